@@ -61,6 +61,26 @@
 #	pragma GCC diagnostic pop
 #endif
 
+#ifdef FBINK_WITH_OPENTYPE
+// NOTE: The (private) declarations were already pulled in by fbink_internal.h, this is the implementation.
+#	define STB_TRUETYPE_IMPLEMENTATION
+// Disable a bunch of very verbose but mostly harmless warnings
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#	pragma clang diagnostic ignored "-Wunknown-warning-option"
+#	pragma GCC diagnostic ignored "-Wcast-qual"
+#	pragma GCC diagnostic ignored "-Wcast-align"
+#	pragma GCC diagnostic ignored "-Wconversion"
+#	pragma GCC diagnostic ignored "-Wsign-conversion"
+#	pragma GCC diagnostic ignored "-Wbad-function-cast"
+#	pragma GCC diagnostic ignored "-Wshadow"
+#	pragma GCC diagnostic ignored "-Wduplicated-branches"
+#	pragma GCC diagnostic ignored "-Wunused-parameter"
+#	pragma GCC diagnostic ignored "-Wunused-function"
+#	include "stb/stb_truetype.h"
+#	pragma GCC diagnostic pop
+#endif
+
 // Return the library version as devised at library compile-time
 const char*
     fbink_version(void)
@@ -81,16 +101,20 @@ static void
 	// or: v * 16 / 256
 
 	// We can't address nibbles directly, so this takes some shenanigans...
+	// NOTE: This is a read-modify-write on the fb for every single pixel, which is why nothing performance sensitive
+	//       goes through here (c.f., fill_rect_Gray4, expand_mask_Gray4 & the 4bpp codepath in fbink_print_image).
+	unsigned char* p = fbPtr + pix_offset;
 	if ((coords->x & 0x01) == 0) {
 		// Even pixel: high nibble
-		*((unsigned char*) (fbPtr + pix_offset)) = (color->r & 0xF0);
-		// Squash to 4bpp, and write to the top/left nibble
+		// Squash to 4bpp, and write to the top/left nibble, without clobbering our odd neighbor
 		// or: ((v >> 4) << 4)
+		*p = (unsigned char) ((*p & 0x0F) | (color->r & 0xF0));
 	} else {
 		// Odd pixel: low nibble
-		// ORed to avoid clobbering our even pixel
-		*((unsigned char*) (fbPtr + pix_offset)) |= (color->r >> 4U);
+		// Squash to 4bpp, and write to the bottom/right nibble, without clobbering our even neighbor
+		*p = (unsigned char) ((*p & 0xF0) | (color->r >> 4U));
 	}
+	damage_rect(coords->x, coords->y, 1U, 1U);
 }
 
 static void
@@ -101,6 +125,7 @@ static void
 
 	// now this is about the same as 'fbp[pix_offset] = value'
 	*((unsigned char*) (fbPtr + pix_offset)) = color->r;
+	damage_rect(coords->x, coords->y, 1U, 1U);
 }
 
 static void
@@ -114,6 +139,7 @@ static void
 	*((unsigned char*) (fbPtr + pix_offset))     = color->b;
 	*((unsigned char*) (fbPtr + pix_offset + 1)) = color->g;
 	*((unsigned char*) (fbPtr + pix_offset + 2)) = color->r;
+	damage_rect(coords->x, coords->y, 1U, 1U);
 }
 
 static void
@@ -130,6 +156,7 @@ static void
 	// Opaque, always. Note that everything is rendered as opaque, no matter what.
 	// But at least this way we ensure fb grabs are consistent with what's seen on screen.
 	*((unsigned char*) (fbPtr + pix_offset + 3)) = 0xFF;
+	damage_rect(coords->x, coords->y, 1U, 1U);
 
 	// NOTE: Trying to retrofit FBInkPixelBGRA into this doesn't appear to net us anything noticeable...
 }
@@ -150,6 +177,7 @@ static void
 #pragma GCC diagnostic ignored "-Wcast-align"
 	*((uint16_t*) (fbPtr + pix_offset)) = c;
 #pragma GCC diagnostic pop
+	damage_rect(coords->x, coords->y, 1U, 1U);
 }
 
 #ifndef FBINK_FOR_KINDLE
@@ -157,8 +185,27 @@ static void
 static void
     rotate_coordinates(FBInkCoordinates* coords)
 {
-	unsigned short int rx = coords->y;
-	unsigned short int ry = (unsigned short int) (screenWidth - coords->x - 1);
+	// NOTE: c.f., set_view_rotation for the whole picture
+	unsigned short int rx;
+	unsigned short int ry;
+	switch (viewRotation.rotate) {
+		case FB_ROTATE_CW:
+			rx = coords->y;
+			ry = (unsigned short int) (screenWidth - coords->x - 1);
+			break;
+		case FB_ROTATE_UD:
+			rx = (unsigned short int) (screenWidth - coords->x - 1);
+			ry = (unsigned short int) (screenHeight - coords->y - 1);
+			break;
+		case FB_ROTATE_CCW:
+			rx = (unsigned short int) (screenHeight - coords->y - 1);
+			ry = coords->x;
+			break;
+		default:
+			rx = coords->x;
+			ry = coords->y;
+			break;
+	}
 
 // NOTE: This codepath is not production ready, it was just an experiment to wrap my head around framebuffer rotation...
 //       In particular, only CW has been actually confirmed to behave properly (to handle the isKobo16Landscape quirk),
@@ -222,34 +269,6 @@ static void
 	// https://github.com/NiLuJe/FBInk/commit/75407d4a44d7bfc7705665ad4ec9ecad0d03a368).
 }
 
-// Handle a few sanity checks...
-static void
-    put_pixel(FBInkCoordinates* coords, FBInkColor* color)
-{
-	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
-	(*fxpRotateCoords)(coords);
-
-	// NOTE: Discard off-screen pixels!
-	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
-	//       when we're padding and centering, the final whitespace of right-padding will have its last
-	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
-	if (coords->x >= vInfo.xres || coords->y >= vInfo.yres) {
-#ifdef DEBUG
-		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
-		//       and does not necessarily indicate an actual issue, as we've just explained...
-		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
-		    coords->x,
-		    coords->y,
-		    vInfo.xres,
-		    vInfo.yres);
-#endif
-		return;
-	}
-
-	// fbink_init() takes care of setting this global pointer to the right function for the fb's bpp
-	(*fxpPutPixel)(coords, color);
-}
-
 // Helper functions to 'get' a specific pixel's color from the framebuffer
 // c.f., FBGrab convert* functions
 //       (http://trac.ak-team.com/trac/browser/niluje/Configs/trunk/Kindle/Misc/FBGrab/fbgrab.c#L402)
@@ -266,26 +285,21 @@ static void
 	// Lo:
 	// ((b) & 0x0F)
 
-	if ((coords->x & 0x01) == 0) {
-		// calculate the pixel's byte offset inside the buffer
-		// note: x / 2 as every byte holds 2 pixels
-		size_t  pix_offset = (coords->x >> 1U) + (coords->y * fInfo.line_length);
-		uint8_t b          = *((unsigned char*) (fbPtr + pix_offset));
+	// calculate the pixel's byte offset inside the buffer
+	// note: x / 2 as every byte holds 2 pixels
+	size_t  pix_offset = (coords->x >> 1U) + (coords->y * fInfo.line_length);
+	uint8_t b          = *((unsigned char*) (fbPtr + pix_offset));
 
+	if ((coords->x & 0x01) == 0) {
 		// Even pixel: high nibble
 		uint8_t v = (b & 0xF0);
 		color->r  = (v | (v >> 4U));
 		// pull the top/left nibble, expanded to 8bit
 		// or: (uint8_t)((((b) >> 4) & 0x0F) * 0x11);
-
-		// We need to get the low nibble *now*, before it gets clobbered by our alpha-blending put...
-		// Thankfully, we have two empty channels in our color struct that we can use ;).
-		color->g = (uint8_t)((b & 0x0F) * 0x11);
-		// or: pull the low/right nibble, expanded to 8bit
 	} else {
 		// Odd pixel: low nibble
-		// We just have to point to what we got during the even pixel pass ;).
-		color->r = color->g;
+		color->r = (uint8_t)((b & 0x0F) * 0x11);
+		// pull the low/right nibble, expanded to 8bit
 	}
 }
 
@@ -331,6 +345,28 @@ static void
 	//       as that's how it behaves.
 }
 
+// Expand an RGB565 pixel back to 8 bits per component
+static inline __attribute__((always_inline)) void
+    unpack_pixel_RGB565(uint16_t v, FBInkColor* color)
+{
+	// NOTE: We're assuming RGB565 and not BGR565 here (as well as in put_pixel_RGB565)...
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+
+	// NOTE: c.f., https://stackoverflow.com/q/2442576
+	//       I feel that this approach tracks better with what we do in put_pixel_RGB565,
+	//       and I have an easier time following it than the previous approach ported from KOReader.
+	//       Both do exactly the same thing, though ;).
+	r = (uint8_t)((v & 0xF800) >> 11U);
+	g = (v & 0x07E0) >> 5U;
+	b = (v & 0x001F);
+
+	color->r = (uint8_t)((r << 3U) | (r >> 2U));
+	color->g = (uint8_t)((g << 2U) | (g >> 4U));
+	color->b = (uint8_t)((b << 3U) | (b >> 2U));
+}
+
 static void
     get_pixel_RGB565(FBInkCoordinates* coords, FBInkColor* color)
 {
@@ -338,73 +374,667 @@ static void
 	// note: x * 2 as every pixel is 2 consecutive bytes
 	size_t pix_offset = (uint32_t)(coords->x << 1U) + (coords->y * fInfo.line_length);
 
-	// NOTE: We're assuming RGB565 and not BGR565 here (as well as in put_pixel)...
 	uint16_t v;
-	uint8_t  r;
-	uint8_t  g;
-	uint8_t  b;
 	// Like put_pixel_RGB565, read those two consecutive bytes at once
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
 	v = *((uint16_t*) (fbPtr + pix_offset));
 #pragma GCC diagnostic pop
 
-	// NOTE: c.f., https://stackoverflow.com/q/2442576
-	//       I feel that this approach tracks better with what we do in put_pixel_RGB565,
-	//       and I have an easier time following it than the previous approach ported from KOReader.
-	//       Both do exactly the same thing, though ;).
-	r = (uint8_t)((v & 0xF800) >> 11U);
-	g = (v & 0x07E0) >> 5U;
-	b = (v & 0x001F);
+	unpack_pixel_RGB565(v, color);
+}
 
-	color->r = (uint8_t)((r << 3U) | (r >> 2U));
-	color->g = (uint8_t)((g << 2U) | (g >> 4U));
-	color->b = (uint8_t)((b << 3U) | (b >> 2U));
+// Helper functions to fill a rectangle in a given color, one span writer per bpp.
+// NOTE: Unlike put_pixel_*, these expect a rectangle that has already been rotated & clipped (c.f., fill_rect),
+//       so they can pack the color once, and then write whole rows in one go.
+static void
+    fill_rect_Gray4(unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  color)
+{
+	// Pack two pixels in a single byte
+	uint8_t v  = color->r & 0xF0;
+	uint8_t px = (uint8_t)(v | (v >> 4U));
+	damage_rect(x, y, w, h);
+
+	for (unsigned short int cy = 0U; cy < h; cy++) {
+		// note: x / 2 as every byte holds 2 pixels
+		unsigned char*     p = (unsigned char*) (fbPtr + (x >> 1U) + ((y + cy) * fInfo.line_length));
+		unsigned short int n = w;
+
+		// If we start on an odd pixel, we only get to touch the low nibble of the first byte...
+		if ((x & 0x01) != 0) {
+			*p = (unsigned char) ((*p & 0xF0) | (v >> 4U));
+			p++;
+			n--;
+		}
+		// Then we can fill full bytes
+		memset(p, px, n >> 1U);
+		// And if we end on an even pixel, we only get to touch the high nibble of the final byte.
+		if ((n & 0x01) != 0) {
+			p += n >> 1U;
+			*p = (unsigned char) ((*p & 0x0F) | v);
+		}
+	}
 }
 
-// Handle a few sanity checks...
 static void
-    get_pixel(FBInkCoordinates* coords, FBInkColor* color)
-{
-	// Handle rotation now, so we can properly validate if the pixel is off-screen or not ;).
-	(*fxpRotateCoords)(coords);
-
-	// NOTE: Discard off-screen pixels!
-	//       For instance, when we have a halfcell offset in conjunction with a !isPerfectFit pixel offset,
-	//       when we're padding and centering, the final whitespace of right-padding will have its last
-	//       few pixels (the exact amount being half of the dead zone width) pushed off-screen...
-	if (coords->x >= vInfo.xres || coords->y >= vInfo.yres) {
-#ifdef DEBUG
-		// NOTE: This is only enabled in Debug builds because it can be pretty verbose,
-		//       and does not necessarily indicate an actual issue, as we've just explained...
-		LOG("Put: discarding off-screen pixel @ (%hu, %hu) (out of %ux%u bounds)",
-		    coords->x,
-		    coords->y,
-		    vInfo.xres,
-		    vInfo.yres);
-#endif
+    fill_rect_Gray8(unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  color)
+{
+	damage_rect(x, y, w, h);
+	// If we span the full line, we can fill the whole thing at once
+	if (x == 0U && w == fInfo.line_length) {
+		memset(fbPtr + (y * fInfo.line_length), color->r, (size_t)(w * h));
 		return;
 	}
 
+	for (unsigned short int cy = 0U; cy < h; cy++) {
+		memset(fbPtr + x + ((y + cy) * fInfo.line_length), color->r, w);
+	}
+}
+
+static void
+    fill_rect_RGB24(unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  color)
+{
+	damage_rect(x, y, w, h);
+	for (unsigned short int cy = 0U; cy < h; cy++) {
+		// note: x * 3 as every pixel is 3 consecutive bytes
+		unsigned char* p = (unsigned char*) (fbPtr + (x * 3U) + ((y + cy) * fInfo.line_length));
+		for (unsigned short int cx = 0U; cx < w; cx++) {
+			*p++ = color->b;
+			*p++ = color->g;
+			*p++ = color->r;
+		}
+	}
+}
+
+static void
+    fill_rect_RGB32(unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  color)
+{
+	// Pack the pixel once, and write it in one go (opaque, like put_pixel_RGB32)
+	FBInkPixelBGRA px;
+	px.color.b = color->b;
+	px.color.g = color->g;
+	px.color.r = color->r;
+	px.color.a = 0xFF;
+	damage_rect(x, y, w, h);
+
+	for (unsigned short int cy = 0U; cy < h; cy++) {
+		// note: x * 4 as every pixel is 4 consecutive bytes
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+		uint32_t* p = (uint32_t*) (fbPtr + (uint32_t)(x << 2U) + ((y + cy) * fInfo.line_length));
+#pragma GCC diagnostic pop
+		for (unsigned short int cx = 0U; cx < w; cx++) {
+			p[cx] = px.p;
+		}
+	}
+}
+
+static void
+    fill_rect_RGB565(unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  color)
+{
+	// Pack the pixel once, like put_pixel_RGB565
+	uint16_t px = (uint16_t)(((color->r >> 3U) << 11U) | ((color->g >> 2U) << 5U) | (color->b >> 3U));
+	damage_rect(x, y, w, h);
+
+	for (unsigned short int cy = 0U; cy < h; cy++) {
+		// note: x * 2 as every pixel is 2 consecutive bytes
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+		uint16_t* p = (uint16_t*) (fbPtr + (uint32_t)(x << 1U) + ((y + cy) * fInfo.line_length));
+#pragma GCC diagnostic pop
+		for (unsigned short int cx = 0U; cx < w; cx++) {
+			p[cx] = px;
+		}
+	}
+}
+
+// Helper function to compute the visible part of a span of len pixels starting at offs on an axis that's limit pixels long.
+// Stores it as a [start, end) range relative to offs, and returns false if the whole span is off-screen.
+// NOTE: Callers rely on wraparound on underflow to point to off-screen coordinates (c.f., draw),
+//       so we honor that: a span that wraps around may still have a visible part starting at 0.
+// NOTE: Clipping is expected, and doesn't necessarily indicate an actual issue: for instance, when we have a halfcell offset
+//       in conjunction with a !isPerfectFit pixel offset, when we're padding and centering,
+//       the final whitespace of right-padding will have its last few pixels pushed off-screen...
+static inline bool
+    clip_span(unsigned short int  offs,
+	      unsigned short int  len,
+	      uint32_t            limit,
+	      unsigned short int* start,
+	      unsigned short int* end)
+{
+	if (offs < limit) {
+		*start = 0U;
+		*end   = (unsigned short int) MIN(len, limit - offs);
+	} else {
+		// Either we're past the edge of the screen, or we've wrapped around...
+		uint32_t skip = UINT16_MAX + 1U - offs;
+		if (skip >= len) {
+			return false;
+		}
+		*start = (unsigned short int) skip;
+		*end   = (unsigned short int) MIN(len, skip + limit);
+	}
+
+	return true;
+}
+
+// Helper function to fill a rectangle in given color, clipping & rotating it as needed.
+// Returns false if it was entirely off-screen.
+static bool
+    fill_area(unsigned short int x, unsigned short int y, unsigned short int w, unsigned short int h, const FBInkColor* color)
+{
+	// NOTE: Discard off-screen pixels, once for the whole rectangle.
+	unsigned short int x_start;
+	unsigned short int x_end;
+	unsigned short int y_start;
+	unsigned short int y_end;
+	if (!clip_span(x, w, screenWidth, &x_start, &x_end) || !clip_span(y, h, screenHeight, &y_start, &y_end)) {
+		return false;
+	}
+	x = (unsigned short int) (x + x_start);
+	y = (unsigned short int) (y + y_start);
+	w = (unsigned short int) (x_end - x_start);
+	h = (unsigned short int) (y_end - y_start);
+
+	// Handle rotation, if need be.
+	rotate_area(&x, &y, &w, &h);
+
 	// fbink_init() takes care of setting this global pointer to the right function for the fb's bpp
-	(*fxpGetPixel)(coords, color);
+	(*fxpFillRect)(x, y, w, h, color);
+	return true;
 }
 
 // Helper function to draw a rectangle in given color
 static void
     fill_rect(unsigned short int x, unsigned short int y, unsigned short int w, unsigned short int h, FBInkColor* color)
 {
-	FBInkCoordinates coords = { 0U };
+	if (fill_area(x, y, w, h, color)) {
+		LOG("Filled a %hux%hu rectangle @ (%hu, %hu)", w, h, x, y);
+	} else {
+		LOG("Discarding an off-screen %hux%hu rectangle @ (%hu, %hu)", w, h, x, y);
+	}
+}
+
+// Helper functions to XOR a span of bytes in the fb, a machine word at a time (c.f., overlay mode).
+// alpha is a packed pixel of bits that should always end up set in the pixels we touch (i.e., alpha at 32bpp,
+// as we always render opaque pixels, c.f., put_pixel_RGB32).
+// NOTE: We only ever get spans that start on a pixel boundary, so alpha's pattern repeats nicely in a word.
+//       And since we only ever get whole pixels at 32bpp, alpha doesn't need any care in the tail.
+static void
+    xor_span(unsigned char* dst, const unsigned char* mask, size_t len, uint32_t alpha)
+{
+	const uintptr_t alpha_w = (uintptr_t) alpha * (UINTPTR_MAX / UINT32_MAX);
+	size_t          i       = 0U;
+	for (; i + sizeof(uintptr_t) <= len; i += sizeof(uintptr_t)) {
+		uintptr_t m;
+		memcpy(&m, mask + i, sizeof(m));
+		// Don't even touch the fb if there's nothing to flip
+		if (m != 0U) {
+			uintptr_t d;
+			memcpy(&d, dst + i, sizeof(d));
+			d = (d ^ m) | (m & alpha_w);
+			memcpy(dst + i, &d, sizeof(d));
+		}
+	}
+	for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+		uint32_t m;
+		memcpy(&m, mask + i, sizeof(m));
+		if (m != 0U) {
+			uint32_t d;
+			memcpy(&d, dst + i, sizeof(d));
+			d = (d ^ m) | (m & alpha);
+			memcpy(dst + i, &d, sizeof(d));
+		}
+	}
+	for (; i < len; i++) {
+		dst[i] ^= mask[i];
+	}
+}
+
+static void
+    invert_span(unsigned char* dst, size_t len, uint32_t alpha)
+{
+	const uintptr_t alpha_w = (uintptr_t) alpha * (UINTPTR_MAX / UINT32_MAX);
+	size_t          i       = 0U;
+	for (; i + sizeof(uintptr_t) <= len; i += sizeof(uintptr_t)) {
+		uintptr_t d;
+		memcpy(&d, dst + i, sizeof(d));
+		d = ~d | alpha_w;
+		memcpy(dst + i, &d, sizeof(d));
+	}
+	for (; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+		uint32_t d;
+		memcpy(&d, dst + i, sizeof(d));
+		d = ~d | alpha;
+		memcpy(dst + i, &d, sizeof(d));
+	}
+	for (; i < len; i++) {
+		dst[i] ^= 0xFF;
+	}
+}
+
+// Helper function to invert the pixels of a rectangle that has already been rotated & clipped (c.f., overlay mode).
+// NOTE: Inverting every 8-bit component before packing them back is the same as inverting every packed component,
+//       so this boils down to flipping every bit of every pixel, whatever the bpp ;).
+//       Like render_glyph, meant to be specialized at compile-time for a given bpp.
+static inline __attribute__((always_inline)) void
+    invert_rect(uint8_t bpp, unsigned short int x, unsigned short int y, unsigned short int w, unsigned short int h)
+{
+	// Keep it opaque at 32bpp, like put_pixel_RGB32
+	const uint32_t alpha = (bpp == 32U) ? 0xFF000000U : 0U;
+	damage_rect(x, y, w, h);
 	for (unsigned short int cy = 0U; cy < h; cy++) {
-		for (unsigned short int cx = 0U; cx < w; cx++) {
-			coords.x = (unsigned short int) (x + cx);
-			coords.y = (unsigned short int) (y + cy);
-			put_pixel(&coords, color);
+		unsigned char* row = fbPtr + ((y + cy) * fInfo.line_length);
+		if (bpp == 4U) {
+			// note: x / 2 as every byte holds 2 pixels, so take care of a potential half-byte on either side.
+			unsigned char*     p = row + (x >> 1U);
+			unsigned short int n = w;
+			if ((x & 0x01) != 0) {
+				*p++ ^= 0x0F;
+				n--;
+			}
+			invert_span(p, n >> 1U, 0U);
+			if ((n & 0x01) != 0) {
+				p[n >> 1U] ^= 0xF0;
+			}
+		} else {
+			const uint8_t Bpp = (uint8_t)(bpp >> 3U);
+			invert_span(row + (x * Bpp), (size_t)(w * Bpp), alpha);
+		}
+	}
+}
+
+// Helper function to paint a run of a glyph's foreground pixels, in view coordinates, already clipped to the view.
+// NOTE: Unlike fill_area, we're only ever called from the specialized renderers (c.f., render_glyph),
+//       so we can skip the clipping, and pick the right span writer at compile-time instead of going through fxpFillRect.
+static inline __attribute__((always_inline)) void
+    paint_glyph_run(uint8_t            bpp,
+		    uint8_t            mode,
+		    unsigned short int x,
+		    unsigned short int y,
+		    unsigned short int w,
+		    unsigned short int h,
+		    const FBInkColor*  fgC)
+{
+	// Handle rotation, if need be (c.f., fill_area).
+	rotate_area(&x, &y, &w, &h);
+
+	if (mode == GLYPH_MODE_OVERLAY) {
+		// In overlay mode, we print foreground pixels in the inverse color of the underlying pixel.
+		// Obviously, the closer we get to GRAY7, the less contrast we get.
+		invert_rect(bpp, x, y, w, h);
+		return;
+	}
+
+	switch (bpp) {
+		case 4U:
+			fill_rect_Gray4(x, y, w, h, fgC);
+			break;
+		case 8U:
+			fill_rect_Gray8(x, y, w, h, fgC);
+			break;
+		case 16U:
+			fill_rect_RGB565(x, y, w, h, fgC);
+			break;
+		case 24U:
+			fill_rect_RGB24(x, y, w, h, fgC);
+			break;
+		case 32U:
+		default:
+			fill_rect_RGB32(x, y, w, h, fgC);
+			break;
+	}
+}
+
+// Helper function to pack a color in the fb's pixel format
+static inline __attribute__((always_inline)) uint32_t
+    pack_pixel(uint8_t bpp, const FBInkColor* color)
+{
+	if (bpp == 16U) {
+		// c.f., put_pixel_RGB565
+		return (uint32_t)(((color->r >> 3U) << 11U) | ((color->g >> 2U) << 5U) | (color->b >> 3U));
+	} else if (bpp > 16U) {
+		// c.f., put_pixel_RGB32 (opaque, always)
+		FBInkPixelBGRA px;
+		px.color.b = color->b;
+		px.color.g = color->g;
+		px.color.r = color->r;
+		px.color.a = 0xFF;
+		return px.p;
+	} else {
+		return color->r;
+	}
+}
+
+// Generic glyph renderer, meant to be specialized at compile-time, hence all the constant parameters ;).
+// Renders the glyph's bitmap (rows of glyphWidth bits wide masks) scaled by FONTSIZE_MULT, with its top-left corner @ (x_offs, y_offs).
+static inline __attribute__((always_inline)) void
+    render_glyph(const uint32_t*    bitmap,
+		 uint8_t            bpp,
+		 uint8_t            mode,
+		 unsigned short int x_offs,
+		 unsigned short int y_offs,
+		 const FBInkColor*  fgC,
+		 const FBInkColor*  bgC)
+{
+	// Compute the visible part of the glyph once, instead of discarding off-screen pixels one by one...
+	unsigned short int x_start;
+	unsigned short int x_end;
+	unsigned short int y_start;
+	unsigned short int y_end;
+	if (!clip_span(x_offs, FONTW, screenWidth, &x_start, &x_end) ||
+	    !clip_span(y_offs, FONTH, screenHeight, &y_start, &y_end)) {
+		return;
+	}
+
+	// NOTE: We only fetch a bitmap row once per input row, and from there, we generate the extra rows
+	//       given our scaling factor.
+	unsigned short int j = y_start;
+	if (mode == GLYPH_MODE_BG || (mode == GLYPH_MODE_OVERLAY && viewRotation.rotate == FB_ROTATE_UR)) {
+		// We paint every pixel, so, render each bitmap row once at the target width,
+		// and copy it to each of the FONTSIZE_MULT output rows it maps to.
+		// In overlay mode, we do the same, except what we render is a XOR mask,
+		// with every bit of foreground pixels set, that we then XOR into the fb, a word at a time.
+		const bool     is_overlay = (mode == GLYPH_MODE_OVERLAY);
+		const uint8_t  phase      = (bpp == 4U) ? (x_offs & 0x01) : 0U;
+		// NOTE: i.e., a packed pixel with every bit set (4bpp pixels are packed as a full byte, c.f., pack_pixel).
+		const uint32_t xorP       = (bpp == 32U) ? UINT32_MAX : ((1U << ((bpp == 4U) ? 8U : bpp)) - 1U);
+		const uint32_t fgP        = is_overlay ? xorP : pack_pixel(bpp, fgC);
+		const uint32_t bgP        = is_overlay ? 0U : pack_pixel(bpp, bgC);
+		unsigned char  row[(bpp == 4U) ? ((phase + FONTW + 1U) >> 1U) : (FONTW * (bpp >> 3U))];
+		while (j < y_end) {
+			// y: input row
+			uint8_t            y     = (uint8_t)(j / FONTSIZE_MULT);
+			// Each element encodes a full row, which we expand in one go.
+			uint32_t           mask  = bitmap[y];
+			// Last output row for this input row
+			unsigned short int j_end = (unsigned short int) MIN(y_end, (y + 1U) * FONTSIZE_MULT);
+			if (is_overlay) {
+				// Nothing to flip in a blank row ;).
+				if (mask != 0U) {
+					expand_glyph_row(mask, fgP, bgP, phase, row);
+					xor_glyph_rows(bpp,
+						       row,
+						       phase,
+						       x_offs,
+						       x_start,
+						       x_end,
+						       (unsigned short int) (y_offs + j),
+						       (unsigned short int) (j_end - j));
+				}
+			} else {
+				expand_glyph_row(mask, fgP, bgP, phase, row);
+				copy_glyph_rows(bpp,
+						row,
+						phase,
+						x_offs,
+						x_start,
+						x_end,
+						(unsigned short int) (y_offs + j),
+						(unsigned short int) (j_end - j));
+			}
+			j = j_end;
+		}
+		return;
+	}
+
+	// Otherwise (bgless mode, or overlay mode on a rotated view),
+	// each run of identical bits in a bitmap row is simply a rectangle...
+	while (j < y_end) {
+		// y: input row
+		uint8_t            y     = (uint8_t)(j / FONTSIZE_MULT);
+		// Each element encodes a full row, we access a column's bit in that row by shifting.
+		uint32_t           mask  = bitmap[y];
+		// Last output row for this input row
+		unsigned short int j_end = (unsigned short int) MIN(y_end, (y + 1U) * FONTSIZE_MULT);
+		unsigned short int i     = x_start;
+		while (i < x_end) {
+			// x: input column
+			uint8_t x     = (uint8_t)(i / FONTSIZE_MULT);
+			bool    is_fg = !!(mask & 1U << x);
+			// Look for the end of this run
+			uint8_t xe    = (uint8_t)(x + 1U);
+			while (xe < glyphWidth && !!(mask & 1U << xe) == is_fg) {
+				xe++;
+			}
+			unsigned short int i_end = (unsigned short int) MIN(x_end, xe * FONTSIZE_MULT);
+			// We don't paint background pixels.
+			if (is_fg) {
+				paint_glyph_run(bpp,
+						mode,
+						(unsigned short int) (x_offs + i),
+						(unsigned short int) (y_offs + j),
+						(unsigned short int) (i_end - i),
+						(unsigned short int) (j_end - j),
+						fgC);
+			}
+			i = i_end;
 		}
+		j = j_end;
 	}
-	LOG("Filled a %hux%hu rectangle @ (%hu, %hu)", w, h, x, y);
 }
 
+// Expand a glyph's bitmap row (scaled by FONTSIZE_MULT) into FONTW pixels in the fb's pixel format @ dst.
+// NOTE: On 4bpp fbs, phase tells us whether the first pixel lives in the low nibble (c.f., scale_glyph_mask).
+static void
+    expand_glyph_row(uint32_t mask, uint32_t fgP, uint32_t bgP, uint8_t phase, unsigned char* dst)
+{
+	// Scale the bitmap row to a mask stream first, so that we can expand it 8 pixels at a time (c.f., fbink_expand.c)
+	uint8_t smask[(phase + FONTW + 7U) >> 3U];
+	scale_glyph_mask(mask, phase, smask);
+	expand_mask(smask, (unsigned short int) (phase + FONTW), fgP, bgP, dst);
+}
+
+// Fetch a glyph's tile from the glyph cache, rendering it on a cache miss.
+// Returns NULL if it can't be cached (in which case, the caller should simply render it straight to the fb).
+static const FBInkGlyphTile*
+    get_glyph_tile(uint32_t codepoint, unsigned short int x_offs, uint32_t fgP, uint32_t bgP)
+{
+	const uint8_t bpp   = (uint8_t) vInfo.bits_per_pixel;
+	const uint8_t phase = (bpp == 4U) ? (x_offs & 0x01) : 0U;
+
+	FBInkGlyphTile* tile = glyph_cache_lookup(codepoint, fgP, bgP, phase);
+	if (tile) {
+		return tile;
+	}
+
+	size_t pitch = (bpp == 4U) ? (size_t)((FONTW + phase + 1U) >> 1U) : (size_t)(FONTW * (bpp >> 3U));
+	tile         = glyph_cache_insert(codepoint, fgP, bgP, phase, pitch, glyphHeight, FONTW);
+	if (!tile) {
+		return NULL;
+	}
+
+	// Render each bitmap row once at the target width, the scaled rows are just copies (c.f., blit_glyph_tile).
+	uint32_t bitmap[GLYPH_MAX_HEIGHT];
+	resolve_glyph(codepoint, bitmap);
+	for (uint8_t y = 0U; y < glyphHeight; y++) {
+		unsigned char* row = tile->data + (y * pitch);
+		expand_glyph_row(bitmap[y], fgP, bgP, phase, row);
+	}
+
+	return tile;
+}
+
+// Copy the visible part [x_start, x_end) of a row of FONTW pixels in the fb's pixel format
+// (starting on the same nibble as x_offs on 4bpp fbs, c.f., expand_glyph_row) to count fb rows, starting @ (x_offs, fy).
+// NOTE: Like render_glyph, meant to be specialized at compile-time for a given bpp.
+static inline __attribute__((always_inline)) void
+    copy_glyph_rows(uint8_t              bpp,
+		    const unsigned char* src,
+		    uint8_t              phase,
+		    unsigned short int   x_offs,
+		    unsigned short int   x_start,
+		    unsigned short int   x_end,
+		    unsigned short int   fy,
+		    unsigned short int   count)
+{
+	unsigned short int fx = (unsigned short int) (x_offs + x_start);
+
+	// Let the rotation-aware blitter deal with rotated views (never 4bpp, c.f., set_view_rotation)
+	if (bpp != 4U && viewRotation.rotate != FB_ROTATE_UR) {
+		blit_rotated(src + (x_start * (bpp >> 3U)), 0U, fx, fy, (unsigned short int) (x_end - x_start), count);
+		return;
+	}
+	damage_rect(fx, fy, (uint32_t)(x_end - x_start), count);
+
+	if (bpp == 4U) {
+		// NOTE: The row starts on the same nibble as x_offs, so things line up nicely byte-wise,
+		//       we just have to take care of a potential half-byte on either side.
+		const unsigned char* r0 = src + ((phase + x_start) >> 1U);
+		for (unsigned short int l = 0U; l < count; l++) {
+			unsigned char*       dst = fbPtr + ((fy + l) * fInfo.line_length) + (fx >> 1U);
+			const unsigned char* row = r0;
+			unsigned short int   n   = (unsigned short int) (x_end - x_start);
+			if ((fx & 0x01) != 0) {
+				*dst = (unsigned char) ((*dst & 0xF0) | (*row & 0x0F));
+				dst++;
+				row++;
+				n--;
+			}
+			memcpy(dst, row, n >> 1U);
+			if ((n & 0x01) != 0) {
+				dst[n >> 1U] = (unsigned char) ((dst[n >> 1U] & 0x0F) | (row[n >> 1U] & 0xF0));
+			}
+		}
+	} else {
+		const uint8_t Bpp = (uint8_t)(bpp >> 3U);
+		for (unsigned short int l = 0U; l < count; l++) {
+			memcpy(fbPtr + ((fy + l) * fInfo.line_length) + (fx * Bpp),
+			       src + (x_start * Bpp),
+			       (size_t)((x_end - x_start) * Bpp));
+		}
+	}
+}
+
+// Same as copy_glyph_rows, but XORs a mask row (c.f., render_glyph) into the fb instead, on an upright view.
+static inline __attribute__((always_inline)) void
+    xor_glyph_rows(uint8_t              bpp,
+		   const unsigned char* mask,
+		   uint8_t              phase,
+		   unsigned short int   x_offs,
+		   unsigned short int   x_start,
+		   unsigned short int   x_end,
+		   unsigned short int   fy,
+		   unsigned short int   count)
+{
+	unsigned short int fx = (unsigned short int) (x_offs + x_start);
+	damage_rect(fx, fy, (uint32_t)(x_end - x_start), count);
+
+	if (bpp == 4U) {
+		// NOTE: Same nibble juggling as in copy_glyph_rows, except we just have to mask out the other nibble.
+		const unsigned char* m0 = mask + ((phase + x_start) >> 1U);
+		for (unsigned short int l = 0U; l < count; l++) {
+			unsigned char*       p = fbPtr + ((fy + l) * fInfo.line_length) + (fx >> 1U);
+			const unsigned char* m = m0;
+			unsigned short int   n = (unsigned short int) (x_end - x_start);
+			if ((fx & 0x01) != 0) {
+				*p++ ^= (*m++ & 0x0F);
+				n--;
+			}
+			xor_span(p, m, n >> 1U, 0U);
+			if ((n & 0x01) != 0) {
+				p[n >> 1U] ^= (m[n >> 1U] & 0xF0);
+			}
+		}
+	} else {
+		const uint8_t  Bpp   = (uint8_t)(bpp >> 3U);
+		// Keep it opaque at 32bpp, like put_pixel_RGB32
+		const uint32_t alpha = (Bpp == 4U) ? 0xFF000000U : 0U;
+		for (unsigned short int l = 0U; l < count; l++) {
+			xor_span(fbPtr + ((fy + l) * fInfo.line_length) + (fx * Bpp),
+				 mask + (x_start * Bpp),
+				 (size_t)((x_end - x_start) * Bpp),
+				 alpha);
+		}
+	}
+}
+
+// Draw a cached glyph tile, with its top-left corner @ (x_offs, y_offs)
+// NOTE: Specialized per pixel format alongside the glyph renderers, c.f., fxpBlitGlyphTile.
+static inline __attribute__((always_inline)) void
+    blit_glyph_tile(uint8_t bpp, const FBInkGlyphTile* tile, unsigned short int x_offs, unsigned short int y_offs)
+{
+	unsigned short int x_start;
+	unsigned short int x_end;
+	unsigned short int y_start;
+	unsigned short int y_end;
+	if (!clip_span(x_offs, tile->width, screenWidth, &x_start, &x_end) ||
+	    !clip_span(y_offs, FONTH, screenHeight, &y_start, &y_end)) {
+		return;
+	}
+
+	// NOTE: The tile only holds the glyph's bitmap rows, each of which maps to FONTSIZE_MULT output rows.
+	unsigned short int j = y_start;
+	while (j < y_end) {
+		uint8_t              y     = (uint8_t)(j / FONTSIZE_MULT);
+		const unsigned char* row   = tile->data + (y * tile->pitch);
+		unsigned short int   j_end = (unsigned short int) MIN(y_end, (y + 1U) * FONTSIZE_MULT);
+		copy_glyph_rows(bpp,
+				row,
+				tile->phase,
+				x_offs,
+				x_start,
+				x_end,
+				(unsigned short int) (y_offs + j),
+				(unsigned short int) (j_end - j));
+		j = j_end;
+	}
+}
+
+// Generate the specialized glyph renderers for a given pixel format, as well as their table, indexed by GLYPH_MODE_E,
+// plus the matching glyph tile blitter.
+#define GLYPH_RENDERER(FMT, BPP, MODE_NAME, MODE)                                                                        \
+	static void render_glyph_##FMT##_##MODE_NAME(const uint32_t*    bitmap,                                          \
+						     unsigned short int x_offs,                                          \
+						     unsigned short int y_offs,                                          \
+						     const FBInkColor*  fgC,                                             \
+						     const FBInkColor*  bgC)                                             \
+	{                                                                                                                \
+		render_glyph(bitmap, BPP, MODE, x_offs, y_offs, fgC, bgC);                                               \
+	}
+
+#define GLYPH_RENDERERS(FMT, BPP)                                                                                        \
+	GLYPH_RENDERER(FMT, BPP, bg, GLYPH_MODE_BG)                                                                      \
+	GLYPH_RENDERER(FMT, BPP, bgless, GLYPH_MODE_BGLESS)                                                              \
+	GLYPH_RENDERER(FMT, BPP, overlay, GLYPH_MODE_OVERLAY)                                                            \
+	static const FBInkGlyphRenderer glyphRenderers_##FMT[GLYPH_MODE_MAX] = {                                         \
+		[GLYPH_MODE_BG]      = &render_glyph_##FMT##_bg,                                                         \
+		[GLYPH_MODE_BGLESS]  = &render_glyph_##FMT##_bgless,                                                     \
+		[GLYPH_MODE_OVERLAY] = &render_glyph_##FMT##_overlay,                                                    \
+	};                                                                                                               \
+	static void blit_glyph_tile_##FMT(const FBInkGlyphTile* tile,                                                    \
+					  unsigned short int    x_offs,                                                  \
+					  unsigned short int    y_offs)                                                  \
+	{                                                                                                                \
+		blit_glyph_tile(BPP, tile, x_offs, y_offs);                                                              \
+	}
+
+GLYPH_RENDERERS(Gray4, 4U)
+GLYPH_RENDERERS(Gray8, 8U)
+GLYPH_RENDERERS(RGB565, 16U)
+GLYPH_RENDERERS(RGB24, 24U)
+GLYPH_RENDERERS(RGB32, 32U)
+
 // Helper function to clear the screen - fill whole screen with given color
 static void
     clear_screen(int fbfd UNUSED_BY_NOTKINDLE, uint8_t v, bool is_flashing UNUSED_BY_NOTKINDLE)
@@ -429,6 +1059,13 @@ static void
 			}
 
 			LOG("Requested a flashing WHITE clear, only doing an FBIO_EINK_CLEAR_SCREEN to save some time!");
+			// Keep our shadow in sync, since it's already been taken care of on the fb side...
+			if (shadowPtr) {
+				memset(shadowPtr, v, fInfo.line_length * vInfo.yres_virtual);
+			}
+			if (frontPtr) {
+				memset(frontPtr, v, fInfo.line_length * vInfo.yres_virtual);
+			}
 			return;
 		}
 		// NOTE: And because we can't have nice things, the einkfb driver has a stupid "optimization",
@@ -437,38 +1074,127 @@ static void
 		//       Do a slightly more targeted memset instead (line_length * yres_virtual),
 		//       which should cover the active & visible buffer only...
 		memset(fbPtr, v, fInfo.line_length * vInfo.yres_virtual);
+		damage_rect(0U, 0U, vInfo.xres, vInfo.yres);
 		// And get out now, we don't want to pile another full memset on top of that ;).
 		return;
 	}
 #endif
 	memset(fbPtr, v, fInfo.smem_len);
+	damage_rect(0U, 0U, vInfo.xres, vInfo.yres);
 }
 
-// Return the font8x8 bitmap for a specific Unicode codepoint
+// Return the font8x8 bitmap for a specific Unicode codepoint (NULL if it's not covered)
 static const unsigned char*
     font8x8_get_bitmap(uint32_t codepoint)
 {
 	// Get the bitmap for the character mapped to that Unicode codepoint
+	// NOTE: Some of these blocks may have been left out of this build (c.f., RANGES in the Makefile)
 	if (codepoint <= 0x7F) {
 		return font8x8_basic[codepoint];
-	} else if (codepoint >= 0x80 && codepoint <= 0x9F) {
+	}
+#ifdef FBINK_WITH_FONT8X8_CONTROL
+	if (codepoint >= 0x80 && codepoint <= 0x9F) {
 		return font8x8_control[codepoint - 0x80];
-	} else if (codepoint >= 0xA0 && codepoint <= 0xFF) {
+	}
+#endif
+#ifdef FBINK_WITH_FONT8X8_EXT_LATIN
+	if (codepoint >= 0xA0 && codepoint <= 0xFF) {
 		return font8x8_ext_latin[codepoint - 0xA0];
-	} else if (codepoint >= 0x390 && codepoint <= 0x3C9) {
+	}
+#endif
+#ifdef FBINK_WITH_FONT8X8_GREEK
+	if (codepoint >= 0x390 && codepoint <= 0x3C9) {
 		return font8x8_greek[codepoint - 0x390];
-	} else if (codepoint >= 0x2500 && codepoint <= 0x257F) {
+	}
+#endif
+#ifdef FBINK_WITH_FONT8X8_BOX
+	if (codepoint >= 0x2500 && codepoint <= 0x257F) {
 		return font8x8_box[codepoint - 0x2500];
-	} else if (codepoint >= 0x2580 && codepoint <= 0x259F) {
+	}
+#endif
+#ifdef FBINK_WITH_FONT8X8_BLOCK
+	if (codepoint >= 0x2580 && codepoint <= 0x259F) {
 		return font8x8_block[codepoint - 0x2580];
-	} else if (codepoint >= 0x3040 && codepoint <= 0x309F) {
+	}
+#endif
+#ifdef FBINK_WITH_FONT8X8_HIRAGANA
+	if (codepoint >= 0x3040 && codepoint <= 0x309F) {
 		return font8x8_hiragana[codepoint - 0x3040];
-	} else {
-		// NOTE: Print a blank space for unknown codepoints
-		fprintf(stderr, "[FBInk] Codepoint U+%04X is not covered by this font!\n", codepoint);
-		return font8x8_basic[0];
 	}
+#endif
+
+	return NULL;
+}
+
+// Unpack the font8x8 glyph for a specific Unicode codepoint, returns false if it's not covered
+static bool
+    font8x8_get_glyph(uint32_t codepoint, uint32_t* rows)
+{
+	const unsigned char* bitmap = font8x8_get_bitmap(codepoint);
+	// NOTE: Print a blank space for unknown codepoints
+	const bool is_covered = (bitmap != NULL);
+	if (!is_covered) {
+		bitmap = font8x8_basic[0];
+	}
+	for (uint8_t y = 0U; y < 8U; y++) {
+		rows[y] = bitmap[y];
+	}
+	return is_covered;
+}
+
+#ifdef FBINK_WITH_FONTS
+// Look a codepoint up in a font's map (as built by tools/hextoc.py), stores the index of its glyph in glyph.
+// Returns false if it's not covered.
+// NOTE: This is constant-time: a chunk lookup, and a popcount to rank the codepoint in its chunk's bitmap.
+static bool
+    font_glyph_index(uint32_t codepoint, const FBInkGlyphMap* map, uint16_t* glyph)
+{
+	const uint32_t chunk = codepoint >> 6U;
+	if (chunk < map->chunk_count) {
+		const uint16_t c   = map->chunks[chunk];
+		const uint64_t bit = 1ULL << (codepoint & 0x3FU);
+		if (map->coverage[c] & bit) {
+			*glyph = (uint16_t) (map->ranks[c] + __builtin_popcountll(map->coverage[c] & (bit - 1U)));
+			return true;
+		}
+	}
+
+	// NOTE: Every font falls back to its first glyph (which is usually a blank) for unknown codepoints
+	*glyph = 0U;
+	return false;
+}
+
+// Unpack a font's glyph for a specific Unicode codepoint, as font->height rows of font->width bits wide masks.
+// Returns false if it's not covered (in which case that's the font's fallback glyph).
+static bool
+    font_get_glyph(const FBInkFont* font, uint32_t codepoint, uint32_t* rows)
+{
+	uint16_t   glyph;
+	const bool is_covered = font_glyph_index(codepoint, &font->map, &glyph);
+	if (font->ids) {
+		glyph = font->ids[glyph];
+	}
+	const uint8_t* bits = font->bitmaps + ((size_t) glyph * font->bitmap_size);
+
+	// NOTE: Rows are packed back to back, LSB first, so just feed them through a bit accumulator,
+	//       one byte at a time, which means we never read past the end of the bitmap.
+	const uint8_t  width = font->width;
+	const uint32_t mask  = (width == 32U) ? UINT32_MAX : ((1U << width) - 1U);
+	uint64_t       acc   = 0U;
+	uint8_t        have  = 0U;
+	for (uint8_t y = 0U; y < font->height; y++) {
+		while (have < width) {
+			acc |= (uint64_t) *bits++ << have;
+			have = (uint8_t) (have + 8U);
+		}
+		rows[y] = (uint32_t) acc & mask;
+		acc >>= width;
+		have = (uint8_t) (have - width);
+	}
+
+	return is_covered;
 }
+#endif
 
 static const char*
     fontname_to_string(uint8_t fontname)
@@ -477,59 +1203,101 @@ static const char*
 		case IBM:
 			return "IBM";
 #ifdef FBINK_WITH_FONTS
+#	ifdef FBINK_WITH_FONT_UNSCII
 		case UNSCII:
 			return "Unscii";
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_ALT
 		case UNSCII_ALT:
 			return "Unscii Alt";
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_THIN
 		case UNSCII_THIN:
 			return "Unscii Thin";
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_FANTASY
 		case UNSCII_FANTASY:
 			return "Unscii Fantasy";
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_MCR
 		case UNSCII_MCR:
 			return "Unscii MCR";
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_TALL
 		case UNSCII_TALL:
 			return "Unscii 16";
+#	endif
+#	ifdef FBINK_WITH_FONT_BLOCK
 		case BLOCK:
 			return "BLOCK";
+#	endif
+#	ifdef FBINK_WITH_FONT_LEGGIE
 		case LEGGIE:
 			return "Leggie Regular";
+#	endif
+#	ifdef FBINK_WITH_FONT_VEGGIE
 		case VEGGIE:
 			return "Leggie VGA/EGA/FB";
+#	endif
+#	ifdef FBINK_WITH_FONT_KATES
 		case KATES:
 			return "Kates";
+#	endif
+#	ifdef FBINK_WITH_FONT_FKP
 		case FKP:
 			return "FKP";
+#	endif
+#	ifdef FBINK_WITH_FONT_CTRLD
 		case CTRLD:
 			return "CtrlD";
+#	endif
+#	ifdef FBINK_WITH_FONT_ORP
 		case ORP:
 			return "Orp Regular";
+#	endif
+#	ifdef FBINK_WITH_FONT_ORPB
 		case ORPB:
 			return "Orp Bold";
+#	endif
+#	ifdef FBINK_WITH_FONT_ORPI
 		case ORPI:
 			return "Orp Italic";
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICA
 		case SCIENTIFICA:
 			return "Scientifica Regular";
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICAB
 		case SCIENTIFICAB:
 			return "Scientifica Bold";
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICAI
 		case SCIENTIFICAI:
 			return "Scientifica Italic";
+#	endif
 #endif
 		default:
+#ifdef FBINK_WITH_FONTS
+			if (get_user_font(fontname)) {
+				return get_user_font(fontname)->name;
+			}
+#endif
 			return "IBM (Default)";
 	}
 }
 
 // Helper function for drawing
 static struct mxcfb_rect
-    draw(const char*        text,
+    draw(const uint32_t*    text,
+	 unsigned short int charcount,
 	 unsigned short int row,
 	 unsigned short int col,
 	 unsigned short int multiline_offset,
 	 bool               halfcell_offset,
 	 const FBInkConfig* fbink_config)
 {
-	LOG("Printing '%s' @ line offset %hu (meaning row %hu)",
-	    text,
+	LOG("Printing %hu characters @ line offset %hu (meaning row %hu)",
+	    charcount,
 	    multiline_offset,
 	    (unsigned short int) (row + multiline_offset));
 
@@ -540,13 +1308,9 @@ static struct mxcfb_rect
 	// Adjust row in case we're a continuation of a multi-line print...
 	row = (unsigned short int) (row + multiline_offset);
 
-	// Compute the length of our actual string
-	// NOTE: We already took care in fbink_print() of making sure that the string passed in text wouldn't take up
-	//       more space (as in columns, not bytes) than (MAXCOLS - col), the maximum printable length.
-	//       And as we're printing glyphs, we need to iterate over the number of characters/grapheme clusters,
-	//       not bytes.
-	unsigned short int charcount = (unsigned short int) u8_strlen(text);
-	LOG("Character count: %hu (over %zu bytes)", charcount, strlen(text));
+	// NOTE: text is already decoded, and fbink_print() took care of making sure that it wouldn't take up
+	//       more space (as in columns) than (MAXCOLS - col), the maximum printable length.
+	//       Which means charcount *is* our length, in glyphs ;).
 
 	// Compute our actual subcell offset in pixels
 	unsigned short int pixel_offset = 0U;
@@ -675,7 +1439,7 @@ static struct mxcfb_rect
 				region.width += pixel_offset;
 				// And make sure it's properly clamped, because we can't necessarily rely on left & width
 				// being entirely acurate either because of the multiline print override,
-				// or because of a bit of subcell placement overshoot trickery (c.f., comment in put_pixel).
+				// or because of a bit of subcell placement overshoot trickery (c.f., comment in clip_span).
 				if (region.width + region.left > screenWidth) {
 					region.width = screenWidth - region.left;
 					LOG("Clamped region.width to %u", region.width);
@@ -730,218 +1494,61 @@ static struct mxcfb_rect
 		    region.width);
 	}
 
-	// Loop through all the *characters* in the text string
-	unsigned int       bi     = 0U;
-	unsigned short int ci     = 0U;
-	uint32_t           ch     = 0U;
-	FBInkCoordinates   coords = { 0U };
-	FBInkColor*        pxC;
+	// Loop through all the *characters* in the text span
+	unsigned short int ci = 0U;
+	uint32_t           ch = 0U;
 	// NOTE: We don't do much sanity checking on hoffset/voffset,
 	//       because we want to allow pushing part of the string off-screen
 	//       (we basically only make sure it won't screw up the region rectangle too badly).
-	//       put_pixel is checked, and will discard off-screen pixels safely.
+	//       The glyph renderers will clip the glyph, and discard its off-screen pixels safely.
 	//       Because we store the final position in an unsigned value, this means that, to some extent,
 	//       we rely on wraparound on underflow to still point to (large, but positive) off-screen coordinates.
 	unsigned short int x_base_offs = (unsigned short int) ((col * FONTW) + pixel_offset + hoffset + viewHoriOrigin);
 	unsigned short int y_offs      = (unsigned short int) ((row * FONTH) + voffset + viewVertOrigin);
 	unsigned short int x_offs      = 0U;
 
-	unsigned short int i;
-	unsigned short int j;
-	unsigned short int cx;
-	unsigned short int cy;
-
-	// NOTE: Extra code duplication because the glyph's bitmap data type depends on the glyph's width,
-	//       so, one way or another, we have to duplicate the inner loops,
-	//       but we want to inline this *and* branch outside the loops,
-	//       and I don't feel like moving that to inline functions,
-	//       because it depends on seven billion different variables I'd have to pass around...
-#ifdef FBINK_WITH_FONTS
-	if (glyphWidth <= 8) {
-#endif
-		while ((ch = u8_nextchar(text, &bi)) != 0U) {
-			LOG("Char %hu (@ %hu) out of %hu is @ byte offset %u and is U+%04X",
-			    (unsigned short int) (ci + 1U),
-			    ci,
-			    charcount,
-			    bi,
-			    ch);
-
-			// Update the x coordinates for this character
-			x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-
-			// Get the glyph's pixmap (width <= 8 -> uint8_t)
-			const unsigned char* bitmap = NULL;
-			bitmap                      = (*fxpFont8xGetBitmap)(ch);
-
-			// Crappy macro to avoid repeating myself in each branch...
-#define RENDER_GLYPH()                                                                                                   \
-	/* NOTE: We only need to loop on the base glyph's dimensions (i.e., the bitmap resolution), */                   \
-	/*       and from there compute the extra pixels for that single input pixel given our scaling factor... */      \
-	if (!fbink_config->is_overlay && !fbink_config->is_bgless) {                                                     \
-		for (uint8_t y = 0U; y < glyphHeight; y++) {                                                             \
-			/* y: input row, j: first output row after scaling */                                            \
-			j = (unsigned short int) (y * FONTSIZE_MULT);                                                    \
-			for (uint8_t x = 0U; x < glyphWidth; x++) {                                                      \
-				/* x: input column, i: first output column after scaling */                              \
-				i = (unsigned short int) (x * FONTSIZE_MULT);                                            \
-				/* Each element encodes a full row, we access a column's bit in that row by shifting. */ \
-				if (bitmap[y] & 1U << x) {                                                               \
-					/* bit was set, pixel is fg! */                                                  \
-					pxC = &fgC;                                                                      \
-				} else {                                                                                 \
-					/* bit was unset, pixel is bg */                                                 \
-					pxC = &bgC;                                                                      \
-				}                                                                                        \
-				/* Initial coordinates, before we generate the extra pixels from the scaling factor */   \
-				cx = (unsigned short int) (x_offs + i);                                                  \
-				cy = (unsigned short int) (y_offs + j);                                                  \
-				/* NOTE: Apply our scaling factor in both dimensions! */                                 \
-				for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                           \
-					for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {                                   \
-						coords.x = (unsigned short int) (cx + k);                                \
-						coords.y = (unsigned short int) (cy + l);                                \
-						put_pixel(&coords, pxC);                                                 \
-					}                                                                                \
-				}                                                                                        \
-			}                                                                                                \
-		}                                                                                                        \
-	} else {                                                                                                         \
-		FBInkColor fbC     = { 0U };                                                                             \
-		bool       is_fgpx = false;                                                                              \
-		for (uint8_t y = 0U; y < glyphHeight; y++) {                                                             \
-			/* y: input row, j: first output row after scaling */                                            \
-			j = (unsigned short int) (y * FONTSIZE_MULT);                                                    \
-			for (uint8_t x = 0U; x < glyphWidth; x++) {                                                      \
-				/* x: input column, i: first output column after scaling */                              \
-				i = (unsigned short int) (x * FONTSIZE_MULT);                                            \
-				/* Each element encodes a full row, we access a column's bit in that row by shifting. */ \
-				if (bitmap[y] & 1U << x) {                                                               \
-					/* bit was set, pixel is fg! */                                                  \
-					pxC     = &fgC;                                                                  \
-					is_fgpx = true;                                                                  \
-				} else {                                                                                 \
-					/* bit was unset, pixel is bg */                                                 \
-					pxC     = &bgC;                                                                  \
-					is_fgpx = false;                                                                 \
-				}                                                                                        \
-				/* Initial coordinates, before we generate the extra pixels from the scaling factor */   \
-				cx = (unsigned short int) (x_offs + i);                                                  \
-				cy = (unsigned short int) (y_offs + j);                                                  \
-				/* NOTE: Apply our scaling factor in both dimensions! */                                 \
-				for (uint8_t l = 0U; l < FONTSIZE_MULT; l++) {                                           \
-					for (uint8_t k = 0U; k < FONTSIZE_MULT; k++) {                                   \
-						coords.x = (unsigned short int) (cx + k);                                \
-						coords.y = (unsigned short int) (cy + l);                                \
-						/* In overlay mode, we only print foreground pixels, */                  \
-						/* and we print in the inverse color of the underlying pixel's */        \
-						/* Obviously, the closer we get to GRAY7, the less contrast we get */    \
-						if (is_fgpx) {                                                           \
-							if (fbink_config->is_overlay) {                                  \
-								get_pixel(&coords, &fbC);                                \
-								fbC.r ^= 0xFF;                                           \
-								/* NOTE: Don't touch g & b if it's not needed! */        \
-								/*       It's especially important on 4bpp, */           \
-								/*       to avoid clobbering the low nibble, */          \
-								/*       which we store in b... */                       \
-								if (vInfo.bits_per_pixel > 8U) {                         \
-									fbC.g ^= 0xFF;                                   \
-									fbC.b ^= 0xFF;                                   \
-								}                                                        \
-								pxC = &fbC;                                              \
-							}                                                                \
-							put_pixel(&coords, pxC);                                         \
-						}                                                                        \
-					}                                                                                \
-				}                                                                                        \
-			}                                                                                                \
-		}                                                                                                        \
-	}
-
-			RENDER_GLYPH();
-			// NOTE: If we did not mirror the bitmasks during conversion,
-			//       another approach to the fact that Unifont's hex format encodes columns in the reverse order
-			//       is simply to access columns in the reverse order ;).
-			//       i.e., switch the inner column loop to:
-			//       for (int8_t x = (glyphWidth - 1); x >= 0; x--) {
-			//           i = (unsigned short int) ((glyphWidth - x) * FONTSIZE_MULT);
-
-			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
-			ci++;
-		}
-#ifdef FBINK_WITH_FONTS
-		/*
-	} else if (glyphWidth <= 16) {
-		while ((ch = u8_nextchar(text, &bi)) != 0U) {
-			LOG("Char %hu (@ %hu) out of %hu is @ byte offset %u and is U+%04X",
-			(unsigned short int) (ci + 1U),
-			ci,
-			charcount,
-			bi,
-			ch);
-
-			// Update the x coordinates for this character
-			x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-
-			// Get the glyph's pixmap (width <= 16 -> uint16_t)
-			const uint16_t* bitmap = NULL;
-			bitmap = (*fxpFont16xGetBitmap)(ch);
-
-			// Render, scale & plot!
-			RENDER_GLYPH();
-
-			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
-			ci++;
-		}
-	*/
-	} else if (glyphWidth <= 32) {
-		while ((ch = u8_nextchar(text, &bi)) != 0U) {
-			LOG("Char %hu (@ %hu) out of %hu is @ byte offset %u and is U+%04X",
-			    (unsigned short int) (ci + 1U),
-			    ci,
-			    charcount,
-			    bi,
-			    ch);
+	// Pick the right renderer for the job, once.
+	// NOTE: fbink_init() already took care of picking the right set of renderers for the fb's bpp,
+	//       we just have to pick the right rendering mode, taking into account that overlay trumps bgless.
+	uint8_t glyph_mode = GLYPH_MODE_BG;
+	if (fbink_config->is_overlay) {
+		glyph_mode = GLYPH_MODE_OVERLAY;
+	} else if (fbink_config->is_bgless) {
+		glyph_mode = GLYPH_MODE_BGLESS;
+	}
 
-			// Update the x coordinates for this character
-			x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
+	// In the default mode, we can go through our glyph cache (the blitter takes care of rotation).
+	const bool use_cache = (glyph_mode == GLYPH_MODE_BG);
+	const uint32_t fgP   = pack_pixel((uint8_t) vInfo.bits_per_pixel, &fgC);
+	const uint32_t bgP   = pack_pixel((uint8_t) vInfo.bits_per_pixel, &bgC);
 
-			// Get the glyph's pixmap (width <= 32 -> uint32_t)
-			const uint32_t* bitmap = NULL;
-			bitmap                 = (*fxpFont32xGetBitmap)(ch);
+	for (ci = 0U; ci < charcount; ci++) {
+		ch = text[ci];
+		LOG("Char %hu (@ %hu) out of %hu is U+%04X", (unsigned short int) (ci + 1U), ci, charcount, ch);
 
-			// Render, scale & plot!
-			RENDER_GLYPH();
+		// Update the x coordinates for this character
+		x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
 
-			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
-			ci++;
+		const FBInkGlyphTile* tile = NULL;
+		if (use_cache) {
+			tile = get_glyph_tile(ch, x_offs, fgP, bgP);
 		}
-		/*
-	} else if (glyphWidth <= 64) {
-		while ((ch = u8_nextchar(text, &bi)) != 0U) {
-			LOG("Char %hu (@ %hu) out of %hu is @ byte offset %u and is U+%04X",
-			(unsigned short int) (ci + 1U),
-			ci,
-			charcount,
-			bi,
-			ch);
-
-			// Update the x coordinates for this character
-			x_offs = (unsigned short int) (x_base_offs + (ci * FONTW));
-
-			// Get the glyph's pixmap (width <= 64 -> uint64_t)
-			const uint64_t* bitmap = NULL;
-			bitmap = (*fxpFont64xGetBitmap)(ch);
+		if (tile) {
+			// Cached, it's just a bunch of memcpy ;).
+			(*fxpBlitGlyphTile)(tile, x_offs, y_offs);
+		} else {
+			// Unpack the glyph's bitmap
+			uint32_t bitmap[GLYPH_MAX_HEIGHT];
+			resolve_glyph(ch, bitmap);
 
 			// Render, scale & plot!
-			RENDER_GLYPH();
-
-			// Next glyph! This serves as the source for the pen position, hence it being used as an index...
-			ci++;
+			(*fxpGlyphRenderers[glyph_mode])(bitmap, x_offs, y_offs, &fgC, &bgC);
+			// NOTE: If we did not mirror the bitmasks during conversion,
+			//       another approach to the fact that Unifont's hex format encodes columns in the reverse order
+			//       is simply to access columns in the reverse order ;).
+			//       i.e., test (glyphWidth - 1 - x) instead of x in render_glyph.
 		}
-	*/
 	}
-#endif
 
 	return region;
 }
@@ -1043,33 +1650,6 @@ static int
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	if (update_mode == UPDATE_MODE_FULL) {
-		if (deviceQuirks.isKindlePearlScreen) {
-			rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_PEARL, &marker);
-		} else {
-			struct mxcfb_update_marker_data update_marker = {
-				.update_marker  = marker,
-				.collision_test = 0U,
-			};
-
-			rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE, &update_marker);
-		}
-
-		if (rv < 0) {
-			char  buf[256];
-			char* errstr = strerror_r(errno, buf, sizeof(buf));
-			if (deviceQuirks.isKindlePearlScreen) {
-				fprintf(stderr, "[FBInk] MXCFB_WAIT_FOR_UPDATE_COMPLETE_PEARL: %s\n", errstr);
-			} else {
-				fprintf(stderr, "[FBInk] MXCFB_WAIT_FOR_UPDATE_COMPLETE: %s\n", errstr);
-			}
-			return ERRCODE(EXIT_FAILURE);
-		} else {
-			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of flashing update %u", (5000 - jiffies_to_ms(rv)), marker);
-		}
-	}
-
 	return EXIT_SUCCESS;
 }
 
@@ -1119,25 +1699,6 @@ static int
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	if (update_mode == UPDATE_MODE_FULL) {
-		struct mxcfb_update_marker_data update_marker = {
-			.update_marker  = marker,
-			.collision_test = 0U,
-		};
-
-		rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE, &update_marker);
-
-		if (rv < 0) {
-			char  buf[256];
-			char* errstr = strerror_r(errno, buf, sizeof(buf));
-			fprintf(stderr, "[FBInk] MXCFB_WAIT_FOR_UPDATE_COMPLETE: %s\n", errstr);
-			return ERRCODE(EXIT_FAILURE);
-		} else {
-			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of flashing update %u", (5000 - jiffies_to_ms(rv)), marker);
-		}
-	}
-
 	return EXIT_SUCCESS;
 }
 
@@ -1176,20 +1737,6 @@ static int
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	if (update_mode == UPDATE_MODE_FULL) {
-		rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_V1, &marker);
-
-		if (rv < 0) {
-			char  buf[256];
-			char* errstr = strerror_r(errno, buf, sizeof(buf));
-			fprintf(stderr, "[FBInk] MXCFB_WAIT_FOR_UPDATE_COMPLETE_V1: %s\n", errstr);
-			return ERRCODE(EXIT_FAILURE);
-		} else {
-			// NOTE: Timeout is set to 10000ms
-			LOG("Waited %ldms for completion of flashing update %u", (10000 - jiffies_to_ms(rv)), marker);
-		}
-	}
-
 	return EXIT_SUCCESS;
 }
 
@@ -1233,35 +1780,85 @@ static int
 		return ERRCODE(EXIT_FAILURE);
 	}
 
-	if (update_mode == UPDATE_MODE_FULL) {
+	return EXIT_SUCCESS;
+}
+#endif    // FBINK_FOR_KINDLE
+
+// Block until the update tagged with marker has been processed by the EPDC.
+// NOTE: The driver forgets about a marker as soon as its update has completed, and only wakes one of its waiters,
+//       so, only one of us may ever wait on a given marker (c.f., wait_for_tracked).
+static int
+    wait_for_update(int fbfd, uint32_t marker)
+{
+	// Without an EPDC, everything is done as soon as it's sent ;).
+#ifdef FBINK_FOR_LINUX
+	return EXIT_SUCCESS;
+#endif
+
+	int         rv;
+	long int    timeout = 5000;
+	const char* request;
+#ifdef FBINK_FOR_KINDLE
+	// NOTE: Legacy einkfb devices don't have markers, and their updates are synchronous anyway.
+	if (deviceQuirks.isKindleLegacy) {
+		return EXIT_SUCCESS;
+	}
+	if (deviceQuirks.isKindlePearlScreen) {
+		request = "MXCFB_WAIT_FOR_UPDATE_COMPLETE_PEARL";
+		rv      = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_PEARL, &marker);
+	} else {
+		struct mxcfb_update_marker_data update_marker = {
+			.update_marker  = marker,
+			.collision_test = 0U,
+		};
+
+		request = "MXCFB_WAIT_FOR_UPDATE_COMPLETE";
+		rv      = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE, &update_marker);
+	}
+#else
+	if (deviceQuirks.isKoboMk7) {
 		struct mxcfb_update_marker_data update_marker = {
 			.update_marker  = marker,
 			.collision_test = 0U,
 		};
 
-		rv = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_V3, &update_marker);
+		request = "MXCFB_WAIT_FOR_UPDATE_COMPLETE_V3";
+		rv      = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_V3, &update_marker);
+	} else {
+		// NOTE: Timeout is set to 10000ms on those
+		timeout = 10000;
+		request = "MXCFB_WAIT_FOR_UPDATE_COMPLETE_V1";
+		rv      = ioctl(fbfd, MXCFB_WAIT_FOR_UPDATE_COMPLETE_V1, &marker);
+	}
+#endif    // FBINK_FOR_KINDLE
 
-		if (rv < 0) {
-			char  buf[256];
-			char* errstr = strerror_r(errno, buf, sizeof(buf));
-			fprintf(stderr, "[FBInk] MXCFB_WAIT_FOR_UPDATE_COMPLETE_V3: %s\n", errstr);
-			return ERRCODE(EXIT_FAILURE);
-		} else {
-			// NOTE: Timeout is set to 5000ms
-			LOG("Waited %ldms for completion of flashing update %u", (5000 - jiffies_to_ms(rv)), marker);
-		}
+	if (rv < 0) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] %s: %s\n", request, errstr);
+		return ERRCODE(EXIT_FAILURE);
+	} else {
+		LOG("Waited %ldms for completion of update %u", (timeout - jiffies_to_ms(rv)), marker);
 	}
 
 	return EXIT_SUCCESS;
 }
-#endif    // FBINK_FOR_KINDLE
 
 // And finally, dispatch the right refresh request for our HW...
+// Every update gets a marker of its own, so that it can be waited on (c.f., wait_for_refresh), which we store in marker.
 static int
-    refresh(int fbfd, const struct mxcfb_rect region, uint32_t waveform_mode, bool is_flashing)
+    submit_refresh(int                     fbfd,
+		   const struct mxcfb_rect region,
+		   uint32_t                waveform_mode,
+		   bool                    is_flashing,
+		   uint32_t*               marker)
 {
+	*marker = next_marker();
+
 	// NOP when we don't have an eInk screen ;).
 #ifdef FBINK_FOR_LINUX
+	// Which also means that it's already done ;).
+	track_marker(*marker);
 	return EXIT_SUCCESS;
 #endif
 
@@ -1273,14 +1870,9 @@ static int
 			"[FBInk] Discarding bogus empty region (%ux%u) to avoid a softlock.\n",
 			region.width,
 			region.height);
-		return ERRCODE(EXIT_FAILURE);
-	}
-
-#ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleLegacy) {
-		return refresh_legacy(fbfd, region, is_flashing);
+		return ERRCODE(EXIT_FAILURE);
 	}
-#endif
+
 	// NOTE: While we'd be perfect candidates for using A2 waveform mode, it's all kinds of fucked up on Kobos,
 	//       and may lead to disappearing text or weird blending depending on the surrounding fb content...
 	//       It only shows up properly when FULL, which isn't great...
@@ -1291,29 +1883,78 @@ static int
 	//       (i.e., DU or GC16 is most likely often what AUTO will land on).
 
 	// So, handle this common switcheroo here...
-	uint32_t wfm    = (is_flashing && waveform_mode == WAVEFORM_MODE_AUTO) ? WAVEFORM_MODE_GC16 : waveform_mode;
-	uint32_t upm    = is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
-	uint32_t marker = (uint32_t) getpid();
-
-	// NOTE: Make sure update_marker is valid, an invalid marker *may* hang the kernel instead of failing gracefully,
-	//       depending on the device/FW...
-	if (marker == 0U) {
-		marker = (70U + 66U + 73U + 78U + 75U);
-	}
+	uint32_t wfm = (is_flashing && waveform_mode == WAVEFORM_MODE_AUTO) ? WAVEFORM_MODE_GC16 : waveform_mode;
+	uint32_t upm = is_flashing ? UPDATE_MODE_FULL : UPDATE_MODE_PARTIAL;
 
+	int rv;
 #ifdef FBINK_FOR_KINDLE
-	if (deviceQuirks.isKindleOasis2) {
-		return refresh_kindle_koa2(fbfd, region, wfm, upm, marker);
+	if (deviceQuirks.isKindleLegacy) {
+		rv = refresh_legacy(fbfd, region, is_flashing);
+	} else if (deviceQuirks.isKindleOasis2) {
+		rv = refresh_kindle_koa2(fbfd, region, wfm, upm, *marker);
 	} else {
-		return refresh_kindle(fbfd, region, wfm, upm, marker);
+		rv = refresh_kindle(fbfd, region, wfm, upm, *marker);
 	}
 #else
 	if (deviceQuirks.isKoboMk7) {
-		return refresh_kobo_mk7(fbfd, region, wfm, upm, marker);
+		rv = refresh_kobo_mk7(fbfd, region, wfm, upm, *marker);
 	} else {
-		return refresh_kobo(fbfd, region, wfm, upm, marker);
+		rv = refresh_kobo(fbfd, region, wfm, upm, *marker);
 	}
 #endif    // FBINK_FOR_KINDLE
+	if (rv != EXIT_SUCCESS) {
+		return rv;
+	}
+
+	// If we're tracking completions, the tracking thread takes it from here (c.f., fbink_open_completion_fd)
+	track_marker(*marker);
+
+	return EXIT_SUCCESS;
+}
+
+// Block until a flashing update we sent is done, unless we were asked not to (c.f., no_refresh_wait),
+// in which case it's up to the caller to wait for it, if need be (c.f., fbink_wait_for_complete).
+static int
+    wait_for_refresh(int fbfd, uint32_t marker)
+{
+	if (noRefreshWait) {
+		return EXIT_SUCCESS;
+	}
+
+	// NOTE: If the tracking thread is already waiting on it, we can't, so, wait for it instead.
+	if (wait_for_tracked(marker)) {
+		return EXIT_SUCCESS;
+	}
+
+	return wait_for_update(fbfd, marker);
+}
+
+// Send a refresh right away, and wait for it if it's a flashing one
+static int
+    send_refresh(int fbfd, const struct mxcfb_rect region, uint32_t waveform_mode, bool is_flashing)
+{
+	uint32_t marker;
+	int      rv = submit_refresh(fbfd, region, waveform_mode, is_flashing, &marker);
+	if (rv == EXIT_SUCCESS && is_flashing) {
+		rv = wait_for_refresh(fbfd, marker);
+	}
+
+	return rv;
+}
+
+// Refresh region, now, or a tad later if we're coalescing refreshes
+static int
+    refresh(int fbfd, const struct mxcfb_rect region, uint32_t waveform_mode, bool is_flashing)
+{
+	// If we're rendering to a shadow buffer, now's the time to push what we drew to the fb.
+	flush_shadow(NULL);
+
+	// If we're coalescing refreshes, hold on to it for a bit (c.f., fbink_coalesce.c)
+	if (coalesceMs > 0U) {
+		return coalesce_region(fbfd, &region, waveform_mode, is_flashing);
+	}
+
+	return send_refresh(fbfd, region, waveform_mode, is_flashing);
 }
 
 // Open the framebuffer file & return the opened fd
@@ -1390,6 +2031,10 @@ int
 	} else {
 		g_isQuiet = false;
 	}
+	// And whether we block on flashing refreshes
+	noRefreshWait = fbink_config->no_refresh_wait;
+	// And whether we pick waveform modes ourselves
+	noAutoWaveform = fbink_config->no_auto_waveform;
 
 	// Start with some more generic stuff, not directly related to the framebuffer.
 	// As all this stuff is pretty much set in stone, we'll only query it once.
@@ -1533,117 +2178,10 @@ int
 	// NOTE: Set (& reset) original font resolution, in case we're re-init'ing,
 	//       since we're relying on the default value to calculate the scaled value,
 	//       and we're using this value to set MAXCOLS & MAXROWS, which we *need* to be sane.
-#ifdef FBINK_WITH_FONTS
-	// Setup custom fonts (glyph size, render fx, bitmap fx)
-	switch (fbink_config->fontname) {
-		case SCIENTIFICA:
-			glyphWidth         = 5U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientifica_get_bitmap;
-			break;
-		case SCIENTIFICAB:
-			glyphWidth         = 5U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientificab_get_bitmap;
-			break;
-		case SCIENTIFICAI:
-			glyphWidth         = 7U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &scientificai_get_bitmap;
-			break;
-		case ORP:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orp_get_bitmap;
-			break;
-		case ORPB:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orpb_get_bitmap;
-			break;
-		case ORPI:
-			glyphWidth         = 6U;
-			glyphHeight        = 12U;
-			fxpFont8xGetBitmap = &orpi_get_bitmap;
-			break;
-		case KATES:
-			glyphWidth         = 7U;
-			glyphHeight        = 15U;
-			fxpFont8xGetBitmap = &kates_get_bitmap;
-			break;
-		case UNSCII_TALL:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &tall_get_bitmap;
-			break;
-		case VEGGIE:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &veggie_get_bitmap;
-			break;
-		case FKP:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &fkp_get_bitmap;
-			break;
-		case CTRLD:
-			glyphWidth         = 8U;
-			glyphHeight        = 16U;
-			fxpFont8xGetBitmap = &ctrld_get_bitmap;
-			break;
-		case LEGGIE:
-			glyphWidth         = 8U;
-			glyphHeight        = 18U;
-			fxpFont8xGetBitmap = &leggie_get_bitmap;
-			break;
-		case BLOCK:
-			glyphWidth  = 32U;
-			glyphHeight = 32U;
-			// An horizontal resolution > 8 means a different data type...
-			fxpFont32xGetBitmap = &block_get_bitmap;
-			break;
-		case UNSCII_MCR:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &mcr_get_bitmap;
-			break;
-		case UNSCII_FANTASY:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &fantasy_get_bitmap;
-			break;
-		case UNSCII_THIN:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &thin_get_bitmap;
-			break;
-		case UNSCII_ALT:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &alt_get_bitmap;
-			break;
-		case UNSCII:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &unscii_get_bitmap;
-			break;
-		case IBM:
-		default:
-			glyphWidth         = 8U;
-			glyphHeight        = 8U;
-			fxpFont8xGetBitmap = &font8x8_get_bitmap;
-			break;
-	}
-#else
-	// Default font is IBM
-	glyphWidth         = 8U;
-	glyphHeight        = 8U;
-	fxpFont8xGetBitmap = &font8x8_get_bitmap;
-
-	if (fbink_config->fontname != IBM) {
-		ELOG("[FBInk] Custom fonts are not supported in this FBInk build, using IBM instead.");
-	}
-#endif
+	// Pick our font, and its fallbacks (c.f., fbink_fallback.c)
+	setup_font_chain(fbink_config);
+	glyphWidth  = fontChain[0].width;
+	glyphHeight = fontChain[0].height;
 
 	// Obey user-specified font scaling multiplier
 	if (fbink_config->fontmult > 0) {
@@ -1697,13 +2235,15 @@ int
 		} else {
 			FONTSIZE_MULT = 4U;    // 32x32
 		}
-#ifdef FBINK_WITH_FONTS
+#ifdef FBINK_WITH_FONT_BLOCK
 		if (fbink_config->fontname == BLOCK) {
 			// Block is roughly 4 times wider than other fonts, compensate for that...
 			FONTSIZE_MULT = (uint8_t) MAX(1U, FONTSIZE_MULT / 4U);
 		}
 #endif
 	}
+	// Remember which font we're using, for the glyph cache's sake
+	glyphFont = fontChain[0].fontname;
 	// Go!
 	FONTW = (unsigned short int) (glyphWidth * FONTSIZE_MULT);
 	FONTH = (unsigned short int) (glyphHeight * FONTSIZE_MULT);
@@ -1756,27 +2296,48 @@ int
 	     fInfo.smem_len,
 	     fInfo.line_length);
 
-	// Use the appropriate get/put pixel functions...
+	// Use the appropriate get/put pixel, fill & expansion functions...
+	expand_init_luts();
 	switch (vInfo.bits_per_pixel) {
 		case 4U:
-			fxpPutPixel = &put_pixel_Gray4;
-			fxpGetPixel = &get_pixel_Gray4;
+			fxpPutPixel       = &put_pixel_Gray4;
+			fxpGetPixel       = &get_pixel_Gray4;
+			fxpFillRect       = &fill_rect_Gray4;
+			fxpExpandMask     = &expand_mask_Gray4;
+			fxpGlyphRenderers = glyphRenderers_Gray4;
+			fxpBlitGlyphTile  = &blit_glyph_tile_Gray4;
 			break;
 		case 8U:
-			fxpPutPixel = &put_pixel_Gray8;
-			fxpGetPixel = &get_pixel_Gray8;
+			fxpPutPixel       = &put_pixel_Gray8;
+			fxpGetPixel       = &get_pixel_Gray8;
+			fxpFillRect       = &fill_rect_Gray8;
+			fxpExpandMask     = &expand_mask_Gray8;
+			fxpGlyphRenderers = glyphRenderers_Gray8;
+			fxpBlitGlyphTile  = &blit_glyph_tile_Gray8;
 			break;
 		case 16U:
-			fxpPutPixel = &put_pixel_RGB565;
-			fxpGetPixel = &get_pixel_RGB565;
+			fxpPutPixel       = &put_pixel_RGB565;
+			fxpGetPixel       = &get_pixel_RGB565;
+			fxpFillRect       = &fill_rect_RGB565;
+			fxpExpandMask     = &expand_mask_RGB565;
+			fxpGlyphRenderers = glyphRenderers_RGB565;
+			fxpBlitGlyphTile  = &blit_glyph_tile_RGB565;
 			break;
 		case 24U:
-			fxpPutPixel = &put_pixel_RGB24;
-			fxpGetPixel = &get_pixel_RGB24;
+			fxpPutPixel       = &put_pixel_RGB24;
+			fxpGetPixel       = &get_pixel_RGB24;
+			fxpFillRect       = &fill_rect_RGB24;
+			fxpExpandMask     = &expand_mask_RGB24;
+			fxpGlyphRenderers = glyphRenderers_RGB24;
+			fxpBlitGlyphTile  = &blit_glyph_tile_RGB24;
 			break;
 		case 32U:
-			fxpPutPixel = &put_pixel_RGB32;
-			fxpGetPixel = &get_pixel_RGB32;
+			fxpPutPixel       = &put_pixel_RGB32;
+			fxpGetPixel       = &get_pixel_RGB32;
+			fxpFillRect       = &fill_rect_RGB32;
+			fxpExpandMask     = &expand_mask_RGB32;
+			fxpGlyphRenderers = glyphRenderers_RGB32;
+			fxpBlitGlyphTile  = &blit_glyph_tile_RGB32;
 			break;
 		default:
 			// Huh oh... Should never happen!
@@ -1786,6 +2347,26 @@ int
 			break;
 	}
 
+	// Now that we know the fb's layout, figure out how to walk it in view coordinates (c.f., fbink_rotate.c)
+	set_view_rotation(deviceQuirks.isKobo16Landscape ? FB_ROTATE_CW : FB_ROTATE_UR);
+
+	// And (re)allocate our shadow buffer if need be (c.f., fbink_shadow.c)
+	if (setup_shadow(fbink_config->use_shadow, fbink_config->use_diff) != EXIT_SUCCESS) {
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	if (shadowPtr) {
+		ELOG("[FBInk] Rendering to a %u bytes shadow buffer%s",
+		     fInfo.smem_len,
+		     frontPtr ? ", only refreshing what changed" : "");
+	}
+
+	// As well as our refresh coalescer (c.f., fbink_coalesce.c)
+	if (setup_coalescer(fbink_config->coalesce_ms) != EXIT_SUCCESS) {
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
 		// NOTE: Now that we know which device we're running on, setup pen colors,
 		//       taking into account the inverted cmap on legacy Kindles...
 #ifdef FBINK_FOR_KINDLE
@@ -1840,7 +2421,7 @@ void
 {
 	fprintf(
 	    stdout,
-	    "viewWidth=%u;viewHeight=%u;screenWidth=%u;screenHeight=%u;viewHoriOrigin=%hhu;viewVertOrigin=%hhu;viewVertOffset=%hhu;BPP=%u;FONTW=%hu;FONTH=%hu;FONTSIZE_MULT=%hhu;FONTNAME='%s';glyphWidth=%hhu;glyphHeight=%hhu;MAXCOLS=%hu;MAXROWS=%hu;isPerfectFit=%d;FBID=%s;USER_HZ=%ld;penFGColor=%hhu;penBGColor=%hhu",
+	    "viewWidth=%u;viewHeight=%u;screenWidth=%u;screenHeight=%u;viewHoriOrigin=%hhu;viewVertOrigin=%hhu;viewVertOffset=%hhu;BPP=%u;FONTW=%hu;FONTH=%hu;FONTSIZE_MULT=%hhu;FONTNAME='%s';glyphWidth=%hhu;glyphHeight=%hhu;MAXCOLS=%hu;MAXROWS=%hu;isPerfectFit=%d;FBID=%s;USER_HZ=%ld;penFGColor=%hhu;penBGColor=%hhu;glyphCacheHits=%u;glyphCacheMisses=%u;glyphsMissing=%u",
 	    viewWidth,
 	    viewHeight,
 	    screenWidth,
@@ -1861,7 +2442,10 @@ void
 	    fInfo.id,
 	    USER_HZ,
 	    penFGColor,
-	    penBGColor);
+	    penBGColor,
+	    glyphCacheHits,
+	    glyphCacheMisses,
+	    glyphsMissing);
 }
 
 // Dump a few of our internal state variables to the FBInkState struct pointed to by fbink_state
@@ -1869,26 +2453,29 @@ void
     fbink_get_state(const FBInkConfig* fbink_config, FBInkState* fbink_state)
 {
 	if (fbink_state) {
-		fbink_state->view_width       = viewWidth;
-		fbink_state->view_height      = viewHeight;
-		fbink_state->screen_width     = screenWidth;
-		fbink_state->screen_height    = screenHeight;
-		fbink_state->view_hori_origin = viewHoriOrigin;
-		fbink_state->view_vert_origin = viewVertOrigin;
-		fbink_state->view_vert_offset = viewVertOffset;
-		fbink_state->bpp              = vInfo.bits_per_pixel;
-		fbink_state->font_w           = FONTW;
-		fbink_state->font_h           = FONTH;
-		fbink_state->fontsize_mult    = FONTSIZE_MULT;
-		fbink_state->font_name        = fontname_to_string(fbink_config->fontname);
-		fbink_state->glyph_width      = glyphWidth;
-		fbink_state->glyph_height     = glyphHeight;
-		fbink_state->max_cols         = MAXCOLS;
-		fbink_state->max_rows         = MAXROWS;
-		fbink_state->is_perfect_fit   = deviceQuirks.isPerfectFit;
-		fbink_state->user_hz          = USER_HZ;
-		fbink_state->pen_fg_color     = penFGColor;
-		fbink_state->pen_bg_color     = penBGColor;
+		fbink_state->view_width         = viewWidth;
+		fbink_state->view_height        = viewHeight;
+		fbink_state->screen_width       = screenWidth;
+		fbink_state->screen_height      = screenHeight;
+		fbink_state->view_hori_origin   = viewHoriOrigin;
+		fbink_state->view_vert_origin   = viewVertOrigin;
+		fbink_state->view_vert_offset   = viewVertOffset;
+		fbink_state->bpp                = vInfo.bits_per_pixel;
+		fbink_state->font_w             = FONTW;
+		fbink_state->font_h             = FONTH;
+		fbink_state->fontsize_mult      = FONTSIZE_MULT;
+		fbink_state->font_name          = fontname_to_string(fbink_config->fontname);
+		fbink_state->glyph_width        = glyphWidth;
+		fbink_state->glyph_height       = glyphHeight;
+		fbink_state->max_cols           = MAXCOLS;
+		fbink_state->max_rows           = MAXROWS;
+		fbink_state->is_perfect_fit     = deviceQuirks.isPerfectFit;
+		fbink_state->user_hz            = USER_HZ;
+		fbink_state->pen_fg_color       = penFGColor;
+		fbink_state->pen_bg_color       = penBGColor;
+		fbink_state->glyph_cache_hits   = glyphCacheHits;
+		fbink_state->glyph_cache_misses = glyphCacheMisses;
+		fbink_state->glyphs_missing     = glyphsMissing;
 	} else {
 		fprintf(stderr, "[FBInk] Err, it appears we were passed a NULL fbink_state pointer?\n");
 	}
@@ -1903,14 +2490,17 @@ static int
 	//       TL;DR: On 16bpp fbs, it *might* be a bit larger than strictly necessary,
 	//              but I've yet to see that be an issue with what I'm doing,
 	//              and trusting it is much simpler than trying to outsmart broken fb setup info...
-	fbPtr = (unsigned char*) mmap(NULL, fInfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
-	if (fbPtr == MAP_FAILED) {
+	fbMapPtr = (unsigned char*) mmap(NULL, fInfo.smem_len, PROT_READ | PROT_WRITE, MAP_SHARED, fbfd, 0);
+	if (fbMapPtr == MAP_FAILED) {
 		char  buf[256];
 		char* errstr = strerror_r(errno, buf, sizeof(buf));
 		fprintf(stderr, "[FBInk] mmap: %s\n", errstr);
+		fbMapPtr = NULL;
 		return ERRCODE(EXIT_FAILURE);
 	} else {
 		isFbMapped = true;
+		// Draw to the shadow buffer, if we have one
+		attach_shadow();
 	}
 
 	return EXIT_SUCCESS;
@@ -1920,7 +2510,7 @@ static int
 static int
     unmap_fb(void)
 {
-	if (munmap(fbPtr, fInfo.smem_len) < 0) {
+	if (munmap(fbMapPtr, fInfo.smem_len) < 0) {
 		char  buf[256];
 		char* errstr = strerror_r(errno, buf, sizeof(buf));
 		fprintf(stderr, "[FBInk] munmap: %s\n", errstr);
@@ -1930,6 +2520,7 @@ static int
 		//       so we won't skip mmap'ing on the next call without a fb fd passed...
 		isFbMapped = false;
 		fbPtr      = NULL;
+		fbMapPtr   = NULL;
 	}
 
 	return EXIT_SUCCESS;
@@ -1940,6 +2531,9 @@ static int
 int
     fbink_close(int fbfd)
 {
+	// Don't leave any refresh we've been holding on to behind (c.f., fbink_coalesce.c)
+	flush_coalescer(fbfd);
+
 	// With a few sprinkles of sanity checks, in case something *really* unexpected happen,
 	// or simply to cover a wide range of API usage.
 	if (isFbMapped) {
@@ -1960,19 +2554,6 @@ int
 	return EXIT_SUCCESS;
 }
 
-// Much like rotate_coordinates, but for a mxcfb rectangle
-static void
-    rotate_region(struct mxcfb_rect* region)
-{
-	// Rotate the region if need be...
-	struct mxcfb_rect oregion = *region;
-	// NOTE: left = x, top = y
-	region->top    = screenWidth - oregion.left - oregion.width;
-	region->left   = oregion.top;
-	region->width  = oregion.height;
-	region->height = oregion.width;
-}
-
 // Tweak the region to cover the full screen
 static void
     fullscreen_region(struct mxcfb_rect* region)
@@ -1983,6 +2564,33 @@ static void
 	region->height = vInfo.yres;
 }
 
+// Tell if a codepoint is a CJK ideograph (or one of its friends, kana & fullwidth forms), i.e., breakable on both sides
+static bool
+    is_cjk(uint32_t ch)
+{
+	return (ch >= 0x2E80U && ch <= 0x9FFFU) ||      // Radicals, CJK Symbols & Punctuation, Kana, Ext. A, Unified
+	       (ch >= 0xF900U && ch <= 0xFAFFU) ||      // Compatibility Ideographs
+	       (ch >= 0xFF00U && ch <= 0xFFEFU) ||      // Halfwidth & Fullwidth Forms
+	       (ch >= 0x20000U && ch <= 0x3FFFFU);      // Ext. B and beyond
+}
+
+// Tell if we're allowed to break a line between the codepoints a & b (c.f., is_wrapped)
+// NOTE: This is a tiny subset of UAX #14: we break around spaces, after hyphens, and around CJK,
+//       without any of the finer points of kinsoku shori, and without hyphenation.
+static bool
+    is_wrap_point(uint32_t a, uint32_t b)
+{
+	// NOTE: When breaking *before* a space, fbink_print swallows it, so the next line doesn't start with a blank.
+	if (a == 0x20U || a == 0x09U || b == 0x20U || b == 0x09U) {
+		return true;
+	}
+	// Hyphen-Minus & Hyphen
+	if (a == 0x2DU || a == 0x2010U) {
+		return true;
+	}
+	return is_cjk(a) || is_cjk(b);
+}
+
 // Magic happens here!
 int
     fbink_print(int fbfd, const char* string, const FBInkConfig* fbink_config)
@@ -1996,8 +2604,10 @@ int
 
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
-	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
-	char* line = NULL;
+	// We need to declare these early (& sentinel 'em to NULL) to make our cleanup jumps safe
+	uint32_t*      text  = NULL;
+	FBInkLineSpan* spans = NULL;
+	uint32_t*      line  = NULL;
 
 	// map fb to user mem
 	// NOTE: If we're keeping the fb's fd open, keep this mmap around, too.
@@ -2063,9 +2673,21 @@ int
 		wrapped_line = true;
 	}
 
+	// Decode our string, once, so that layout only ever has to deal with codepoints...
+	// NOTE: UTF-8 is at least 1 byte per sequence, so len + 1 codepoints is always enough.
+	size_t len = strlen(string);
+	text       = malloc((len + 1U) * sizeof(*text));
+	if (text == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] malloc (text): %s\n", errstr);
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	// NOTE: Invalid sequences are replaced by U+FFFD (c.f., fbink_utf8.c).
+	unsigned int charcount = (unsigned int) utf8_decode(string, len, text);
+
 	// See if we need to break our string down into multiple lines...
-	size_t       len       = strlen(string);
-	unsigned int charcount = u8_strlen(string);
 	// Check how much extra storage is used up by multibyte sequences.
 	if (len > charcount) {
 		LOG("Extra storage used up by multibyte sequences: %zu bytes (for a total of %u characters over %zu bytes)",
@@ -2097,21 +2719,99 @@ int
 		// Otherwise, col will be fixed, so, trust it.
 		available_cols = (unsigned short int) (available_cols - col);
 	}
-	// Given that, compute how many lines it'll take to print all that in these constraints...
-	unsigned short int lines = 1U;
-	if (charcount > available_cols) {
-		lines = (unsigned short int) (charcount / available_cols);
-		// If there's a remainder, we'll need an extra line ;).
-		if (charcount % available_cols) {
-			lines++;
-		}
+	// Lay our text out first, so that we know exactly how many lines it'll take *before* we position them
+	// (linefeeds & word wrapping may need more lines than a plain count of characters would suggest).
+	// NOTE: We only ever keep what fits on a single screen, hence MAXROWS.
+	spans = malloc(MAXROWS * sizeof(*spans));
+	if (spans == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] malloc (spans): %s\n", errstr);
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
 	}
 
+	// NOTE: Everything is now expressed in characters, so, one line is simply the span [pos, pos + line_len) of text.
+	//       We keep track of the next linefeed (and, when wrapping, of the latest break opportunity) as we go,
+	//       so that finding line breaks stays linear.
+	unsigned short int lines    = 0U;
+	unsigned int       pos      = 0U;
+	unsigned int       next_pos = 0U;
+	unsigned int       next_lf  = 0U;
+	unsigned int       brk_scan = 0U;
+	unsigned int       brk_end  = 0U;
+	unsigned short int line_len = 0U;
+	while (next_lf < charcount && text[next_lf] != 0x0A) {
+		next_lf++;
+	}
+	for (pos = 0U; pos < charcount && lines < MAXROWS; pos = next_pos) {
+		// Compute the amount of characters to print on *this* line
+		const unsigned int chars_left = charcount - pos;
+		line_len                      = (unsigned short int) MIN(chars_left, available_cols);
+
+		// NOTE: Honor linefeeds...
+		//       The main use-case for this is throwing tail'ed logfiles at us and having them
+		//       be readable instead of a jumbled glued together mess ;).
+		if (next_lf < pos) {
+			next_lf = pos;
+			while (next_lf < charcount && text[next_lf] != 0x0A) {
+				next_lf++;
+			}
+		}
+		if (next_lf < pos + line_len) {
+			// We keep the LF itself on this line (it'll render as a blank), mostly to make padding look nicer.
+			LOG("Caught a linefeed at character number %u", next_lf - pos + 1U);
+			line_len = (unsigned short int) (next_lf - pos + 1U);
+		}
+		next_pos = pos + line_len;
+
+		// NOTE: If we're about to cut a line mid-stream, and we were asked to wrap words,
+		//       backtrack to the latest break opportunity on this line, if there's one
+		//       (otherwise, that word is longer than a line, so, cut it).
+		//       A line that fills the row exactly, right before a LF, isn't cut mid-stream, though:
+		//       just fold that LF into it, we've already broken (like fbink_print_ot does).
+		const bool is_cut = (next_pos < charcount && text[next_pos - 1U] != 0x0A);
+		if (fbink_config->is_wrapped && is_cut && text[next_pos] == 0x0A) {
+			next_pos++;
+			LOG("Line fits exactly, swallowing the LF after it, resuming at character %u", next_pos);
+		} else if (fbink_config->is_wrapped && is_cut) {
+			// Only ever scan forward: what we've already classified on the previous line still holds.
+			brk_scan = MAX(brk_scan, pos);
+			while (brk_scan < next_pos) {
+				// NOTE: We remember the position right *after* the break opportunity, so 0 means none.
+				brk_scan++;
+				if (is_wrap_point(text[brk_scan - 1U], text[brk_scan])) {
+					brk_end = brk_scan;
+				}
+			}
+			if (brk_end > pos) {
+				next_pos = brk_end;
+				line_len = (unsigned short int) (next_pos - pos);
+				// Don't draw trailing blanks, so that they don't throw centering off...
+				while (line_len > 1U &&
+				       (text[pos + line_len - 1U] == 0x20U || text[pos + line_len - 1U] == 0x09U)) {
+					line_len--;
+				}
+				// ... and swallow the blanks we broke on, as well as a LF right after 'em (we've already broken).
+				while (next_pos < charcount && (text[next_pos] == 0x20U || text[next_pos] == 0x09U)) {
+					next_pos++;
+				}
+				if (next_pos < charcount && text[next_pos] == 0x0A) {
+					next_pos++;
+				}
+				LOG("Wrapped line to %hu characters, resuming at character %u", line_len, next_pos);
+			}
+		}
+
+		spans[lines].pos = pos;
+		spans[lines].len = line_len;
+		lines++;
+	}
 	// Truncate to a single screen...
-	if (lines > MAXROWS) {
-		LOG("Can only print %hu out of %hu lines, truncating!", MAXROWS, lines);
-		lines = MAXROWS;
+	if (pos < charcount) {
+		LOG("Can only print %hu lines, discarding the %u characters left!", MAXROWS, charcount - pos);
 	}
+	LOG("Need %hu lines to print %u characters over %hu available columns", lines, charcount, available_cols);
 
 	// Move our initial row up if we add so much lines that some of it goes off-screen...
 	if (row + lines > MAXROWS) {
@@ -2119,103 +2819,27 @@ int
 	}
 	LOG("Final position: column %hd, row %hd", col, row);
 
-	// We'll copy our text in chunks of formatted line...
+	// We'll draw our text in chunks of padded line...
 	// NOTE: Store that on the heap, we've had some wacky adventures with automatic VLAs...
-	// NOTE: UTF-8 is at most 4 bytes per sequence, make sure we can fit a full line of UTF-8,
-	//       (+ 1 'wide' NULL, wide to make sure u8_strlen won't skip over it).
-	line = calloc((MAXCOLS + 1U) * 4U, sizeof(*line));
+	// NOTE: A line never spans more than MAXCOLS columns, plus our wraparound marker.
+	line = malloc((MAXCOLS + 1U) * sizeof(*line));
 	if (line == NULL) {
 		char  buf[256];
 		char* errstr = strerror_r(errno, buf, sizeof(buf));
-		fprintf(stderr, "[FBInk] calloc (line): %s\n", errstr);
+		fprintf(stderr, "[FBInk] malloc (line): %s\n", errstr);
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
 	}
-	// NOTE: This makes sure it's always full of NULLs, to avoid weird shit happening later with u8_strlen()
-	//       and uninitialized or re-used memory...
-	//       Namely, a single NULL immediately followed by something that *might* be interpreted as an UTF-8
-	//       sequence would trip it into counting bogus characters.
-	//       And as snprintf() only NULL-terminates what it expects to be a non-wide string,
-	//       it's not filling the end of the buffer with NULLs, it just outputs a single one!
-	//       That's why we're also using calloc here.
-	//       Plus, the OS will ensure that'll always be smarter than malloc + memset ;).
-	// NOTE: Since we re-use line on each iteration of the loop,
-	//       we do also need to clear it at the end of the loop, in preparation of the next iteration.
 
-	LOG("Need %hu lines to print %u characters over %hu available columns", lines, charcount, available_cols);
-
-	// Do the initial computation outside the loop,
-	// so we'll be able to re-use line_len to accurately compute chars_left when looping.
-	// NOTE: This is where it gets tricky. With multibyte sequences, 1 byte doesn't necessarily mean 1 char.
-	//       And we need to work both in amount of characters for column/width arithmetic,
-	//       and in bytes for snprintf...
-	unsigned int       chars_left = charcount;
-	unsigned short int line_len   = 0U;
 	// If we have multiple lines worth of stuff to print, draw it line per line
-	while (chars_left > line_len) {
-		LOG("Line %hu (of ~%hu), previous line was %hu characters long and there were %u characters left to print",
-		    (unsigned short int) (multiline_offset + 1U),
+	for (unsigned short int l = 0U; l < lines; l++) {
+		pos      = spans[l].pos;
+		line_len = (unsigned short int) spans[l].len;
+		LOG("Line %hu (of %hu), %hu characters long, starting at character %u",
+		    (unsigned short int) (l + 1U),
 		    lines,
 		    line_len,
-		    chars_left);
-		// Make sure we don't try to draw off-screen...
-		if (row + multiline_offset >= MAXROWS) {
-			LOG("Can only print %hu lines, discarding the %u characters left!",
-			    MAXROWS,
-			    chars_left - line_len);
-			// And that's it, we're done.
-			break;
-		}
-
-		// Compute the amount of characters left to print...
-		chars_left -= line_len;
-		// And use it to compute the amount of characters to print on *this* line
-		line_len = (unsigned short int) MIN(chars_left, available_cols);
-		LOG("Characters to print: %hu out of the %u remaining ones", line_len, chars_left);
-
-		// NOTE: Now we just have to switch from characters to bytes, both for line_len & chars_left...
-		// First, get the byte offset of this section of our string (i.e., this line)...
-		unsigned int line_offset = u8_offset(string, charcount - chars_left);
-		// ... then compute how many bytes we'll need to store it.
-		unsigned int       line_bytes = 0U;
-		unsigned short int cn         = 0U;
-		uint32_t           ch         = 0U;
-		while ((ch = u8_nextchar(string + line_offset, &line_bytes)) != 0U) {
-			cn++;
-			// NOTE: Honor linefeeds...
-			//       The main use-case for this is throwing tail'ed logfiles at us and having them
-			//       be readable instead of a jumbled glued together mess ;).
-			if (ch == 0x0A) {
-				LOG("Caught a linefeed!");
-				// NOTE: We're essentially forcing a reflow by cutting the line mid-stream,
-				//       so we have to update our counters...
-				//       But we can only correct *one* of chars_left or line_len,
-				//       to avoid screwing the count on the next iteration if we correct both,
-				//       since the one depend on the other.
-				//       And as, for the rest of this iteration/line, we only rely on
-				//       line_len being accurate (for padding & centering), the choice is easy.
-				// Increment lines, because of course we're adding a line,
-				// even if the reflowing changes that'll cause mean we might not end up using it.
-				lines++;
-				// Don't decrement the byte index, we want to print the LF,
-				// (it'll render as a blank), mostly to make padding look nicer,
-				// but also so that line_bytes matches line_len ;).
-				// And finally, as we've explained earlier, trim line_len to where we stopped.
-				LOG("Line length was %hu characters, but LF is character number %u", line_len, cn);
-				line_len = cn;
-				// Don't touch line_offset, the beginning of our line has not changed,
-				// only its length was cut short.
-				LOG("Adjusted lines to %hu & line_len to %hu", lines, line_len);
-				// And of course we break, because that was the whole point of this shenanigan!
-				break;
-			}
-			// We've walked our full line, stop!
-			if (cn >= line_len) {
-				break;
-			}
-		}
-		LOG("Line takes up %u bytes", line_bytes);
-		int bytes_printed = 0;
+		    pos);
 
 		// Just fudge the column for centering...
 		bool halfcell_offset = false;
@@ -2234,15 +2858,19 @@ int
 			LOG("Adjusted column to %hd for centering", col);
 		}
 
-		// When centered & padded, we need to split the padding in two, left & right.
+		// Compute our padding, in blanks...
+		// NOTE: Don't touch line_len, because we're *adding* new blank characters,
+		//       we're still printing the exact same amount of characters *from our string*.
+		unsigned short int left_pad  = 0U;
+		unsigned short int right_pad = 0U;
 		if (fbink_config->is_centered && fbink_config->is_padded) {
+			// When centered & padded, we need to split the padding in two, left & right.
 			// We always want full padding
 			col = 0;
 
-			// Compute our padding length
-			unsigned short int left_pad = (unsigned short int) (MAXCOLS - line_len) / 2U;
+			left_pad = (unsigned short int) (MAXCOLS - line_len) / 2U;
 			// As for the right padding, we basically just have to print 'til the edge of the screen
-			unsigned short int right_pad = (unsigned short int) (MAXCOLS - line_len - left_pad);
+			right_pad = (unsigned short int) (MAXCOLS - line_len - left_pad);
 
 			// Compute the effective right padding value for science!
 			LOG("Total size: %hu + %hu + %hu = %hu",
@@ -2250,52 +2878,34 @@ int
 			    line_len,
 			    right_pad,
 			    (unsigned short int) (left_pad + line_len + right_pad));
-
-			// NOTE: To recap:
-			//       Copy at most (MAXCOLS * 4) + 1 bytes into line
-			//       (thus ensuring both that its NULL-terminated, and fits a full UTF-8 string)
-			//       Left-pad a blank with spaces for left_pad characters
-			//       Print line_len characters of our string at the correct position for this line
-			//       Right pad a blank with spaces for right_pad characters
-			//           Given that we split this in three sections,
-			//           left-padding would have had a similar effect.
-			bytes_printed = snprintf(line,
-						 (MAXCOLS * 4U) + 1U,
-						 "%*s%.*s%-*s",
-						 (int) left_pad,
-						 "",
-						 (int) line_bytes,
-						 string + line_offset,
-						 (int) right_pad,
-						 "");
 		} else if (fbink_config->is_padded) {
-			// NOTE: Rely on the field width for padding ;).
-			// Padding character is a space, which is 1 byte, so that's good enough ;).
-			unsigned int padded_bytes = line_bytes + (unsigned int) (available_cols - line_len);
-			// NOTE: Don't touch line_len, because we're *adding* new blank characters,
-			//       we're still printing the exact same amount of characters *from our string*.
-			LOG("Padded %u bytes to %u to cover %hu columns", line_bytes, padded_bytes, available_cols);
-			bytes_printed = snprintf(
-			    line, padded_bytes + 1U, "%*.*s", (int) padded_bytes, (int) line_bytes, string + line_offset);
-		} else {
-			// NOTE: Enforce precision for safety.
-			bytes_printed = snprintf(
-			    line, line_bytes + 1U, "%*.*s", (int) line_bytes, (int) line_bytes, string + line_offset);
+			// Otherwise, we pad on the left, up to the edge of the screen.
+			left_pad = (unsigned short int) (available_cols - line_len);
+			LOG("Padded %hu characters to cover %hu columns", line_len, available_cols);
+		}
+
+		// Lay it out: left padding, our span of text, right padding...
+		unsigned short int n = 0U;
+		while (n < left_pad) {
+			line[n++] = 0x20;
+		}
+		memcpy(line + n, text + pos, line_len * sizeof(*line));
+		n = (unsigned short int) (n + line_len);
+		while (n < left_pad + line_len + right_pad) {
+			line[n++] = 0x20;
 		}
-		LOG("snprintf wrote %d bytes", bytes_printed);
 
 		// NOTE: And don't forget our wraparound marker (U+2588, a solid black block).
 		//       We don't need nor even *want* to add it if the line is already full,
 		//       (since the idea is to make it clearer when we're potentially mixing up content from two different lines).
-		//       Plus, that'd bork the region in the following draw call, and potentially risk a buffer overflow anyway.
+		//       Plus, that'd bork the region in the following draw call.
 		if (wrapped_line && line_len < available_cols) {
 			LOG("Capping the line with a solid block to make it clearer it has wrapped around...");
-			strcat(line, "\u2588");
-			// NOTE: U+2588 (█) is a multibyte sequence, namely, it takes 3 bytes
-			bytes_printed += 3;
+			line[n++] = 0x2588;
 		}
 
 		region = draw(line,
+			      n,
 			      (unsigned short int) row,
 			      (unsigned short int) col,
 			      multiline_offset,
@@ -2304,31 +2914,20 @@ int
 
 		// Next line!
 		multiline_offset++;
-
-		// NOTE: If we've actually written something, and we're not the final line,
-		//       clear what we've just written, to get back a pristine NULL-filled buffer,
-		//       so u8_nextchar() has zero chance to skip a NULL on the next iteration.
-		//       See the comments around the initial calloc() call for more details.
-		if (bytes_printed > 0 && line_len < chars_left) {
-			LOG("We have more stuff to print, clearing the line buffer for re-use!\n");
-			memset(line, 0, (size_t) bytes_printed);
-		}
-		// The nuclear option is simply to unconditonally zero the *full* buffer ;).
-		//memset(line, 0, ((MAXCOLS + 1U) * 4U) * sizeof(*line));
 	}
 
 	// Rotate the region if need be...
-	if (deviceQuirks.isKobo16Landscape) {
-		rotate_region(&region);
-	}
+	rotate_region(&region);
 
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (fbink_config->is_cleared) {
 		fullscreen_region(&region);
 	}
 
-	// Refresh screen
-	if (refresh(fbfd, region, WAVEFORM_MODE_AUTO, fbink_config->is_flashing) != EXIT_SUCCESS) {
+	// Refresh screen, unless nothing actually changed (c.f., use_diff), or we're batching refreshes (c.f., fbink_begin)
+	uint32_t wfm = WAVEFORM_MODE_AUTO;
+	if (commit_region(&region, &wfm, fbink_config->is_flashing) &&
+	    refresh(fbfd, region, wfm, fbink_config->is_flashing) != EXIT_SUCCESS) {
 		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
 		rv = ERRCODE(EXIT_FAILURE);
 		goto cleanup;
@@ -2340,6 +2939,8 @@ int
 	// Cleanup
 cleanup:
 	free(line);
+	free(spans);
+	free(text);
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -2613,11 +3214,14 @@ int
 		}
 
 		// We enforce centering for the percentage text...
-		// NOTE: Zero init, and leave enough space for a *wide* NULL,
-		//       to avoid spurious behavior with u8_strlen later on...
+		// NOTE: It's pure ASCII, so we can just widen it to codepoints for draw ;).
 		char percentage_text[8] = { 0 };
 		snprintf(percentage_text, sizeof(percentage_text), "%hhu%%", value);
-		size_t line_len = strlen(percentage_text);
+		size_t   line_len          = strlen(percentage_text);
+		uint32_t percentage_cps[8] = { 0U };
+		for (size_t i = 0U; i < line_len; i++) {
+			percentage_cps[i] = (uint32_t) percentage_text[i];
+		}
 
 		bool      halfcell_offset = false;
 		short int col             = (short int) ((unsigned short int) (MAXCOLS - line_len) / 2U);
@@ -2633,7 +3237,8 @@ int
 		}
 
 		// Draw percentage in the middle of the bar...
-		draw(percentage_text,
+		draw(percentage_cps,
+		     (unsigned short int) line_len,
 		     (unsigned short int) row,
 		     (unsigned short int) col,
 		     0U,
@@ -2705,9 +3310,7 @@ int
 	}
 
 	// Rotate the region if need be...
-	if (deviceQuirks.isKobo16Landscape) {
-		rotate_region(&region);
-	}
+	rotate_region(&region);
 
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (fbink_config->is_cleared) {
@@ -2719,7 +3322,9 @@ int
 	//       It has the added benefit of increasing the framerate limit after which the eInk controller risks getting
 	//       confused (unless is_flashing is enabled, since that'll block,
 	//       essentially throttling the bar to the screen's refresh rate).
-	if (refresh(fbfd, region, WAVEFORM_MODE_AUTO, fbink_config->is_flashing) != EXIT_SUCCESS) {
+	uint32_t wfm = WAVEFORM_MODE_AUTO;
+	if (commit_region(&region, &wfm, fbink_config->is_flashing) &&
+	    refresh(fbfd, region, wfm, fbink_config->is_flashing) != EXIT_SUCCESS) {
 		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
 		return ERRCODE(EXIT_FAILURE);
 	}
@@ -3129,74 +3734,150 @@ int
 	//       and make use of a few different blitting tweaks depending on the situation...
 	//       And since we can easily do so from here,
 	//       we also entirely avoid trying to plot off-screen pixels (on any sides).
-	if (fb_is_grayscale) {
-		// 4bpp & 8bpp
-		if (!fbink_config->ignore_alpha && img_has_alpha) {
-			if (!fb_is_legacy) {
-				// 8bpp
+	if (fb_is_legacy) {
+		// 4bpp
+		// NOTE: The fb stores two pixels per byte, so we build each row of packed pixels in a buffer mirroring
+		//       the span of the fb it covers, and write it back to the fb in one go,
+		//       instead of doing a read-modify-write on the fb for every single nibble.
+		//       We only ever need to read from the fb to blend, or to preserve a nibble on either edge of the span.
+		const unsigned short int row_x      = (unsigned short int) (img_x_off + x_off);
+		const unsigned short int row_end    = (unsigned short int) ((uint32_t) row_x + max_width - img_x_off - 1U);
+		const size_t             row_offset = (size_t)(row_x >> 1U);
+		const size_t             row_len    = (size_t)(row_end >> 1U) - row_offset + 1U;
+		if (img_x_off < max_width && img_y_off < max_height) {
+			damage_rect(row_x,
+				    (unsigned short int) (img_y_off + y_off),
+				    (uint32_t) max_width - img_x_off,
+				    (uint32_t) max_height - img_y_off);
+			unsigned char* row = malloc(row_len);
+			if (row == NULL) {
+				char  buf[256];
+				char* errstr = strerror_r(errno, buf, sizeof(buf));
+				fprintf(stderr, "[FBInk] malloc (row): %s\n", errstr);
+				stbi_image_free(data);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// Map an image pixel straight to a nibble, honoring inversion (and, as such, the inverted palette on legacy devices).
+			uint8_t nibbles[256];
+			for (uint16_t v = 0U; v < 256U; v++) {
+				nibbles[v] = (uint8_t)((v ^ invert) >> 4U);
+			}
+			size_t pix_offset;
+			if (!fbink_config->ignore_alpha && img_has_alpha) {
 				// There's an alpha channel in the image, we'll have to do alpha blending...
-				// c.f., https://en.wikipedia.org/wiki/Alpha_compositing
-				//       https://blogs.msdn.microsoft.com/shawnhar/2009/11/06/premultiplied-alpha/
-				FBInkCoordinates coords   = { 0U };
-				FBInkColor       bg_color = { 0U };
-				size_t           pix_offset;
-				FBInkPixelG8A    img_px;
-				uint8_t          ainv = 0U;
+				// c.f., the 8bpp codepath for details.
+				FBInkPixelG8A img_px;
+				uint8_t       ainv = 0U;
 				for (j = img_y_off; j < max_height; j++) {
-					for (i = img_x_off; i < max_width; i++) {
+					unsigned char* fb_row =
+					    fbPtr + ((unsigned short int) (j + y_off) * fInfo.line_length) + row_offset;
+					// We need to know what this span currently looks like in the framebuffer...
+					memcpy(row, fb_row, row_len);
+					// Index of the nibble we're working on in our row (even nibbles are the high ones).
+					size_t nib = row_x & 0x01;
+					for (i = img_x_off; i < max_width; i++, nib++) {
 						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
 						pix_offset = (size_t)(((j << 1U) * w) + (i << 1U));
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-						// First, we gobble the full image pixel (all 2 bytes)
+						// We gobble the full image pixel (all 2 bytes)
 						img_px.p = *((uint16_t*) &data[pix_offset]);
 #	pragma GCC diagnostic pop
 
+						uint8_t v;
 						// Take a shortcut for the most common alpha values (none & full)
 						if (img_px.color.a == 0xFF) {
-							// Fully opaque, we can blit the image (almost) directly.
-							// We do need to honor inversion ;).
-							color.r = img_px.color.v ^ invert;
-
-							coords.x = (unsigned short int) (i + x_off);
-							coords.y = (unsigned short int) (j + y_off);
-
-							(*fxpPutPixel)(&coords, &color);
+							// Fully opaque
+							v = nibbles[img_px.color.v];
 						} else if (img_px.color.a == 0) {
 							// Transparent! Keep fb as-is.
+							continue;
 						} else {
-							// Alpha blending...
-
-							// We need to know what this pixel currently looks like in the framebuffer...
-							coords.x = (unsigned short int) (i + x_off);
-							coords.y = (unsigned short int) (j + y_off);
-							// NOTE: We use the the function pointers directly, to avoid the OOB checks,
-							//       because we know we're only processing on-screen pixels,
-							//       and we don't care about the rotation checks at this bpp :).
-							(*fxpGetPixel)(&coords, &bg_color);
-
+							// Alpha blending, against the underlying nibble, expanded to 8bpp (c.f., get_pixel_Gray4).
+							uint8_t bg = (uint8_t)((((nib & 0x01) == 0) ? (row[nib >> 1U] >> 4U)
+												  : (row[nib >> 1U] & 0x0F)) *
+									       0x11);
 							ainv = img_px.color.a ^ 0xFF;
 							// Don't forget to honor inversion
 							img_px.color.v ^= invert;
 							// Blend it!
-							color.r = (uint8_t) DIV255(
-							    ((img_px.color.v * img_px.color.a) + (bg_color.r * ainv)));
-
-							(*fxpPutPixel)(&coords, &color);
+							v = (uint8_t)(DIV255(((img_px.color.v * img_px.color.a) + (bg * ainv))) >> 4U);
+						}
+						if ((nib & 0x01) == 0) {
+							row[nib >> 1U] = (unsigned char) ((row[nib >> 1U] & 0x0F) | (v << 4U));
+						} else {
+							row[nib >> 1U] = (unsigned char) ((row[nib >> 1U] & 0xF0) | v);
 						}
 					}
+					memcpy(fb_row, row, row_len);
 				}
 			} else {
-				// 4bpp
-				// NOTE: The fact that the fb stores two pixels per byte means we can't take any shortcut,
-				//       because they may only apply to one of those two pixels...
-				FBInkCoordinates coords   = { 0U };
-				FBInkColor       bg_color = { 0U };
-				size_t           pix_offset;
-				FBInkPixelG8A    img_px;
-				uint8_t          ainv = 0U;
+				// No alpha in image, or ignored
 				for (j = img_y_off; j < max_height; j++) {
-					for (i = img_x_off; i < max_width; i++) {
+					unsigned char* fb_row =
+					    fbPtr + ((unsigned short int) (j + y_off) * fInfo.line_length) + row_offset;
+					size_t k = 0U;
+					i        = img_x_off;
+					// NOTE: Here, req_n is either 2, or 1 if ignore_alpha, so, no shift trickery ;)
+					pix_offset = (size_t)((j * req_n * w) + (i * req_n));
+					// If we start on an odd pixel, keep the high nibble as-is
+					if ((row_x & 0x01) != 0) {
+						row[k++] = (unsigned char) ((fb_row[0] & 0xF0) | nibbles[data[pix_offset]]);
+						i++;
+						pix_offset += (size_t) req_n;
+					}
+					// Then build two pixels at a time
+					for (; i + 1U < max_width; i = (unsigned short int) (i + 2U)) {
+						row[k++] = (unsigned char) ((nibbles[data[pix_offset]] << 4U) |
+									    nibbles[data[pix_offset + (size_t) req_n]]);
+						pix_offset += (size_t) req_n << 1U;
+					}
+					// And if we end on an even pixel, keep the low nibble as-is
+					if (i < max_width) {
+						row[k] = (unsigned char) ((nibbles[data[pix_offset]] << 4U) | (fb_row[k] & 0x0F));
+					}
+					memcpy(fb_row, row, row_len);
+				}
+			}
+			free(row);
+		}
+	} else if (fb_is_grayscale) {
+		// 8bpp
+		if (!fbink_config->ignore_alpha && img_has_alpha) {
+			// There's an alpha channel in the image, we'll have to do alpha blending...
+			// c.f., https://en.wikipedia.org/wiki/Alpha_compositing
+			//       https://blogs.msdn.microsoft.com/shawnhar/2009/11/06/premultiplied-alpha/
+			FBInkCoordinates coords   = { 0U };
+			FBInkColor       bg_color = { 0U };
+			size_t           pix_offset;
+			FBInkPixelG8A    img_px;
+			uint8_t          ainv = 0U;
+			for (j = img_y_off; j < max_height; j++) {
+				for (i = img_x_off; i < max_width; i++) {
+					// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
+					pix_offset = (size_t)(((j << 1U) * w) + (i << 1U));
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wcast-align"
+					// First, we gobble the full image pixel (all 2 bytes)
+					img_px.p = *((uint16_t*) &data[pix_offset]);
+#	pragma GCC diagnostic pop
+
+					// Take a shortcut for the most common alpha values (none & full)
+					if (img_px.color.a == 0xFF) {
+						// Fully opaque, we can blit the image (almost) directly.
+						// We do need to honor inversion ;).
+						color.r = img_px.color.v ^ invert;
+
+						coords.x = (unsigned short int) (i + x_off);
+						coords.y = (unsigned short int) (j + y_off);
+
+						(*fxpPutPixel)(&coords, &color);
+					} else if (img_px.color.a == 0) {
+						// Transparent! Keep fb as-is.
+					} else {
+						// Alpha blending...
+
 						// We need to know what this pixel currently looks like in the framebuffer...
 						coords.x = (unsigned short int) (i + x_off);
 						coords.y = (unsigned short int) (j + y_off);
@@ -3205,14 +3886,6 @@ int
 						//       and we don't care about the rotation checks at this bpp :).
 						(*fxpGetPixel)(&coords, &bg_color);
 
-						// NOTE: In this branch, req_n == 2, so we can do << 1 instead of * 2 ;).
-						pix_offset = (size_t)(((j << 1U) * w) + (i << 1U));
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Wcast-align"
-						// We gobble the full image pixel (all 2 bytes)
-						img_px.p = *((uint16_t*) &data[pix_offset]);
-#	pragma GCC diagnostic pop
-
 						ainv = img_px.color.a ^ 0xFF;
 						// Don't forget to honor inversion
 						img_px.color.v ^= invert;
@@ -3245,6 +3918,13 @@ int
 		}
 	} else if (fb_is_true_bgr) {
 		// 24bpp & 32bpp
+		// NOTE: We write to the fb directly, so, keep track of what we're about to touch.
+		if (img_x_off < max_width && img_y_off < max_height) {
+			damage_rect((unsigned short int) (img_x_off + x_off),
+				    (unsigned short int) (img_y_off + y_off),
+				    (uint32_t) max_width - img_x_off,
+				    (uint32_t) max_height - img_y_off);
+		}
 		if (!fbink_config->ignore_alpha && img_has_alpha) {
 			FBInkPixelRGBA img_px;
 			uint8_t        ainv = 0U;
@@ -3442,98 +4122,111 @@ int
 		}
 	} else {
 		// 16bpp
-		if (!fbink_config->ignore_alpha && img_has_alpha) {
-			FBInkCoordinates coords   = { 0U };
-			FBInkColor       bg_color = { 0U };
-			size_t           pix_offset;
-			FBInkPixelRGBA   img_px;
-			uint8_t          ainv = 0U;
-			for (j = img_y_off; j < max_height; j++) {
-				for (i = img_x_off; i < max_width; i++) {
-					// NOTE: Same general idea as the fb_is_grayscale case,
-					//       except at this bpp we then have to handle rotation ourselves...
-					// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
-					pix_offset = (size_t)(((j << 2U) * w) + (i << 2U));
+		// NOTE: This is the only bpp where our view may be rotated (c.f., isKobo16Landscape),
+		//       so we render the image in bands of ROTATE_TILE rows, which we then let the rotation-aware blitter
+		//       move to the fb in one go (as well as from it, when we need to alpha-blend).
+		const bool               has_alpha = (!fbink_config->ignore_alpha && img_has_alpha);
+		const unsigned short int band_w    = (unsigned short int) (max_width - img_x_off);
+		if (img_x_off < max_width && img_y_off < max_height) {
+			uint16_t* band = malloc(sizeof(*band) * band_w * ROTATE_TILE);
+			if (band == NULL) {
+				char  buf[256];
+				char* errstr = strerror_r(errno, buf, sizeof(buf));
+				fprintf(stderr, "[FBInk] malloc (band): %s\n", errstr);
+				stbi_image_free(data);
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			const size_t             band_pitch = sizeof(*band) * band_w;
+			const unsigned short int band_x     = (unsigned short int) (img_x_off + x_off);
+			unsigned short int       band_h;
+			FBInkColor               bg_color = { 0U };
+			size_t                   pix_offset;
+			for (unsigned short int bj = img_y_off; bj < max_height; bj = (unsigned short int) (bj + band_h)) {
+				band_h = (unsigned short int) MIN(ROTATE_TILE, (unsigned int) (max_height - bj));
+				const unsigned short int band_y = (unsigned short int) (bj + y_off);
+				uint16_t*                px     = band;
+				if (has_alpha) {
+					FBInkPixelRGBA img_px;
+					uint8_t        ainv = 0U;
+					// We need to know what those pixels currently look like in the framebuffer...
+					grab_rotated((unsigned char*) band, band_pitch, band_x, band_y, band_w, band_h);
+					for (j = bj; j < bj + band_h; j++) {
+						for (i = img_x_off; i < max_width; i++, px++) {
+							// NOTE: In this branch, req_n == 4, so we can do << 2 instead of * 4 ;).
+							pix_offset = (size_t)(((j << 2U) * w) + (i << 2U));
 #	pragma GCC diagnostic push
 #	pragma GCC diagnostic ignored "-Wcast-align"
-					// Gobble the full image pixel (all 4 bytes)
-					img_px.p = *((uint32_t*) &data[pix_offset]);
+							// Gobble the full image pixel (all 4 bytes)
+							img_px.p = *((uint32_t*) &data[pix_offset]);
 #	pragma GCC diagnostic pop
 
-					// Take a shortcut for the most common alpha values (none & full)
-					if (img_px.color.a == 0xFF) {
-						// Fully opaque, we can blit the image (almost) directly.
-						// We do need to handle BGR and honor inversion ;).
-						img_px.p ^= invert_rgb;
-						color.r = img_px.color.r;
-						color.g = img_px.color.g;
-						color.b = img_px.color.b;
-
-						coords.x = (unsigned short int) (i + x_off);
-						coords.y = (unsigned short int) (j + y_off);
-						(*fxpRotateCoords)(&coords);
-						(*fxpPutPixel)(&coords, &color);
-					} else if (img_px.color.a == 0) {
-						// Transparent! Keep fb as-is.
-					} else {
-						// Alpha blending...
-						ainv = img_px.color.a ^ 0xFF;
-
-						coords.x = (unsigned short int) (i + x_off);
-						coords.y = (unsigned short int) (j + y_off);
-						(*fxpRotateCoords)(&coords);
-						(*fxpGetPixel)(&coords, &bg_color);
-
-						// Don't forget to honor inversion
-						img_px.p ^= invert_rgb;
-						// Blend it, we get our BGR swap in the process ;).
-						color.r = (uint8_t) DIV255(
-						    ((img_px.color.r * img_px.color.a) + (bg_color.r * ainv)));
-						color.g = (uint8_t) DIV255(
-						    ((img_px.color.g * img_px.color.a) + (bg_color.r * ainv)));
-						color.b = (uint8_t) DIV255(
-						    ((img_px.color.b * img_px.color.a) + (bg_color.b * ainv)));
-
-						(*fxpPutPixel)(&coords, &color);
+							// Take a shortcut for the most common alpha values (none & full)
+							if (img_px.color.a == 0xFF) {
+								// Fully opaque, we can blit the image (almost) directly.
+								// We do need to handle BGR and honor inversion ;).
+								img_px.p ^= invert_rgb;
+								color.r = img_px.color.r;
+								color.g = img_px.color.g;
+								color.b = img_px.color.b;
+
+								*px = (uint16_t) pack_pixel(16U, &color);
+							} else if (img_px.color.a == 0) {
+								// Transparent! Keep fb as-is.
+							} else {
+								// Alpha blending...
+								ainv = img_px.color.a ^ 0xFF;
+
+								unpack_pixel_RGB565(*px, &bg_color);
+
+								// Don't forget to honor inversion
+								img_px.p ^= invert_rgb;
+								// Blend it, we get our BGR swap in the process ;).
+								color.r = (uint8_t) DIV255(
+								    ((img_px.color.r * img_px.color.a) + (bg_color.r * ainv)));
+								color.g = (uint8_t) DIV255(
+								    ((img_px.color.g * img_px.color.a) + (bg_color.r * ainv)));
+								color.b = (uint8_t) DIV255(
+								    ((img_px.color.b * img_px.color.a) + (bg_color.b * ainv)));
+
+								*px = (uint16_t) pack_pixel(16U, &color);
+							}
+						}
+					}
+				} else {
+					// No alpha in image, or ignored
+					// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
+					for (j = bj; j < bj + band_h; j++) {
+						for (i = img_x_off; i < max_width; i++, px++) {
+							// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
+							pix_offset = (size_t)((j * req_n * w) + (i * req_n));
+							color.r    = data[pix_offset + 0] ^ invert;
+							color.g    = data[pix_offset + 1] ^ invert;
+							color.b    = data[pix_offset + 2] ^ invert;
+
+							*px = (uint16_t) pack_pixel(16U, &color);
+						}
 					}
 				}
+				blit_rotated((const unsigned char*) band, band_pitch, band_x, band_y, band_w, band_h);
 			}
-		} else {
-			// No alpha in image, or ignored
-			size_t           pix_offset;
-			FBInkCoordinates coords = { 0U };
-			// NOTE: For some reason, reading the image 3 or 4 bytes at once doesn't win us anything, here...
-			for (j = img_y_off; j < max_height; j++) {
-				for (i = img_x_off; i < max_width; i++) {
-					// NOTE: Here, req_n is either 4, or 3 if ignore_alpha, so, no shift trickery ;)
-					pix_offset = (size_t)((j * req_n * w) + (i * req_n));
-					color.r    = data[pix_offset + 0] ^ invert;
-					color.g    = data[pix_offset + 1] ^ invert;
-					color.b    = data[pix_offset + 2] ^ invert;
-
-					coords.x = (unsigned short int) (i + x_off);
-					coords.y = (unsigned short int) (j + y_off);
-					// NOTE: Again, we can only skip the OOB checks at this bpp.
-					(*fxpRotateCoords)(&coords);
-					(*fxpPutPixel)(&coords, &color);
-				}
-			}
+			free(band);
 		}
 	}
 	stbi_image_free(data);
 
 	// Rotate the region if need be...
-	if (deviceQuirks.isKobo16Landscape) {
-		rotate_region(&region);
-	}
+	rotate_region(&region);
 
 	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
 	if (fbink_config->is_cleared) {
 		fullscreen_region(&region);
 	}
 
-	// Refresh screen
-	if (refresh(fbfd, region, WAVEFORM_MODE_GC16, fbink_config->is_flashing) != EXIT_SUCCESS) {
+	// Refresh screen, unless nothing actually changed (c.f., use_diff), or we're batching refreshes (c.f., fbink_begin)
+	uint32_t wfm = WAVEFORM_MODE_GC16;
+	if (commit_region(&region, &wfm, fbink_config->is_flashing) &&
+	    refresh(fbfd, region, wfm, fbink_config->is_flashing) != EXIT_SUCCESS) {
 		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
 	}
 
@@ -3577,5 +4270,33 @@ cleanup:
 // Various other small fonts (c.f., CREDITS for details)
 #	include "fbink_misc_fonts.c"
 #endif
+// Our glyph cache
+#include "fbink_glyph_cache.c"
+// Bitmask to pixel expansion kernels
+#include "fbink_expand.c"
+// Rotation-aware blitting
+#include "fbink_rotate.c"
+// Shadow buffer rendering
+#include "fbink_shadow.c"
+// Draw batching (fbink_begin & fbink_commit)
+#include "fbink_batch.c"
+// A tiny VT100-ish terminal (fbink_console_write)
+#include "fbink_console.c"
+// A retained grid of text cells (fbink_grid_*)
+#include "fbink_grid.c"
+// Our UTF-8 decoder
+#include "fbink_utf8.c"
+// External font files (fbink_register_font)
+#include "fbink_user_fonts.c"
+// Font fallback
+#include "fbink_fallback.c"
+// OpenType rendering
+#include "fbink_ot.c"
+// Update markers & completion tracking
+#include "fbink_async.c"
+// Refresh coalescing
+#include "fbink_coalesce.c"
+// Content-aware waveform modes
+#include "fbink_waveform.c"
 // Contains fbink_button_scan's implementation, Kobo only, and has a bit of Linux MT input thrown in ;).
 #include "fbink_button_scan.c"
@@ -53,6 +53,12 @@
 // Magic number for automatic fbfd handling
 #define FBFD_AUTO -1
 
+// How many fallback fonts can follow the main one (c.f., FBInkConfig's fallback_fonts)
+#define MAX_FALLBACK_FONTS 3U
+
+// Magic marker for the latest update we sent (c.f., fbink_wait_for_complete)
+#define LAST_MARKER 0U
+
 // List of available fonts
 typedef enum
 {
@@ -74,7 +80,8 @@ typedef enum
 	ORPI,              // orp (italic)
 	SCIENTIFICA,       // scientifica (regular)
 	SCIENTIFICAB,      // scientifica (bold)
-	SCIENTIFICAI       // scientifica (italic)
+	SCIENTIFICAI,      // scientifica (italic)
+	USER_FONT = 128U   // First font registered via fbink_register_font (the next one is USER_FONT + 1, and so on)
 } FONT_INDEX_T;
 
 // List of available halign/valign values
@@ -130,26 +137,29 @@ typedef enum
 // A struct to dump FBInk's internal state into, like fbink_state_dump() would, but in C ;)
 typedef struct
 {
-	uint32_t           view_width;          // viewWidth
-	uint32_t           view_height;         // viewHeight
-	uint32_t           screen_width;        // screenWidth
-	uint32_t           screen_height;       // screenHeight
-	uint8_t            view_hori_origin;    // viewHoriOrigin
-	uint8_t            view_vert_origin;    // viewVertOrigin
-	uint8_t            view_vert_offset;    // viewVertOffset
-	uint32_t           bpp;                 // vInfo.bits_per_pixel
-	unsigned short int font_w;              // FONTW
-	unsigned short     font_h;              // FONTH
-	uint8_t            fontsize_mult;       // FONTSIZE_MULT
-	const char*        font_name;           // fbink_config->fontname
-	uint8_t            glyph_width;         // glyphWidth
-	uint8_t            glyph_height;        // glyphHeight
-	unsigned short int max_cols;            // MAXCOLS
-	unsigned short int max_rows;            // MAXROWS
-	bool               is_perfect_fit;      // deviceQuirks.isPerfectFit
-	long int           user_hz;             // USER_HZ
-	uint8_t            pen_fg_color;        // penFGColor
-	uint8_t            pen_bg_color;        // penFGColor;
+	uint32_t           view_width;            // viewWidth
+	uint32_t           view_height;           // viewHeight
+	uint32_t           screen_width;          // screenWidth
+	uint32_t           screen_height;         // screenHeight
+	uint8_t            view_hori_origin;      // viewHoriOrigin
+	uint8_t            view_vert_origin;      // viewVertOrigin
+	uint8_t            view_vert_offset;      // viewVertOffset
+	uint32_t           bpp;                   // vInfo.bits_per_pixel
+	unsigned short int font_w;                // FONTW
+	unsigned short     font_h;                // FONTH
+	uint8_t            fontsize_mult;         // FONTSIZE_MULT
+	const char*        font_name;             // fbink_config->fontname
+	uint8_t            glyph_width;           // glyphWidth
+	uint8_t            glyph_height;          // glyphHeight
+	unsigned short int max_cols;              // MAXCOLS
+	unsigned short int max_rows;              // MAXROWS
+	bool               is_perfect_fit;        // deviceQuirks.isPerfectFit
+	long int           user_hz;               // USER_HZ
+	uint8_t            pen_fg_color;          // penFGColor
+	uint8_t            pen_bg_color;          // penFGColor;
+	uint32_t           glyph_cache_hits;      // glyphCacheHits (i.e., glyphs drawn straight from the glyph cache)
+	uint32_t           glyph_cache_misses;    // glyphCacheMisses (i.e., glyphs that had to be rendered from scratch)
+	uint32_t           glyphs_missing;        // glyphsMissing (i.e., lookups of codepoints none of our fonts cover)
 } FBInkState;
 
 // What a FBInk config should look like. Perfectly sane when fully zero-initialized.
@@ -177,8 +187,28 @@ typedef struct
 	bool      ignore_alpha;    // Ignore any potential alpha channel in source image (i.e., flatten the image)
 	uint8_t   halign;    // Horizontal alignment of images (NONE/LEFT, CENTER, EDGE/RIGHT; c.f., ALIGN_INDEX_T enum)
 	uint8_t   valign;    // Vertical alignment of images (NONE/TOP, CENTER, EDGE/BOTTOM; c.f., ALIGN_INDEX_T enum)
+	bool      use_shadow;    // Render to a cached copy of the fb, only pushing what we drew to the fb on refresh
+	bool      use_diff;      // Only refresh what actually changed on screen (requires use_shadow)
+	bool      is_wrapped;    // Break lines between words (on spaces, after hyphens, around CJK), instead of mid-word
+	uint8_t   fallback_fonts[MAX_FALLBACK_FONTS];    // Fonts for the codepoints fontname doesn't cover (c.f., fbink_init)
+	bool      no_refresh_wait;     // Don't block until flashing refreshes complete (c.f., fbink_wait_for_complete)
+	uint8_t   coalesce_ms;         // Hold refreshes for that many ms, merging those that follow (c.f., fbink_init)
+	bool      no_auto_waveform;    // Don't pick waveform modes based on what we drew (c.f., fbink_init)
 } FBInkConfig;
 
+// What a FBInk OpenType config should look like (c.f., fbink_print_ot). Perfectly sane when fully zero-initialized.
+typedef struct
+{
+	struct
+	{
+		short int top;       // Top margin, in pixels (i.e., where the first line starts)
+		short int bottom;    // Bottom margin, in pixels (we never print past it)
+		short int left;      // Left margin, in pixels
+		short int right;     // Right margin, in pixels
+	} margins;
+	float size_px;    // Line height, in pixels (fractional sizes are fine), 0 means the same as the bitmap fonts
+} FBInkOTConfig;
+
 // NOTE: Unless otherwise specified,
 //       stuff returns a negative value (usually -(EXIT_FAILURE)) on failure & EXIT_SUCCESS otherwise ;).
 
@@ -202,7 +232,8 @@ FBINK_API int fbink_close(int fbfd);
 //				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
 // fbink_config:	pointer to an FBInkConfig struct
 //				If you wish to customize them, the fields:
-//				is_centered, fontmult, fontname, fg_color, bg_color, no_viewport, is_verbose & is_quiet
+//				is_centered, fontmult, fontname, fallback_fonts, fg_color, bg_color, no_viewport,
+//				is_verbose, is_quiet, use_shadow, use_diff, no_refresh_wait, coalesce_ms & no_auto_waveform
 //				MUST be set beforehand.
 //				This means you MUST call fbink_init() again when you update them, too!
 // NOTE: By virtue of, well, setting global variables, do NOT consider this thread-safe.
@@ -211,8 +242,37 @@ FBINK_API int fbink_close(int fbfd);
 //       this needs to be called as many times as necessary to ensure that every following fbink_* call will be made
 //       against a fb state that matches the state it was in during the last fbink_init() call...
 //       c.f., KFMon's handling of this via fbink_is_fb_quirky() to detect the initial 16bpp -> 32bpp switch.
+// NOTE: With use_shadow, we keep a copy of the fb in RAM, so that blending & overlay text don't have to read from the fb,
+//       which is usually *very* slow. That copy is only synced with the fb the first time we mmap it after this call,
+//       so this is only sane if you're the only one drawing to the fb (i.e., call this again if that's not the case).
+//       With use_diff on top of that, we also remember what's on the fb, so that a print only refreshes the pixels
+//       that actually changed (or nothing at all, if none did). Flashing refreshes are left alone, though.
+// NOTE: Codepoints that fontname doesn't cover are drawn with the first of fallback_fonts that does,
+//       centered in fontname's cells. The list ends at the first IBM, and, unless it's empty, IBM is the last resort.
+//       Fonts larger than fontname are skipped.
+//       Codepoints that none of them cover are counted in glyphs_missing (c.f., FBInkState).
+// NOTE: With coalesce_ms (5 to 20ms is usually plenty), refreshes aren't sent right away, but held for that long,
+//       so that the ones that follow in the meantime can be merged with them, like fbink_commit() does.
+//       That's sent as fewer, larger refreshes, which the EPDC handles much better than a flurry of tiny ones.
+//       A thread of our own (with its own fd to the framebuffer) sends them once that window has expired.
+//       A flashing refresh closes the window early. So do fbink_wait_for_complete() & fbink_close().
+//       Set it back to 0 (and call this again) to send everything that's pending, and stop coalescing.
+// NOTE: Unless no_auto_waveform is set, we look at what we drew before refreshing it (that's cheaper with use_shadow),
+//       and refresh pure black & white content in DU, which is much faster than GC16.
+//       Otherwise, text is refreshed in REAGL (on devices that support it) or GL16, and images in GC16.
+//       Flashing refreshes are left alone, as are explicit waveform modes (c.f., fbink_refresh).
 FBINK_API int fbink_init(int fbfd, const FBInkConfig* fbink_config);
 
+// Register an external font file (as built by tools/mkfont.py out of a PSF, BDF or Unifont hex font),
+// so that it can be used as fontname.
+// Returns the font's index (i.e., what to set fontname to, USER_FONT or above) on success, or a negative value on failure.
+// The file is mmap'ed read-only, so its glyphs are only ever paged in when they're actually used,
+// and a font that's already been registered is simply reused.
+// NOTE: As with fontname, you'll need to call fbink_init() again for this to take effect.
+// NOTE: Like fbink_init, this is NOT thread-safe.
+// filename:		path to the font file
+FBINK_API int fbink_register_font(const char* filename);
+
 // Dump a few of our internal state variables to stdout, in a format easily consumable by a shell (i.e., eval)
 FBINK_API void fbink_state_dump(const FBInkConfig* fbink_config);
 
@@ -220,9 +280,8 @@ FBINK_API void fbink_state_dump(const FBInkConfig* fbink_config);
 FBINK_API void fbink_get_state(const FBInkConfig* fbink_config, FBInkState* fbink_state);
 
 // Print a string on screen.
-// NOTE: The string is expected to be encoded in valid UTF-8, no validation of any kind is done by the library,
-//       and we assume a single multibyte sequence will occupy a maximum of 4 bytes.
-//       c.f., my rant about Kobo's broken libc in fbink_internal.h for more details behind this choice.
+// NOTE: The string is expected to be encoded in UTF-8 (c.f., my rant about Kobo's broken libc in fbink_internal.h),
+//       invalid sequences are not fatal: each of them is printed as a single U+FFFD.
 //       Since any decent system built in the last decade should default to UTF-8, that should be pretty much transparent...
 // Returns the amount of lines printed on success (helpful when you keep track of which row you're printing to).
 // fbfd:		open file descriptor to the framebuffer character device,
@@ -238,6 +297,49 @@ FBINK_API int fbink_print(int fbfd, const char* string, const FBInkConfig* fbink
 FBINK_API int fbink_printf(int fbfd, const FBInkConfig* fbink_config, const char* fmt, ...)
     __attribute__((format(printf, 3, 4)));
 
+// Print a string through a tiny terminal emulator, which keeps track of its own cursor across calls,
+// and scrolls up when it runs out of rows, instead of wrapping back to the top of the screen like fbink_print.
+// Handy for logs, or whatever else would be sent to a terminal.
+// Only the rows that changed are drawn, and they're refreshed in one go once the whole string has been processed.
+// Returns EXIT_SUCCESS on success.
+// fbfd:		open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
+// string:		UTF-8 encoded string to print, possibly sprinkled with escape sequences.
+//				Multibyte & escape sequences may be split across calls.
+// fbink_config:	pointer to an FBInkConfig struct (ignores row, col, offsets, is_centered, is_padded,
+//				is_overlay & is_bgless; is_cleared also resets the console)
+// NOTE: The console's grid follows the current font & fontmult, and starts over when they change (c.f., fbink_init).
+// NOTE: What's supported is a subset of VT100/ANSI:
+//       BS, HT, CR, LF (which also implies a CR, like a tty with ONLCR), VT & FF;
+//       ESC c (reset & clear), ESC 7 & ESC 8 (save/restore cursor), ESC D, ESC E & ESC M (index/next line/reverse index);
+//       CSI A, B, C, D, E, F, G, d, H & f (cursor moves), J & K (erase), s & u (save/restore cursor),
+//       and CSI m (SGR), where only inverse video & colors are honored, the latter as gray levels.
+//       Everything else is swallowed.
+FBINK_API int fbink_console_write(int fbfd, const char* string, const FBInkConfig* fbink_config);
+
+// Update a retained grid of text cells (MAXCOLS x MAXROWS), without drawing anything (c.f., fbink_grid_flush).
+// Meant for dashboards & co, where only a few characters change between updates.
+// Returns the amount of cells that actually changed.
+// string:		UTF-8 encoded string to print, a linefeed moves to the next row, back to the initial column.
+//				Anything that goes past the right edge of the grid is dropped.
+// fbink_config:	pointer to an FBInkConfig struct (honors row & col, like fbink_print, minus the wraparound;
+//				as well as is_inverted & is_padded, which pads to the right edge of the grid)
+// NOTE: The grid follows the current font & fontmult, and starts over when they change (c.f., fbink_init).
+FBINK_API int fbink_grid_print(const char* string, const FBInkConfig* fbink_config);
+
+// Draw & refresh the cells of the grid that changed since the last flush, and only those.
+// Their refreshes are merged in as few regions as sensible, like fbink_commit does (and if you're already batching,
+// they just end up in your batch).
+// Returns the amount of cells that were drawn.
+// fbfd:		open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
+// fbink_config:	pointer to an FBInkConfig struct (honors is_flashing, is_overlay & is_bgless)
+FBINK_API int fbink_grid_flush(int fbfd, const FBInkConfig* fbink_config);
+
+// Forget everything about the grid: its cells are empty again, and nothing is assumed to be on screen anymore,
+// so the next flush will draw every cell printed since then (e.g., if something else drew over the grid).
+FBINK_API int fbink_grid_reset(void);
+
 // A simple wrapper around the internal screen refresh handling, without requiring you to include einkfb/mxcfb headers
 // fbfd:		open file descriptor to the framebuffer character device,
 //				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
@@ -255,6 +357,56 @@ FBINK_API int fbink_refresh(int         fbfd,
 			    const char* waveform_mode,
 			    bool        is_flashing);
 
+// Start batching refreshes: until the matching fbink_commit() call, fbink_print*, fbink_print_image & the progress bars
+// only draw, and remember what they would have refreshed.
+// Returns -(EBUSY) if we were already batching.
+// NOTE: fbink_refresh() is *not* batched.
+// NOTE: Like most of our state, this is global, so don't interleave batches from different threads!
+FBINK_API int fbink_begin(void);
+
+// Refresh everything that was drawn since fbink_begin(), in as few refreshes as possible, and stop batching.
+// Regions are merged when they overlap or touch, or whenever that doesn't mean refreshing more pixels than we would have
+// otherwise. A merged refresh flashes if any of its parts asked to, and uses GC16 if they disagreed on the waveform mode.
+// With use_diff, only what actually changed is refreshed (c.f., fbink_init).
+// Returns -(EINVAL) if we weren't batching.
+// fbfd:		open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
+FBINK_API int fbink_commit(int fbfd);
+
+// Every refresh we send is tagged with a marker of its own, which increases with each of them.
+// Returns the marker of the latest one (0 if we haven't sent any yet), so that you can wait on it later.
+// NOTE: By default, we block until flashing refreshes have completed, which you can opt out of via no_refresh_wait,
+//       for instance to draw the next frame while the EPDC is busy with the current one.
+// NOTE: With coalesce_ms, refreshes only get a marker once they're actually sent (c.f., fbink_init).
+FBINK_API uint32_t fbink_get_last_marker(void);
+
+// Block until the refresh tagged with marker has completed (or the driver's timeout has expired).
+// Any refresh we were still holding on to (c.f., coalesce_ms) is sent first.
+// Returns -(EINVAL) if we haven't sent any refresh yet.
+// fbfd:		open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened for the duration of this call
+// marker:		as returned by fbink_get_last_marker(), or LAST_MARKER for the latest refresh we sent
+FBINK_API int fbink_wait_for_complete(int fbfd, uint32_t marker);
+
+// Start tracking the completion of every refresh we send from now on,
+// returns a (non-blocking) eventfd that becomes readable whenever some of them have completed,
+// so that it can be polled alongside whatever else your event loop is waiting on.
+// Reading from it returns (as an uint64_t) how many of them completed since the last read,
+// and fbink_get_completed_marker() tells you which one was the latest.
+// Calling this again while we're already tracking simply returns the same fd.
+// NOTE: Completions are waited on by a thread of our own, with its own fd to the framebuffer.
+//       Refreshes are tracked in the order they were sent, and if too many of them are pending,
+//       the latest one stands for the ones we couldn't keep track of.
+FBINK_API int fbink_open_completion_fd(void);
+
+// Returns the marker of the latest tracked refresh that has completed (0 if none have yet)
+FBINK_API uint32_t fbink_get_completed_marker(void);
+
+// Stop tracking refreshes, and close the fd returned by fbink_open_completion_fd().
+// Returns -(EINVAL) if we weren't tracking anything.
+// NOTE: If a refresh is still pending, this blocks until it completes.
+FBINK_API int fbink_close_completion_fd(void);
+
 // Returns true if the device appears to be in a quirky framebuffer state
 // NOTE: Right now, this only checks for the isKobo16Landscape Device Quirk,
 //       because that's the only one that is not permanent (i.e., hardware specific),
@@ -292,6 +444,35 @@ FBINK_API int fbink_print_image(int                fbfd,
 				short int          y_off,
 				const FBInkConfig* fbink_config);
 
+// Load the TrueType/OpenType font fbink_print_ot renders with, replacing the previous one, if any.
+// Returns -(ENOSYS) when OpenType support is disabled (MINIMAL build).
+// NOTE: The file is mmap'ed, and stays mapped until the next fbink_add_ot_font or fbink_free_ot_fonts call.
+// NOTE: Like fbink_init, this is NOT thread-safe.
+// filename:		path to the font file (TTF, OTF or TTC, in which case we use its first font)
+FBINK_API int fbink_add_ot_font(const char* filename);
+
+// Unload the font loaded by fbink_add_ot_font, and free the glyphs we've rendered with it.
+// Returns -(ENOSYS) when OpenType support is disabled (MINIMAL build).
+FBINK_API int fbink_free_ot_fonts(void);
+
+// Print a string on screen with the font loaded by fbink_add_ot_font, antialiased, at any size.
+// Glyphs are laid out proportionally (with kerning), lines are broken between words to fit in the margins,
+// and honor linefeeds. Rendered glyphs are cached (per size), so that printing them again only costs a blit.
+// Returns the top margin the next line would start at on success (i.e., where to print next),
+// -(ENOSYS) when OpenType support is disabled (MINIMAL build), or -(ENODATA) when no font was loaded.
+// NOTE: Antialiasing is quantized to the 16 gray levels of the eInk palette.
+// NOTE: Text that doesn't fit above the bottom margin is discarded.
+// fbfd:		open file descriptor to the framebuffer character device,
+//				if set to FBFD_AUTO, the fb is opened & mmap'ed for the duration of this call
+// string:		UTF-8 encoded string to print
+// fbink_ot_config:	pointer to an FBInkOTConfig struct
+// fbink_config:	pointer to an FBInkConfig struct (honors is_inverted, is_flashing, is_cleared, is_centered,
+//				is_padded, is_overlay & is_bgless)
+FBINK_API int fbink_print_ot(int                  fbfd,
+			     const char*          string,
+			     const FBInkOTConfig* fbink_ot_config,
+			     const FBInkConfig*   fbink_config);
+
 // Scan the screen for Kobo's "Connect" button in the "USB plugged in" popup,
 // and optionally generate an input event to press that button.
 // KOBO Only! Returns -(ENOSYS) when disabled (!KOBO, as well as MINIMAL builds).
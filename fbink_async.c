@@ -0,0 +1,262 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_async.h"
+
+// Asynchronous refreshes: every update we send gets a marker of its own, which the caller can then wait on,
+// either right away (c.f., fbink_wait_for_complete), or from its event loop, via an eventfd that a tracking thread
+// pokes every time one of our updates has completed (c.f., fbink_open_completion_fd).
+
+// Returns the marker of the update we're about to send
+// NOTE: Both the caller's thread & the coalescing thread send updates (c.f., fbink_coalesce.c), hence the atomics.
+static uint32_t
+    next_marker(void)
+{
+	uint32_t marker = __atomic_load_n(&lastMarker, __ATOMIC_RELAXED);
+	uint32_t next;
+	do {
+		// NOTE: Start from our pid, like we used to,
+		//       so that concurrent FBInk processes don't step on each other's toes.
+		next = (marker == 0U) ? (uint32_t) getpid() : marker;
+		next++;
+		// NOTE: Make sure update_marker is valid, an invalid marker *may* hang the kernel
+		//       instead of failing gracefully, depending on the device/FW...
+		if (next == 0U) {
+			next = 1U;
+		}
+	} while (
+	    !__atomic_compare_exchange_n(&lastMarker, &marker, next, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	return next;
+}
+
+// Hand an update we just sent over to the tracking thread, if there's one
+static void
+    track_marker(uint32_t marker)
+{
+	if (!isTracking) {
+		return;
+	}
+
+	pthread_mutex_lock(&trackMutex);
+	if (trackCount == TRACK_MAX_PENDING) {
+		// NOTE: Out of room, so, the latest pending update stands for this one, too.
+		//       Since updates are processed in order, by the time this one completes, it's a safe bet that it has, too.
+		trackPending[(trackHead + trackCount - 1U) % TRACK_MAX_PENDING] = marker;
+		LOG("Too many pending updates, tracking %u in place of an earlier one", marker);
+	} else {
+		trackPending[(trackHead + trackCount) % TRACK_MAX_PENDING] = marker;
+		trackCount++;
+	}
+	pthread_cond_signal(&trackCond);
+	pthread_mutex_unlock(&trackMutex);
+}
+
+// The tracking thread: waits on pending updates, in order, and pokes completionFd as each of them completes
+static void*
+    track_updates(void* arg __attribute__((unused)))
+{
+	pthread_mutex_lock(&trackMutex);
+	for (;;) {
+		while (trackCount == 0U && isTracking) {
+			pthread_cond_wait(&trackCond, &trackMutex);
+		}
+		if (!isTracking) {
+			break;
+		}
+		const uint32_t marker = trackPending[trackHead];
+		trackHead             = (uint8_t) ((trackHead + 1U) % TRACK_MAX_PENDING);
+		trackCount--;
+		trackBusy             = true;
+		pthread_mutex_unlock(&trackMutex);
+
+		// NOTE: This blocks, which is the whole point of doing it here ;).
+		//       Even if that fails, we still move on, so as not to leave the caller hanging.
+		wait_for_update(trackFbfd, marker);
+
+		pthread_mutex_lock(&trackMutex);
+		trackBusy       = false;
+		completedMarker = marker;
+		pthread_cond_broadcast(&trackDoneCond);
+		const uint64_t done = 1U;
+		if (write(completionFd, &done, sizeof(done)) == -1) {
+			// NOTE: That only happens if nobody ever reads it, and the counter overflows, which is harmless.
+			LOG("Failed to signal the completion of update %u", marker);
+		}
+	}
+	pthread_mutex_unlock(&trackMutex);
+
+	return NULL;
+}
+
+// Block until an update we're tracking has completed, without waiting on it ourselves:
+// the driver only wakes one of its waiters, so, only one of us may ever wait on a given marker.
+// Returns false if the tracking thread isn't taking care of it, in which case it's up to the caller to wait on it.
+static bool
+    wait_for_tracked(uint32_t marker)
+{
+	pthread_mutex_lock(&trackMutex);
+	// NOTE: Markers only ever go up, and the tracking thread processes them in order,
+	//       so, serial number arithmetic tells us where we stand, wraparound or not.
+	const uint32_t last    = __atomic_load_n(&lastMarker, __ATOMIC_RELAXED);
+	const bool     tracked = (int32_t) (marker - trackFirstMarker) >= 0 && (int32_t) (last - marker) >= 0;
+	bool           done    = completedMarker != 0U && (int32_t) (completedMarker - marker) >= 0;
+	// NOTE: If tracking is stopped in the meantime, what was still pending is dropped, but not what's in flight.
+	while (tracked && !done && (isTracking || trackBusy)) {
+		pthread_cond_wait(&trackDoneCond, &trackMutex);
+		done = completedMarker != 0U && (int32_t) (completedMarker - marker) >= 0;
+	}
+	pthread_mutex_unlock(&trackMutex);
+
+	return tracked && done;
+}
+
+// Returns the marker of the latest update we sent
+uint32_t
+    fbink_get_last_marker(void)
+{
+	return __atomic_load_n(&lastMarker, __ATOMIC_RELAXED);
+}
+
+// Block until the update tagged with marker has completed
+int
+    fbink_wait_for_complete(int fbfd, uint32_t marker)
+{
+	// If we open a fd now, we'll only keep it open for this single call!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// If we've been holding on to some refreshes, there's no point in waiting any longer (c.f., fbink_coalesce.c)
+	flush_coalescer(fbfd);
+
+	if (marker == LAST_MARKER) {
+		marker = __atomic_load_n(&lastMarker, __ATOMIC_RELAXED);
+	}
+	if (marker == 0U) {
+		fprintf(stderr, "[FBInk] No update to wait for!\n");
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+
+	// NOTE: If the tracking thread is already waiting on it, we can't, so, wait for it instead.
+	if (!wait_for_tracked(marker)) {
+		rv = wait_for_update(fbfd, marker);
+	}
+
+	// Cleanup
+cleanup:
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
+
+// Start tracking the completion of every update we send, returns an eventfd that becomes readable when they complete
+int
+    fbink_open_completion_fd(void)
+{
+	if (isTracking) {
+		return completionFd;
+	}
+
+	completionFd = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (completionFd == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] eventfd: %s\n", errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// NOTE: The tracking thread gets an fd of its own, so that it doesn't depend on the caller's.
+	trackFbfd = open("/dev/fb0", O_RDWR | O_CLOEXEC);
+	if (trackFbfd == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] open: %s\n", errstr);
+		close(completionFd);
+		completionFd = -1;
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	pthread_mutex_lock(&trackMutex);
+	trackHead        = 0U;
+	trackCount       = 0U;
+	trackBusy        = false;
+	trackFirstMarker = __atomic_load_n(&lastMarker, __ATOMIC_RELAXED) + 1U;
+	completedMarker  = 0U;
+	isTracking       = true;
+	pthread_mutex_unlock(&trackMutex);
+	int rv = pthread_create(&trackThread, NULL, &track_updates, NULL);
+	if (rv != 0) {
+		char  buf[256];
+		char* errstr = strerror_r(rv, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] pthread_create: %s\n", errstr);
+		isTracking = false;
+		close(trackFbfd);
+		trackFbfd = -1;
+		close(completionFd);
+		completionFd = -1;
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	return completionFd;
+}
+
+// Returns the marker of the latest tracked update that has completed
+uint32_t
+    fbink_get_completed_marker(void)
+{
+	pthread_mutex_lock(&trackMutex);
+	const uint32_t marker = completedMarker;
+	pthread_mutex_unlock(&trackMutex);
+
+	return marker;
+}
+
+// Stop tracking completions, and close the eventfd
+int
+    fbink_close_completion_fd(void)
+{
+	if (!isTracking) {
+		fprintf(stderr, "[FBInk] We're not tracking update completions!\n");
+		return ERRCODE(EINVAL);
+	}
+
+	// NOTE: If the thread is currently waiting on an update, this blocks until it's done (or has timed out).
+	pthread_mutex_lock(&trackMutex);
+	isTracking = false;
+	trackCount = 0U;
+	pthread_cond_signal(&trackCond);
+	pthread_cond_broadcast(&trackDoneCond);
+	pthread_mutex_unlock(&trackMutex);
+	pthread_join(trackThread, NULL);
+
+	close(trackFbfd);
+	trackFbfd = -1;
+	close(completionFd);
+	completionFd = -1;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_ASYNC_H
+#define __FBINK_ASYNC_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// How many updates we keep track of while they're pending,
+// past that, the latest one stands for the ones that didn't fit (c.f., track_marker).
+#define TRACK_MAX_PENDING 64U
+
+// Whether we block until flashing updates have completed (c.f., FBInkConfig's no_refresh_wait)
+bool noRefreshWait = false;
+// The marker of the latest update we sent (0 means we haven't sent any yet, c.f., next_marker)
+// NOTE: Only ever accessed atomically, as the coalescing thread sends updates, too.
+uint32_t lastMarker = 0U;
+
+// Completion tracking (c.f., fbink_open_completion_fd)
+// NOTE: Everything but isTracking & the fds is only ever touched with trackMutex held.
+bool            isTracking   = false;
+int             completionFd = -1;
+int             trackFbfd    = -1;
+pthread_t       trackThread;
+pthread_mutex_t trackMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t  trackCond     = PTHREAD_COND_INITIALIZER;
+pthread_cond_t  trackDoneCond = PTHREAD_COND_INITIALIZER;
+uint32_t        trackPending[TRACK_MAX_PENDING];
+uint8_t         trackHead        = 0U;
+uint8_t         trackCount       = 0U;
+bool            trackBusy        = false;
+uint32_t        trackFirstMarker = 0U;
+uint32_t        completedMarker  = 0U;
+
+static uint32_t next_marker(void);
+static void     track_marker(uint32_t);
+static void*    track_updates(void*);
+static bool     wait_for_tracked(uint32_t);
+
+#endif
@@ -0,0 +1,259 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_batch.h"
+
+// Draw batching: between fbink_begin & fbink_commit, our drawing functions only draw,
+// and remember what they would have refreshed (c.f., commit_region).
+// fbink_commit then refreshes those regions in one go, after having merged the ones that overlap or touch,
+// as well as those where that doesn't mean refreshing more pixels than necessary.
+
+static uint32_t
+    region_area(const struct mxcfb_rect* region)
+{
+	return region->width * region->height;
+}
+
+// Whether two regions overlap, or at least touch
+static bool
+    regions_touch(const struct mxcfb_rect* a, const struct mxcfb_rect* b)
+{
+	return a->left <= b->left + b->width && b->left <= a->left + a->width && a->top <= b->top + b->height &&
+	       b->top <= a->top + a->height;
+}
+
+// Grow region to also cover other
+static void
+    union_region(struct mxcfb_rect* region, const struct mxcfb_rect* other)
+{
+	const uint32_t left   = MIN(region->left, other->left);
+	const uint32_t top    = MIN(region->top, other->top);
+	const uint32_t right  = MAX(region->left + region->width, other->left + other->width);
+	const uint32_t bottom = MAX(region->top + region->height, other->top + other->height);
+
+	region->top    = top;
+	region->left   = left;
+	region->width  = right - left;
+	region->height = bottom - top;
+}
+
+// How much a waveform mode can render properly, from DU (B/W only), to GL16/REAGL (grays), to GC16 (everything)
+// Returns 0 for anything else (c.f., pick_waveform_mode, which only ever lands on one of those).
+static uint8_t
+    waveform_mode_rank(uint32_t waveform_mode)
+{
+	if (waveform_mode == WAVEFORM_MODE_GC16) {
+		return 3U;
+	}
+	if (waveform_mode == WAVEFORM_MODE_DU) {
+		return 1U;
+	}
+#ifdef FBINK_FOR_KINDLE
+	// NOTE: The Oasis 2 has a numbering of its own for everything else.
+	if (deviceQuirks.isKindleOasis2) {
+		return (waveform_mode == WAVEFORM_MODE_KOA2_GL16 || waveform_mode == WAVEFORM_MODE_KOA2_REAGL) ? 2U : 0U;
+	}
+#endif
+	return (waveform_mode == WAVEFORM_MODE_GL16 || waveform_mode == WAVEFORM_MODE_REAGL) ? 2U : 0U;
+}
+
+// Pick a waveform mode that suits both requests, i.e., the stronger of the two
+static uint32_t
+    merge_waveform_mode(uint32_t a, uint32_t b)
+{
+	if (a == b) {
+		return a;
+	}
+
+	const uint8_t rank_a = waveform_mode_rank(a);
+	const uint8_t rank_b = waveform_mode_rank(b);
+	// NOTE: When in doubt (i.e., a mode we were explicitly asked for, that we can't rank),
+	//       GC16 is the one mode that'll always render everything properly ;).
+	if (rank_a == 0U || rank_b == 0U) {
+		return WAVEFORM_MODE_GC16;
+	}
+	return (rank_b > rank_a) ? b : a;
+}
+
+// Remember that we'll have to refresh region later on, merging it with the count refreshes we already put off in regions
+// (which holds up to BATCH_MAX_REGIONS of them). Used for both batching & coalescing (c.f., fbink_coalesce.c).
+static void
+    batch_region(FBInkBatchRegion*        regions,
+		 uint8_t*                 count,
+		 const struct mxcfb_rect* region,
+		 uint32_t                 waveform_mode,
+		 bool                     is_flashing)
+{
+	FBInkBatchRegion pending = { .region = *region, .waveform_mode = waveform_mode, .is_flashing = is_flashing };
+
+	// Merge with whatever we already have if they overlap or touch (e.g., labels on consecutive rows),
+	// or if it doesn't cost us anything (i.e., the bounding box of both isn't larger than both of them put together),
+	// and keep going, as the result may now be mergeable with another one.
+	bool merged;
+	do {
+		merged = false;
+		for (uint8_t i = 0U; i < *count; i++) {
+			struct mxcfb_rect u = pending.region;
+			union_region(&u, &regions[i].region);
+			if (regions_touch(&pending.region, &regions[i].region) ||
+			    region_area(&u) <= region_area(&pending.region) + region_area(&regions[i].region)) {
+				pending.region = u;
+				pending.waveform_mode =
+				    merge_waveform_mode(pending.waveform_mode, regions[i].waveform_mode);
+				pending.is_flashing |= regions[i].is_flashing;
+				// Drop the old one, we'll store the merged one at the end
+				regions[i] = regions[--(*count)];
+				merged     = true;
+				break;
+			}
+		}
+	} while (merged);
+
+	// If we're out of room, merge with the one that grows the least
+	if (*count == BATCH_MAX_REGIONS) {
+		uint8_t  best      = 0U;
+		uint32_t best_cost = UINT32_MAX;
+		for (uint8_t i = 0U; i < *count; i++) {
+			struct mxcfb_rect u = pending.region;
+			union_region(&u, &regions[i].region);
+			const uint32_t cost = region_area(&u) - region_area(&regions[i].region);
+			if (cost < best_cost) {
+				best      = i;
+				best_cost = cost;
+			}
+		}
+		union_region(&regions[best].region, &pending.region);
+		regions[best].waveform_mode = merge_waveform_mode(regions[best].waveform_mode, pending.waveform_mode);
+		regions[best].is_flashing |= pending.is_flashing;
+		return;
+	}
+
+	regions[(*count)++] = pending;
+}
+
+// Called once we're done drawing to region (in fb coordinates, c.f., rotate_region):
+// pick the waveform mode that suits what we drew (c.f., pick_waveform_mode), and update waveform_mode accordingly,
+// then remember it for later if we're batching,
+// otherwise, push what we drew to the fb (c.f., damage_rect), and, if we can (c.f., use_diff),
+// shrink region to what actually changed on screen.
+// Returns false if there's nothing left to refresh right now.
+static bool
+    commit_region(struct mxcfb_rect* region, uint32_t* waveform_mode, bool is_flashing)
+{
+	*waveform_mode = pick_waveform_mode(region, *waveform_mode, is_flashing);
+
+	if (isBatching) {
+		batch_region(batchRegions, &batchCount, region, *waveform_mode, is_flashing);
+		LOG("Batching a refresh of region (%u, %u) %ux%u (%hhu pending)",
+		    region->left,
+		    region->top,
+		    region->width,
+		    region->height,
+		    batchCount);
+		return false;
+	}
+
+	struct mxcfb_rect changed = { 0U };
+	if (!flush_shadow(&changed)) {
+		return true;
+	}
+
+	// NOTE: Flashing refreshes are usually meant to get rid of ghosting, which won't show up in a diff,
+	//       so leave those alone.
+	if (is_flashing) {
+		return true;
+	}
+
+	return shrink_region(region, &changed);
+}
+
+// Start batching refreshes
+int
+    fbink_begin(void)
+{
+	if (isBatching) {
+		fprintf(stderr, "[FBInk] We're already batching refreshes!\n");
+		return ERRCODE(EBUSY);
+	}
+
+	isBatching = true;
+	batchCount = 0U;
+
+	return EXIT_SUCCESS;
+}
+
+// Refresh everything we've drawn since fbink_begin
+int
+    fbink_commit(int fbfd)
+{
+	if (!isBatching) {
+		fprintf(stderr, "[FBInk] There's no batch to commit!\n");
+		return ERRCODE(EINVAL);
+	}
+	// Whatever happens next, the batch is over
+	isBatching = false;
+
+	// If we open a fd now, we'll only keep it open for this single call!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// We may need to flush our shadow buffer
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Push everything to the fb at once, and see what actually changed while we're there (c.f., use_diff)
+	struct mxcfb_rect changed = { 0U };
+	const bool        diffed  = flush_shadow(&changed);
+
+	LOG("Committing %hhu batched refreshes", batchCount);
+	for (uint8_t i = 0U; i < batchCount; i++) {
+		struct mxcfb_rect region = batchRegions[i].region;
+		// NOTE: Same as in commit_region, leave flashing refreshes alone.
+		if (diffed && !batchRegions[i].is_flashing && !shrink_region(&region, &changed)) {
+			continue;
+		}
+
+		if (refresh(fbfd, region, batchRegions[i].waveform_mode, batchRegions[i].is_flashing) != EXIT_SUCCESS) {
+			fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
+			rv = ERRCODE(EXIT_FAILURE);
+		}
+	}
+
+	// Cleanup
+cleanup:
+	batchCount = 0U;
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
@@ -0,0 +1,47 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_BATCH_H
+#define __FBINK_BATCH_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// How many distinct refreshes we'll keep track of between fbink_begin & fbink_commit,
+// past that, we merge the closest ones.
+#define BATCH_MAX_REGIONS 16U
+
+// Whether we're between fbink_begin & fbink_commit
+bool isBatching = false;
+// The refreshes we've put off until then (c.f., batch_region)
+FBInkBatchRegion batchRegions[BATCH_MAX_REGIONS];
+uint8_t          batchCount = 0U;
+
+static uint32_t region_area(const struct mxcfb_rect*);
+static bool     regions_touch(const struct mxcfb_rect*, const struct mxcfb_rect*);
+static void     union_region(struct mxcfb_rect*, const struct mxcfb_rect*);
+static uint8_t  waveform_mode_rank(uint32_t);
+static uint32_t merge_waveform_mode(uint32_t, uint32_t);
+static void     batch_region(FBInkBatchRegion*, uint8_t*, const struct mxcfb_rect*, uint32_t, bool);
+static bool     commit_region(struct mxcfb_rect*, uint32_t*, bool);
+
+#endif
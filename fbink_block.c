@@ -20,13 +20,10 @@
 
 #include "fbink_block.h"
 
-static const uint32_t*
-    block_get_bitmap(uint32_t codepoint)
+#ifdef FBINK_WITH_FONT_BLOCK
+static bool
+    block_get_glyph(uint32_t codepoint, uint32_t* rows)
 {
-	if (codepoint >= 0x20 && codepoint <= 0x7e) {
-		return block_block1[codepoint - 0x20];
-	} else {
-		fprintf(stderr, "[FBInk] Codepoint U+%04X is not covered by this font!\n", codepoint);
-		return block_block1[0];
-	}
+	return font_get_glyph(&block_font, codepoint, rows);
 }
+#endif
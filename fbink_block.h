@@ -25,9 +25,14 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/block.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/block.h"
+#else
+#	include "fonts/block.h"
+#endif
 
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const uint32_t* block_get_bitmap(uint32_t) __attribute__((const));
+#ifdef FBINK_WITH_FONT_BLOCK
+static bool block_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
@@ -104,6 +104,14 @@ cleanup:
 	return rb;
 }
 
+// Whether the pixel in the fb's pixel format @ px is the color packed in ref (c.f., pack_pixel)
+// NOTE: We ignore alpha, we always assume it's opaque, like get_pixel_RGB32 (hence the 3 bytes at most).
+static bool
+    is_pixel_match(const unsigned char* px, const unsigned char* ref)
+{
+	return memcmp(px, ref, MIN(viewRotation.pixel_size, 3U)) == 0;
+}
+
 static bool
     wait_for_background_color(uint8_t v, unsigned short int timeout, unsigned short int granularity)
 {
@@ -112,9 +120,19 @@ static bool
 	// Something on the bottom margin should do the trick,
 	// without falling into any "might be behind the bezel" quirk,
 	// which would cause it to potentially already be black (or transparent) in Nickel...
-	FBInkCoordinates coords = { (unsigned short int) (viewWidth / 2U), (unsigned short int) (viewHeight - 1) };
-	(*fxpRotateCoords)(&coords);
-	FBInkColor color = { 0U };
+	const unsigned short int x = (unsigned short int) (viewWidth / 2U);
+	const unsigned short int y = (unsigned short int) (viewHeight - 1);
+	// Pack the color we're looking for in the fb's pixel format once, so we can just compare bytes
+	// with what we read (c.f., grab_rotated).
+	const FBInkColor         color  = { v, v, v };
+	const uint32_t           packed = pack_pixel((uint8_t) vInfo.bits_per_pixel, &color);
+	unsigned char            ref[sizeof(packed)];
+	memcpy(ref, &packed, sizeof(ref));
+	unsigned char px[sizeof(packed)] = { 0U };
+	// NOTE: The blitter needs whole bytes per pixel (c.f., set_view_rotation), which Kobos always have.
+	if (viewRotation.pixel_size == 0U) {
+		return false;
+	}
 
 	// We loop for <timeout> seconds at most, waking up every <granularity> ms...
 	unsigned short int iterations;
@@ -129,18 +147,19 @@ static bool
 		// Wait <granularity> ms . . .
 		nanosleep(&zzz, NULL);
 
-		(*fxpGetPixel)(&coords, &color);
-		LOG("On iteration nr. %hhu of %hu, pixel (%hu, %hu) was #%02hhX%02hhX%02hhX",
+		grab_rotated(px, 0U, x, y, 1U, 1U);
+		LOG("On iteration nr. %hhu of %hu, pixel (%hu, %hu) was %02hhX %02hhX %02hhX %02hhX (in the fb's format)",
 		    i,
 		    iterations,
-		    coords.x,
-		    coords.y,
-		    color.r,
-		    color.g,
-		    color.b);
+		    x,
+		    y,
+		    px[0],
+		    px[1],
+		    px[2],
+		    px[3]);
 
 		// Got it!
-		if (color.r == v && color.g == v && color.b == v) {
+		if (is_pixel_match(px, ref)) {
 			return true;
 		}
 	}
@@ -313,6 +332,8 @@ int
 
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
+	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
+	unsigned char* pixels = NULL;
 
 	// mmap the fb if need be...
 	if (!isFbMapped) {
@@ -321,6 +342,16 @@ int
 			goto cleanup;
 		}
 	}
+	// We're looking at what *Nickel* drew, so we need to read from the actual fb (c.f., use_shadow)
+	bypass_shadow();
+
+	// NOTE: We read pixels through the blitter, which needs whole bytes per pixel (c.f., set_view_rotation).
+	//       Not an issue in practice, Kobos never run at 4bpp.
+	if (viewRotation.pixel_size == 0U) {
+		fprintf(stderr, "[FBInk] Can't scan for buttons on a %ubpp fb!\n", vInfo.bits_per_pixel);
+		rv = ERRCODE(ENOSYS);
+		goto cleanup;
+	}
 
 	// Wheee! (Default to the proper value on 32bpp FW)
 	FBInkColor button_color = { 0xD9, 0xD9, 0xD9 };
@@ -335,8 +366,6 @@ int
 		button_color.b = 0xDE;
 	}
 
-	FBInkColor         color         = { 0U };
-	FBInkCoordinates   coords        = { 0U };
 	unsigned short int button_width  = 0U;
 	unsigned short int match_count   = 0U;
 	FBInkCoordinates   match_coords  = { 0U };
@@ -362,6 +391,22 @@ int
 	unsigned short int min_width  = (unsigned short int) ((0.05f * (float) viewWidth) + 0.5f);
 	unsigned short int max_width  = (unsigned short int) ((0.80f * (float) viewWidth) + 0.5f);
 
+	// NOTE: We read whole rows (or columns) of pixels at once (c.f., grab_rotated),
+	//       and compare them in the fb's pixel format, so, pack the button's color once,
+	//       and make room for the longest span we'll ever read.
+	const uint32_t packed = pack_pixel((uint8_t) vInfo.bits_per_pixel, &button_color);
+	unsigned char  ref[sizeof(packed)];
+	memcpy(ref, &packed, sizeof(ref));
+	const size_t size = viewRotation.pixel_size;
+	pixels            = malloc((size_t) MAX(max_width - min_width, max_height - min_height) * size);
+	if (pixels == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] malloc (pixels): %s\n", errstr);
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
 	LOG("Looking for buttons in a %hux%hu rectangle, from (%hu, %hu) to (%hu, %hu)",
 	    (unsigned short int) (max_width - min_width),
 	    (unsigned short int) (max_height - min_height),
@@ -381,15 +426,10 @@ int
 		button_width = 0U;
 		match_count  = 0U;
 
+		// Handles 16bpp rotation (hopefully applies in Nickel, too ;D)
+		grab_rotated(pixels, 0U, min_width, y, (unsigned short int) (max_width - min_width), 1U);
 		for (unsigned short int x = min_width; x < max_width; x++) {
-			coords.x = x;
-			coords.y = y;
-
-			// Handle 16bpp rotation (hopefully applies in Nickel, too ;D)
-			(*fxpRotateCoords)(&coords);
-			(*fxpGetPixel)(&coords, &color);
-
-			if (color.r == button_color.r && color.g == button_color.g && color.b == button_color.b) {
+			if (is_pixel_match(pixels + ((x - min_width) * size), ref)) {
 				// Found a pixel of the right color for a button...
 				button_width++;
 			} else {
@@ -429,15 +469,14 @@ int
 	if (gotcha) {
 		gotcha = false;
 		// We're just going too scan down that final column of the button until we hit the end of it :).
+		grab_rotated(pixels,
+			     size,
+			     match_coords.x,
+			     match_coords.y,
+			     1U,
+			     (unsigned short int) (max_height - match_coords.y));
 		for (unsigned short int j = match_coords.y; j < max_height; j++) {
-			// NOTE: Keep those two together to avoid desyncing them if we have a rotation quirk...
-			coords.x = match_coords.x;
-			coords.y = j;
-
-			(*fxpRotateCoords)(&coords);
-			(*fxpGetPixel)(&coords, &color);
-
-			if (color.r == button_color.r && color.g == button_color.g && color.b == button_color.b) {
+			if (is_pixel_match(pixels + ((j - match_coords.y) * size), ref)) {
 				// Found a pixel of the right color for a button...
 				button_height++;
 			} else {
@@ -486,6 +525,8 @@ int
 
 	// Cleanup
 cleanup:
+	free(pixels);
+	restore_shadow();
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -514,6 +555,8 @@ int
 
 	// Assume success, until shit happens ;)
 	int rv = EXIT_SUCCESS;
+	// We need to declare this early (& sentinel it to NULL) to make our cleanup jumps safe
+	unsigned char* pixels = NULL;
 
 	// mmap the fb if need be...
 	if (!isFbMapped) {
@@ -522,6 +565,8 @@ int
 			goto cleanup;
 		}
 	}
+	// We're looking at what *Nickel* drew, so we need to read from the actual fb (c.f., use_shadow)
+	bypass_shadow();
 
 	// Double-check that we're really on something that looks like the Connected screen,
 	// in case someone slipped on the wrong CLI flag or the wrong function ;).
@@ -603,6 +648,8 @@ int
 
 	// Cleanup
 cleanup:
+	free(pixels);
+	restore_shadow();
 	if (isFbMapped && !keep_fd) {
 		unmap_fb();
 	}
@@ -48,6 +48,7 @@
 
 static bool is_onboard_state(bool);
 static bool wait_for_onboard_state(bool);
+static bool is_pixel_match(const unsigned char*, const unsigned char*);
 static bool wait_for_background_color(uint8_t, unsigned short int, unsigned short int);
 static bool is_on_connected_screen(void);
 static bool is_on_home_screen(void);
@@ -62,6 +62,8 @@ static void
 	    "\t-p, --padded\t\tLeft pad STRING with blank spaces.\n"
 	    "\t\t\t\tMost useful when combined with --centered to ensure a line will be completely filled, while still centering STRING,\n"
 	    "\t\t\t\ti.e., padding it on both sides.\n"
+	    "\t-w, --wrap\t\tWhen STRING doesn't fit on a single line, break it between words instead of mid-word.\n"
+	    "\t\t\t\tLines are broken on blanks, after hyphens, and around CJK characters. Words longer than a line are still cut.\n"
 	    "\n"
 	    "Options affecting the message's appearance:\n"
 	    "\t-h, --invert\t\tPrint STRING in <background color> over <foreground color> instead of the reverse.\n"
@@ -78,6 +80,11 @@ static void
 #ifdef FBINK_WITH_FONTS
 	    "\t\t\t\tAvailable font families: IBM, UNSCII, ALT, THIN, FANTASY, MCR, TALL, BLOCK,\n"
 	    "\t\t\t\t\t\tLEGGIE, VEGGIE, KATES, FKP, CTRLD, ORP, ORPB, ORPI, SCIENTIFICA, SCIENTIFICAB, SCIENTIFICAI\n"
+	    "\t\t\t\tNAME can also be the path to a font file (i.e., if it contains a /), as built by tools/mkfont.py\n"
+	    "\t\t\t\t\t\tout of a PSF, BDF or Unifont hex font (e.g., -F ./unifont.fbf).\n"
+	    "\t\t\t\tNAME can be followed by up to 3 comma-separated fallback fonts, for the characters it doesn't cover,\n"
+	    "\t\t\t\t\t\tin which case IBM is always the last resort (e.g., -F LEGGIE,UNSCII).\n"
+	    "\t\t\t\t\t\tFallback fonts can't be larger than NAME.\n"
 #else
 	    "\t\t\t\tAvailable font families: IBM\n"
 #endif
@@ -97,6 +104,9 @@ static void
 	    "\n"
 	    "Options affecting the program's behavior:\n"
 	    "\t-I, --interactive\tEnter a very basic interactive mode.\n"
+	    "\t-T, --console\t\tPrint STRING (or whatever is read from stdin) through a tiny terminal emulator, which scrolls once it reaches the bottom of the screen.\n"
+	    "\t\t\t\tIt honors a subset of VT100/ANSI escape sequences (cursor moves, erase, as well as inverse video & colors, as gray levels).\n"
+	    "\t\t\t\tIgnores -x, --col; -y, --row; -X, --hoffset; -Y, --voffset; -m, --centered; -p, --padded; -o, --overlay & -O, --bgless\n"
 	    "\t-L, --linecountcode\tWhen successfully printing text, returns the total amount of printed lines as the process exit code.\n"
 	    "\t-l, --linecount\t\tWhen successfully printing text, outputs the total amount of printed lines in the final line of output to stdout (NOTE: enforces quiet & non-verbose!).\n"
 	    "\t-P, --progressbar NUM\tDraw a NUM%% full progress bar (full-width). Like other alternative modes, does *NOT* have precedence over text printing.\n"
@@ -105,6 +115,9 @@ static void
 	    "\t\t\t\tNOTE: If NUM is negative, will cycle between each possible value every 750ms, until the death of the sun! Be careful not to be caught in an involuntary infinite loop!\n"
 	    "\t\t\t\tIgnores -x, --col; -X, --hoffset; as well as -m, --centered & -p, --padded\n"
 	    "\t-V, --noviewport\tIgnore any & all viewport corrections, be it from Kobo devices with rows of pixels hidden by a bezel, or a dynamic offset applied to rows when vertical fit isn't perfect.\n"
+	    "\t-W, --coalesce MS\tHold refreshes for MS milliseconds (5 to 20 is usually plenty), and merge those that follow in the meantime,\n"
+	    "\t\t\t\tso that the eInk controller gets fewer, larger refreshes (e.g., when passing multiple STRINGs).\n"
+	    "\t-D, --noautowfm\tDon't pick waveform modes based on what was drawn (by default, pure black & white content is refreshed in DU, which is much faster).\n"
 	    "\n"
 	    "NOTES:\n"
 	    "\tYou can specify multiple STRINGs in a single invocation of fbink, each consecutive one will be printed on the subsequent line.\n"
@@ -164,6 +177,23 @@ static void
 	    "\t\tAnd to make pixel-perfect adjustments, you can also specifiy negative values for x & y.\n"
 	    "\tSpecifying one or more STRING takes precedence over this mode.\n"
 	    "\t--refresh also takes precedence over this mode.\n"
+#endif
+#ifdef FBINK_WITH_OPENTYPE
+	    "\n\n"
+	    "You can also print STRING with a TrueType/OpenType font, at any size, with antialiasing:\n"
+	    "\t-t, --truetype file=PATH,size=NUM,top=NUM,bottom=NUM,left=NUM,right=NUM\n"
+	    "\t\tsize is the line height, in pixels (Default: the height of the builtin font's glyphs),\n"
+	    "\t\ttop, bottom, left & right are the margins of the area STRING will be laid out in, in pixels (Default: 0).\n"
+	    "\n"
+	    "EXAMPLES:\n"
+	    "\tfbink -t file=serif.ttf,size=32,top=100,left=20,right=20 -m \"Hello World!\"\n"
+	    "\t\tPrints 'Hello World!' in serif.ttf, 32px high, centered, 100px from the top of the screen.\n"
+	    "\n"
+	    "NOTES:\n"
+	    "\tLines are broken between words, and on linefeeds.\n"
+	    "\tThis honors --flash, --clear, --invert, --centered, --padded, --overlay & --bgless\n"
+	    "\t\tas well as --color & --background, but *not* --col, --row, --hoffset, --voffset, --size & --font.\n"
+	    "\tConsecutive STRINGs are printed below one another.\n"
 #endif
 	    "\n"
 	    "NOTES:\n"
@@ -205,6 +235,61 @@ static int
 	return rv;
 }
 
+// Parse a font name (or the path to a font file), returns its FONT_INDEX_T, or a negative value on failure
+static int
+    parse_fontname(const char* name)
+{
+	if (strcasecmp(name, "IBM") == 0) {
+		return IBM;
+	} else if (strcasecmp(name, "UNSCII") == 0) {
+		return UNSCII;
+	} else if (strcasecmp(name, "ALT") == 0) {
+		return UNSCII_ALT;
+	} else if (strcasecmp(name, "THIN") == 0) {
+		return UNSCII_THIN;
+	} else if (strcasecmp(name, "FANTASY") == 0) {
+		return UNSCII_FANTASY;
+	} else if (strcasecmp(name, "MCR") == 0) {
+		return UNSCII_MCR;
+	} else if (strcasecmp(name, "TALL") == 0) {
+		return UNSCII_TALL;
+	} else if (strcasecmp(name, "BLOCK") == 0) {
+		return BLOCK;
+	} else if (strcasecmp(name, "LEGGIE") == 0) {
+		return LEGGIE;
+	} else if (strcasecmp(name, "VEGGIE") == 0) {
+		return VEGGIE;
+	} else if (strcasecmp(name, "KATES") == 0) {
+		return KATES;
+	} else if (strcasecmp(name, "FKP") == 0) {
+		return FKP;
+	} else if (strcasecmp(name, "CTRLD") == 0) {
+		return CTRLD;
+	} else if (strcasecmp(name, "ORP") == 0) {
+		return ORP;
+	} else if (strcasecmp(name, "ORPB") == 0) {
+		return ORPB;
+	} else if (strcasecmp(name, "ORPI") == 0) {
+		return ORPI;
+	} else if (strcasecmp(name, "SCIENTIFICA") == 0) {
+		return SCIENTIFICA;
+	} else if (strcasecmp(name, "SCIENTIFICAB") == 0) {
+		return SCIENTIFICAB;
+	} else if (strcasecmp(name, "SCIENTIFICAI") == 0) {
+		return SCIENTIFICAI;
+	} else if (strchr(name, '/')) {
+		// A path to a font file (c.f., tools/mkfont.py)
+		int font = fbink_register_font(name);
+		if (font < 0) {
+			fprintf(stderr, "Failed to load font file '%s'.\n", name);
+		}
+		return font;
+	}
+
+	fprintf(stderr, "Unknown font name '%s'.\n", name);
+	return ERRCODE(EINVAL);
+}
+
 // Application entry point
 int
     main(int argc, char* argv[])
@@ -221,6 +306,7 @@ int
 					      { "centered", no_argument, NULL, 'm' },
 					      { "halfway", no_argument, NULL, 'M' },
 					      { "padded", no_argument, NULL, 'p' },
+					      { "wrap", no_argument, NULL, 'w' },
 					      { "refresh", required_argument, NULL, 's' },
 					      { "size", required_argument, NULL, 'S' },
 					      { "font", required_argument, NULL, 'F' },
@@ -231,6 +317,7 @@ int
 					      { "flatten", no_argument, NULL, 'a' },
 					      { "eval", no_argument, NULL, 'e' },
 					      { "interactive", no_argument, NULL, 'I' },
+					      { "console", no_argument, NULL, 'T' },
 					      { "color", required_argument, NULL, 'C' },
 					      { "background", required_argument, NULL, 'B' },
 					      { "linecountcode", no_argument, NULL, 'L' },
@@ -240,9 +327,13 @@ int
 					      { "noviewport", no_argument, NULL, 'V' },
 					      { "overlay", no_argument, NULL, 'o' },
 					      { "bgless", no_argument, NULL, 'O' },
+					      { "truetype", required_argument, NULL, 't' },
+					      { "coalesce", required_argument, NULL, 'W' },
+					      { "noautowfm", no_argument, NULL, 'D' },
 					      { NULL, 0, NULL, 0 } };
 
-	FBInkConfig fbink_config = { 0 };
+	FBInkConfig   fbink_config = { 0 };
+	FBInkOTConfig ot_config    = { 0 };
 
 	enum
 	{
@@ -260,18 +351,32 @@ int
 		HALIGN_OPT,
 		VALIGN_OPT,
 	};
+	enum
+	{
+		OT_FILE_OPT = 0,
+		OT_SIZE_OPT,
+		OT_TOP_OPT,
+		OT_BOTTOM_OPT,
+		OT_LEFT_OPT,
+		OT_RIGHT_OPT,
+	};
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #pragma clang diagnostic ignored "-Wunknown-warning-option"
 #pragma GCC diagnostic ignored "-Wdiscarded-qualifiers"
 #pragma clang diagnostic ignored "-Wincompatible-pointer-types-discards-qualifiers"
-	char* const refresh_token[] = { [TOP_OPT] = "top",       [LEFT_OPT] = "left", [WIDTH_OPT] = "width",
-					[HEIGHT_OPT] = "height", [WFM_OPT] = "wfm",   NULL };
-	char* const image_token[]   = { [FILE_OPT] = "file",     [XOFF_OPT] = "x",        [YOFF_OPT] = "y",
-                                      [HALIGN_OPT] = "halign", [VALIGN_OPT] = "valign", NULL };
+	char* const refresh_token[]  = { [TOP_OPT] = "top",       [LEFT_OPT] = "left", [WIDTH_OPT] = "width",
+					 [HEIGHT_OPT] = "height", [WFM_OPT] = "wfm",   NULL };
+	char* const image_token[]    = { [FILE_OPT] = "file",     [XOFF_OPT] = "x",        [YOFF_OPT] = "y",
+                                       [HALIGN_OPT] = "halign", [VALIGN_OPT] = "valign", NULL };
+	char* const truetype_token[] = { [OT_FILE_OPT] = "file",     [OT_SIZE_OPT] = "size", [OT_TOP_OPT] = "top",
+					 [OT_BOTTOM_OPT] = "bottom", [OT_LEFT_OPT] = "left", [OT_RIGHT_OPT] = "right",
+					 NULL };
 #pragma GCC diagnostic pop
 	char*     subopts;
 	char*     value;
+	char*     saveptr;
+	uint8_t   font_count     = 0U;
 	uint32_t  region_top     = 0;
 	uint32_t  region_left    = 0;
 	uint32_t  region_width   = 0;
@@ -282,8 +387,11 @@ int
 	short int image_x_offset = 0;
 	short int image_y_offset = 0;
 	bool      is_image       = false;
+	char*     ot_file        = NULL;
+	bool      is_truetype    = false;
 	bool      is_eval        = false;
 	bool      is_interactive = false;
+	bool      is_console     = false;
 	bool      want_linecode  = false;
 	bool      want_linecount = false;
 	bool      is_progressbar = false;
@@ -292,7 +400,7 @@ int
 	uint8_t   progress       = 0;
 	int       errfnd         = 0;
 
-	while ((opt = getopt_long(argc, argv, "y:x:Y:X:hfcmMps:S:F:vqg:i:aeIC:B:LlP:A:oOV", opts, &opt_index)) != -1) {
+	while ((opt = getopt_long(argc, argv, "y:x:Y:X:hfcmMpws:S:F:vqg:i:aeITC:B:LlP:A:oOVt:W:D", opts, &opt_index)) != -1) {
 		switch (opt) {
 			case 'y':
 				fbink_config.row = (short int) atoi(optarg);
@@ -324,6 +432,9 @@ int
 			case 'p':
 				fbink_config.is_padded = true;
 				break;
+			case 'w':
+				fbink_config.is_wrapped = true;
+				break;
 			case 's':
 				subopts = optarg;
 				while (*subopts != '\0' && !errfnd) {
@@ -372,47 +483,25 @@ int
 				fbink_config.fontmult = (uint8_t) strtoul(optarg, NULL, 10);
 				break;
 			case 'F':
-				if (strcasecmp(optarg, "IBM") == 0) {
-					fbink_config.fontname = IBM;
-				} else if (strcasecmp(optarg, "UNSCII") == 0) {
-					fbink_config.fontname = UNSCII;
-				} else if (strcasecmp(optarg, "ALT") == 0) {
-					fbink_config.fontname = UNSCII_ALT;
-				} else if (strcasecmp(optarg, "THIN") == 0) {
-					fbink_config.fontname = UNSCII_THIN;
-				} else if (strcasecmp(optarg, "FANTASY") == 0) {
-					fbink_config.fontname = UNSCII_FANTASY;
-				} else if (strcasecmp(optarg, "MCR") == 0) {
-					fbink_config.fontname = UNSCII_MCR;
-				} else if (strcasecmp(optarg, "TALL") == 0) {
-					fbink_config.fontname = UNSCII_TALL;
-				} else if (strcasecmp(optarg, "BLOCK") == 0) {
-					fbink_config.fontname = BLOCK;
-				} else if (strcasecmp(optarg, "LEGGIE") == 0) {
-					fbink_config.fontname = LEGGIE;
-				} else if (strcasecmp(optarg, "VEGGIE") == 0) {
-					fbink_config.fontname = VEGGIE;
-				} else if (strcasecmp(optarg, "KATES") == 0) {
-					fbink_config.fontname = KATES;
-				} else if (strcasecmp(optarg, "FKP") == 0) {
-					fbink_config.fontname = FKP;
-				} else if (strcasecmp(optarg, "CTRLD") == 0) {
-					fbink_config.fontname = CTRLD;
-				} else if (strcasecmp(optarg, "ORP") == 0) {
-					fbink_config.fontname = ORP;
-				} else if (strcasecmp(optarg, "ORPB") == 0) {
-					fbink_config.fontname = ORPB;
-				} else if (strcasecmp(optarg, "ORPI") == 0) {
-					fbink_config.fontname = ORPI;
-				} else if (strcasecmp(optarg, "SCIENTIFICA") == 0) {
-					fbink_config.fontname = SCIENTIFICA;
-				} else if (strcasecmp(optarg, "SCIENTIFICAB") == 0) {
-					fbink_config.fontname = SCIENTIFICAB;
-				} else if (strcasecmp(optarg, "SCIENTIFICAI") == 0) {
-					fbink_config.fontname = SCIENTIFICAI;
-				} else {
-					fprintf(stderr, "Unknown font name '%s'.\n", optarg);
-					errfnd = 1;
+				// NOTE: Any extra comma-separated fonts are fallbacks, for the codepoints the first one doesn't cover
+				//       (e.g., -F LEGGIE,UNSCII).
+				memset(fbink_config.fallback_fonts, IBM, sizeof(fbink_config.fallback_fonts));
+				font_count = 0U;
+				for (char* name = strtok_r(optarg, ",", &saveptr); name != NULL && !errfnd;
+				     name = strtok_r(NULL, ",", &saveptr)) {
+					int font = parse_fontname(name);
+					if (font < 0) {
+						errfnd = 1;
+					} else if (font_count == 0U) {
+						fbink_config.fontname = (uint8_t) font;
+						font_count++;
+					} else if (font_count <= MAX_FALLBACK_FONTS) {
+						fbink_config.fallback_fonts[font_count - 1U] = (uint8_t) font;
+						font_count++;
+					} else {
+						fprintf(stderr, "Too many fallback fonts (max: %u).\n", MAX_FALLBACK_FONTS);
+						errfnd = 1;
+					}
 				}
 				break;
 			case 'v':
@@ -500,6 +589,9 @@ int
 			case 'I':
 				is_interactive = true;
 				break;
+			case 'T':
+				is_console = true;
+				break;
 			case 'C':
 				if (strcasecmp(optarg, "BLACK") == 0) {
 					fbink_config.fg_color = FG_BLACK;
@@ -604,6 +696,48 @@ int
 			case 'V':
 				fbink_config.no_viewport = true;
 				break;
+			case 'W':
+				fbink_config.coalesce_ms = (uint8_t) strtoul(optarg, NULL, 10);
+				break;
+			case 'D':
+				fbink_config.no_auto_waveform = true;
+				break;
+			case 't':
+				subopts = optarg;
+				while (*subopts != '\0' && !errfnd) {
+					switch (getsubopt(&subopts, truetype_token, &value)) {
+						case OT_FILE_OPT:
+							free(ot_file);
+							ot_file = value ? strdup(value) : NULL;
+							break;
+						case OT_SIZE_OPT:
+							ot_config.size_px = value ? strtof(value, NULL) : 0.0f;
+							break;
+						case OT_TOP_OPT:
+							ot_config.margins.top = value ? (short int) atoi(value) : 0;
+							break;
+						case OT_BOTTOM_OPT:
+							ot_config.margins.bottom = value ? (short int) atoi(value) : 0;
+							break;
+						case OT_LEFT_OPT:
+							ot_config.margins.left = value ? (short int) atoi(value) : 0;
+							break;
+						case OT_RIGHT_OPT:
+							ot_config.margins.right = value ? (short int) atoi(value) : 0;
+							break;
+						default:
+							fprintf(stderr, "No match found for token: /%s/\n", value);
+							errfnd = 1;
+							break;
+					}
+				}
+				if (ot_file == NULL) {
+					fprintf(stderr, "Must specify at least '%s'\n", truetype_token[OT_FILE_OPT]);
+					errfnd = 1;
+				} else {
+					is_truetype = true;
+				}
+				break;
 			default:
 				fprintf(stderr, "?? Unknown option code 0%o ??\n", (unsigned int) opt);
 				errfnd = 1;
@@ -643,7 +777,54 @@ int
 	}
 
 	char* string;
-	if (optind < argc) {
+	if (optind < argc && is_console) {
+		// NOTE: In console mode, STRINGs are fed as-is, it's up to them to include a linefeed if they want one.
+		while (optind < argc) {
+			string = argv[optind++];
+			if (fbink_console_write(fbfd, string, &fbink_config) != EXIT_SUCCESS) {
+				fprintf(stderr, "Failed to print that string!\n");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// NOTE: Only clear the screen once, the console takes care of what's on it from then on.
+			fbink_config.is_cleared = false;
+		}
+	} else if (optind < argc && is_truetype) {
+		if (fbink_add_ot_font(ot_file) != EXIT_SUCCESS) {
+			fprintf(stderr, "Failed to load that font!\n");
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+		while (optind < argc) {
+			string = argv[optind++];
+			if (!fbink_config.is_quiet) {
+				printf(
+				    "Printing string '%s' in '%s' @ %.1fpx, with margins top=%hd, bottom=%hd, left=%hd, right=%hd (overlay: %s, backgroundless: %s, inverted: %s, flashing: %s, centered: %s, padded: %s, clear screen: %s)\n",
+				    string,
+				    ot_file,
+				    (double) ot_config.size_px,
+				    ot_config.margins.top,
+				    ot_config.margins.bottom,
+				    ot_config.margins.left,
+				    ot_config.margins.right,
+				    fbink_config.is_overlay ? "true" : "false",
+				    fbink_config.is_bgless ? "true" : "false",
+				    fbink_config.is_inverted ? "true" : "false",
+				    fbink_config.is_flashing ? "true" : "false",
+				    fbink_config.is_centered ? "true" : "false",
+				    fbink_config.is_padded ? "true" : "false",
+				    fbink_config.is_cleared ? "true" : "false");
+			}
+			int top;
+			if ((top = fbink_print_ot(fbfd, string, &ot_config, &fbink_config)) < 0) {
+				fprintf(stderr, "Failed to print that string!\n");
+				rv = ERRCODE(EXIT_FAILURE);
+				goto cleanup;
+			}
+			// NOTE: Print's return value is where the next line would start, so, that's our next top margin.
+			ot_config.margins.top = (short int) top;
+		}
+	} else if (optind < argc) {
 		unsigned short int total_lines = 0U;
 		while (optind < argc) {
 			int linecount = -1;
@@ -806,6 +987,14 @@ int
 			printf(">>> ");
 			while ((nread = getline(&line, &len, stdin)) != -1) {
 				printf(">>> ");
+				if (is_console) {
+					if (fbink_console_write(fbfd, line, &fbink_config) != EXIT_SUCCESS) {
+						fprintf(stderr, "Failed to print that string!\n");
+						rv = ERRCODE(EXIT_FAILURE);
+					}
+					fbink_config.is_cleared = false;
+					continue;
+				}
 				if ((linecnt = fbink_print(fbfd, line, &fbink_config)) < 0) {
 					fprintf(stderr, "Failed to print that string!\n");
 					rv = ERRCODE(EXIT_FAILURE);
@@ -813,6 +1002,35 @@ int
 				fbink_config.row = (short int) (fbink_config.row + linecnt);
 			}
 			free(line);
+		} else if (is_console && !isatty(fileno(stdin))) {
+			// Feed the console whatever we get, as soon as we get it,
+			// so that a burst of output only costs us a single refresh.
+			char    buf[4096 + 1];
+			ssize_t nread;
+			bool    got_something = false;
+			while ((nread = read(fileno(stdin), buf, sizeof(buf) - 1U)) != 0) {
+				if (nread < 0) {
+					if (errno == EINTR) {
+						continue;
+					}
+					fprintf(stderr, "Failed to read from stdin: %s\n", strerror(errno));
+					rv = ERRCODE(EXIT_FAILURE);
+					break;
+				}
+				buf[nread]    = '\0';
+				got_something = true;
+				if (fbink_console_write(fbfd, buf, &fbink_config) != EXIT_SUCCESS) {
+					fprintf(stderr, "Failed to print that string!\n");
+					rv = ERRCODE(EXIT_FAILURE);
+				}
+				// NOTE: Only clear the screen on the first chunk, we'd wipe what we just printed otherwise.
+				fbink_config.is_cleared = false;
+			}
+
+			// If nothing was read, show the help
+			if (!got_something) {
+				show_helpmsg();
+			}
 		} else {
 			// If all else failed, try reading from stdin, provided we're not running from a terminal ;).
 			if (!isatty(fileno(stdin))) {
@@ -842,6 +1060,7 @@ int
 	// Cleanup
 cleanup:
 	free(image_file);
+	free(ot_file);
 	if (fbink_close(fbfd) == ERRCODE(EXIT_FAILURE)) {
 		fprintf(stderr, "Failed to close the framebuffer, aborting . . .\n");
 		rv = ERRCODE(EXIT_FAILURE);
@@ -23,6 +23,7 @@
 
 #include "fbink.h"
 
+#include <errno.h>
 #include <getopt.h>
 #include <stdlib.h>
 #include <string.h>
@@ -37,4 +38,6 @@ static void show_helpmsg(void);
 
 static int do_infinite_progress_bar(int, const FBInkConfig*);
 
+static int parse_fontname(const char*);
+
 #endif
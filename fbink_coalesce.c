@@ -0,0 +1,212 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_coalesce.h"
+
+// Refresh coalescing: instead of sending a refresh right away, we hold on to it for a few ms,
+// so that the ones that follow in quick succession (e.g., a handful of labels updated one after the other)
+// can be merged with it (c.f., batch_region), and sent as fewer, larger refreshes, which the EPDC handles much better
+// than a flurry of tiny ones that collide with each other.
+// A thread of our own sends them once the window has expired, so nothing is ever held for longer than that.
+
+// Start, tweak or stop coalescing refreshes, depending on window (in ms, 0 to stop)
+static int
+    setup_coalescer(uint8_t window)
+{
+	if (window == 0U) {
+		if (isCoalescing) {
+			// Send whatever we were still holding on to, and let the thread go
+			uint32_t flash_marker;
+			pthread_mutex_lock(&coalesceMutex);
+			send_coalesced_regions(coalesceFbfd, &flash_marker);
+			isCoalescing = false;
+			pthread_cond_signal(&coalesceCond);
+			pthread_mutex_unlock(&coalesceMutex);
+			if (flash_marker != 0U) {
+				wait_for_refresh(coalesceFbfd, flash_marker);
+			}
+			pthread_join(coalesceThread, NULL);
+			pthread_cond_destroy(&coalesceCond);
+
+			close(coalesceFbfd);
+			coalesceFbfd = -1;
+		}
+		coalesceMs = 0U;
+		return EXIT_SUCCESS;
+	}
+
+	if (isCoalescing) {
+		// NOTE: Only affects refreshes held from now on.
+		coalesceMs = window;
+		return EXIT_SUCCESS;
+	}
+
+	// NOTE: The thread gets an fd of its own, since the caller's may be long gone by the time it needs one.
+	coalesceFbfd = open("/dev/fb0", O_RDWR | O_CLOEXEC);
+	if (coalesceFbfd == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] open: %s\n", errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// We measure the window on the monotonic clock, so that it's not thrown off by the wall clock changing.
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&coalesceCond, &attr);
+	pthread_condattr_destroy(&attr);
+
+	coalesceCount = 0U;
+	isCoalescing  = true;
+	int rv        = pthread_create(&coalesceThread, NULL, &flush_coalesced_regions, NULL);
+	if (rv != 0) {
+		char  buf[256];
+		char* errstr = strerror_r(rv, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] pthread_create: %s\n", errstr);
+		isCoalescing = false;
+		pthread_cond_destroy(&coalesceCond);
+		close(coalesceFbfd);
+		coalesceFbfd = -1;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	coalesceMs = window;
+	ELOG("[FBInk] Coalescing refreshes over %hhums", window);
+
+	return EXIT_SUCCESS;
+}
+
+// Hold on to a refresh (in fb coordinates), merging it with the ones we're already holding if we can
+static int
+    coalesce_region(int fbfd, const struct mxcfb_rect* region, uint32_t waveform_mode, bool is_flashing)
+{
+	int      rv           = EXIT_SUCCESS;
+	uint32_t flash_marker = 0U;
+
+	pthread_mutex_lock(&coalesceMutex);
+	// The window starts with the first refresh we hold on to
+	if (coalesceCount == 0U) {
+		clock_gettime(CLOCK_MONOTONIC, &coalesceDeadline);
+		coalesceDeadline.tv_nsec += (long int) coalesceMs * 1000000L;
+		if (coalesceDeadline.tv_nsec >= 1000000000L) {
+			coalesceDeadline.tv_sec++;
+			coalesceDeadline.tv_nsec -= 1000000000L;
+		}
+		pthread_cond_signal(&coalesceCond);
+	}
+	batch_region(coalesceRegions, &coalesceCount, region, waveform_mode, is_flashing);
+	LOG("Coalescing a refresh of region (%u, %u) %ux%u (%hhu pending)",
+	    region->left,
+	    region->top,
+	    region->width,
+	    region->height,
+	    coalesceCount);
+
+	// NOTE: A flash is meant to be seen (and usually waited on) right away, so it closes the window early.
+	//       Whatever was merged with it gets flashed, too.
+	if (is_flashing) {
+		rv = send_coalesced_regions(fbfd, &flash_marker);
+	}
+	pthread_mutex_unlock(&coalesceMutex);
+
+	// NOTE: Don't hold the lock while we wait, the flushing thread (and whoever else refreshes) can go on meanwhile.
+	if (flash_marker != 0U && wait_for_refresh(fbfd, flash_marker) != EXIT_SUCCESS) {
+		rv = ERRCODE(EXIT_FAILURE);
+	}
+
+	return rv;
+}
+
+// Send everything we've been holding on to (with coalesceMutex held), without waiting for any of it:
+// flash_marker is set to the marker of the last flashing refresh we sent (0 if none), for the caller to wait on
+// once it has released coalesceMutex (c.f., wait_for_refresh).
+// NOTE: Since the EPDC processes updates in order, by the time that one is done, the previous ones are, too.
+static int
+    send_coalesced_regions(int fbfd, uint32_t* flash_marker)
+{
+	int rv = EXIT_SUCCESS;
+
+	*flash_marker = 0U;
+	if (coalesceCount > 0U) {
+		LOG("Sending %hhu coalesced refreshes", coalesceCount);
+	}
+	for (uint8_t i = 0U; i < coalesceCount; i++) {
+		uint32_t marker;
+		if (submit_refresh(fbfd,
+				   coalesceRegions[i].region,
+				   coalesceRegions[i].waveform_mode,
+				   coalesceRegions[i].is_flashing,
+				   &marker) != EXIT_SUCCESS) {
+			fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
+			rv = ERRCODE(EXIT_FAILURE);
+		} else if (coalesceRegions[i].is_flashing) {
+			*flash_marker = marker;
+		}
+	}
+	coalesceCount = 0U;
+
+	return rv;
+}
+
+// Send whatever we're holding on to right now (e.g., because someone is about to wait on it)
+static void
+    flush_coalescer(int fbfd)
+{
+	if (!isCoalescing) {
+		return;
+	}
+
+	const int fd = (fbfd == FBFD_AUTO) ? coalesceFbfd : fbfd;
+	uint32_t  flash_marker;
+	pthread_mutex_lock(&coalesceMutex);
+	send_coalesced_regions(fd, &flash_marker);
+	pthread_mutex_unlock(&coalesceMutex);
+	if (flash_marker != 0U) {
+		wait_for_refresh(fd, flash_marker);
+	}
+}
+
+// The flushing thread: sends what we've been holding on to as soon as the window has expired
+static void*
+    flush_coalesced_regions(void* arg __attribute__((unused)))
+{
+	pthread_mutex_lock(&coalesceMutex);
+	for (;;) {
+		while (coalesceCount == 0U && isCoalescing) {
+			pthread_cond_wait(&coalesceCond, &coalesceMutex);
+		}
+		if (!isCoalescing) {
+			break;
+		}
+
+		// Let the window run its course (refreshes that come in in the meantime get merged in),
+		// unless something else already sent everything (i.e., a flash).
+		int rv = 0;
+		while (coalesceCount > 0U && isCoalescing && rv != ETIMEDOUT) {
+			rv = pthread_cond_timedwait(&coalesceCond, &coalesceMutex, &coalesceDeadline);
+		}
+		// NOTE: Nobody's waiting on us, so, there's no point in waiting for flashing refreshes here.
+		uint32_t flash_marker;
+		send_coalesced_regions(coalesceFbfd, &flash_marker);
+	}
+	pthread_mutex_unlock(&coalesceMutex);
+
+	return NULL;
+}
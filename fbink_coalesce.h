@@ -0,0 +1,49 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_COALESCE_H
+#define __FBINK_COALESCE_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// How long we hold on to a refresh, in ms (0 means we don't, c.f., FBInkConfig's coalesce_ms)
+uint8_t coalesceMs = 0U;
+// The refreshes we're holding on to, and when we have to send them (on CLOCK_MONOTONIC)
+// NOTE: Everything but coalesceMs & the fd is only ever touched with coalesceMutex held,
+//       which, while coalescing, is also what keeps our refreshes in order across threads (c.f., submit_refresh).
+FBInkBatchRegion coalesceRegions[BATCH_MAX_REGIONS];
+uint8_t          coalesceCount = 0U;
+struct timespec  coalesceDeadline;
+// The flushing thread (c.f., flush_coalesced_regions)
+bool            isCoalescing  = false;
+int             coalesceFbfd  = -1;
+pthread_t       coalesceThread;
+pthread_mutex_t coalesceMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t  coalesceCond;
+
+static int   setup_coalescer(uint8_t);
+static int   coalesce_region(int, const struct mxcfb_rect*, uint32_t, bool);
+static int   send_coalesced_regions(int, uint32_t*);
+static void  flush_coalescer(int);
+static void* flush_coalesced_regions(void*);
+
+#endif
@@ -0,0 +1,724 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_console.h"
+
+// A tiny terminal: we keep a grid of cells & a cursor, and feed it with a useful subset of VT100/ANSI sequences.
+// Nothing is drawn while parsing, we just keep track of what changed on the grid (c.f., console_mark_dirty),
+// and sync the fb with it in one go at the end of each fbink_console_write call (c.f., console_flush).
+// NOTE: Scrolling is cheap: we just remember how many rows the grid scrolled by, and when syncing,
+//       we move the fb's pixels up by as much, and only draw the rows that were exposed (plus whatever else changed).
+
+// (Re)allocate our grid if need be, (i.e., on first use, or if MAXROWS/MAXCOLS changed since, c.f., fbink_init)
+static int
+    setup_console(void)
+{
+	if (consoleCells && consoleRows == MAXROWS && consoleCols == MAXCOLS) {
+		return EXIT_SUCCESS;
+	}
+
+	free(consoleCells);
+	free(consoleDirtyStart);
+	free(consoleDirtyEnd);
+	free(consoleLine);
+	consoleRows       = MAXROWS;
+	consoleCols       = MAXCOLS;
+	consoleCells      = calloc((size_t) consoleRows * consoleCols, sizeof(*consoleCells));
+	consoleDirtyStart = calloc(consoleRows, sizeof(*consoleDirtyStart));
+	consoleDirtyEnd   = calloc(consoleRows, sizeof(*consoleDirtyEnd));
+	consoleLine       = calloc(consoleCols, sizeof(*consoleLine));
+	if (consoleCells == NULL || consoleDirtyStart == NULL || consoleDirtyEnd == NULL || consoleLine == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] calloc (console): %s\n", errstr);
+		free(consoleCells);
+		free(consoleDirtyStart);
+		free(consoleDirtyEnd);
+		free(consoleLine);
+		consoleCells      = NULL;
+		consoleDirtyStart = NULL;
+		consoleDirtyEnd   = NULL;
+		consoleLine       = NULL;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	LOG("Allocated a %hux%hu console", consoleCols, consoleRows);
+
+	reset_console();
+	return EXIT_SUCCESS;
+}
+
+// Back to a blank grid, with the cursor home, and default attributes
+// NOTE: This doesn't mark anything dirty, it's up to the caller to decide whether the screen should follow.
+static void
+    reset_console(void)
+{
+	consoleFG        = penFGColor;
+	consoleBG        = penBGColor;
+	consoleIsInverse = false;
+	for (size_t i = 0U; i < (size_t) consoleRows * consoleCols; i++) {
+		consoleCells[i] = (FBInkCell){ .codepoint = 0x20U, .fg = consoleFG, .bg = consoleBG };
+	}
+	memset(consoleDirtyStart, 0, consoleRows * sizeof(*consoleDirtyStart));
+	memset(consoleDirtyEnd, 0, consoleRows * sizeof(*consoleDirtyEnd));
+	consoleScroll     = 0U;
+	consoleRow        = 0U;
+	consoleCol        = 0U;
+	consoleSavedRow   = 0U;
+	consoleSavedCol   = 0U;
+	consoleState      = CONSOLE_STATE_GROUND;
+	consoleParamCount = 0U;
+	consoleIsIgnored  = false;
+	consoleUTF8Left   = 0U;
+}
+
+// Remember that the columns [start, end) of row will need to be drawn
+static void
+    console_mark_dirty(unsigned short int row, unsigned short int start, unsigned short int end)
+{
+	if (consoleDirtyStart[row] >= consoleDirtyEnd[row]) {
+		consoleDirtyStart[row] = start;
+		consoleDirtyEnd[row]   = end;
+	} else {
+		consoleDirtyStart[row] = (unsigned short int) MIN(consoleDirtyStart[row], start);
+		consoleDirtyEnd[row]   = (unsigned short int) MAX(consoleDirtyEnd[row], end);
+	}
+}
+
+// Blank the columns [start, end) of row, with the current background color
+static void
+    console_erase(unsigned short int row, unsigned short int start, unsigned short int end)
+{
+	FBInkCell* cell = consoleCells + ((size_t) row * consoleCols);
+	for (unsigned short int col = start; col < end; col++) {
+		cell[col] = (FBInkCell){ .codepoint = 0x20U, .fg = consoleFG, .bg = consoleBG };
+	}
+	if (start < end) {
+		console_mark_dirty(row, start, end);
+	}
+}
+
+// Scroll the grid up by one row, the fb will follow on the next console_flush
+static void
+    console_scroll_up(void)
+{
+	const size_t rows = (size_t) consoleRows - 1U;
+	memmove(consoleCells, consoleCells + consoleCols, rows * consoleCols * sizeof(*consoleCells));
+	// NOTE: Our dirty spans move with the grid, since the fb's pixels will, too.
+	memmove(consoleDirtyStart, consoleDirtyStart + 1, rows * sizeof(*consoleDirtyStart));
+	memmove(consoleDirtyEnd, consoleDirtyEnd + 1, rows * sizeof(*consoleDirtyEnd));
+	consoleDirtyStart[rows] = 0U;
+	consoleDirtyEnd[rows]   = 0U;
+	// That's the only row we'll actually have to draw
+	console_erase((unsigned short int) rows, 0U, consoleCols);
+
+	if (consoleScroll < consoleRows) {
+		consoleScroll++;
+	}
+}
+
+// Scroll the grid down by one row (i.e., a reverse linefeed on the top row)
+// NOTE: That's rare enough that we don't bother moving the fb's pixels: we simply redraw everything.
+static void
+    console_scroll_down(void)
+{
+	const size_t rows = (size_t) consoleRows - 1U;
+	memmove(consoleCells + consoleCols, consoleCells, rows * consoleCols * sizeof(*consoleCells));
+	for (unsigned short int row = 0U; row < consoleRows; row++) {
+		console_mark_dirty(row, 0U, consoleCols);
+	}
+	console_erase(0U, 0U, consoleCols);
+}
+
+static void
+    console_linefeed(void)
+{
+	if (consoleRow + 1U < consoleRows) {
+		consoleRow++;
+	} else {
+		console_scroll_up();
+	}
+}
+
+// Print a codepoint at the cursor
+static void
+    console_put(uint32_t ch)
+{
+	// NOTE: Like a VT100, we only wrap when the *next* character comes in,
+	//       so that filling the last column doesn't scroll right away.
+	if (consoleCol >= consoleCols) {
+		consoleCol = 0U;
+		console_linefeed();
+	}
+
+	consoleCells[((size_t) consoleRow * consoleCols) + consoleCol] = (FBInkCell){
+		.codepoint = ch,
+		.fg        = consoleIsInverse ? consoleBG : consoleFG,
+		.bg        = consoleIsInverse ? consoleFG : consoleBG,
+	};
+	console_mark_dirty(consoleRow, consoleCol, (unsigned short int) (consoleCol + 1U));
+	consoleCol++;
+}
+
+// Convert a color to one of our 16 gray levels
+static uint8_t
+    luma_to_gray(uint8_t r, uint8_t g, uint8_t b)
+{
+	// NOTE: Rec. 601 luma, rounded to the nearest multiple of 0x11
+	const unsigned int v = ((299U * r) + (587U * g) + (114U * b)) / 1000U;
+	return (uint8_t) (((v + 8U) / 17U) * 17U);
+}
+
+// Convert an xterm 256 colors palette index (i.e., < 256) to a gray level
+static uint8_t
+    xterm_to_gray(unsigned short int index)
+{
+	// NOTE: The 16 ANSI colors, as per the luma of xterm's defaults.
+	static const uint8_t ansi[16] = { 0x00, 0x44, 0x77, 0xBB, 0x22, 0x55, 0x88, 0xDD,
+					  0x77, 0x44, 0x99, 0xDD, 0x66, 0x66, 0xAA, 0xFF };
+	static const uint8_t cube[6]  = { 0U, 95U, 135U, 175U, 215U, 255U };
+
+	if (index < 16U) {
+		return ansi[index];
+	} else if (index < 232U) {
+		// 6x6x6 color cube
+		index = (unsigned short int) (index - 16U);
+		return luma_to_gray(cube[index / 36U], cube[(index / 6U) % 6U], cube[index % 6U]);
+	} else {
+		// Grayscale ramp
+		const uint8_t v = (uint8_t) (8U + (index - 232U) * 10U);
+		return luma_to_gray(v, v, v);
+	}
+}
+
+// Fetch the i-th CSI parameter, with a default value for missing (or zero) ones
+static unsigned short int
+    csi_param(uint8_t i, unsigned short int def)
+{
+	if (i < MIN(consoleParamCount, CONSOLE_MAX_PARAMS) && consoleParams[i] != 0U) {
+		return consoleParams[i];
+	}
+	return def;
+}
+
+// Select Graphic Rendition: we only honor inverse video & colors (as gray levels)
+static void
+    console_sgr(void)
+{
+	const uint8_t count = (uint8_t) MIN(consoleParamCount, CONSOLE_MAX_PARAMS);
+	// NOTE: No parameters means 0 (i.e., reset)
+	if (count == 0U) {
+		consoleFG        = penFGColor;
+		consoleBG        = penBGColor;
+		consoleIsInverse = false;
+		return;
+	}
+
+	for (uint8_t i = 0U; i < count; i++) {
+		const unsigned short int p = consoleParams[i];
+		if (p == 0U) {
+			consoleFG        = penFGColor;
+			consoleBG        = penBGColor;
+			consoleIsInverse = false;
+		} else if (p == 7U) {
+			consoleIsInverse = true;
+		} else if (p == 27U) {
+			consoleIsInverse = false;
+		} else if (p >= 30U && p <= 37U) {
+			consoleFG = xterm_to_gray((unsigned short int) (p - 30U));
+		} else if (p == 39U) {
+			consoleFG = penFGColor;
+		} else if (p >= 40U && p <= 47U) {
+			consoleBG = xterm_to_gray((unsigned short int) (p - 40U));
+		} else if (p == 49U) {
+			consoleBG = penBGColor;
+		} else if (p >= 90U && p <= 97U) {
+			consoleFG = xterm_to_gray((unsigned short int) (p - 90U + 8U));
+		} else if (p >= 100U && p <= 107U) {
+			consoleBG = xterm_to_gray((unsigned short int) (p - 100U + 8U));
+		} else if (p == 38U || p == 48U) {
+			// Extended colors: 5;INDEX or 2;R;G;B
+			uint8_t v = p == 38U ? consoleFG : consoleBG;
+			if (i + 2U < count && consoleParams[i + 1U] == 5U) {
+				if (consoleParams[i + 2U] < 256U) {
+					v = xterm_to_gray(consoleParams[i + 2U]);
+				}
+				i = (uint8_t) (i + 2U);
+			} else if (i + 4U < count && consoleParams[i + 1U] == 2U) {
+				v = luma_to_gray((uint8_t) MIN(consoleParams[i + 2U], 255U),
+						 (uint8_t) MIN(consoleParams[i + 3U], 255U),
+						 (uint8_t) MIN(consoleParams[i + 4U], 255U));
+				i = (uint8_t) (i + 4U);
+			} else {
+				// Malformed, ignore the rest of it
+				break;
+			}
+			if (p == 38U) {
+				consoleFG = v;
+			} else {
+				consoleBG = v;
+			}
+		}
+		// NOTE: Everything else (bold, underline, blink & co) is silently ignored.
+	}
+}
+
+// Handle a complete CSI sequence
+static void
+    console_csi(uint8_t final)
+{
+	// NOTE: If we're still waiting for a wrap, we're actually on the last column.
+	const unsigned int last_row = consoleRows - 1U;
+	const unsigned int last_col = consoleCols - 1U;
+	const unsigned int row      = consoleRow;
+	const unsigned int col      = MIN(consoleCol, last_col);
+	const unsigned int n        = csi_param(0U, 1U);
+
+	switch (final) {
+		case 'A':
+			// CUU: Cursor Up
+			consoleRow = (unsigned short int) (row > n ? row - n : 0U);
+			consoleCol = (unsigned short int) col;
+			break;
+		case 'B':
+			// CUD: Cursor Down
+			consoleRow = (unsigned short int) MIN(row + n, last_row);
+			consoleCol = (unsigned short int) col;
+			break;
+		case 'C':
+			// CUF: Cursor Forward
+			consoleCol = (unsigned short int) MIN(col + n, last_col);
+			break;
+		case 'D':
+			// CUB: Cursor Back
+			consoleCol = (unsigned short int) (col > n ? col - n : 0U);
+			break;
+		case 'E':
+			// CNL: Cursor Next Line
+			consoleRow = (unsigned short int) MIN(row + n, last_row);
+			consoleCol = 0U;
+			break;
+		case 'F':
+			// CPL: Cursor Previous Line
+			consoleRow = (unsigned short int) (row > n ? row - n : 0U);
+			consoleCol = 0U;
+			break;
+		case 'G':
+		case '`':
+			// CHA: Cursor Horizontal Absolute
+			consoleCol = (unsigned short int) MIN(n - 1U, last_col);
+			break;
+		case 'd':
+			// VPA: Vertical Position Absolute
+			consoleRow = (unsigned short int) MIN(n - 1U, last_row);
+			consoleCol = (unsigned short int) col;
+			break;
+		case 'H':
+		case 'f':
+			// CUP: Cursor Position
+			consoleRow = (unsigned short int) MIN(n - 1U, last_row);
+			consoleCol = (unsigned short int) MIN(csi_param(1U, 1U) - 1U, last_col);
+			break;
+		case 'J':
+			// ED: Erase in Display
+			switch (consoleParamCount ? consoleParams[0] : 0U) {
+				case 0U:
+					console_erase(consoleRow, (unsigned short int) col, consoleCols);
+					for (unsigned short int r = (unsigned short int) (consoleRow + 1U); r < consoleRows; r++) {
+						console_erase(r, 0U, consoleCols);
+					}
+					break;
+				case 1U:
+					for (unsigned short int r = 0U; r < consoleRow; r++) {
+						console_erase(r, 0U, consoleCols);
+					}
+					console_erase(consoleRow, 0U, (unsigned short int) (col + 1U));
+					break;
+				case 2U:
+				case 3U:
+					for (unsigned short int r = 0U; r < consoleRows; r++) {
+						console_erase(r, 0U, consoleCols);
+					}
+					break;
+				default:
+					break;
+			}
+			break;
+		case 'K':
+			// EL: Erase in Line
+			switch (consoleParamCount ? consoleParams[0] : 0U) {
+				case 0U:
+					console_erase(consoleRow, (unsigned short int) col, consoleCols);
+					break;
+				case 1U:
+					console_erase(consoleRow, 0U, (unsigned short int) (col + 1U));
+					break;
+				case 2U:
+					console_erase(consoleRow, 0U, consoleCols);
+					break;
+				default:
+					break;
+			}
+			break;
+		case 'm':
+			console_sgr();
+			break;
+		case 's':
+			consoleSavedRow = consoleRow;
+			consoleSavedCol = consoleCol;
+			break;
+		case 'u':
+			consoleRow = consoleSavedRow;
+			consoleCol = consoleSavedCol;
+			break;
+		default:
+			LOG("Ignoring unsupported CSI sequence (final byte: %c)", final);
+			break;
+	}
+}
+
+// Handle the byte following an ESC
+static void
+    console_escape(uint8_t c)
+{
+	// NOTE: Intermediate bytes (e.g., charset designations, like ESC ( B) mean we're in something we don't handle.
+	if (c >= 0x20U && c <= 0x2FU) {
+		consoleIsIgnored = true;
+		return;
+	}
+	consoleState = CONSOLE_STATE_GROUND;
+	if (consoleIsIgnored) {
+		return;
+	}
+
+	switch (c) {
+		case '[':
+			consoleState      = CONSOLE_STATE_CSI;
+			consoleParamCount = 0U;
+			memset(consoleParams, 0, sizeof(consoleParams));
+			break;
+		case ']':
+			consoleState = CONSOLE_STATE_OSC;
+			break;
+		case 'c':
+			// RIS: Full reset, which also clears the screen
+			reset_console();
+			for (unsigned short int row = 0U; row < consoleRows; row++) {
+				console_mark_dirty(row, 0U, consoleCols);
+			}
+			break;
+		case '7':
+			// DECSC: Save Cursor
+			consoleSavedRow = consoleRow;
+			consoleSavedCol = consoleCol;
+			break;
+		case '8':
+			// DECRC: Restore Cursor
+			consoleRow = consoleSavedRow;
+			consoleCol = consoleSavedCol;
+			break;
+		case 'D':
+			// IND: Index
+			console_linefeed();
+			break;
+		case 'E':
+			// NEL: Next Line
+			consoleCol = 0U;
+			console_linefeed();
+			break;
+		case 'M':
+			// RI: Reverse Index
+			if (consoleRow > 0U) {
+				consoleRow--;
+			} else {
+				console_scroll_down();
+			}
+			break;
+		default:
+			LOG("Ignoring unsupported escape sequence (ESC %c)", c);
+			break;
+	}
+}
+
+// Handle a C0 control character (or DEL)
+static void
+    console_control(uint8_t c)
+{
+	switch (c) {
+		case 0x08U:
+			// BS (NOTE: If we're still waiting for a wrap, we're actually on the last column)
+			consoleCol = (unsigned short int) MIN(consoleCol, consoleCols - 1U);
+			if (consoleCol > 0U) {
+				consoleCol--;
+			}
+			break;
+		case 0x09U:
+			// HT: Tab stops every 8 columns
+			consoleCol = (unsigned short int) MIN((consoleCol | 7U) + 1U, consoleCols - 1U);
+			break;
+		case 0x0AU:
+		case 0x0BU:
+		case 0x0CU:
+			// LF, VT & FF
+			// NOTE: Like a tty with ONLCR, we also return to the first column,
+			//       since that's what everybody piping logs to us expects.
+			consoleCol = 0U;
+			console_linefeed();
+			break;
+		case 0x0DU:
+			// CR
+			consoleCol = 0U;
+			break;
+		case 0x1BU:
+			// ESC
+			consoleState     = CONSOLE_STATE_ESCAPE;
+			consoleIsIgnored = false;
+			break;
+		default:
+			// NUL, BEL, DEL & co
+			break;
+	}
+}
+
+// Feed the console with a single byte of UTF-8 (or of an escape sequence)
+static void
+    console_feed(uint8_t c)
+{
+	switch (consoleState) {
+		case CONSOLE_STATE_GROUND:
+			if (consoleUTF8Left > 0U) {
+				if ((c & 0xC0U) == 0x80U) {
+					consoleCodepoint = (consoleCodepoint << 6U) | (c & 0x3FU);
+					if (--consoleUTF8Left == 0U) {
+						console_put(consoleCodepoint);
+					}
+					return;
+				}
+				// Truncated sequence, flag it, and process this byte as usual.
+				consoleUTF8Left = 0U;
+				console_put(0xFFFDU);
+			}
+			if (c < 0x20U || c == 0x7FU) {
+				console_control(c);
+			} else if (c < 0x80U) {
+				console_put(c);
+			} else if ((c & 0xE0U) == 0xC0U) {
+				consoleCodepoint = c & 0x1FU;
+				consoleUTF8Left  = 1U;
+			} else if ((c & 0xF0U) == 0xE0U) {
+				consoleCodepoint = c & 0x0FU;
+				consoleUTF8Left  = 2U;
+			} else if ((c & 0xF8U) == 0xF0U) {
+				consoleCodepoint = c & 0x07U;
+				consoleUTF8Left  = 3U;
+			} else {
+				console_put(0xFFFDU);
+			}
+			break;
+		case CONSOLE_STATE_ESCAPE:
+			if (c < 0x20U) {
+				// NOTE: Controls are still honored in the middle of a sequence (and CAN & SUB abort it).
+				consoleState = (c == 0x18U || c == 0x1AU) ? CONSOLE_STATE_GROUND : consoleState;
+				console_control(c);
+			} else {
+				console_escape(c);
+			}
+			break;
+		case CONSOLE_STATE_CSI:
+			if (c >= '0' && c <= '9') {
+				if (consoleParamCount == 0U) {
+					consoleParamCount = 1U;
+				}
+				if (consoleParamCount <= CONSOLE_MAX_PARAMS) {
+					unsigned short int* p = &consoleParams[consoleParamCount - 1U];
+					*p                    = (unsigned short int) MIN((*p * 10U) + (c - '0'), 9999U);
+				}
+			} else if (c == ';') {
+				if (consoleParamCount == 0U) {
+					consoleParamCount = 1U;
+				}
+				if (consoleParamCount <= CONSOLE_MAX_PARAMS) {
+					consoleParamCount++;
+				}
+			} else if (c >= 0x3CU && c <= 0x3FU) {
+				// Private sequences (e.g., ESC [ ? 25 l)
+				consoleIsIgnored = true;
+			} else if (c >= 0x20U && c <= 0x2FU) {
+				// Intermediate bytes
+				consoleIsIgnored = true;
+			} else if (c >= 0x40U && c <= 0x7EU) {
+				consoleState = CONSOLE_STATE_GROUND;
+				if (!consoleIsIgnored) {
+					console_csi(c);
+				}
+			} else if (c < 0x20U) {
+				consoleState = (c == 0x18U || c == 0x1AU) ? CONSOLE_STATE_GROUND : consoleState;
+				console_control(c);
+			}
+			break;
+		case CONSOLE_STATE_OSC:
+			// We don't do window titles & co, swallow it until its terminator (BEL or ST)
+			if (c == 0x07U) {
+				consoleState = CONSOLE_STATE_GROUND;
+			} else if (c == 0x1BU) {
+				consoleState = CONSOLE_STATE_OSC_ESC;
+			}
+			break;
+		case CONSOLE_STATE_OSC_ESC:
+		default:
+			consoleState = CONSOLE_STATE_GROUND;
+			break;
+	}
+}
+
+// Sync the fb with our grid, and report the range of rows [top, bottom) that we touched
+static void
+    console_flush(const FBInkConfig* fbink_config, unsigned short int* top, unsigned short int* bottom)
+{
+	// First, honor scrolling, by moving what's still visible on the fb up.
+	// The rows that scrolling exposed have already been marked dirty, so they'll be drawn below.
+	if (consoleScroll > 0U) {
+		LOG("Scrolling the console by %hu rows", consoleScroll);
+		if (consoleScroll < consoleRows) {
+			move_view_rows((unsigned short int) viewVertOrigin,
+				       (unsigned short int) (viewVertOrigin + consoleScroll * FONTH),
+				       (unsigned short int) ((consoleRows - consoleScroll) * FONTH));
+		}
+		*top          = 0U;
+		*bottom       = consoleRows;
+		consoleScroll = 0U;
+	}
+
+	// Then draw whatever changed, in runs of cells sharing the same colors
+	const uint8_t fg = penFGColor;
+	const uint8_t bg = penBGColor;
+	for (unsigned short int row = 0U; row < consoleRows; row++) {
+		if (consoleDirtyStart[row] >= consoleDirtyEnd[row]) {
+			continue;
+		}
+		const FBInkCell*   cell = consoleCells + ((size_t) row * consoleCols);
+		unsigned short int col  = consoleDirtyStart[row];
+		while (col < consoleDirtyEnd[row]) {
+			unsigned short int n = 0U;
+			penFGColor           = cell[col].fg;
+			penBGColor           = cell[col].bg;
+			while (col + n < consoleDirtyEnd[row] && cell[col + n].fg == penFGColor &&
+			       cell[col + n].bg == penBGColor) {
+				consoleLine[n] = cell[col + n].codepoint;
+				n++;
+			}
+			draw(consoleLine, n, row, col, 0U, false, fbink_config);
+			col = (unsigned short int) (col + n);
+		}
+		consoleDirtyStart[row] = 0U;
+		consoleDirtyEnd[row]   = 0U;
+
+		*top    = (unsigned short int) MIN(*top, row);
+		*bottom = (unsigned short int) MAX(*bottom, row + 1U);
+	}
+	penFGColor = fg;
+	penBGColor = bg;
+}
+
+// Print a string through our tiny terminal
+int
+    fbink_console_write(int fbfd, const char* string, const FBInkConfig* fbink_config)
+{
+	// If we open a fd now, we'll only keep it open for this single call!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// map fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	if (setup_console() != EXIT_SUCCESS) {
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Clear screen? That also means starting from a clean slate.
+	if (fbink_config->is_cleared) {
+		clear_screen(fbfd, fbink_config->is_inverted ? penFGColor : penBGColor, fbink_config->is_flashing);
+		reset_console();
+	}
+
+	for (const char* p = string; *p != '\0'; p++) {
+		console_feed((uint8_t) *p);
+	}
+
+	// We draw straight on the grid, so positioning & overlay options make no sense here.
+	FBInkConfig config = *fbink_config;
+	config.is_centered = false;
+	config.is_padded   = false;
+	config.is_overlay  = false;
+	config.is_bgless   = false;
+	config.hoffset     = 0;
+	config.voffset     = 0;
+
+	unsigned short int top    = consoleRows;
+	unsigned short int bottom = 0U;
+	console_flush(&config, &top, &bottom);
+
+	struct mxcfb_rect region = { 0U };
+	if (fbink_config->is_cleared) {
+		fullscreen_region(&region);
+	} else if (top < bottom) {
+		// NOTE: Clamp to the bottom of the view, which may not be the bottom of the screen (c.f., koboVertOffset).
+		//       viewVertOrigin already includes viewVertOffset, which only shifts our rows, not the view itself.
+		const uint32_t view_bottom = (uint32_t) (viewVertOrigin - viewVertOffset) + viewHeight;
+		region.top                 = viewVertOrigin + (uint32_t) (top * FONTH);
+		region.left                = 0U + viewHoriOrigin;
+		region.width               = screenWidth;
+		region.height              = MIN((uint32_t) ((bottom - top) * FONTH), view_bottom - region.top);
+		rotate_region(&region);
+	} else {
+		// Nothing to refresh
+		goto cleanup;
+	}
+
+	// Refresh screen, unless nothing actually changed (c.f., use_diff), or we're batching refreshes (c.f., fbink_begin)
+	uint32_t wfm = WAVEFORM_MODE_AUTO;
+	if (commit_region(&region, &wfm, fbink_config->is_flashing) &&
+	    refresh(fbfd, region, wfm, fbink_config->is_flashing) != EXIT_SUCCESS) {
+		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
@@ -0,0 +1,87 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_CONSOLE_H
+#define __FBINK_CONSOLE_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// How many numeric parameters we'll remember in a CSI sequence, past that, they're ignored.
+#define CONSOLE_MAX_PARAMS 8U
+
+// Where we are in an escape sequence
+typedef enum
+{
+	CONSOLE_STATE_GROUND = 0U,    // Plain text
+	CONSOLE_STATE_ESCAPE,         // After an ESC
+	CONSOLE_STATE_CSI,            // After an ESC [
+	CONSOLE_STATE_OSC,            // After an ESC ], until a BEL or an ST
+	CONSOLE_STATE_OSC_ESC,        // After an ESC in an OSC string (i.e., the first half of an ST)
+} CONSOLE_STATE_E;
+
+// Our grid of cells, and its geometry (which follows MAXROWS & MAXCOLS, c.f., setup_console)
+FBInkCell*         consoleCells = NULL;
+unsigned short int consoleRows  = 0U;
+unsigned short int consoleCols  = 0U;
+// Per-row dirty spans, as [start, end) columns that have yet to be drawn
+unsigned short int* consoleDirtyStart = NULL;
+unsigned short int* consoleDirtyEnd   = NULL;
+// A row's worth of codepoints, to hand runs of cells over to draw
+uint32_t* consoleLine = NULL;
+// How many rows the grid has scrolled since we last synced the fb with it
+unsigned short int consoleScroll = 0U;
+// Cursor
+unsigned short int consoleRow      = 0U;
+unsigned short int consoleCol      = 0U;
+unsigned short int consoleSavedRow = 0U;
+unsigned short int consoleSavedCol = 0U;
+// Current attributes (SGR), colors are gray levels, like penFGColor & penBGColor
+uint8_t consoleFG        = 0x00;
+uint8_t consoleBG        = 0xFF;
+bool    consoleIsInverse = false;
+// Parser state
+uint8_t            consoleState = CONSOLE_STATE_GROUND;
+unsigned short int consoleParams[CONSOLE_MAX_PARAMS];
+uint8_t            consoleParamCount = 0U;
+bool               consoleIsIgnored  = false;
+uint32_t           consoleCodepoint  = 0U;
+uint8_t            consoleUTF8Left   = 0U;
+
+static int                setup_console(void);
+static void               reset_console(void);
+static void               console_mark_dirty(unsigned short int, unsigned short int, unsigned short int);
+static void               console_erase(unsigned short int, unsigned short int, unsigned short int);
+static void               console_scroll_up(void);
+static void               console_scroll_down(void);
+static void               console_linefeed(void);
+static void               console_put(uint32_t);
+static uint8_t            luma_to_gray(uint8_t, uint8_t, uint8_t) __attribute__((const));
+static uint8_t            xterm_to_gray(unsigned short int) __attribute__((const));
+static unsigned short int csi_param(uint8_t, unsigned short int);
+static void               console_sgr(void);
+static void               console_csi(uint8_t);
+static void               console_escape(uint8_t);
+static void               console_control(uint8_t);
+static void               console_feed(uint8_t);
+static void               console_flush(const FBInkConfig*, unsigned short int*, unsigned short int*);
+
+#endif
@@ -0,0 +1,299 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_expand.h"
+
+// Bitmask to pixel expansion kernels: they turn a stream of mask bytes (LSB first, one bit per pixel)
+// into pixels in the fb's pixel format, picking the packed fg pixel for set bits, and the packed bg pixel otherwise.
+// Every kernel expands count mask bytes, i.e., count * 8 pixels.
+// We've got NEON (ARM) or SSE2/AVX2 (x86) versions where they actually beat the LUT-based scalar versions
+// (c.f., make bench), and the scalar versions everywhere else.
+
+// Build the LUTs for the scalar kernels, once
+static void
+    expand_init_luts(void)
+{
+	static bool is_init = false;
+	if (is_init) {
+		return;
+	}
+
+	for (uint16_t b = 0U; b < 256U; b++) {
+		uint32_t m4 = 0U;
+#ifndef FBINK_EXPAND_NEON
+		uint64_t m8 = 0U;
+#endif
+		for (uint8_t i = 0U; i < 8U; i++) {
+			if (b & 1U << i) {
+				// Even pixels in the high nibble, odd pixels in the low nibble
+				m4 |= 0x0Fu << ((8U * (i >> 1U)) + (((i & 0x01) == 0) ? 4U : 0U));
+#ifndef FBINK_EXPAND_NEON
+				m8 |= 0xFFull << (8U * i);
+#endif
+			}
+		}
+		expandLUT4[b] = m4;
+#ifndef FBINK_EXPAND_NEON
+		expandLUT8[b] = m8;
+#endif
+#if !defined(FBINK_EXPAND_NEON) && !defined(FBINK_EXPAND_SSE2)
+		if (b < 16U) {
+			uint64_t m16 = 0U;
+			for (uint8_t i = 0U; i < 4U; i++) {
+				if (b & 1U << i) {
+					m16 |= 0xFFFFull << (16U * i);
+				}
+			}
+			expandLUT16[b] = m16;
+		}
+		if (b < 4U) {
+			uint64_t m32 = 0U;
+			for (uint8_t i = 0U; i < 2U; i++) {
+				if (b & 1U << i) {
+					m32 |= 0xFFFFFFFFull << (32U * i);
+				}
+			}
+			expandLUT32[b] = m32;
+		}
+#endif
+	}
+
+	is_init = true;
+}
+
+// Set count bits starting at bit start in the mask stream smask
+static void
+    set_mask_bits(uint8_t* smask, uint32_t start, uint32_t count)
+{
+	uint32_t i   = start;
+	uint32_t end = start + count;
+
+	// Up to the next byte boundary...
+	for (; i < end && (i & 0x07) != 0; i++) {
+		smask[i >> 3U] |= (uint8_t)(1U << (i & 0x07));
+	}
+	// Full bytes...
+	for (; i + 8U <= end; i += 8U) {
+		smask[i >> 3U] = 0xFF;
+	}
+	// And the leftovers.
+	for (; i < end; i++) {
+		smask[i >> 3U] |= (uint8_t)(1U << (i & 0x07));
+	}
+}
+
+// Scale a glyph's bitmap row by FONTSIZE_MULT, as a stream of (phase + FONTW + 7) / 8 mask bytes.
+// NOTE: On 4bpp fbs, phase (0 or 1) shifts everything by a pixel, so that the first pixel lands in the low nibble.
+static void
+    scale_glyph_mask(uint32_t mask, uint8_t phase, uint8_t* smask)
+{
+	const size_t len = (size_t)((phase + FONTW + 7U) >> 3U);
+
+	// Unscaled, this is just the bitmap row itself ;).
+	if (FONTSIZE_MULT == 1U && phase == 0U) {
+		for (size_t k = 0U; k < len; k++) {
+			smask[k] = (uint8_t)(mask >> (8U * k));
+		}
+		return;
+	}
+
+	// Otherwise, each set bit becomes a run of FONTSIZE_MULT set bits
+	memset(smask, 0, len);
+	for (uint8_t x = 0U; x < glyphWidth; x++) {
+		if (mask & 1U << x) {
+			set_mask_bits(smask, (uint32_t)(phase + (x * FONTSIZE_MULT)), FONTSIZE_MULT);
+		}
+	}
+}
+
+static void
+    expand_mask_Gray4(const uint8_t* smask, size_t count, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+	// 8 pixels are 4 bytes, so we can simply use a single 32-bit mask per mask byte.
+	const uint32_t fg = ((fgP & 0xF0) >> 4U) * 0x11111111U;
+	const uint32_t bg = ((bgP & 0xF0) >> 4U) * 0x11111111U;
+
+	for (size_t k = 0U; k < count; k++) {
+		uint32_t m  = expandLUT4[smask[k]];
+		uint32_t px = (fg & m) | (bg & ~m);
+		memcpy(dst + (k << 2U), &px, 4U);
+	}
+}
+
+static void
+    expand_mask_Gray8(const uint8_t* smask, size_t count, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+#if defined(FBINK_EXPAND_NEON)
+	const uint8x8_t bits = { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+	const uint8x8_t fg   = vdup_n_u8((uint8_t) fgP);
+	const uint8x8_t bg   = vdup_n_u8((uint8_t) bgP);
+
+	for (size_t k = 0U; k < count; k++) {
+		uint8x8_t m = vtst_u8(vdup_n_u8(smask[k]), bits);
+		vst1_u8(dst + (k << 3U), vbsl_u8(m, fg, bg));
+	}
+#else
+	// NOTE: On x86, SSE2 doesn't beat the LUT here (c.f., tools/bench_expand.c), so we don't bother.
+	const uint64_t fg = fgP * 0x0101010101010101ull;
+	const uint64_t bg = bgP * 0x0101010101010101ull;
+
+	for (size_t k = 0U; k < count; k++) {
+		uint64_t m  = expandLUT8[smask[k]];
+		uint64_t px = (fg & m) | (bg & ~m);
+		memcpy(dst + (k << 3U), &px, 8U);
+	}
+#endif
+}
+
+static void
+    expand_mask_RGB24(const uint8_t* smask, size_t count, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+	// NOTE: 3 bytes per pixel doesn't vectorize nicely, and nothing we run on actually uses 24bpp, so keep it simple.
+	for (size_t k = 0U; k < count; k++) {
+		uint8_t b = smask[k];
+		for (uint8_t i = 0U; i < 8U; i++) {
+			memcpy(dst + (((k << 3U) + i) * 3U), (b & 1U << i) ? &fgP : &bgP, 3U);
+		}
+	}
+}
+
+static void
+    expand_mask_RGB32(const uint8_t* smask, size_t count, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+#if defined(FBINK_EXPAND_NEON)
+	const uint32x4_t lo_bits = { 1U, 2U, 4U, 8U };
+	const uint32x4_t hi_bits = { 16U, 32U, 64U, 128U };
+	const uint32x4_t fg      = vdupq_n_u32(fgP);
+	const uint32x4_t bg      = vdupq_n_u32(bgP);
+
+	for (size_t k = 0U; k < count; k++) {
+		uint32x4_t v = vdupq_n_u32(smask[k]);
+		vst1q_u8(dst + (k << 5U), vreinterpretq_u8_u32(vbslq_u32(vtstq_u32(v, lo_bits), fg, bg)));
+		vst1q_u8(dst + (k << 5U) + 16U, vreinterpretq_u8_u32(vbslq_u32(vtstq_u32(v, hi_bits), fg, bg)));
+	}
+#elif defined(FBINK_EXPAND_AVX2)
+	const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	const __m256i fg   = _mm256_set1_epi32((int) fgP);
+	const __m256i bg   = _mm256_set1_epi32((int) bgP);
+
+	for (size_t k = 0U; k < count; k++) {
+		__m256i m = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(smask[k]), bits), bits);
+		_mm256_storeu_si256((__m256i*) (dst + (k << 5U)), _mm256_blendv_epi8(bg, fg, m));
+	}
+#elif defined(FBINK_EXPAND_SSE2)
+	const __m128i lo_bits = _mm_setr_epi32(1, 2, 4, 8);
+	const __m128i hi_bits = _mm_setr_epi32(16, 32, 64, 128);
+	const __m128i fg      = _mm_set1_epi32((int) fgP);
+	const __m128i bg      = _mm_set1_epi32((int) bgP);
+
+	for (size_t k = 0U; k < count; k++) {
+		__m128i v  = _mm_set1_epi32(smask[k]);
+		__m128i lo = _mm_cmpeq_epi32(_mm_and_si128(v, lo_bits), lo_bits);
+		__m128i hi = _mm_cmpeq_epi32(_mm_and_si128(v, hi_bits), hi_bits);
+		_mm_storeu_si128((__m128i*) (dst + (k << 5U)), _mm_or_si128(_mm_and_si128(lo, fg), _mm_andnot_si128(lo, bg)));
+		_mm_storeu_si128((__m128i*) (dst + (k << 5U) + 16U),
+				 _mm_or_si128(_mm_and_si128(hi, fg), _mm_andnot_si128(hi, bg)));
+	}
+#else
+	const uint64_t fg = fgP | ((uint64_t) fgP << 32U);
+	const uint64_t bg = bgP | ((uint64_t) bgP << 32U);
+
+	for (size_t k = 0U; k < count; k++) {
+		uint8_t b = smask[k];
+		for (uint8_t i = 0U; i < 4U; i++) {
+			uint64_t m  = expandLUT32[(b >> (2U * i)) & 0x03];
+			uint64_t px = (fg & m) | (bg & ~m);
+			memcpy(dst + (k << 5U) + (i << 3U), &px, 8U);
+		}
+	}
+#endif
+}
+
+static void
+    expand_mask_RGB565(const uint8_t* smask, size_t count, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+#if defined(FBINK_EXPAND_NEON)
+	const uint16x8_t bits = { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+	const uint16x8_t fg   = vdupq_n_u16((uint16_t) fgP);
+	const uint16x8_t bg   = vdupq_n_u16((uint16_t) bgP);
+
+	for (size_t k = 0U; k < count; k++) {
+		uint16x8_t m = vtstq_u16(vdupq_n_u16(smask[k]), bits);
+		vst1q_u8(dst + (k << 4U), vreinterpretq_u8_u16(vbslq_u16(m, fg, bg)));
+	}
+#elif defined(FBINK_EXPAND_SSE2)
+	size_t k = 0U;
+#	ifdef FBINK_EXPAND_AVX2
+	// Two mask bytes per vector
+	const __m256i wbits = _mm256_setr_epi16(
+	    1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, (short) 32768);
+	const __m256i wfg = _mm256_set1_epi16((short) fgP);
+	const __m256i wbg = _mm256_set1_epi16((short) bgP);
+	for (; k + 2U <= count; k += 2U) {
+		__m256i v = _mm256_set1_epi16((short) (smask[k] | (smask[k + 1U] << 8U)));
+		__m256i m = _mm256_cmpeq_epi16(_mm256_and_si256(v, wbits), wbits);
+		_mm256_storeu_si256((__m256i*) (dst + (k << 4U)), _mm256_blendv_epi8(wbg, wfg, m));
+	}
+#	endif
+	const __m128i bits = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+	const __m128i fg   = _mm_set1_epi16((short) fgP);
+	const __m128i bg   = _mm_set1_epi16((short) bgP);
+	for (; k < count; k++) {
+		__m128i m = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(smask[k]), bits), bits);
+		_mm_storeu_si128((__m128i*) (dst + (k << 4U)), _mm_or_si128(_mm_and_si128(m, fg), _mm_andnot_si128(m, bg)));
+	}
+#else
+	const uint64_t fg = fgP * 0x0001000100010001ull;
+	const uint64_t bg = bgP * 0x0001000100010001ull;
+
+	for (size_t k = 0U; k < count; k++) {
+		uint8_t  b  = smask[k];
+		uint64_t m  = expandLUT16[b & 0x0F];
+		uint64_t px = (fg & m) | (bg & ~m);
+		memcpy(dst + (k << 4U), &px, 8U);
+		m  = expandLUT16[b >> 4U];
+		px = (fg & m) | (bg & ~m);
+		memcpy(dst + (k << 4U) + 8U, &px, 8U);
+	}
+#endif
+}
+
+// Expand n pixels worth of the mask stream smask into the fb's pixel format @ dst,
+// taking care of the final partial mask byte, if any.
+static void
+    expand_mask(const uint8_t* smask, unsigned short int n, uint32_t fgP, uint32_t bgP, unsigned char* dst)
+{
+	const size_t full = n >> 3U;
+	// fbink_init() takes care of setting this global pointer to the right function for the fb's bpp
+	(*fxpExpandMask)(smask, full, fgP, bgP, dst);
+
+	const uint8_t rem = n & 0x07;
+	if (rem != 0U) {
+		// Expand the final byte in a scratch buffer large enough for 8 pixels @ 32bpp, and only keep what we need.
+		unsigned char tmp[32];
+		(*fxpExpandMask)(smask + full, 1U, fgP, bgP, tmp);
+		if (vInfo.bits_per_pixel == 4U) {
+			memcpy(dst + (full << 2U), tmp, (size_t)((rem + 1U) >> 1U));
+		} else {
+			const uint8_t Bpp = (uint8_t)(vInfo.bits_per_pixel >> 3U);
+			memcpy(dst + ((full << 3U) * Bpp), tmp, (size_t)(rem * Bpp));
+		}
+	}
+}
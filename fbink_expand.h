@@ -0,0 +1,66 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_EXPAND_H
+#define __FBINK_EXPAND_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// Pick the best bitmask expansion kernels available for our target at compile-time...
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include <arm_neon.h>
+#	define FBINK_EXPAND_NEON
+#elif defined(__SSE2__)
+#	include <emmintrin.h>
+#	define FBINK_EXPAND_SSE2
+#	ifdef __AVX2__
+#		include <immintrin.h>
+#		define FBINK_EXPAND_AVX2
+#	endif
+#endif
+
+// LUTs used by the scalar kernels, where a set bit becomes a fully set pixel mask
+// NOTE: Like everything else that packs pixels in FBInk, this assumes a little-endian target.
+// 8 nibbles, with the first pixel in the high nibble of the first byte (4bpp is always scalar)
+uint32_t expandLUT4[256] = { 0U };
+#ifndef FBINK_EXPAND_NEON
+// 8 bytes (8bpp is scalar on x86, too, c.f., expand_mask_Gray8)
+uint64_t expandLUT8[256] = { 0U };
+#endif
+#if !defined(FBINK_EXPAND_NEON) && !defined(FBINK_EXPAND_SSE2)
+// 4 halfwords
+uint64_t expandLUT16[16] = { 0U };
+// 2 words
+uint64_t expandLUT32[4] = { 0U };
+#endif
+
+static void expand_init_luts(void);
+static void set_mask_bits(uint8_t*, uint32_t, uint32_t);
+static void scale_glyph_mask(uint32_t, uint8_t, uint8_t*);
+static void expand_mask_Gray4(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+static void expand_mask_Gray8(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+static void expand_mask_RGB24(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+static void expand_mask_RGB32(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+static void expand_mask_RGB565(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+static void expand_mask(const uint8_t*, unsigned short int, uint32_t, uint32_t, unsigned char*);
+
+#endif
@@ -0,0 +1,328 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_fallback.h"
+
+// Font fallback: codepoints our font doesn't cover are drawn with the first font of the chain that does,
+// (i.e., fbink_config->fallback_fonts, then IBM), centered in our font's cells.
+// Since walking the chain means a few failed lookups, the result is remembered per codepoint.
+
+// Fill in a link of our chain for a specific font (glyph size & getter).
+// Returns false if that font isn't available in this build (or hasn't been registered), in which case that's IBM.
+static bool
+    get_font_link(uint8_t fontname, FBInkFontLink* link)
+{
+	link->fontname  = fontname;
+	link->get_glyph = NULL;
+	link->font      = NULL;
+	link->x_offs    = 0U;
+	link->y_offs    = 0U;
+
+#ifdef FBINK_WITH_FONTS
+	switch (fontname) {
+#	ifdef FBINK_WITH_FONT_SCIENTIFICA
+		case SCIENTIFICA:
+			link->width     = 5U;
+			link->height    = 12U;
+			link->get_glyph = &scientifica_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICAB
+		case SCIENTIFICAB:
+			link->width     = 5U;
+			link->height    = 12U;
+			link->get_glyph = &scientificab_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_SCIENTIFICAI
+		case SCIENTIFICAI:
+			link->width     = 7U;
+			link->height    = 12U;
+			link->get_glyph = &scientificai_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_ORP
+		case ORP:
+			link->width     = 6U;
+			link->height    = 12U;
+			link->get_glyph = &orp_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_ORPB
+		case ORPB:
+			link->width     = 6U;
+			link->height    = 12U;
+			link->get_glyph = &orpb_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_ORPI
+		case ORPI:
+			link->width     = 6U;
+			link->height    = 12U;
+			link->get_glyph = &orpi_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_KATES
+		case KATES:
+			link->width     = 7U;
+			link->height    = 15U;
+			link->get_glyph = &kates_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_TALL
+		case UNSCII_TALL:
+			link->width     = 8U;
+			link->height    = 16U;
+			link->get_glyph = &tall_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_VEGGIE
+		case VEGGIE:
+			link->width     = 8U;
+			link->height    = 16U;
+			link->get_glyph = &veggie_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_FKP
+		case FKP:
+			link->width     = 8U;
+			link->height    = 16U;
+			link->get_glyph = &fkp_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_CTRLD
+		case CTRLD:
+			link->width     = 8U;
+			link->height    = 16U;
+			link->get_glyph = &ctrld_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_LEGGIE
+		case LEGGIE:
+			link->width     = 8U;
+			link->height    = 18U;
+			link->get_glyph = &leggie_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_BLOCK
+		case BLOCK:
+			link->width     = 32U;
+			link->height    = 32U;
+			link->get_glyph = &block_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_MCR
+		case UNSCII_MCR:
+			link->width     = 8U;
+			link->height    = 8U;
+			link->get_glyph = &mcr_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_FANTASY
+		case UNSCII_FANTASY:
+			link->width     = 8U;
+			link->height    = 8U;
+			link->get_glyph = &fantasy_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_THIN
+		case UNSCII_THIN:
+			link->width     = 8U;
+			link->height    = 8U;
+			link->get_glyph = &thin_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII_ALT
+		case UNSCII_ALT:
+			link->width     = 8U;
+			link->height    = 8U;
+			link->get_glyph = &alt_get_glyph;
+			return true;
+#	endif
+#	ifdef FBINK_WITH_FONT_UNSCII
+		case UNSCII:
+			link->width     = 8U;
+			link->height    = 8U;
+			link->get_glyph = &unscii_get_glyph;
+			return true;
+#	endif
+		case IBM:
+			break;
+		default:
+			// Fonts registered via fbink_register_font
+			if (get_user_font(fontname)) {
+				link->font   = &get_user_font(fontname)->font;
+				link->width  = link->font->width;
+				link->height = link->font->height;
+				return true;
+			}
+			break;
+	}
+#endif
+
+	link->width     = 8U;
+	link->height    = 8U;
+	link->get_glyph = &font8x8_get_glyph;
+	if (fontname != IBM) {
+		link->fontname = IBM;
+		return false;
+	}
+	return true;
+}
+
+// Pick our font, and chain its fallbacks
+static void
+    setup_font_chain(const FBInkConfig* fbink_config)
+{
+	FBInkFontLink chain[MAX_FALLBACK_FONTS + 2U];
+	uint8_t       length = 1U;
+
+	if (!get_font_link(fbink_config->fontname, &chain[0])) {
+		if (fbink_config->fontname >= USER_FONT) {
+			ELOG("[FBInk] Font %hhu hasn't been registered, using IBM instead.", fbink_config->fontname);
+		} else {
+			ELOG("[FBInk] Font %hhu is not available in this FBInk build, using IBM instead.",
+			     fbink_config->fontname);
+		}
+	}
+
+	// NOTE: The list ends at the first IBM, and, unless it's empty, IBM is always our last resort.
+	uint8_t count = 0U;
+	while (count < MAX_FALLBACK_FONTS && fbink_config->fallback_fonts[count] != IBM) {
+		count++;
+	}
+	for (uint8_t i = 0U; count > 0U && i <= count; i++) {
+		FBInkFontLink* link = &chain[length];
+		if (!get_font_link((i < count) ? fbink_config->fallback_fonts[i] : (uint8_t) IBM, link)) {
+			ELOG("[FBInk] Fallback font %hhu is not available, skipping it.", fbink_config->fallback_fonts[i]);
+			continue;
+		}
+		bool is_dupe = false;
+		for (uint8_t j = 0U; j < length; j++) {
+			if (chain[j].fontname == link->fontname) {
+				is_dupe = true;
+			}
+		}
+		if (is_dupe) {
+			continue;
+		}
+		// Its glyphs have to fit in our cells
+		if (link->width > chain[0].width || link->height > chain[0].height) {
+			if (i < count) {
+				ELOG("[FBInk] Fallback font %s (%hhux%hhu) is larger than %s (%hhux%hhu), skipping it.",
+				     fontname_to_string(link->fontname),
+				     link->width,
+				     link->height,
+				     fontname_to_string(chain[0].fontname),
+				     chain[0].width,
+				     chain[0].height);
+			}
+			continue;
+		}
+		link->x_offs = (uint8_t) ((chain[0].width - link->width) / 2U);
+		link->y_offs = (uint8_t) ((chain[0].height - link->height) / 2U);
+		length++;
+	}
+
+	// If that's not the chain we had, the glyph cache (which only knows about our font) may be stale,
+	// and our resolutions definitely are.
+	bool is_same = (length == fontChainLength);
+	for (uint8_t i = 0U; is_same && i < length; i++) {
+		is_same = (chain[i].fontname == fontChain[i].fontname);
+	}
+	if (!is_same) {
+		if (length > 1U || fontChainLength > 1U) {
+			glyph_cache_flush();
+		}
+		memcpy(fontChain, chain, sizeof(*chain) * length);
+		fontChainLength = length;
+		for (uint16_t i = 0U; i < FALLBACK_CACHE_SIZE; i++) {
+			// NOTE: That's an invalid codepoint, so it won't ever match.
+			fallbackCodepoints[i] = UINT32_MAX;
+		}
+	}
+}
+
+// Unpack a glyph from a specific link of our chain, in our font's cell.
+// Returns false if that font doesn't cover that codepoint.
+static bool
+    link_get_glyph(uint8_t idx, uint32_t codepoint, uint32_t* rows)
+{
+	const FBInkFontLink* link = &fontChain[idx];
+	// Our own font's glyphs are a perfect fit, the others need to be moved into place
+	uint32_t  glyph[GLYPH_MAX_HEIGHT];
+	uint32_t* dst = (idx == 0U) ? rows : glyph;
+	bool      is_covered;
+#ifdef FBINK_WITH_FONTS
+	is_covered = link->font ? font_get_glyph(link->font, codepoint, dst) : (*link->get_glyph)(codepoint, dst);
+#else
+	is_covered = (*link->get_glyph)(codepoint, dst);
+#endif
+	if (is_covered && idx != 0U) {
+		memset(rows, 0, sizeof(*rows) * fontChain[0].height);
+		for (uint8_t y = 0U; y < link->height; y++) {
+			rows[link->y_offs + y] = glyph[y] << link->x_offs;
+		}
+	}
+	return is_covered;
+}
+
+// Unpack the glyph for a specific Unicode codepoint, from whichever font of the chain covers it first,
+// as glyphHeight rows of glyphWidth bits wide masks.
+// If none of them do, that's our font's fallback glyph (usually a blank).
+static void
+    resolve_glyph(uint32_t codepoint, uint32_t* rows)
+{
+	// No fallbacks, no need to remember anything
+	if (fontChainLength == 1U) {
+		if (!link_get_glyph(0U, codepoint, rows)) {
+			LOG("Codepoint U+%04X is not covered by this font!", codepoint);
+			glyphsMissing++;
+		}
+		return;
+	}
+
+	const uint32_t slot = codepoint & (FALLBACK_CACHE_SIZE - 1U);
+	if (fallbackCodepoints[slot] == codepoint) {
+		if (fallbackLinks[slot] == FALLBACK_MISSING) {
+			link_get_glyph(0U, codepoint, rows);
+			glyphsMissing++;
+		} else {
+			link_get_glyph(fallbackLinks[slot], codepoint, rows);
+		}
+		return;
+	}
+
+	// Walk the chain
+	// NOTE: Our font's attempt leaves its fallback glyph in rows, which the following ones don't touch unless they hit.
+	uint8_t link = FALLBACK_MISSING;
+	for (uint8_t i = 0U; i < fontChainLength; i++) {
+		if (link_get_glyph(i, codepoint, rows)) {
+			link = i;
+			break;
+		}
+	}
+	if (link == FALLBACK_MISSING) {
+		LOG("Codepoint U+%04X is not covered by any of our fonts!", codepoint);
+		glyphsMissing++;
+	}
+	fallbackCodepoints[slot] = codepoint;
+	fallbackLinks[slot]      = link;
+}
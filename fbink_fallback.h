@@ -0,0 +1,47 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_FALLBACK_H
+#define __FBINK_FALLBACK_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// How many codepoints we remember the resolution of (must be a power of two)
+#define FALLBACK_CACHE_SIZE 256U
+// What a codepoint no font in the chain covers resolves to
+#define FALLBACK_MISSING UINT8_MAX
+
+// Our font, then its fallbacks, in order (c.f., setup_font_chain)
+FBInkFontLink fontChain[MAX_FALLBACK_FONTS + 2U] = { 0 };
+uint8_t       fontChainLength                   = 0U;
+// Which link of the chain a codepoint resolved to, direct-mapped on the codepoint
+uint32_t fallbackCodepoints[FALLBACK_CACHE_SIZE] = { 0U };
+uint8_t  fallbackLinks[FALLBACK_CACHE_SIZE]      = { 0U };
+// Lookups of codepoints that no font in the chain covers
+uint32_t glyphsMissing = 0U;
+
+static bool get_font_link(uint8_t, FBInkFontLink*);
+static void setup_font_chain(const FBInkConfig*);
+static bool link_get_glyph(uint8_t, uint32_t, uint32_t*);
+static void resolve_glyph(uint32_t, uint32_t*);
+
+#endif
@@ -0,0 +1,223 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_glyph_cache.h"
+
+// A small LRU cache of glyphs pre-rendered in the fb's pixel format, so that drawing a glyph we've already seen
+// is only a matter of a few memcpy (c.f., blit_glyph_tile).
+// Tiles are keyed by (font, codepoint, FONTSIZE_MULT, fg, bg, bpp), plus the nibble a tile starts on on 4bpp fbs.
+static uint16_t
+    glyph_cache_hash(uint32_t codepoint, uint32_t fg, uint32_t bg, uint8_t phase)
+{
+	// Knuth's multiplicative hash on the codepoint, the rest is mostly constant between calls anyway...
+	uint32_t h = codepoint * 2654435761U;
+	h ^= fg ^ (bg << 1U) ^ ((uint32_t) glyphFont << 8U) ^ ((uint32_t) FONTSIZE_MULT << 16U) ^
+	     (vInfo.bits_per_pixel << 24U) ^ phase;
+	return (uint16_t)((h >> 16U) & (GLYPH_CACHE_BUCKETS - 1U));
+}
+
+// Detach a tile from the LRU list
+static void
+    glyph_cache_lru_unlink(uint16_t idx)
+{
+	FBInkGlyphTile* tile = &glyphTiles[idx];
+
+	if (tile->lru_prev != GLYPH_CACHE_NIL) {
+		glyphTiles[tile->lru_prev].lru_next = tile->lru_next;
+	} else {
+		glyphLRUHead = tile->lru_next;
+	}
+	if (tile->lru_next != GLYPH_CACHE_NIL) {
+		glyphTiles[tile->lru_next].lru_prev = tile->lru_prev;
+	} else {
+		glyphLRUTail = tile->lru_prev;
+	}
+	tile->lru_prev = GLYPH_CACHE_NIL;
+	tile->lru_next = GLYPH_CACHE_NIL;
+}
+
+// Make a tile the most recently used one
+static void
+    glyph_cache_lru_push(uint16_t idx)
+{
+	FBInkGlyphTile* tile = &glyphTiles[idx];
+
+	tile->lru_prev = GLYPH_CACHE_NIL;
+	tile->lru_next = glyphLRUHead;
+	if (glyphLRUHead != GLYPH_CACHE_NIL) {
+		glyphTiles[glyphLRUHead].lru_prev = idx;
+	}
+	glyphLRUHead = idx;
+	if (glyphLRUTail == GLYPH_CACHE_NIL) {
+		glyphLRUTail = idx;
+	}
+}
+
+// Throw away the least recently used tile
+static void
+    glyph_cache_evict(void)
+{
+	uint16_t idx = glyphLRUTail;
+	if (idx == GLYPH_CACHE_NIL) {
+		return;
+	}
+	FBInkGlyphTile* tile = &glyphTiles[idx];
+
+	glyph_cache_lru_unlink(idx);
+
+	// Unlink it from its hash chain, too
+	uint16_t* link = &glyphBuckets[tile->bucket];
+	while (*link != GLYPH_CACHE_NIL) {
+		if (*link == idx) {
+			*link = tile->hash_next;
+			break;
+		}
+		link = &glyphTiles[*link].hash_next;
+	}
+
+	glyphTilesBytes -= tile->size;
+	free(tile->data);
+	tile->data = NULL;
+	tile->size = 0U;
+	// Keep track of free slots through the hash_next field
+	tile->hash_next = GLYPH_CACHE_NIL;
+}
+
+// Throw away every tile (e.g., when what a codepoint renders as changes under our feet, c.f., setup_font_chain)
+static void
+    glyph_cache_flush(void)
+{
+	while (glyphLRUTail != GLYPH_CACHE_NIL) {
+		glyph_cache_evict();
+	}
+}
+
+// Setup our (empty) hash buckets, once
+static void
+    glyph_cache_init(void)
+{
+	static bool is_init = false;
+	if (is_init) {
+		return;
+	}
+
+	for (uint16_t i = 0U; i < GLYPH_CACHE_BUCKETS; i++) {
+		glyphBuckets[i] = GLYPH_CACHE_NIL;
+	}
+	is_init = true;
+}
+
+// Look for a tile matching our current font/fontmult/bpp setup, returns NULL on a cache miss
+static FBInkGlyphTile*
+    glyph_cache_lookup(uint32_t codepoint, uint32_t fg, uint32_t bg, uint8_t phase)
+{
+	glyph_cache_init();
+
+	uint16_t idx = glyphBuckets[glyph_cache_hash(codepoint, fg, bg, phase)];
+	while (idx != GLYPH_CACHE_NIL) {
+		FBInkGlyphTile* tile = &glyphTiles[idx];
+		if (tile->codepoint == codepoint && tile->fg == fg && tile->bg == bg && tile->phase == phase &&
+		    tile->font == glyphFont && tile->fontsize_mult == FONTSIZE_MULT &&
+		    tile->bpp == vInfo.bits_per_pixel) {
+			// Hit! Bump it to the front of the LRU list
+			glyph_cache_lru_unlink(idx);
+			glyph_cache_lru_push(idx);
+			glyphCacheHits++;
+			return tile;
+		}
+		idx = tile->hash_next;
+	}
+
+	glyphCacheMisses++;
+	return NULL;
+}
+
+// Allocate a new tile (evicting old ones if need be) of rows rows of pitch bytes.
+// The caller is then responsible for rendering the glyph in tile->data.
+// Returns NULL if the glyph is too large to be cached, or if we ran out of memory.
+static FBInkGlyphTile*
+    glyph_cache_insert(uint32_t           codepoint,
+		       uint32_t           fg,
+		       uint32_t           bg,
+		       uint8_t            phase,
+		       size_t             pitch,
+		       size_t             rows,
+		       unsigned short int width)
+{
+	glyph_cache_init();
+
+	size_t size = pitch * rows;
+	// Don't let a single huge glyph (i.e., a large FONTSIZE_MULT) flush everything else.
+	if (size > GLYPH_CACHE_MAX_BYTES / 8U) {
+		LOG("Glyph U+%04X is too large to be cached (%zu bytes)", codepoint, size);
+		return NULL;
+	}
+
+	// Make some room, if need be...
+	while ((glyphTilesBytes + size > GLYPH_CACHE_MAX_BYTES) && glyphLRUTail != GLYPH_CACHE_NIL) {
+		glyph_cache_evict();
+	}
+
+	// Find a free slot
+	uint16_t idx = GLYPH_CACHE_NIL;
+	if (glyphTilesCount < GLYPH_CACHE_MAX_TILES) {
+		idx = glyphTilesCount++;
+	} else {
+		// Look for an evicted tile first, and if there aren't any, evict the LRU one.
+		for (uint16_t i = 0U; i < GLYPH_CACHE_MAX_TILES; i++) {
+			if (!glyphTiles[i].data) {
+				idx = i;
+				break;
+			}
+		}
+		if (idx == GLYPH_CACHE_NIL) {
+			idx = glyphLRUTail;
+			glyph_cache_evict();
+		}
+	}
+
+	FBInkGlyphTile* tile = &glyphTiles[idx];
+	tile->data           = calloc(1U, size);
+	if (!tile->data) {
+		fprintf(stderr, "[FBInk] Failed to allocate a %zu bytes glyph tile!\n", size);
+		tile->size = 0U;
+		return NULL;
+	}
+	tile->size          = size;
+	tile->pitch         = pitch;
+	tile->width         = width;
+	tile->codepoint     = codepoint;
+	tile->fg            = fg;
+	tile->bg            = bg;
+	tile->font          = glyphFont;
+	tile->fontsize_mult = FONTSIZE_MULT;
+	tile->bpp           = (uint8_t) vInfo.bits_per_pixel;
+	tile->phase         = phase;
+	glyphTilesBytes += size;
+
+	// Link it in its hash bucket...
+	tile->bucket               = glyph_cache_hash(codepoint, fg, bg, phase);
+	tile->hash_next            = glyphBuckets[tile->bucket];
+	glyphBuckets[tile->bucket] = idx;
+	// And at the front of the LRU list
+	glyph_cache_lru_push(idx);
+
+	return tile;
+}
@@ -0,0 +1,54 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_GLYPH_CACHE_H
+#define __FBINK_GLYPH_CACHE_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// Maximum amount of memory our glyph tiles may use (1MB)
+#define GLYPH_CACHE_MAX_BYTES (1U << 20U)
+// Maximum amount of glyph tiles we keep around
+#define GLYPH_CACHE_MAX_TILES 512U
+// Amount of hash buckets (MUST be a power of two)
+#define GLYPH_CACHE_BUCKETS 256U
+// Used as a NULL index in our hash chains & LRU list
+#define GLYPH_CACHE_NIL UINT16_MAX
+
+// Our tiles, & the hash buckets & LRU list threaded through them
+FBInkGlyphTile glyphTiles[GLYPH_CACHE_MAX_TILES]    = { { 0 } };
+uint16_t       glyphBuckets[GLYPH_CACHE_BUCKETS]    = { 0U };
+uint16_t       glyphTilesCount                      = 0U;
+uint16_t       glyphLRUHead                         = GLYPH_CACHE_NIL;
+uint16_t       glyphLRUTail                         = GLYPH_CACHE_NIL;
+size_t         glyphTilesBytes                      = 0U;
+
+static uint16_t        glyph_cache_hash(uint32_t, uint32_t, uint32_t, uint8_t);
+static void            glyph_cache_lru_unlink(uint16_t);
+static void            glyph_cache_lru_push(uint16_t);
+static void            glyph_cache_evict(void);
+static void            glyph_cache_flush(void);
+static void            glyph_cache_init(void);
+static FBInkGlyphTile* glyph_cache_lookup(uint32_t, uint32_t, uint32_t, uint8_t);
+static FBInkGlyphTile* glyph_cache_insert(uint32_t, uint32_t, uint32_t, uint8_t, size_t, size_t, unsigned short int);
+
+#endif
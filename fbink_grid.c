@@ -0,0 +1,288 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_grid.h"
+
+// A retained grid of text cells: fbink_grid_print only updates the grid,
+// and fbink_grid_flush then draws (and refreshes) only the cells that differ from what we last put on screen.
+// That makes updating a few digits on a dashboard cost a few glyphs, instead of a full line.
+
+// (Re)allocate our grids if need be, (i.e., on first use, or if MAXROWS/MAXCOLS changed since, c.f., fbink_init)
+static int
+    setup_grid(void)
+{
+	if (gridCells && gridRows == MAXROWS && gridCols == MAXCOLS) {
+		return EXIT_SUCCESS;
+	}
+
+	free(gridCells);
+	free(gridFront);
+	free(gridDirtyStart);
+	free(gridDirtyEnd);
+	free(gridLine);
+	gridRows       = MAXROWS;
+	gridCols       = MAXCOLS;
+	gridCells      = calloc((size_t) gridRows * gridCols, sizeof(*gridCells));
+	gridFront      = calloc((size_t) gridRows * gridCols, sizeof(*gridFront));
+	gridDirtyStart = calloc(gridRows, sizeof(*gridDirtyStart));
+	gridDirtyEnd   = calloc(gridRows, sizeof(*gridDirtyEnd));
+	gridLine       = calloc(gridCols, sizeof(*gridLine));
+	if (gridCells == NULL || gridFront == NULL || gridDirtyStart == NULL || gridDirtyEnd == NULL ||
+	    gridLine == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] calloc (grid): %s\n", errstr);
+		free(gridCells);
+		free(gridFront);
+		free(gridDirtyStart);
+		free(gridDirtyEnd);
+		free(gridLine);
+		gridCells      = NULL;
+		gridFront      = NULL;
+		gridDirtyStart = NULL;
+		gridDirtyEnd   = NULL;
+		gridLine       = NULL;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	LOG("Allocated a %hux%hu grid", gridCols, gridRows);
+
+	return EXIT_SUCCESS;
+}
+
+// Forget everything: nothing is wanted, and nothing is known to be on screen
+static void
+    reset_grid(void)
+{
+	memset(gridCells, 0, (size_t) gridRows * gridCols * sizeof(*gridCells));
+	memset(gridFront, 0, (size_t) gridRows * gridCols * sizeof(*gridFront));
+	memset(gridDirtyStart, 0, gridRows * sizeof(*gridDirtyStart));
+	memset(gridDirtyEnd, 0, gridRows * sizeof(*gridDirtyEnd));
+}
+
+static bool
+    same_cell(const FBInkCell* a, const FBInkCell* b)
+{
+	return a->codepoint == b->codepoint && a->fg == b->fg && a->bg == b->bg;
+}
+
+// Remember that the columns [start, end) of row may need to be drawn
+static void
+    grid_mark_dirty(unsigned short int row, unsigned short int start, unsigned short int end)
+{
+	if (gridDirtyStart[row] >= gridDirtyEnd[row]) {
+		gridDirtyStart[row] = start;
+		gridDirtyEnd[row]   = end;
+	} else {
+		gridDirtyStart[row] = (unsigned short int) MIN(gridDirtyStart[row], start);
+		gridDirtyEnd[row]   = (unsigned short int) MAX(gridDirtyEnd[row], end);
+	}
+}
+
+// Update the grid with a string
+int
+    fbink_grid_print(const char* string, const FBInkConfig* fbink_config)
+{
+	if (setup_grid() != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Same positioning rules as fbink_print, minus the wraparound
+	short int col = fbink_config->col;
+	short int row = fbink_config->row;
+	if (col < 0) {
+		col = (short int) MAX(gridCols + col, 0);
+	}
+	if (row < 0) {
+		row = (short int) MAX(gridRows + row, 0);
+	}
+	if (col >= gridCols || row >= gridRows) {
+		LOG("Position (%hd, %hd) is off-grid, discarding '%s'", col, row, string);
+		return 0;
+	}
+
+	// NOTE: Colors are resolved now, so that each cell can have its own.
+	const FBInkCell blank = {
+		.codepoint = 0x20U,
+		.fg        = fbink_config->is_inverted ? penBGColor : penFGColor,
+		.bg        = fbink_config->is_inverted ? penFGColor : penBGColor,
+	};
+
+	int                changed = 0;
+	unsigned short int x       = (unsigned short int) col;
+	unsigned short int y       = (unsigned short int) row;
+	size_t             bi      = 0U;
+	uint32_t           ch      = 0U;
+	bool               is_done = false;
+	while (!is_done) {
+		ch = utf8_next(string, &bi);
+		// At the end of each line, honor padding, by blanking what's left of the row
+		if (ch == 0U || ch == 0x0AU) {
+			if (fbink_config->is_padded) {
+				while (x < gridCols) {
+					FBInkCell* cell = gridCells + ((size_t) y * gridCols) + x;
+					if (!same_cell(cell, &blank)) {
+						*cell = blank;
+						grid_mark_dirty(y, x, (unsigned short int) (x + 1U));
+						changed++;
+					}
+					x++;
+				}
+			}
+			// LF moves us to the next row, back to our initial column
+			if (ch == 0U || ++y >= gridRows) {
+				is_done = true;
+			}
+			x = (unsigned short int) col;
+			continue;
+		}
+		// Anything past the right edge is dropped
+		if (x >= gridCols) {
+			continue;
+		}
+
+		FBInkCell  wanted = blank;
+		FBInkCell* cell   = gridCells + ((size_t) y * gridCols) + x;
+		wanted.codepoint  = ch;
+		if (!same_cell(cell, &wanted)) {
+			*cell = wanted;
+			grid_mark_dirty(y, x, (unsigned short int) (x + 1U));
+			changed++;
+		}
+		x++;
+	}
+
+	LOG("Updated %d cells", changed);
+	return changed;
+}
+
+// Draw & refresh whatever changed in the grid since the last flush
+int
+    fbink_grid_flush(int fbfd, const FBInkConfig* fbink_config)
+{
+	// If we open a fd now, we'll only keep it open for this single call!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+
+	// map fb to user mem
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	if (setup_grid() != EXIT_SUCCESS) {
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// Colors are baked in the cells, and we're bound to the grid, so, positioning options make no sense here.
+	FBInkConfig config = *fbink_config;
+	config.is_inverted = false;
+	config.is_centered = false;
+	config.is_padded   = false;
+	config.hoffset     = 0;
+	config.voffset     = 0;
+
+	// NOTE: We let the batching machinery merge our refreshes, (unless the caller is already batching, in which case
+	//       everything simply ends up in the caller's batch).
+	const bool own_batch = !isBatching;
+	if (own_batch) {
+		fbink_begin();
+	}
+
+	const uint8_t fg    = penFGColor;
+	const uint8_t bg    = penBGColor;
+	int           drawn = 0;
+	for (unsigned short int row = 0U; row < gridRows; row++) {
+		if (gridDirtyStart[row] >= gridDirtyEnd[row]) {
+			continue;
+		}
+		const FBInkCell*   cell  = gridCells + ((size_t) row * gridCols);
+		FBInkCell*         front = gridFront + ((size_t) row * gridCols);
+		unsigned short int col   = gridDirtyStart[row];
+		while (col < gridDirtyEnd[row]) {
+			// Skip what's already on screen (or was never asked for)
+			if (cell[col].codepoint == 0U || same_cell(&cell[col], &front[col])) {
+				col++;
+				continue;
+			}
+			// Then draw runs of changed cells sharing the same colors
+			unsigned short int n = 0U;
+			penFGColor           = cell[col].fg;
+			penBGColor           = cell[col].bg;
+			while (col + n < gridDirtyEnd[row] && cell[col + n].codepoint != 0U &&
+			       !same_cell(&cell[col + n], &front[col + n]) && cell[col + n].fg == penFGColor &&
+			       cell[col + n].bg == penBGColor) {
+				gridLine[n]    = cell[col + n].codepoint;
+				front[col + n] = cell[col + n];
+				n++;
+			}
+			struct mxcfb_rect region = draw(gridLine, n, row, col, 0U, false, &config);
+			rotate_region(&region);
+			uint32_t wfm = WAVEFORM_MODE_AUTO;
+			commit_region(&region, &wfm, fbink_config->is_flashing);
+			drawn = drawn + n;
+			col   = (unsigned short int) (col + n);
+		}
+		gridDirtyStart[row] = 0U;
+		gridDirtyEnd[row]   = 0U;
+	}
+	penFGColor = fg;
+	penBGColor = bg;
+	LOG("Drew %d cells", drawn);
+
+	if (own_batch && fbink_commit(fbfd) != EXIT_SUCCESS) {
+		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// On success, we return the amount of cells we've drawn
+	rv = drawn;
+
+	// Cleanup
+cleanup:
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+}
+
+// Forget about the grid's content, and what we think is on screen
+int
+    fbink_grid_reset(void)
+{
+	if (setup_grid() != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+	reset_grid();
+
+	return EXIT_SUCCESS;
+}
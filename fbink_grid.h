@@ -0,0 +1,44 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_GRID_H
+#define __FBINK_GRID_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// What we want on screen, and what we know is on screen, cell per cell (c.f., fbink_grid.c)
+FBInkCell*         gridCells = NULL;
+FBInkCell*         gridFront = NULL;
+unsigned short int gridRows  = 0U;
+unsigned short int gridCols  = 0U;
+// Per-row spans, as [start, end) columns, that may differ between the two
+unsigned short int* gridDirtyStart = NULL;
+unsigned short int* gridDirtyEnd   = NULL;
+// A row's worth of codepoints, to hand runs of cells over to draw
+uint32_t* gridLine = NULL;
+
+static int  setup_grid(void);
+static void reset_grid(void);
+static bool same_cell(const FBInkCell*, const FBInkCell*) __attribute__((pure));
+static void grid_mark_dirty(unsigned short int, unsigned short int, unsigned short int);
+
+#endif
@@ -28,7 +28,7 @@
 #ifndef __FBINK_INTERNAL_H
 #define __FBINK_INTERNAL_H
 
-// No extra fonts & no image support in minimal builds
+// No extra fonts, no image support & no OpenType support in minimal builds
 #ifndef FBINK_MINIMAL
 #	ifndef FBINK_WITH_FONTS
 #		define FBINK_WITH_FONTS
@@ -36,6 +36,9 @@
 #	ifndef FBINK_WITH_IMAGE
 #		define FBINK_WITH_IMAGE
 #	endif
+#	ifndef FBINK_WITH_OPENTYPE
+#		define FBINK_WITH_OPENTYPE
+#	endif
 // Connect button scanning is Kobo specific
 #	ifndef FBINK_FOR_KINDLE
 #		ifndef FBINK_WITH_BUTTON_SCAN
@@ -44,6 +47,39 @@
 #	endif
 #endif
 
+// Which fonts, and which of font8x8's blocks, we build (c.f., FONTS & RANGES in the Makefile, and tools/subset_fonts.py)
+// NOTE: Unless we were asked for a subset, that's everything.
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/fonts.h"
+#else
+#	define FBINK_WITH_FONT8X8_CONTROL
+#	define FBINK_WITH_FONT8X8_EXT_LATIN
+#	define FBINK_WITH_FONT8X8_GREEK
+#	define FBINK_WITH_FONT8X8_BOX
+#	define FBINK_WITH_FONT8X8_BLOCK
+#	define FBINK_WITH_FONT8X8_HIRAGANA
+#	ifdef FBINK_WITH_FONTS
+#		define FBINK_WITH_FONT_UNSCII
+#		define FBINK_WITH_FONT_UNSCII_ALT
+#		define FBINK_WITH_FONT_UNSCII_THIN
+#		define FBINK_WITH_FONT_UNSCII_FANTASY
+#		define FBINK_WITH_FONT_UNSCII_MCR
+#		define FBINK_WITH_FONT_UNSCII_TALL
+#		define FBINK_WITH_FONT_BLOCK
+#		define FBINK_WITH_FONT_LEGGIE
+#		define FBINK_WITH_FONT_VEGGIE
+#		define FBINK_WITH_FONT_KATES
+#		define FBINK_WITH_FONT_FKP
+#		define FBINK_WITH_FONT_CTRLD
+#		define FBINK_WITH_FONT_ORP
+#		define FBINK_WITH_FONT_ORPB
+#		define FBINK_WITH_FONT_ORPI
+#		define FBINK_WITH_FONT_SCIENTIFICA
+#		define FBINK_WITH_FONT_SCIENTIFICAB
+#		define FBINK_WITH_FONT_SCIENTIFICAI
+#	endif
+#endif
+
 #include <errno.h>
 #include <fcntl.h>
 #include <linux/fb.h>
@@ -52,10 +88,14 @@
 #ifdef FBINK_WITH_MATHS
 #	include <math.h>
 #endif
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 
 // NOTE: This is from https://www.cprogramming.com/tutorial/unicode.html
@@ -70,7 +110,9 @@
 //       We're left with handling UTF-8 ourselves, and taking great pains to try not to horribly blow up on invalid input.
 //
 //       TL;DR; for API users: You have to ensure you feed FBInk valid UTF-8 input,
-//              as this is the encoding it effectively uses internally, without any kind of validation.
+//              as this is the encoding it effectively uses internally.
+//              Invalid sequences are replaced by U+FFFD (c.f., fbink_utf8.c), so they won't eat your string anymore,
+//              but don't expect anything fancier than that.
 //
 //       Further reading on the subject, in no particular order:
 //           https://github.com/benkasminbullock/unicode-c
@@ -102,12 +144,32 @@
 //       And with potentially a tiny bit of additional work, can work with Hex files exported from BDF
 //       or other bitmap fonts by gbdfed (with maybe an initial FontForge conversion to BDF if need be) ;).
 #include "font8x8/font8x8_basic.h"
-#include "font8x8/font8x8_block.h"
-#include "font8x8/font8x8_box.h"
-#include "font8x8/font8x8_control.h"
-#include "font8x8/font8x8_ext_latin.h"
-#include "font8x8/font8x8_greek.h"
-#include "font8x8/font8x8_hiragana.h"
+#ifdef FBINK_WITH_FONT8X8_BLOCK
+#	include "font8x8/font8x8_block.h"
+#endif
+#ifdef FBINK_WITH_FONT8X8_BOX
+#	include "font8x8/font8x8_box.h"
+#endif
+#ifdef FBINK_WITH_FONT8X8_CONTROL
+#	include "font8x8/font8x8_control.h"
+#endif
+#ifdef FBINK_WITH_FONT8X8_EXT_LATIN
+#	include "font8x8/font8x8_ext_latin.h"
+#endif
+#ifdef FBINK_WITH_FONT8X8_GREEK
+#	include "font8x8/font8x8_greek.h"
+#endif
+#ifdef FBINK_WITH_FONT8X8_HIRAGANA
+#	include "font8x8/font8x8_hiragana.h"
+#endif
+
+// NOTE: This is from https://github.com/nothings/stb, like stb_image.
+//       We only need its declarations here, for our typedefs, c.f., fbink.c for the implementation.
+#ifdef FBINK_WITH_OPENTYPE
+// Make it private, we don't need it anywhere else
+#	define STBTT_STATIC
+#	include "stb/stb_truetype.h"
+#endif
 
 // Where our (internal) typedefs dwell...
 #include "fbink_types.h"
@@ -195,6 +257,9 @@
 // We want to return negative values on failure, always
 #define ERRCODE(e) (-(e))
 
+// Glyphs are at most 32x32 (c.f., tools/hextoc.py), so that a row always fits in an uint32_t
+#define GLYPH_MAX_HEIGHT 32U
+
 // eInk color map
 // c.f., linux/drivers/video/mxc/cmap_lab126.h
 // NOTE: Legacy devices have an inverted color map, which we handle internally!
@@ -205,7 +270,8 @@ static const uint8_t eInkBGCMap[16] = { 0xFF, 0xEE, 0xDD, 0xCC, 0xBB, 0xAA, 0x99
 					0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0x00 };
 
 // Global variables to store fb/screen info
-unsigned char*           fbPtr      = NULL;
+unsigned char*           fbPtr      = NULL;    // Where we draw: either fbMapPtr, or our shadow buffer (c.f., use_shadow)
+unsigned char*           fbMapPtr   = NULL;    // The actual fb mmap
 bool                     isFbMapped = false;
 struct fb_var_screeninfo vInfo;
 struct fb_fix_screeninfo fInfo;
@@ -223,6 +289,11 @@ unsigned short int       FONTH          = 8U;
 uint8_t                  FONTSIZE_MULT  = 1U;
 uint8_t                  penFGColor     = 0x00;
 uint8_t                  penBGColor     = 0xFF;
+// The font we picked in fbink_init (c.f., FONT_INDEX_T)
+uint8_t glyphFont = 0U;
+// Glyph cache stats (c.f., fbink_glyph_cache.c)
+uint32_t glyphCacheHits   = 0U;
+uint32_t glyphCacheMisses = 0U;
 // Slightly arbitrary-ish fallback values
 unsigned short int MAXROWS = 45U;
 unsigned short int MAXCOLS = 32U;
@@ -235,15 +306,16 @@ long int USER_HZ = 100;
 // Pointers to the appropriate put_pixel/get_pixel functions for the fb's bpp
 void (*fxpPutPixel)(FBInkCoordinates*, FBInkColor*) = NULL;
 void (*fxpGetPixel)(FBInkCoordinates*, FBInkColor*) = NULL;
+// And to the matching rectangle fill function
+void (*fxpFillRect)(unsigned short int, unsigned short int, unsigned short int, unsigned short int, const FBInkColor*) = NULL;
+// As well as the matching bitmask expansion kernel (c.f., fbink_expand.c)
+void (*fxpExpandMask)(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*) = NULL;
+// And to the matching set of glyph renderers (indexed by GLYPH_MODE_E), c.f., draw()
+const FBInkGlyphRenderer* fxpGlyphRenderers = NULL;
+// As well as the matching glyph cache tile blitter
+void (*fxpBlitGlyphTile)(const FBInkGlyphTile*, unsigned short int, unsigned short int) = NULL;
 // As well as the appropriate coordinates rotation function...
 void (*fxpRotateCoords)(FBInkCoordinates*) = NULL;
-// And the font bitmap getter...
-const unsigned char* (*fxpFont8xGetBitmap)(uint32_t) = NULL;
-#ifdef FBINK_WITH_FONTS
-//const uint16_t* (*fxpFont16xGetBitmap)(uint32_t) = NULL;
-const uint32_t* (*fxpFont32xGetBitmap)(uint32_t) = NULL;
-//const uint64_t* (*fxpFont64xGetBitmap)(uint32_t) = NULL;
-#endif
 
 // Where we track device/screen-specific quirks
 FBInkDeviceQuirks deviceQuirks = { 0 };
@@ -258,14 +330,13 @@ static void put_pixel_Gray8(FBInkCoordinates*, FBInkColor*);
 static void put_pixel_RGB24(FBInkCoordinates*, FBInkColor*);
 static void put_pixel_RGB32(FBInkCoordinates*, FBInkColor*);
 static void put_pixel_RGB565(FBInkCoordinates*, FBInkColor*);
-static void put_pixel(FBInkCoordinates*, FBInkColor*);
 
 static void get_pixel_Gray4(FBInkCoordinates*, FBInkColor*);
 static void get_pixel_Gray8(FBInkCoordinates*, FBInkColor*);
 static void get_pixel_RGB24(FBInkCoordinates*, FBInkColor*);
 static void get_pixel_RGB32(FBInkCoordinates*, FBInkColor*);
-static void get_pixel_RGB565(FBInkCoordinates*, FBInkColor*);
-static void get_pixel(FBInkCoordinates*, FBInkColor*);
+static inline __attribute__((always_inline)) void unpack_pixel_RGB565(uint16_t, FBInkColor*);
+static void                                       get_pixel_RGB565(FBInkCoordinates*, FBInkColor*);
 
 #ifdef FBINK_WITH_IMAGE
 // This is only needed for alpha blending in the image codepath ;).
@@ -274,14 +345,85 @@ static void get_pixel(FBInkCoordinates*, FBInkColor*);
 #	define DIV255(v) (((v >> 8U) + v + 0x01) >> 8U)
 #endif
 
+static void fill_rect_Gray4(unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkColor*);
+static void fill_rect_Gray8(unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkColor*);
+static void fill_rect_RGB24(unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkColor*);
+static void fill_rect_RGB32(unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkColor*);
+static void fill_rect_RGB565(unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    unsigned short int,
+			    const FBInkColor*);
+static inline bool clip_span(unsigned short int, unsigned short int, uint32_t, unsigned short int*, unsigned short int*);
+static bool fill_area(unsigned short int, unsigned short int, unsigned short int, unsigned short int, const FBInkColor*);
 static void fill_rect(unsigned short int, unsigned short int, unsigned short int, unsigned short int, FBInkColor*);
+static void xor_span(unsigned char*, const unsigned char*, size_t, uint32_t);
+static void invert_span(unsigned char*, size_t, uint32_t);
+static inline void invert_rect(uint8_t, unsigned short int, unsigned short int, unsigned short int, unsigned short int);
+static inline void paint_glyph_run(uint8_t,
+				   uint8_t,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int,
+				   unsigned short int,
+				   const FBInkColor*);
+
+static inline uint32_t pack_pixel(uint8_t, const FBInkColor*);
+static inline void     render_glyph(const uint32_t*,
+				    uint8_t,
+				    uint8_t,
+				    unsigned short int,
+				    unsigned short int,
+				    const FBInkColor*,
+				    const FBInkColor*);
+
+static void                  expand_glyph_row(uint32_t, uint32_t, uint32_t, uint8_t, unsigned char*);
+static const FBInkGlyphTile* get_glyph_tile(uint32_t, unsigned short int, uint32_t, uint32_t);
+static inline void           copy_glyph_rows(uint8_t,
+					     const unsigned char*,
+					     uint8_t,
+					     unsigned short int,
+					     unsigned short int,
+					     unsigned short int,
+					     unsigned short int,
+					     unsigned short int);
+static inline void           xor_glyph_rows(uint8_t,
+					    const unsigned char*,
+					    uint8_t,
+					    unsigned short int,
+					    unsigned short int,
+					    unsigned short int,
+					    unsigned short int,
+					    unsigned short int);
+static inline void           blit_glyph_tile(uint8_t, const FBInkGlyphTile*, unsigned short int, unsigned short int);
 static void clear_screen(int UNUSED_BY_NOTKINDLE, uint8_t, bool UNUSED_BY_NOTKINDLE);
 
-static const unsigned char* font8x8_get_bitmap(uint32_t);
+static bool font8x8_get_glyph(uint32_t, uint32_t*);
+#ifdef FBINK_WITH_FONTS
+static bool font_glyph_index(uint32_t, const FBInkGlyphMap*, uint16_t*);
+static bool font_get_glyph(const FBInkFont*, uint32_t, uint32_t*);
+#endif
 
 static const char* fontname_to_string(uint8_t);
 
-static struct mxcfb_rect draw(const char*,
+static struct mxcfb_rect draw(const uint32_t*,
+			      unsigned short int,
 			      unsigned short int,
 			      unsigned short int,
 			      unsigned short int,
@@ -297,6 +439,10 @@ static int refresh_kindle_koa2(int, const struct mxcfb_rect, uint32_t, uint32_t,
 static int refresh_kobo(int, const struct mxcfb_rect, uint32_t, uint32_t, uint32_t);
 static int refresh_kobo_mk7(int, const struct mxcfb_rect, uint32_t, uint32_t, uint32_t);
 #endif    // FBINK_FOR_KINDLE
+static int wait_for_update(int, uint32_t);
+static int submit_refresh(int, const struct mxcfb_rect, uint32_t, bool, uint32_t*);
+static int wait_for_refresh(int, uint32_t);
+static int send_refresh(int, const struct mxcfb_rect, uint32_t, bool);
 static int refresh(int, const struct mxcfb_rect, uint32_t, bool);
 
 static int open_fb_fd(int*, bool*);
@@ -306,11 +452,42 @@ static const char* fb_rotate_to_string(uint32_t);
 static int memmap_fb(int);
 static int unmap_fb(void);
 
-static void rotate_region(struct mxcfb_rect*);
 static void fullscreen_region(struct mxcfb_rect*);
 
+static bool is_cjk(uint32_t) __attribute__((const));
+static bool is_wrap_point(uint32_t, uint32_t) __attribute__((const));
+
 int draw_progress_bars(int, bool, uint8_t, const FBInkConfig*);
 
+// The glyph cache lives in its own file, too
+#include "fbink_glyph_cache.h"
+// As do the bitmask expansion kernels
+#include "fbink_expand.h"
+// And the rotation-aware blitter
+#include "fbink_rotate.h"
+// And the shadow buffer
+#include "fbink_shadow.h"
+// And draw batching
+#include "fbink_batch.h"
+// And the console
+#include "fbink_console.h"
+// And the retained grid
+#include "fbink_grid.h"
+// And our UTF-8 decoder
+#include "fbink_utf8.h"
+// And external fonts
+#include "fbink_user_fonts.h"
+// And font fallback
+#include "fbink_fallback.h"
+// OpenType rendering
+#include "fbink_ot.h"
+// And update markers
+#include "fbink_async.h"
+// And refresh coalescing
+#include "fbink_coalesce.h"
+// And waveform mode selection
+#include "fbink_waveform.h"
+
 // For identify_device, which we need outside of fbink_device_id.c ;)
 #ifndef FBINK_FOR_LINUX
 #	include "fbink_device_id.h"
@@ -25,11 +25,19 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/leggie.h"
-#include "fonts/veggie.h"
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/leggie.h"
+#	include "fonts/subset/veggie.h"
+#else
+#	include "fonts/leggie.h"
+#	include "fonts/veggie.h"
+#endif
 
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const unsigned char* leggie_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* veggie_get_bitmap(uint32_t codepoint) __attribute__((const));
+#ifdef FBINK_WITH_FONT_LEGGIE
+static bool leggie_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_VEGGIE
+static bool veggie_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
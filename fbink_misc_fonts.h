@@ -25,13 +25,24 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/ctrld.h"
-#include "fonts/fkp.h"
-#include "fonts/kates.h"
-
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const unsigned char* kates_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* fkp_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* ctrld_get_bitmap(uint32_t codepoint) __attribute__((const));
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/ctrld.h"
+#	include "fonts/subset/fkp.h"
+#	include "fonts/subset/kates.h"
+#else
+#	include "fonts/ctrld.h"
+#	include "fonts/fkp.h"
+#	include "fonts/kates.h"
+#endif
+
+#ifdef FBINK_WITH_FONT_KATES
+static bool kates_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_FKP
+static bool fkp_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_CTRLD
+static bool ctrld_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
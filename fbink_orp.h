@@ -25,13 +25,20 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/orp.h"
-#include "fonts/orpb.h"
-#include "fonts/orpi.h"
-
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const unsigned char* orp_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* orpb_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* orpi_get_bitmap(uint32_t codepoint) __attribute__((const));
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/orp.h"
+#else
+#	include "fonts/orp.h"
+#endif
+
+#ifdef FBINK_WITH_FONT_ORP
+static bool orp_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_ORPB
+static bool orpb_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_ORPI
+static bool orpi_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
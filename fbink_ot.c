@@ -0,0 +1,576 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_ot.h"
+
+// OpenType rendering, via stb_truetype: glyphs are rasterized (antialiased) at whatever size we're asked for,
+// quantized to the 16 gray levels of the eInk palette, and packed in an atlas, keyed on (glyph, size),
+// so that printing them again is only a matter of blending their coverage into the fb.
+// NOTE: The atlas is a plain bump allocator: when it (or the hash table) fills up, we simply start over.
+
+#ifdef FBINK_WITH_OPENTYPE
+// Forget about every glyph we've rasterized
+static void
+    ot_flush_glyphs(void)
+{
+	memset(otGlyphs, 0, sizeof(otGlyphs));
+	otGlyphsCount = 0U;
+	otAtlasUsed   = 0U;
+}
+
+// Returns a glyph rasterized at size (in 1/64th of a pixel, scale being the matching font scale),
+// straight from the atlas if we've already rasterized it. Returns NULL if we can't.
+static const FBInkOTGlyph*
+    ot_get_glyph(int glyph, uint32_t size, float scale)
+{
+	// NOTE: Open addressing, with linear probing. We never let the table get more than 3/4 full, so that ends quickly.
+	const uint32_t home = (((uint32_t) glyph * 2654435761U) ^ size) & (OT_CACHE_SLOTS - 1U);
+	uint32_t       slot = home;
+	while (otGlyphs[slot].size != 0U) {
+		if (otGlyphs[slot].glyph == glyph && otGlyphs[slot].size == size) {
+			return &otGlyphs[slot];
+		}
+		slot = (slot + 1U) & (OT_CACHE_SLOTS - 1U);
+	}
+
+	int x0;
+	int y0;
+	int x1;
+	int y1;
+	stbtt_GetGlyphBitmapBox(&otFont.info, glyph, scale, scale, &x0, &y0, &x1, &y1);
+	const size_t len = (size_t)(x1 - x0) * (size_t)(y1 - y0);
+	if (len > OT_ATLAS_SIZE) {
+		LOG("Glyph %d is too large to be rendered at this size, skipping it", glyph);
+		return NULL;
+	}
+
+	// Make some room, if need be...
+	if (otGlyphsCount >= (OT_CACHE_SLOTS / 4U) * 3U || otAtlasUsed + len > OT_ATLAS_SIZE) {
+		LOG("OpenType glyph cache is full (%hu glyphs, %zu bytes), starting over", otGlyphsCount, otAtlasUsed);
+		ot_flush_glyphs();
+		slot = home;
+	}
+	if (otAtlas == NULL) {
+		otAtlas = malloc(OT_ATLAS_SIZE);
+		if (otAtlas == NULL) {
+			char  buf[256];
+			char* errstr = strerror_r(errno, buf, sizeof(buf));
+			fprintf(stderr, "[FBInk] malloc (atlas): %s\n", errstr);
+			return NULL;
+		}
+	}
+
+	FBInkOTGlyph* cached = &otGlyphs[slot];
+	cached->size         = size;
+	cached->offset       = (uint32_t) otAtlasUsed;
+	cached->glyph        = glyph;
+	cached->width        = (uint16_t)(x1 - x0);
+	cached->height       = (uint16_t)(y1 - y0);
+	cached->x_offs       = (int16_t) x0;
+	cached->y_offs       = (int16_t) y0;
+	if (len > 0U) {
+		unsigned char* levels = otAtlas + otAtlasUsed;
+		stbtt_MakeGlyphBitmap(
+		    &otFont.info, levels, cached->width, cached->height, cached->width, scale, scale, glyph);
+		// Quantize the coverage to the eInk palette
+		for (size_t i = 0U; i < len; i++) {
+			levels[i] = (unsigned char) (((levels[i] * 15U) + 127U) / 255U);
+		}
+	}
+	otAtlasUsed += len;
+	otGlyphsCount++;
+
+	return cached;
+}
+
+// Blend a coverage level (0 to 15) of fg over bg (honors is_overlay)
+// NOTE: Unless the background is black or white, the blend may land between two of the palette's
+//       gray levels, so round it to the nearest one (i.e., a multiple of 0x11, like luma_to_gray).
+static inline __attribute__((always_inline)) uint8_t
+    ot_blend(uint8_t fg, uint8_t bg, uint8_t level, bool is_overlay)
+{
+	const uint8_t v = is_overlay ? (uint8_t)(bg ^ 0xFF) : fg;
+	if (level == 15U && !is_overlay) {
+		return v;
+	}
+	const unsigned int blend = ((v * level) + (bg * (15U - level)) + 7U) / 15U;
+	return (uint8_t)(((blend + 8U) / 17U) * 17U);
+}
+
+// Blend w coverage levels into a row of pixels in the fb's pixel format (at 8bpp & up), in place.
+// NOTE: Like render_glyph, meant to be specialized at compile-time for a given bpp.
+//       We only ever draw grays, so r stands for the whole pixel (c.f., get_pixel_RGB32).
+static inline __attribute__((always_inline)) void
+    ot_blend_row(uint8_t              bpp,
+		 unsigned char*       row,
+		 const unsigned char* levels,
+		 unsigned short int   w,
+		 uint8_t              fg,
+		 bool                 is_overlay)
+{
+	const uint8_t Bpp = (uint8_t)(bpp >> 3U);
+	for (unsigned short int i = 0U; i < w; i++) {
+		const uint8_t level = levels[i];
+		if (level == 0U) {
+			continue;
+		}
+
+		unsigned char* p = row + (i * Bpp);
+		FBInkColor     color;
+		if (bpp == 16U) {
+			uint16_t v;
+			memcpy(&v, p, sizeof(v));
+			unpack_pixel_RGB565(v, &color);
+		} else {
+			// NOTE: BGR(A) at 24bpp & 32bpp, so r is the third byte.
+			color.r = (bpp == 8U) ? p[0] : p[2];
+		}
+
+		color.r = ot_blend(fg, color.r, level, is_overlay);
+		color.g = color.r;
+		color.b = color.r;
+		const uint32_t px = pack_pixel(bpp, &color);
+		memcpy(p, &px, Bpp);
+	}
+}
+
+// Blend a glyph's coverage into the fb in color fg, with its top-left corner @ (x, y) (honors is_overlay)
+// NOTE: We work one row at a time: pull the row of pixels the glyph covers out of the view (c.f., grab_rotated),
+//       blend it in the fb's pixel format, and push it back (c.f., blit_rotated), so rotation is only ever dealt with
+//       per row, not per pixel. row is scratch space for that, and needs room for a full row of the view.
+static void
+    ot_blit_glyph(const FBInkOTGlyph* glyph, int x, int y, const FBInkColor* fg, bool is_overlay, unsigned char* row)
+{
+	const int i_start = MAX(0, -x);
+	const int i_end   = MIN((int) glyph->width, (int) screenWidth - x);
+	const int j_start = MAX(0, -y);
+	const int j_end   = MIN((int) glyph->height, (int) screenHeight - y);
+	if (i_start >= i_end || j_start >= j_end) {
+		return;
+	}
+
+	const uint8_t            bpp = (uint8_t) vInfo.bits_per_pixel;
+	const unsigned short int fx  = (unsigned short int) (x + i_start);
+	const unsigned short int w   = (unsigned short int) (i_end - i_start);
+	for (int j = j_start; j < j_end; j++) {
+		const unsigned char*     levels = otAtlas + glyph->offset + (j * glyph->width) + i_start;
+		const unsigned short int fy     = (unsigned short int) (y + j);
+
+		if (bpp == 4U) {
+			// NOTE: 4bpp fbs are never rotated (c.f., set_view_rotation), so just blend the nibbles in place.
+			unsigned char* p = fbPtr + (fy * fInfo.line_length);
+			damage_rect(fx, fy, w, 1U);
+			for (unsigned short int i = 0U; i < w; i++) {
+				if (levels[i] == 0U) {
+					continue;
+				}
+				const unsigned short int px    = (unsigned short int) (fx + i);
+				const uint8_t            shift = (px & 0x01) ? 0U : 4U;
+				const uint8_t            bg    = (uint8_t)(((p[px >> 1U] >> shift) & 0x0F) * 0x11);
+				const uint8_t            v     = ot_blend(fg->r, bg, levels[i], is_overlay);
+				p[px >> 1U] = (unsigned char) ((p[px >> 1U] & ~(0x0F << shift)) | ((v >> 4U) << shift));
+			}
+			continue;
+		}
+
+		grab_rotated(row, 0U, fx, fy, w, 1U);
+		switch (bpp) {
+			case 8U:
+				ot_blend_row(8U, row, levels, w, fg->r, is_overlay);
+				break;
+			case 16U:
+				ot_blend_row(16U, row, levels, w, fg->r, is_overlay);
+				break;
+			case 24U:
+				ot_blend_row(24U, row, levels, w, fg->r, is_overlay);
+				break;
+			case 32U:
+			default:
+				ot_blend_row(32U, row, levels, w, fg->r, is_overlay);
+				break;
+		}
+		blit_rotated(row, 0U, fx, fy, w, 1U);
+	}
+}
+
+// Width of the span [start, end) of a line, in pixels (kerning included)
+static float
+    ot_line_width(const float* advances, const float* kerns, unsigned int start, unsigned int end)
+{
+	float width = 0.0f;
+	for (unsigned int i = start; i < end; i++) {
+		width += advances[i] + (i > start ? kerns[i] : 0.0f);
+	}
+	return width;
+}
+#endif    // FBINK_WITH_OPENTYPE
+
+// Load the font fbink_print_ot renders with
+int
+    fbink_add_ot_font(const char* filename UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	int fd = open(filename, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] open (%s): %s\n", filename, errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] fstat (%s): %s\n", filename, errstr);
+		close(fd);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// NOTE: That's the size of the offset table every font starts with
+	if (st.st_size < 12) {
+		fprintf(stderr, "[FBInk] %s is not an OpenType font!\n", filename);
+		close(fd);
+		return ERRCODE(EINVAL);
+	}
+
+	// NOTE: The mapping outlives the fd just fine.
+	const size_t size = (size_t) st.st_size;
+	void*        data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] mmap (%s): %s\n", filename, errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// Lookups are all over the place, don't bother with readahead
+	madvise(data, size, MADV_RANDOM);
+
+	// NOTE: Unlike our own font files, stb_truetype doesn't validate much of anything, so, only use fonts you trust.
+	stbtt_fontinfo info;
+	const int      offset = stbtt_GetFontOffsetForIndex((const unsigned char*) data, 0);
+	if (offset < 0 || !stbtt_InitFont(&info, (const unsigned char*) data, offset)) {
+		fprintf(stderr, "[FBInk] %s is not an OpenType font!\n", filename);
+		munmap(data, size);
+		return ERRCODE(EINVAL);
+	}
+
+	// Out with the old...
+	fbink_free_ot_fonts();
+	otFont.info = info;
+	otFont.data = data;
+	otFont.size = size;
+	isOTLoaded  = true;
+
+	LOG("Loaded OpenType font %s", filename);
+	return EXIT_SUCCESS;
+#else
+	fprintf(stderr, "[FBInk] OpenType support is disabled in this FBInk build!\n");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Unload our OpenType font, and forget about its glyphs
+int
+    fbink_free_ot_fonts(void)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (isOTLoaded) {
+		munmap(otFont.data, otFont.size);
+	}
+	memset(&otFont, 0, sizeof(otFont));
+	isOTLoaded = false;
+
+	ot_flush_glyphs();
+	free(otAtlas);
+	otAtlas = NULL;
+
+	return EXIT_SUCCESS;
+#else
+	fprintf(stderr, "[FBInk] OpenType support is disabled in this FBInk build!\n");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
+
+// Print a string with our OpenType font
+int
+    fbink_print_ot(int fbfd                         UNUSED_BY_MINIMAL,
+		   const char* string                   UNUSED_BY_MINIMAL,
+		   const FBInkOTConfig* fbink_ot_config UNUSED_BY_MINIMAL,
+		   const FBInkConfig* fbink_config      UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_OPENTYPE
+	if (!isOTLoaded) {
+		fprintf(stderr, "[FBInk] No OpenType font loaded!\n");
+		return ERRCODE(ENODATA);
+	}
+
+	// If we open a fd now, we'll only keep it open for this single print call!
+	bool keep_fd = true;
+	if (open_fb_fd(&fbfd, &keep_fd) != EXIT_SUCCESS) {
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	// Assume success, until shit happens ;)
+	int rv = EXIT_SUCCESS;
+	// We need to declare these early (& sentinel 'em to NULL) to make our cleanup jumps safe
+	uint32_t*      text    = NULL;
+	int*           glyphs  = NULL;
+	float*         metrics = NULL;
+	unsigned char* row     = NULL;
+
+	if (!isFbMapped) {
+		if (memmap_fb(fbfd) != EXIT_SUCCESS) {
+			rv = ERRCODE(EXIT_FAILURE);
+			goto cleanup;
+		}
+	}
+
+	// Where we can print, in view coordinates
+	const int left   = viewHoriOrigin + MAX(0, fbink_ot_config->margins.left);
+	const int right  = viewHoriOrigin + (int) viewWidth - MAX(0, fbink_ot_config->margins.right);
+	const int top    = viewVertOrigin + MAX(0, fbink_ot_config->margins.top);
+	const int bottom = viewVertOrigin + (int) viewHeight - MAX(0, fbink_ot_config->margins.bottom);
+	if (right <= left || bottom <= top) {
+		fprintf(stderr, "[FBInk] The margins leave no room to print anything!\n");
+		rv = ERRCODE(EINVAL);
+		goto cleanup;
+	}
+
+	// Default to the same line height as our bitmap fonts
+	float size_px = fbink_ot_config->size_px > 0.0f ? fbink_ot_config->size_px : (float) FONTH;
+	size_px       = MIN(MAX(size_px, 1.0f), OT_MAX_SIZE_PX);
+	// NOTE: Round to our fixed point precision *before* computing the scale, so that every glyph of a size matches.
+	const uint32_t size  = (uint32_t)((size_px * (float) (1U << OT_SIZE_SHIFT)) + 0.5f);
+	const float    scale = stbtt_ScaleForPixelHeight(&otFont.info, (float) size / (float) (1U << OT_SIZE_SHIFT));
+	int            ascent;
+	int            descent;
+	int            line_gap;
+	stbtt_GetFontVMetrics(&otFont.info, &ascent, &descent, &line_gap);
+	const int baseline    = (int) (((float) ascent * scale) + 0.5f);
+	const int line_height = MAX(1, (int) (((float) (ascent - descent + line_gap) * scale) + 0.5f));
+	LOG("OpenType size: %.2fpx (scale: %f), baseline @ %dpx, line height: %dpx", size_px, scale, baseline, line_height);
+
+	// NOTE: It's a grayscale ramp, so r = g = b (= v).
+	FBInkColor fgC = { fbink_config->is_inverted ? penBGColor : penFGColor, fgC.r, fgC.r };
+	FBInkColor bgC = { fbink_config->is_inverted ? penFGColor : penBGColor, bgC.r, bgC.r };
+
+	// Clear screen?
+	if (fbink_config->is_cleared) {
+		clear_screen(fbfd, bgC.r, fbink_config->is_flashing);
+	}
+
+	// Decode our string, and look up every glyph & its metrics, once
+	size_t len = strlen(string);
+	text       = malloc((len + 1U) * sizeof(*text));
+	if (text == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] malloc (text): %s\n", errstr);
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	unsigned int charcount = (unsigned int) utf8_decode(string, len, text);
+	glyphs                 = malloc((charcount + 1U) * sizeof(*glyphs));
+	metrics                = malloc((charcount + 1U) * 2U * sizeof(*metrics));
+	// NOTE: Scratch space for ot_blit_glyph, a full row of the view in the fb's pixel format.
+	row = malloc(screenWidth * sizeof(uint32_t));
+	if (glyphs == NULL || metrics == NULL || row == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] malloc (glyphs): %s\n", errstr);
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+	// Advances, in pixels, and the kerning between each glyph & the previous one
+	float* advances = metrics;
+	float* kerns    = metrics + charcount + 1U;
+	for (unsigned int i = 0U; i < charcount; i++) {
+		// Linefeeds take no room
+		if (text[i] == 0x0A) {
+			glyphs[i]   = 0;
+			advances[i] = 0.0f;
+			kerns[i]    = 0.0f;
+			continue;
+		}
+		glyphs[i] = stbtt_FindGlyphIndex(&otFont.info, (int) text[i]);
+		if (glyphs[i] == 0) {
+			LOG("Codepoint U+%04X is not covered by this font!", text[i]);
+			glyphsMissing++;
+		}
+		int advance;
+		int lsb;
+		stbtt_GetGlyphHMetrics(&otFont.info, glyphs[i], &advance, &lsb);
+		const int kern = (i > 0U) ? stbtt_GetGlyphKernAdvance(&otFont.info, glyphs[i - 1U], glyphs[i]) : 0;
+		advances[i]    = (float) advance * scale;
+		kerns[i]       = (float) kern * scale;
+	}
+
+	// Lay it out, one line at a time
+	const float  max_width = (float) (right - left);
+	int          x_min     = (int) screenWidth;
+	int          y_min     = (int) screenHeight;
+	int          x_max     = 0;
+	int          y_max     = 0;
+	int          y         = top;
+	unsigned int pos       = 0U;
+	while (pos < charcount) {
+		if (y + line_height > bottom) {
+			LOG("No room left above the bottom margin, discarding the %u characters left!", charcount - pos);
+			break;
+		}
+
+		// Fit as much as we can on this line, keeping track of the latest break opportunity (0 means none)
+		// NOTE: There's always at least one glyph per line, even if it doesn't actually fit.
+		unsigned int end   = pos;
+		unsigned int brk   = 0U;
+		float        width = 0.0f;
+		while (end < charcount && text[end] != 0x0A) {
+			const float w = advances[end] + (end > pos ? kerns[end] : 0.0f);
+			if (end > pos && width + w > max_width) {
+				break;
+			}
+			width += w;
+			end++;
+			if (end < charcount && is_wrap_point(text[end - 1U], text[end])) {
+				brk = end;
+			}
+		}
+		// If we ran out of room mid-word, backtrack to the latest break opportunity, if any (otherwise, cut it),
+		// and swallow the blanks we broke on.
+		const bool is_soft_break = (end < charcount && text[end] != 0x0A);
+		if (is_soft_break && brk > pos) {
+			end = brk;
+		}
+		unsigned int next = end;
+		if (is_soft_break) {
+			while (next < charcount && (text[next] == 0x20U || text[next] == 0x09U)) {
+				next++;
+			}
+		}
+		if (next < charcount && text[next] == 0x0A) {
+			next++;
+		}
+		// Don't draw trailing blanks, so that they don't throw centering off
+		while (end > pos && (text[end - 1U] == 0x20U || text[end - 1U] == 0x09U)) {
+			end--;
+		}
+		width = ot_line_width(advances, kerns, pos, end);
+
+		int x = left;
+		if (fbink_config->is_centered) {
+			x = MAX(left, left + (int) ((max_width - width) / 2.0f));
+		}
+		LOG("Line @ (%d, %d): %u characters over %.2fpx", x, y, end - pos, width);
+
+		// Background, unless we were asked not to
+		if (!fbink_config->is_bgless && !fbink_config->is_overlay) {
+			const int bg_x = fbink_config->is_padded ? left : x;
+			const int bg_w = fbink_config->is_padded ? (right - left) : (int) (width + 0.5f);
+			fill_rect((unsigned short int) bg_x,
+				  (unsigned short int) y,
+				  (unsigned short int) bg_w,
+				  (unsigned short int) line_height,
+				  &bgC);
+			x_min = MIN(x_min, bg_x);
+			x_max = MAX(x_max, bg_x + bg_w);
+			y_min = MIN(y_min, y);
+			y_max = MAX(y_max, y + line_height);
+		}
+
+		// And the glyphs, on a fractional pen position, but snapped to whole pixels, so that the atlas stays useful
+		float pen = (float) x;
+		for (unsigned int i = pos; i < end; i++) {
+			if (i > pos) {
+				pen += kerns[i];
+			}
+			const FBInkOTGlyph* glyph = ot_get_glyph(glyphs[i], size, scale);
+			if (glyph != NULL && glyph->width > 0U) {
+				const int gx = (int) (pen + 0.5f) + glyph->x_offs;
+				const int gy = y + baseline + glyph->y_offs;
+				ot_blit_glyph(glyph, gx, gy, &fgC, fbink_config->is_overlay, row);
+				// NOTE: Glyphs may very well overflow their line (accents, descenders)
+				x_min = MIN(x_min, gx);
+				x_max = MAX(x_max, gx + glyph->width);
+				y_min = MIN(y_min, gy);
+				y_max = MAX(y_max, gy + glyph->height);
+			}
+			pen += advances[i];
+		}
+
+		y += line_height;
+		pos = next;
+	}
+
+	// Refresh what we touched (clamped to the screen)
+	x_min                    = MAX(x_min, 0);
+	y_min                    = MAX(y_min, 0);
+	x_max                    = MIN(x_max, (int) screenWidth);
+	y_max                    = MIN(y_max, (int) screenHeight);
+	struct mxcfb_rect region = { 0U };
+	if (x_max > x_min && y_max > y_min) {
+		region.top    = (uint32_t) y_min;
+		region.left   = (uint32_t) x_min;
+		region.width  = (uint32_t)(x_max - x_min);
+		region.height = (uint32_t)(y_max - y_min);
+	}
+	LOG("Region: top=%u, left=%u, width=%u, height=%u", region.top, region.left, region.width, region.height);
+
+	// Rotate the region if need be...
+	rotate_region(&region);
+
+	// Fudge the region if we asked for a screen clear, so that we actually refresh the full screen...
+	if (fbink_config->is_cleared) {
+		fullscreen_region(&region);
+	}
+
+	// Refresh screen, unless we didn't draw anything, nothing actually changed (c.f., use_diff),
+	// or we're batching refreshes (c.f., fbink_begin)
+	uint32_t wfm = WAVEFORM_MODE_AUTO;
+	if (region.width > 0U && region.height > 0U &&
+	    commit_region(&region, &wfm, fbink_config->is_flashing) &&
+	    refresh(fbfd, region, wfm, fbink_config->is_flashing) != EXIT_SUCCESS) {
+		fprintf(stderr, "[FBInk] Failed to refresh the screen!\n");
+		rv = ERRCODE(EXIT_FAILURE);
+		goto cleanup;
+	}
+
+	// On success, we return where the next line would start, as a top margin
+	rv = y - viewVertOrigin;
+
+	// Cleanup
+cleanup:
+	free(row);
+	free(metrics);
+	free(glyphs);
+	free(text);
+	if (isFbMapped && !keep_fd) {
+		unmap_fb();
+	}
+	if (!keep_fd) {
+		close(fbfd);
+	}
+
+	return rv;
+#else
+	fprintf(stderr, "[FBInk] OpenType support is disabled in this FBInk build!\n");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_OPENTYPE
+}
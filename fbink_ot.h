@@ -0,0 +1,60 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_OT_H
+#define __FBINK_OT_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+#ifdef FBINK_WITH_OPENTYPE
+// How many rasterized glyphs we keep around (must be a power of two), and how much room their coverage gets, in bytes
+#	define OT_CACHE_SLOTS 1024U
+#	define OT_ATLAS_SIZE (512U * 1024U)
+// Sizes are in 1/64th of a pixel (like FreeType's 26.6 fixed point), so that close enough sizes share their glyphs
+#	define OT_SIZE_SHIFT 6U
+// And we don't go past that, so that a glyph always fits in an empty atlas
+#	define OT_MAX_SIZE_PX 256.0f
+
+// The font we render with (c.f., fbink_add_ot_font)
+FBInkOTFont otFont     = { 0 };
+bool        isOTLoaded = false;
+// The glyphs we've rasterized, hashed on (glyph, size), and the atlas their coverage is packed in
+FBInkOTGlyph   otGlyphs[OT_CACHE_SLOTS] = { 0 };
+uint16_t       otGlyphsCount            = 0U;
+unsigned char* otAtlas                  = NULL;
+size_t         otAtlasUsed              = 0U;
+
+static void                ot_flush_glyphs(void);
+static const FBInkOTGlyph* ot_get_glyph(int, uint32_t, float);
+static void                ot_blit_glyph(const FBInkOTGlyph*, int, int, const FBInkColor*, bool, unsigned char*);
+static float               ot_line_width(const float*, const float*, unsigned int, unsigned int);
+
+static inline __attribute__((always_inline)) uint8_t ot_blend(uint8_t, uint8_t, uint8_t, bool);
+static inline __attribute__((always_inline)) void    ot_blend_row(uint8_t,
+								  unsigned char*,
+								  const unsigned char*,
+								  unsigned short int,
+								  uint8_t,
+								  bool);
+#endif
+
+#endif
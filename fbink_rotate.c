@@ -0,0 +1,297 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "fbink_rotate.h"
+
+// Rotation-aware blitting: our view (i.e., screenWidth x screenHeight, with (0, 0) at the top-left)
+// may be rotated in any of the four FB_ROTATE_* directions relative to the fb's memory layout.
+// Instead of rotating every single pixel's coordinates, we precompute how to walk the fb from the view's origin,
+// and move whole rectangles of pixels at a time.
+// NOTE: This requires whole bytes per pixel, so 4bpp fbs are never rotated.
+//       Text, fills & refresh regions honor any rotation, but fbink_print_image only goes through the blitter at 16bpp,
+//       as that's the only depth we currently ever end up rotated at (c.f., isKobo16Landscape).
+
+// Compute the byte offsets needed to walk the fb in view coordinates, for a given FB_ROTATE_* rotation.
+// NOTE: Expects screenWidth & screenHeight to already describe the *view*, (i.e., swapped for CW & CCW).
+static void
+    set_view_rotation(uint32_t rotate)
+{
+	// Our pixels need to be byte-addressable...
+	if (vInfo.bits_per_pixel < 8U) {
+		rotate = FB_ROTATE_UR;
+	}
+
+	const ptrdiff_t size  = (ptrdiff_t)(vInfo.bits_per_pixel >> 3U);
+	const ptrdiff_t pitch = (ptrdiff_t) fInfo.line_length;
+	const ptrdiff_t w     = (ptrdiff_t) screenWidth;
+	const ptrdiff_t h     = (ptrdiff_t) screenHeight;
+
+	viewRotation.pixel_size = (uint32_t) size;
+	switch (rotate) {
+		case FB_ROTATE_CW:
+			// (x, y) -> (y, w - 1 - x)
+			viewRotation.origin = (w - 1) * pitch;
+			viewRotation.x_step = -pitch;
+			viewRotation.y_step = size;
+			break;
+		case FB_ROTATE_UD:
+			// (x, y) -> (w - 1 - x, h - 1 - y)
+			viewRotation.origin = ((h - 1) * pitch) + ((w - 1) * size);
+			viewRotation.x_step = -size;
+			viewRotation.y_step = -pitch;
+			break;
+		case FB_ROTATE_CCW:
+			// (x, y) -> (h - 1 - y, x)
+			viewRotation.origin = (h - 1) * size;
+			viewRotation.x_step = pitch;
+			viewRotation.y_step = -size;
+			break;
+		case FB_ROTATE_UR:
+		default:
+			rotate              = FB_ROTATE_UR;
+			viewRotation.origin = 0;
+			viewRotation.x_step = size;
+			viewRotation.y_step = pitch;
+			break;
+	}
+	viewRotation.rotate = rotate;
+}
+
+// Map a rectangle in view coordinates to fb coordinates.
+// A rotated rectangle is still a rectangle, so fills & co can still work on whole fb rows ;).
+static void
+    rotate_area(unsigned short int* x, unsigned short int* y, unsigned short int* w, unsigned short int* h)
+{
+	unsigned short int rx;
+	unsigned short int ry;
+	unsigned short int rw = *w;
+	switch (viewRotation.rotate) {
+		case FB_ROTATE_CW:
+			rx = *y;
+			ry = (unsigned short int) (screenWidth - *x - *w);
+			*w = *h;
+			*h = rw;
+			break;
+		case FB_ROTATE_UD:
+			rx = (unsigned short int) (screenWidth - *x - *w);
+			ry = (unsigned short int) (screenHeight - *y - *h);
+			break;
+		case FB_ROTATE_CCW:
+			rx = (unsigned short int) (screenHeight - *y - *h);
+			ry = *x;
+			*w = *h;
+			*h = rw;
+			break;
+		default:
+			return;
+	}
+	*x = rx;
+	*y = ry;
+}
+
+// Much like rotate_area, but for a mxcfb rectangle
+static void
+    rotate_region(struct mxcfb_rect* region)
+{
+	// Rotate the region if need be...
+	struct mxcfb_rect oregion = *region;
+	// NOTE: left = x, top = y
+	switch (viewRotation.rotate) {
+		case FB_ROTATE_CW:
+			region->top    = screenWidth - oregion.left - oregion.width;
+			region->left   = oregion.top;
+			region->width  = oregion.height;
+			region->height = oregion.width;
+			break;
+		case FB_ROTATE_UD:
+			region->top  = screenHeight - oregion.top - oregion.height;
+			region->left = screenWidth - oregion.left - oregion.width;
+			break;
+		case FB_ROTATE_CCW:
+			region->top    = oregion.left;
+			region->left   = screenHeight - oregion.top - oregion.height;
+			region->width  = oregion.height;
+			region->height = oregion.width;
+			break;
+		default:
+			break;
+	}
+}
+
+// Move a w x h block of pixels in the fb's pixel format between buf (with rows pitch bytes apart)
+// and the view @ (x, y). The block must already be clipped to the view.
+// NOTE: A pitch of 0 replicates the same row of pixels (c.f., glyph scaling).
+//       Meant to be specialized at compile-time for a given pixel size & direction.
+static inline __attribute__((always_inline)) void
+    transfer_rotated(unsigned char*     buf,
+		     size_t             pitch,
+		     unsigned short int x,
+		     unsigned short int y,
+		     unsigned short int w,
+		     unsigned short int h,
+		     uint8_t            size,
+		     bool               to_fb)
+{
+	const ptrdiff_t x_step = viewRotation.x_step;
+	const ptrdiff_t y_step = viewRotation.y_step;
+	unsigned char*  fb     = fbPtr + viewRotation.origin + (x * x_step) + (y * y_step);
+
+	if (x_step == size) {
+		// UR: view rows are fb rows
+		for (unsigned short int j = 0U; j < h; j++) {
+			unsigned char* f = fb + (j * y_step);
+			unsigned char* b = buf + (j * pitch);
+			if (to_fb) {
+				memcpy(f, b, (size_t)(w * size));
+			} else {
+				memcpy(b, f, (size_t)(w * size));
+			}
+		}
+	} else if (x_step == -size) {
+		// UD: view rows are still fb rows, just backwards
+		for (unsigned short int j = 0U; j < h; j++) {
+			unsigned char* f = fb + (j * y_step);
+			unsigned char* b = buf + (j * pitch);
+			for (unsigned short int i = 0U; i < w; i++) {
+				if (to_fb) {
+					memcpy(f - (i * size), b + (i * size), size);
+				} else {
+					memcpy(b + (i * size), f - (i * size), size);
+				}
+			}
+		}
+	} else {
+		// CW & CCW: view columns are fb rows, so we transpose tile by tile,
+		// in order to always walk the fb sequentially, without thrashing the cache on the other side.
+		for (unsigned short int ty = 0U; ty < h; ty = (unsigned short int) (ty + ROTATE_TILE)) {
+			unsigned short int th = (unsigned short int) MIN(ROTATE_TILE, (unsigned int) (h - ty));
+			for (unsigned short int tx = 0U; tx < w; tx = (unsigned short int) (tx + ROTATE_TILE)) {
+				unsigned short int tw = (unsigned short int) MIN(ROTATE_TILE, (unsigned int) (w - tx));
+				for (unsigned short int i = tx; i < tx + tw; i++) {
+					// A view column is a (partial) fb row
+					unsigned char* f = fb + (i * x_step) + (ty * y_step);
+					unsigned char* b = buf + (ty * pitch) + (i * size);
+					for (unsigned short int k = 0U; k < th; k++) {
+						if (to_fb) {
+							memcpy(f + (k * y_step), b + (k * pitch), size);
+						} else {
+							memcpy(b + (k * pitch), f + (k * y_step), size);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+// Blit a block of pixels in the fb's pixel format to the view @ (x, y), honoring its rotation
+static void
+    blit_rotated(const unsigned char* src,
+		 size_t               pitch,
+		 unsigned short int   x,
+		 unsigned short int   y,
+		 unsigned short int   w,
+		 unsigned short int   h)
+{
+	// NOTE: We never write to src, we just share the kernels with grab_rotated ;).
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+	unsigned char* buf = (unsigned char*) src;
+#pragma GCC diagnostic pop
+	damage_view_rect(x, y, w, h);
+	switch (viewRotation.pixel_size) {
+		case 1U:
+			transfer_rotated(buf, pitch, x, y, w, h, 1U, true);
+			break;
+		case 2U:
+			transfer_rotated(buf, pitch, x, y, w, h, 2U, true);
+			break;
+		case 3U:
+			transfer_rotated(buf, pitch, x, y, w, h, 3U, true);
+			break;
+		case 4U:
+		default:
+			transfer_rotated(buf, pitch, x, y, w, h, 4U, true);
+			break;
+	}
+}
+
+// Move h full-width rows of pixels from view row src_y to view row dst_y (overlaps are fine), honoring its rotation
+// NOTE: Used to scroll the console (c.f., fbink_console.c).
+static void
+    move_view_rows(unsigned short int dst_y, unsigned short int src_y, unsigned short int h)
+{
+	if (h == 0U) {
+		return;
+	}
+	damage_view_rect(0U, dst_y, (unsigned short int) screenWidth, h);
+
+	// Start from whichever end of the span comes first in memory
+	const ptrdiff_t first = viewRotation.y_step > 0 ? 0 : (ptrdiff_t) h - 1;
+	const ptrdiff_t pitch = (ptrdiff_t) fInfo.line_length;
+	ptrdiff_t       dst   = viewRotation.origin + ((ptrdiff_t) dst_y + first) * viewRotation.y_step;
+	ptrdiff_t       src   = viewRotation.origin + ((ptrdiff_t) src_y + first) * viewRotation.y_step;
+
+	if (viewRotation.y_step == pitch || viewRotation.y_step == -pitch) {
+		// View rows are fb rows, so that's a single memmove of whole fb rows ;).
+		dst -= dst % pitch;
+		src -= src % pitch;
+		memmove(fbPtr + dst, fbPtr + src, (size_t) h * fInfo.line_length);
+	} else {
+		// View rows are fb columns, so, move the same strip of every fb row.
+		const size_t len = (size_t) h * viewRotation.pixel_size;
+		for (unsigned short int x = 0U; x < screenWidth; x++) {
+			memmove(fbPtr + dst, fbPtr + src, len);
+			dst += viewRotation.x_step;
+			src += viewRotation.x_step;
+		}
+	}
+}
+
+#if defined(FBINK_WITH_IMAGE) || defined(FBINK_WITH_OPENTYPE) || defined(FBINK_WITH_BUTTON_SCAN)
+// Read a block of pixels in the fb's pixel format from the view @ (x, y), honoring its rotation
+// NOTE: Only needed for blending (i.e., alpha in fbink_print_image, and antialiasing in fbink_print_ot),
+//       and to look for buttons (c.f., fbink_button_scan) ;).
+static void
+    grab_rotated(unsigned char*     dst,
+		 size_t             pitch,
+		 unsigned short int x,
+		 unsigned short int y,
+		 unsigned short int w,
+		 unsigned short int h)
+{
+	switch (viewRotation.pixel_size) {
+		case 1U:
+			transfer_rotated(dst, pitch, x, y, w, h, 1U, false);
+			break;
+		case 2U:
+			transfer_rotated(dst, pitch, x, y, w, h, 2U, false);
+			break;
+		case 3U:
+			transfer_rotated(dst, pitch, x, y, w, h, 3U, false);
+			break;
+		case 4U:
+		default:
+			transfer_rotated(dst, pitch, x, y, w, h, 4U, false);
+			break;
+	}
+}
+#endif    // FBINK_WITH_IMAGE || FBINK_WITH_OPENTYPE || FBINK_WITH_BUTTON_SCAN
@@ -0,0 +1,64 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_ROTATE_H
+#define __FBINK_ROTATE_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// Size of the square tiles the transposing blitters work with, in pixels.
+// NOTE: At 16bpp, a 16x16 tile spans 16 rows of 32 bytes on both sides of the transpose,
+//       which keeps everything we touch nicely cache-hot, instead of striding through the fb one pixel per row ;).
+#define ROTATE_TILE 16U
+
+// How our view maps to the fb's memory (c.f., set_view_rotation)
+FBInkViewRotation viewRotation = { 0 };
+
+static void set_view_rotation(uint32_t);
+static void rotate_area(unsigned short int*, unsigned short int*, unsigned short int*, unsigned short int*);
+static void rotate_region(struct mxcfb_rect*);
+static inline __attribute__((always_inline)) void transfer_rotated(unsigned char*,
+								   size_t,
+								   unsigned short int,
+								   unsigned short int,
+								   unsigned short int,
+								   unsigned short int,
+								   uint8_t,
+								   bool);
+static void blit_rotated(const unsigned char*,
+			 size_t,
+			 unsigned short int,
+			 unsigned short int,
+			 unsigned short int,
+			 unsigned short int);
+static void move_view_rows(unsigned short int, unsigned short int, unsigned short int);
+#if defined(FBINK_WITH_IMAGE) || defined(FBINK_WITH_OPENTYPE) || defined(FBINK_WITH_BUTTON_SCAN)
+static void grab_rotated(unsigned char*,
+			 size_t,
+			 unsigned short int,
+			 unsigned short int,
+			 unsigned short int,
+			 unsigned short int);
+#endif
+
+#endif
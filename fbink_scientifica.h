@@ -25,13 +25,22 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/scientifica.h"
-#include "fonts/scientificab.h"
-#include "fonts/scientificai.h"
-
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const unsigned char* scientifica_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* scientificab_get_bitmap(uint32_t codepoint) __attribute__((const));
-static const unsigned char* scientificai_get_bitmap(uint32_t codepoint) __attribute__((const));
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/scientifica.h"
+#	include "fonts/subset/scientificai.h"
+#else
+#	include "fonts/scientifica.h"
+#	include "fonts/scientificai.h"
+#endif
+
+#ifdef FBINK_WITH_FONT_SCIENTIFICA
+static bool scientifica_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_SCIENTIFICAB
+static bool scientificab_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_SCIENTIFICAI
+static bool scientificai_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
@@ -0,0 +1,324 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_shadow.h"
+
+// Shadow rendering: the fb mapping is usually uncached (or write-combined) on these SoCs,
+// so reading from it (for overlay text, or alpha-blending) is *slow*.
+// When enabled (c.f., FBInkConfig's use_shadow), fbPtr points to a malloc'd copy of the fb instead,
+// so that every read & write we do hits cached memory,
+// and we only copy the spans we've touched to the actual fb, in order, right before a refresh.
+// NOTE: This assumes we're the only ones drawing to the fb!
+//       The shadow is only synced with the fb on the first mmap after fbink_init (and before a button scan),
+//       so anything drawn behind our back in the meantime will be ignored by overlay/alpha-blending,
+//       and may be clobbered by our next flush (but only inside the spans we've drawn to).
+// With use_diff, we also keep a copy of what we last pushed to the fb (frontPtr), so that flushing only writes
+// the bytes that actually changed, and we can shrink the refresh region to those (c.f., commit_region).
+
+// Allocate (or release) the shadow (& front) buffers, according to the fb's current layout
+static int
+    setup_shadow(bool enable, bool diff)
+{
+	// NOTE: Anything we haven't flushed yet is lost (which only happens if something went wrong before a refresh).
+	if (!enable || !diff) {
+		free(frontPtr);
+		frontPtr = NULL;
+	}
+	if (!enable) {
+		free(shadowPtr);
+		shadowPtr = NULL;
+		free(dirtyStart);
+		dirtyStart = NULL;
+		free(dirtyEnd);
+		dirtyEnd = NULL;
+		if (isFbMapped) {
+			fbPtr = fbMapPtr;
+		}
+		return EXIT_SUCCESS;
+	}
+
+	// NOTE: The fb's layout may have changed since the last time we were called (rotation, bpp switch...),
+	//       so always start from scratch.
+	unsigned char* shadow = realloc(shadowPtr, fInfo.smem_len);
+	if (shadow == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] realloc (shadow): %s\n", errstr);
+		setup_shadow(false, false);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	shadowPtr = shadow;
+
+	if (diff) {
+		unsigned char* front = realloc(frontPtr, fInfo.smem_len);
+		if (front == NULL) {
+			char  buf[256];
+			char* errstr = strerror_r(errno, buf, sizeof(buf));
+			fprintf(stderr, "[FBInk] realloc (front): %s\n", errstr);
+			setup_shadow(false, false);
+			return ERRCODE(EXIT_FAILURE);
+		}
+		frontPtr = front;
+	}
+
+	uint32_t* span = realloc(dirtyStart, vInfo.yres * sizeof(*dirtyStart));
+	if (span == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] realloc (dirty spans): %s\n", errstr);
+		setup_shadow(false, false);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	dirtyStart = span;
+	span       = realloc(dirtyEnd, vInfo.yres * sizeof(*dirtyEnd));
+	if (span == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] realloc (dirty spans): %s\n", errstr);
+		setup_shadow(false, false);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	dirtyEnd = span;
+
+	// Nothing's dirty yet
+	for (uint32_t y = 0U; y < vInfo.yres; y++) {
+		dirtyStart[y] = UINT32_MAX;
+		dirtyEnd[y]   = 0U;
+	}
+	dirtyTop    = vInfo.yres;
+	dirtyBottom = 0U;
+
+	// We'll have to catch up with the fb's content
+	isShadowSync = false;
+	if (isFbMapped) {
+		attach_shadow();
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// Point fbPtr to the right buffer after a mmap
+static void
+    attach_shadow(void)
+{
+	if (!shadowPtr) {
+		fbPtr = fbMapPtr;
+		return;
+	}
+
+	if (!isShadowSync) {
+		sync_shadow();
+	}
+	fbPtr = shadowPtr;
+}
+
+// Catch up with the fb's content, in one sequential pass
+static void
+    sync_shadow(void)
+{
+	memcpy(shadowPtr, fbMapPtr, fInfo.smem_len);
+	if (frontPtr) {
+		memcpy(frontPtr, shadowPtr, fInfo.smem_len);
+	}
+	isShadowSync = true;
+}
+
+// Remember that we've drawn to a rectangle of the shadow (in fb coordinates, c.f., damage_rect)
+static void
+    damage_rows(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+	// NOTE: Clamp to the visible screen, that's all we ever flush (c.f., fullscreen_region).
+	const uint32_t top    = MIN(y, vInfo.yres);
+	const uint32_t bottom = MIN(y + h, vInfo.yres);
+	const uint32_t left   = MIN(x, vInfo.xres);
+	const uint32_t right  = MIN(x + w, vInfo.xres);
+	if (top >= bottom || left >= right) {
+		return;
+	}
+
+	// Convert the pixel span to bytes, rounding outwards to full bytes on 4bpp fbs.
+	// NOTE: If we reach the right edge, take the row's padding along, too (i.e., so a screen clear is flushed as-is).
+	const uint32_t start = (left * vInfo.bits_per_pixel) >> 3U;
+	const uint32_t end   = (right == vInfo.xres) ? fInfo.line_length : ((right * vInfo.bits_per_pixel) + 7U) >> 3U;
+	for (uint32_t cy = top; cy < bottom; cy++) {
+		dirtyStart[cy] = MIN(dirtyStart[cy], start);
+		dirtyEnd[cy]   = MAX(dirtyEnd[cy], end);
+	}
+	dirtyTop    = MIN(dirtyTop, top);
+	dirtyBottom = MAX(dirtyBottom, bottom);
+}
+
+// Called by every function that writes to fbPtr, with the rectangle it writes to (in fb coordinates),
+// so that we flush exactly what was drawn, whatever the refresh region ends up being.
+// NOTE: Inlined, so that it only costs a branch when we're drawing to the fb directly.
+static inline __attribute__((always_inline)) void
+    damage_rect(uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+	if (shadowPtr) {
+		damage_rows(x, y, w, h);
+	}
+}
+
+// Same, but for a rectangle in view coordinates (c.f., rotate_area)
+static inline __attribute__((always_inline)) void
+    damage_view_rect(unsigned short int x, unsigned short int y, unsigned short int w, unsigned short int h)
+{
+	if (shadowPtr) {
+		rotate_area(&x, &y, &w, &h);
+		damage_rows(x, y, w, h);
+	}
+}
+
+// Push the dirty spans to the fb (i.e., right before a refresh).
+// If we can tell (c.f., use_diff), returns true, and stores the bounding box of the pixels that actually changed
+// in changed (in fb coordinates, zero-sized if nothing did).
+static bool
+    flush_shadow(struct mxcfb_rect* changed)
+{
+	if (!shadowPtr || !isFbMapped) {
+		return false;
+	}
+
+	LOG("Flushing shadow rows %u to %u", dirtyTop, dirtyBottom);
+	uint32_t min_x = UINT32_MAX;
+	uint32_t max_x = 0U;
+	uint32_t min_y = UINT32_MAX;
+	uint32_t max_y = 0U;
+	for (uint32_t y = dirtyTop; y < dirtyBottom; y++) {
+		if (dirtyStart[y] < dirtyEnd[y]) {
+			const size_t offset = (y * fInfo.line_length) + dirtyStart[y];
+			size_t       len    = dirtyEnd[y] - dirtyStart[y];
+			if (frontPtr) {
+				// Only push the bytes that differ from what's already on the fb
+				const unsigned char* s = shadowPtr + offset;
+				unsigned char*       f = frontPtr + offset;
+				if (memcmp(s, f, len) != 0) {
+					size_t lo = 0U;
+					while (s[lo] == f[lo]) {
+						lo++;
+					}
+					while (s[len - 1U] == f[len - 1U]) {
+						len--;
+					}
+					memcpy(fbMapPtr + offset + lo, s + lo, len - lo);
+					memcpy(f + lo, s + lo, len - lo);
+
+					min_x = MIN(min_x, (uint32_t)(dirtyStart[y] + lo));
+					max_x = MAX(max_x, (uint32_t)(dirtyStart[y] + len));
+					min_y = MIN(min_y, y);
+					max_y = MAX(max_y, y);
+				}
+			} else {
+				memcpy(fbMapPtr + offset, shadowPtr + offset, len);
+			}
+		}
+		dirtyStart[y] = UINT32_MAX;
+		dirtyEnd[y]   = 0U;
+	}
+	dirtyTop    = vInfo.yres;
+	dirtyBottom = 0U;
+
+	if (!frontPtr || !changed) {
+		return false;
+	}
+
+	if (min_y > max_y) {
+		changed->top    = 0U;
+		changed->left   = 0U;
+		changed->width  = 0U;
+		changed->height = 0U;
+	} else {
+		// Back to pixels, rounding outwards
+		const uint32_t bpp   = vInfo.bits_per_pixel;
+		const uint32_t left  = (min_x << 3U) / bpp;
+		const uint32_t right = MIN(((max_x << 3U) + bpp - 1U) / bpp, vInfo.xres);
+		changed->top         = min_y;
+		changed->left        = left;
+		changed->width       = right - left;
+		changed->height      = max_y + 1U - min_y;
+	}
+	return true;
+}
+
+// Shrink region to the part of it that actually changed (c.f., flush_shadow).
+// Returns false if nothing did.
+static bool
+    shrink_region(struct mxcfb_rect* region, const struct mxcfb_rect* changed)
+{
+	const uint32_t left   = MAX(region->left, changed->left);
+	const uint32_t top    = MAX(region->top, changed->top);
+	const uint32_t right  = MIN(region->left + region->width, changed->left + changed->width);
+	const uint32_t bottom = MIN(region->top + region->height, changed->top + changed->height);
+	if (left >= right || top >= bottom) {
+		LOG("Nothing changed in region (%u, %u) %ux%u", region->left, region->top, region->width, region->height);
+		return false;
+	}
+
+	struct mxcfb_rect shrunk = { .top = top, .left = left, .width = right - left, .height = bottom - top };
+	// NOTE: Some devices choke on 1xN or Nx1 regions (c.f., refresh), so make sure we're at least 2x2.
+	if (shrunk.width < 2U) {
+		shrunk.left  = MIN(shrunk.left, vInfo.xres - 2U);
+		shrunk.width = 2U;
+	}
+	if (shrunk.height < 2U) {
+		shrunk.top    = MIN(shrunk.top, vInfo.yres - 2U);
+		shrunk.height = 2U;
+	}
+	LOG("Shrinking refresh region from (%u, %u) %ux%u to (%u, %u) %ux%u",
+	    region->left,
+	    region->top,
+	    region->width,
+	    region->height,
+	    shrunk.left,
+	    shrunk.top,
+	    shrunk.width,
+	    shrunk.height);
+	*region = shrunk;
+
+	return true;
+}
+
+#ifdef FBINK_WITH_BUTTON_SCAN
+// Temporarily draw to (and, more importantly, read from) the fb itself
+static void
+    bypass_shadow(void)
+{
+	if (!shadowPtr || !isFbMapped) {
+		return;
+	}
+
+	flush_shadow(NULL);
+	fbPtr = fbMapPtr;
+}
+
+// And go back to the shadow buffer, which is now stale
+static void
+    restore_shadow(void)
+{
+	if (!shadowPtr) {
+		return;
+	}
+
+	isShadowSync = false;
+	if (isFbMapped) {
+		attach_shadow();
+	}
+}
+#endif
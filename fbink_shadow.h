@@ -0,0 +1,53 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_SHADOW_H
+#define __FBINK_SHADOW_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// A cached copy of the fb we render to instead of the fb itself (c.f., fbink_shadow.c)
+unsigned char* shadowPtr    = NULL;
+bool           isShadowSync = false;
+// A cached copy of what we last pushed to the fb, so we can tell what actually changed (c.f., use_diff)
+unsigned char* frontPtr = NULL;
+// Per-row dirty spans, as [start, end) byte offsets in a fb row, and the range of rows that may have some.
+uint32_t* dirtyStart  = NULL;
+uint32_t* dirtyEnd    = NULL;
+uint32_t  dirtyTop    = 0U;
+uint32_t  dirtyBottom = 0U;
+
+static int         setup_shadow(bool, bool);
+static void        attach_shadow(void);
+static void        sync_shadow(void);
+static void        damage_rows(uint32_t, uint32_t, uint32_t, uint32_t);
+static inline void damage_rect(uint32_t, uint32_t, uint32_t, uint32_t);
+static inline void damage_view_rect(unsigned short int, unsigned short int, unsigned short int, unsigned short int);
+static bool        flush_shadow(struct mxcfb_rect*);
+static bool        shrink_region(struct mxcfb_rect*, const struct mxcfb_rect*);
+#ifdef FBINK_WITH_BUTTON_SCAN
+static void bypass_shadow(void);
+static void restore_shadow(void);
+#endif
+
+#endif
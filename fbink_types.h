@@ -22,6 +22,7 @@
 #define __FBINK_TYPES_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // List of flags for device or screen-specific quirks...
@@ -126,4 +127,172 @@ typedef union
 	} color;
 } FBInkPixelBGR;
 
+// The different ways we can render a glyph (c.f., draw)
+typedef enum
+{
+	GLYPH_MODE_BG = 0U,    // Both fg & bg pixels
+	GLYPH_MODE_BGLESS,     // Only fg pixels
+	GLYPH_MODE_OVERLAY,    // Only fg pixels, inverting what's already on screen
+	GLYPH_MODE_MAX,        // Number of modes
+} GLYPH_MODE_E;
+
+// Glyph renderers, specialized for a bpp (& rotation quirk) and a rendering mode (c.f., render_glyph)
+typedef void (*FBInkGlyphRenderer)(const uint32_t*,
+				   unsigned short int,
+				   unsigned short int,
+				   const FBInkColor*,
+				   const FBInkColor*);
+
+// Maps a font's codepoints to indices in its array of glyphs, in chunks of 64 codepoints (c.f., font_glyph_index)
+typedef struct
+{
+	const uint16_t* chunks;         // For each chunk, an index in coverage & ranks (0 means nothing is covered)
+	const uint64_t* coverage;       // For each chunk, a bitmap of which of its codepoints are covered
+	const uint16_t* ranks;          // For each chunk, the glyph index of its first covered codepoint
+	size_t          chunk_count;    // Everything past that isn't covered
+} FBInkGlyphMap;
+
+// A bit-packed font, as built by tools/hextoc.py (c.f., font_get_glyph)
+typedef struct
+{
+	FBInkGlyphMap   map;
+	const uint16_t* ids;            // Glyph index to bitmap index, when bitmaps are shared (NULL if they're 1:1)
+	const uint8_t*  bitmaps;        // Rows of width bits, LSB first, with each bitmap starting on a byte boundary
+	uint8_t         width;
+	uint8_t         height;
+	uint8_t         bitmap_size;    // In bytes
+} FBInkFont;
+
+// The header of an FBInk font file, as built by tools/mkfont.py (c.f., fbink_user_fonts.c)
+// NOTE: Everything is little-endian, and offsets are from the start of the file.
+typedef struct
+{
+	char     magic[8];           // FBInkFnt
+	uint32_t version;            // 1
+	uint8_t  width;
+	uint8_t  height;
+	uint8_t  bitmap_size;        // In bytes
+	uint8_t  reserved;
+	uint32_t chunk_count;
+	uint32_t coverage_count;     // Also the number of ranks
+	uint32_t glyph_count;
+	uint32_t bitmap_count;
+	uint32_t chunks_offset;      // uint16_t[chunk_count]
+	uint32_t coverage_offset;    // uint64_t[coverage_count], 8 bytes aligned
+	uint32_t ranks_offset;       // uint16_t[coverage_count]
+	uint32_t ids_offset;         // uint16_t[glyph_count], 0 if bitmaps are 1:1
+	uint32_t bitmaps_offset;     // uint8_t[bitmap_count * bitmap_size]
+} FBInkFontFileHeader;
+
+// A font file we've mapped (c.f., fbink_register_font)
+typedef struct
+{
+	FBInkFont font;    // Pointing straight into our mapping
+	void*     data;
+	size_t    size;
+	char*     name;
+} FBInkUserFont;
+
+// Unpacks a font's glyph for a specific Unicode codepoint, as rows of width bits wide masks.
+// Returns false if the font doesn't cover that codepoint (in which case that's the font's fallback glyph).
+typedef bool (*FBInkGlyphGetter)(uint32_t, uint32_t*);
+
+// A font in our fallback chain (c.f., fbink_fallback.c)
+typedef struct
+{
+	FBInkGlyphGetter get_glyph;    // Builtin fonts
+	const FBInkFont* font;         // Registered fonts (when get_glyph is NULL)
+	uint8_t          fontname;     // FONT_INDEX_T
+	uint8_t          width;
+	uint8_t          height;
+	uint8_t          x_offs;       // Where its glyphs sit in the first font's cells
+	uint8_t          y_offs;
+} FBInkFontLink;
+
+#ifdef FBINK_WITH_OPENTYPE
+// An OpenType font we've mapped (c.f., fbink_add_ot_font)
+// NOTE: Relies on fbink_internal.h having pulled in stb_truetype's declarations first.
+typedef struct
+{
+	stbtt_fontinfo info;    // Pointing straight into our mapping
+	void*          data;
+	size_t         size;
+} FBInkOTFont;
+
+// An OpenType glyph, rasterized at a specific size (c.f., fbink_ot.c)
+typedef struct
+{
+	uint32_t size;        // In 1/64th of a pixel (0 means this slot is free)
+	uint32_t offset;      // Of its coverage in otAtlas (width * height gray levels, from 0 to 15)
+	int      glyph;       // Glyph index in the font
+	uint16_t width;
+	uint16_t height;
+	int16_t  x_offs;      // From the pen position to its left edge
+	int16_t  y_offs;      // From the baseline to its top edge
+} FBInkOTGlyph;
+#endif
+
+// A glyph, pre-rendered in the fb's pixel format (c.f., fbink_glyph_cache.c)
+typedef struct
+{
+	unsigned char*     data;             // glyphHeight rows of pitch bytes (i.e., unscaled vertically)
+	size_t             size;             // pitch * glyphHeight
+	size_t             pitch;            // Size of a row, in bytes
+	uint32_t           codepoint;
+	uint32_t           fg;               // Packed fg pixel
+	uint32_t           bg;               // Packed bg pixel
+	unsigned short int width;            // FONTW
+	uint16_t           bucket;           // Our hash bucket
+	uint16_t           hash_next;        // Next tile in our hash bucket
+	uint16_t           lru_prev;         // Previous (i.e., more recently used) tile
+	uint16_t           lru_next;         // Next (i.e., less recently used) tile
+	uint8_t            font;
+	uint8_t            fontsize_mult;
+	uint8_t            bpp;
+	uint8_t            phase;            // On 4bpp fbs, whether the first pixel is on the low nibble
+} FBInkGlyphTile;
+
+// A line of text, as laid out by fbink_print, before padding
+typedef struct
+{
+	unsigned int pos;    // Index of its first codepoint
+	unsigned int len;    // In codepoints
+} FBInkLineSpan;
+
+// What a byte means as the start of an UTF-8 sequence (c.f., utf8Leads)
+typedef struct
+{
+	uint8_t need;    // How many continuation bytes follow
+	uint8_t mask;    // What's left of the payload in the lead byte
+	uint8_t lo;      // Bounds of the first continuation byte
+	uint8_t hi;
+} FBInkUTF8Lead;
+
+// How our view maps to the fb's memory, whatever its rotation (c.f., fbink_rotate.c)
+typedef struct
+{
+	ptrdiff_t origin;        // Offset of the view's (0, 0) pixel, in bytes
+	ptrdiff_t x_step;        // Offset between (x, y) & (x + 1, y), in bytes
+	ptrdiff_t y_step;        // Offset between (x, y) & (x, y + 1), in bytes
+	uint32_t  rotate;        // FB_ROTATE_*
+	uint32_t  pixel_size;    // In bytes
+} FBInkViewRotation;
+
+// A refresh we've put off until fbink_commit (c.f., fbink_batch.c)
+// NOTE: Relies on fbink_internal.h having pulled in the right mxcfb header first.
+typedef struct
+{
+	struct mxcfb_rect region;           // In fb coordinates
+	uint32_t          waveform_mode;    // WAVEFORM_MODE_*
+	bool              is_flashing;
+} FBInkBatchRegion;
+
+// A cell of a grid of text (c.f., fbink_console.c & fbink_grid.c)
+typedef struct
+{
+	uint32_t codepoint;    // 0 means nothing (as opposed to a blank)
+	uint8_t  fg;           // Gray level, like penFGColor
+	uint8_t  bg;           // Gray level, like penBGColor
+} FBInkCell;
+
 #endif
@@ -25,19 +25,31 @@
 #include "fbink.h"
 #include "fbink_internal.h"
 
-#include "fonts/alt.h"
-#include "fonts/fantasy.h"
-#include "fonts/mcr.h"
-#include "fonts/tall.h"
-#include "fonts/thin.h"
-#include "fonts/unscii.h"
-
-// NOTE: Should technically be pure, but we can get away with const, according to https://lwn.net/Articles/285332/
-static const unsigned char* unscii_get_bitmap(uint32_t) __attribute__((const));
-static const unsigned char* alt_get_bitmap(uint32_t) __attribute__((const));
-static const unsigned char* thin_get_bitmap(uint32_t) __attribute__((const));
-static const unsigned char* fantasy_get_bitmap(uint32_t) __attribute__((const));
-static const unsigned char* mcr_get_bitmap(uint32_t) __attribute__((const));
-static const unsigned char* tall_get_bitmap(uint32_t) __attribute__((const));
+#ifdef FBINK_FONTS_SUBSET
+#	include "fonts/subset/tall.h"
+#	include "fonts/subset/unscii.h"
+#else
+#	include "fonts/tall.h"
+#	include "fonts/unscii.h"
+#endif
+
+#ifdef FBINK_WITH_FONT_UNSCII
+static bool unscii_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_UNSCII_ALT
+static bool alt_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_UNSCII_THIN
+static bool thin_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_UNSCII_FANTASY
+static bool fantasy_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_UNSCII_MCR
+static bool mcr_get_glyph(uint32_t, uint32_t*);
+#endif
+#ifdef FBINK_WITH_FONT_UNSCII_TALL
+static bool tall_get_glyph(uint32_t, uint32_t*);
+#endif
 
 #endif
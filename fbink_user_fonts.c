@@ -0,0 +1,212 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_user_fonts.h"
+
+// External font files: the exact same layout as our builtin fonts (c.f., font_get_glyph), but in a file we mmap,
+// so that we don't pay for fonts (or glyphs!) we don't use. That's nice for the larger CJK fonts ;).
+// NOTE: The format is little-endian, which is what everything we run on is, so we just point straight into the mapping.
+
+#ifdef FBINK_WITH_FONTS
+// Check that count elements of elem_size bytes starting at offset fit in a file of size bytes
+static bool
+    is_in_file(uint64_t offset, uint64_t count, size_t elem_size, size_t size)
+{
+	return (offset <= size && count * elem_size <= size - offset);
+}
+
+// Map & validate font->name, and setup font->font to point into that mapping
+// NOTE: We check everything a lookup might use to index into the file,
+//       so that a corrupted font can only ever give us garbled glyphs, and not a SIGBUS.
+static int
+    load_font_file(FBInkUserFont* font)
+{
+	int fd = open(font->name, O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] open (%s): %s\n", font->name, errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == -1) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] fstat (%s): %s\n", font->name, errstr);
+		close(fd);
+		return ERRCODE(EXIT_FAILURE);
+	}
+	if ((size_t) st.st_size < sizeof(FBInkFontFileHeader)) {
+		fprintf(stderr, "[FBInk] %s is not an FBInk font file!\n", font->name);
+		close(fd);
+		return ERRCODE(EINVAL);
+	}
+
+	// NOTE: The mapping outlives the fd just fine.
+	font->size = (size_t) st.st_size;
+	font->data = mmap(NULL, font->size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (font->data == MAP_FAILED) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] mmap (%s): %s\n", font->name, errstr);
+		font->data = NULL;
+		return ERRCODE(EXIT_FAILURE);
+	}
+	// Lookups are all over the place, don't bother with readahead
+	madvise(font->data, font->size, MADV_RANDOM);
+
+	const unsigned char*       data = (const unsigned char*) font->data;
+	const FBInkFontFileHeader* hdr  = (const FBInkFontFileHeader*) font->data;
+	if (memcmp(hdr->magic, FONT_FILE_MAGIC, sizeof(hdr->magic)) != 0) {
+		fprintf(stderr, "[FBInk] %s is not an FBInk font file!\n", font->name);
+		goto invalid;
+	}
+	if (hdr->version != FONT_FILE_VERSION) {
+		fprintf(stderr, "[FBInk] %s: unsupported font file version %u!\n", font->name, hdr->version);
+		goto invalid;
+	}
+	if (hdr->width == 0U || hdr->width > 32U || hdr->height == 0U || hdr->height > GLYPH_MAX_HEIGHT ||
+	    hdr->bitmap_size != (hdr->width * hdr->height + 7U) / 8U) {
+		fprintf(stderr, "[FBInk] %s: unsupported glyph size (%hhux%hhu)!\n", font->name, hdr->width, hdr->height);
+		goto invalid;
+	}
+	// NOTE: Every index is an uint16_t, and glyph 0 is what we fall back to for unknown codepoints.
+	if (hdr->chunk_count == 0U || hdr->coverage_count == 0U || hdr->coverage_count > (UINT16_MAX + 1U) ||
+	    hdr->glyph_count == 0U || hdr->glyph_count > (UINT16_MAX + 1U) || hdr->bitmap_count == 0U ||
+	    hdr->bitmap_count > (UINT16_MAX + 1U)) {
+		fprintf(stderr, "[FBInk] %s: invalid glyph count!\n", font->name);
+		goto invalid;
+	}
+	if ((hdr->chunks_offset | hdr->ranks_offset | hdr->ids_offset) & 1U || hdr->coverage_offset & 7U ||
+	    !is_in_file(hdr->chunks_offset, hdr->chunk_count, sizeof(uint16_t), font->size) ||
+	    !is_in_file(hdr->coverage_offset, hdr->coverage_count, sizeof(uint64_t), font->size) ||
+	    !is_in_file(hdr->ranks_offset, hdr->coverage_count, sizeof(uint16_t), font->size) ||
+	    (hdr->ids_offset && !is_in_file(hdr->ids_offset, hdr->glyph_count, sizeof(uint16_t), font->size)) ||
+	    !is_in_file(hdr->bitmaps_offset, hdr->bitmap_count, hdr->bitmap_size, font->size)) {
+		fprintf(stderr, "[FBInk] %s is truncated or corrupted!\n", font->name);
+		goto invalid;
+	}
+
+	font->font.map.chunks      = (const uint16_t*) (data + hdr->chunks_offset);
+	font->font.map.coverage    = (const uint64_t*) (data + hdr->coverage_offset);
+	font->font.map.ranks       = (const uint16_t*) (data + hdr->ranks_offset);
+	font->font.map.chunk_count = hdr->chunk_count;
+	font->font.ids             = hdr->ids_offset ? (const uint16_t*) (data + hdr->ids_offset) : NULL;
+	font->font.bitmaps         = data + hdr->bitmaps_offset;
+	font->font.width           = hdr->width;
+	font->font.height          = hdr->height;
+	font->font.bitmap_size     = hdr->bitmap_size;
+
+	// Make sure every lookup lands on a glyph, and every glyph on a bitmap.
+	// NOTE: That does touch the whole map, but not the bitmaps, which is where the bulk of the data lives.
+	for (uint32_t i = 0U; i < hdr->chunk_count; i++) {
+		if (font->font.map.chunks[i] >= hdr->coverage_count) {
+			fprintf(stderr, "[FBInk] %s: invalid chunk index!\n", font->name);
+			goto invalid;
+		}
+	}
+	for (uint32_t i = 0U; i < hdr->coverage_count; i++) {
+		if ((uint32_t) font->font.map.ranks[i] + (uint32_t) __builtin_popcountll(font->font.map.coverage[i]) >
+		    hdr->glyph_count) {
+			fprintf(stderr, "[FBInk] %s: invalid glyph rank!\n", font->name);
+			goto invalid;
+		}
+	}
+	if (font->font.ids) {
+		for (uint32_t i = 0U; i < hdr->glyph_count; i++) {
+			if (font->font.ids[i] >= hdr->bitmap_count) {
+				fprintf(stderr, "[FBInk] %s: invalid bitmap index!\n", font->name);
+				goto invalid;
+			}
+		}
+	} else if (hdr->glyph_count > hdr->bitmap_count) {
+		fprintf(stderr, "[FBInk] %s: missing bitmaps!\n", font->name);
+		goto invalid;
+	}
+
+	return EXIT_SUCCESS;
+
+invalid:
+	munmap(font->data, font->size);
+	font->data = NULL;
+	font->size = 0U;
+	return ERRCODE(EINVAL);
+}
+
+// Returns the registered font matching a fontname, if any
+static const FBInkUserFont*
+    get_user_font(uint8_t fontname)
+{
+	if (fontname < USER_FONT || fontname - USER_FONT >= userFontsCount) {
+		return NULL;
+	}
+	return &userFonts[fontname - USER_FONT];
+}
+#endif    // FBINK_WITH_FONTS
+
+// Register an external font file
+int
+    fbink_register_font(const char* filename UNUSED_BY_MINIMAL)
+{
+#ifdef FBINK_WITH_FONTS
+	// NOTE: Canonicalize the path, so that we don't map the same file twice
+	char* path = realpath(filename, NULL);
+	if (path == NULL) {
+		char  buf[256];
+		char* errstr = strerror_r(errno, buf, sizeof(buf));
+		fprintf(stderr, "[FBInk] realpath (%s): %s\n", filename, errstr);
+		return ERRCODE(EXIT_FAILURE);
+	}
+
+	for (uint8_t i = 0U; i < userFontsCount; i++) {
+		if (strcmp(userFonts[i].name, path) == 0) {
+			free(path);
+			return USER_FONT + i;
+		}
+	}
+
+	if (userFontsCount >= MAX_USER_FONTS) {
+		fprintf(stderr, "[FBInk] Can't register more than %u fonts!\n", MAX_USER_FONTS);
+		free(path);
+		return ERRCODE(ENOSPC);
+	}
+
+	FBInkUserFont* font = &userFonts[userFontsCount];
+	font->name          = path;
+	int rv              = load_font_file(font);
+	if (rv != EXIT_SUCCESS) {
+		free(path);
+		font->name = NULL;
+		return rv;
+	}
+
+	LOG("Registered font %s (%hhux%hhu) as %d",
+	    font->name,
+	    font->font.width,
+	    font->font.height,
+	    USER_FONT + userFontsCount);
+	return USER_FONT + userFontsCount++;
+#else
+	fprintf(stderr, "[FBInk] Custom fonts are disabled in this FBInk build!\n");
+	return ERRCODE(ENOSYS);
+#endif    // FBINK_WITH_FONTS
+}
@@ -0,0 +1,44 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_USER_FONTS_H
+#define __FBINK_USER_FONTS_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+#ifdef FBINK_WITH_FONTS
+// How many font files we can register
+#	define MAX_USER_FONTS 16U
+// Our font file format (c.f., FBInkFontFileHeader & tools/mkfont.py)
+#	define FONT_FILE_MAGIC "FBInkFnt"
+#	define FONT_FILE_VERSION 1U
+
+// The fonts we've registered, in order (i.e., userFonts[0] is USER_FONT)
+FBInkUserFont userFonts[MAX_USER_FONTS] = { 0 };
+uint8_t       userFontsCount            = 0U;
+
+static bool                 is_in_file(uint64_t, uint64_t, size_t, size_t) __attribute__((const));
+static int                  load_font_file(FBInkUserFont*);
+static const FBInkUserFont* get_user_font(uint8_t);
+#endif
+
+#endif
@@ -0,0 +1,207 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_utf8.h"
+
+// A validating UTF-8 decoder, used to turn our input strings into codepoints in one go.
+// Anything invalid (stray continuation bytes, overlong forms, surrogates, truncated sequences, or anything past U+10FFFF)
+// becomes U+FFFD, with one replacement per maximal subpart (c.f., Unicode 3.9, U+FFFD Substitution of Maximal Subparts),
+// so that garbage never swallows the valid text that follows it.
+// Long enough ASCII runs skip the state machine entirely, and are widened 16 bytes at a time with NEON or SSE2.
+
+// For each byte, as the start of a sequence: how many continuation bytes it needs, what's left of its payload,
+// and the bounds of its first continuation byte, which is where overlongs, surrogates & > U+10FFFF are caught.
+// NOTE: ASCII needs nothing, and stray continuation bytes & lead bytes that can only start something invalid
+//       need a continuation byte that can never match, which saves us from special-casing either of them.
+static const FBInkUTF8Lead utf8Leads[256] = {
+	[0x00 ... 0x7F] = { 0U, 0x7FU, 0xFFU, 0x00U },
+	[0x80 ... 0xC1] = { 1U, 0x00U, 0xFFU, 0x00U },
+	[0xC2 ... 0xDF] = { 1U, 0x1FU, 0x80U, 0xBFU },
+	[0xE0]          = { 2U, 0x0FU, 0xA0U, 0xBFU },
+	[0xE1 ... 0xEC] = { 2U, 0x0FU, 0x80U, 0xBFU },
+	[0xED]          = { 2U, 0x0FU, 0x80U, 0x9FU },
+	[0xEE ... 0xEF] = { 2U, 0x0FU, 0x80U, 0xBFU },
+	[0xF0]          = { 3U, 0x07U, 0x90U, 0xBFU },
+	[0xF1 ... 0xF3] = { 3U, 0x07U, 0x80U, 0xBFU },
+	[0xF4]          = { 3U, 0x07U, 0x80U, 0x8FU },
+	[0xF5 ... 0xFF] = { 1U, 0x00U, 0xFFU, 0x00U },
+};
+
+// Decode the sequence at s (at most left bytes) to *cp, returns the amount of bytes consumed (always at least 1)
+static inline __attribute__((always_inline)) size_t
+    utf8_decode_seq(const unsigned char* s, size_t left, uint32_t* cp)
+{
+	const FBInkUTF8Lead lead = utf8Leads[s[0]];
+
+	// NOTE: A NUL is never a valid continuation byte, so we can't ever read past the end of a C string.
+	uint32_t      ch = s[0] & lead.mask;
+	unsigned char lo = lead.lo;
+	unsigned char hi = lead.hi;
+	for (size_t k = 1U; k <= lead.need; k++) {
+		if (k >= left || s[k] < lo || s[k] > hi) {
+			// Invalid or truncated sequence: flag it, and resume on the offending byte.
+			*cp = UTF8_REPLACEMENT_CHAR;
+			return k;
+		}
+		ch = (ch << 6U) | (s[k] & 0x3FU);
+		lo = 0x80U;
+		hi = 0xBFU;
+	}
+	*cp = ch;
+	return lead.need + 1U;
+}
+
+// Same as utf8_decode_seq, but expects s to start with a 0xC2-0xF4 lead byte, followed by a continuation byte,
+// which is all it takes to settle two-byte sequences, and most of what it takes for three-byte ones (i.e., the BMP).
+static inline __attribute__((always_inline)) size_t
+    utf8_decode_multi(const unsigned char* s, size_t left, uint32_t* cp)
+{
+	const uint32_t c = s[0];
+	if (c < 0xE0U) {
+		*cp = ((c & 0x1FU) << 6U) | (s[1] & 0x3FU);
+		return 2U;
+	}
+	const FBInkUTF8Lead lead = utf8Leads[c];
+	if (c < 0xF0U && left > 2U && s[1] >= lead.lo && s[1] <= lead.hi && (s[2] & 0xC0U) == 0x80U) {
+		*cp = ((c & 0x0FU) << 12U) | ((s[1] & 0x3FU) << 6U) | (s[2] & 0x3FU);
+		return 3U;
+	}
+	// Astral planes, or something invalid: leave it to the state machine
+	return utf8_decode_seq(s, left, cp);
+}
+
+// Check whether the first UTF8_ASCII_HEAD bytes of s are all ASCII
+static inline __attribute__((always_inline)) bool
+    utf8_is_ascii_head(const unsigned char* s)
+{
+	uint64_t words[UTF8_ASCII_HEAD / sizeof(uint64_t)];
+	memcpy(words, s, sizeof(words));
+	uint64_t high = 0U;
+	for (size_t k = 0U; k < sizeof(words) / sizeof(*words); k++) {
+		high |= words[k];
+	}
+	return (high & 0x8080808080808080U) == 0U;
+}
+
+// Widen the run of ASCII bytes at the start of s (at most len bytes) to dst, returns its length
+// NOTE: Expects s to start with at least UTF8_ASCII_HEAD ASCII bytes (c.f., utf8_decode).
+//       Kept out of line, as it's only worth it for long runs anyway, and it'd just get in the way of utf8_decode's loop.
+static __attribute__((noinline)) size_t
+    utf8_decode_ascii(const unsigned char* s, size_t len, uint32_t* dst)
+{
+	size_t i = 0U;
+	for (; i < UTF8_ASCII_HEAD; i++) {
+		dst[i] = s[i];
+	}
+#if defined(FBINK_UTF8_NEON)
+	const uint8x16_t high = vdupq_n_u8(0x80U);
+	for (; i + 16U <= len; i += 16U) {
+		uint8x16_t v = vld1q_u8(s + i);
+		// NOTE: No horizontal max on ARMv7, so fold the high bits down to a single 64-bit lane instead.
+		uint8x16_t h = vandq_u8(v, high);
+		uint8x8_t  m = vorr_u8(vget_low_u8(h), vget_high_u8(h));
+		if (vget_lane_u64(vreinterpret_u64_u8(m), 0) != 0U) {
+			break;
+		}
+		uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+		uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+		vst1q_u32(dst + i, vmovl_u16(vget_low_u16(lo)));
+		vst1q_u32(dst + i + 4U, vmovl_u16(vget_high_u16(lo)));
+		vst1q_u32(dst + i + 8U, vmovl_u16(vget_low_u16(hi)));
+		vst1q_u32(dst + i + 12U, vmovl_u16(vget_high_u16(hi)));
+	}
+#elif defined(FBINK_UTF8_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16U <= len; i += 16U) {
+		__m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+		int     m = _mm_movemask_epi8(v);
+		if (m != 0) {
+			// Widen what we can of this block in the scalar loop below
+			len = i + (size_t) __builtin_ctz((unsigned int) m);
+			break;
+		}
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		_mm_storeu_si128((__m128i*) (dst + i), _mm_unpacklo_epi16(lo, zero));
+		_mm_storeu_si128((__m128i*) (dst + i + 4U), _mm_unpackhi_epi16(lo, zero));
+		_mm_storeu_si128((__m128i*) (dst + i + 8U), _mm_unpacklo_epi16(hi, zero));
+		_mm_storeu_si128((__m128i*) (dst + i + 12U), _mm_unpackhi_epi16(hi, zero));
+	}
+#endif
+	for (; i < len && s[i] < 0x80U; i++) {
+		dst[i] = s[i];
+	}
+	return i;
+}
+
+// Decode the len bytes of string to dst, returns the amount of codepoints decoded
+// NOTE: dst must have room for len codepoints, as we never emit more codepoints than we consume bytes.
+static size_t
+    utf8_decode(const char* string, size_t len, uint32_t* dst)
+{
+	const unsigned char* s = (const unsigned char*) string;
+	size_t               i = 0U;
+	size_t               n = 0U;
+
+	while (i + 1U < len) {
+		const uint32_t c = s[i];
+		// NOTE: We branch on whether a multi-byte sequence starts here, and *not* on whether this is ASCII:
+		//       in garbage, or when scripts keep switching, the latter is a coin flip on every single byte,
+		//       while the former hardly ever happens in garbage, and follows the text in everything else.
+		//       Which is also why both checks are folded into a single comparison
+		//       (cont is 0 iff s[i + 1] is a continuation byte).
+		const uint32_t cont = ((uint32_t) s[i + 1U] ^ 0x80U) >> 6U;
+		if (((c - 0xC2U) | (cont << 8U)) <= 0xF4U - 0xC2U) {
+			i += utf8_decode_multi(s + i, len - i, dst + n);
+			n++;
+			continue;
+		}
+
+		// Only take the ASCII path for runs long enough to be worth it
+		if (i + UTF8_ASCII_HEAD <= len && utf8_is_ascii_head(s + i)) {
+			size_t k = utf8_decode_ascii(s + i, len - i, dst + n);
+			i += k;
+			n += k;
+		} else {
+			// Either a lone ASCII byte, or something invalid: always a single byte, no branching required.
+			dst[n++] = (c < 0x80U) ? c : UTF8_REPLACEMENT_CHAR;
+			i++;
+		}
+	}
+	while (i < len) {
+		i += utf8_decode_seq(s + i, len - i, dst + n);
+		n++;
+	}
+	return n;
+}
+
+// Like u8_nextchar, but validating: returns the codepoint at string[*i] (0 at the end of the string), and moves *i past it
+static uint32_t
+    utf8_next(const char* string, size_t* i)
+{
+	const unsigned char* s  = (const unsigned char*) string + *i;
+	uint32_t             cp = 0U;
+
+	if (*s == 0U) {
+		return 0U;
+	}
+	*i += utf8_decode_seq(s, 4U, &cp);
+	return cp;
+}
@@ -0,0 +1,50 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FBINK_UTF8_H
+#define __FBINK_UTF8_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// Pick the best ASCII fast path available for our target at compile-time...
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#	include <arm_neon.h>
+#	define FBINK_UTF8_NEON
+#elif defined(__SSE2__)
+#	include <emmintrin.h>
+#	define FBINK_UTF8_SSE2
+#endif
+
+// What we substitute for anything that isn't valid UTF-8
+#define UTF8_REPLACEMENT_CHAR 0xFFFDU
+
+// How many ASCII bytes in a row it takes for a run to be worth widening on its own (c.f., utf8_decode)
+#define UTF8_ASCII_HEAD 16U
+
+static inline size_t utf8_decode_seq(const unsigned char*, size_t, uint32_t*);
+static inline size_t utf8_decode_multi(const unsigned char*, size_t, uint32_t*);
+static inline bool   utf8_is_ascii_head(const unsigned char*);
+static size_t        utf8_decode_ascii(const unsigned char*, size_t, uint32_t*);
+static size_t        utf8_decode(const char*, size_t, uint32_t*);
+static uint32_t      utf8_next(const char*, size_t*);
+
+#endif
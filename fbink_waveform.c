@@ -0,0 +1,129 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fbink_waveform.h"
+
+// Content-aware waveform modes: our drawing functions only tell us what kind of content they drew
+// (i.e., AUTO for text & bars, GC16 for images), and, right before refreshing it, we look at what actually ended up
+// in the region, so we can pick the cheapest waveform mode that'll still render it properly.
+// Pure black & white content only needs DU, which is much faster than GC16 (and doesn't flicker).
+// NOTE: We don't bother with A2, which is even faster, but only behaves when what was on screen was B/W, too,
+//       and is all kinds of broken on Kobos anyway (c.f., send_refresh). DU handles any gray to B/W transition.
+
+// Whether a region (in fb coordinates, c.f., rotate_region) only holds pure black & white pixels.
+// NOTE: We read what we drew (i.e., from the shadow buffer if there's one, c.f., use_shadow),
+//       and bail at the first gray pixel. Since we only ever draw grays, checking bytes is enough, whatever the bpp.
+static bool
+    is_region_bw(const struct mxcfb_rect* region)
+{
+	if (!fbPtr) {
+		return false;
+	}
+
+	// NOTE: Clamp to the visible screen, like damage_rows.
+	const uint32_t top    = MIN(region->top, vInfo.yres);
+	const uint32_t bottom = MIN(region->top + region->height, vInfo.yres);
+	const uint32_t left   = MIN(region->left, vInfo.xres);
+	const uint32_t right  = MIN(region->left + region->width, vInfo.xres);
+
+	// NOTE: On 4bpp fbs, we round outwards to full bytes, so we may end up checking a neighbor, which is harmless.
+	const uint32_t bpp   = vInfo.bits_per_pixel;
+	const uint32_t start = (left * bpp) >> 3U;
+	const uint32_t end   = ((right * bpp) + 7U) >> 3U;
+	for (uint32_t y = top; y < bottom; y++) {
+		const unsigned char* row = fbPtr + (y * fInfo.line_length);
+		for (uint32_t i = start; i < end; i++) {
+			const unsigned char v = row[i];
+			if (v == 0x00U || v == 0xFFU) {
+				continue;
+			}
+			// Two pixels per byte on 4bpp fbs
+			if (bpp == 4U && (v == 0x0FU || v == 0xF0U)) {
+				continue;
+			}
+			// And alpha doesn't matter on 32bpp fbs
+			if (bpp == 32U && (i & 3U) == 3U) {
+				continue;
+			}
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Pick the waveform mode we'll refresh region (in fb coordinates) with, given the one our caller asked for
+static uint32_t
+    pick_waveform_mode(const struct mxcfb_rect* region, uint32_t waveform_mode, bool is_flashing)
+{
+	// NOTE: Flashing refreshes are meant to get rid of ghosting, so they get the full treatment (c.f., send_refresh).
+	//       And we only ever refine AUTO & GC16, anything else was explicitly asked for.
+	if (noAutoWaveform || is_flashing ||
+	    (waveform_mode != WAVEFORM_MODE_AUTO && waveform_mode != WAVEFORM_MODE_GC16)) {
+		return waveform_mode;
+	}
+#ifdef FBINK_FOR_LINUX
+	// No eInk, no waveform modes ;).
+	return waveform_mode;
+#endif
+#ifdef FBINK_FOR_KINDLE
+	// Legacy einkfb devices don't do waveform modes (c.f., refresh_legacy)
+	if (deviceQuirks.isKindleLegacy) {
+		return waveform_mode;
+	}
+#endif
+
+	if (is_region_bw(region)) {
+		LOG("Region (%u, %u) %ux%u is pure black & white, refreshing it in DU",
+		    region->left,
+		    region->top,
+		    region->width,
+		    region->height);
+		return WAVEFORM_MODE_DU;
+	}
+
+	// Images keep their full fidelity
+	if (waveform_mode == WAVEFORM_MODE_GC16) {
+		return waveform_mode;
+	}
+
+	// Everything else is mostly text on a gray background (or in gray), which is what REAGL is made for,
+	// on devices that support it, GL16 otherwise.
+	uint32_t wfm;
+#ifdef FBINK_FOR_KINDLE
+	if (deviceQuirks.isKindleOasis2) {
+		wfm = WAVEFORM_MODE_KOA2_REAGL;
+	} else if (deviceQuirks.isKindlePearlScreen) {
+		wfm = WAVEFORM_MODE_GL16;
+	} else {
+		wfm = WAVEFORM_MODE_REAGL;
+	}
+#else
+	// NOTE: Older Kobos only do REAGL as REAGLD, via AAD (c.f., refresh_kobo), so stick to GL16 there.
+	wfm = deviceQuirks.isKoboMk7 ? WAVEFORM_MODE_REAGL : WAVEFORM_MODE_GL16;
+#endif
+	LOG("Region (%u, %u) %ux%u holds grays, refreshing it in %s",
+	    region->left,
+	    region->top,
+	    region->width,
+	    region->height,
+	    (wfm == WAVEFORM_MODE_GL16) ? "GL16" : "REAGL");
+	return wfm;
+}
@@ -0,0 +1,35 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __FBINK_WAVEFORM_H
+#define __FBINK_WAVEFORM_H
+
+// Mainly to make IDEs happy
+#include "fbink.h"
+#include "fbink_internal.h"
+
+// Whether we leave the waveform mode our drawing functions ask for alone (c.f., FBInkConfig's no_auto_waveform)
+bool noAutoWaveform = false;
+
+static bool     is_region_bw(const struct mxcfb_rect*);
+static uint32_t pick_waveform_mode(const struct mxcfb_rect*, uint32_t, bool);
+
+#endif
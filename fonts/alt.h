@@ -1,2355 +0,0 @@
-/*
-* C Header for use with https://github.com/NiLuJe/FBInk
-* Converted from Hex font ../fonts/unscii-8-alt.hex
-* With FBInk's tools/hextoc.py
-*/
-
-static const unsigned char alt_block1[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0000 (ESC)
-	{ 0x07, 0x01, 0x57, 0x54, 0x77, 0x50, 0x50, 0x00 },	// U+0001 (ESC)
-	{ 0x07, 0x01, 0x57, 0x54, 0x27, 0x50, 0x50, 0x00 },	// U+0002 (ESC)
-	{ 0x07, 0x01, 0x53, 0x51, 0x27, 0x50, 0x50, 0x00 },	// U+0003 (ESC)
-	{ 0x07, 0x01, 0x73, 0x21, 0x27, 0x20, 0x20, 0x00 },	// U+0004 (ESC)
-	{ 0x07, 0x01, 0x73, 0x51, 0x57, 0x70, 0x20, 0x00 },	// U+0005 (ESC)
-	{ 0x07, 0x05, 0x57, 0x55, 0x35, 0x50, 0x50, 0x00 },	// U+0006 (ESC)
-	{ 0x03, 0x05, 0x13, 0x15, 0x13, 0x10, 0x70, 0x00 },	// U+0007 (ESC)
-	{ 0x03, 0x05, 0x73, 0x15, 0x73, 0x40, 0x70, 0x00 },	// U+0008 (ESC)
-	{ 0x05, 0x05, 0x77, 0x25, 0x25, 0x20, 0x20, 0x00 },	// U+0009 (ESC)
-	{ 0x01, 0x01, 0x71, 0x11, 0x37, 0x10, 0x10, 0x00 },	// U+000A (ESC)
-	{ 0x05, 0x05, 0x75, 0x25, 0x22, 0x20, 0x20, 0x00 },	// U+000B (ESC)
-	{ 0x07, 0x01, 0x73, 0x11, 0x31, 0x10, 0x10, 0x00 },	// U+000C (ESC)
-	{ 0x07, 0x01, 0x71, 0x51, 0x77, 0x30, 0x50, 0x00 },	// U+000D (ESC)
-	{ 0x07, 0x01, 0x77, 0x54, 0x57, 0x50, 0x70, 0x00 },	// U+000E (ESC)
-	{ 0x07, 0x01, 0x77, 0x24, 0x27, 0x20, 0x70, 0x00 },	// U+000F (ESC)
-	{ 0x03, 0x05, 0x15, 0x15, 0x13, 0x10, 0x70, 0x00 },	// U+0010 (ESC)
-	{ 0x03, 0x05, 0x25, 0x35, 0x23, 0x20, 0x70, 0x00 },	// U+0011 (ESC)
-	{ 0x03, 0x05, 0x75, 0x45, 0x73, 0x10, 0x70, 0x00 },	// U+0012 (ESC)
-	{ 0x03, 0x05, 0x75, 0x45, 0x63, 0x40, 0x70, 0x00 },	// U+0013 (ESC)
-	{ 0x03, 0x05, 0x55, 0x55, 0x73, 0x40, 0x40, 0x00 },	// U+0014 (ESC)
-	{ 0x07, 0x05, 0x55, 0x55, 0x35, 0x50, 0x50, 0x00 },	// U+0015 (ESC)
-	{ 0x07, 0x01, 0x57, 0x54, 0x77, 0x20, 0x20, 0x00 },	// U+0016 (ESC)
-	{ 0x07, 0x01, 0x33, 0x51, 0x37, 0x50, 0x30, 0x00 },	// U+0017 (ESC)
-	{ 0x07, 0x01, 0x71, 0x51, 0x57, 0x50, 0x50, 0x00 },	// U+0018 (ESC)
-	{ 0x07, 0x01, 0x53, 0x71, 0x57, 0x50, 0x50, 0x00 },	// U+0019 (ESC)
-	{ 0x3c, 0x66, 0x66, 0x0c, 0x18, 0x00, 0x18, 0x00 },	// U+001A (ESC)
-	{ 0x07, 0x01, 0x73, 0x11, 0x17, 0x10, 0x70, 0x00 },	// U+001B (ESC)
-	{ 0x07, 0x01, 0x73, 0x11, 0x71, 0x40, 0x70, 0x00 },	// U+001C (ESC)
-	{ 0x07, 0x01, 0x75, 0x15, 0x77, 0x40, 0x70, 0x00 },	// U+001D (ESC)
-	{ 0x07, 0x05, 0x77, 0x13, 0x75, 0x40, 0x70, 0x00 },	// U+001E (ESC)
-	{ 0x05, 0x05, 0x75, 0x15, 0x77, 0x40, 0x70, 0x00 },	// U+001F (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
-	{ 0x0c, 0x1e, 0x1e, 0x0c, 0x0c, 0x00, 0x0c, 0x00 },	// U+0021 (!)
-	{ 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
-	{ 0x00, 0x66, 0xff, 0x66, 0x66, 0xff, 0x66, 0x00 },	// U+0023 (#)
-	{ 0x18, 0x7e, 0x0b, 0x3e, 0x68, 0x3f, 0x0c, 0x00 },	// U+0024 ($)
-	{ 0x06, 0x66, 0x30, 0x18, 0x0c, 0x66, 0x60, 0x00 },	// U+0025 (%)
-	{ 0x1e, 0x33, 0x1e, 0x0e, 0x73, 0x33, 0x7e, 0x00 },	// U+0026 (&)
-	{ 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0027 (')
-	{ 0x00, 0x70, 0x38, 0x18, 0x18, 0x38, 0x70, 0x00 },	// U+0028 (()
-	{ 0x00, 0x0e, 0x1c, 0x18, 0x18, 0x1c, 0x0e, 0x00 },	// U+0029 ())
-	{ 0x00, 0x18, 0x7e, 0x3c, 0x7e, 0x18, 0x00, 0x00 },	// U+002A (*)
-	{ 0x00, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x00 },	// U+002B (+)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x0c },	// U+002C (,)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+002D (-)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00 },	// U+002E (.)
-	{ 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x00 },	// U+002F (/)
-	{ 0x1c, 0x32, 0x73, 0x6b, 0x67, 0x26, 0x1c, 0x00 },	// U+0030 (0)
-	{ 0x18, 0x1c, 0x1e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+0031 (1)
-	{ 0x3e, 0x63, 0x70, 0x3c, 0x1e, 0x47, 0x7f, 0x00 },	// U+0032 (2)
-	{ 0x7e, 0x30, 0x18, 0x3c, 0x60, 0x63, 0x3e, 0x00 },	// U+0033 (3)
-	{ 0x38, 0x3c, 0x36, 0x33, 0x7f, 0x30, 0x78, 0x00 },	// U+0034 (4)
-	{ 0x7e, 0x46, 0x06, 0x3e, 0x60, 0x66, 0x3c, 0x00 },	// U+0035 (5)
-	{ 0x1e, 0x33, 0x03, 0x3f, 0x63, 0x63, 0x3e, 0x00 },	// U+0036 (6)
-	{ 0x7e, 0x66, 0x30, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+0037 (7)
-	{ 0x1e, 0x21, 0x23, 0x1e, 0x79, 0x61, 0x3e, 0x00 },	// U+0038 (8)
-	{ 0x3e, 0x63, 0x63, 0x7e, 0x60, 0x66, 0x3c, 0x00 },	// U+0039 (9)
-	{ 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00 },	// U+003A (:)
-	{ 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x18, 0x0c },	// U+003B (;)
-	{ 0x00, 0x60, 0x18, 0x06, 0x18, 0x60, 0x00, 0x00 },	// U+003C (<)
-	{ 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00 },	// U+003D (=)
-	{ 0x00, 0x06, 0x18, 0x60, 0x18, 0x06, 0x00, 0x00 },	// U+003E (>)
-	{ 0x3c, 0x66, 0x60, 0x30, 0x18, 0x00, 0x18, 0x00 },	// U+003F (?)
-	{ 0x3c, 0x66, 0x76, 0x76, 0x06, 0x46, 0x3c, 0x00 },	// U+0040 (@)
-	{ 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+0041 (A)
-	{ 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x00 },	// U+0042 (B)
-	{ 0x3c, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3c, 0x00 },	// U+0043 (C)
-	{ 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x00 },	// U+0044 (D)
-	{ 0x7f, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x7f, 0x00 },	// U+0045 (E)
-	{ 0x7f, 0x46, 0x16, 0x1e, 0x16, 0x06, 0x0f, 0x00 },	// U+0046 (F)
-	{ 0x3c, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7c, 0x00 },	// U+0047 (G)
-	{ 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00 },	// U+0048 (H)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0049 (I)
-	{ 0x7c, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1e, 0x00 },	// U+004A (J)
-	{ 0x67, 0x66, 0x36, 0x1e, 0x3e, 0x76, 0x77, 0x00 },	// U+004B (K)
-	{ 0x0f, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7f, 0x00 },	// U+004C (L)
-	{ 0x63, 0x77, 0x7f, 0x6b, 0x6b, 0x63, 0x63, 0x00 },	// U+004D (M)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x00 },	// U+004E (N)
-	{ 0x1c, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00 },	// U+004F (O)
-	{ 0x3f, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x0f, 0x00 },	// U+0050 (P)
-	{ 0x1c, 0x36, 0x63, 0x63, 0x5b, 0x33, 0x6e, 0x00 },	// U+0051 (Q)
-	{ 0x3f, 0x66, 0x66, 0x76, 0x3e, 0x36, 0x67, 0x00 },	// U+0052 (R)
-	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x00 },	// U+0053 (S)
-	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+0054 (T)
-	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+0055 (U)
-	{ 0x63, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x08, 0x00 },	// U+0056 (V)
-	{ 0x63, 0x63, 0x6b, 0x6b, 0x7f, 0x77, 0x63, 0x00 },	// U+0057 (W)
-	{ 0x63, 0x77, 0x3e, 0x1c, 0x3e, 0x77, 0x63, 0x00 },	// U+0058 (X)
-	{ 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x3c, 0x00 },	// U+0059 (Y)
-	{ 0x7f, 0x63, 0x31, 0x18, 0x4c, 0x66, 0x7f, 0x00 },	// U+005A (Z)
-	{ 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00 },	// U+005B ([)
-	{ 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x00 },	// U+005C (\)
-	{ 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00 },	// U+005D (])
-	{ 0x18, 0x3c, 0x66, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+005E (^)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff },	// U+005F (_)
-	{ 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0060 (`)
-	{ 0x00, 0x00, 0x1e, 0x30, 0x3e, 0x33, 0x6e, 0x00 },	// U+0061 (a)
-	{ 0x07, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3b, 0x00 },	// U+0062 (b)
-	{ 0x00, 0x00, 0x1e, 0x33, 0x03, 0x33, 0x1e, 0x00 },	// U+0063 (c)
-	{ 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6e, 0x00 },	// U+0064 (d)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0065 (e)
-	{ 0x38, 0x6c, 0x0c, 0x1e, 0x0c, 0x0c, 0x1e, 0x00 },	// U+0066 (f)
-	{ 0x00, 0x00, 0x6e, 0x33, 0x33, 0x3e, 0x30, 0x1e },	// U+0067 (g)
-	{ 0x07, 0x06, 0x36, 0x6e, 0x66, 0x66, 0x67, 0x00 },	// U+0068 (h)
-	{ 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00 },	// U+0069 (i)
-	{ 0x60, 0x00, 0x70, 0x60, 0x60, 0x66, 0x66, 0x3c },	// U+006A (j)
-	{ 0x07, 0x06, 0x06, 0x36, 0x1e, 0x36, 0x67, 0x00 },	// U+006B (k)
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00 },	// U+006C (l)
-	{ 0x00, 0x00, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x00 },	// U+006D (m)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+006E (n)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+006F (o)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x3e, 0x06 },	// U+0070 (p)
-	{ 0x00, 0x00, 0x6e, 0x33, 0x33, 0x33, 0x3e, 0x30 },	// U+0071 (q)
-	{ 0x00, 0x00, 0x3b, 0x6e, 0x66, 0x06, 0x0f, 0x00 },	// U+0072 (r)
-	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+0073 (s)
-	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x00 },	// U+0074 (t)
-	{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6e, 0x00 },	// U+0075 (u)
-	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00 },	// U+0076 (v)
-	{ 0x00, 0x00, 0x63, 0x6b, 0x6b, 0x7f, 0x36, 0x00 },	// U+0077 (w)
-	{ 0x00, 0x00, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x00 },	// U+0078 (x)
-	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x0c },	// U+0079 (y)
-	{ 0x00, 0x00, 0x3f, 0x19, 0x0c, 0x26, 0x3f, 0x00 },	// U+007A (z)
-	{ 0x30, 0x18, 0x18, 0x0e, 0x18, 0x18, 0x30, 0x00 },	// U+007B ({)
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+007C (|)
-	{ 0x0c, 0x18, 0x18, 0x70, 0x18, 0x18, 0x0c, 0x00 },	// U+007D (})
-	{ 0x6e, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-	{ 0x03, 0x05, 0x75, 0x25, 0x23, 0x20, 0x20, 0x00 },	// U+007F ()
-	{ 0x07, 0x05, 0x77, 0x55, 0x57, 0x50, 0x70, 0x00 },	// U+0080 ()
-	{ 0x07, 0x05, 0x27, 0x35, 0x27, 0x20, 0x70, 0x00 },	// U+0081 ()
-	{ 0x07, 0x05, 0x77, 0x45, 0x77, 0x10, 0x70, 0x00 },	// U+0082 ()
-	{ 0x07, 0x05, 0x77, 0x45, 0x77, 0x40, 0x70, 0x00 },	// U+0083 ()
-	{ 0x07, 0x02, 0x72, 0x52, 0x57, 0x50, 0x50, 0x00 },	// U+0084 ()
-	{ 0x07, 0x05, 0x15, 0x15, 0x15, 0x10, 0x70, 0x00 },	// U+0085 ()
-	{ 0x07, 0x01, 0x77, 0x14, 0x77, 0x40, 0x70, 0x00 },	// U+0086 ()
-	{ 0x07, 0x01, 0x73, 0x11, 0x77, 0x40, 0x70, 0x00 },	// U+0087 ()
-	{ 0x05, 0x05, 0x77, 0x15, 0x75, 0x40, 0x70, 0x00 },	// U+0088 ()
-	{ 0x05, 0x05, 0x47, 0x45, 0x45, 0x50, 0x70, 0x00 },	// U+0089 ()
-	{ 0x05, 0x05, 0x75, 0x15, 0x72, 0x40, 0x70, 0x00 },	// U+008A ()
-	{ 0x07, 0x05, 0x37, 0x51, 0x51, 0x50, 0x30, 0x00 },	// U+008B ()
-	{ 0x07, 0x05, 0x57, 0x51, 0x51, 0x50, 0x70, 0x00 },	// U+008C ()
-	{ 0x03, 0x05, 0x73, 0x25, 0x25, 0x20, 0x70, 0x00 },	// U+008D ()
-	{ 0x07, 0x01, 0x77, 0x44, 0x77, 0x10, 0x70, 0x00 },	// U+008E ()
-	{ 0x07, 0x01, 0x77, 0x44, 0x67, 0x40, 0x70, 0x00 },	// U+008F ()
-	{ 0x03, 0x05, 0x75, 0x15, 0x13, 0x10, 0x70, 0x00 },	// U+0090 ()
-	{ 0x07, 0x05, 0x27, 0x31, 0x21, 0x20, 0x70, 0x00 },	// U+0091 ()
-	{ 0x07, 0x05, 0x77, 0x41, 0x71, 0x10, 0x70, 0x00 },	// U+0092 ()
-	{ 0x07, 0x01, 0x77, 0x14, 0x37, 0x10, 0x70, 0x00 },	// U+0093 ()
-	{ 0x07, 0x01, 0x71, 0x11, 0x17, 0x10, 0x70, 0x00 },	// U+0094 ()
-	{ 0x05, 0x07, 0x57, 0x55, 0x75, 0x70, 0x50, 0x00 },	// U+0095 ()
-	{ 0x07, 0x01, 0x77, 0x54, 0x77, 0x10, 0x10, 0x00 },	// U+0096 ()
-	{ 0x07, 0x01, 0x73, 0x51, 0x77, 0x10, 0x10, 0x00 },	// U+0097 ()
-	{ 0x07, 0x05, 0x77, 0x54, 0x77, 0x50, 0x70, 0x00 },	// U+0098 ()
-	{ 0x07, 0x05, 0x77, 0x54, 0x77, 0x40, 0x70, 0x00 },	// U+0099 ()
-	{ 0x07, 0x05, 0x77, 0x54, 0x77, 0x50, 0x50, 0x00 },	// U+009A ()
-	{ 0x07, 0x01, 0x71, 0x11, 0x77, 0x40, 0x70, 0x00 },	// U+009B ()
-	{ 0x07, 0x01, 0x77, 0x24, 0x27, 0x20, 0x20, 0x00 },	// U+009C ()
-	{ 0x07, 0x05, 0x75, 0x15, 0x77, 0x40, 0x70, 0x00 },	// U+009D ()
-	{ 0x07, 0x05, 0x57, 0x71, 0x71, 0x50, 0x50, 0x00 },	// U+009E ()
-	{ 0x07, 0x05, 0x77, 0x55, 0x75, 0x10, 0x10, 0x00 },	// U+009F ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
-	{ 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+00A1 (¡)
-	{ 0x00, 0x18, 0x7e, 0x1b, 0x1b, 0x7e, 0x18, 0x00 },	// U+00A2 (¢)
-	{ 0x1c, 0x36, 0x06, 0x0f, 0x06, 0x66, 0x3f, 0x00 },	// U+00A3 (£)
-	{ 0x30, 0x48, 0x0c, 0x3e, 0x0c, 0x46, 0x3f, 0x00 },	// U+00A4 (¤)
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x18, 0x18, 0x00 },	// U+00A5 (¥)
-	{ 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },	// U+00A6 (¦)
-	{ 0x3c, 0x06, 0x3c, 0x66, 0x66, 0x3c, 0x60, 0x3c },	// U+00A7 (§)
-	{ 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A8 (¨)
-	{ 0x7e, 0x81, 0xb9, 0x8d, 0x8d, 0xb9, 0x81, 0x7e },	// U+00A9 (©)
-	{ 0x3c, 0x36, 0x36, 0x7c, 0x00, 0x7e, 0x00, 0x00 },	// U+00AA (ª)
-	{ 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00, 0x00 },	// U+00AB («)
-	{ 0x00, 0x7e, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00AD (­)
-	{ 0x7e, 0x81, 0x9d, 0xa5, 0x9d, 0xa5, 0x81, 0x7e },	// U+00AE (®)
-	{ 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
-	{ 0x3c, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
-	{ 0x18, 0x18, 0x7e, 0x18, 0x18, 0x00, 0x7e, 0x00 },	// U+00B1 (±)
-	{ 0x0e, 0x18, 0x0c, 0x06, 0x1e, 0x00, 0x00, 0x00 },	// U+00B2 (²)
-	{ 0x1e, 0x30, 0x18, 0x30, 0x1e, 0x00, 0x00, 0x00 },	// U+00B3 (³)
-	{ 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B4 (´)
-	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x3e, 0x06, 0x03 },	// U+00B5 (µ)
-	{ 0x7c, 0x5e, 0x5e, 0x5c, 0x58, 0x58, 0x58, 0x00 },	// U+00B6 (¶)
-	{ 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+00B7 (·)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x00 },	// U+00B8 (¸)
-	{ 0x0c, 0x0e, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+00B9 (¹)
-	{ 0x1c, 0x36, 0x36, 0x1c, 0x00, 0x3e, 0x00, 0x00 },	// U+00BA (º)
-	{ 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00 },	// U+00BB (»)
-	{ 0xc2, 0x63, 0x32, 0x5a, 0x6c, 0x56, 0xf3, 0x40 },	// U+00BC (¼)
-	{ 0x02, 0x63, 0x32, 0x7a, 0xcc, 0x66, 0x33, 0xf0 },	// U+00BD (½)
-	{ 0x03, 0xc4, 0x66, 0xb4, 0xdb, 0xac, 0xe6, 0x80 },	// U+00BE (¾)
-	{ 0x18, 0x00, 0x18, 0x0c, 0x06, 0x66, 0x3c, 0x00 },	// U+00BF (¿)
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00C0 (À)
-	{ 0x70, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00C1 (Á)
-	{ 0x18, 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+00C2 (Â)
-	{ 0x6e, 0x3b, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+00C3 (Ã)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00C4 (Ä)
-	{ 0x18, 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+00C5 (Å)
-	{ 0xfc, 0x36, 0x33, 0x7f, 0x33, 0x33, 0xf3, 0x00 },	// U+00C6 (Æ)
-	{ 0x3c, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3c, 0x18 },	// U+00C7 (Ç)
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00C8 (È)
-	{ 0x70, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00C9 (É)
-	{ 0x18, 0x66, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+00CA (Ê)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+00CB (Ë)
-	{ 0x0e, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+00CC (Ì)
-	{ 0x70, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+00CD (Í)
-	{ 0x18, 0x66, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+00CE (Î)
-	{ 0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+00CF (Ï)
-	{ 0x1e, 0x36, 0x66, 0x6f, 0x66, 0x36, 0x1e, 0x00 },	// U+00D0 (Ð)
-	{ 0x6e, 0x3b, 0x00, 0x63, 0x6f, 0x7b, 0x63, 0x00 },	// U+00D1 (Ñ)
-	{ 0x0e, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00D2 (Ò)
-	{ 0x70, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00D3 (Ó)
-	{ 0x18, 0x66, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+00D4 (Ô)
-	{ 0x6e, 0x3b, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+00D5 (Õ)
-	{ 0x66, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00D6 (Ö)
-	{ 0x00, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x00, 0x00 },	// U+00D7 (×)
-	{ 0x40, 0x3c, 0x66, 0x76, 0x6e, 0x66, 0x3c, 0x02 },	// U+00D8 (Ø)
-	{ 0x0e, 0x00, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00D9 (Ù)
-	{ 0x70, 0x00, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00DA (Ú)
-	{ 0x18, 0x66, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00DB (Û)
-	{ 0x66, 0x00, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+00DC (Ü)
-	{ 0x70, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x00 },	// U+00DD (Ý)
-	{ 0x03, 0x03, 0x3f, 0x63, 0x3f, 0x03, 0x03, 0x00 },	// U+00DE (Þ)
-	{ 0x3c, 0x66, 0x66, 0x36, 0x66, 0x66, 0x36, 0x00 },	// U+00DF (ß)
-	{ 0x0e, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+00E0 (à)
-	{ 0x70, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+00E1 (á)
-	{ 0x18, 0x66, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+00E2 (â)
-	{ 0x6e, 0x3b, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+00E3 (ã)
-	{ 0x66, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+00E4 (ä)
-	{ 0x18, 0x18, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+00E5 (å)
-	{ 0x00, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+00E6 (æ)
-	{ 0x00, 0x00, 0x1e, 0x33, 0x03, 0x33, 0x1e, 0x18 },	// U+00E7 (ç)
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+00E8 (è)
-	{ 0x70, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+00E9 (é)
-	{ 0x18, 0x66, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+00EA (ê)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+00EB (ë)
-	{ 0x0e, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+00EC (ì)
-	{ 0x70, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+00ED (í)
-	{ 0x18, 0x66, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+00EE (î)
-	{ 0x66, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+00EF (ï)
-	{ 0x30, 0x7c, 0x30, 0x3e, 0x33, 0x33, 0x1e, 0x00 },	// U+00F0 (ð)
-	{ 0x6e, 0x3b, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x00 },	// U+00F1 (ñ)
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+00F2 (ò)
-	{ 0x70, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+00F3 (ó)
-	{ 0x18, 0x66, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+00F4 (ô)
-	{ 0x6e, 0x3b, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+00F5 (õ)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+00F6 (ö)
-	{ 0x18, 0x18, 0x00, 0x7e, 0x00, 0x18, 0x18, 0x00 },	// U+00F7 (÷)
-	{ 0x00, 0x40, 0x3e, 0x73, 0x6b, 0x67, 0x3e, 0x01 },	// U+00F8 (ø)
-	{ 0x0e, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+00F9 (ù)
-	{ 0x70, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+00FA (ú)
-	{ 0x18, 0x66, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+00FB (û)
-	{ 0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+00FC (ü)
-	{ 0x70, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+00FD (ý)
-	{ 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x06 },	// U+00FE (þ)
-	{ 0x66, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+00FF (ÿ)
-	{ 0x7e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0100 (Ā)
-	{ 0x7e, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+0101 (ā)
-	{ 0x63, 0x3e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+0102 (Ă)
-	{ 0x63, 0x3e, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+0103 (ă)
-	{ 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x70 },	// U+0104 (Ą)
-	{ 0x00, 0x00, 0x1e, 0x30, 0x3e, 0x33, 0x6e, 0x70 },	// U+0105 (ą)
-	{ 0x70, 0x00, 0x7e, 0x03, 0x03, 0x03, 0x7e, 0x00 },	// U+0106 (Ć)
-	{ 0x70, 0x00, 0x3c, 0x06, 0x06, 0x06, 0x3c, 0x00 },	// U+0107 (ć)
-	{ 0x18, 0x66, 0x00, 0x7e, 0x03, 0x03, 0x7e, 0x00 },	// U+0108 (Ĉ)
-	{ 0x18, 0x66, 0x00, 0x3c, 0x06, 0x06, 0x3c, 0x00 },	// U+0109 (ĉ)
-	{ 0x18, 0x00, 0x7e, 0x03, 0x03, 0x03, 0x7e, 0x00 },	// U+010A (Ċ)
-	{ 0x18, 0x00, 0x3c, 0x06, 0x06, 0x06, 0x3c, 0x00 },	// U+010B (ċ)
-	{ 0x66, 0x18, 0x00, 0x7e, 0x03, 0x03, 0x7e, 0x00 },	// U+010C (Č)
-	{ 0x66, 0x18, 0x00, 0x3c, 0x06, 0x06, 0x3c, 0x00 },	// U+010D (č)
-	{ 0x66, 0x18, 0x00, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+010E (Ď)
-	{ 0x58, 0x58, 0x1e, 0x1b, 0x1b, 0x1b, 0x1e, 0x00 },	// U+010F (ď)
-	{ 0x1e, 0x36, 0x66, 0x6f, 0x66, 0x36, 0x1e, 0x00 },	// U+0110 (Đ)
-	{ 0x60, 0xf8, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x00 },	// U+0111 (đ)
-	{ 0x7e, 0x00, 0x7f, 0x03, 0x1f, 0x03, 0x7f, 0x00 },	// U+0112 (Ē)
-	{ 0x7e, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0113 (ē)
-	{ 0x63, 0x3e, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+0114 (Ĕ)
-	{ 0x63, 0x3e, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+0115 (ĕ)
-	{ 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0116 (Ė)
-	{ 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0117 (ė)
-	{ 0x7f, 0x46, 0x16, 0x1e, 0x16, 0x46, 0x7f, 0x70 },	// U+0118 (Ę)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x70 },	// U+0119 (ę)
-	{ 0x66, 0x18, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+011A (Ě)
-	{ 0x66, 0x18, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+011B (ě)
-	{ 0x18, 0x66, 0x00, 0x7c, 0x06, 0x66, 0x7c, 0x00 },	// U+011C (Ĝ)
-	{ 0x18, 0x66, 0x00, 0x7c, 0x66, 0x7c, 0x60, 0x3e },	// U+011D (ĝ)
-	{ 0x63, 0x3e, 0x00, 0x7c, 0x06, 0x66, 0x7c, 0x00 },	// U+011E (Ğ)
-	{ 0x63, 0x3e, 0x00, 0x7c, 0x66, 0x7c, 0x60, 0x3e },	// U+011F (ğ)
-	{ 0x18, 0x00, 0x7c, 0x06, 0x76, 0x66, 0x7c, 0x00 },	// U+0120 (Ġ)
-	{ 0x18, 0x00, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0x3e },	// U+0121 (ġ)
-	{ 0x3c, 0x66, 0x06, 0x76, 0x66, 0x66, 0x7c, 0x0e },	// U+0122 (Ģ)
-	{ 0x08, 0x18, 0x00, 0x7c, 0x66, 0x7c, 0x60, 0x3e },	// U+0123 (ģ)
-	{ 0x18, 0x66, 0x00, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0124 (Ĥ)
-	{ 0x33, 0x4b, 0x03, 0x3f, 0x63, 0x63, 0x63, 0x00 },	// U+0125 (ĥ)
-	{ 0x66, 0xff, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00 },	// U+0126 (Ħ)
-	{ 0x06, 0x1e, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x00 },	// U+0127 (ħ)
-	{ 0x6e, 0x3b, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+0128 (Ĩ)
-	{ 0x6e, 0x3b, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+0129 (ĩ)
-	{ 0x7e, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+012A (Ī)
-	{ 0x7e, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+012B (ī)
-	{ 0x63, 0x3e, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+012C (Ĭ)
-	{ 0x63, 0x3e, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+012D (ĭ)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x70 },	// U+012E (Į)
-	{ 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30, 0x70 },	// U+012F (į)
-	{ 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0130 (İ)
-	{ 0x00, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+0131 (ı)
-	{ 0x63, 0x63, 0x63, 0x63, 0x63, 0x6b, 0x33, 0x00 },	// U+0132 (Ĳ)
-	{ 0x66, 0x00, 0x66, 0x66, 0x66, 0x66, 0x66, 0x30 },	// U+0133 (ĳ)
-	{ 0x18, 0x66, 0x00, 0x60, 0x60, 0x60, 0x3f, 0x00 },	// U+0134 (Ĵ)
-	{ 0x18, 0x66, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1e },	// U+0135 (ĵ)
-	{ 0x67, 0x66, 0x36, 0x1e, 0x3e, 0x76, 0x77, 0x18 },	// U+0136 (Ķ)
-	{ 0x07, 0x06, 0x06, 0x36, 0x1e, 0x36, 0x77, 0x18 },	// U+0137 (ķ)
-	{ 0x00, 0x00, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+0138 (ĸ)
-	{ 0x70, 0x00, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00 },	// U+0139 (Ĺ)
-	{ 0x70, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x7c, 0x00 },	// U+013A (ĺ)
-	{ 0x0f, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7f, 0x18 },	// U+013B (Ļ)
-	{ 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0e },	// U+013C (ļ)
-	{ 0x66, 0x36, 0x06, 0x06, 0x06, 0x06, 0x7e, 0x00 },	// U+013D (Ľ)
-	{ 0x67, 0x36, 0x06, 0x06, 0x06, 0x06, 0x0f, 0x00 },	// U+013E (ľ)
-	{ 0x06, 0x06, 0x06, 0x36, 0x06, 0x06, 0x7e, 0x00 },	// U+013F (Ŀ)
-	{ 0x70, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x7c, 0x00 },	// U+0140 (ŀ)
-	{ 0x0c, 0x0c, 0x3c, 0x1e, 0x0f, 0x0c, 0x7c, 0x00 },	// U+0141 (Ł)
-	{ 0x1e, 0x18, 0x78, 0x3c, 0x1e, 0x18, 0x78, 0x00 },	// U+0142 (ł)
-	{ 0x70, 0x00, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x00 },	// U+0143 (Ń)
-	{ 0x70, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+0144 (ń)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x73, 0x18 },	// U+0145 (Ņ)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x76, 0x18 },	// U+0146 (ņ)
-	{ 0x66, 0x18, 0x00, 0x63, 0x6f, 0x7b, 0x63, 0x00 },	// U+0147 (Ň)
-	{ 0x66, 0x18, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x00 },	// U+0148 (ň)
-	{ 0x00, 0x00, 0x3d, 0x6d, 0x6c, 0x6c, 0x6c, 0x00 },	// U+0149 (ŉ)
-	{ 0x3f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x33, 0x18 },	// U+014A (Ŋ)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x30 },	// U+014B (ŋ)
-	{ 0x7e, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+014C (Ō)
-	{ 0x7e, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+014D (ō)
-	{ 0x63, 0x3e, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+014E (Ŏ)
-	{ 0x63, 0x3e, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+014F (ŏ)
-	{ 0x66, 0x33, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+0150 (Ő)
-	{ 0x66, 0x33, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+0151 (ő)
-	{ 0x7e, 0x33, 0x33, 0x73, 0x33, 0x33, 0x7e, 0x00 },	// U+0152 (Œ)
-	{ 0x00, 0x00, 0x36, 0x5b, 0x7b, 0x1b, 0x6e, 0x00 },	// U+0153 (œ)
-	{ 0x70, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x66, 0x00 },	// U+0154 (Ŕ)
-	{ 0x70, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x00 },	// U+0155 (ŕ)
-	{ 0x3f, 0x63, 0x63, 0x3f, 0x33, 0x63, 0x6b, 0x0c },	// U+0156 (Ŗ)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x0e },	// U+0157 (ŗ)
-	{ 0x66, 0x18, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x00 },	// U+0158 (Ř)
-	{ 0x66, 0x18, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x00 },	// U+0159 (ř)
-	{ 0x70, 0x00, 0x7e, 0x03, 0x3c, 0x60, 0x3f, 0x00 },	// U+015A (Ś)
-	{ 0x70, 0x00, 0x7c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+015B (ś)
-	{ 0x18, 0x66, 0x7e, 0x03, 0x3c, 0x60, 0x3f, 0x00 },	// U+015C (Ŝ)
-	{ 0x18, 0x66, 0x7c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+015D (ŝ)
-	{ 0x3c, 0x66, 0x06, 0x3c, 0x60, 0x66, 0x3c, 0x0e },	// U+015E (Ş)
-	{ 0x00, 0x00, 0x7c, 0x06, 0x3c, 0x60, 0x3e, 0x07 },	// U+015F (ş)
-	{ 0x66, 0x18, 0x00, 0x7e, 0x0f, 0x78, 0x3f, 0x00 },	// U+0160 (Š)
-	{ 0x66, 0x18, 0x00, 0x7c, 0x1e, 0x78, 0x3e, 0x00 },	// U+0161 (š)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c },	// U+0162 (Ţ)
-	{ 0x0c, 0x0c, 0x3e, 0x0c, 0x0c, 0x0c, 0x38, 0x0e },	// U+0163 (ţ)
-	{ 0x66, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+0164 (Ť)
-	{ 0x60, 0x36, 0x06, 0x1f, 0x06, 0x06, 0x1c, 0x00 },	// U+0165 (ť)
-	{ 0x7e, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+0166 (Ŧ)
-	{ 0x0c, 0x0c, 0x3e, 0x0c, 0x1e, 0x0c, 0x38, 0x00 },	// U+0167 (ŧ)
-	{ 0x6e, 0x3b, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+0168 (Ũ)
-	{ 0x6e, 0x3b, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+0169 (ũ)
-	{ 0x7e, 0x00, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+016A (Ū)
-	{ 0x7e, 0x00, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+016B (ū)
-	{ 0x63, 0x3e, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+016C (Ŭ)
-	{ 0x63, 0x3e, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+016D (ŭ)
-	{ 0x18, 0x18, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+016E (Ů)
-	{ 0x18, 0x18, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+016F (ů)
-	{ 0x66, 0x33, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+0170 (Ű)
-	{ 0x66, 0x33, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+0171 (ű)
-	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x70 },	// U+0172 (Ų)
-	{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6e, 0x70 },	// U+0173 (ų)
-	{ 0x18, 0x66, 0x00, 0x63, 0x6b, 0x7f, 0x63, 0x00 },	// U+0174 (Ŵ)
-	{ 0x18, 0x66, 0x00, 0x63, 0x6b, 0x3e, 0x36, 0x00 },	// U+0175 (ŵ)
-	{ 0x18, 0x66, 0x00, 0x66, 0x3c, 0x18, 0x18, 0x00 },	// U+0176 (Ŷ)
-	{ 0x18, 0x66, 0x00, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+0177 (ŷ)
-	{ 0x66, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x00 },	// U+0178 (Ÿ)
-	{ 0x70, 0x00, 0x7f, 0x30, 0x1c, 0x06, 0x7f, 0x00 },	// U+0179 (Ź)
-	{ 0x70, 0x00, 0x7e, 0x30, 0x18, 0x0c, 0x7e, 0x00 },	// U+017A (ź)
-	{ 0x18, 0x00, 0x7f, 0x30, 0x1c, 0x06, 0x7f, 0x00 },	// U+017B (Ż)
-	{ 0x18, 0x00, 0x7e, 0x30, 0x18, 0x0c, 0x7e, 0x00 },	// U+017C (ż)
-	{ 0x66, 0x18, 0x00, 0x7e, 0x30, 0x0c, 0x7e, 0x00 },	// U+017D (Ž)
-	{ 0x66, 0x18, 0x00, 0x7e, 0x30, 0x0c, 0x7e, 0x00 },	// U+017E (ž)
-	{ 0x3c, 0x66, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00 },	// U+017F (ſ)
-	{ 0x06, 0x1f, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0180 (ƀ)
-	{ 0x3e, 0x6d, 0x6d, 0x3c, 0x6c, 0x6c, 0x3c, 0x00 },	// U+0181 (Ɓ)
-	{ 0x7e, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0182 (Ƃ)
-	{ 0x3e, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x00 },	// U+0183 (ƃ)
-	{ 0x06, 0x07, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0184 (Ƅ)
-	{ 0x06, 0x07, 0x06, 0x3e, 0x66, 0x66, 0x3c, 0x00 },	// U+0185 (ƅ)
-	{ 0x3c, 0x66, 0x60, 0x60, 0x60, 0x66, 0x3c, 0x00 },	// U+0186 (Ɔ)
-	{ 0x60, 0x7e, 0x03, 0x03, 0x03, 0x03, 0x7e, 0x00 },	// U+0187 (Ƈ)
-	{ 0x60, 0x30, 0x3e, 0x03, 0x03, 0x03, 0x3e, 0x00 },	// U+0188 (ƈ)
-	{ 0x1e, 0x36, 0x66, 0x6f, 0x66, 0x36, 0x1e, 0x00 },	// U+0189 (Ɖ)
-	{ 0x3e, 0x6d, 0x6d, 0x6c, 0x6c, 0x6c, 0x3e, 0x00 },	// U+018A (Ɗ)
-	{ 0x7c, 0x60, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x00 },	// U+018B (Ƌ)
-	{ 0x7c, 0x60, 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+018C (ƌ)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x60, 0x38 },	// U+018D (ƍ)
-	{ 0x7e, 0x60, 0x60, 0x7c, 0x60, 0x60, 0x7e, 0x00 },	// U+018E (Ǝ)
-	{ 0x3c, 0x66, 0x60, 0x7e, 0x66, 0x66, 0x3c, 0x00 },	// U+018F (Ə)
-	{ 0x3c, 0x66, 0x06, 0x1c, 0x06, 0x66, 0x3c, 0x00 },	// U+0190 (Ɛ)
-	{ 0x7e, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x06, 0x03 },	// U+0191 (Ƒ)
-	{ 0x70, 0xd8, 0x18, 0x3c, 0x18, 0x18, 0x1b, 0x0e },	// U+0192 (ƒ)
-	{ 0x60, 0x3e, 0x03, 0x03, 0x3b, 0x33, 0x3e, 0x00 },	// U+0193 (Ɠ)
-	{ 0x63, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x1c, 0x00 },	// U+0194 (Ɣ)
-	{ 0x03, 0x03, 0xcf, 0xdb, 0xdb, 0xdb, 0x73, 0x00 },	// U+0195 (ƕ)
-}; // 406
-
-static const unsigned char alt_block2[][8] = {
-	{ 0x7e, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+0197 (Ɨ)
-	{ 0x73, 0x5b, 0x1b, 0x0f, 0x1b, 0x33, 0x33, 0x00 },	// U+0198 (Ƙ)
-	{ 0x3c, 0x06, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+0199 (ƙ)
-	{ 0x1e, 0x18, 0x18, 0x7e, 0x18, 0x18, 0x78, 0x00 },	// U+019A (ƚ)
-	{ 0x30, 0x7c, 0x30, 0x3e, 0x33, 0x33, 0x33, 0x00 },	// U+019B (ƛ)
-	{ 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x7e, 0x00 },	// U+019C (Ɯ)
-	{ 0x63, 0x67, 0x6f, 0x7f, 0x7b, 0x73, 0x63, 0x03 },	// U+019D (Ɲ)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x60 },	// U+019E (ƞ)
-	{ 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x3c, 0x00 },	// U+019F (Ɵ)
-}; // 9
-
-static const unsigned char alt_block3[][8] = {
-	{ 0x66, 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01CD (Ǎ)
-	{ 0x66, 0x18, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01CE (ǎ)
-	{ 0x66, 0x18, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+01CF (Ǐ)
-	{ 0x66, 0x18, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+01D0 (ǐ)
-	{ 0x66, 0x18, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+01D1 (Ǒ)
-	{ 0x66, 0x18, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+01D2 (ǒ)
-	{ 0x66, 0x18, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+01D3 (Ǔ)
-	{ 0x66, 0x18, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+01D4 (ǔ)
-	{ 0x7f, 0x36, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+01D5 (Ǖ)
-	{ 0x7f, 0x36, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+01D6 (ǖ)
-	{ 0x30, 0xdb, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+01D7 (Ǘ)
-	{ 0x30, 0xdb, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+01D8 (ǘ)
-	{ 0x3c, 0xdb, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+01D9 (Ǚ)
-	{ 0x3c, 0xdb, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+01DA (ǚ)
-	{ 0x0c, 0xdb, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+01DB (Ǜ)
-	{ 0x0c, 0xdb, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+01DC (ǜ)
-	{ 0x00, 0x00, 0x3c, 0x60, 0x7e, 0x66, 0x3c, 0x00 },	// U+01DD (ǝ)
-	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01DE (Ǟ)
-	{ 0x7f, 0x36, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01DF (ǟ)
-	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01E0 (Ǡ)
-	{ 0x7f, 0x36, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01E1 (ǡ)
-	{ 0x7e, 0x00, 0xfe, 0x33, 0x7f, 0x33, 0xf3, 0x00 },	// U+01E2 (Ǣ)
-	{ 0x7e, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+01E3 (ǣ)
-}; // 23
-
-static const unsigned char alt_block4[][8] = {
-	{ 0x66, 0x18, 0x00, 0x7c, 0x06, 0x66, 0x7c, 0x00 },	// U+01E6 (Ǧ)
-	{ 0x66, 0x18, 0x00, 0x7c, 0x66, 0x7c, 0x60, 0x3e },	// U+01E7 (ǧ)
-	{ 0x66, 0x18, 0x00, 0x73, 0x1f, 0x33, 0x63, 0x00 },	// U+01E8 (Ǩ)
-}; // 3
-
-static const unsigned char alt_block5[][8] = {
-	{ 0x66, 0x18, 0x00, 0x30, 0x30, 0x30, 0x30, 0x1e },	// U+01F0 (ǰ)
-}; // 1
-
-static const unsigned char alt_block6[][8] = {
-	{ 0x70, 0x00, 0x7c, 0x06, 0x76, 0x66, 0x7c, 0x00 },	// U+01F4 (Ǵ)
-	{ 0x70, 0x00, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0x3e },	// U+01F5 (ǵ)
-}; // 2
-
-static const unsigned char alt_block7[][8] = {
-	{ 0x0e, 0x00, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x00 },	// U+01F8 (Ǹ)
-	{ 0x0e, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+01F9 (ǹ)
-	{ 0x66, 0x36, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+01FA (Ǻ)
-	{ 0x66, 0x36, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+01FB (ǻ)
-	{ 0x70, 0x00, 0xfe, 0x33, 0x7f, 0x33, 0xf3, 0x00 },	// U+01FC (Ǽ)
-	{ 0x70, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+01FD (ǽ)
-	{ 0x70, 0x00, 0x7c, 0x66, 0x7e, 0x66, 0x3e, 0x00 },	// U+01FE (Ǿ)
-	{ 0x70, 0x40, 0x3e, 0x73, 0x6b, 0x67, 0x3e, 0x01 },	// U+01FF (ǿ)
-	{ 0x33, 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+0200 (Ȁ)
-	{ 0x33, 0x66, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+0201 (ȁ)
-	{ 0x3e, 0x63, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+0202 (Ȃ)
-	{ 0x3e, 0x63, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+0203 (ȃ)
-	{ 0x33, 0x66, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+0204 (Ȅ)
-	{ 0x33, 0x66, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+0205 (ȅ)
-	{ 0x3e, 0x63, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+0206 (Ȇ)
-	{ 0x3e, 0x63, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+0207 (ȇ)
-	{ 0x33, 0x66, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+0208 (Ȉ)
-	{ 0x33, 0x66, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+0209 (ȉ)
-	{ 0x3e, 0x63, 0x00, 0x7e, 0x18, 0x18, 0x7e, 0x00 },	// U+020A (Ȋ)
-	{ 0x3e, 0x63, 0x00, 0x1c, 0x18, 0x18, 0x3c, 0x00 },	// U+020B (ȋ)
-	{ 0x33, 0x66, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+020C (Ȍ)
-	{ 0x33, 0x66, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+020D (ȍ)
-	{ 0x3e, 0x63, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+020E (Ȏ)
-	{ 0x3e, 0x63, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+020F (ȏ)
-	{ 0x33, 0x66, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x00 },	// U+0210 (Ȑ)
-	{ 0x33, 0x66, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x00 },	// U+0211 (ȑ)
-	{ 0x3e, 0x63, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x00 },	// U+0212 (Ȓ)
-	{ 0x3e, 0x63, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x00 },	// U+0213 (ȓ)
-	{ 0x33, 0x66, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+0214 (Ȕ)
-	{ 0x33, 0x66, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+0215 (ȕ)
-	{ 0x3e, 0x63, 0x00, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+0216 (Ȗ)
-	{ 0x3e, 0x63, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x00 },	// U+0217 (ȗ)
-	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x0c },	// U+0218 (Ș)
-	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x0c },	// U+0219 (ș)
-	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x0c },	// U+021A (Ț)
-	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x0c },	// U+021B (ț)
-}; // 36
-
-static const unsigned char alt_block8[][8] = {
-	{ 0x18, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0226 (Ȧ)
-	{ 0x18, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+0227 (ȧ)
-}; // 2
-
-static const unsigned char alt_block9[][8] = {
-	{ 0x7f, 0x36, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+022A (Ȫ)
-	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+022B (ȫ)
-	{ 0x7f, 0x26, 0x19, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+022C (Ȭ)
-	{ 0x7f, 0x26, 0x19, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+022D (ȭ)
-	{ 0x18, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+022E (Ȯ)
-	{ 0x18, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+022F (ȯ)
-	{ 0x7f, 0x36, 0x00, 0x3e, 0x63, 0x63, 0x3e, 0x00 },	// U+0230 (Ȱ)
-	{ 0x7f, 0x36, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00 },	// U+0231 (ȱ)
-	{ 0x7e, 0x00, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x00 },	// U+0232 (Ȳ)
-	{ 0x7e, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+0233 (ȳ)
-}; // 10
-
-static const unsigned char alt_block10[][8] = {
-	{ 0x00, 0x00, 0x3c, 0x66, 0x7e, 0x60, 0x3c, 0x00 },	// U+0258 (ɘ)
-	{ 0x00, 0x00, 0x3c, 0x60, 0x7e, 0x66, 0x3c, 0x00 },	// U+0259 (ə)
-}; // 2
-
-static const unsigned char alt_block11[][8] = {
-	{ 0x00, 0x00, 0x63, 0x63, 0x36, 0x1c, 0x36, 0x1c },	// U+0263 (ɣ)
-}; // 1
-
-static const unsigned char alt_block12[][8] = {
-	{ 0x3c, 0x66, 0x60, 0x30, 0x18, 0x18, 0x18, 0x00 },	// U+0294 (ʔ)
-}; // 1
-
-static const unsigned char alt_block13[][8] = {
-	{ 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
-}; // 1
-
-static const unsigned char alt_block14[][8] = {
-	{ 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
-}; // 1
-
-static const unsigned char alt_block15[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c },	// U+02CD (ˍ)
-}; // 1
-
-static const unsigned char alt_block16[][8] = {
-	{ 0x7f, 0x26, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
-}; // 1
-
-static const unsigned char alt_block17[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034F (͏)
-}; // 1
-
-static const unsigned char alt_block18[][8] = {
-	{ 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0391 (Α)
-	{ 0x3e, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0392 (Β)
-	{ 0x7f, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00 },	// U+0393 (Γ)
-	{ 0x1c, 0x36, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00 },	// U+0394 (Δ)
-	{ 0x7e, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x7e, 0x00 },	// U+0395 (Ε)
-	{ 0x7e, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x7e, 0x00 },	// U+0396 (Ζ)
-	{ 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00 },	// U+0397 (Η)
-	{ 0x3e, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x3e, 0x00 },	// U+0398 (Θ)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0399 (Ι)
-	{ 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x63, 0x00 },	// U+039A (Κ)
-	{ 0x08, 0x1c, 0x36, 0x63, 0x63, 0x63, 0x63, 0x00 },	// U+039B (Λ)
-	{ 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00 },	// U+039C (Μ)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x00 },	// U+039D (Ν)
-	{ 0x7f, 0x63, 0x00, 0x3e, 0x00, 0x63, 0x7f, 0x00 },	// U+039E (Ξ)
-	{ 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+039F (Ο)
-	{ 0x7f, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x00 },	// U+03A0 (Π)
-	{ 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x06, 0x00 },	// U+03A1 (Ρ)
-}; // 17
-
-static const unsigned char alt_block19[][8] = {
-	{ 0x7e, 0x66, 0x0c, 0x18, 0x0c, 0x66, 0x7e, 0x00 },	// U+03A3 (Σ)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+03A4 (Τ)
-	{ 0x66, 0x66, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+03A5 (Υ)
-	{ 0x3f, 0x0c, 0x1e, 0x33, 0x33, 0x1e, 0x0c, 0x3f },	// U+03A6 (Φ)
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x00 },	// U+03A7 (Χ)
-	{ 0x08, 0x6b, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x00 },	// U+03A8 (Ψ)
-	{ 0x1c, 0x36, 0x63, 0x63, 0x36, 0x36, 0x77, 0x00 },	// U+03A9 (Ω)
-}; // 7
-
-static const unsigned char alt_block20[][8] = {
-	{ 0x00, 0x00, 0x6e, 0x3b, 0x13, 0x3b, 0x6e, 0x00 },	// U+03B1 (α)
-	{ 0x00, 0x3c, 0x66, 0x3e, 0x66, 0x3e, 0x06, 0x06 },	// U+03B2 (β)
-	{ 0x00, 0x00, 0x66, 0x66, 0x3c, 0x66, 0x66, 0x3c },	// U+03B3 (γ)
-	{ 0x70, 0x18, 0x30, 0x7c, 0x66, 0x66, 0x3c, 0x00 },	// U+03B4 (δ)
-	{ 0x00, 0x00, 0x78, 0x0c, 0x3e, 0x0c, 0x78, 0x00 },	// U+03B5 (ε)
-	{ 0x7f, 0x63, 0x30, 0x1e, 0x03, 0x03, 0x3e, 0x40 },	// U+03B6 (ζ)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x60 },	// U+03B7 (η)
-	{ 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x3c, 0x00 },	// U+03B8 (θ)
-	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00 },	// U+03B9 (ι)
-	{ 0x00, 0x00, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+03BA (κ)
-	{ 0x00, 0x03, 0x06, 0x0c, 0x1c, 0x36, 0x63, 0x00 },	// U+03BB (λ)
-	{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6f, 0x03 },	// U+03BC (μ)
-	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x3c, 0x18, 0x00 },	// U+03BD (ν)
-	{ 0x7f, 0x60, 0x3e, 0x03, 0x0e, 0x03, 0x3e, 0x40 },	// U+03BE (ξ)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+03BF (ο)
-	{ 0x00, 0x00, 0x60, 0x3e, 0x37, 0x36, 0x36, 0x00 },	// U+03C0 (π)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3e, 0x06, 0x06 },	// U+03C1 (ρ)
-	{ 0x00, 0x00, 0x3e, 0x63, 0x03, 0x03, 0x3e, 0x60 },	// U+03C2 (ς)
-	{ 0x00, 0x00, 0x7e, 0x1b, 0x1b, 0x1b, 0x0e, 0x00 },	// U+03C3 (σ)
-	{ 0x00, 0x00, 0x6e, 0x3b, 0x18, 0x18, 0x18, 0x00 },	// U+03C4 (τ)
-	{ 0x00, 0x00, 0x63, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+03C5 (υ)
-	{ 0x00, 0x00, 0x76, 0xdb, 0xdb, 0x7e, 0x18, 0x18 },	// U+03C6 (φ)
-	{ 0x00, 0x67, 0x3c, 0x18, 0x1c, 0x36, 0xe3, 0x00 },	// U+03C7 (χ)
-	{ 0x00, 0x00, 0xc3, 0xdb, 0xdb, 0x7e, 0x18, 0x18 },	// U+03C8 (ψ)
-	{ 0x00, 0x00, 0x66, 0xc3, 0xdb, 0xdb, 0x7e, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char alt_block21[][8] = {
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0400 (Ѐ)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0401 (Ё)
-}; // 2
-
-static const unsigned char alt_block22[][8] = {
-	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x00 },	// U+0405 (Ѕ)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0406 (І)
-	{ 0x66, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+0407 (Ї)
-	{ 0x7c, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1e, 0x00 },	// U+0408 (Ј)
-}; // 4
-
-static const unsigned char alt_block23[][8] = {
-	{ 0x18, 0x3c, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+0410 (А)
-	{ 0x7e, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0411 (Б)
-	{ 0x3e, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+0412 (В)
-	{ 0x7e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00 },	// U+0413 (Г)
-	{ 0x78, 0x6c, 0x66, 0x66, 0x66, 0x66, 0xff, 0xc3 },	// U+0414 (Д)
-	{ 0x7e, 0x06, 0x06, 0x3e, 0x06, 0x06, 0x7e, 0x00 },	// U+0415 (Е)
-	{ 0x6b, 0x6b, 0x3e, 0x1c, 0x3e, 0x6b, 0x6b, 0x00 },	// U+0416 (Ж)
-	{ 0x3c, 0x66, 0x60, 0x38, 0x60, 0x66, 0x3c, 0x00 },	// U+0417 (З)
-	{ 0x63, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x00 },	// U+0418 (И)
-	{ 0x1c, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x63, 0x00 },	// U+0419 (Й)
-	{ 0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x63, 0x00 },	// U+041A (К)
-	{ 0x78, 0x6c, 0x66, 0x66, 0x66, 0x66, 0x63, 0x00 },	// U+041B (Л)
-	{ 0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00 },	// U+041C (М)
-	{ 0x66, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x00 },	// U+041D (Н)
-	{ 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+041E (О)
-	{ 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+041F (П)
-	{ 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x06, 0x06, 0x00 },	// U+0420 (Р)
-	{ 0x3c, 0x66, 0x06, 0x06, 0x06, 0x66, 0x3c, 0x00 },	// U+0421 (С)
-	{ 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+0422 (Т)
-	{ 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x3e, 0x00 },	// U+0423 (У)
-	{ 0x08, 0x3e, 0x6b, 0x6b, 0x6b, 0x3e, 0x08, 0x00 },	// U+0424 (Ф)
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x00 },	// U+0425 (Х)
-	{ 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x7f, 0x60 },	// U+0426 (Ц)
-	{ 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x60, 0x00 },	// U+0427 (Ч)
-	{ 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x00 },	// U+0428 (Ш)
-	{ 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0xff, 0xc0 },	// U+0429 (Щ)
-	{ 0x0f, 0x0f, 0x0d, 0x3c, 0x6c, 0x6c, 0x3c, 0x00 },	// U+042A (Ъ)
-	{ 0x63, 0x63, 0x63, 0x6f, 0x7b, 0x7b, 0x6f, 0x00 },	// U+042B (Ы)
-	{ 0x06, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3e, 0x00 },	// U+042C (Ь)
-	{ 0x1e, 0x33, 0x60, 0x7c, 0x60, 0x33, 0x1e, 0x00 },	// U+042D (Э)
-	{ 0x3b, 0x6b, 0x6b, 0x6f, 0x6b, 0x6b, 0x3b, 0x00 },	// U+042E (Ю)
-	{ 0x7c, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x00 },	// U+042F (Я)
-	{ 0x00, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+0430 (а)
-	{ 0x60, 0x3c, 0x06, 0x3e, 0x66, 0x66, 0x3c, 0x00 },	// U+0431 (б)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x3e, 0x00 },	// U+0432 (в)
-	{ 0x00, 0x00, 0x7e, 0x06, 0x06, 0x06, 0x06, 0x00 },	// U+0433 (г)
-	{ 0x00, 0x00, 0x3c, 0x36, 0x36, 0x36, 0x7f, 0x63 },	// U+0434 (д)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0435 (е)
-	{ 0x00, 0x00, 0x6b, 0x3e, 0x1c, 0x3e, 0x6b, 0x00 },	// U+0436 (ж)
-	{ 0x00, 0x00, 0x3e, 0x63, 0x38, 0x63, 0x3e, 0x00 },	// U+0437 (з)
-	{ 0x00, 0x00, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x00 },	// U+0438 (и)
-	{ 0x00, 0x1c, 0x63, 0x73, 0x7b, 0x6f, 0x67, 0x00 },	// U+0439 (й)
-	{ 0x00, 0x00, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+043A (к)
-	{ 0x00, 0x00, 0x7c, 0x66, 0x66, 0x66, 0x67, 0x00 },	// U+043B (л)
-	{ 0x00, 0x00, 0x63, 0x7f, 0x7f, 0x6b, 0x63, 0x00 },	// U+043C (м)
-	{ 0x00, 0x00, 0x66, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+043D (н)
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+043E (о)
-	{ 0x00, 0x00, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+043F (п)
-	{ 0x00, 0x00, 0x3e, 0x66, 0x66, 0x3e, 0x06, 0x06 },	// U+0440 (р)
-	{ 0x00, 0x00, 0x3c, 0x06, 0x06, 0x06, 0x3c, 0x00 },	// U+0441 (с)
-	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+0442 (т)
-	{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+0443 (у)
-	{ 0x08, 0x08, 0x3e, 0x6b, 0x6b, 0x3e, 0x08, 0x08 },	// U+0444 (ф)
-	{ 0x00, 0x00, 0x63, 0x36, 0x1c, 0x36, 0x63, 0x00 },	// U+0445 (х)
-	{ 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x7f, 0x60 },	// U+0446 (ц)
-	{ 0x00, 0x00, 0x66, 0x66, 0x7c, 0x60, 0x60, 0x00 },	// U+0447 (ч)
-	{ 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x00 },	// U+0448 (ш)
-	{ 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x60 },	// U+0449 (щ)
-	{ 0x00, 0x00, 0x07, 0x07, 0x3e, 0x66, 0x3e, 0x00 },	// U+044A (ъ)
-	{ 0x00, 0x00, 0x63, 0x63, 0x6f, 0x7b, 0x6f, 0x00 },	// U+044B (ы)
-	{ 0x00, 0x00, 0x06, 0x06, 0x3e, 0x66, 0x3e, 0x00 },	// U+044C (ь)
-	{ 0x00, 0x00, 0x3e, 0x63, 0x78, 0x63, 0x3e, 0x00 },	// U+044D (э)
-	{ 0x00, 0x00, 0x33, 0x6b, 0x6f, 0x6b, 0x33, 0x00 },	// U+044E (ю)
-	{ 0x00, 0x00, 0x7c, 0x66, 0x7c, 0x6c, 0x66, 0x00 },	// U+044F (я)
-	{ 0x0e, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0450 (ѐ)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x06, 0x3c, 0x00 },	// U+0451 (ё)
-}; // 66
-
-static const unsigned char alt_block24[][8] = {
-	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+0455 (ѕ)
-	{ 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30, 0x00 },	// U+0456 (і)
-	{ 0x66, 0x00, 0x1c, 0x18, 0x18, 0x18, 0x3c, 0x00 },	// U+0457 (ї)
-	{ 0x60, 0x00, 0x70, 0x60, 0x60, 0x66, 0x66, 0x3c },	// U+0458 (ј)
-}; // 4
-
-static const unsigned char alt_block25[][8] = {
-	{ 0x63, 0x3e, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x00 },	// U+04D0 (Ӑ)
-	{ 0x63, 0x3e, 0x00, 0x7c, 0x66, 0x63, 0x7e, 0x00 },	// U+04D1 (ӑ)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x00 },	// U+04D2 (Ӓ)
-	{ 0x66, 0x00, 0x3c, 0x60, 0x7c, 0x66, 0x7c, 0x00 },	// U+04D3 (ӓ)
-	{ 0xfc, 0x36, 0x33, 0x7f, 0x33, 0x33, 0xf3, 0x00 },	// U+04D4 (Ӕ)
-	{ 0x00, 0x00, 0x7e, 0xd8, 0xfe, 0x1b, 0xee, 0x00 },	// U+04D5 (ӕ)
-	{ 0x63, 0x3e, 0x00, 0x7f, 0x0f, 0x03, 0x7f, 0x00 },	// U+04D6 (Ӗ)
-	{ 0x63, 0x3e, 0x00, 0x3c, 0x7e, 0x06, 0x3c, 0x00 },	// U+04D7 (ӗ)
-}; // 8
-
-static const unsigned char alt_block26[][8] = {
-	{ 0x66, 0x00, 0x3e, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+04E6 (Ӧ)
-	{ 0x66, 0x00, 0x3c, 0x66, 0x66, 0x66, 0x3c, 0x00 },	// U+04E7 (ӧ)
-}; // 2
-
-static const unsigned char alt_block27[][8] = {
-	{ 0x66, 0x00, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x3c },	// U+04F1 (ӱ)
-}; // 1
-
-static const unsigned char alt_block28[][8] = {
-	{ 0x00, 0x66, 0x6e, 0x3c, 0x76, 0x66, 0x00, 0x00 },	// U+05D0 (א)
-	{ 0x00, 0x3e, 0x30, 0x30, 0x30, 0x7e, 0x00, 0x00 },	// U+05D1 (ב)
-	{ 0x00, 0x78, 0x60, 0x70, 0x78, 0x6c, 0x00, 0x00 },	// U+05D2 (ג)
-	{ 0x00, 0x7e, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+05D3 (ד)
-	{ 0x00, 0x3e, 0x60, 0x66, 0x66, 0x66, 0x00, 0x00 },	// U+05D4 (ה)
-	{ 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+05D5 (ו)
-	{ 0x00, 0x78, 0x30, 0x60, 0x60, 0x60, 0x00, 0x00 },	// U+05D6 (ז)
-	{ 0x00, 0x7e, 0x6c, 0x6c, 0x6c, 0x6c, 0x00, 0x00 },	// U+05D7 (ח)
-	{ 0x06, 0x76, 0x66, 0x66, 0x66, 0x7e, 0x00, 0x00 },	// U+05D8 (ט)
-	{ 0x00, 0x3c, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+05D9 (י)
-	{ 0x00, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00 },	// U+05DA (ך)
-	{ 0x00, 0x7c, 0x60, 0x60, 0x60, 0x7c, 0x00, 0x00 },	// U+05DB (כ)
-	{ 0x06, 0x7e, 0x60, 0x60, 0x60, 0x70, 0x00, 0x00 },	// U+05DC (ל)
-	{ 0x00, 0x7f, 0x66, 0x66, 0x66, 0x7e, 0x00, 0x00 },	// U+05DD (ם)
-	{ 0x00, 0x36, 0x7c, 0x66, 0x66, 0x76, 0x00, 0x00 },	// U+05DE (מ)
-	{ 0x00, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00 },	// U+05DF (ן)
-	{ 0x00, 0x38, 0x30, 0x30, 0x30, 0x3c, 0x00, 0x00 },	// U+05E0 (נ)
-	{ 0x00, 0x7c, 0x6c, 0x6c, 0x6c, 0x38, 0x00, 0x00 },	// U+05E1 (ס)
-	{ 0x00, 0x6c, 0x6c, 0x6c, 0x6c, 0x7e, 0x00, 0x00 },	// U+05E2 (ע)
-	{ 0x00, 0x7e, 0x66, 0x6e, 0x60, 0x60, 0x60, 0x00 },	// U+05E3 (ף)
-	{ 0x00, 0x7e, 0x66, 0x6e, 0x60, 0x7e, 0x00, 0x00 },	// U+05E4 (פ)
-	{ 0x00, 0x6c, 0x6c, 0x38, 0x30, 0x30, 0x30, 0x00 },	// U+05E5 (ץ)
-	{ 0x00, 0x66, 0x66, 0x3c, 0x70, 0x7e, 0x00, 0x00 },	// U+05E6 (צ)
-	{ 0x00, 0x7c, 0x60, 0x6c, 0x6c, 0x2c, 0x0c, 0x00 },	// U+05E7 (ק)
-	{ 0x00, 0x1e, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00 },	// U+05E8 (ר)
-	{ 0x00, 0x6b, 0x6b, 0x6b, 0x6b, 0x7f, 0x00, 0x00 },	// U+05E9 (ש)
-	{ 0x00, 0x7c, 0x6c, 0x6c, 0x6c, 0x6e, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char alt_block29[][8] = {
-	{ 0x18, 0x0c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+0623 (أ)
-}; // 1
-
-static const unsigned char alt_block30[][8] = {
-	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+0627 (ا)
-	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+0628 (ب)
-	{ 0xd8, 0x00, 0xf0, 0x90, 0xf0, 0x00, 0x00, 0x00 },	// U+0629 (ة)
-	{ 0x6c, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+062A (ت)
-	{ 0x18, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+062B (ث)
-	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x34, 0xf8 },	// U+062C (ج)
-	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x04, 0xf8 },	// U+062D (ح)
-}; // 7
-
-static const unsigned char alt_block31[][8] = {
-	{ 0x00, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+062F (د)
-	{ 0x0c, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+0630 (ذ)
-	{ 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+0631 (ر)
-	{ 0x00, 0xc0, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+0632 (ز)
-	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+0633 (س)
-	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+0634 (ش)
-	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+0635 (ص)
-}; // 7
-
-static const unsigned char alt_block32[][8] = {
-	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+0637 (ط)
-	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+0638 (ظ)
-	{ 0x00, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+0639 (ع)
-	{ 0x0c, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+063A (غ)
-}; // 4
-
-static const unsigned char alt_block33[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+0640 (ـ)
-	{ 0x60, 0x00, 0xf1, 0x91, 0xfe, 0x00, 0x00, 0x00 },	// U+0641 (ف)
-	{ 0xd8, 0x00, 0xf0, 0x91, 0xf1, 0x81, 0x7e, 0x00 },	// U+0642 (ق)
-	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+0643 (ك)
-	{ 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7e, 0x00 },	// U+0644 (ل)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xb8, 0x44, 0x04, 0x04 },	// U+0645 (م)
-	{ 0x18, 0x81, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+0646 (ن)
-	{ 0x00, 0x00, 0x38, 0x28, 0x38, 0x00, 0x00, 0x00 },	// U+0647 (ه)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x7c, 0x00 },	// U+0648 (و)
-	{ 0x00, 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00 },	// U+0649 (ى)
-	{ 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00, 0x6c },	// U+064A (ي)
-}; // 11
-
-static const unsigned char alt_block34[][8] = {
-	{ 0x38, 0x4c, 0x32, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+0671 (ٱ)
-	{ 0x60, 0x14, 0x62, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+0672 (ٲ)
-	{ 0x08, 0x08, 0x08, 0x08, 0x60, 0x14, 0x62, 0x00 },	// U+0673 (ٳ)
-}; // 3
-
-static const unsigned char alt_block35[][8] = {
-	{ 0x18, 0x00, 0x7e, 0x03, 0x3c, 0x60, 0x3f, 0x00 },	// U+1560 (ᕠ)
-	{ 0x18, 0x00, 0x7c, 0x06, 0x3c, 0x60, 0x3e, 0x00 },	// U+1561 (ᕡ)
-	{ 0x1e, 0x33, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x18 },	// U+1562 (ᕢ)
-	{ 0x00, 0x00, 0x3c, 0x06, 0x3c, 0x60, 0x3e, 0x18 },	// U+1563 (ᕣ)
-}; // 4
-
-static const unsigned char alt_block36[][8] = {
-	{ 0x18, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+156A (ᕪ)
-}; // 1
-
-static const unsigned char alt_block37[][8] = {
-	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x18 },	// U+156C (ᕬ)
-	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x18 },	// U+156D (ᕭ)
-	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x7e },	// U+156E (ᕮ)
-	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x38, 0x7e },	// U+156F (ᕯ)
-	{ 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c },	// U+1570 (ᕰ)
-	{ 0x08, 0x0c, 0x3e, 0x0c, 0x0c, 0x6c, 0x7e, 0x3c },	// U+1571 (ᕱ)
-}; // 6
-
-static const unsigned char alt_block38[][8] = {
-	{ 0x7e, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x66, 0x18 },	// U+15EC (ᗬ)
-	{ 0x7e, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x18 },	// U+15ED (ᗭ)
-}; // 2
-
-static const unsigned char alt_block39[][8] = {
-	{ 0x00, 0x00, 0x3b, 0x6e, 0x66, 0x06, 0x0f, 0x7e },	// U+15EF (ᗯ)
-}; // 1
-
-static const unsigned char alt_block40[][8] = {
-	{ 0x36, 0x1e, 0x06, 0x36, 0x1e, 0x06, 0x06, 0x00 },	// U+16A0 (ᚠ)
-	{ 0x6b, 0x33, 0x1f, 0x03, 0x33, 0x1f, 0x03, 0x00 },	// U+16A1 (ᚡ)
-	{ 0x06, 0x0e, 0x1e, 0x36, 0x66, 0x66, 0x66, 0x00 },	// U+16A2 (ᚢ)
-	{ 0x03, 0x07, 0x0f, 0x1b, 0x33, 0x63, 0x6b, 0x00 },	// U+16A3 (ᚣ)
-	{ 0x1c, 0x36, 0x36, 0x63, 0x6b, 0x63, 0x63, 0x00 },	// U+16A4 (ᚤ)
-	{ 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0x66, 0x00 },	// U+16A5 (ᚥ)
-	{ 0x0c, 0x0c, 0x3c, 0x6c, 0x3c, 0x0c, 0x0c, 0x00 },	// U+16A6 (ᚦ)
-	{ 0x03, 0x3f, 0x63, 0x6b, 0x63, 0x3f, 0x03, 0x00 },	// U+16A7 (ᚧ)
-	{ 0x3c, 0x6c, 0x0c, 0x3c, 0x6c, 0x0c, 0x0c, 0x00 },	// U+16A8 (ᚨ)
-	{ 0x6e, 0x36, 0x06, 0x6e, 0x36, 0x06, 0x06, 0x00 },	// U+16A9 (ᚩ)
-	{ 0x6e, 0x36, 0x06, 0x1e, 0x36, 0x06, 0x06, 0x00 },	// U+16AA (ᚪ)
-	{ 0x3c, 0x6c, 0x0c, 0x3c, 0x6c, 0x0c, 0x0c, 0x00 },	// U+16AB (ᚫ)
-}; // 12
-
-static const unsigned char alt_block41[][8] = {
-	{ 0x1e, 0x36, 0x66, 0x36, 0x1e, 0x36, 0x66, 0x00 },	// U+16B1 (ᚱ)
-	{ 0x00, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+16B2 (ᚲ)
-	{ 0x06, 0x06, 0x06, 0x0e, 0x1e, 0x36, 0x66, 0x00 },	// U+16B3 (ᚳ)
-	{ 0x6c, 0x6c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+16B4 (ᚴ)
-	{ 0x6b, 0x63, 0x33, 0x1b, 0x0f, 0x03, 0x03, 0x00 },	// U+16B5 (ᚵ)
-	{ 0x6c, 0x6c, 0x3e, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+16B6 (ᚶ)
-	{ 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x66, 0x00 },	// U+16B7 (ᚷ)
-	{ 0x66, 0x66, 0x3c, 0x5a, 0x3c, 0x66, 0x66, 0x00 },	// U+16B8 (ᚸ)
-	{ 0x1e, 0x36, 0x66, 0x36, 0x1e, 0x06, 0x06, 0x00 },	// U+16B9 (ᚹ)
-	{ 0x66, 0x66, 0x6e, 0x76, 0x66, 0x66, 0x66, 0x00 },	// U+16BA (ᚺ)
-	{ 0x66, 0x66, 0x6e, 0x76, 0x6e, 0x76, 0x66, 0x00 },	// U+16BB (ᚻ)
-	{ 0x18, 0x18, 0x5a, 0x3c, 0x5a, 0x18, 0x18, 0x00 },	// U+16BC (ᚼ)
-	{ 0x18, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+16BD (ᚽ)
-	{ 0x18, 0x18, 0x1a, 0x7e, 0x58, 0x18, 0x18, 0x00 },	// U+16BE (ᚾ)
-	{ 0x0c, 0x0c, 0x0c, 0x3c, 0x6c, 0x0c, 0x0c, 0x00 },	// U+16BF (ᚿ)
-	{ 0x18, 0x18, 0x1a, 0x7e, 0x58, 0x18, 0x18, 0x00 },	// U+16C0 (ᛀ)
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16C1 (ᛁ)
-	{ 0x18, 0x18, 0x18, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+16C2 (ᛂ)
-	{ 0x00, 0x00, 0x06, 0x33, 0x66, 0x30, 0x00, 0x00 },	// U+16C3 (ᛃ)
-	{ 0x18, 0x18, 0x3c, 0x5a, 0x3c, 0x18, 0x18, 0x00 },	// U+16C4 (ᛄ)
-	{ 0x18, 0x18, 0x58, 0x7e, 0x1a, 0x18, 0x18, 0x00 },	// U+16C5 (ᛅ)
-	{ 0x30, 0x30, 0x30, 0x3c, 0x36, 0x30, 0x30, 0x00 },	// U+16C6 (ᛆ)
-	{ 0x38, 0x58, 0x18, 0x18, 0x18, 0x1a, 0x1c, 0x00 },	// U+16C7 (ᛇ)
-	{ 0x66, 0x66, 0x3e, 0x06, 0x3e, 0x66, 0x66, 0x00 },	// U+16C8 (ᛈ)
-	{ 0x6b, 0x6b, 0x3e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16C9 (ᛉ)
-	{ 0x38, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x38, 0x00 },	// U+16CA (ᛊ)
-	{ 0x0c, 0x0c, 0x2c, 0x3c, 0x34, 0x30, 0x30, 0x00 },	// U+16CB (ᛋ)
-	{ 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+16CC (ᛌ)
-	{ 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+16CD (ᛍ)
-	{ 0x18, 0x5a, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+16CE (ᛎ)
-	{ 0x18, 0x3c, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16CF (ᛏ)
-	{ 0x30, 0x3c, 0x36, 0x30, 0x30, 0x30, 0x30, 0x00 },	// U+16D0 (ᛐ)
-	{ 0x30, 0x3c, 0x36, 0x30, 0x78, 0x30, 0x30, 0x00 },	// U+16D1 (ᛑ)
-	{ 0x1e, 0x36, 0x1e, 0x36, 0x66, 0x36, 0x1e, 0x00 },	// U+16D2 (ᛒ)
-	{ 0x06, 0x36, 0x1e, 0x26, 0x1e, 0x06, 0x06, 0x00 },	// U+16D3 (ᛓ)
-	{ 0x3f, 0x6b, 0x3f, 0x63, 0x6b, 0x63, 0x3f, 0x00 },	// U+16D4 (ᛔ)
-	{ 0x66, 0x36, 0x3e, 0x06, 0x1e, 0x36, 0x66, 0x00 },	// U+16D5 (ᛕ)
-	{ 0x41, 0x63, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00 },	// U+16D6 (ᛖ)
-	{ 0x66, 0x7e, 0x5a, 0x7e, 0x66, 0x66, 0x66, 0x00 },	// U+16D7 (ᛗ)
-	{ 0x5a, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16D8 (ᛘ)
-	{ 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16D9 (ᛙ)
-	{ 0x1c, 0x3c, 0x6c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+16DA (ᛚ)
-	{ 0x1c, 0x3c, 0x6c, 0x0c, 0x1e, 0x0c, 0x0c, 0x00 },	// U+16DB (ᛛ)
-	{ 0x00, 0x18, 0x3c, 0x66, 0x3c, 0x18, 0x00, 0x00 },	// U+16DC (ᛜ)
-	{ 0x66, 0x66, 0x3c, 0x66, 0x3c, 0x66, 0x66, 0x00 },	// U+16DD (ᛝ)
-	{ 0x42, 0x66, 0x7e, 0x5a, 0x7e, 0x66, 0x42, 0x00 },	// U+16DE (ᛞ)
-	{ 0x18, 0x3c, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x00 },	// U+16DF (ᛟ)
-	{ 0x5a, 0x7e, 0x5a, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16E0 (ᛠ)
-	{ 0x00, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+16E1 (ᛡ)
-	{ 0x1a, 0x1e, 0x1a, 0x18, 0x18, 0x58, 0x78, 0x58 },	// U+16E2 (ᛢ)
-	{ 0x18, 0x18, 0x18, 0x18, 0x3e, 0x6b, 0x6b, 0x00 },	// U+16E3 (ᛣ)
-	{ 0x6b, 0x6b, 0x3e, 0x6b, 0x3e, 0x6b, 0x6b, 0x00 },	// U+16E4 (ᛤ)
-	{ 0x42, 0x66, 0x7e, 0x66, 0x7e, 0x66, 0x42, 0x00 },	// U+16E5 (ᛥ)
-	{ 0x07, 0x1f, 0x73, 0x63, 0x7f, 0x6b, 0x6b, 0x00 },	// U+16E6 (ᛦ)
-	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+16E7 (ᛧ)
-	{ 0x18, 0x3c, 0x5a, 0x18, 0x5a, 0x3c, 0x18, 0x00 },	// U+16E8 (ᛨ)
-	{ 0x3c, 0x36, 0x33, 0x36, 0x3c, 0x30, 0x30, 0x00 },	// U+16E9 (ᛩ)
-	{ 0x06, 0x0f, 0x26, 0x3e, 0x32, 0x78, 0x30, 0x00 },	// U+16EA (ᛪ)
-	{ 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+16EB (᛫)
-	{ 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00 },	// U+16EC (᛬)
-	{ 0x3c, 0x18, 0x5a, 0x7e, 0x5a, 0x18, 0x3c, 0x00 },	// U+16ED (᛭)
-	{ 0x1c, 0x3c, 0x6c, 0x0f, 0x0d, 0x0c, 0x0c, 0x00 },	// U+16EE (ᛮ)
-	{ 0x6b, 0x6b, 0x3e, 0x18, 0x3e, 0x6b, 0x6b, 0x00 },	// U+16EF (ᛯ)
-	{ 0x08, 0x08, 0x3e, 0x6b, 0x3e, 0x08, 0x08, 0x00 },	// U+16F0 (ᛰ)
-	{ 0x06, 0x06, 0x06, 0x3e, 0x36, 0x66, 0x66, 0x00 },	// U+16F1 (ᛱ)
-	{ 0x30, 0x30, 0x34, 0x3c, 0x2c, 0x0c, 0x0c, 0x00 },	// U+16F2 (ᛲ)
-	{ 0x18, 0x3c, 0x5a, 0x3c, 0x18, 0x18, 0x18, 0x00 },	// U+16F3 (ᛳ)
-	{ 0x0c, 0x0c, 0x6c, 0x3c, 0x36, 0x30, 0x30, 0x00 },	// U+16F4 (ᛴ)
-	{ 0x18, 0x0c, 0x18, 0x0c, 0x18, 0x0c, 0x18, 0x00 },	// U+16F5 (ᛵ)
-	{ 0x06, 0x06, 0x6c, 0x18, 0x36, 0x60, 0x60, 0x00 },	// U+16F6 (ᛶ)
-	{ 0x06, 0x06, 0x3e, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+16F7 (ᛷ)
-	{ 0x18, 0x18, 0x18, 0x18, 0x3c, 0x66, 0x66, 0x00 },	// U+16F8 (ᛸ)
-}; // 72
-
-static const unsigned char alt_block42[][8] = {
-	{ 0x3c, 0x66, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x18 },	// U+1E00 (Ḁ)
-	{ 0x00, 0x00, 0x1e, 0x30, 0x3e, 0x33, 0x6e, 0x18 },	// U+1E01 (ḁ)
-	{ 0x18, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x3e, 0x00 },	// U+1E02 (Ḃ)
-}; // 3
-
-static const unsigned char alt_block43[][8] = {
-	{ 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x18 },	// U+1E04 (Ḅ)
-	{ 0x07, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3b, 0x18 },	// U+1E05 (ḅ)
-	{ 0x3f, 0x66, 0x66, 0x3e, 0x66, 0x66, 0x3f, 0x7e },	// U+1E06 (Ḇ)
-	{ 0x07, 0x06, 0x06, 0x3e, 0x66, 0x66, 0x3b, 0x7e },	// U+1E07 (ḇ)
-}; // 4
-
-static const unsigned char alt_block44[][8] = {
-	{ 0x18, 0x00, 0x3e, 0x66, 0x66, 0x66, 0x3e, 0x00 },	// U+1E0A (Ḋ)
-}; // 1
-
-static const unsigned char alt_block45[][8] = {
-	{ 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x18 },	// U+1E0C (Ḍ)
-	{ 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6e, 0x18 },	// U+1E0D (ḍ)
-	{ 0x1f, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1f, 0x7e },	// U+1E0E (Ḏ)
-	{ 0x38, 0x30, 0x30, 0x3e, 0x33, 0x33, 0x6e, 0x7e },	// U+1E0F (ḏ)
-}; // 4
-
-static const unsigned char alt_block46[][8] = {
-	{ 0x18, 0x00, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x00 },	// U+1E41 (ṁ)
-	{ 0x63, 0x77, 0x7f, 0x6b, 0x6b, 0x63, 0x63, 0x18 },	// U+1E42 (Ṃ)
-	{ 0x00, 0x00, 0x36, 0x7f, 0x6b, 0x6b, 0x63, 0x18 },	// U+1E43 (ṃ)
-	{ 0x18, 0x00, 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x00 },	// U+1E44 (Ṅ)
-	{ 0x18, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+1E45 (ṅ)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x18 },	// U+1E46 (Ṇ)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x18 },	// U+1E47 (ṇ)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x7e },	// U+1E48 (Ṉ)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x7e },	// U+1E49 (ṉ)
-	{ 0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x67, 0x3c },	// U+1E4A (Ṋ)
-	{ 0x00, 0x00, 0x3b, 0x66, 0x66, 0x66, 0x66, 0x3c },	// U+1E4B (ṋ)
-}; // 11
-
-static const unsigned char alt_block47[][8] = {
-	{ 0x18, 0x00, 0x3e, 0x66, 0x3e, 0x66, 0x66, 0x00 },	// U+1E58 (Ṙ)
-	{ 0x18, 0x00, 0x3e, 0x66, 0x06, 0x06, 0x06, 0x00 },	// U+1E59 (ṙ)
-	{ 0x3f, 0x66, 0x66, 0x76, 0x3e, 0x36, 0x67, 0x18 },	// U+1E5A (Ṛ)
-	{ 0x00, 0x00, 0x3b, 0x6e, 0x66, 0x06, 0x0f, 0x18 },	// U+1E5B (ṛ)
-}; // 4
-
-static const unsigned char alt_block48[][8] = {
-	{ 0x3f, 0x66, 0x66, 0x76, 0x3e, 0x36, 0x67, 0x7e },	// U+1E5E (Ṟ)
-}; // 1
-
-static const unsigned char alt_block49[][8] = {
-	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
-	{ 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
-	{ 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
-	{ 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00 },	// U+2016 (‖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff },	// U+2017 (‗)
-	{ 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
-	{ 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-}; // 10
-
-static const unsigned char alt_block50[][8] = {
-	{ 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
-	{ 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
-}; // 2
-
-static const unsigned char alt_block51[][8] = {
-	{ 0x18, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x00 },	// U+2020 (†)
-	{ 0x18, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x00 },	// U+2021 (‡)
-	{ 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00 },	// U+2022 (•)
-}; // 3
-
-static const unsigned char alt_block52[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00 },	// U+2024 (․)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x00 },	// U+2025 (‥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x49, 0x00 },	// U+2026 (…)
-}; // 3
-
-static const unsigned char alt_block53[][8] = {
-	{ 0x00, 0x63, 0x33, 0x18, 0x06, 0xdb, 0xdb, 0x00 },	// U+2030 (‰)
-	{ 0x00, 0x63, 0x33, 0x18, 0x06, 0xab, 0xab, 0x00 },	// U+2031 (‱)
-}; // 2
-
-static const unsigned char alt_block54[][8] = {
-	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x66, 0x00 },	// U+203C (‼)
-}; // 1
-
-static const unsigned char alt_block55[][8] = {
-	{ 0x33, 0x66, 0x66, 0x33, 0x33, 0x00, 0x33, 0x00 },	// U+2047 (⁇)
-	{ 0x67, 0x6c, 0x6c, 0x66, 0x63, 0x00, 0x63, 0x00 },	// U+2048 (⁈)
-	{ 0x3b, 0x63, 0x63, 0x33, 0x1b, 0x00, 0x1b, 0x00 },	// U+2049 (⁉)
-}; // 3
-
-static const unsigned char alt_block56[][8] = {
-	{ 0x1c, 0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
-}; // 1
-
-static const unsigned char alt_block57[][8] = {
-	{ 0x38, 0x34, 0x36, 0x7e, 0x30, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
-	{ 0x3e, 0x06, 0x1e, 0x30, 0x1e, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
-	{ 0x1c, 0x06, 0x1e, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
-	{ 0x3e, 0x30, 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+2077 (⁷)
-	{ 0x1c, 0x36, 0x1c, 0x36, 0x1c, 0x00, 0x00, 0x00 },	// U+2078 (⁸)
-	{ 0x1c, 0x36, 0x3c, 0x30, 0x1c, 0x00, 0x00, 0x00 },	// U+2079 (⁹)
-}; // 6
-
-static const unsigned char alt_block58[][8] = {
-	{ 0x00, 0x1e, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-}; // 1
-
-static const unsigned char alt_block59[][8] = {
-	{ 0x1f, 0x33, 0x33, 0x5f, 0x63, 0xf3, 0x63, 0xe3 },	// U+20A7 (₧)
-}; // 1
-
-static const unsigned char alt_block60[][8] = {
-	{ 0x7c, 0x06, 0x3f, 0x06, 0x1f, 0x06, 0x7c, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char alt_block61[][8] = {
-	{ 0x7e, 0x81, 0x9d, 0xa5, 0x9d, 0x85, 0x81, 0x7e },	// U+2117 (℗)
-}; // 1
-
-static const unsigned char alt_block62[][8] = {
-	{ 0x56, 0x71, 0x72, 0x54, 0x53, 0x00, 0x00, 0x00 },	// U+2120 (℠)
-}; // 1
-
-static const unsigned char alt_block63[][8] = {
-	{ 0x57, 0x72, 0x72, 0x52, 0x52, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char alt_block64[][8] = {
-	{ 0x00, 0x08, 0x0c, 0xfe, 0xfe, 0x0c, 0x08, 0x00 },	// U+2190 (←)
-	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2191 (↑)
-	{ 0x00, 0x10, 0x30, 0x7f, 0x7f, 0x30, 0x10, 0x00 },	// U+2192 (→)
-}; // 3
-
-static const unsigned char alt_block65[][8] = {
-	{ 0x00, 0x24, 0x66, 0xff, 0xff, 0x66, 0x24, 0x00 },	// U+2194 (↔)
-}; // 1
-
-static const unsigned char alt_block66[][8] = {
-	{ 0x0f, 0x07, 0x0f, 0x1d, 0x38, 0x70, 0x20, 0x00 },	// U+2196 (↖)
-	{ 0xf0, 0xe0, 0xf0, 0xb8, 0x1c, 0x0e, 0x04, 0x00 },	// U+2197 (↗)
-	{ 0x00, 0x04, 0x0e, 0x1c, 0xb8, 0xf0, 0xe0, 0xf0 },	// U+2198 (↘)
-	{ 0x00, 0x20, 0x70, 0x38, 0x1d, 0x0f, 0x07, 0x0f },	// U+2199 (↙)
-}; // 4
-
-static const unsigned char alt_block67[][8] = {
-	{ 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x7e, 0x3c, 0x18 },	// U+21A5 (↥)
-}; // 1
-
-static const unsigned char alt_block68[][8] = {
-	{ 0x18, 0x3c, 0x7e, 0x18, 0x7e, 0x3c, 0x18, 0xff },	// U+21A8 (↨)
-}; // 1
-
-static const unsigned char alt_block69[][8] = {
-	{ 0x18, 0x1c, 0xf6, 0x83, 0x83, 0xf6, 0x1c, 0x18 },	// U+21E6 (⇦)
-	{ 0x18, 0x3c, 0x66, 0xc3, 0xe7, 0x24, 0x24, 0x3c },	// U+21E7 (⇧)
-	{ 0x18, 0x38, 0x6f, 0xc1, 0xc1, 0x6f, 0x38, 0x18 },	// U+21E8 (⇨)
-	{ 0x3c, 0x24, 0x24, 0xe7, 0xc3, 0x66, 0x3c, 0x18 },	// U+21E9 (⇩)
-}; // 4
-
-static const unsigned char alt_block70[][8] = {
-	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-}; // 1
-
-static const unsigned char alt_block71[][8] = {
-	{ 0x00, 0x00, 0x3c, 0x66, 0x66, 0x3c, 0x00, 0x00 },	// U+2218 (∘)
-}; // 1
-
-static const unsigned char alt_block72[][8] = {
-	{ 0xf0, 0x30, 0x30, 0x30, 0x37, 0x36, 0x3c, 0x38 },	// U+221A (√)
-}; // 1
-
-static const unsigned char alt_block73[][8] = {
-	{ 0x66, 0xef, 0x99, 0x99, 0xf7, 0x66, 0x00, 0x00 },	// U+221E (∞)
-	{ 0x00, 0x00, 0x03, 0x03, 0x03, 0x7f, 0x00, 0x00 },	// U+221F (∟)
-}; // 2
-
-static const unsigned char alt_block74[][8] = {
-	{ 0x3c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00 },	// U+2229 (∩)
-}; // 1
-
-static const unsigned char alt_block75[][8] = {
-	{ 0x00, 0x6e, 0x3b, 0x00, 0x6e, 0x3b, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char alt_block76[][8] = {
-	{ 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00 },	// U+2261 (≡)
-}; // 1
-
-static const unsigned char alt_block77[][8] = {
-	{ 0x30, 0x18, 0x0c, 0x18, 0x30, 0x00, 0x7e, 0x00 },	// U+2264 (≤)
-	{ 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x7e, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char alt_block78[][8] = {
-	{ 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
-}; // 1
-
-static const unsigned char alt_block79[][8] = {
-	{ 0x00, 0x70, 0xd8, 0xd8, 0x18, 0x18, 0x18, 0x18 },	// U+2320 (⌠)
-	{ 0x18, 0x18, 0x18, 0x18, 0x1b, 0x1b, 0x0e, 0x00 },	// U+2321 (⌡)
-}; // 2
-
-static const unsigned char alt_block80[][8] = {
-	{ 0x00, 0x00, 0x44, 0x66, 0x77, 0x66, 0x44, 0x00 },	// U+23EA (⏪)
-	{ 0x3e, 0x1c, 0x08, 0x00, 0x3e, 0x1c, 0x08, 0x00 },	// U+23EB (⏫)
-	{ 0x00, 0x00, 0x11, 0x33, 0x77, 0x33, 0x11, 0x00 },	// U+23EC (⏬)
-}; // 3
-
-static const unsigned char alt_block81[][8] = {
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+2500 (─)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+2501 (━)
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+2502 (│)
-	{ 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c },	// U+2503 (┃)
-	{ 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00 },	// U+2504 (┄)
-	{ 0x00, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00 },	// U+2505 (┅)
-	{ 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00, 0x18 },	// U+2506 (┆)
-	{ 0x3c, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x00, 0x3c },	// U+2507 (┇)
-	{ 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00 },	// U+2508 (┈)
-	{ 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00 },	// U+2509 (┉)
-	{ 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00 },	// U+250A (┊)
-	{ 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00 },	// U+250B (┋)
-	{ 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x18, 0x18, 0x18 },	// U+250C (┌)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf8, 0xf8, 0x18, 0x18 },	// U+250D (┍)
-	{ 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c },	// U+250E (┎)
-	{ 0x00, 0x00, 0xf0, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c },	// U+250F (┏)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x18, 0x18, 0x18 },	// U+2510 (┐)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18 },	// U+2511 (┑)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c },	// U+2512 (┒)
-	{ 0x00, 0x00, 0x1f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c },	// U+2513 (┓)
-	{ 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x00, 0x00, 0x00 },	// U+2514 (└)
-	{ 0x18, 0x18, 0xf8, 0xf8, 0xf0, 0xf0, 0x00, 0x00 },	// U+2515 (┕)
-	{ 0x3c, 0x3c, 0x3c, 0xfc, 0xf8, 0x00, 0x00, 0x00 },	// U+2516 (┖)
-	{ 0x3c, 0x3c, 0xfc, 0xfc, 0xf0, 0xf0, 0x00, 0x00 },	// U+2517 (┗)
-	{ 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-	{ 0x18, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2519 (┙)
-	{ 0x3c, 0x3c, 0x3c, 0x3f, 0x1f, 0x00, 0x00, 0x00 },	// U+251A (┚)
-	{ 0x3c, 0x3c, 0x3f, 0x3f, 0x1f, 0x1f, 0x00, 0x00 },	// U+251B (┛)
-	{ 0x18, 0x18, 0x18, 0xf8, 0xf8, 0x18, 0x18, 0x18 },	// U+251C (├)
-	{ 0x18, 0x18, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18 },	// U+251D (┝)
-	{ 0x3c, 0x3c, 0x3c, 0xfc, 0xf8, 0x18, 0x18, 0x18 },	// U+251E (┞)
-	{ 0x18, 0x18, 0xf8, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c },	// U+251F (┟)
-	{ 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c },	// U+2520 (┠)
-	{ 0x3c, 0x3c, 0xfc, 0xfc, 0xf8, 0xf8, 0x18, 0x18 },	// U+2521 (┡)
-	{ 0x18, 0x18, 0x18, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c },	// U+2522 (┢)
-	{ 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c },	// U+2523 (┣)
-	{ 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x18, 0x18, 0x18 },	// U+2524 (┤)
-	{ 0x18, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18 },	// U+2525 (┥)
-	{ 0x3c, 0x3c, 0x3c, 0x3f, 0x1f, 0x18, 0x18, 0x18 },	// U+2526 (┦)
-	{ 0x18, 0x18, 0x1f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c },	// U+2527 (┧)
-	{ 0x3c, 0x3c, 0x3c, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c },	// U+2528 (┨)
-	{ 0x3c, 0x3c, 0x3f, 0x3f, 0x1f, 0x1f, 0x18, 0x18 },	// U+2529 (┩)
-	{ 0x18, 0x18, 0x18, 0x3f, 0x3f, 0x3c, 0x3c, 0x3c },	// U+252A (┪)
-	{ 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c, 0x3c },	// U+252B (┫)
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0x18, 0x18 },	// U+252C (┬)
-	{ 0x00, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0x18, 0x18 },	// U+252D (┭)
-	{ 0x00, 0x00, 0xf0, 0xff, 0xff, 0xf8, 0x18, 0x18 },	// U+252E (┮)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18 },	// U+252F (┯)
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x3c, 0x3c, 0x3c },	// U+2530 (┰)
-	{ 0x00, 0x00, 0x1f, 0xff, 0xff, 0x3f, 0x3c, 0x3c },	// U+2531 (┱)
-	{ 0x00, 0x00, 0xf0, 0xff, 0xff, 0xfc, 0x3c, 0x3c },	// U+2532 (┲)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c },	// U+2533 (┳)
-	{ 0x18, 0x18, 0x18, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-	{ 0x18, 0x18, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00 },	// U+2535 (┵)
-	{ 0x18, 0x18, 0xf8, 0xff, 0xff, 0xf0, 0x00, 0x00 },	// U+2536 (┶)
-	{ 0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+2537 (┷)
-	{ 0x3c, 0x3c, 0x3c, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+2538 (┸)
-	{ 0x3c, 0x3c, 0x3f, 0xff, 0xff, 0x1f, 0x00, 0x00 },	// U+2539 (┹)
-	{ 0x3c, 0x3c, 0xfc, 0xff, 0xff, 0xf0, 0x00, 0x00 },	// U+253A (┺)
-	{ 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+253B (┻)
-	{ 0x18, 0x18, 0x18, 0xff, 0xff, 0x18, 0x18, 0x18 },	// U+253C (┼)
-	{ 0x18, 0x18, 0x1f, 0xff, 0xff, 0x1f, 0x18, 0x18 },	// U+253D (┽)
-	{ 0x18, 0x18, 0xf8, 0xff, 0xff, 0xf8, 0x18, 0x18 },	// U+253E (┾)
-	{ 0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18 },	// U+253F (┿)
-	{ 0x3c, 0x3c, 0x3c, 0xff, 0xff, 0x18, 0x18, 0x18 },	// U+2540 (╀)
-	{ 0x18, 0x18, 0x18, 0xff, 0xff, 0x3c, 0x3c, 0x3c },	// U+2541 (╁)
-	{ 0x3c, 0x3c, 0x3c, 0xff, 0xff, 0x3c, 0x3c, 0x3c },	// U+2542 (╂)
-	{ 0x3c, 0x3c, 0x3f, 0xff, 0xff, 0x1f, 0x18, 0x18 },	// U+2543 (╃)
-	{ 0x3c, 0x3c, 0xfc, 0xff, 0xff, 0xf8, 0x18, 0x18 },	// U+2544 (╄)
-	{ 0x18, 0x18, 0x1f, 0xff, 0xff, 0x3f, 0x3c, 0x3c },	// U+2545 (╅)
-	{ 0x18, 0x18, 0xf8, 0xff, 0xff, 0xfc, 0x3c, 0x3c },	// U+2546 (╆)
-	{ 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18 },	// U+2547 (╇)
-	{ 0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c },	// U+2548 (╈)
-	{ 0x3c, 0x3c, 0x3f, 0xff, 0xff, 0x3f, 0x3c, 0x3c },	// U+2549 (╉)
-	{ 0x3c, 0x3c, 0xfc, 0xff, 0xff, 0xfc, 0x3c, 0x3c },	// U+254A (╊)
-	{ 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c },	// U+254B (╋)
-	{ 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 },	// U+254C (╌)
-	{ 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x00, 0x00 },	// U+254D (╍)
-	{ 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 },	// U+254E (╎)
-	{ 0x3c, 0x3c, 0x3c, 0x00, 0x3c, 0x3c, 0x3c, 0x00 },	// U+254F (╏)
-	{ 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+2550 (═)
-	{ 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36 },	// U+2551 (║)
-	{ 0x00, 0x00, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18 },	// U+2552 (╒)
-	{ 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x36, 0x36, 0x36 },	// U+2553 (╓)
-	{ 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36 },	// U+2554 (╔)
-	{ 0x00, 0x00, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18 },	// U+2555 (╕)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x36, 0x36, 0x36 },	// U+2556 (╖)
-	{ 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36 },	// U+2557 (╗)
-	{ 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x00, 0x00, 0x00 },	// U+2558 (╘)
-	{ 0x36, 0x36, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00 },	// U+2559 (╙)
-	{ 0x36, 0x36, 0xf6, 0x06, 0xfe, 0x00, 0x00, 0x00 },	// U+255A (╚)
-	{ 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x00, 0x00, 0x00 },	// U+255B (╛)
-	{ 0x36, 0x36, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+255C (╜)
-	{ 0x36, 0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00 },	// U+255D (╝)
-	{ 0x18, 0x18, 0xf8, 0x18, 0xf8, 0x18, 0x18, 0x18 },	// U+255E (╞)
-	{ 0x36, 0x36, 0x36, 0xf6, 0xf6, 0x36, 0x36, 0x36 },	// U+255F (╟)
-	{ 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36, 0x36 },	// U+2560 (╠)
-	{ 0x18, 0x18, 0x1f, 0x18, 0x1f, 0x18, 0x18, 0x18 },	// U+2561 (╡)
-	{ 0x36, 0x36, 0x36, 0x37, 0x37, 0x36, 0x36, 0x36 },	// U+2562 (╢)
-	{ 0x36, 0x36, 0x37, 0x30, 0x37, 0x36, 0x36, 0x36 },	// U+2563 (╣)
-	{ 0x00, 0x00, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18 },	// U+2564 (╤)
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x36, 0x36, 0x36 },	// U+2565 (╥)
-	{ 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36 },	// U+2566 (╦)
-	{ 0x18, 0x18, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+2567 (╧)
-	{ 0x18, 0x18, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+2568 (╨)
-	{ 0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+2569 (╩)
-	{ 0x18, 0x18, 0xff, 0x18, 0xff, 0x18, 0x18, 0x18 },	// U+256A (╪)
-	{ 0x36, 0x36, 0x36, 0xff, 0xff, 0x36, 0x36, 0x36 },	// U+256B (╫)
-	{ 0x36, 0x36, 0xf7, 0x00, 0xef, 0x36, 0x36, 0x36 },	// U+256C (╬)
-	{ 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x38, 0x18, 0x18 },	// U+256D (╭)
-	{ 0x00, 0x00, 0x00, 0x07, 0x0f, 0x1c, 0x18, 0x18 },	// U+256E (╮)
-	{ 0x18, 0x18, 0x1c, 0x0f, 0x07, 0x00, 0x00, 0x00 },	// U+256F (╯)
-	{ 0x18, 0x18, 0x38, 0xf0, 0xe0, 0x00, 0x00, 0x00 },	// U+2570 (╰)
-	{ 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+2571 (╱)
-	{ 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01 },	// U+2572 (╲)
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x81 },	// U+2573 (╳)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2574 (╴)
-	{ 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+2575 (╵)
-	{ 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x00 },	// U+2576 (╶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18 },	// U+2577 (╷)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2578 (╸)
-	{ 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2579 (╹)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+257A (╺)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c },	// U+257B (╻)
-	{ 0x00, 0x00, 0xf0, 0xff, 0xff, 0xf0, 0x00, 0x00 },	// U+257C (╼)
-	{ 0x18, 0x18, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c },	// U+257D (╽)
-	{ 0x00, 0x00, 0x1f, 0xff, 0xff, 0x1f, 0x00, 0x00 },	// U+257E (╾)
-	{ 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x18, 0x18, 0x18 },	// U+257F (╿)
-	{ 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+2580 (▀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff },	// U+2581 (▁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+2582 (▂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff },	// U+2583 (▃)
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+2584 (▄)
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2585 (▅)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2586 (▆)
-	{ 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2587 (▇)
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+2588 (█)
-	{ 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f },	// U+2589 (▉)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+258A (▊)
-	{ 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+258B (▋)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+258C (▌)
-	{ 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+258D (▍)
-	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+258E (▎)
-	{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+258F (▏)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+2590 (▐)
-	{ 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11 },	// U+2591 (░)
-	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa },	// U+2592 (▒)
-	{ 0xdb, 0xee, 0xdb, 0x77, 0xdb, 0xee, 0xdb, 0x77 },	// U+2593 (▓)
-	{ 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2594 (▔)
-	{ 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },	// U+2595 (▕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2596 (▖)
-	{ 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+2597 (▗)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2598 (▘)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff },	// U+2599 (▙)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+259A (▚)
-	{ 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f },	// U+259B (▛)
-	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+259C (▜)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00 },	// U+259D (▝)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f },	// U+259E (▞)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+259F (▟)
-	{ 0x00, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00 },	// U+25A0 (■)
-	{ 0x00, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x7e, 0x00 },	// U+25A1 (□)
-	{ 0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00 },	// U+25A2 (▢)
-	{ 0x7f, 0x41, 0x5d, 0x5d, 0x5d, 0x41, 0x7f, 0x00 },	// U+25A3 (▣)
-	{ 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00 },	// U+25A4 (▤)
-	{ 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },	// U+25A5 (▥)
-	{ 0x22, 0xff, 0x22, 0x22, 0x22, 0xff, 0x22, 0x22 },	// U+25A6 (▦)
-	{ 0x11, 0x22, 0x44, 0x88, 0x11, 0x22, 0x44, 0x88 },	// U+25A7 (▧)
-	{ 0x88, 0x44, 0x22, 0x11, 0x88, 0x44, 0x22, 0x11 },	// U+25A8 (▨)
-	{ 0x55, 0x22, 0x55, 0x88, 0x55, 0x22, 0x55, 0x88 },	// U+25A9 (▩)
-	{ 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-	{ 0x00, 0x00, 0x1c, 0x14, 0x1c, 0x00, 0x00, 0x00 },	// U+25AB (▫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x7e, 0x00 },	// U+25AC (▬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x7e, 0x66, 0x7e, 0x00 },	// U+25AD (▭)
-	{ 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00 },	// U+25AE (▮)
-	{ 0x3c, 0x24, 0x24, 0x24, 0x24, 0x24, 0x3c, 0x00 },	// U+25AF (▯)
-	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7e, 0x3f, 0x00 },	// U+25B0 (▰)
-	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0x66, 0x3f, 0x00 },	// U+25B1 (▱)
-	{ 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x7f },	// U+25B2 (▲)
-	{ 0x18, 0x18, 0x3c, 0x66, 0x66, 0xc3, 0xc3, 0xff },	// U+25B3 (△)
-	{ 0x00, 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x00 },	// U+25B4 (▴)
-	{ 0x00, 0x08, 0x14, 0x22, 0x41, 0x41, 0x7f, 0x00 },	// U+25B5 (▵)
-	{ 0x03, 0x0f, 0x3f, 0xff, 0x3f, 0x0f, 0x03, 0x00 },	// U+25B6 (▶)
-	{ 0x03, 0x0f, 0x3b, 0xe3, 0x3b, 0x0f, 0x03, 0x00 },	// U+25B7 (▷)
-	{ 0x00, 0x06, 0x1e, 0x7e, 0x1e, 0x06, 0x00, 0x00 },	// U+25B8 (▸)
-	{ 0x00, 0x06, 0x1a, 0x62, 0x1a, 0x06, 0x00, 0x00 },	// U+25B9 (▹)
-	{ 0x00, 0x07, 0x3f, 0xff, 0x3f, 0x07, 0x00, 0x00 },	// U+25BA (►)
-	{ 0x00, 0x0f, 0x3b, 0xe3, 0x3b, 0x0f, 0x00, 0x00 },	// U+25BB (▻)
-	{ 0x7f, 0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08 },	// U+25BC (▼)
-	{ 0xff, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x18 },	// U+25BD (▽)
-	{ 0x00, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00 },	// U+25BE (▾)
-	{ 0x00, 0x7f, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00 },	// U+25BF (▿)
-	{ 0xc0, 0xf0, 0xfc, 0xff, 0xfc, 0xf0, 0xc0, 0x00 },	// U+25C0 (◀)
-	{ 0xc0, 0xf0, 0xdc, 0xc7, 0xdc, 0xf0, 0xc0, 0x00 },	// U+25C1 (◁)
-	{ 0x00, 0x60, 0x78, 0x7e, 0x78, 0x60, 0x00, 0x00 },	// U+25C2 (◂)
-	{ 0x00, 0x60, 0x58, 0x46, 0x58, 0x60, 0x00, 0x00 },	// U+25C3 (◃)
-	{ 0x00, 0xe0, 0xfc, 0xff, 0xfc, 0xe0, 0x00, 0x00 },	// U+25C4 (◄)
-	{ 0x00, 0xf0, 0xdc, 0xc7, 0xdc, 0xf0, 0x00, 0x00 },	// U+25C5 (◅)
-	{ 0x18, 0x3c, 0x7e, 0xff, 0xff, 0x7e, 0x3c, 0x18 },	// U+25C6 (◆)
-	{ 0x18, 0x3c, 0x66, 0xc3, 0xc3, 0x66, 0x3c, 0x18 },	// U+25C7 (◇)
-	{ 0x18, 0x24, 0x5a, 0xbd, 0xbd, 0x5a, 0x24, 0x18 },	// U+25C8 (◈)
-	{ 0x3c, 0x66, 0xc3, 0xdb, 0xdb, 0xc3, 0x66, 0x3c },	// U+25C9 (◉)
-	{ 0x08, 0x1c, 0x36, 0x63, 0x63, 0x36, 0x1c, 0x08 },	// U+25CA (◊)
-	{ 0x00, 0x3c, 0x66, 0x42, 0x42, 0x66, 0x3c, 0x00 },	// U+25CB (○)
-	{ 0x08, 0x22, 0x00, 0x41, 0x00, 0x22, 0x08, 0x00 },	// U+25CC (◌)
-	{ 0x00, 0x1c, 0x36, 0x55, 0x55, 0x36, 0x1c, 0x00 },	// U+25CD (◍)
-	{ 0x1c, 0x22, 0x49, 0x55, 0x49, 0x22, 0x1c, 0x00 },	// U+25CE (◎)
-	{ 0x00, 0x3c, 0x7e, 0x7e, 0x7e, 0x7e, 0x3c, 0x00 },	// U+25CF (●)
-	{ 0x3c, 0x6e, 0xcf, 0xcf, 0xcf, 0xcf, 0x6e, 0x3c },	// U+25D0 (◐)
-	{ 0x3c, 0x76, 0xf3, 0xf3, 0xf3, 0xf3, 0x76, 0x3c },	// U+25D1 (◑)
-	{ 0x3c, 0x66, 0xc3, 0xc3, 0xff, 0xff, 0x7e, 0x3c },	// U+25D2 (◒)
-	{ 0x3c, 0x7e, 0xff, 0xff, 0xc3, 0xc3, 0x66, 0x3c },	// U+25D3 (◓)
-	{ 0x3c, 0x76, 0xf3, 0xf3, 0xc3, 0xc3, 0x66, 0x3c },	// U+25D4 (◔)
-	{ 0x3c, 0x76, 0xf3, 0xf3, 0xff, 0xff, 0x7e, 0x3c },	// U+25D5 (◕)
-	{ 0x00, 0xe0, 0xf8, 0xfc, 0xfc, 0xf8, 0xe0, 0x00 },	// U+25D6 (◖)
-	{ 0x00, 0x07, 0x1f, 0x3f, 0x3f, 0x1f, 0x07, 0x00 },	// U+25D7 (◗)
-	{ 0xff, 0xff, 0xe7, 0xc3, 0xc3, 0xe7, 0xff, 0xff },	// U+25D8 (◘)
-	{ 0xff, 0xc3, 0x99, 0xbd, 0xbd, 0x99, 0xc3, 0xff },	// U+25D9 (◙)
-	{ 0xff, 0xc3, 0x99, 0xbd, 0x00, 0x00, 0x00, 0x00 },	// U+25DA (◚)
-	{ 0x00, 0x00, 0x00, 0x00, 0xbd, 0x99, 0xc3, 0xff },	// U+25DB (◛)
-	{ 0x1c, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+25DC (◜)
-	{ 0x38, 0x60, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+25DD (◝)
-	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x60, 0x38 },	// U+25DE (◞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x06, 0x1c },	// U+25DF (◟)
-	{ 0x3c, 0x66, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00 },	// U+25E0 (◠)
-	{ 0x00, 0x00, 0x00, 0x00, 0xc3, 0xc3, 0x66, 0x3c },	// U+25E1 (◡)
-	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff },	// U+25E2 (◢)
-	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff },	// U+25E3 (◣)
-	{ 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+25E4 (◤)
-	{ 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+25E5 (◥)
-	{ 0x00, 0x00, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00 },	// U+25E6 (◦)
-	{ 0xff, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xcf, 0xff },	// U+25E7 (◧)
-	{ 0xff, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xff },	// U+25E8 (◨)
-	{ 0xff, 0xff, 0xff, 0xdf, 0xcf, 0xc7, 0xc3, 0xff },	// U+25E9 (◩)
-	{ 0xff, 0xc3, 0xe3, 0xf3, 0xfb, 0xff, 0xff, 0xff },	// U+25EA (◪)
-	{ 0xff, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xff },	// U+25EB (◫)
-	{ 0x18, 0x18, 0x24, 0x42, 0x5a, 0x99, 0x81, 0xff },	// U+25EC (◬)
-	{ 0x18, 0x18, 0x3c, 0x6e, 0x6e, 0xcf, 0xcf, 0xff },	// U+25ED (◭)
-	{ 0x18, 0x18, 0x3c, 0x76, 0x76, 0xf3, 0xf3, 0xff },	// U+25EE (◮)
-	{ 0x3c, 0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0x66, 0x3c },	// U+25EF (◯)
-	{ 0xff, 0xdb, 0xdb, 0xdb, 0xdf, 0xc3, 0xc3, 0xff },	// U+25F0 (◰)
-	{ 0xff, 0xc3, 0xc3, 0xc3, 0xdf, 0xdb, 0xdb, 0xff },	// U+25F1 (◱)
-	{ 0xff, 0xc3, 0xc3, 0xc3, 0xfb, 0xdb, 0xdb, 0xff },	// U+25F2 (◲)
-	{ 0xff, 0xdb, 0xdb, 0xdb, 0xfb, 0xc3, 0xc3, 0xff },	// U+25F3 (◳)
-	{ 0x3c, 0x7e, 0xdb, 0xdb, 0xdf, 0xc3, 0x66, 0x3c },	// U+25F4 (◴)
-	{ 0x3c, 0x66, 0xc3, 0xdf, 0xdb, 0xdb, 0x7e, 0x3c },	// U+25F5 (◵)
-	{ 0x3c, 0x66, 0xc3, 0xfb, 0xdb, 0xdb, 0x7e, 0x3c },	// U+25F6 (◶)
-	{ 0x3c, 0x7e, 0xdb, 0xdb, 0xfb, 0xc3, 0x66, 0x3c },	// U+25F7 (◷)
-	{ 0xff, 0x63, 0x33, 0x1b, 0x0f, 0x07, 0x03, 0x01 },	// U+25F8 (◸)
-	{ 0xff, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+25F9 (◹)
-	{ 0x80, 0xc0, 0xe0, 0xf0, 0xd8, 0xcc, 0xc6, 0xff },	// U+25FA (◺)
-	{ 0x00, 0x3e, 0x36, 0x36, 0x36, 0x3e, 0x00, 0x00 },	// U+25FB (◻)
-	{ 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00 },	// U+25FC (◼)
-	{ 0x00, 0x00, 0x3c, 0x24, 0x24, 0x3c, 0x00, 0x00 },	// U+25FD (◽)
-	{ 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00 },	// U+25FE (◾)
-	{ 0x01, 0x03, 0x07, 0x0f, 0x1b, 0x33, 0x63, 0xff },	// U+25FF (◿)
-}; // 256
-
-static const unsigned char alt_block82[][8] = {
-	{ 0x3e, 0x63, 0x36, 0x1c, 0x7f, 0x1c, 0x1c, 0x00 },	// U+2625 (☥)
-}; // 1
-
-static const unsigned char alt_block83[][8] = {
-	{ 0x18, 0x3c, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00 },	// U+2628 (☨)
-}; // 1
-
-static const unsigned char alt_block84[][8] = {
-	{ 0x00, 0x7e, 0x81, 0x8d, 0xcf, 0xff, 0x7e, 0x00 },	// U+262F (☯)
-	{ 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+2630 (☰)
-	{ 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+2631 (☱)
-	{ 0x00, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x7f, 0x00 },	// U+2632 (☲)
-	{ 0x00, 0x00, 0x63, 0x00, 0x63, 0x00, 0x7f, 0x00 },	// U+2633 (☳)
-	{ 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x63, 0x00 },	// U+2634 (☴)
-	{ 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x63, 0x00 },	// U+2635 (☵)
-	{ 0x00, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+2636 (☶)
-	{ 0x00, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+2637 (☷)
-}; // 9
-
-static const unsigned char alt_block85[][8] = {
-	{ 0x7e, 0x81, 0xa5, 0x81, 0x99, 0xbd, 0x81, 0x7e },	// U+2639 (☹)
-	{ 0x7e, 0x81, 0xa5, 0x81, 0xbd, 0x99, 0x81, 0x7e },	// U+263A (☺)
-	{ 0x7e, 0xff, 0xdb, 0xff, 0xc3, 0xe7, 0xff, 0x7e },	// U+263B (☻)
-}; // 3
-
-static const unsigned char alt_block86[][8] = {
-	{ 0x08, 0x1c, 0x3e, 0x7f, 0x7f, 0x1c, 0x3e, 0x00 },	// U+2660 (♠)
-	{ 0x36, 0x7f, 0x63, 0x63, 0x36, 0x1c, 0x08, 0x00 },	// U+2661 (♡)
-	{ 0x08, 0x1c, 0x36, 0x63, 0x36, 0x1c, 0x08, 0x00 },	// U+2662 (♢)
-	{ 0x08, 0x1c, 0x2a, 0x7f, 0x2a, 0x08, 0x1c, 0x00 },	// U+2663 (♣)
-	{ 0x08, 0x1c, 0x36, 0x63, 0x77, 0x1c, 0x3e, 0x00 },	// U+2664 (♤)
-	{ 0x36, 0x7f, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00 },	// U+2665 (♥)
-	{ 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00 },	// U+2666 (♦)
-	{ 0x1c, 0x1c, 0x63, 0x63, 0x77, 0x14, 0x3e, 0x00 },	// U+2667 (♧)
-}; // 8
-
-static const unsigned char alt_block87[][8] = {
-	{ 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3e, 0x1c },	// U+2669 (♩)
-	{ 0x18, 0x38, 0x78, 0xd8, 0x18, 0x1e, 0x1f, 0x0e },	// U+266A (♪)
-	{ 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xe6, 0x67, 0x03 },	// U+266B (♫)
-	{ 0xfe, 0xc6, 0xfe, 0xc6, 0xc6, 0xe6, 0x67, 0x03 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char alt_block88[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00 },	// U+268A (⚊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00 },	// U+268B (⚋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00 },	// U+268C (⚌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x7f, 0x00 },	// U+268D (⚍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x63, 0x00 },	// U+268E (⚎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x63, 0x00 },	// U+268F (⚏)
-}; // 6
-
-static const unsigned char alt_block89[][8] = {
-	{ 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00 },	// U+26AA (⚪)
-	{ 0x00, 0x00, 0x3c, 0x7e, 0x7e, 0x7e, 0x3c, 0x00 },	// U+26AB (⚫)
-	{ 0x00, 0x1c, 0x3e, 0x36, 0x3e, 0x1c, 0x00, 0x00 },	// U+26AC (⚬)
-}; // 3
-
-static const unsigned char alt_block90[][8] = {
-	{ 0x0c, 0x1c, 0x39, 0xff, 0xff, 0x39, 0x1c, 0x0c },	// U+2708 (✈)
-}; // 1
-
-static const unsigned char alt_block91[][8] = {
-	{ 0x49, 0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x49, 0x00 },	// U+2734 (✴)
-}; // 1
-
-static const unsigned char alt_block92[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2803 (⠃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00 },	// U+2804 (⠄)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00 },	// U+2805 (⠅)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+2806 (⠆)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+2807 (⠇)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2808 (⠈)
-	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2809 (⠉)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+280A (⠊)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+280B (⠋)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00 },	// U+280C (⠌)
-	{ 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00 },	// U+280D (⠍)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+280E (⠎)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+280F (⠏)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00 },	// U+2810 (⠐)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00 },	// U+2811 (⠑)
-	{ 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+2812 (⠒)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+2813 (⠓)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00 },	// U+2814 (⠔)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00 },	// U+2815 (⠕)
-	{ 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00 },	// U+2816 (⠖)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00 },	// U+2817 (⠗)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00 },	// U+2818 (⠘)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00 },	// U+2819 (⠙)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+281A (⠚)
-	{ 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+281B (⠛)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00 },	// U+281C (⠜)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00 },	// U+281D (⠝)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00 },	// U+281E (⠞)
-	{ 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00 },	// U+281F (⠟)
-	{ 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00 },	// U+2820 (⠠)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00 },	// U+2821 (⠡)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00 },	// U+2822 (⠢)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00 },	// U+2823 (⠣)
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 },	// U+2824 (⠤)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 },	// U+2825 (⠥)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00 },	// U+2826 (⠦)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00 },	// U+2827 (⠧)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00 },	// U+2828 (⠨)
-	{ 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00 },	// U+2829 (⠩)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00 },	// U+282A (⠪)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00 },	// U+282B (⠫)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 },	// U+282C (⠬)
-	{ 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 },	// U+282D (⠭)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00 },	// U+282E (⠮)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00 },	// U+282F (⠯)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+2830 (⠰)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+2831 (⠱)
-	{ 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00 },	// U+2832 (⠲)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00 },	// U+2833 (⠳)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00 },	// U+2834 (⠴)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00 },	// U+2835 (⠵)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+2836 (⠶)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+2837 (⠷)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+2838 (⠸)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+2839 (⠹)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00 },	// U+283A (⠺)
-	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00 },	// U+283B (⠻)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00 },	// U+283C (⠼)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00 },	// U+283D (⠽)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+283E (⠾)
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+283F (⠿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f },	// U+2840 (⡀)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f },	// U+2841 (⡁)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f },	// U+2842 (⡂)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f },	// U+2843 (⡃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2844 (⡄)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2845 (⡅)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2846 (⡆)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2847 (⡇)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f },	// U+2848 (⡈)
-	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f },	// U+2849 (⡉)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f },	// U+284A (⡊)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f },	// U+284B (⡋)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f },	// U+284C (⡌)
-	{ 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f },	// U+284D (⡍)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+284E (⡎)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+284F (⡏)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f },	// U+2850 (⡐)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f },	// U+2851 (⡑)
-	{ 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f },	// U+2852 (⡒)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f },	// U+2853 (⡓)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2854 (⡔)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2855 (⡕)
-	{ 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2856 (⡖)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f },	// U+2857 (⡗)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f },	// U+2858 (⡘)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f },	// U+2859 (⡙)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f },	// U+285A (⡚)
-	{ 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f },	// U+285B (⡛)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f },	// U+285C (⡜)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f },	// U+285D (⡝)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f },	// U+285E (⡞)
-	{ 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f },	// U+285F (⡟)
-	{ 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2860 (⡠)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2861 (⡡)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2862 (⡢)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2863 (⡣)
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f },	// U+2864 (⡤)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f },	// U+2865 (⡥)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f },	// U+2866 (⡦)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f },	// U+2867 (⡧)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2868 (⡨)
-	{ 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2869 (⡩)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f },	// U+286A (⡪)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f },	// U+286B (⡫)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f },	// U+286C (⡬)
-	{ 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f },	// U+286D (⡭)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f },	// U+286E (⡮)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f },	// U+286F (⡯)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2870 (⡰)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2871 (⡱)
-	{ 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2872 (⡲)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2873 (⡳)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f },	// U+2874 (⡴)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f },	// U+2875 (⡵)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+2876 (⡶)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+2877 (⡷)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2878 (⡸)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f },	// U+2879 (⡹)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f },	// U+287A (⡺)
-	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f },	// U+287B (⡻)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f },	// U+287C (⡼)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f },	// U+287D (⡽)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+287E (⡾)
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+287F (⡿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0 },	// U+2880 (⢀)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0 },	// U+2881 (⢁)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0 },	// U+2882 (⢂)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0 },	// U+2883 (⢃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2884 (⢄)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2885 (⢅)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2886 (⢆)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2887 (⢇)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0 },	// U+2888 (⢈)
-	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0 },	// U+2889 (⢉)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0 },	// U+288A (⢊)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0 },	// U+288B (⢋)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+288C (⢌)
-	{ 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+288D (⢍)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+288E (⢎)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+288F (⢏)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0 },	// U+2890 (⢐)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0 },	// U+2891 (⢑)
-	{ 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0 },	// U+2892 (⢒)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0 },	// U+2893 (⢓)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2894 (⢔)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2895 (⢕)
-	{ 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2896 (⢖)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+2897 (⢗)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0 },	// U+2898 (⢘)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0 },	// U+2899 (⢙)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0 },	// U+289A (⢚)
-	{ 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0 },	// U+289B (⢛)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+289C (⢜)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+289D (⢝)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+289E (⢞)
-	{ 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0 },	// U+289F (⢟)
-	{ 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A0 (⢠)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A1 (⢡)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A2 (⢢)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A3 (⢣)
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0 },	// U+28A4 (⢤)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0 },	// U+28A5 (⢥)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0 },	// U+28A6 (⢦)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0 },	// U+28A7 (⢧)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A8 (⢨)
-	{ 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28A9 (⢩)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28AA (⢪)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28AB (⢫)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0 },	// U+28AC (⢬)
-	{ 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0 },	// U+28AD (⢭)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0 },	// U+28AE (⢮)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0 },	// U+28AF (⢯)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B0 (⢰)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B1 (⢱)
-	{ 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B2 (⢲)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B3 (⢳)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0 },	// U+28B4 (⢴)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0 },	// U+28B5 (⢵)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+28B6 (⢶)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+28B7 (⢷)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B8 (⢸)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28B9 (⢹)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28BA (⢺)
-	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+28BB (⢻)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0 },	// U+28BC (⢼)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0 },	// U+28BD (⢽)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+28BE (⢾)
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+28BF (⢿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+28C0 (⣀)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+28C1 (⣁)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff },	// U+28C2 (⣂)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff },	// U+28C3 (⣃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff },	// U+28C4 (⣄)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff },	// U+28C5 (⣅)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff },	// U+28C6 (⣆)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff },	// U+28C7 (⣇)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+28C8 (⣈)
-	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff },	// U+28C9 (⣉)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff },	// U+28CA (⣊)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff },	// U+28CB (⣋)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff },	// U+28CC (⣌)
-	{ 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff },	// U+28CD (⣍)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff },	// U+28CE (⣎)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff },	// U+28CF (⣏)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff },	// U+28D0 (⣐)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff },	// U+28D1 (⣑)
-	{ 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff },	// U+28D2 (⣒)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff },	// U+28D3 (⣓)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff },	// U+28D4 (⣔)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff },	// U+28D5 (⣕)
-	{ 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff },	// U+28D6 (⣖)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff },	// U+28D7 (⣗)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff },	// U+28D8 (⣘)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff },	// U+28D9 (⣙)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff },	// U+28DA (⣚)
-	{ 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff },	// U+28DB (⣛)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff },	// U+28DC (⣜)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff },	// U+28DD (⣝)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff },	// U+28DE (⣞)
-	{ 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff },	// U+28DF (⣟)
-	{ 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff },	// U+28E0 (⣠)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff },	// U+28E1 (⣡)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff },	// U+28E2 (⣢)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff },	// U+28E3 (⣣)
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+28E4 (⣤)
-	{ 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+28E5 (⣥)
-	{ 0x00, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff },	// U+28E6 (⣦)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff },	// U+28E7 (⣧)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff },	// U+28E8 (⣨)
-	{ 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff },	// U+28E9 (⣩)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff },	// U+28EA (⣪)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff },	// U+28EB (⣫)
-	{ 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+28EC (⣬)
-	{ 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff },	// U+28ED (⣭)
-	{ 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff },	// U+28EE (⣮)
-	{ 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff },	// U+28EF (⣯)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff },	// U+28F0 (⣰)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff },	// U+28F1 (⣱)
-	{ 0x00, 0x00, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff },	// U+28F2 (⣲)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff },	// U+28F3 (⣳)
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+28F4 (⣴)
-	{ 0x0f, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+28F5 (⣵)
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28F6 (⣶)
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28F7 (⣷)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff },	// U+28F8 (⣸)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff },	// U+28F9 (⣹)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff },	// U+28FA (⣺)
-	{ 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff },	// U+28FB (⣻)
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+28FC (⣼)
-	{ 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff },	// U+28FD (⣽)
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FE (⣾)
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+28FF (⣿)
-}; // 256
-
-static const unsigned char alt_block93[][8] = {
-	{ 0x38, 0x38, 0x7c, 0x38, 0x10, 0x00, 0x7c, 0x00 },	// U+2913 (⤓)
-}; // 1
-
-static const unsigned char alt_block94[][8] = {
-	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2B1D (⬝)
-}; // 1
-
-static const unsigned char alt_block95[][8] = {
-	{ 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c },	// U+2B24 (⬤)
-}; // 1
-
-static const unsigned char alt_block96[][8] = {
-	{ 0x3c, 0x7e, 0xe7, 0xc3, 0xc3, 0xe7, 0x7e, 0x3c },	// U+2B55 (⭕)
-}; // 1
-
-static const unsigned char alt_block97[][8] = {
-	{ 0x00, 0x3c, 0x7e, 0x66, 0x66, 0x7e, 0x3c, 0x00 },	// U+2B58 (⭘)
-}; // 1
-
-static const unsigned char alt_block98[][8] = {
-	{ 0x3c, 0x66, 0x66, 0x0c, 0x18, 0x00, 0x18, 0x00 },	// U+2E2E (⸮)
-}; // 1
-
-static const unsigned char alt_block99[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E080 ()
-	{ 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E081 ()
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+E082 ()
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+E083 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f },	// U+E084 ()
-	{ 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f },	// U+E085 ()
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+E086 ()
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+E087 ()
-	{ 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E088 ()
-	{ 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E089 ()
-	{ 0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+E08A ()
-	{ 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+E08B ()
-	{ 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x0f },	// U+E08C ()
-	{ 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x0f, 0x0f },	// U+E08D ()
-	{ 0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+E08E ()
-	{ 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+E08F ()
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+E090 ()
-	{ 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+E091 ()
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E092 ()
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E093 ()
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xff, 0x0f, 0x0f },	// U+E094 ()
-	{ 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xff, 0x0f, 0x0f },	// U+E095 ()
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+E096 ()
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+E097 ()
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+E098 ()
-	{ 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x00, 0x00 },	// U+E099 ()
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E09A ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E09B ()
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0x0f, 0x0f },	// U+E09C ()
-	{ 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0x0f, 0x0f },	// U+E09D ()
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+E09E ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f },	// U+E09F ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0 },	// U+E0A0 ()
-	{ 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0xf0 },	// U+E0A1 ()
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0 },	// U+E0A2 ()
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0 },	// U+E0A3 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff },	// U+E0A4 ()
-	{ 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff },	// U+E0A5 ()
-	{ 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff },	// U+E0A6 ()
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff },	// U+E0A7 ()
-	{ 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0xf0 },	// U+E0A8 ()
-	{ 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xf0 },	// U+E0A9 ()
-	{ 0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0xff, 0xf0, 0xf0 },	// U+E0AA ()
-	{ 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xf0, 0xf0 },	// U+E0AB ()
-	{ 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff },	// U+E0AC ()
-	{ 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff },	// U+E0AD ()
-	{ 0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff },	// U+E0AE ()
-	{ 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff },	// U+E0AF ()
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+E0B0 ()
-	{ 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+E0B1 ()
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+E0B2 ()
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+E0B3 ()
-	{ 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff },	// U+E0B4 ()
-	{ 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff },	// U+E0B5 ()
-	{ 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E0B6 ()
-	{ 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E0B7 ()
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+E0B8 ()
-	{ 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0 },	// U+E0B9 ()
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+E0BA ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0 },	// U+E0BB ()
-	{ 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0xff },	// U+E0BC ()
-	{ 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff },	// U+E0BD ()
-	{ 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E0BE ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E0BF ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E0C0 ()
-	{ 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E0C1 ()
-	{ 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00 },	// U+E0C2 ()
-	{ 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00 },	// U+E0C3 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00 },	// U+E0C4 ()
-	{ 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07 },	// U+E0C5 ()
-	{ 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07 },	// U+E0C6 ()
-	{ 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07 },	// U+E0C7 ()
-	{ 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E0C8 ()
-	{ 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E0C9 ()
-	{ 0x70, 0x70, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00 },	// U+E0CA ()
-	{ 0x77, 0x77, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00 },	// U+E0CB ()
-	{ 0x70, 0x70, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00 },	// U+E0CC ()
-	{ 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07 },	// U+E0CD ()
-	{ 0x70, 0x70, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07 },	// U+E0CE ()
-	{ 0x77, 0x77, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07 },	// U+E0CF ()
-	{ 0x00, 0x00, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00 },	// U+E0D0 ()
-	{ 0x07, 0x07, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00 },	// U+E0D1 ()
-	{ 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 },	// U+E0D2 ()
-	{ 0x07, 0x07, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 },	// U+E0D3 ()
-	{ 0x00, 0x00, 0x00, 0x70, 0x70, 0x07, 0x07, 0x00 },	// U+E0D4 ()
-	{ 0x07, 0x07, 0x00, 0x70, 0x70, 0x00, 0x07, 0x07 },	// U+E0D5 ()
-	{ 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x07, 0x07 },	// U+E0D6 ()
-	{ 0x07, 0x07, 0x00, 0x77, 0x77, 0x00, 0x07, 0x07 },	// U+E0D7 ()
-	{ 0x70, 0x70, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00 },	// U+E0D8 ()
-	{ 0x77, 0x77, 0x00, 0x70, 0x70, 0x00, 0x00, 0x00 },	// U+E0D9 ()
-	{ 0x70, 0x70, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 },	// U+E0DA ()
-	{ 0x77, 0x77, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00 },	// U+E0DB ()
-	{ 0x70, 0x70, 0x00, 0x70, 0x70, 0x07, 0x07, 0x00 },	// U+E0DC ()
-	{ 0x77, 0x77, 0x00, 0x70, 0x70, 0x00, 0x07, 0x07 },	// U+E0DD ()
-	{ 0x70, 0x70, 0x00, 0x77, 0x77, 0x00, 0x07, 0x07 },	// U+E0DE ()
-	{ 0x77, 0x77, 0x00, 0x77, 0x77, 0x00, 0x07, 0x07 },	// U+E0DF ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70 },	// U+E0E0 ()
-	{ 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70 },	// U+E0E1 ()
-	{ 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x70, 0x70 },	// U+E0E2 ()
-	{ 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x70, 0x70 },	// U+E0E3 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x70 },	// U+E0E4 ()
-	{ 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77 },	// U+E0E5 ()
-	{ 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x77, 0x77 },	// U+E0E6 ()
-	{ 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x77, 0x77 },	// U+E0E7 ()
-	{ 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70 },	// U+E0E8 ()
-	{ 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70 },	// U+E0E9 ()
-	{ 0x70, 0x70, 0x00, 0x07, 0x07, 0x00, 0x70, 0x70 },	// U+E0EA ()
-	{ 0x77, 0x77, 0x00, 0x07, 0x07, 0x00, 0x70, 0x70 },	// U+E0EB ()
-	{ 0x70, 0x70, 0x00, 0x00, 0x00, 0x07, 0x77, 0x70 },	// U+E0EC ()
-	{ 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77 },	// U+E0ED ()
-	{ 0x70, 0x70, 0x00, 0x07, 0x07, 0x00, 0x77, 0x77 },	// U+E0EE ()
-	{ 0x77, 0x77, 0x00, 0x07, 0x07, 0x00, 0x77, 0x77 },	// U+E0EF ()
-	{ 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70 },	// U+E0F0 ()
-	{ 0x07, 0x07, 0x00, 0x70, 0x70, 0x70, 0x70, 0x70 },	// U+E0F1 ()
-	{ 0x00, 0x00, 0x00, 0x77, 0x77, 0x70, 0x70, 0x70 },	// U+E0F2 ()
-	{ 0x07, 0x07, 0x00, 0x77, 0x77, 0x70, 0x70, 0x70 },	// U+E0F3 ()
-	{ 0x00, 0x00, 0x00, 0x70, 0x70, 0x77, 0x77, 0x70 },	// U+E0F4 ()
-	{ 0x07, 0x07, 0x00, 0x70, 0x70, 0x70, 0x77, 0x77 },	// U+E0F5 ()
-	{ 0x00, 0x00, 0x00, 0x77, 0x77, 0x70, 0x77, 0x77 },	// U+E0F6 ()
-	{ 0x07, 0x07, 0x00, 0x77, 0x77, 0x70, 0x77, 0x77 },	// U+E0F7 ()
-	{ 0x70, 0x70, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70 },	// U+E0F8 ()
-	{ 0x77, 0x77, 0x00, 0x70, 0x70, 0x00, 0x70, 0x70 },	// U+E0F9 ()
-	{ 0x70, 0x70, 0x00, 0x77, 0x77, 0x00, 0x70, 0x70 },	// U+E0FA ()
-	{ 0x77, 0x77, 0x00, 0x77, 0x77, 0x00, 0x70, 0x70 },	// U+E0FB ()
-	{ 0x70, 0x70, 0x00, 0x70, 0x70, 0x07, 0x77, 0x70 },	// U+E0FC ()
-	{ 0x77, 0x77, 0x00, 0x70, 0x70, 0x00, 0x77, 0x77 },	// U+E0FD ()
-	{ 0x70, 0x70, 0x00, 0x77, 0x77, 0x00, 0x77, 0x77 },	// U+E0FE ()
-	{ 0x77, 0x77, 0x00, 0x77, 0x77, 0x00, 0x77, 0x77 },	// U+E0FF ()
-	{ 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0 },	// U+E100 ()
-	{ 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0 },	// U+E101 ()
-	{ 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8 },	// U+E102 ()
-	{ 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc },	// U+E103 ()
-	{ 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe },	// U+E104 ()
-	{ 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E105 ()
-	{ 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E106 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+E107 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00 },	// U+E108 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 },	// U+E109 ()
-	{ 0x55, 0xaa, 0x55, 0xaa, 0x00, 0x00, 0x00, 0x00 },	// U+E10A ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x55, 0xaa },	// U+E10B ()
-	{ 0x05, 0x0a, 0x05, 0x0a, 0x05, 0x0a, 0x05, 0x0a },	// U+E10C ()
-	{ 0x50, 0xa0, 0x50, 0xa0, 0x50, 0xa0, 0x50, 0xa0 },	// U+E10D ()
-	{ 0x33, 0x33, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00 },	// U+E10E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xcc, 0xcc },	// U+E10F ()
-	{ 0x03, 0x03, 0x0c, 0x0c, 0x03, 0x03, 0x0c, 0x0c },	// U+E110 ()
-	{ 0x30, 0x30, 0xc0, 0xc0, 0x30, 0x30, 0xc0, 0xc0 },	// U+E111 ()
-	{ 0x00, 0x80, 0x40, 0xa0, 0x50, 0xa8, 0x54, 0xaa },	// U+E112 ()
-	{ 0x00, 0x01, 0x02, 0x05, 0x0a, 0x15, 0x2a, 0x55 },	// U+E113 ()
-	{ 0x55, 0x2a, 0x15, 0x0a, 0x05, 0x02, 0x01, 0x00 },	// U+E114 ()
-	{ 0x55, 0xaa, 0x54, 0xa8, 0x50, 0xa0, 0x40, 0x80 },	// U+E115 ()
-	{ 0x00, 0x00, 0x80, 0xc0, 0xf0, 0xf8, 0xfc, 0xfe },	// U+E116 ()
-	{ 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x3f, 0x7f },	// U+E117 ()
-	{ 0x7f, 0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x00, 0x00 },	// U+E118 ()
-	{ 0xfe, 0xfc, 0xf8, 0xf0, 0xc0, 0x80, 0x00, 0x00 },	// U+E119 ()
-	{ 0xff, 0xff, 0x7f, 0x3f, 0x0f, 0x07, 0x03, 0x01 },	// U+E11A ()
-	{ 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0xc0, 0x80 },	// U+E11B ()
-	{ 0x80, 0xc0, 0xe0, 0xf0, 0xfc, 0xfe, 0xff, 0xff },	// U+E11C ()
-	{ 0x01, 0x03, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0xff },	// U+E11D ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff },	// U+E11E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff },	// U+E11F ()
-	{ 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+E120 ()
-	{ 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+E121 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0x03, 0x00 },	// U+E122 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xc0, 0x00 },	// U+E123 ()
-	{ 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0xff },	// U+E124 ()
-	{ 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff },	// U+E125 ()
-	{ 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xf0 },	// U+E126 ()
-	{ 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0f, 0x0f },	// U+E127 ()
-	{ 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01 },	// U+E128 ()
-	{ 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80 },	// U+E129 ()
-	{ 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f },	// U+E12A ()
-	{ 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xf0 },	// U+E12B ()
-	{ 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe },	// U+E12C ()
-	{ 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f },	// U+E12D ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xff },	// U+E12E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xff },	// U+E12F ()
-	{ 0xff, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E130 ()
-	{ 0xff, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E131 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x07, 0x00 },	// U+E132 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00 },	// U+E133 ()
-	{ 0x00, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E134 ()
-	{ 0x00, 0x07, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E135 ()
-	{ 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xf0, 0xf0 },	// U+E136 ()
-	{ 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f },	// U+E137 ()
-	{ 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00 },	// U+E138 ()
-	{ 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00 },	// U+E139 ()
-	{ 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 0x0f },	// U+E13A ()
-	{ 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xf8, 0xf0, 0xf0 },	// U+E13B ()
-	{ 0xf0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xff, 0xff },	// U+E13C ()
-	{ 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0xff, 0xff },	// U+E13D ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0 },	// U+E13E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f },	// U+E13F ()
-	{ 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+E140 ()
-	{ 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00 },	// U+E141 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f },	// U+E142 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0 },	// U+E143 ()
-	{ 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff },	// U+E144 ()
-	{ 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff },	// U+E145 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf0 },	// U+E146 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x0f },	// U+E147 ()
-	{ 0x0f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+E148 ()
-	{ 0xf0, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+E149 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0 },	// U+E14A ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07 },	// U+E14B ()
-	{ 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E14C ()
-	{ 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E14D ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f },	// U+E14E ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8 },	// U+E14F ()
-	{ 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E150 ()
-	{ 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E151 ()
-	{ 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, 0xff, 0xff },	// U+E152 ()
-	{ 0x00, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff },	// U+E153 ()
-	{ 0xff, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x00 },	// U+E154 ()
-	{ 0xff, 0xff, 0xff, 0xfc, 0xc0, 0x00, 0x00, 0x00 },	// U+E155 ()
-	{ 0xf7, 0xf7, 0xe3, 0xe3, 0xc1, 0xc1, 0x80, 0x80 },	// U+E156 ()
-	{ 0xfc, 0xf0, 0xc0, 0x00, 0xc0, 0xf0, 0xfc, 0xff },	// U+E157 ()
-	{ 0x80, 0x80, 0xc1, 0xc1, 0xe3, 0xe3, 0xf7, 0xf7 },	// U+E158 ()
-	{ 0x3f, 0x0f, 0x03, 0x00, 0x03, 0x0f, 0x3f, 0xff },	// U+E159 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f },	// U+E15A ()
-	{ 0x01, 0x03, 0x07, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+E15B ()
-	{ 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+E15C ()
-	{ 0x80, 0xc0, 0xe0, 0xf0, 0xe0, 0xc0, 0x80, 0x00 },	// U+E15D ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe3, 0xc1, 0x80 },	// U+E15E ()
-	{ 0xfe, 0xfc, 0xf8, 0xf0, 0xf8, 0xfc, 0xfe, 0xff },	// U+E15F ()
-	{ 0x80, 0xc1, 0xe3, 0xf7, 0xff, 0xff, 0xff, 0xff },	// U+E160 ()
-	{ 0x7f, 0x3f, 0x1f, 0x0f, 0x1f, 0x3f, 0x7f, 0xff },	// U+E161 ()
-	{ 0x18, 0x3c, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff },	// U+E162 ()
-	{ 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f },	// U+E163 ()
-	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x3c, 0x18 },	// U+E164 ()
-	{ 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8 },	// U+E165 ()
-	{ 0xe7, 0xc3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E166 ()
-	{ 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0xe0 },	// U+E167 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xc3, 0xe7 },	// U+E168 ()
-	{ 0x07, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x07 },	// U+E169 ()
-	{ 0xff, 0x7e, 0x3c, 0x18, 0x18, 0x3c, 0x7e, 0xff },	// U+E16A ()
-	{ 0x81, 0xc3, 0xe7, 0xff, 0xff, 0xe7, 0xc3, 0x81 },	// U+E16B ()
-	{ 0xff, 0xff, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+E16C ()
-	{ 0xff, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0 },	// U+E16D ()
-	{ 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff },	// U+E16E ()
-	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff },	// U+E16F ()
-	{ 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+E170 ()
-	{ 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+E171 ()
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+E172 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 },	// U+E173 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00 },	// U+E174 ()
-	{ 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06 },	// U+E175 ()
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+E176 ()
-	{ 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30 },	// U+E177 ()
-	{ 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60 },	// U+E178 ()
-	{ 0x07, 0x1c, 0x70, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+E179 ()
-	{ 0x00, 0x00, 0x00, 0x01, 0x07, 0x1c, 0x70, 0xc0 },	// U+E17A ()
-	{ 0x00, 0x00, 0x00, 0x80, 0xe0, 0x38, 0x0e, 0x03 },	// U+E17B ()
-	{ 0xe0, 0x38, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+E17C ()
-	{ 0x01, 0x03, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18 },	// U+E17D ()
-	{ 0x18, 0x30, 0x30, 0x60, 0x60, 0xc0, 0xc0, 0x80 },	// U+E17E ()
-	{ 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x03, 0x03, 0x01 },	// U+E17F ()
-	{ 0x80, 0xc0, 0xc0, 0x60, 0x60, 0x30, 0x30, 0x18 },	// U+E180 ()
-	{ 0x07, 0x1c, 0x70, 0xc0, 0x70, 0x1c, 0x07, 0x00 },	// U+E181 ()
-	{ 0xe0, 0x38, 0x0e, 0x03, 0x0c, 0x38, 0xe0, 0x00 },	// U+E182 ()
-	{ 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x3c, 0x18, 0x18 },	// U+E183 ()
-	{ 0x18, 0x18, 0x3c, 0x3c, 0x66, 0x66, 0xc3, 0xc3 },	// U+E184 ()
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+E185 ()
-	{ 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00 },	// U+E186 ()
-	{ 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00 },	// U+E187 ()
-	{ 0x00, 0x2a, 0x54, 0x2a, 0x54, 0x2a, 0x54, 0x00 },	// U+E188 ()
-	{ 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x7e, 0x7e, 0x7e },	// U+E189 ()
-	{ 0x7e, 0x7e, 0x7e, 0x3c, 0x3c, 0x18, 0x00, 0x00 },	// U+E18A ()
-	{ 0xe0, 0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff },	// U+E18B ()
-	{ 0x07, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xff },	// U+E18C ()
-	{ 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x07 },	// U+E18D ()
-	{ 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0 },	// U+E18E ()
-	{ 0x24, 0x42, 0x81, 0x00, 0x00, 0x81, 0x42, 0x24 },	// U+E18F ()
-	{ 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00 },	// U+E190 ()
-	{ 0x04, 0x00, 0x40, 0x00, 0x04, 0x00, 0x40, 0x00 },	// U+E191 ()
-	{ 0x44, 0x00, 0x11, 0x00, 0x44, 0x00, 0x11, 0x00 },	// U+E192 ()
-	{ 0x11, 0x00, 0xaa, 0x00, 0x44, 0x00, 0xaa, 0x00 },	// U+E193 ()
-	{ 0xff, 0xdd, 0xff, 0x77, 0xff, 0xdd, 0xff, 0x77 },	// U+E194 ()
-	{ 0xfd, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xdf, 0xff },	// U+E195 ()
-	{ 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff },	// U+E196 ()
-	{ 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 },	// U+E197 ()
-	{ 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00 },	// U+E198 ()
-	{ 0x33, 0x33, 0xcc, 0xcc, 0x33, 0x33, 0xcc, 0xcc },	// U+E199 ()
-	{ 0xcc, 0x66, 0x33, 0x99, 0xcc, 0x66, 0x33, 0x99 },	// U+E19A ()
-	{ 0x33, 0x66, 0xcc, 0x99, 0x33, 0x66, 0xcc, 0x99 },	// U+E19B ()
-}; // 284
-
-static const unsigned char alt_block100[][8] = {
-	{ 0x03, 0x03, 0x03, 0xff, 0xff, 0x03, 0x03, 0x03 },	// U+E800 ()
-	{ 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E801 ()
-	{ 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xc0, 0xc0, 0xc0 },	// U+E802 ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff },	// U+E803 ()
-	{ 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+E804 ()
-	{ 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+E805 ()
-	{ 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00 },	// U+E806 ()
-	{ 0xf0, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0 },	// U+E807 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xff, 0xff },	// U+E808 ()
-	{ 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xf0 },	// U+E809 ()
-	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xff, 0xff },	// U+E80A ()
-	{ 0x03, 0x03, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+E80B ()
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x03, 0x03 },	// U+E80C ()
-	{ 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E80D ()
-	{ 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E80E ()
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0xc0, 0xc0 },	// U+E80F ()
-	{ 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x00 },	// U+E810 ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f },	// U+E811 ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8 },	// U+E812 ()
-	{ 0x03, 0x0e, 0x38, 0x60, 0x60, 0xc0, 0xc0, 0x80 },	// U+E813 ()
-	{ 0x01, 0x03, 0x03, 0x06, 0x06, 0x1c, 0x70, 0xc0 },	// U+E814 ()
-	{ 0xc0, 0x70, 0x1c, 0x06, 0x06, 0x03, 0x03, 0x01 },	// U+E815 ()
-	{ 0x80, 0xc0, 0xc0, 0x60, 0x60, 0x38, 0x0e, 0x03 },	// U+E816 ()
-	{ 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00 },	// U+E817 ()
-	{ 0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x00 },	// U+E818 ()
-	{ 0x18, 0x3c, 0x66, 0xc3, 0x81, 0x00, 0x00, 0x00 },	// U+E819 ()
-	{ 0x00, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18 },	// U+E81A ()
-	{ 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18 },	// U+E81B ()
-	{ 0x18, 0x30, 0x60, 0xc0, 0xc0, 0x60, 0x30, 0x18 },	// U+E81C ()
-	{ 0x18, 0x3c, 0x66, 0xc3, 0xc1, 0x60, 0x30, 0x18 },	// U+E81D ()
-	{ 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0c, 0x18 },	// U+E81E ()
-	{ 0x00, 0x00, 0x00, 0x81, 0xc3, 0x66, 0x3c, 0x18 },	// U+E81F ()
-	{ 0x18, 0x0c, 0x06, 0x83, 0xc3, 0x66, 0x3c, 0x18 },	// U+E820 ()
-	{ 0x18, 0x30, 0x60, 0xc1, 0xc3, 0x66, 0x3c, 0x18 },	// U+E821 ()
-	{ 0x03, 0x06, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+E822 ()
-	{ 0xc0, 0x60, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+E823 ()
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+E824 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xc0, 0x80 },	// U+E825 ()
-	{ 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E826 ()
-	{ 0xc0, 0x60, 0x30, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E827 ()
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E828 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x06, 0x03, 0x01 },	// U+E829 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x66, 0xc3, 0x81 },	// U+E82A ()
-	{ 0x03, 0x06, 0x0c, 0x18, 0x3c, 0x66, 0xc3, 0x81 },	// U+E82B ()
-	{ 0xc0, 0x60, 0x30, 0x18, 0x3c, 0x66, 0xc3, 0x81 },	// U+E82C ()
-	{ 0x03, 0x06, 0x0c, 0x1f, 0x1f, 0x06, 0x03, 0x01 },	// U+E82D ()
-	{ 0x18, 0x18, 0x18, 0x1f, 0x3f, 0x60, 0xc0, 0x80 },	// U+E82E ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x3c, 0x66, 0xc3, 0x81 },	// U+E82F ()
-	{ 0xd8, 0x78, 0x38, 0xf8, 0xf8, 0x00, 0x00, 0x00 },	// U+E830 ()
-	{ 0xc0, 0x60, 0x30, 0xf8, 0xf8, 0x60, 0xc0, 0x80 },	// U+E831 ()
-	{ 0x03, 0x06, 0x0c, 0xf8, 0xf8, 0x18, 0x18, 0x18 },	// U+E832 ()
-	{ 0xc3, 0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E833 ()
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1e, 0x1b, 0x19 },	// U+E834 ()
-	{ 0x03, 0x06, 0x0c, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+E835 ()
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x06, 0x03, 0x01 },	// U+E836 ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x0c, 0x06, 0x03, 0x01 },	// U+E837 ()
-	{ 0x18, 0x18, 0x18, 0x18, 0x30, 0x60, 0xc0, 0x80 },	// U+E838 ()
-	{ 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x60, 0xc0, 0x80 },	// U+E839 ()
-	{ 0xc0, 0x60, 0x30, 0xf8, 0xf8, 0x00, 0x00, 0x00 },	// U+E83A ()
-	{ 0xc0, 0x60, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E83B ()
-	{ 0x03, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x18 },	// U+E83C ()
-	{ 0x40, 0x04, 0x80, 0x10, 0x02, 0x20, 0x01, 0x08 },	// U+E83D ()
-	{ 0x90, 0x04, 0x20, 0x01, 0x88, 0x02, 0x10, 0x40 },	// U+E83E ()
-	{ 0x11, 0x40, 0x02, 0x00, 0x11, 0x82, 0x00, 0x89 },	// U+E83F ()
-	{ 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc },	// U+E840 ()
-	{ 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00 },	// U+E841 ()
-	{ 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22 },	// U+E842 ()
-	{ 0x00, 0xaa, 0x00, 0x22, 0x00, 0xaa, 0x00, 0x22 },	// U+E843 ()
-	{ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xff, 0x20 },	// U+E844 ()
-	{ 0x82, 0x01, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44 },	// U+E845 ()
-	{ 0x80, 0x80, 0xff, 0x08, 0x08, 0x08, 0xff, 0x80 },	// U+E846 ()
-	{ 0x82, 0x45, 0xaa, 0x45, 0x82, 0x01, 0x00, 0x01 },	// U+E847 ()
-	{ 0x10, 0x10, 0x55, 0x82, 0x01, 0x01, 0x55, 0x28 },	// U+E848 ()
-	{ 0xc7, 0xc7, 0xbb, 0x64, 0x7c, 0x7c, 0xbb, 0x46 },	// U+E849 ()
-	{ 0x11, 0x0a, 0x44, 0x00, 0x55, 0x00, 0x44, 0xa0 },	// U+E84A ()
-	{ 0x02, 0x00, 0x22, 0x00, 0x02, 0x00, 0xaa, 0x00 },	// U+E84B ()
-	{ 0x01, 0x00, 0x10, 0x20, 0x40, 0x00, 0x04, 0x02 },	// U+E84C ()
-	{ 0x55, 0xff, 0x40, 0x20, 0x10, 0x08, 0x04, 0x2a },	// U+E84D ()
-	{ 0x6c, 0x0c, 0xc0, 0xc6, 0x36, 0x30, 0x03, 0x63 },	// U+E84E ()
-	{ 0x44, 0x44, 0x44, 0x82, 0x01, 0x10, 0x28, 0x44 },	// U+E84F ()
-	{ 0x44, 0x82, 0x01, 0x01, 0x01, 0x82, 0x44, 0x39 },	// U+E850 ()
-}; // 81
-
-static const unsigned char alt_block101[][8] = {
-	{ 0x60, 0x90, 0x09, 0x06, 0x60, 0x90, 0x09, 0x06 },	// U+EC00 ()
-	{ 0x72, 0x4e, 0xcf, 0xfc, 0xe4, 0x27, 0x3f, 0xf3 },	// U+EC01 ()
-	{ 0xa5, 0x42, 0xa5, 0x00, 0x00, 0xa5, 0x42, 0xa5 },	// U+EC02 ()
-	{ 0x00, 0x4a, 0x2c, 0x60, 0x06, 0x34, 0x52, 0x00 },	// U+EC03 ()
-	{ 0x00, 0x08, 0x34, 0x5c, 0x3a, 0x2c, 0x20, 0x00 },	// U+EC04 ()
-	{ 0x4a, 0x22, 0xb4, 0x23, 0x88, 0x2d, 0xc4, 0x52 },	// U+EC05 ()
-	{ 0x89, 0x4a, 0x00, 0xc0, 0x03, 0x00, 0x52, 0x91 },	// U+EC06 ()
-	{ 0x18, 0x18, 0x3c, 0x7e, 0xff, 0xdb, 0x18, 0x3c },	// U+EC07 ()
-	{ 0x3c, 0x18, 0xdb, 0xff, 0x7e, 0x3c, 0x18, 0x18 },	// U+EC08 ()
-	{ 0x30, 0x38, 0x9c, 0xff, 0xff, 0x9c, 0x38, 0x30 },	// U+EC09 ()
-	{ 0x5d, 0x77, 0x55, 0x1c, 0x1c, 0x5d, 0x7f, 0x5d },	// U+EC0A ()
-	{ 0x44, 0xc6, 0xef, 0xed, 0xff, 0x7e, 0x3c, 0x3c },	// U+EC0B ()
-	{ 0x3c, 0x7e, 0xff, 0xfd, 0xff, 0x7e, 0x3c, 0x3c },	// U+EC0C ()
-	{ 0x3c, 0x3c, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x18 },	// U+EC0D ()
-	{ 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x3c, 0x3c },	// U+EC0E ()
-	{ 0x00, 0x00, 0xde, 0xff, 0xff, 0xde, 0x00, 0x00 },	// U+EC0F ()
-	{ 0x00, 0x00, 0x7b, 0xff, 0xff, 0x7b, 0x00, 0x00 },	// U+EC10 ()
-	{ 0x04, 0x06, 0x04, 0x04, 0x0c, 0x14, 0x3c, 0x3c },	// U+EC11 ()
-	{ 0x00, 0x0c, 0x1a, 0xbf, 0xff, 0x9e, 0x0c, 0x00 },	// U+EC12 ()
-	{ 0x00, 0x30, 0x58, 0xfd, 0xff, 0x79, 0x30, 0x00 },	// U+EC13 ()
-	{ 0x00, 0x0c, 0x1a, 0xbf, 0xfc, 0x9f, 0x0c, 0x00 },	// U+EC14 ()
-	{ 0x00, 0x30, 0x58, 0xfd, 0x3f, 0xf9, 0x30, 0x00 },	// U+EC15 ()
-	{ 0x08, 0x14, 0x16, 0x3d, 0x3f, 0x1e, 0x08, 0x1c },	// U+EC16 ()
-	{ 0x00, 0x00, 0x3f, 0x38, 0xfe, 0xc6, 0x7c, 0x00 },	// U+EC17 ()
-	{ 0x1c, 0x1c, 0x49, 0x3e, 0x08, 0x14, 0x14, 0x14 },	// U+EC18 ()
-	{ 0x1c, 0x1c, 0x08, 0x7f, 0x08, 0x14, 0x22, 0x41 },	// U+EC19 ()
-	{ 0x1c, 0x1c, 0x48, 0x3e, 0x09, 0x14, 0x24, 0x44 },	// U+EC1A ()
-	{ 0x1c, 0x1c, 0x09, 0x3e, 0x48, 0x14, 0x12, 0x11 },	// U+EC1B ()
-	{ 0x10, 0x28, 0x10, 0x38, 0x54, 0x28, 0x7c, 0x28 },	// U+EC1C ()
-	{ 0x81, 0xc3, 0xe7, 0xff, 0xff, 0x99, 0x24, 0xc3 },	// U+EC1D ()
-	{ 0x82, 0x45, 0x3c, 0x5a, 0x7e, 0xff, 0x42, 0xc6 },	// U+EC1E ()
-	{ 0x41, 0xa2, 0x3c, 0x5a, 0x7e, 0xff, 0x42, 0x63 },	// U+EC1F ()
-	{ 0x00, 0x5a, 0xbd, 0x99, 0x24, 0x42, 0x24, 0x00 },	// U+EC20 ()
-	{ 0x81, 0xa5, 0x5a, 0x18, 0x18, 0x24, 0xc3, 0x00 },	// U+EC21 ()
-	{ 0x3c, 0x5a, 0xff, 0xd5, 0xab, 0xff, 0xbb, 0x91 },	// U+EC22 ()
-	{ 0x3c, 0x5a, 0xff, 0xd5, 0xab, 0xff, 0xee, 0x44 },	// U+EC23 ()
-	{ 0x3c, 0x42, 0xa5, 0x81, 0x99, 0x81, 0xab, 0x55 },	// U+EC24 ()
-	{ 0x3c, 0x42, 0xa5, 0x81, 0x99, 0x81, 0xd5, 0xaa },	// U+EC25 ()
-	{ 0x7e, 0xff, 0x99, 0xff, 0xc3, 0xbd, 0xff, 0x7e },	// U+EC26 ()
-}; // 39
-
-static const unsigned char alt_block102[][8] = {
-	{ 0x38, 0x04, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+FE81 (ﺁ)
-	{ 0x1c, 0x0a, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00 },	// U+FE82 (ﺂ)
-}; // 2
-
-static const unsigned char alt_block103[][8] = {
-	{ 0x0c, 0x06, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00 },	// U+FE84 (ﺄ)
-}; // 1
-
-static const unsigned char alt_block104[][8] = {
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x18, 0x0c },	// U+FE87 (ﺇ)
-}; // 1
-
-static const unsigned char alt_block105[][8] = {
-	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+FE8F (ﺏ)
-	{ 0x00, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x18, 0x00 },	// U+FE90 (ﺐ)
-	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x18, 0x00 },	// U+FE91 (ﺑ)
-	{ 0x00, 0x00, 0x10, 0x10, 0xef, 0x00, 0x18, 0x00 },	// U+FE92 (ﺒ)
-	{ 0xd8, 0x00, 0xf0, 0x90, 0xf0, 0x00, 0x00, 0x00 },	// U+FE93 (ﺓ)
-	{ 0xd8, 0x00, 0xf0, 0x90, 0xf0, 0x00, 0x00, 0x00 },	// U+FE94 (ﺔ)
-	{ 0x6c, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FE95 (ﺕ)
-	{ 0x6c, 0x00, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FE96 (ﺖ)
-	{ 0x6c, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+FE97 (ﺗ)
-	{ 0x6c, 0x00, 0x10, 0x10, 0xef, 0x00, 0x00, 0x00 },	// U+FE98 (ﺘ)
-	{ 0x18, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FE99 (ﺙ)
-	{ 0x18, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FE9A (ﺚ)
-	{ 0x18, 0x66, 0x00, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+FE9B (ﺛ)
-	{ 0x18, 0x66, 0x00, 0x10, 0xef, 0x00, 0x00, 0x00 },	// U+FE9C (ﺜ)
-}; // 14
-
-static const unsigned char alt_block106[][8] = {
-	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x34, 0xf8 },	// U+FE9E (ﺞ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x30, 0x00 },	// U+FE9F (ﺟ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x30, 0x00 },	// U+FEA0 (ﺠ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x04, 0xf8 },	// U+FEA1 (ﺡ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xf8, 0x04, 0x04, 0xf8 },	// U+FEA2 (ﺢ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x00, 0x00 },	// U+FEA3 (ﺣ)
-	{ 0x00, 0x00, 0x38, 0x40, 0xff, 0x00, 0x00, 0x00 },	// U+FEA4 (ﺤ)
-}; // 7
-
-static const unsigned char alt_block107[][8] = {
-	{ 0x00, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+FEA9 (ﺩ)
-	{ 0x00, 0x18, 0x20, 0x40, 0xbf, 0x00, 0x00, 0x00 },	// U+FEAA (ﺪ)
-	{ 0x0c, 0x20, 0x40, 0x88, 0xf8, 0x00, 0x00, 0x00 },	// U+FEAB (ﺫ)
-	{ 0x06, 0x10, 0x20, 0x40, 0xbf, 0x00, 0x00, 0x00 },	// U+FEAC (ﺬ)
-	{ 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+FEAD (ﺭ)
-}; // 5
-
-static const unsigned char alt_block108[][8] = {
-	{ 0x00, 0xc0, 0x00, 0x80, 0x80, 0x40, 0x3c, 0x00 },	// U+FEAF (ﺯ)
-}; // 1
-
-static const unsigned char alt_block109[][8] = {
-	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB1 (ﺱ)
-	{ 0x00, 0x00, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB2 (ﺲ)
-	{ 0x00, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x00, 0x00 },	// U+FEB3 (ﺳ)
-	{ 0x00, 0x00, 0x00, 0xa8, 0xff, 0x00, 0x00, 0x00 },	// U+FEB4 (ﺴ)
-	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB5 (ﺵ)
-	{ 0x20, 0x50, 0x00, 0xaa, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB6 (ﺶ)
-	{ 0x20, 0x50, 0x00, 0xa8, 0xff, 0x00, 0x00, 0x00 },	// U+FEB7 (ﺷ)
-}; // 7
-
-static const unsigned char alt_block110[][8] = {
-	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEB9 (ﺹ)
-	{ 0x00, 0x00, 0xe0, 0x9a, 0xfa, 0x0a, 0x04, 0x00 },	// U+FEBA (ﺺ)
-	{ 0x00, 0x00, 0xe0, 0x94, 0xff, 0x00, 0x00, 0x00 },	// U+FEBB (ﺻ)
-	{ 0x00, 0x00, 0xe0, 0x94, 0xff, 0x00, 0x00, 0x00 },	// U+FEBC (ﺼ)
-}; // 4
-
-static const unsigned char alt_block111[][8] = {
-	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC1 (ﻁ)
-	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC2 (ﻂ)
-	{ 0x08, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC3 (ﻃ)
-	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC4 (ﻄ)
-	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC5 (ﻅ)
-	{ 0x68, 0x08, 0xe8, 0x98, 0xff, 0x00, 0x00, 0x00 },	// U+FEC6 (ﻆ)
-}; // 6
-
-static const unsigned char alt_block112[][8] = {
-	{ 0x00, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+FEC9 (ﻉ)
-	{ 0x00, 0x00, 0x3c, 0x18, 0xf4, 0x02, 0x7c, 0x00 },	// U+FECA (ﻊ)
-	{ 0x00, 0x70, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00 },	// U+FECB (ﻋ)
-	{ 0x00, 0x00, 0xf0, 0x60, 0xdf, 0x00, 0x00, 0x00 },	// U+FECC (ﻌ)
-	{ 0x0c, 0x70, 0x10, 0x78, 0x04, 0x04, 0x78, 0x00 },	// U+FECD (ﻍ)
-	{ 0x18, 0x00, 0x3c, 0x18, 0xf4, 0x02, 0x7c, 0x00 },	// U+FECE (ﻎ)
-	{ 0x06, 0x70, 0x08, 0x08, 0x7f, 0x00, 0x00, 0x00 },	// U+FECF (ﻏ)
-	{ 0x60, 0x00, 0xf0, 0x60, 0xdf, 0x00, 0x00, 0x00 },	// U+FED0 (ﻐ)
-	{ 0x60, 0x00, 0xf1, 0x91, 0xfe, 0x00, 0x00, 0x00 },	// U+FED1 (ﻑ)
-	{ 0x60, 0x00, 0xe0, 0xa0, 0xff, 0x00, 0x00, 0x00 },	// U+FED2 (ﻒ)
-	{ 0x60, 0x00, 0xe0, 0xa0, 0xff, 0x00, 0x00, 0x00 },	// U+FED3 (ﻓ)
-	{ 0x18, 0x00, 0x38, 0x28, 0xff, 0x00, 0x00, 0x00 },	// U+FED4 (ﻔ)
-	{ 0xd8, 0x00, 0xf0, 0x91, 0xf1, 0x81, 0x7e, 0x00 },	// U+FED5 (ﻕ)
-	{ 0xd8, 0x00, 0xf0, 0x90, 0xff, 0x00, 0x00, 0x00 },	// U+FED6 (ﻖ)
-	{ 0xd8, 0x00, 0xf0, 0x90, 0xff, 0x00, 0x00, 0x00 },	// U+FED7 (ﻗ)
-	{ 0x6c, 0x00, 0x38, 0x28, 0xff, 0x00, 0x00, 0x00 },	// U+FED8 (ﻘ)
-	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FED9 (ﻙ)
-	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FEDA (ﻚ)
-	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FEDB (ﻛ)
-	{ 0x80, 0xb0, 0x9a, 0x82, 0x7c, 0x00, 0x00, 0x00 },	// U+FEDC (ﻜ)
-	{ 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x7e, 0x00 },	// U+FEDD (ﻝ)
-}; // 21
-
-static const unsigned char alt_block113[][8] = {
-	{ 0x80, 0x80, 0x80, 0x80, 0x7f, 0x00, 0x00, 0x00 },	// U+FEDF (ﻟ)
-	{ 0x80, 0x80, 0x80, 0x80, 0x7f, 0x00, 0x00, 0x00 },	// U+FEE0 (ﻠ)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xb8, 0x44, 0x04, 0x04 },	// U+FEE1 (ﻡ)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xb8, 0x44, 0x04, 0x04 },	// U+FEE2 (ﻢ)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xbf, 0x40, 0x00, 0x00 },	// U+FEE3 (ﻣ)
-}; // 5
-
-static const unsigned char alt_block114[][8] = {
-	{ 0x18, 0x81, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FEE5 (ﻥ)
-	{ 0x18, 0x81, 0x81, 0x81, 0x7e, 0x00, 0x00, 0x00 },	// U+FEE6 (ﻦ)
-	{ 0x30, 0x00, 0x40, 0x40, 0x3f, 0x00, 0x00, 0x00 },	// U+FEE7 (ﻧ)
-	{ 0x30, 0x00, 0x10, 0x10, 0xef, 0x00, 0x00, 0x00 },	// U+FEE8 (ﻨ)
-	{ 0x00, 0x00, 0xe0, 0xa0, 0xe0, 0x00, 0x00, 0x00 },	// U+FEE9 (ﻩ)
-}; // 5
-
-static const unsigned char alt_block115[][8] = {
-	{ 0x00, 0x70, 0x80, 0xb0, 0xff, 0x00, 0x00, 0x00 },	// U+FEEB (ﻫ)
-	{ 0x00, 0x70, 0x80, 0xb0, 0xff, 0x00, 0x00, 0x00 },	// U+FEEC (ﻬ)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x7c, 0x00 },	// U+FEED (ﻭ)
-	{ 0x00, 0x00, 0x40, 0xa0, 0xe0, 0x80, 0x7c, 0x00 },	// U+FEEE (ﻮ)
-	{ 0x00, 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00 },	// U+FEEF (ﻯ)
-	{ 0x00, 0x00, 0x00, 0x70, 0x91, 0x21, 0x3e, 0x00 },	// U+FEF0 (ﻰ)
-	{ 0x00, 0xc0, 0x20, 0xc2, 0x82, 0x7c, 0x00, 0x6c },	// U+FEF1 (ﻱ)
-	{ 0x00, 0x00, 0x00, 0x70, 0x91, 0x21, 0x7e, 0x6c },	// U+FEF2 (ﻲ)
-	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x28, 0x00 },	// U+FEF3 (ﻳ)
-	{ 0x00, 0x00, 0x80, 0x80, 0x7f, 0x00, 0x28, 0x00 },	// U+FEF4 (ﻴ)
-}; // 10
-
-static const unsigned char alt_block116[][8] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x1c, 0x00 },	// U+FF61 (｡)
-	{ 0x78, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+FF62 (｢)
-	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x1e, 0x00 },	// U+FF63 (｣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x0c, 0x18, 0x00 },	// U+FF64 (､)
-	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+FF65 (･)
-	{ 0x7e, 0x60, 0x7e, 0x60, 0x30, 0x18, 0x0c, 0x00 },	// U+FF66 (ｦ)
-	{ 0x00, 0x00, 0x7f, 0x30, 0x1a, 0x0e, 0x03, 0x00 },	// U+FF67 (ｧ)
-	{ 0x00, 0x38, 0x1c, 0x1e, 0x1b, 0x18, 0x18, 0x00 },	// U+FF68 (ｨ)
-	{ 0x00, 0x18, 0x7e, 0x66, 0x60, 0x30, 0x18, 0x00 },	// U+FF69 (ｩ)
-	{ 0x00, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+FF6A (ｪ)
-	{ 0x00, 0x30, 0x7f, 0x3c, 0x36, 0x33, 0x30, 0x00 },	// U+FF6B (ｫ)
-	{ 0x00, 0x06, 0x7f, 0x66, 0x36, 0x06, 0x06, 0x00 },	// U+FF6C (ｬ)
-	{ 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x7e, 0x00 },	// U+FF6D (ｭ)
-	{ 0x00, 0x00, 0x3e, 0x30, 0x3e, 0x30, 0x3e, 0x00 },	// U+FF6E (ｮ)
-	{ 0x00, 0x00, 0x6a, 0x6a, 0x60, 0x30, 0x18, 0x00 },	// U+FF6F (ｯ)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+FF70 (ｰ)
-	{ 0x7e, 0x60, 0x68, 0x38, 0x18, 0x18, 0x0c, 0x00 },	// U+FF71 (ｱ)
-	{ 0x30, 0x18, 0x1c, 0x1e, 0x1b, 0x18, 0x18, 0x00 },	// U+FF72 (ｲ)
-	{ 0x18, 0x7e, 0x66, 0x66, 0x60, 0x30, 0x18, 0x00 },	// U+FF73 (ｳ)
-	{ 0x00, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00 },	// U+FF74 (ｴ)
-	{ 0x30, 0x7f, 0x38, 0x3c, 0x36, 0x33, 0x30, 0x00 },	// U+FF75 (ｵ)
-	{ 0x0c, 0x7f, 0x6c, 0x6c, 0x6c, 0x66, 0x63, 0x00 },	// U+FF76 (ｶ)
-	{ 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x00 },	// U+FF77 (ｷ)
-	{ 0x7e, 0x66, 0x63, 0x60, 0x60, 0x30, 0x18, 0x00 },	// U+FF78 (ｸ)
-	{ 0x06, 0x7e, 0x36, 0x33, 0x30, 0x30, 0x18, 0x00 },	// U+FF79 (ｹ)
-	{ 0x00, 0x7e, 0x60, 0x60, 0x60, 0x60, 0x7e, 0x00 },	// U+FF7A (ｺ)
-	{ 0x36, 0x7f, 0x36, 0x36, 0x30, 0x30, 0x18, 0x00 },	// U+FF7B (ｻ)
-	{ 0x00, 0x06, 0x60, 0x66, 0x60, 0x30, 0x1e, 0x00 },	// U+FF7C (ｼ)
-	{ 0x00, 0x3f, 0x30, 0x18, 0x1c, 0x36, 0x63, 0x00 },	// U+FF7D (ｽ)
-	{ 0x06, 0x7f, 0x66, 0x36, 0x06, 0x06, 0x3c, 0x00 },	// U+FF7E (ｾ)
-	{ 0x63, 0x63, 0x66, 0x60, 0x30, 0x18, 0x0c, 0x00 },	// U+FF7F (ｿ)
-	{ 0x7e, 0x66, 0x7e, 0x63, 0x60, 0x30, 0x18, 0x00 },	// U+FF80 (ﾀ)
-	{ 0x60, 0x3e, 0x18, 0x7e, 0x18, 0x18, 0x0c, 0x00 },	// U+FF81 (ﾁ)
-	{ 0x6a, 0x6a, 0x6a, 0x60, 0x60, 0x30, 0x18, 0x00 },	// U+FF82 (ﾂ)
-	{ 0x3c, 0x00, 0x7e, 0x18, 0x18, 0x18, 0x0c, 0x00 },	// U+FF83 (ﾃ)
-	{ 0x06, 0x06, 0x1e, 0x36, 0x66, 0x06, 0x06, 0x00 },	// U+FF84 (ﾄ)
-	{ 0x18, 0x7e, 0x18, 0x18, 0x18, 0x18, 0x0c, 0x00 },	// U+FF85 (ﾅ)
-	{ 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00 },	// U+FF86 (ﾆ)
-	{ 0x00, 0x3f, 0x30, 0x1f, 0x1c, 0x36, 0x63, 0x00 },	// U+FF87 (ﾇ)
-	{ 0x0c, 0x7f, 0x30, 0x3c, 0x6f, 0x0c, 0x0c, 0x00 },	// U+FF88 (ﾈ)
-	{ 0x60, 0x60, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x00 },	// U+FF89 (ﾉ)
-	{ 0x18, 0x30, 0x66, 0x66, 0x66, 0x66, 0x63, 0x00 },	// U+FF8A (ﾊ)
-	{ 0x06, 0x06, 0x7e, 0x06, 0x06, 0x06, 0x7c, 0x00 },	// U+FF8B (ﾋ)
-	{ 0x7e, 0x60, 0x60, 0x60, 0x30, 0x18, 0x0c, 0x00 },	// U+FF8C (ﾌ)
-	{ 0x00, 0x0c, 0x1e, 0x33, 0x60, 0x60, 0x00, 0x00 },	// U+FF8D (ﾍ)
-	{ 0x18, 0x7e, 0x18, 0x18, 0x5a, 0x5a, 0x18, 0x00 },	// U+FF8E (ﾎ)
-	{ 0x00, 0x7e, 0x60, 0x60, 0x36, 0x0c, 0x18, 0x00 },	// U+FF8F (ﾏ)
-	{ 0x3e, 0x00, 0x1c, 0x00, 0x00, 0x3e, 0x60, 0x00 },	// U+FF90 (ﾐ)
-	{ 0x18, 0x0c, 0x06, 0x03, 0x33, 0x63, 0x7f, 0x00 },	// U+FF91 (ﾑ)
-	{ 0x30, 0x30, 0x36, 0x1c, 0x1c, 0x36, 0x03, 0x00 },	// U+FF92 (ﾒ)
-	{ 0x7c, 0x18, 0x7e, 0x18, 0x18, 0x18, 0x70, 0x00 },	// U+FF93 (ﾓ)
-	{ 0x06, 0x7f, 0x66, 0x66, 0x36, 0x06, 0x06, 0x00 },	// U+FF94 (ﾔ)
-	{ 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x7e, 0x00 },	// U+FF95 (ﾕ)
-	{ 0x00, 0x7e, 0x60, 0x7e, 0x60, 0x60, 0x7e, 0x00 },	// U+FF96 (ﾖ)
-	{ 0x3c, 0x00, 0x7e, 0x60, 0x60, 0x30, 0x18, 0x00 },	// U+FF97 (ﾗ)
-	{ 0x66, 0x66, 0x66, 0x66, 0x66, 0x30, 0x18, 0x00 },	// U+FF98 (ﾘ)
-	{ 0x30, 0x36, 0x36, 0x36, 0x36, 0x76, 0x33, 0x00 },	// U+FF99 (ﾙ)
-	{ 0x06, 0x06, 0x06, 0x66, 0x66, 0x36, 0x1e, 0x00 },	// U+FF9A (ﾚ)
-	{ 0x00, 0x7f, 0x63, 0x63, 0x63, 0x63, 0x7f, 0x00 },	// U+FF9B (ﾛ)
-	{ 0x7f, 0x63, 0x63, 0x60, 0x60, 0x30, 0x18, 0x00 },	// U+FF9C (ﾜ)
-	{ 0x00, 0x06, 0x00, 0x60, 0x60, 0x30, 0x1e, 0x00 },	// U+FF9D (ﾝ)
-	{ 0x33, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9E (ﾞ)
-	{ 0x1c, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FF9F (ﾟ)
-}; // 63
-
@@ -4,101 +4,125 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const uint32_t block_block1[][32] = {
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0020 ( )
-	{ 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00007f00, 0x00003f00, 0x00001f00, 0x00000f00, 0x00000700, 0x00000300, 0x00000100, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+0021 (!)
-	{ 0x00808000, 0x00c0c000, 0x00e0e000, 0x00f0f000, 0x00f8f800, 0x00fcfc00, 0x00fefe00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0022 (")
-	{ 0x00800100, 0x00c00300, 0x00e00700, 0x00f00f00, 0x00f81f00, 0x00fc3f00, 0x00fe7f00, 0x00ffff00, 0xffffffff, 0x7ffe7ffe, 0x3ffc3ffc, 0x1ff81ff8, 0x0ff00ff0, 0x07e007e0, 0x03c003c0, 0x01800180, 0x01800180, 0x03c003c0, 0x07e007e0, 0x0ff00ff0, 0x1ff81ff8, 0x3ffc3ffc, 0x7ffe7ffe, 0xffffffff, 0x00ffff00, 0x00fe7f00, 0x00fc3f00, 0x00f81f00, 0x00f00f00, 0x00e00700, 0x00c00300, 0x00800100 },	// U+0023 (#)
-	{ 0x00010100, 0x00030300, 0x00070700, 0x000f0f00, 0x001f1f00, 0x003f3f00, 0x007f7f00, 0x00ffff00, 0xffffff00, 0x7fffff00, 0x3fffff00, 0x1fffff00, 0x0fffff00, 0x07ffff00, 0x03ffff00, 0x01ffff00, 0x00ffff80, 0x00ffffc0, 0x00ffffe0, 0x00fffff0, 0x00fffff8, 0x00fffffc, 0x00fffffe, 0x00ffffff, 0x00ffff00, 0x007f7f00, 0x003f3f00, 0x001f1f00, 0x000f0f00, 0x00070700, 0x00030300, 0x00010100 },	// U+0024 ($)
-	{ 0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xf8000000, 0xfc000000, 0xfe000000, 0xff000000, 0xff80ff00, 0x7fc0ff00, 0x3fe0ff00, 0x1ff0ff00, 0x0ff8ff00, 0x07fcff00, 0x03feff00, 0x01ffff00, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x00ffff80, 0x00ff7fc0, 0x00ff3fe0, 0x00ff1ff0, 0x00ff0ff8, 0x00ff07fc, 0x00ff03fe, 0x00ff01ff },	// U+0025 (%)
-	{ 0x00018000, 0x0003c000, 0x0007e000, 0x000ff000, 0x001ff800, 0x003ffc00, 0x007ffe00, 0x00ffff00, 0x00ffff00, 0x007ffe00, 0x003ffc00, 0x001ff800, 0x000ff000, 0x0007e000, 0x0003c000, 0x00018000, 0xff01ff80, 0x7f03ffc0, 0x3f07ffe0, 0x1f0ffff0, 0x0f1ffff8, 0x073ffffc, 0x037ffffe, 0x01ffffff, 0x01ffffff, 0x037ffffe, 0x073ffffc, 0x0f1ffff8, 0x1f0ffff0, 0x3f07ffe0, 0x7f03ffc0, 0xff01ff80 },	// U+0026 (&)
-	{ 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x007f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0027 (')
-	{ 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000 },	// U+0028 (()
-	{ 0x000001ff, 0x000003fe, 0x000007fc, 0x00000ff8, 0x00001ff0, 0x00003fe0, 0x00007fc0, 0x0000ff80, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff },	// U+0029 ())
-	{ 0x00800000, 0x00c00000, 0x00e00000, 0x00f00000, 0x00f80000, 0x00fc0000, 0x00fe0000, 0x00ff0000, 0x00ffffff, 0x00fffffe, 0x00fffffc, 0x00fffff8, 0x00fffff0, 0x00ffffe0, 0x00ffffc0, 0x00ffff80, 0x01ffff00, 0x03ffff00, 0x07ffff00, 0x0fffff00, 0x1fffff00, 0x3fffff00, 0x7fffff00, 0xffffff00, 0x0000ff00, 0x00007f00, 0x00003f00, 0x00001f00, 0x00000f00, 0x00000700, 0x00000300, 0x00000100 },	// U+002A (*)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000 },	// U+002B (+)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x007f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000 },	// U+002C (,)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+002D (-)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+002E (.)
-	{ 0x80000000, 0xc0000000, 0xe0000000, 0xf0000000, 0xf8000000, 0xfc000000, 0xfe000000, 0xff000000, 0xff800000, 0x7fc00000, 0x3fe00000, 0x1ff00000, 0x0ff80000, 0x07fc0000, 0x03fe0000, 0x01ff0000, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff },	// U+002F (/)
-	{ 0x0001ff80, 0x0003ffc0, 0x0007ffe0, 0x000ffff0, 0x001ffff8, 0x003ffffc, 0x007ffffe, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffffff, 0x007ffffe, 0x003ffffc, 0x001ffff8, 0x000ffff0, 0x0007ffe0, 0x0003ffc0, 0x0001ff80 },	// U+0030 (0)
-	{ 0x00008000, 0x0000c000, 0x0000e000, 0x0000f000, 0x0000f800, 0x0000fc00, 0x0000fe00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+0031 (1)
-	{ 0x00ffff80, 0x00ffffc0, 0x00ffffe0, 0x00fffff0, 0x00fffff8, 0x00fffffc, 0x00fffffe, 0x00ffffff, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff, 0x00ffffff, 0x007fffff, 0x003fffff, 0x001fffff, 0x000fffff, 0x0007ffff, 0x0003ffff, 0x0001ffff },	// U+0032 (2)
-	{ 0x0001ff80, 0x0003ffc0, 0x0007ffe0, 0x000ffff0, 0x001ffff8, 0x003ffffc, 0x007ffffe, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffff00, 0x00fffe00, 0x00fffc00, 0x00fff800, 0x00fff000, 0x00ffe000, 0x00ffc000, 0x00ff8000, 0x00ffffff, 0x007ffffe, 0x003ffffc, 0x001ffff8, 0x000ffff0, 0x0007ffe0, 0x0003ffc0, 0x0001ff80 },	// U+0033 (3)
-	{ 0x00800080, 0x00c000c0, 0x00e000e0, 0x00f000f0, 0x00f800f8, 0x00fc00fc, 0x00fe00fe, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffffff, 0x00fffffe, 0x00fffffc, 0x00fffff8, 0x00fffff0, 0x00ffffe0, 0x00ffffc0, 0x00ffff80, 0x00ff0000, 0x007f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000 },	// U+0034 (4)
-	{ 0x00ffffff, 0x007fffff, 0x003fffff, 0x001fffff, 0x000fffff, 0x0007ffff, 0x0003ffff, 0x0001ffff, 0x000001ff, 0x000003ff, 0x000007ff, 0x00000fff, 0x00001fff, 0x00003fff, 0x00007fff, 0x0000ffff, 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000, 0x00ffffff, 0x007ffffe, 0x003ffffc, 0x001ffff8, 0x000ffff0, 0x0007ffe0, 0x0003ffc0, 0x0001ff80 },	// U+0035 (5)
-	{ 0x0001ff80, 0x0003ffc0, 0x0007ffe0, 0x000ffff0, 0x001ffff8, 0x003ffffc, 0x007ffffe, 0x00ffffff, 0x000001ff, 0x000003ff, 0x000007ff, 0x00000fff, 0x00001fff, 0x00003fff, 0x00007fff, 0x0000ffff, 0x0001ffff, 0x0003feff, 0x0007fcff, 0x000ff8ff, 0x001ff0ff, 0x003fe0ff, 0x007fc0ff, 0x00ff80ff, 0x00ffffff, 0x007ffffe, 0x003ffffc, 0x001ffff8, 0x000ffff0, 0x0007ffe0, 0x0003ffc0, 0x0001ff80 },	// U+0036 (6)
-	{ 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff, 0x000000ff, 0x0000007f, 0x0000003f, 0x0000001f, 0x0000000f, 0x00000007, 0x00000003, 0x00000001 },	// U+0037 (7)
-	{ 0x00ffff80, 0x00ffffc0, 0x00ffffe0, 0x00fffff0, 0x00fffff8, 0x00fffffc, 0x00fffffe, 0x00ffffff, 0x00ff01ff, 0x007f03ff, 0x003f07ff, 0x001f0fff, 0x000f1fff, 0x00073fff, 0x00037fff, 0x0001ffff, 0x0001ff80, 0x0003fec0, 0x0007fce0, 0x000ff8f0, 0x001ff0f8, 0x003fe0fc, 0x007fc0fe, 0x00ff80ff, 0x00ffffff, 0x007fffff, 0x003fffff, 0x001fffff, 0x000fffff, 0x0007ffff, 0x0003ffff, 0x0001ffff },	// U+0038 (8)
-	{ 0x0001ff80, 0x0003ffc0, 0x0007ffe0, 0x000ffff0, 0x001ffff8, 0x003ffffc, 0x007ffffe, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ffffff, 0x00ff7ffe, 0x00ff3ffc, 0x00ff1ff8, 0x00ff0ff0, 0x00ff07e0, 0x00ff03c0, 0x00ff0180, 0x00ffff80, 0x007fffc0, 0x003fffe0, 0x001ffff0, 0x000ffff8, 0x0007fffc, 0x0003fffe, 0x0001ffff },	// U+0039 (9)
-	{ 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+003A (:)
-	{ 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x007f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000 },	// U+003B (;)
-	{ 0xff800000, 0x7fc00000, 0x3fe00000, 0x1ff00000, 0x0ff80000, 0x07fc0000, 0x03fe0000, 0x01ff0000, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000, 0x01ff0000, 0x03fe0000, 0x07fc0000, 0x0ff80000, 0x1ff00000, 0x3fe00000, 0x7fc00000, 0xff800000 },	// U+003C (<)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+003D (=)
-	{ 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000, 0x01ff0000, 0x03fe0000, 0x07fc0000, 0x0ff80000, 0x1ff00000, 0x3fe00000, 0x7fc00000, 0xff800000, 0xff800000, 0x7fc00000, 0x3fe00000, 0x1ff00000, 0x0ff80000, 0x07fc0000, 0x03fe0000, 0x01ff0000, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00 },	// U+003E (>)
-	{ 0x00ffffff, 0x00fffffe, 0x00fffffc, 0x00fffff8, 0x00fffff0, 0x00ffffe0, 0x00ffffc0, 0x00ffff80, 0x00ff0000, 0x007f8000, 0x003fc000, 0x001fe000, 0x000ff000, 0x0007f800, 0x0003fc00, 0x0001fe00, 0x0000ff00, 0x00007f00, 0x00003f00, 0x00001f00, 0x00000f00, 0x00000700, 0x00000300, 0x00000100, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+003F (?)
-	{ 0x01ffff80, 0x03fe7fc0, 0x07fc3fe0, 0x0ff81ff0, 0x1ff00ff8, 0x3fe007fc, 0x7fc003fe, 0xff8001ff, 0xffff00ff, 0x7fff00ff, 0x3fff00ff, 0x1fff00ff, 0x0fff00ff, 0x07ff00ff, 0x03ff00ff, 0x01ff00ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0xff8001ff, 0x7fc003fe, 0x3fe007fc, 0x1ff00ff8, 0x0ff81ff0, 0x07fc3fe0, 0x03fe7fc0, 0x01ffff80 },	// U+0040 (@)
-	{ 0x01ffff80, 0x03ffffc0, 0x07ffffe0, 0x0ffffff0, 0x1ffffff8, 0x3ffffffc, 0x7ffffffe, 0xffffffff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff01ffff, 0xff03ffff, 0xff07ffff, 0xff0fffff, 0xff1fffff, 0xff3fffff, 0xff7fffff, 0xffffffff, 0xff0000ff, 0x7f0000fe, 0x3f0000fc, 0x1f0000f8, 0x0f0000f0, 0x070000e0, 0x030000c0, 0x01000080 },	// U+0041 (A)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff8000ff, 0x7fc000ff, 0x3fe000ff, 0x1ff000ff, 0x0ff800ff, 0x07fc00ff, 0x03fe00ff, 0x01ff00ff, 0x01ff00ff, 0x03fe00ff, 0x07fc00ff, 0x0ff800ff, 0x1ff000ff, 0x3fe000ff, 0x7fc000ff, 0xff8000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0042 (B)
-	{ 0xffffff80, 0x7fffffc0, 0x3fffffe0, 0x1ffffff0, 0x0ffffff8, 0x07fffffc, 0x03fffffe, 0x01ffffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0043 (C)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff00ffff, 0xff007fff, 0xff003fff, 0xff001fff, 0xff000fff, 0xff0007ff, 0xff0003ff, 0xff0001ff, 0xffffffff, 0x7fffff7f, 0x3fffff3f, 0x1fffff1f, 0x0fffff0f, 0x07ffff07, 0x03ffff03, 0x01ffff01 },	// U+0044 (D)
-	{ 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x000001ff, 0x000003ff, 0x000007ff, 0x00000fff, 0x00001fff, 0x00003fff, 0x00007fff, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0045 (E)
-	{ 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x000001ff, 0x000003ff, 0x000007ff, 0x00000fff, 0x00001fff, 0x00003fff, 0x00007fff, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000fe, 0x000000fc, 0x000000f8, 0x000000f0, 0x000000e0, 0x000000c0, 0x00000080 },	// U+0046 (F)
-	{ 0x00ffff80, 0x00ffffc0, 0x00ffffe0, 0x00fffff0, 0x00fffff8, 0x00fffffc, 0x00fffffe, 0x00ffffff, 0xff8000ff, 0xffc000ff, 0xffe000ff, 0xfff000ff, 0xfff800ff, 0xfffc00ff, 0xfffe00ff, 0xffff00ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffffffff, 0xfefffffe, 0xfcfffffc, 0xf8fffff8, 0xf0fffff0, 0xe0ffffe0, 0xc0ffffc0, 0x80ffff80 },	// U+0047 (G)
-	{ 0x01000080, 0x030000c0, 0x070000e0, 0x0f0000f0, 0x1f0000f8, 0x3f0000fc, 0x7f0000fe, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xff0000ff, 0x7f0000fe, 0x3f0000fc, 0x1f0000f8, 0x0f0000f0, 0x070000e0, 0x030000c0, 0x01000080 },	// U+0048 (H)
-	{ 0x00ff0000, 0x00fe0000, 0x00fc0000, 0x00f80000, 0x00f00000, 0x00e00000, 0x00c00000, 0x00800000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x007f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000 },	// U+0049 (I)
-	{ 0xffffffff, 0xfffffffe, 0xfffffffc, 0xfffffff8, 0xfffffff0, 0xffffffe0, 0xffffffc0, 0xffffff80, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000080, 0xff0000c0, 0xff0000e0, 0xff0000f0, 0xff0000f8, 0xff0000fc, 0xff0000fe, 0xff0000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+004A (J)
-	{ 0xff8000ff, 0x7fc000ff, 0x3fe000ff, 0x1ff000ff, 0x0ff800ff, 0x07fc00ff, 0x03fe00ff, 0x01ff00ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x01ff00ff, 0x03fe00ff, 0x07fc00ff, 0x0ff800ff, 0x1ff000ff, 0x3fe000ff, 0x7fc000ff, 0xff8000ff, 0xff0000ff, 0x7f0000fe, 0x3f0000fc, 0x1f0000f8, 0x0f0000f0, 0x070000e0, 0x030000c0, 0x01000080 },	// U+004B (K)
-	{ 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x800000ff, 0xc00000ff, 0xe00000ff, 0xf00000ff, 0xf80000ff, 0xfc0000ff, 0xfe0000ff, 0xff0000ff, 0xffffffff, 0x7fffff7f, 0x3fffff3f, 0x1fffff1f, 0x0fffff0f, 0x07ffff07, 0x03ffff03, 0x01ffff01 },	// U+004C (L)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xffffffff, 0xff7f7fff, 0xff3f3fff, 0xff1f1fff, 0xff0f0fff, 0xff0707ff, 0xff0303ff, 0xff0101ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0x7f00007f, 0x3f00003f, 0x1f00001f, 0x0f00000f, 0x07000007, 0x03000003, 0x01000001 },	// U+004D (M)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0x7f00007f, 0x3f00003f, 0x1f00001f, 0x0f00000f, 0x07000007, 0x03000003, 0x01000001 },	// U+004E (N)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+004F (O)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff0000ff, 0x7f0000ff, 0x3f0000ff, 0x1f0000ff, 0x0f0000ff, 0x070000ff, 0x030000ff, 0x010000ff, 0x00ffffff, 0x007ffeff, 0x003ffcff, 0x001ff8ff, 0x000ff0ff, 0x0007e0ff, 0x0003c0ff, 0x000180ff, 0x000000ff, 0x000000fe, 0x000000fc, 0x000000f8, 0x000000f0, 0x000000e0, 0x000000c0, 0x00000080 },	// U+0050 (P)
-	{ 0x01ffff80, 0x03ffffc0, 0x07ffffe0, 0x0ffffff0, 0x1ffffff8, 0x3ffffffc, 0x7ffffffe, 0xffffffff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0100ff, 0xff0300ff, 0xff0700ff, 0xff0f00ff, 0xff1f00ff, 0xff3f00ff, 0xff7f00ff, 0xffff00ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0051 (Q)
-	{ 0x01ffffff, 0x03fffffe, 0x07fffffc, 0x0ffffff8, 0x1ffffff0, 0x3fffffe0, 0x7fffffc0, 0xffffff80, 0xff0000ff, 0x7f0000ff, 0x3f0000ff, 0x1f0000ff, 0x0f0000ff, 0x070000ff, 0x030000ff, 0x010000ff, 0x01ff80ff, 0x03ffc0ff, 0x07ffe0ff, 0x0ffff0ff, 0x1ffff8ff, 0x3ffffcff, 0x7ffffeff, 0xffffffff, 0xff0000ff, 0xff0000fe, 0xff0000fc, 0xff0000f8, 0xff0000f0, 0xff0000e0, 0xff0000c0, 0xff000080 },	// U+0052 (R)
-	{ 0xffffff80, 0x7fffffc0, 0x3fffffe0, 0x1ffffff0, 0x0ffffff8, 0x07fffffc, 0x03fffffe, 0x01ffffff, 0x000001ff, 0x000003fe, 0x000007fc, 0x00000ff8, 0x00001ff0, 0x00003fe0, 0x00007fc0, 0x0000ff80, 0x01ff0000, 0x03fe0000, 0x07fc0000, 0x0ff80000, 0x1ff00000, 0x3fe00000, 0x7fc00000, 0xff800000, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0053 (S)
-	{ 0xffffff80, 0xffffffc0, 0xffffffe0, 0xfffffff0, 0xfffffff8, 0xfffffffc, 0xfffffffe, 0xffffffff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000 },	// U+0054 (T)
-	{ 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0055 (U)
-	{ 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff8001ff, 0x7fc003fe, 0x3fe007fc, 0x1ff00ff8, 0x0ff81ff0, 0x07fc3fe0, 0x03fe7fc0, 0x01ffff80, 0x00ffff00, 0x007ffe00, 0x003ffc00, 0x001ff800, 0x000ff000, 0x0007e000, 0x0003c000, 0x00018000 },	// U+0056 (V)
-	{ 0x80000080, 0xc00000c0, 0xe00000e0, 0xf00000f0, 0xf80000f8, 0xfc0000fc, 0xfe0000fe, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff8080ff, 0xffc0c0ff, 0xffe0e0ff, 0xfff0f0ff, 0xfff8f8ff, 0xfffcfcff, 0xfffefeff, 0xffffffff, 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80 },	// U+0057 (W)
-	{ 0xff8001ff, 0x7fc003fe, 0x3fe007fc, 0x1ff00ff8, 0x0ff81ff0, 0x07fc3fe0, 0x03fe7fc0, 0x01ffff80, 0x00ffff00, 0x007ffe00, 0x003ffc00, 0x001ff800, 0x000ff000, 0x0007e000, 0x0003c000, 0x00018000, 0x00018000, 0x0003c000, 0x0007e000, 0x000ff000, 0x001ff800, 0x003ffc00, 0x007ffe00, 0x00ffff00, 0x01ffff80, 0x03fe7fc0, 0x07fc3fe0, 0x0ff81ff0, 0x1ff00ff8, 0x3fe007fc, 0x7fc003fe, 0xff8001ff },	// U+0058 (X)
-	{ 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff8001ff, 0x7fc003fe, 0x3fe007fc, 0x1ff00ff8, 0x0ff81ff0, 0x07fc3fe0, 0x03fe7fc0, 0x01ffff80, 0x00ffff00, 0x007fff00, 0x003fff00, 0x001fff00, 0x000fff00, 0x0007ff00, 0x0003ff00, 0x0001ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff },	// U+0059 (Y)
-	{ 0xffffffff, 0x7ffffffe, 0x3ffffffc, 0x1ffffff8, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ff8000, 0x007fc000, 0x003fe000, 0x001ff000, 0x000ff800, 0x0007fc00, 0x0003fe00, 0x0001ff00, 0x0000ff80, 0x00007fc0, 0x00003fe0, 0x00001ff0, 0x00000ff8, 0x000007fc, 0x000003fe, 0x000001ff, 0x01ffffff, 0x03ffffff, 0x07ffffff, 0x0fffffff, 0x1fffffff, 0x3fffffff, 0x7fffffff, 0xffffffff },	// U+005A (Z)
-	{ 0x00ffff00, 0x007fff00, 0x003fff00, 0x001fff00, 0x000fff00, 0x0007ff00, 0x0003ff00, 0x0001ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0001ff00, 0x0003ff00, 0x0007ff00, 0x000fff00, 0x001fff00, 0x003fff00, 0x007fff00, 0x00ffff00 },	// U+005B ([)
-	{ 0x00000001, 0x00000003, 0x00000007, 0x0000000f, 0x0000001f, 0x0000003f, 0x0000007f, 0x000000ff, 0x000001ff, 0x000003fe, 0x000007fc, 0x00000ff8, 0x00001ff0, 0x00003fe0, 0x00007fc0, 0x0000ff80, 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000, 0x01ff0000, 0x03fe0000, 0x07fc0000, 0x0ff80000, 0x1ff00000, 0x3fe00000, 0x7fc00000, 0xff800000 },	// U+005C (\)
-	{ 0x00ffff00, 0x00fffe00, 0x00fffc00, 0x00fff800, 0x00fff000, 0x00ffe000, 0x00ffc000, 0x00ff8000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff8000, 0x00ffc000, 0x00ffe000, 0x00fff000, 0x00fff800, 0x00fffc00, 0x00fffe00, 0x00ffff00 },	// U+005D (])
-	{ 0x00018000, 0x0003c000, 0x0007e000, 0x000ff000, 0x001ff800, 0x003ffc00, 0x007ffe00, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+005E (^)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },	// U+005F (_)
-	{ 0x0001ff00, 0x0003fe00, 0x0007fc00, 0x000ff800, 0x001ff000, 0x003fe000, 0x007fc000, 0x00ff8000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+0060 (`)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffe00, 0x00ffff00, 0x01ffff80, 0x03ffffc0, 0x07ffffe0, 0x0ffffff0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc1fff0, 0x0fc3fff0, 0x0fc7fff0, 0x0fcffff0, 0x0fdffff0, 0x0ffffff0, 0x0fc003f0, 0x07c003e0, 0x03c003c0, 0x01c00380, 0x00c00300, 0x00400200 },	// U+0061 (a)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0fc003f0, 0x07e003f0, 0x03f003f0, 0x01f803f0, 0x00fc03f0, 0x007e03f0, 0x007e03f0, 0x00fc03f0, 0x01f803f0, 0x03f003f0, 0x07e003f0, 0x0fc003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0062 (b)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffe00, 0x07ffff00, 0x03ffff80, 0x01ffffc0, 0x00ffffe0, 0x007ffff0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0063 (c)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0f8003f0, 0x0f8003f0, 0x0f8003f0, 0x0f8003f0, 0x0f8003f0, 0x0f8003f0, 0x0f80fff0, 0x0f807ff0, 0x0f803ff0, 0x0f801ff0, 0x0f800ff0, 0x0f8007f0, 0x0ffffff0, 0x07fffdf0, 0x03fffcf0, 0x01fffc70, 0x00fffc30, 0x007ffc10 },	// U+0064 (d)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00, 0x000007f0, 0x00000ff0, 0x00001ff0, 0x00003ff0, 0x00007ff0, 0x0000fff0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0065 (e)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00, 0x000007f0, 0x00000ff0, 0x00001ff0, 0x00003ff0, 0x00007ff0, 0x0000fff0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003e0, 0x000003c0, 0x00000380, 0x00000300, 0x00000200 },	// U+0066 (f)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003ffe00, 0x003fff00, 0x003fff80, 0x003fffc0, 0x003fffe0, 0x003ffff0, 0x0fe003f0, 0x0ff003f0, 0x0ff803f0, 0x0ffc03f0, 0x0ffe03f0, 0x0fff03f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0ffffff0, 0x0fbfffe0, 0x0f3fffc0, 0x0e3fff80, 0x0c3fff00, 0x083ffe00 },	// U+0067 (g)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00400200, 0x00c00300, 0x01c00380, 0x03c003c0, 0x07c003e0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0ffffff0, 0x0ffffff0, 0x0ffffff0, 0x0ffffff0, 0x0ffffff0, 0x0ffffff0, 0x0fc003f0, 0x07c003e0, 0x03c003c0, 0x01c00380, 0x00c00300, 0x00400200 },	// U+0068 (h)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003f0000, 0x003e0000, 0x003c0000, 0x00380000, 0x00300000, 0x00200000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x001f0000, 0x000f0000, 0x00070000, 0x00030000, 0x00010000 },	// U+0069 (i)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffff0, 0x0fffffe0, 0x0fffffc0, 0x0fffff80, 0x0fffff00, 0x0ffffe00, 0x0fc00000, 0x0fc00000, 0x0fc00000, 0x0fc00000, 0x0fc00000, 0x0fc00000, 0x0fc00200, 0x0fc00300, 0x0fc00380, 0x0fc003c0, 0x0fc003e0, 0x0fc003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+006A (j)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fc003f0, 0x07e003f0, 0x03f003f0, 0x01f803f0, 0x00fc03f0, 0x007e03f0, 0x003ffff0, 0x003ffff0, 0x003ffff0, 0x003ffff0, 0x003ffff0, 0x003ffff0, 0x007e03f0, 0x00fc03f0, 0x01f803f0, 0x03f003f0, 0x07e003f0, 0x0fc003f0, 0x0fc003f0, 0x07c003e0, 0x03c003c0, 0x01c00380, 0x00c00300, 0x00400200 },	// U+006B (k)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x000003f0, 0x080003f0, 0x0c0003f0, 0x0e0003f0, 0x0f0003f0, 0x0f8003f0, 0x0fc003f0, 0x0ffffff0, 0x07fffdf0, 0x03fffcf0, 0x01fffc70, 0x00fffc30, 0x007ffc10 },	// U+006C (l)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0ffffff0, 0x0fdf7ff0, 0x0fcf3ff0, 0x0fc71ff0, 0x0fc30ff0, 0x0fc107f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x07c001f0, 0x03c000f0, 0x01c00070, 0x00c00030, 0x00400010 },	// U+006D (m)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x07c001f0, 0x03c000f0, 0x01c00070, 0x00c00030, 0x00400010 },	// U+006E (n)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003ffff0, 0x007fffe0, 0x00ffffc0, 0x01ffff80, 0x03ffff00, 0x07fffe00, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+006F (o)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0fc003f0, 0x07c003f0, 0x03c003f0, 0x01c003f0, 0x00c003f0, 0x004003f0, 0x003ffff0, 0x001ffbf0, 0x000ff3f0, 0x0007e3f0, 0x0003c3f0, 0x000183f0, 0x000003f0, 0x000003e0, 0x000003c0, 0x00000380, 0x00000300, 0x00000200 },	// U+0070 (p)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffe00, 0x00ffff00, 0x01ffff80, 0x03ffffc0, 0x07ffffe0, 0x0ffffff0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc103f0, 0x0fc303f0, 0x0fc703f0, 0x0fcf03f0, 0x0fdf03f0, 0x0fff03f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0071 (q)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007ffff0, 0x00ffffe0, 0x01ffffc0, 0x03ffff80, 0x07ffff00, 0x0ffffe00, 0x0fc003f0, 0x07c003f0, 0x03c003f0, 0x01c003f0, 0x00c003f0, 0x004003f0, 0x007f83f0, 0x00ffc3f0, 0x01ffe3f0, 0x03fff3f0, 0x07fffbf0, 0x0ffffff0, 0x0fc003f0, 0x0fc003e0, 0x0fc003c0, 0x0fc00380, 0x0fc00300, 0x0fc00200 },	// U+0072 (r)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffe00, 0x07ffff00, 0x03ffff80, 0x01ffffc0, 0x00ffffe0, 0x007ffff0, 0x000007f0, 0x00000fe0, 0x00001fc0, 0x00003f80, 0x00007f00, 0x0000fe00, 0x003f8000, 0x007f0000, 0x00fe0000, 0x01fc0000, 0x03f80000, 0x07f00000, 0x07fffff0, 0x03ffffe0, 0x01ffffc0, 0x00ffff80, 0x007fff00, 0x003ffe00 },	// U+0073 (s)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffe00, 0x0fffff00, 0x0fffff80, 0x0fffffc0, 0x0fffffe0, 0x0ffffff0, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000, 0x003f0000 },	// U+0074 (t)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0075 (u)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fe007f0, 0x07f00fe0, 0x03f81fc0, 0x01fc3f80, 0x00fe7f00, 0x007ffe00, 0x003ffc00, 0x001ff800, 0x000ff000, 0x0007e000, 0x0003c000, 0x00018000 },	// U+0076 (v)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000200, 0x0c000300, 0x0e000380, 0x0f0003c0, 0x0f8003e0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fe083f0, 0x0ff0c3f0, 0x0ff8e3f0, 0x0ffcf3f0, 0x0ffefbf0, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00 },	// U+0077 (w)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fc003f0, 0x07e007e0, 0x03f00fc0, 0x01f81f80, 0x00fc3f00, 0x007e7e00, 0x003ffc00, 0x001ff800, 0x000ff000, 0x0007e000, 0x0003c000, 0x00018000, 0x00018000, 0x0003c000, 0x0007e000, 0x000ff000, 0x001ff800, 0x003ffc00, 0x007e7e00, 0x00fc3f00, 0x01f81f80, 0x03f00fc0, 0x07e007e0, 0x0fc003f0 },	// U+0078 (x)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fc003f0, 0x0fe007f0, 0x07f00fe0, 0x03f81fc0, 0x01fc3f80, 0x00fe7f00, 0x007ffe00, 0x003ffc00, 0x001ffc00, 0x000ffc00, 0x0007fc00, 0x0003fc00, 0x0001fc00, 0x0000fe00, 0x00007f00, 0x00003f80, 0x00001fc0, 0x00000fe0, 0x000007f0 },	// U+0079 (y)
-	{ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ffffff0, 0x07ffffe0, 0x03ffffc0, 0x01ffff80, 0x00ffff00, 0x007ffe00, 0x003f8000, 0x001fc000, 0x000fe000, 0x0007f000, 0x0003f800, 0x0001fc00, 0x0000fe00, 0x00007f00, 0x00003f80, 0x00001fc0, 0x00000fe0, 0x000007f0, 0x007ffff0, 0x00fffff0, 0x01fffff0, 0x03fffff0, 0x07fffff0, 0x0ffffff0 },	// U+007A (z)
-	{ 0x00ffff00, 0x007fff00, 0x003fff00, 0x001fff00, 0x000fff00, 0x0007ff00, 0x0003ff00, 0x0001ff00, 0x0000ff80, 0x0000ffc0, 0x0000ffe0, 0x0000fff0, 0x0000fff8, 0x0000fffc, 0x0000fffe, 0x0000ffff, 0x0000ffff, 0x0000fffe, 0x0000fffc, 0x0000fff8, 0x0000fff0, 0x0000ffe0, 0x0000ffc0, 0x0000ff80, 0x0001ff00, 0x0003ff00, 0x0007ff00, 0x000fff00, 0x001fff00, 0x003fff00, 0x007fff00, 0x00ffff00 },	// U+007B ({)
-	{ 0x00000100, 0x00000300, 0x00000700, 0x00000f00, 0x00001f00, 0x00003f00, 0x00007f00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00000100, 0x00000300, 0x00000700, 0x00000f00, 0x00001f00, 0x00003f00, 0x00007f00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00 },	// U+007C (|)
-	{ 0x0000ffff, 0x0000fffe, 0x0000fffc, 0x0000fff8, 0x0000fff0, 0x0000ffe0, 0x0000ffc0, 0x0000ff80, 0x0001ff00, 0x0003ff00, 0x0007ff00, 0x000fff00, 0x001fff00, 0x003fff00, 0x007fff00, 0x00ffff00, 0x00ffff00, 0x007fff00, 0x003fff00, 0x001fff00, 0x000fff00, 0x0007ff00, 0x0003ff00, 0x0001ff00, 0x0000ff80, 0x0000ffc0, 0x0000ffe0, 0x0000fff0, 0x0000fff8, 0x0000fffc, 0x0000fffe, 0x0000ffff },	// U+007D (})
-	{ 0xff008000, 0x7f00c000, 0x3f00e000, 0x1f00f000, 0x0f00f800, 0x0700fc00, 0x0300fe00, 0x0100ff00, 0x00ff00ff, 0x007f007f, 0x003f003f, 0x001f001f, 0x000f000f, 0x00070007, 0x00030003, 0x00010001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },	// U+007E (~)
+static const uint8_t block_bitmaps[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0020 ( )
+	0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,	// U+0021 (!)
+	0x00, 0x80, 0x80, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0022 (")
+	0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00,	// U+0023 (#)
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00,	// U+0024 ($)
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0xc0, 0x7f, 0x00, 0xff, 0xe0, 0x3f, 0x00, 0xff, 0xf0, 0x1f, 0x00, 0xff, 0xf8, 0x0f, 0x00, 0xff, 0xfc, 0x07, 0x00, 0xff, 0xfe, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0xe0, 0x3f, 0xff, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0xf8, 0x0f, 0xff, 0x00, 0xfc, 0x07, 0xff, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00,	// U+0025 (%)
+	0x00, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0xff, 0x01, 0xff, 0xc0, 0xff, 0x03, 0x7f, 0xe0, 0xff, 0x07, 0x3f, 0xf0, 0xff, 0x0f, 0x1f, 0xf8, 0xff, 0x1f, 0x0f, 0xfc, 0xff, 0x3f, 0x07, 0xfe, 0xff, 0x7f, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0x7f, 0x03, 0xfc, 0xff, 0x3f, 0x07, 0xf8, 0xff, 0x1f, 0x0f, 0xf0, 0xff, 0x0f, 0x1f, 0xe0, 0xff, 0x07, 0x3f, 0xc0, 0xff, 0x03, 0x7f, 0x80, 0xff, 0x01, 0xff,	// U+0026 (&)
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0027 (')
+	0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00,	// U+0028 (()
+	0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,	// U+0029 ())
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,	// U+002A (*)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,	// U+002B (+)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,	// U+002C (,)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+002D (-)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,	// U+002E (.)
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,	// U+002F (/)
+	0x80, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x80, 0xff, 0x01, 0x00,	// U+0030 (0)
+	0x00, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,	// U+0031 (1)
+	0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00,	// U+0032 (2)
+	0x80, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x80, 0xff, 0x01, 0x00,	// U+0033 (3)
+	0x80, 0x00, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfe, 0x00, 0xfe, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,	// U+0034 (4)
+	0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x80, 0xff, 0x01, 0x00,	// U+0035 (5)
+	0x80, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xfe, 0x03, 0x00, 0xff, 0xfc, 0x07, 0x00, 0xff, 0xf8, 0x0f, 0x00, 0xff, 0xf0, 0x1f, 0x00, 0xff, 0xe0, 0x3f, 0x00, 0xff, 0xc0, 0x7f, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x80, 0xff, 0x01, 0x00,	// U+0036 (6)
+	0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,	// U+0037 (7)
+	0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x03, 0x7f, 0x00, 0xff, 0x07, 0x3f, 0x00, 0xff, 0x0f, 0x1f, 0x00, 0xff, 0x1f, 0x0f, 0x00, 0xff, 0x3f, 0x07, 0x00, 0xff, 0x7f, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0x80, 0xff, 0x01, 0x00, 0xc0, 0xfe, 0x03, 0x00, 0xe0, 0xfc, 0x07, 0x00, 0xf0, 0xf8, 0x0f, 0x00, 0xf8, 0xf0, 0x1f, 0x00, 0xfc, 0xe0, 0x3f, 0x00, 0xfe, 0xc0, 0x7f, 0x00, 0xff, 0x80, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00,	// U+0038 (8)
+	0x80, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x07, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xf8, 0xff, 0x1f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0x7f, 0xff, 0x00, 0xfc, 0x3f, 0xff, 0x00, 0xf8, 0x1f, 0xff, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0xe0, 0x07, 0xff, 0x00, 0xc0, 0x03, 0xff, 0x00, 0x80, 0x01, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0x0f, 0x00, 0xfc, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00,	// U+0039 (9)
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+003A (:)
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,	// U+003B (;)
+	0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff,	// U+003C (<)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+003D (=)
+	0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00,	// U+003E (>)
+	0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0x7f, 0x00, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,	// U+003F (?)
+	0x80, 0xff, 0xff, 0x01, 0xc0, 0x7f, 0xfe, 0x03, 0xe0, 0x3f, 0xfc, 0x07, 0xf0, 0x1f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf0, 0x1f, 0xfc, 0x07, 0xe0, 0x3f, 0xfe, 0x03, 0xc0, 0x7f, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x7f, 0xff, 0x00, 0xff, 0x3f, 0xff, 0x00, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x07, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x80, 0xff, 0xfe, 0x03, 0xc0, 0x7f, 0xfc, 0x07, 0xe0, 0x3f, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8, 0x0f, 0xe0, 0x3f, 0xfc, 0x07, 0xc0, 0x7f, 0xfe, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0040 (@)
+	0x80, 0xff, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x03, 0xe0, 0xff, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f, 0xf8, 0xff, 0xff, 0x1f, 0xfc, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01,	// U+0041 (A)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0xe0, 0x3f, 0xff, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0xf8, 0x0f, 0xff, 0x00, 0xfc, 0x07, 0xff, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xfc, 0x07, 0xff, 0x00, 0xf8, 0x0f, 0xff, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0xe0, 0x3f, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0042 (B)
+	0x80, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x7f, 0xe0, 0xff, 0xff, 0x3f, 0xf0, 0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0043 (C)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x7f, 0x00, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x1f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x00, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0xff, 0xff, 0x3f, 0x1f, 0xff, 0xff, 0x1f, 0x0f, 0xff, 0xff, 0x0f, 0x07, 0xff, 0xff, 0x07, 0x03, 0xff, 0xff, 0x03, 0x01, 0xff, 0xff, 0x01,	// U+0044 (D)
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0045 (E)
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,	// U+0046 (F)
+	0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0xff, 0xf8, 0xf0, 0xff, 0xff, 0xf0, 0xe0, 0xff, 0xff, 0xe0, 0xc0, 0xff, 0xff, 0xc0, 0x80, 0xff, 0xff, 0x80,	// U+0047 (G)
+	0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01,	// U+0048 (H)
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,	// U+0049 (I)
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+004A (J)
+	0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0xe0, 0x3f, 0xff, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0xf8, 0x0f, 0xff, 0x00, 0xfc, 0x07, 0xff, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x01, 0xff, 0x00, 0xfe, 0x03, 0xff, 0x00, 0xfc, 0x07, 0xff, 0x00, 0xf8, 0x0f, 0xff, 0x00, 0xf0, 0x1f, 0xff, 0x00, 0xe0, 0x3f, 0xff, 0x00, 0xc0, 0x7f, 0xff, 0x00, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01,	// U+004B (K)
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0xff, 0xff, 0x3f, 0x1f, 0xff, 0xff, 0x1f, 0x0f, 0xff, 0xff, 0x0f, 0x07, 0xff, 0xff, 0x07, 0x03, 0xff, 0xff, 0x03, 0x01, 0xff, 0xff, 0x01,	// U+004C (L)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0xff, 0xff, 0x3f, 0x3f, 0xff, 0xff, 0x1f, 0x1f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0x07, 0x07, 0xff, 0xff, 0x03, 0x03, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x7f, 0x3f, 0x00, 0x00, 0x3f, 0x1f, 0x00, 0x00, 0x1f, 0x0f, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01,	// U+004D (M)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x7f, 0x3f, 0x00, 0x00, 0x3f, 0x1f, 0x00, 0x00, 0x1f, 0x0f, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01,	// U+004E (N)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+004F (O)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0x7f, 0x00, 0xff, 0xfc, 0x3f, 0x00, 0xff, 0xf8, 0x1f, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0xe0, 0x07, 0x00, 0xff, 0xc0, 0x03, 0x00, 0xff, 0x80, 0x01, 0x00, 0xff, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,	// U+0050 (P)
+	0x80, 0xff, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x03, 0xe0, 0xff, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f, 0xf8, 0xff, 0xff, 0x1f, 0xfc, 0xff, 0xff, 0x3f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0051 (Q)
+	0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x1f, 0xe0, 0xff, 0xff, 0x3f, 0xc0, 0xff, 0xff, 0x7f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x01, 0xff, 0x80, 0xff, 0x01, 0xff, 0xc0, 0xff, 0x03, 0xff, 0xe0, 0xff, 0x07, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xf8, 0xff, 0x1f, 0xff, 0xfc, 0xff, 0x3f, 0xff, 0xfe, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,	// U+0052 (R)
+	0x80, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x7f, 0xe0, 0xff, 0xff, 0x3f, 0xf0, 0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x01, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0053 (S)
+	0x80, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,	// U+0054 (T)
+	0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0055 (U)
+	0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x80, 0xff, 0xfe, 0x03, 0xc0, 0x7f, 0xfc, 0x07, 0xe0, 0x3f, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8, 0x0f, 0xe0, 0x3f, 0xfc, 0x07, 0xc0, 0x7f, 0xfe, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,	// U+0056 (V)
+	0x80, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x00, 0xc0, 0xe0, 0x00, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0xf0, 0xf8, 0x00, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0xe0, 0xe0, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01,	// U+0057 (W)
+	0xff, 0x01, 0x80, 0xff, 0xfe, 0x03, 0xc0, 0x7f, 0xfc, 0x07, 0xe0, 0x3f, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8, 0x0f, 0xe0, 0x3f, 0xfc, 0x07, 0xc0, 0x7f, 0xfe, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0xc0, 0x7f, 0xfe, 0x03, 0xe0, 0x3f, 0xfc, 0x07, 0xf0, 0x1f, 0xf8, 0x0f, 0xf8, 0x0f, 0xf0, 0x1f, 0xfc, 0x07, 0xe0, 0x3f, 0xfe, 0x03, 0xc0, 0x7f, 0xff, 0x01, 0x80, 0xff,	// U+0058 (X)
+	0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x01, 0x80, 0xff, 0xfe, 0x03, 0xc0, 0x7f, 0xfc, 0x07, 0xe0, 0x3f, 0xf8, 0x0f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf8, 0x0f, 0xe0, 0x3f, 0xfc, 0x07, 0xc0, 0x7f, 0xfe, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,	// U+0059 (Y)
+	0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,	// U+005A (Z)
+	0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00,	// U+005B ([)
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff,	// U+005C (\)
+	0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,	// U+005D (])
+	0x00, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+005E (^)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	// U+005F (_)
+	0x00, 0xff, 0x01, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xc0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0060 (`)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x03, 0xe0, 0xff, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xc1, 0x0f, 0xf0, 0xff, 0xc3, 0x0f, 0xf0, 0xff, 0xc7, 0x0f, 0xf0, 0xff, 0xcf, 0x0f, 0xf0, 0xff, 0xdf, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0xc0, 0x01, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00,	// U+0061 (a)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xe0, 0x07, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf8, 0x01, 0xf0, 0x03, 0xfc, 0x00, 0xf0, 0x03, 0x7e, 0x00, 0xf0, 0x03, 0x7e, 0x00, 0xf0, 0x03, 0xfc, 0x00, 0xf0, 0x03, 0xf8, 0x01, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xe0, 0x07, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0062 (b)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x80, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x01, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0063 (c)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0xff, 0x80, 0x0f, 0xf0, 0x7f, 0x80, 0x0f, 0xf0, 0x3f, 0x80, 0x0f, 0xf0, 0x1f, 0x80, 0x0f, 0xf0, 0x0f, 0x80, 0x0f, 0xf0, 0x07, 0x80, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xfd, 0xff, 0x07, 0xf0, 0xfc, 0xff, 0x03, 0x70, 0xfc, 0xff, 0x01, 0x30, 0xfc, 0xff, 0x00, 0x10, 0xfc, 0x7f, 0x00,	// U+0064 (d)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0065 (e)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,	// U+0066 (f)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x80, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0xe0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0x03, 0xe0, 0x0f, 0xf0, 0x03, 0xf0, 0x0f, 0xf0, 0x03, 0xf8, 0x0f, 0xf0, 0x03, 0xfc, 0x0f, 0xf0, 0x03, 0xfe, 0x0f, 0xf0, 0x03, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xbf, 0x0f, 0xc0, 0xff, 0x3f, 0x0f, 0x80, 0xff, 0x3f, 0x0e, 0x00, 0xff, 0x3f, 0x0c, 0x00, 0xfe, 0x3f, 0x08,	// U+0067 (g)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x80, 0x03, 0xc0, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x03, 0xc0, 0x07, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0xc0, 0x01, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00,	// U+0068 (h)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,	// U+0069 (i)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x0f, 0x80, 0xff, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xfe, 0xff, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x02, 0xc0, 0x0f, 0x00, 0x03, 0xc0, 0x0f, 0x80, 0x03, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x0f, 0xe0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+006A (j)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xe0, 0x07, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xf8, 0x01, 0xf0, 0x03, 0xfc, 0x00, 0xf0, 0x03, 0x7e, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0x03, 0x7e, 0x00, 0xf0, 0x03, 0xfc, 0x00, 0xf0, 0x03, 0xf8, 0x01, 0xf0, 0x03, 0xf0, 0x03, 0xf0, 0x03, 0xe0, 0x07, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0x80, 0x03, 0xc0, 0x01, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00,	// U+006B (k)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x08, 0xf0, 0x03, 0x00, 0x0c, 0xf0, 0x03, 0x00, 0x0e, 0xf0, 0x03, 0x00, 0x0f, 0xf0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xfd, 0xff, 0x07, 0xf0, 0xfc, 0xff, 0x03, 0x70, 0xfc, 0xff, 0x01, 0x30, 0xfc, 0xff, 0x00, 0x10, 0xfc, 0x7f, 0x00,	// U+006C (l)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x7f, 0xdf, 0x0f, 0xf0, 0x3f, 0xcf, 0x0f, 0xf0, 0x1f, 0xc7, 0x0f, 0xf0, 0x0f, 0xc3, 0x0f, 0xf0, 0x07, 0xc1, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x01, 0xc0, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x70, 0x00, 0xc0, 0x01, 0x30, 0x00, 0xc0, 0x00, 0x10, 0x00, 0x40, 0x00,	// U+006D (m)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x01, 0xc0, 0x07, 0xf0, 0x00, 0xc0, 0x03, 0x70, 0x00, 0xc0, 0x01, 0x30, 0x00, 0xc0, 0x00, 0x10, 0x00, 0x40, 0x00,	// U+006E (n)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xe0, 0xff, 0x7f, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x03, 0x00, 0xfe, 0xff, 0x07, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+006F (o)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x07, 0xf0, 0x03, 0xc0, 0x03, 0xf0, 0x03, 0xc0, 0x01, 0xf0, 0x03, 0xc0, 0x00, 0xf0, 0x03, 0x40, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xf0, 0xfb, 0x1f, 0x00, 0xf0, 0xf3, 0x0f, 0x00, 0xf0, 0xe3, 0x07, 0x00, 0xf0, 0xc3, 0x03, 0x00, 0xf0, 0x83, 0x01, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,	// U+0070 (p)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x03, 0xe0, 0xff, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc1, 0x0f, 0xf0, 0x03, 0xc3, 0x0f, 0xf0, 0x03, 0xc7, 0x0f, 0xf0, 0x03, 0xcf, 0x0f, 0xf0, 0x03, 0xdf, 0x0f, 0xf0, 0x03, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0071 (q)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0x00, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x03, 0x00, 0xff, 0xff, 0x07, 0x00, 0xfe, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x07, 0xf0, 0x03, 0xc0, 0x03, 0xf0, 0x03, 0xc0, 0x01, 0xf0, 0x03, 0xc0, 0x00, 0xf0, 0x03, 0x40, 0x00, 0xf0, 0x83, 0x7f, 0x00, 0xf0, 0xc3, 0xff, 0x00, 0xf0, 0xe3, 0xff, 0x01, 0xf0, 0xf3, 0xff, 0x03, 0xf0, 0xfb, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x03, 0xc0, 0x0f, 0xc0, 0x03, 0xc0, 0x0f, 0x80, 0x03, 0xc0, 0x0f, 0x00, 0x03, 0xc0, 0x0f, 0x00, 0x02, 0xc0, 0x0f,	// U+0072 (r)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x07, 0x80, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x01, 0xe0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xf0, 0x07, 0xf0, 0xff, 0xff, 0x07, 0xe0, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xfe, 0x3f, 0x00,	// U+0073 (s)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x0f, 0x80, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00,	// U+0074 (t)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0075 (u)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x07, 0xe0, 0x0f, 0xe0, 0x0f, 0xf0, 0x07, 0xc0, 0x1f, 0xf8, 0x03, 0x80, 0x3f, 0xfc, 0x01, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00,	// U+0076 (v)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x03, 0x00, 0x0c, 0x80, 0x03, 0x00, 0x0e, 0xc0, 0x03, 0x00, 0x0f, 0xe0, 0x03, 0x80, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x83, 0xe0, 0x0f, 0xf0, 0xc3, 0xf0, 0x0f, 0xf0, 0xe3, 0xf8, 0x0f, 0xf0, 0xf3, 0xfc, 0x0f, 0xf0, 0xfb, 0xfe, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00,	// U+0077 (w)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x0f, 0xf0, 0x03, 0x80, 0x1f, 0xf8, 0x01, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x80, 0x1f, 0xf8, 0x01, 0xc0, 0x0f, 0xf0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x03, 0xc0, 0x0f,	// U+0078 (x)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x03, 0xc0, 0x0f, 0xf0, 0x07, 0xe0, 0x0f, 0xe0, 0x0f, 0xf0, 0x07, 0xc0, 0x1f, 0xf8, 0x03, 0x80, 0x3f, 0xfc, 0x01, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfc, 0x1f, 0x00, 0x00, 0xfc, 0x0f, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00,	// U+0079 (y)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xe0, 0xff, 0xff, 0x07, 0xc0, 0xff, 0xff, 0x03, 0x80, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x01, 0xf0, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x0f,	// U+007A (z)
+	0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00,	// U+007B ({)
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,	// U+007C (|)
+	0xff, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0x01, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0xfc, 0xff, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,	// U+007D (})
+	0x00, 0x80, 0x00, 0xff, 0x00, 0xc0, 0x00, 0x7f, 0x00, 0xe0, 0x00, 0x3f, 0x00, 0xf0, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x0f, 0x00, 0xfc, 0x00, 0x07, 0x00, 0xfe, 0x00, 0x03, 0x00, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+007E (~)
 }; // 95
 
+static const uint16_t block_chunks[] = {
+	1, 2,
+};
+static const uint64_t block_coverage[] = {
+	0x0000000000000000, 0xffffffff00000000, 0x7fffffffffffffff,
+};
+static const uint16_t block_ranks[] = {
+	0, 0, 32,
+};
+static const FBInkFont block_font = {
+	.map =
+	    {
+		.chunks      = block_chunks,
+		.coverage    = block_coverage,
+		.ranks       = block_ranks,
+		.chunk_count = 2U,
+	    },
+	.ids         = NULL,
+	.bitmaps     = block_bitmaps,
+	.width       = 32U,
+	.height      = 32U,
+	.bitmap_size = 128U,
+};
+
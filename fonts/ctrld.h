@@ -4,361 +4,390 @@
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char ctrld_block1[][16] = {
-	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000A (ESC)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000B (ESC)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000C (ESC)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000D (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000E (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+000F (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0010 (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0011 (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0012 (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0013 (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0014 (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0015 (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0016 (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0017 (ESC)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+0018 (ESC)
-	{ 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa },	// U+0019 (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7e, 0x18, 0x7e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+001A (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x18, 0x60, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+001B (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+001C (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x60, 0x18, 0x06, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+001D (ESC)
-	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+001E (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+001F (ESC)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
-	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0021 (!)
-	{ 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
-	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x7e, 0x24, 0x24, 0x7e, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+0023 (#)
-	{ 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x0a, 0x0a, 0x1c, 0x28, 0x28, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+0024 ($)
-	{ 0x00, 0x00, 0x00, 0x06, 0x49, 0x29, 0x16, 0x08, 0x34, 0x4a, 0x49, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+0025 (%)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x0c, 0x52, 0x22, 0x22, 0x22, 0x5c, 0x00, 0x00, 0x00, 0x00 },	// U+0026 (&)
-	{ 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0027 (')
-	{ 0x00, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x00, 0x00 },	// U+0028 (()
-	{ 0x00, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x00, 0x00 },	// U+0029 ())
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0x7e, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+002A (*)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+002B (+)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x0c, 0x00, 0x00 },	// U+002C (,)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+002D (-)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+002E (.)
-	{ 0x00, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+002F (/)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0030 (0)
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0031 (1)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+0032 (2)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x40, 0x38, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0033 (3)
-	{ 0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x24, 0x22, 0x7e, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+0034 (4)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0035 (5)
-	{ 0x00, 0x00, 0x00, 0x38, 0x04, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0036 (6)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0037 (7)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0038 (8)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+0039 (9)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00 },	// U+003A (:)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x0c, 0x00, 0x00 },	// U+003B (;)
-	{ 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00 },	// U+003C (<)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+003D (=)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+003E (>)
-	{ 0x00, 0x00, 0x3c, 0x42, 0x40, 0x40, 0x30, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+003F (?)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x72, 0x4a, 0x4a, 0x72, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0040 (@)
-	{ 0x00, 0x00, 0x00, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0041 (A)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0042 (B)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0043 (C)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+0044 (D)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+0045 (E)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+0046 (F)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x72, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0047 (G)
-	{ 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0048 (H)
-	{ 0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0049 (I)
-	{ 0x00, 0x00, 0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+004A (J)
-	{ 0x00, 0x00, 0x00, 0x42, 0x42, 0x22, 0x12, 0x1e, 0x22, 0x22, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+004B (K)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+004C (L)
-	{ 0x00, 0x00, 0x00, 0x42, 0x66, 0x5a, 0x5a, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+004D (M)
-	{ 0x00, 0x00, 0x00, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+004E (N)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+004F (O)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+0050 (P)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x5c, 0x40, 0x00, 0x00, 0x00 },	// U+0051 (Q)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x22, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0052 (R)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x3c, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0053 (S)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0054 (T)
-	{ 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0055 (U)
-	{ 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x14, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0056 (V)
-	{ 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x49, 0x2a, 0x2a, 0x36, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+0057 (W)
-	{ 0x00, 0x00, 0x00, 0x42, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0058 (X)
-	{ 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0059 (Y)
-	{ 0x00, 0x00, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+005A (Z)
-	{ 0x00, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x00, 0x00 },	// U+005B ([)
-	{ 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00 },	// U+005C (\)
-	{ 0x00, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x00, 0x00 },	// U+005D (])
-	{ 0x00, 0x00, 0x08, 0x08, 0x14, 0x14, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+005E (^)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00 },	// U+005F (_)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0060 (`)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0061 (a)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+0062 (b)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0063 (c)
-	{ 0x00, 0x00, 0x40, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0064 (d)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0065 (e)
-	{ 0x00, 0x00, 0x70, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0066 (f)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+0067 (g)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0068 (h)
-	{ 0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+0069 (i)
-	{ 0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x00, 0x00 },	// U+006A (j)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x42, 0x22, 0x12, 0x1e, 0x22, 0x22, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+006B (k)
-	{ 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+006C (l)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00 },	// U+006D (m)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+006E (n)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+006F (o)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x02, 0x02, 0x02 },	// U+0070 (p)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x40 },	// U+0071 (q)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x46, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+0072 (r)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x3c, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+0073 (s)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00 },	// U+0074 (t)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+0075 (u)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0076 (v)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x49, 0x2a, 0x2a, 0x36, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+0077 (w)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+0078 (x)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+0079 (y)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+007A (z)
-	{ 0x00, 0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x30, 0x00, 0x00 },	// U+007B ({)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+007C (|)
-	{ 0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00 },	// U+007D (})
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+007F ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x1e, 0x04, 0x1e, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+0080 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0081 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00 },	// U+0082 ()
-	{ 0x00, 0x30, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00 },	// U+0083 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00 },	// U+0084 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00 },	// U+0085 ()
-	{ 0x00, 0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0086 ()
-	{ 0x00, 0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+0087 ()
-	{ 0x00, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0088 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x08, 0x08, 0x04, 0x04, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00 },	// U+0089 ()
-	{ 0x00, 0x24, 0x18, 0x3c, 0x42, 0x02, 0x02, 0x3c, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+008A ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+008B ()
-	{ 0x00, 0x00, 0x00, 0x6c, 0x12, 0x12, 0x12, 0x32, 0x12, 0x12, 0x12, 0x6c, 0x00, 0x00, 0x00, 0x00 },	// U+008C ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+008D ()
-	{ 0x00, 0x24, 0x18, 0x7e, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+008E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+008F ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0090 ()
-	{ 0x00, 0x0c, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0091 ()
-	{ 0x00, 0x18, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0092 ()
-	{ 0x00, 0x36, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0093 ()
-	{ 0x00, 0x6c, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0094 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0095 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0096 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0097 ()
-	{ 0x00, 0x00, 0x00, 0x2c, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0098 ()
-	{ 0x00, 0x00, 0x00, 0x5e, 0x74, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0099 ()
-	{ 0x00, 0x00, 0x24, 0x18, 0x00, 0x3c, 0x42, 0x02, 0x3c, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+009A ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+009B ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x49, 0x49, 0x79, 0x09, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00 },	// U+009C ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+009D ()
-	{ 0x00, 0x00, 0x24, 0x18, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+009E ()
-	{ 0x00, 0x14, 0x14, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+009F ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
-	{ 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+00A1 (¡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x0a, 0x0a, 0x0a, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+00A2 (¢)
-	{ 0x00, 0x00, 0x00, 0x18, 0x24, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+00A3 (£)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A4 (¤)
-	{ 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+00A5 (¥)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 },	// U+00A6 (¦)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x1c, 0x24, 0x38, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00A7 (§)
-	{ 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A8 (¨)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x52, 0x4a, 0x4a, 0x4a, 0x52, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00A9 (©)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x10, 0x1c, 0x12, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AA (ª)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x12, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AB («)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AD (­)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x5a, 0x6a, 0x5a, 0x6a, 0x6a, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00AE (®)
-	{ 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
-	{ 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B1 (±)
-	{ 0x00, 0x0e, 0x10, 0x08, 0x04, 0x02, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B2 (²)
-	{ 0x00, 0x0e, 0x10, 0x0c, 0x10, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B3 (³)
-	{ 0x00, 0x18, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B4 (´)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2c, 0x14, 0x04, 0x04, 0x02, 0x00 },	// U+00B5 (µ)
-	{ 0x00, 0x00, 0x00, 0x7c, 0x2e, 0x2e, 0x2e, 0x2c, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00 },	// U+00B6 (¶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B7 (·)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x08, 0x00 },	// U+00B8 (¸)
-	{ 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B9 (¹)
-	{ 0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00BA (º)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x48, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00BB (»)
-	{ 0x00, 0x40, 0x44, 0x26, 0x24, 0x14, 0x10, 0x08, 0x48, 0x64, 0x74, 0x42, 0x42, 0x00, 0x00, 0x00 },	// U+00BC (¼)
-	{ 0x00, 0x40, 0x44, 0x26, 0x24, 0x14, 0x10, 0x08, 0x28, 0x54, 0x44, 0x22, 0x72, 0x00, 0x00, 0x00 },	// U+00BD (½)
-	{ 0x00, 0x40, 0x46, 0x24, 0x22, 0x14, 0x16, 0x08, 0x48, 0x64, 0x74, 0x42, 0x42, 0x00, 0x00, 0x00 },	// U+00BE (¾)
-	{ 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x0c, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00BF (¿)
-	{ 0x00, 0x08, 0x10, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C0 (À)
-	{ 0x00, 0x10, 0x08, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C1 (Á)
-	{ 0x00, 0x18, 0x24, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C2 (Â)
-	{ 0x00, 0x58, 0x34, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C3 (Ã)
-	{ 0x00, 0x24, 0x24, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C4 (Ä)
-	{ 0x00, 0x18, 0x24, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00C5 (Å)
-	{ 0x00, 0x00, 0x00, 0x70, 0x18, 0x14, 0x14, 0x72, 0x1e, 0x12, 0x12, 0x72, 0x00, 0x00, 0x00, 0x00 },	// U+00C6 (Æ)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x08, 0x08, 0x04, 0x00 },	// U+00C7 (Ç)
-	{ 0x00, 0x08, 0x10, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+00C8 (È)
-	{ 0x00, 0x10, 0x08, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+00C9 (É)
-	{ 0x00, 0x18, 0x24, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+00CA (Ê)
-	{ 0x00, 0x24, 0x24, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+00CB (Ë)
-	{ 0x00, 0x08, 0x10, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+00CC (Ì)
-	{ 0x00, 0x10, 0x08, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+00CD (Í)
-	{ 0x00, 0x08, 0x14, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+00CE (Î)
-	{ 0x00, 0x24, 0x24, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+00CF (Ï)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x4e, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D0 (Ð)
-	{ 0x00, 0x58, 0x34, 0x00, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00D1 (Ñ)
-	{ 0x00, 0x08, 0x10, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D2 (Ò)
-	{ 0x00, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D3 (Ó)
-	{ 0x00, 0x18, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D4 (Ô)
-	{ 0x00, 0x58, 0x34, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D5 (Õ)
-	{ 0x00, 0x24, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D6 (Ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00D7 (×)
-	{ 0x00, 0x00, 0x00, 0x5c, 0x22, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x44, 0x3a, 0x00, 0x00, 0x00, 0x00 },	// U+00D8 (Ø)
-	{ 0x00, 0x08, 0x10, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00D9 (Ù)
-	{ 0x00, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00DA (Ú)
-	{ 0x00, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00DB (Û)
-	{ 0x00, 0x24, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00DC (Ü)
-	{ 0x00, 0x10, 0x08, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+00DD (Ý)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1e, 0x22, 0x22, 0x1e, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+00DE (Þ)
-	{ 0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x02, 0x00, 0x00, 0x00 },	// U+00DF (ß)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E0 (à)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E1 (á)
-	{ 0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E2 (â)
-	{ 0x00, 0x58, 0x34, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E3 (ã)
-	{ 0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E4 (ä)
-	{ 0x00, 0x10, 0x28, 0x10, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00E5 (å)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x4a, 0x48, 0x7c, 0x0a, 0x4a, 0x34, 0x00, 0x00, 0x00, 0x00 },	// U+00E6 (æ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x10, 0x10, 0x10, 0x08 },	// U+00E7 (ç)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00E8 (è)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00E9 (é)
-	{ 0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00EA (ê)
-	{ 0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00EB (ë)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+00EC (ì)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+00ED (í)
-	{ 0x00, 0x10, 0x28, 0x44, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+00EE (î)
-	{ 0x00, 0x24, 0x24, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00 },	// U+00EF (ï)
-	{ 0x00, 0x2c, 0x10, 0x28, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F0 (ð)
-	{ 0x00, 0x58, 0x34, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00 },	// U+00F1 (ñ)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F2 (ò)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F3 (ó)
-	{ 0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F4 (ô)
-	{ 0x00, 0x58, 0x34, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F5 (õ)
-	{ 0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+00F6 (ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00F7 (÷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x40, 0x3c, 0x62, 0x52, 0x4a, 0x4a, 0x46, 0x3c, 0x02, 0x00, 0x00, 0x00 },	// U+00F8 (ø)
-	{ 0x00, 0x18, 0x10, 0x20, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00F9 (ù)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00FA (ú)
-	{ 0x00, 0x10, 0x28, 0x44, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00FB (û)
-	{ 0x00, 0x24, 0x24, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00 },	// U+00FC (ü)
-	{ 0x00, 0x30, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+00FD (ý)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x02, 0x02, 0x02, 0x00 },	// U+00FE (þ)
-	{ 0x00, 0x00, 0x24, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c },	// U+00FF (ÿ)
-}; // 246
+static const uint8_t ctrld_bitmaps[] = {
+	0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000A (ESC)
+	0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000B (ESC)
+	0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000C (ESC)
+	0x00, 0x00, 0x00, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000D (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000E (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+000F (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0010 (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0011 (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0012 (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0013 (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0014 (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0015 (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xf8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0016 (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0017 (ESC)
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xff, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,	// U+0018 (ESC)
+	0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa,	// U+0019 (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x7e, 0x18, 0x7e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+001A (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x18, 0x60, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+001B (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,	// U+001C (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x60, 0x18, 0x06, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+001D (ESC)
+	0x00, 0x00, 0x00, 0x18, 0x24, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+001E (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+001F (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0020 ( )
+	0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0021 (!)
+	0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0022 (")
+	0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x7e, 0x24, 0x24, 0x7e, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,	// U+0023 (#)
+	0x00, 0x00, 0x08, 0x1c, 0x2a, 0x0a, 0x0a, 0x1c, 0x28, 0x28, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00,	// U+0024 ($)
+	0x00, 0x00, 0x00, 0x06, 0x49, 0x29, 0x16, 0x08, 0x34, 0x4a, 0x49, 0x30, 0x00, 0x00, 0x00, 0x00,	// U+0025 (%)
+	0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x0c, 0x52, 0x22, 0x22, 0x22, 0x5c, 0x00, 0x00, 0x00, 0x00,	// U+0026 (&)
+	0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0027 (')
+	0x00, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x00, 0x00,	// U+0028 (()
+	0x00, 0x04, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x00, 0x00,	// U+0029 ())
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0x7e, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+002A (*)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+002B (+)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x0c, 0x00, 0x00,	// U+002C (,)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+002D (-)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,	// U+002E (.)
+	0x00, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00, 0x00,	// U+002F (/)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x62, 0x52, 0x4a, 0x46, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0030 (0)
+	0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0031 (1)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+0032 (2)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x40, 0x38, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0033 (3)
+	0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x24, 0x22, 0x7e, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,	// U+0034 (4)
+	0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0035 (5)
+	0x00, 0x00, 0x00, 0x38, 0x04, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0036 (6)
+	0x00, 0x00, 0x00, 0x7e, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0037 (7)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0038 (8)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x20, 0x1c, 0x00, 0x00, 0x00, 0x00,	// U+0039 (9)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,	// U+003A (:)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x0c, 0x00, 0x00,	// U+003B (;)
+	0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,	// U+003C (<)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+003D (=)
+	0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+003E (>)
+	0x00, 0x00, 0x3c, 0x42, 0x40, 0x40, 0x30, 0x08, 0x08, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+003F (?)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x72, 0x4a, 0x4a, 0x72, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0040 (@)
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0041 (A)
+	0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+0042 (B)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0043 (C)
+	0x00, 0x00, 0x00, 0x1e, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x1e, 0x00, 0x00, 0x00, 0x00,	// U+0044 (D)
+	0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+0045 (E)
+	0x00, 0x00, 0x00, 0x7e, 0x02, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+0046 (F)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x72, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0047 (G)
+	0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x7e, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0048 (H)
+	0x00, 0x00, 0x00, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0049 (I)
+	0x00, 0x00, 0x00, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+004A (J)
+	0x00, 0x00, 0x00, 0x42, 0x42, 0x22, 0x12, 0x1e, 0x22, 0x22, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+004B (K)
+	0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+004C (L)
+	0x00, 0x00, 0x00, 0x42, 0x66, 0x5a, 0x5a, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+004D (M)
+	0x00, 0x00, 0x00, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+004E (N)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+004F (O)
+	0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+0050 (P)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x5c, 0x40, 0x00, 0x00, 0x00,	// U+0051 (Q)
+	0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x3e, 0x22, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0052 (R)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x3c, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0053 (S)
+	0x00, 0x00, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0054 (T)
+	0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0055 (U)
+	0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x14, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0056 (V)
+	0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x49, 0x2a, 0x2a, 0x36, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00,	// U+0057 (W)
+	0x00, 0x00, 0x00, 0x42, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0058 (X)
+	0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0059 (Y)
+	0x00, 0x00, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+005A (Z)
+	0x00, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x00, 0x00,	// U+005B ([)
+	0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00,	// U+005C (\)
+	0x00, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x00, 0x00,	// U+005D (])
+	0x00, 0x00, 0x08, 0x08, 0x14, 0x14, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+005E (^)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,	// U+005F (_)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0060 (`)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0061 (a)
+	0x00, 0x00, 0x02, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+0062 (b)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0063 (c)
+	0x00, 0x00, 0x40, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0064 (d)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0065 (e)
+	0x00, 0x00, 0x70, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0066 (f)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c,	// U+0067 (g)
+	0x00, 0x00, 0x02, 0x02, 0x02, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0068 (h)
+	0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+0069 (i)
+	0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0e, 0x00, 0x00,	// U+006A (j)
+	0x00, 0x00, 0x02, 0x02, 0x02, 0x42, 0x22, 0x12, 0x1e, 0x22, 0x22, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+006B (k)
+	0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00,	// U+006C (l)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00, 0x00,	// U+006D (m)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+006E (n)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+006F (o)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3e, 0x02, 0x02, 0x02, 0x02,	// U+0070 (p)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x40,	// U+0071 (q)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x46, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+0072 (r)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x3c, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+0073 (s)
+	0x00, 0x00, 0x04, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00, 0x00, 0x00,	// U+0074 (t)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+0075 (u)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0076 (v)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x49, 0x2a, 0x2a, 0x36, 0x14, 0x00, 0x00, 0x00, 0x00,	// U+0077 (w)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x24, 0x18, 0x24, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+0078 (x)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c,	// U+0079 (y)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+007A (z)
+	0x00, 0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x30, 0x00, 0x00,	// U+007B ({)
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,	// U+007C (|)
+	0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x70, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00,	// U+007D (})
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+007E (~)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+007F ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x44, 0x1e, 0x04, 0x1e, 0x44, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+0080 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0081 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x04, 0x00, 0x00,	// U+0082 ()
+	0x00, 0x30, 0x08, 0x08, 0x08, 0x3c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00,	// U+0083 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,	// U+0084 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00,	// U+0085 ()
+	0x00, 0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0086 ()
+	0x00, 0x08, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+0087 ()
+	0x00, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0088 ()
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x08, 0x08, 0x04, 0x04, 0x2a, 0x2a, 0x00, 0x00, 0x00, 0x00,	// U+0089 ()
+	0x00, 0x24, 0x18, 0x3c, 0x42, 0x02, 0x02, 0x3c, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+008A ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+008B ()
+	0x00, 0x00, 0x00, 0x6c, 0x12, 0x12, 0x12, 0x32, 0x12, 0x12, 0x12, 0x6c, 0x00, 0x00, 0x00, 0x00,	// U+008C ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+008D ()
+	0x00, 0x24, 0x18, 0x7e, 0x20, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+008E ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+008F ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0090 ()
+	0x00, 0x0c, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0091 ()
+	0x00, 0x18, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0092 ()
+	0x00, 0x36, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0093 ()
+	0x00, 0x6c, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0094 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0095 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0096 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0097 ()
+	0x00, 0x00, 0x00, 0x2c, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0098 ()
+	0x00, 0x00, 0x00, 0x5e, 0x74, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+0099 ()
+	0x00, 0x00, 0x24, 0x18, 0x00, 0x3c, 0x42, 0x02, 0x3c, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+009A ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+009B ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x49, 0x49, 0x79, 0x09, 0x49, 0x36, 0x00, 0x00, 0x00, 0x00,	// U+009C ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+009D ()
+	0x00, 0x00, 0x24, 0x18, 0x00, 0x7e, 0x20, 0x10, 0x08, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+009E ()
+	0x00, 0x14, 0x14, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+009F ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00A0 ( )
+	0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+00A1 (¡)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x0a, 0x0a, 0x0a, 0x2a, 0x1c, 0x08, 0x00, 0x00, 0x00,	// U+00A2 (¢)
+	0x00, 0x00, 0x00, 0x18, 0x24, 0x04, 0x04, 0x1e, 0x04, 0x04, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+00A3 (£)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00A4 (¤)
+	0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+00A5 (¥)
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,	// U+00A6 (¦)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x1c, 0x24, 0x38, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00A7 (§)
+	0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00A8 (¨)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x52, 0x4a, 0x4a, 0x4a, 0x52, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00A9 (©)
+	0x00, 0x00, 0x00, 0x0c, 0x10, 0x1c, 0x12, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00AA (ª)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x24, 0x12, 0x24, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00AB («)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00AC (¬)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00AD (­)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x5a, 0x6a, 0x5a, 0x6a, 0x6a, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00AE (®)
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00AF (¯)
+	0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B0 (°)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B1 (±)
+	0x00, 0x0e, 0x10, 0x08, 0x04, 0x02, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B2 (²)
+	0x00, 0x0e, 0x10, 0x0c, 0x10, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B3 (³)
+	0x00, 0x18, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B4 (´)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2c, 0x14, 0x04, 0x04, 0x02, 0x00,	// U+00B5 (µ)
+	0x00, 0x00, 0x00, 0x7c, 0x2e, 0x2e, 0x2e, 0x2c, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00,	// U+00B6 (¶)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B7 (·)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x10, 0x08, 0x00,	// U+00B8 (¸)
+	0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00B9 (¹)
+	0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00BA (º)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x48, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00BB (»)
+	0x00, 0x40, 0x44, 0x26, 0x24, 0x14, 0x10, 0x08, 0x48, 0x64, 0x74, 0x42, 0x42, 0x00, 0x00, 0x00,	// U+00BC (¼)
+	0x00, 0x40, 0x44, 0x26, 0x24, 0x14, 0x10, 0x08, 0x28, 0x54, 0x44, 0x22, 0x72, 0x00, 0x00, 0x00,	// U+00BD (½)
+	0x00, 0x40, 0x46, 0x24, 0x22, 0x14, 0x16, 0x08, 0x48, 0x64, 0x74, 0x42, 0x42, 0x00, 0x00, 0x00,	// U+00BE (¾)
+	0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x10, 0x0c, 0x02, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00BF (¿)
+	0x00, 0x08, 0x10, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C0 (À)
+	0x00, 0x10, 0x08, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C1 (Á)
+	0x00, 0x18, 0x24, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C2 (Â)
+	0x00, 0x58, 0x34, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C3 (Ã)
+	0x00, 0x24, 0x24, 0x00, 0x18, 0x24, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C4 (Ä)
+	0x00, 0x18, 0x24, 0x18, 0x18, 0x24, 0x24, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00C5 (Å)
+	0x00, 0x00, 0x00, 0x70, 0x18, 0x14, 0x14, 0x72, 0x1e, 0x12, 0x12, 0x72, 0x00, 0x00, 0x00, 0x00,	// U+00C6 (Æ)
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x08, 0x08, 0x04, 0x00,	// U+00C7 (Ç)
+	0x00, 0x08, 0x10, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+00C8 (È)
+	0x00, 0x10, 0x08, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+00C9 (É)
+	0x00, 0x18, 0x24, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+00CA (Ê)
+	0x00, 0x24, 0x24, 0x00, 0x7e, 0x02, 0x02, 0x3e, 0x02, 0x02, 0x02, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+00CB (Ë)
+	0x00, 0x08, 0x10, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+00CC (Ì)
+	0x00, 0x10, 0x08, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+00CD (Í)
+	0x00, 0x08, 0x14, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+00CE (Î)
+	0x00, 0x24, 0x24, 0x00, 0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00, 0x00,	// U+00CF (Ï)
+	0x00, 0x00, 0x00, 0x00, 0x3c, 0x44, 0x44, 0x4e, 0x44, 0x44, 0x44, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D0 (Ð)
+	0x00, 0x58, 0x34, 0x00, 0x42, 0x46, 0x4a, 0x52, 0x62, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00D1 (Ñ)
+	0x00, 0x08, 0x10, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D2 (Ò)
+	0x00, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D3 (Ó)
+	0x00, 0x18, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D4 (Ô)
+	0x00, 0x58, 0x34, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D5 (Õ)
+	0x00, 0x24, 0x24, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D6 (Ö)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x24, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00D7 (×)
+	0x00, 0x00, 0x00, 0x5c, 0x22, 0x52, 0x52, 0x4a, 0x4a, 0x4a, 0x44, 0x3a, 0x00, 0x00, 0x00, 0x00,	// U+00D8 (Ø)
+	0x00, 0x08, 0x10, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00D9 (Ù)
+	0x00, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00DA (Ú)
+	0x00, 0x18, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00DB (Û)
+	0x00, 0x24, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00DC (Ü)
+	0x00, 0x10, 0x08, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+00DD (Ý)
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x1e, 0x22, 0x22, 0x1e, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+00DE (Þ)
+	0x00, 0x00, 0x00, 0x38, 0x44, 0x44, 0x3c, 0x44, 0x44, 0x44, 0x44, 0x3c, 0x02, 0x00, 0x00, 0x00,	// U+00DF (ß)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E0 (à)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E1 (á)
+	0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E2 (â)
+	0x00, 0x58, 0x34, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E3 (ã)
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E4 (ä)
+	0x00, 0x10, 0x28, 0x10, 0x00, 0x3c, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00E5 (å)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x4a, 0x48, 0x7c, 0x0a, 0x4a, 0x34, 0x00, 0x00, 0x00, 0x00,	// U+00E6 (æ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x42, 0x02, 0x02, 0x02, 0x42, 0x3c, 0x10, 0x10, 0x10, 0x08,	// U+00E7 (ç)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00E8 (è)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00E9 (é)
+	0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00EA (ê)
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x02, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00EB (ë)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+00EC (ì)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+00ED (í)
+	0x00, 0x10, 0x28, 0x44, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+00EE (î)
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00, 0x00,	// U+00EF (ï)
+	0x00, 0x2c, 0x10, 0x28, 0x40, 0x40, 0x7c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F0 (ð)
+	0x00, 0x58, 0x34, 0x00, 0x00, 0x3e, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00, 0x00,	// U+00F1 (ñ)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F2 (ò)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F3 (ó)
+	0x00, 0x10, 0x28, 0x44, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F4 (ô)
+	0x00, 0x58, 0x34, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F5 (õ)
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00, 0x00,	// U+00F6 (ö)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+00F7 (÷)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x3c, 0x62, 0x52, 0x4a, 0x4a, 0x46, 0x3c, 0x02, 0x00, 0x00, 0x00,	// U+00F8 (ø)
+	0x00, 0x18, 0x10, 0x20, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00F9 (ù)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00FA (ú)
+	0x00, 0x10, 0x28, 0x44, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00FB (û)
+	0x00, 0x24, 0x24, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x00, 0x00, 0x00, 0x00,	// U+00FC (ü)
+	0x00, 0x30, 0x10, 0x08, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c,	// U+00FD (ý)
+	0x00, 0x00, 0x02, 0x02, 0x02, 0x1e, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1e, 0x02, 0x02, 0x02, 0x00,	// U+00FE (þ)
+	0x00, 0x00, 0x24, 0x24, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7c, 0x40, 0x40, 0x40, 0x3c,	// U+00FF (ÿ)
+	0x00, 0x00, 0x03, 0x04, 0x04, 0x08, 0x08, 0x14, 0x22, 0x22, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00,	// U+03BB (λ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x14, 0x14, 0x12, 0x12, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00,	// U+03C0 (π)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc4, 0xc6, 0xff, 0xff, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00,	// U+21B5 (↵)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+25AA (▪)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x00, 0x00, 0x00, 0x00,	// U+25B4 (▴)
+	0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00,	// U+25B8 (▸)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+25BE (▾)
+	0x00, 0x00, 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00,	// U+25C2 (◂)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+25C6 (◆)
+	0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x11, 0x09, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00,	// U+2713 (✓)
+	0x00, 0x40, 0x44, 0x24, 0x18, 0x18, 0x28, 0x44, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,	// U+2717 (✗)
+	0x03, 0x03, 0x03, 0x23, 0x73, 0xfb, 0x23, 0x33, 0x39, 0x1c, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07,	// U+E0A0 ()
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x88, 0x98, 0x98, 0xa8, 0xe8, 0xc8, 0x88, 0x00,	// U+E0A1 ()
+	0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x7e, 0xe7, 0xc3, 0xe7, 0xff, 0x7e, 0x3c, 0x00, 0x00, 0x00,	// U+E0A2 ()
+	0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01,	// U+E0B0 ()
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,	// U+E0B1 ()
+	0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80,	// U+E0B2 ()
+	0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,	// U+E0B3 ()
+	0x00, 0x00, 0x00, 0xf7, 0xf7, 0x07, 0xf7, 0xf0, 0xf7, 0x07, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00,	// U+EE00 ()
+	0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00,	// U+EE01 ()
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EE02 ()
+	0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00,	// U+EE03 ()
+	0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0xf9, 0x8f, 0x89, 0xf9, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EE10 ()
+	0x00, 0x00, 0x00, 0xff, 0x91, 0x91, 0xff, 0xa9, 0xa9, 0xa9, 0xa9, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EE11 ()
+	0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EE12 ()
+	0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EE13 ()
+	0x00, 0x00, 0x00, 0x10, 0x18, 0x5c, 0x2f, 0x17, 0x0b, 0x14, 0x1a, 0x11, 0x00, 0x00, 0x00, 0x00,	// U+EE20 ()
+	0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00,	// U+EE21 ()
+	0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x5f, 0x5f, 0x5f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00,	// U+EE22 ()
+	0x00, 0x00, 0x00, 0x08, 0x4c, 0x8e, 0xaf, 0xaf, 0xaf, 0x8e, 0x4c, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+EE23 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE30 ()
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE31 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE32 ()
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x2e, 0x3e, 0x2e, 0x26, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE33 ()
+	0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x3f, 0x7f, 0x3f, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE34 ()
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x3a, 0x3e, 0x3a, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE35 ()
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x6c, 0x7e, 0x7f, 0x7e, 0x6c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE36 ()
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x7e, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,	// U+EE37 ()
+	0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x41, 0x5d, 0x41, 0x7f, 0x00, 0x00,	// U+EE40 ()
+	0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00,	// U+EE41 ()
+	0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00,	// U+EE42 ()
+	0x00, 0x00, 0x1c, 0x7f, 0x77, 0x63, 0x77, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00,	// U+EE43 ()
+	0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0xa1, 0xd1, 0x8b, 0x85, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00,	// U+EEF0 ()
+	0x00, 0x00, 0x00, 0x00, 0xdb, 0x81, 0x3c, 0xbd, 0xbd, 0x3c, 0x81, 0xdb, 0x00, 0x00, 0x00, 0x00,	// U+EEF1 ()
+	0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00,	// U+EEF2 ()
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x84, 0x84, 0x84, 0x84, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x00,	// U+EEF3 ()
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0xe4, 0x27, 0x27, 0xe4, 0x28, 0x30, 0x00, 0x00, 0x00, 0x00,	// U+EEF4 ()
+	0x00, 0x0c, 0x5e, 0x1e, 0x5e, 0x1e, 0x52, 0x12, 0x52, 0x21, 0x21, 0x21, 0x12, 0x0c, 0x00, 0x00,	// U+EEF5 ()
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7e, 0xbd, 0xdb, 0xe7, 0xbd, 0x7e, 0x00, 0x00, 0x00, 0x00,	// U+EEF6 ()
+	0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x81, 0x81, 0xa5, 0xe7, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00,	// U+EEF7 ()
+	0x00, 0x00, 0x00, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00,	// U+EEF8 ()
+	0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00,	// U+EEF9 ()
+}; // 298
 
-static const unsigned char ctrld_block2[][16] = {
-	{ 0x00, 0x00, 0x03, 0x04, 0x04, 0x08, 0x08, 0x14, 0x22, 0x22, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00 },	// U+03BB (λ)
-}; // 1
-
-static const unsigned char ctrld_block3[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x14, 0x14, 0x12, 0x12, 0x51, 0x71, 0x00, 0x00, 0x00, 0x00 },	// U+03C0 (π)
-}; // 1
-
-static const unsigned char ctrld_block4[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc4, 0xc6, 0xff, 0xff, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-}; // 1
-
-static const unsigned char ctrld_block5[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-}; // 1
-
-static const unsigned char ctrld_block6[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x1c, 0x1c, 0x3e, 0x3e, 0x7f, 0x00, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
-}; // 1
-
-static const unsigned char ctrld_block7[][16] = {
-	{ 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x3e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+25B8 (▸)
-}; // 1
-
-static const unsigned char ctrld_block8[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3e, 0x3e, 0x1c, 0x1c, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+25BE (▾)
-}; // 1
-
-static const unsigned char ctrld_block9[][16] = {
-	{ 0x00, 0x00, 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+25C2 (◂)
-}; // 1
-
-static const unsigned char ctrld_block10[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C6 (◆)
-}; // 1
-
-static const unsigned char ctrld_block11[][16] = {
-	{ 0x00, 0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x11, 0x09, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2713 (✓)
-}; // 1
-
-static const unsigned char ctrld_block12[][16] = {
-	{ 0x00, 0x40, 0x44, 0x24, 0x18, 0x18, 0x28, 0x44, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+2717 (✗)
-}; // 1
-
-static const unsigned char ctrld_block13[][16] = {
-	{ 0x03, 0x03, 0x03, 0x23, 0x73, 0xfb, 0x23, 0x33, 0x39, 0x1c, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+E0A0 ()
-	{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x88, 0x98, 0x98, 0xa8, 0xe8, 0xc8, 0x88, 0x00 },	// U+E0A1 ()
-	{ 0x00, 0x00, 0x3c, 0x66, 0x42, 0x42, 0x7e, 0xe7, 0xc3, 0xe7, 0xff, 0x7e, 0x3c, 0x00, 0x00, 0x00 },	// U+E0A2 ()
-}; // 3
-
-static const unsigned char ctrld_block14[][16] = {
-	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+E0B0 ()
-	{ 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 },	// U+E0B1 ()
-	{ 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0x80 },	// U+E0B2 ()
-	{ 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 },	// U+E0B3 ()
-}; // 4
-
-static const unsigned char ctrld_block15[][16] = {
-	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0x07, 0xf7, 0xf0, 0xf7, 0x07, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00 },	// U+EE00 ()
-	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+EE01 ()
-	{ 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE02 ()
-	{ 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0xf7, 0xf7, 0xf7, 0xf7, 0x00, 0x00, 0x00, 0x00 },	// U+EE03 ()
-}; // 4
-
-static const unsigned char ctrld_block16[][16] = {
-	{ 0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0xf9, 0x8f, 0x89, 0xf9, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE10 ()
-	{ 0x00, 0x00, 0x00, 0xff, 0x91, 0x91, 0xff, 0xa9, 0xa9, 0xa9, 0xa9, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE11 ()
-	{ 0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE12 ()
-	{ 0x00, 0x00, 0x00, 0xff, 0x89, 0x89, 0x89, 0xff, 0x89, 0x89, 0x89, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EE13 ()
-}; // 4
-
-static const unsigned char ctrld_block17[][16] = {
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x5c, 0x2f, 0x17, 0x0b, 0x14, 0x1a, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+EE20 ()
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x1f, 0x1f, 0x1f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+EE21 ()
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x5f, 0x5f, 0x5f, 0x1c, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+EE22 ()
-	{ 0x00, 0x00, 0x00, 0x08, 0x4c, 0x8e, 0xaf, 0xaf, 0xaf, 0x8e, 0x4c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+EE23 ()
-}; // 4
-
-static const unsigned char ctrld_block18[][16] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE30 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE31 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE32 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x22, 0x26, 0x2e, 0x3e, 0x2e, 0x26, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE33 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x1b, 0x3f, 0x7f, 0x3f, 0x1b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE34 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x3a, 0x3e, 0x3a, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE35 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x48, 0x6c, 0x7e, 0x7f, 0x7e, 0x6c, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE36 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x7e, 0x7e, 0x7e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+EE37 ()
-}; // 8
-
-static const unsigned char ctrld_block19[][16] = {
-	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x41, 0x5d, 0x41, 0x7f, 0x00, 0x00 },	// U+EE40 ()
-	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x41, 0x41, 0x41, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE41 ()
-	{ 0x00, 0x00, 0x1c, 0x7f, 0x49, 0x5d, 0x49, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE42 ()
-	{ 0x00, 0x00, 0x1c, 0x7f, 0x77, 0x63, 0x77, 0x7f, 0x7f, 0x7f, 0x7f, 0x63, 0x7f, 0x7f, 0x00, 0x00 },	// U+EE43 ()
-}; // 4
-
-static const unsigned char ctrld_block20[][16] = {
-	{ 0x00, 0x00, 0x00, 0xff, 0x81, 0x81, 0xa1, 0xd1, 0x8b, 0x85, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00 },	// U+EEF0 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xdb, 0x81, 0x3c, 0xbd, 0xbd, 0x3c, 0x81, 0xdb, 0x00, 0x00, 0x00, 0x00 },	// U+EEF1 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00 },	// U+EEF2 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x84, 0x84, 0x84, 0x84, 0xe7, 0xe7, 0x00, 0x00, 0x00, 0x00 },	// U+EEF3 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0xe4, 0x27, 0x27, 0xe4, 0x28, 0x30, 0x00, 0x00, 0x00, 0x00 },	// U+EEF4 ()
-	{ 0x00, 0x0c, 0x5e, 0x1e, 0x5e, 0x1e, 0x52, 0x12, 0x52, 0x21, 0x21, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+EEF5 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7e, 0xbd, 0xdb, 0xe7, 0xbd, 0x7e, 0x00, 0x00, 0x00, 0x00 },	// U+EEF6 ()
-	{ 0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x81, 0x81, 0xa5, 0xe7, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00 },	// U+EEF7 ()
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0x3e, 0x1c, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+EEF8 ()
-	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+EEF9 ()
-}; // 10
+static const uint16_t ctrld_chunks[] = {
+	1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 0, 10, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 0, 14,
+};
+static const uint64_t ctrld_coverage[] = {
+	0x0000000000000000, 0xfffffffffffffc00, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0x0800000000000000, 0x0000000000000001, 0x0020000000000000,
+	0x4110040000000000, 0x0000000000000044, 0x0000000000880000, 0x000f000700000000,
+	0x00ff000f000f000f, 0x000000000000000f, 0x03ff000000000000,
+};
+static const uint16_t ctrld_ranks[] = {
+	0, 0, 54, 118, 182, 246, 247, 248, 249, 253, 255, 257, 264, 284, 288,
+};
+static const FBInkFont ctrld_font = {
+	.map =
+	    {
+		.chunks      = ctrld_chunks,
+		.coverage    = ctrld_coverage,
+		.ranks       = ctrld_ranks,
+		.chunk_count = 956U,
+	    },
+	.ids         = NULL,
+	.bitmaps     = ctrld_bitmaps,
+	.width       = 8U,
+	.height      = 16U,
+	.bitmap_size = 16U,
+};
 
@@ -1,4796 +1,5528 @@
 /*
 * C Header for use with https://github.com/NiLuJe/FBInk
-* Converted from Hex font ../fonts/orp-6x12.hex
+* Converted from Hex fonts ../fonts/orp-6x12.hex, ../fonts/orp-6x12b.hex, ../fonts/orp-6x12i.hex
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char orp_block1[][12] = {
-	{ 0x00, 0x00, 0x00, 0x15, 0x00, 0x11, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00 },	// U+0000 (ESC)
-}; // 1
+static const uint8_t orp_bitmaps[] = {
+	0x00, 0x00, 0x54, 0x40, 0x04, 0x44, 0x40, 0x05, 0x00,	// orp U+0000 (ESC)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0020 ( )
+	0x00, 0x00, 0x18, 0x86, 0x61, 0x00, 0x86, 0x01, 0x00,	// orp U+0021 (!)
+	0x00, 0xa0, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0022 (")
+	0x00, 0x00, 0x00, 0xca, 0xa7, 0x7c, 0x0a, 0x00, 0x00,	// orp U+0023 (#)
+	0x00, 0x00, 0x10, 0x5e, 0xe1, 0x50, 0x0f, 0x01, 0x00,	// orp U+0024 ($)
+	0x00, 0x00, 0x00, 0xd3, 0x42, 0x68, 0x19, 0x00, 0x00,	// orp U+0025 (%)
+	0x00, 0x00, 0x08, 0x45, 0x21, 0x54, 0x89, 0x05, 0x00,	// orp U+0026 (&)
+	0x00, 0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0027 (')
+	0x00, 0x80, 0x10, 0x82, 0x20, 0x08, 0x02, 0x81, 0x00,	// orp U+0028 (()
+	0x00, 0x20, 0x10, 0x08, 0x82, 0x20, 0x08, 0x21, 0x00,	// orp U+0029 ())
+	0x00, 0x00, 0x10, 0x95, 0xe3, 0x54, 0x04, 0x00, 0x00,	// orp U+002A (*)
+	0x00, 0x00, 0x00, 0x04, 0xf1, 0x11, 0x04, 0x00, 0x00,	// orp U+002B (+)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x00,	// orp U+002C (,)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00,	// orp U+002D (-)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x00,	// orp U+002E (.)
+	0x00, 0x00, 0x40, 0x10, 0x42, 0x08, 0x41, 0x00, 0x00,	// orp U+002F (/)
+	0x00, 0x00, 0x38, 0x51, 0x54, 0x45, 0x91, 0x03, 0x00,	// orp U+0030 (0)
+	0x00, 0x00, 0x10, 0x46, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+0031 (1)
+	0x00, 0x00, 0x38, 0x11, 0x84, 0x10, 0xc2, 0x07, 0x00,	// orp U+0032 (2)
+	0x00, 0x00, 0x7c, 0x10, 0xc2, 0x40, 0x91, 0x03, 0x00,	// orp U+0033 (3)
+	0x00, 0x00, 0x20, 0x8c, 0x92, 0x7c, 0x08, 0x07, 0x00,	// orp U+0034 (4)
+	0x00, 0x00, 0x7c, 0xc1, 0x03, 0x41, 0x91, 0x03, 0x00,	// orp U+0035 (5)
+	0x00, 0x00, 0x38, 0xc1, 0x13, 0x55, 0x91, 0x03, 0x00,	// orp U+0036 (6)
+	0x00, 0x00, 0x7c, 0x10, 0x82, 0x10, 0x04, 0x01, 0x00,	// orp U+0037 (7)
+	0x00, 0x00, 0x38, 0x51, 0xe4, 0x44, 0x91, 0x03, 0x00,	// orp U+0038 (8)
+	0x00, 0x00, 0x38, 0x51, 0x15, 0x79, 0x90, 0x03, 0x00,	// orp U+0039 (9)
+	0x00, 0x00, 0x00, 0x80, 0x61, 0x00, 0x86, 0x01, 0x00,	// orp U+003A (:)
+	0x00, 0x00, 0x00, 0x80, 0x61, 0x00, 0x86, 0x31, 0x00,	// orp U+003B (;)
+	0x00, 0x00, 0x00, 0x08, 0x21, 0x10, 0x08, 0x00, 0x00,	// orp U+003C (<)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x7c, 0x00, 0x00, 0x00,	// orp U+003D (=)
+	0x00, 0x00, 0x00, 0x02, 0x81, 0x10, 0x02, 0x00, 0x00,	// orp U+003E (>)
+	0x00, 0x00, 0x38, 0x11, 0x84, 0x10, 0x00, 0x01, 0x00,	// orp U+003F (?)
+	0x00, 0x00, 0x38, 0x51, 0x57, 0x75, 0x81, 0x03, 0x00,	// orp U+0040 (@)
+	0x00, 0x00, 0x10, 0x4a, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0041 (A)
+	0x00, 0x00, 0x1c, 0x49, 0xf2, 0x44, 0xd1, 0x03, 0x00,	// orp U+0042 (B)
+	0x00, 0x00, 0x18, 0x49, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+0043 (C)
+	0x00, 0x00, 0x1c, 0x49, 0x14, 0x45, 0xd1, 0x03, 0x00,	// orp U+0044 (D)
+	0x00, 0x00, 0x3c, 0x41, 0x70, 0x04, 0xc1, 0x07, 0x00,	// orp U+0045 (E)
+	0x00, 0x00, 0x3c, 0x41, 0x70, 0x04, 0x41, 0x00, 0x00,	// orp U+0046 (F)
+	0x00, 0x00, 0x18, 0x49, 0x90, 0x45, 0x91, 0x03, 0x00,	// orp U+0047 (G)
+	0x00, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0048 (H)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+0049 (I)
+	0x00, 0x00, 0x60, 0x10, 0x04, 0x41, 0x91, 0x03, 0x00,	// orp U+004A (J)
+	0x00, 0x00, 0x24, 0x49, 0x31, 0x14, 0x49, 0x04, 0x00,	// orp U+004B (K)
+	0x00, 0x00, 0x04, 0x41, 0x10, 0x04, 0xc1, 0x07, 0x00,	// orp U+004C (L)
+	0x00, 0x00, 0x44, 0x5b, 0x55, 0x45, 0x51, 0x04, 0x00,	// orp U+004D (M)
+	0x00, 0x00, 0x44, 0x53, 0x95, 0x45, 0x51, 0x04, 0x00,	// orp U+004E (N)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+004F (O)
+	0x00, 0x00, 0x1c, 0x49, 0x72, 0x04, 0x41, 0x00, 0x00,	// orp U+0050 (P)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0x95, 0x02, 0x01,	// orp U+0051 (Q)
+	0x00, 0x00, 0x1c, 0x49, 0xf2, 0x44, 0x51, 0x04, 0x00,	// orp U+0052 (R)
+	0x00, 0x00, 0x18, 0x49, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+0053 (S)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+0054 (T)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0055 (U)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x29, 0x0a, 0x01, 0x00,	// orp U+0056 (V)
+	0x00, 0x00, 0x44, 0x51, 0x54, 0x55, 0xd5, 0x06, 0x00,	// orp U+0057 (W)
+	0x00, 0x00, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x00,	// orp U+0058 (X)
+	0x00, 0x00, 0x44, 0x51, 0xe4, 0x10, 0x04, 0x01, 0x00,	// orp U+0059 (Y)
+	0x00, 0x00, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x07, 0x00,	// orp U+005A (Z)
+	0x00, 0xe0, 0x08, 0x82, 0x20, 0x08, 0x82, 0xe0, 0x00,	// orp U+005B ([)
+	0x00, 0x00, 0x04, 0x81, 0x40, 0x20, 0x10, 0x04, 0x00,	// orp U+005C (\)
+	0x00, 0xe0, 0x20, 0x08, 0x82, 0x20, 0x08, 0xe2, 0x00,	// orp U+005D (])
+	0x00, 0x40, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+005E (^)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01,	// orp U+005F (_)
+	0x00, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0060 (`)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x45, 0x99, 0x05, 0x00,	// orp U+0061 (a)
+	0x00, 0x00, 0x04, 0x41, 0x33, 0x45, 0xd1, 0x03, 0x00,	// orp U+0062 (b)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x81, 0x07, 0x00,	// orp U+0063 (c)
+	0x00, 0x00, 0x40, 0x90, 0x17, 0x45, 0x99, 0x05, 0x00,	// orp U+0064 (d)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x7d, 0x81, 0x07, 0x00,	// orp U+0065 (e)
+	0x00, 0x80, 0x13, 0xc4, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+0066 (f)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x45, 0x99, 0x15, 0x39,	// orp U+0067 (g)
+	0x00, 0x00, 0x04, 0x41, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+0068 (h)
+	0x00, 0x00, 0x10, 0x80, 0x41, 0x10, 0x04, 0x06, 0x00,	// orp U+0069 (i)
+	0x00, 0x00, 0x20, 0x00, 0x83, 0x20, 0x08, 0x82, 0x1c,	// orp U+006A (j)
+	0x00, 0x00, 0x04, 0x41, 0x94, 0x14, 0x4b, 0x04, 0x00,	// orp U+006B (k)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x10, 0x04, 0x06, 0x00,	// orp U+006C (l)
+	0x00, 0x00, 0x00, 0xc0, 0x53, 0x55, 0x55, 0x05, 0x00,	// orp U+006D (m)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+006E (n)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+006F (o)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0xd1, 0x13, 0x04,	// orp U+0070 (p)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x45, 0x99, 0x05, 0x41,	// orp U+0071 (q)
+	0x00, 0x00, 0x00, 0x40, 0x37, 0x05, 0x41, 0x00, 0x00,	// orp U+0072 (r)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+0073 (s)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x00,	// orp U+0074 (t)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x99, 0x05, 0x00,	// orp U+0075 (u)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x0a, 0x01, 0x00,	// orp U+0076 (v)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x95, 0x02, 0x00,	// orp U+0077 (w)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x00,	// orp U+0078 (x)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+0079 (y)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xc2, 0x07, 0x00,	// orp U+007A (z)
+	0x00, 0x80, 0x10, 0x04, 0x31, 0x10, 0x04, 0x81, 0x00,	// orp U+007B ({)
+	0x00, 0x40, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x00,	// orp U+007C (|)
+	0x00, 0x20, 0x10, 0x04, 0x81, 0x11, 0x04, 0x21, 0x00,	// orp U+007D (})
+	0x00, 0x00, 0x00, 0x80, 0x54, 0x25, 0x00, 0x00, 0x00,	// orp U+007E (~)
+	0x00, 0x00, 0x10, 0x00, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+00A1 (¡)
+	0x00, 0x00, 0x00, 0x84, 0x53, 0x15, 0x95, 0x43, 0x00,	// orp U+00A2 (¢)
+	0x00, 0x00, 0x30, 0x92, 0x70, 0x08, 0x52, 0x03, 0x00,	// orp U+00A3 (£)
+	0x00, 0x00, 0x00, 0x40, 0xa5, 0x44, 0x4a, 0x05, 0x00,	// orp U+00A4 (¤)
+	0x00, 0x00, 0x44, 0xca, 0x47, 0x7c, 0x04, 0x01, 0x00,	// orp U+00A5 (¥)
+	0x00, 0x00, 0x10, 0x04, 0x01, 0x10, 0x04, 0x01, 0x00,	// orp U+00A6 (¦)
+	0x00, 0xc0, 0x09, 0x8c, 0x24, 0x31, 0x90, 0x03, 0x00,	// orp U+00A7 (§)
+	0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00A8 (¨)
+	0x00, 0x00, 0x78, 0x61, 0x5a, 0xa6, 0xa1, 0x07, 0x00,	// orp U+00A9 (©)
+	0x00, 0xa3, 0x30, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+00AA (ª)
+	0x00, 0x00, 0x00, 0x94, 0x52, 0x28, 0x14, 0x00, 0x00,	// orp U+00AB («)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x10, 0x00, 0x00,	// orp U+00AC (¬)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,	// orp U+00AD (­)
+	0x00, 0x00, 0x78, 0x61, 0x5b, 0x96, 0xa1, 0x07, 0x00,	// orp U+00AE (®)
+	0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00AF (¯)
+	0x00, 0x23, 0x49, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00B0 (°)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0xc0, 0x07, 0x00,	// orp U+00B1 (±)
+	0x84, 0x82, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00B2 (²)
+	0x06, 0x42, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00B3 (³)
+	0x00, 0x80, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00B4 (´)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0xd9, 0x15, 0x04,	// orp U+00B5 (µ)
+	0x00, 0xe0, 0x5d, 0xd7, 0x65, 0x51, 0x14, 0x05, 0x00,	// orp U+00B6 (¶)
+	0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00,	// orp U+00B7 (·)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18,	// orp U+00B8 (¸)
+	0x84, 0x41, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00B9 (¹)
+	0x84, 0x42, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+00BA (º)
+	0x00, 0x00, 0x00, 0x85, 0x42, 0x29, 0x05, 0x00, 0x00,	// orp U+00BB (»)
+	0xc2, 0x20, 0x08, 0x0a, 0xa3, 0x78, 0x08, 0x02, 0x00,	// orp U+00BC (¼)
+	0xc2, 0x20, 0x08, 0x0a, 0x05, 0x21, 0x04, 0x07, 0x00,	// orp U+00BD (½)
+	0x03, 0x21, 0x10, 0x0b, 0xa3, 0x78, 0x08, 0x02, 0x00,	// orp U+00BE (¾)
+	0x00, 0x00, 0x10, 0x00, 0x41, 0x08, 0x91, 0x03, 0x00,	// orp U+00BF (¿)
+	0x02, 0x01, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C0 (À)
+	0x08, 0x01, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C1 (Á)
+	0x84, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C2 (Â)
+	0x56, 0x03, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C3 (Ã)
+	0x80, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C4 (Ä)
+	0x84, 0x42, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+00C5 (Å)
+	0x00, 0x00, 0x78, 0x45, 0xf1, 0x14, 0x45, 0x07, 0x00,	// orp U+00C6 (Æ)
+	0x00, 0x00, 0x38, 0x51, 0x10, 0x04, 0x91, 0x83, 0x18,	// orp U+00C7 (Ç)
+	0x02, 0x01, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+00C8 (È)
+	0x08, 0x01, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+00C9 (É)
+	0x84, 0x02, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+00CA (Ê)
+	0x80, 0x02, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+00CB (Ë)
+	0x02, 0x01, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00CC (Ì)
+	0x08, 0x01, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00CD (Í)
+	0x84, 0x02, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00CE (Î)
+	0x80, 0x02, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00CF (Ï)
+	0x00, 0x00, 0x38, 0x92, 0x74, 0x49, 0x92, 0x03, 0x00,	// orp U+00D0 (Ð)
+	0x56, 0x03, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00,	// orp U+00D1 (Ñ)
+	0x02, 0x01, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D2 (Ò)
+	0x08, 0x01, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D3 (Ó)
+	0x84, 0x02, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D4 (Ô)
+	0x56, 0x03, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D5 (Õ)
+	0x80, 0x02, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D6 (Ö)
+	0x00, 0x00, 0x00, 0x91, 0x42, 0x28, 0x11, 0x00, 0x00,	// orp U+00D7 (×)
+	0x00, 0x00, 0x39, 0x59, 0x55, 0x55, 0x93, 0x13, 0x00,	// orp U+00D8 (Ø)
+	0x02, 0x01, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00D9 (Ù)
+	0x08, 0x01, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00DA (Ú)
+	0x84, 0x02, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00DB (Û)
+	0x80, 0x02, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00DC (Ü)
+	0x08, 0x01, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+00DD (Ý)
+	0x00, 0x00, 0x08, 0x8e, 0x24, 0x49, 0x8e, 0x00, 0x00,	// orp U+00DE (Þ)
+	0x00, 0x00, 0x38, 0x51, 0x52, 0x24, 0x51, 0x03, 0x00,	// orp U+00DF (ß)
+	0x00, 0x20, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E0 (à)
+	0x00, 0x80, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E1 (á)
+	0x00, 0x40, 0x28, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E2 (â)
+	0x00, 0x60, 0x35, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E3 (ã)
+	0x00, 0x00, 0x28, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E4 (ä)
+	0x00, 0x40, 0x28, 0x84, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+00E5 (å)
+	0x00, 0x00, 0x00, 0x80, 0x43, 0x39, 0x85, 0x07, 0x00,	// orp U+00E6 (æ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x91, 0x83, 0x18,	// orp U+00E7 (ç)
+	0x00, 0x20, 0x10, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+00E8 (è)
+	0x00, 0x80, 0x10, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+00E9 (é)
+	0x00, 0x40, 0x28, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+00EA (ê)
+	0x00, 0x00, 0x28, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+00EB (ë)
+	0x00, 0x20, 0x10, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00EC (ì)
+	0x00, 0x80, 0x10, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00ED (í)
+	0x00, 0x40, 0x28, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00EE (î)
+	0x00, 0x00, 0x28, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+00EF (ï)
+	0x80, 0x42, 0x28, 0x90, 0x17, 0x45, 0x91, 0x03, 0x00,	// orp U+00F0 (ð)
+	0x00, 0x60, 0x35, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+00F1 (ñ)
+	0x00, 0x20, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+00F2 (ò)
+	0x00, 0x80, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+00F3 (ó)
+	0x00, 0x40, 0x28, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+00F4 (ô)
+	0x00, 0x60, 0x35, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+00F5 (õ)
+	0x00, 0x00, 0x28, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+00F6 (ö)
+	0x00, 0x00, 0x00, 0x04, 0xf0, 0x01, 0x04, 0x00, 0x00,	// orp U+00F7 (÷)
+	0x00, 0x00, 0x00, 0x80, 0x97, 0x55, 0xd3, 0x03, 0x00,	// orp U+00F8 (ø)
+	0x00, 0x20, 0x10, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00F9 (ù)
+	0x00, 0x80, 0x10, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00FA (ú)
+	0x00, 0x40, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00FB (û)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+00FC (ü)
+	0x00, 0x80, 0x10, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+00FD (ý)
+	0x00, 0x00, 0x04, 0xc1, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+00FE (þ)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+00FF (ÿ)
+	0x80, 0x03, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0100 (Ā)
+	0x00, 0x00, 0x38, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0101 (ā)
+	0x91, 0x03, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0102 (Ă)
+	0x00, 0x10, 0x39, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0103 (ă)
+	0x00, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x84, 0x40,	// orp U+0104 (Ą)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x79, 0x91, 0x47, 0x30,	// orp U+0105 (ą)
+	0x08, 0x01, 0x38, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+0106 (Ć)
+	0x00, 0x80, 0x10, 0x80, 0x13, 0x05, 0x91, 0x03, 0x00,	// orp U+0107 (ć)
+	0x84, 0x02, 0x38, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+0108 (Ĉ)
+	0x00, 0x40, 0x28, 0x80, 0x13, 0x05, 0x81, 0x07, 0x00,	// orp U+0109 (ĉ)
+	0x00, 0x01, 0x38, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+010A (Ċ)
+	0x00, 0x00, 0x10, 0x80, 0x13, 0x05, 0x91, 0x03, 0x00,	// orp U+010B (ċ)
+	0x0a, 0x01, 0x38, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+010C (Č)
+	0x00, 0xa0, 0x10, 0x80, 0x13, 0x05, 0x91, 0x03, 0x00,	// orp U+010D (č)
+	0x0a, 0x01, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x03, 0x00,	// orp U+010E (Ď)
+	0x28, 0x04, 0x40, 0x90, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+010F (ď)
+	0x00, 0x00, 0x3c, 0x92, 0x74, 0x49, 0xd2, 0x03, 0x00,	// orp U+0110 (Đ)
+	0x00, 0x00, 0xe1, 0x90, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+0111 (đ)
+	0x80, 0x03, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0112 (Ē)
+	0x00, 0x00, 0x38, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0113 (ē)
+	0x91, 0x03, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0114 (Ĕ)
+	0x00, 0x10, 0x39, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0115 (ĕ)
+	0x00, 0x01, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0116 (Ė)
+	0x00, 0x00, 0x10, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0117 (ė)
+	0x00, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x47, 0x30,	// orp U+0118 (Ę)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x3d, 0x81, 0x43, 0x30,	// orp U+0119 (ę)
+	0x0a, 0x01, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+011A (Ě)
+	0x00, 0xa0, 0x10, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+011B (ě)
+	0x84, 0x02, 0x38, 0x51, 0x90, 0x45, 0x91, 0x03, 0x00,	// orp U+011C (Ĝ)
+	0x00, 0x40, 0x28, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+011D (ĝ)
+	0x91, 0x03, 0x38, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00,	// orp U+011E (Ğ)
+	0x00, 0x10, 0x39, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+011F (ğ)
+	0x00, 0x01, 0x38, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00,	// orp U+0120 (Ġ)
+	0x00, 0x00, 0x10, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+0121 (ġ)
+	0x00, 0x00, 0x38, 0x51, 0x10, 0x64, 0x91, 0x83, 0x18,	// orp U+0122 (Ģ)
+	0x00, 0x21, 0x18, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+0123 (ģ)
+	0x84, 0x02, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0124 (Ĥ)
+	0x84, 0x02, 0x04, 0xc1, 0x13, 0x45, 0x51, 0x04, 0x00,	// orp U+0125 (ĥ)
+	0x00, 0x00, 0x48, 0xbf, 0xe4, 0x49, 0x92, 0x04, 0x00,	// orp U+0126 (Ħ)
+	0x00, 0x00, 0x08, 0x8f, 0xe0, 0x48, 0x92, 0x04, 0x00,	// orp U+0127 (ħ)
+	0x94, 0x02, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0128 (Ĩ)
+	0x00, 0xa0, 0x14, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0129 (ĩ)
+	0x80, 0x03, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+012A (Ī)
+	0x00, 0x00, 0x38, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+012B (ī)
+	0x91, 0x03, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+012C (Ĭ)
+	0x00, 0x10, 0x39, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+012D (ĭ)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x43, 0x30,	// orp U+012E (Į)
+	0x00, 0x00, 0x10, 0x80, 0x41, 0x10, 0x84, 0x43, 0x30,	// orp U+012F (į)
+	0x00, 0x01, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0130 (İ)
+	0x00, 0x00, 0x00, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0131 (ı)
+	0x00, 0x00, 0x64, 0x51, 0x14, 0x45, 0x55, 0x02, 0x00,	// orp U+0132 (Ĳ)
+	0x00, 0x00, 0x44, 0x40, 0x16, 0x45, 0x51, 0x14, 0x31,	// orp U+0133 (ĳ)
+	0x08, 0x05, 0x20, 0x08, 0x82, 0x20, 0xc8, 0x01, 0x00,	// orp U+0134 (Ĵ)
+	0x00, 0x80, 0x50, 0x00, 0x83, 0x20, 0x08, 0x82, 0x18,	// orp U+0135 (ĵ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x84, 0x18,	// orp U+0136 (Ķ)
+	0x00, 0x00, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x84, 0x18,	// orp U+0137 (ķ)
+	0x00, 0x00, 0x00, 0x80, 0xa4, 0x18, 0x8a, 0x04, 0x00,	// orp U+0138 (ĸ)
+	0x08, 0x01, 0x04, 0x41, 0x10, 0x04, 0xc1, 0x07, 0x00,	// orp U+0139 (Ĺ)
+	0x08, 0x01, 0x18, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+013A (ĺ)
+	0x00, 0x00, 0x04, 0x41, 0x10, 0x04, 0xc1, 0x87, 0x18,	// orp U+013B (Ļ)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x10, 0x84, 0x83, 0x18,	// orp U+013C (ļ)
+	0x0a, 0x01, 0x04, 0x41, 0x10, 0x04, 0xc1, 0x07, 0x00,	// orp U+013D (Ľ)
+	0x0a, 0x01, 0x18, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+013E (ľ)
+	0x00, 0x00, 0x04, 0x41, 0x90, 0x04, 0xc1, 0x07, 0x00,	// orp U+013F (Ŀ)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x11, 0x84, 0x03, 0x00,	// orp U+0140 (ŀ)
+	0x00, 0x00, 0x08, 0x82, 0x31, 0x08, 0x82, 0x07, 0x00,	// orp U+0141 (Ł)
+	0x00, 0x00, 0x18, 0x04, 0x63, 0x10, 0x84, 0x03, 0x00,	// orp U+0142 (ł)
+	0x08, 0x01, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00,	// orp U+0143 (Ń)
+	0x00, 0x80, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+0144 (ń)
+	0x00, 0x00, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x44, 0x08,	// orp U+0145 (Ņ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x44, 0x08,	// orp U+0146 (ņ)
+	0x0a, 0x01, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00,	// orp U+0147 (Ň)
+	0x00, 0xa0, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+0148 (ň)
+	0x00, 0x30, 0x08, 0x81, 0x62, 0x49, 0x92, 0x04, 0x00,	// orp U+0149 (ŉ)
+	0x00, 0x00, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x31,	// orp U+014A (Ŋ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x04, 0x31,	// orp U+014B (ŋ)
+	0x80, 0x03, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+014C (Ō)
+	0x00, 0x00, 0x38, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+014D (ō)
+	0x91, 0x03, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+014E (Ŏ)
+	0x00, 0x10, 0x39, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+014F (ŏ)
+	0x52, 0x02, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0150 (Ő)
+	0x00, 0x20, 0x25, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+0151 (ő)
+	0x00, 0x00, 0x78, 0x45, 0xd1, 0x14, 0x85, 0x07, 0x00,	// orp U+0152 (Œ)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x35, 0x85, 0x07, 0x00,	// orp U+0153 (œ)
+	0x08, 0x01, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x04, 0x00,	// orp U+0154 (Ŕ)
+	0x00, 0x80, 0x10, 0x40, 0x33, 0x05, 0x41, 0x00, 0x00,	// orp U+0155 (ŕ)
+	0x00, 0x00, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x44, 0x08,	// orp U+0156 (Ŗ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x05, 0x41, 0x40, 0x08,	// orp U+0157 (ŗ)
+	0x0a, 0x01, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x04, 0x00,	// orp U+0158 (Ř)
+	0x00, 0xa0, 0x10, 0x40, 0x33, 0x05, 0x41, 0x00, 0x00,	// orp U+0159 (ř)
+	0x08, 0x01, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+015A (Ś)
+	0x00, 0x80, 0x10, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+015B (ś)
+	0x84, 0x02, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+015C (Ŝ)
+	0x00, 0x40, 0x28, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+015D (ŝ)
+	0x00, 0x00, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x83, 0x18,	// orp U+015E (Ş)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x83, 0x18,	// orp U+015F (ş)
+	0x0a, 0x01, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+0160 (Š)
+	0x00, 0xa0, 0x10, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+0161 (š)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x81, 0x18,	// orp U+0162 (Ţ)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x31,	// orp U+0163 (ţ)
+	0x0a, 0x01, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+0164 (Ť)
+	0x0a, 0x01, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x00,	// orp U+0165 (ť)
+	0x00, 0x00, 0x7c, 0xc4, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+0166 (Ŧ)
+	0x00, 0x00, 0x10, 0x1f, 0xf1, 0x11, 0x04, 0x06, 0x00,	// orp U+0167 (ŧ)
+	0x56, 0x03, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0168 (Ũ)
+	0x00, 0x60, 0x35, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0169 (ũ)
+	0x80, 0x03, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+016A (Ū)
+	0x00, 0x00, 0x38, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+016B (ū)
+	0x91, 0x03, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+016C (Ŭ)
+	0x00, 0x10, 0x39, 0x40, 0x14, 0x45, 0x99, 0x05, 0x00,	// orp U+016D (ŭ)
+	0x84, 0x42, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+016E (Ů)
+	0x00, 0x40, 0x28, 0x44, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+016F (ů)
+	0x52, 0x02, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0170 (Ű)
+	0x00, 0x20, 0x25, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0171 (ű)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x45, 0x91, 0x43, 0x30,	// orp U+0172 (Ų)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x91, 0x43, 0x30,	// orp U+0173 (ų)
+	0x84, 0x02, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+0174 (Ŵ)
+	0x00, 0x40, 0x28, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+0175 (ŵ)
+	0x84, 0x02, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+0176 (Ŷ)
+	0x00, 0x40, 0x28, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+0177 (ŷ)
+	0x80, 0x02, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+0178 (Ÿ)
+	0x08, 0x01, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x07, 0x00,	// orp U+0179 (Ź)
+	0x00, 0x80, 0x10, 0xc0, 0x87, 0x10, 0xc2, 0x07, 0x00,	// orp U+017A (ź)
+	0x00, 0x01, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x07, 0x00,	// orp U+017B (Ż)
+	0x00, 0x00, 0x10, 0xc0, 0x87, 0x10, 0xc2, 0x07, 0x00,	// orp U+017C (ż)
+	0x0a, 0x01, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x07, 0x00,	// orp U+017D (Ž)
+	0x00, 0xa0, 0x10, 0xc0, 0x87, 0x10, 0xc2, 0x07, 0x00,	// orp U+017E (ž)
+	0x00, 0x00, 0x30, 0x82, 0x30, 0x08, 0x82, 0x00, 0x00,	// orp U+017F (ſ)
+	0x00, 0x00, 0x08, 0x8f, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+0180 (ƀ)
+	0x00, 0x00, 0x38, 0x15, 0xc5, 0x50, 0x14, 0x03, 0x00,	// orp U+0181 (Ɓ)
+	0x00, 0x00, 0x3c, 0x82, 0xe0, 0x48, 0xd2, 0x03, 0x00,	// orp U+0182 (Ƃ)
+	0x00, 0x00, 0x3c, 0xc1, 0x13, 0x45, 0xd1, 0x03, 0x00,	// orp U+0183 (ƃ)
+	0x00, 0x00, 0x08, 0xc3, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+0184 (Ƅ)
+	0x00, 0x00, 0x08, 0x83, 0x23, 0x49, 0x92, 0x03, 0x00,	// orp U+0185 (ƅ)
+	0x00, 0x00, 0x38, 0x11, 0x04, 0x41, 0x91, 0x03, 0x00,	// orp U+0186 (Ɔ)
+	0x00, 0x00, 0x3b, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+0187 (Ƈ)
+	0x00, 0x00, 0x00, 0x98, 0x91, 0x04, 0x89, 0x01, 0x00,	// orp U+0188 (ƈ)
+	0x00, 0x00, 0x38, 0x15, 0x45, 0x51, 0x14, 0x03, 0x00,	// orp U+018A (Ɗ)
+	0x00, 0x00, 0x78, 0x10, 0xe4, 0x45, 0x91, 0x07, 0x00,	// orp U+018B (Ƌ)
+	0x00, 0x00, 0x78, 0x90, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+018C (ƌ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x0e, 0x14, 0x39,	// orp U+018D (ƍ)
+	0x00, 0x00, 0x7c, 0x10, 0xe4, 0x41, 0xd0, 0x07, 0x00,	// orp U+018E (Ǝ)
+	0x00, 0x00, 0x38, 0x11, 0xf4, 0x45, 0x91, 0x03, 0x00,	// orp U+018F (Ə)
+	0x00, 0x00, 0x38, 0x51, 0xe0, 0x04, 0x91, 0x03, 0x00,	// orp U+0190 (Ɛ)
+	0x00, 0x00, 0x78, 0x82, 0xe0, 0x08, 0x82, 0x10, 0x00,	// orp U+0191 (Ƒ)
+	0x00, 0x00, 0x20, 0x14, 0xe1, 0x10, 0x44, 0x21, 0x00,	// orp U+0192 (ƒ)
+	0x00, 0x00, 0x3b, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00,	// orp U+0193 (Ɠ)
+	0x00, 0x00, 0x44, 0x91, 0xa2, 0x10, 0x0a, 0x01, 0x00,	// orp U+0194 (Ɣ)
+	0x00, 0x00, 0x04, 0xc1, 0x54, 0x55, 0x55, 0x02, 0x00,	// orp U+0195 (ƕ)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x10, 0x04, 0x02, 0x00,	// orp U+0196 (Ɩ)
+	0x00, 0x00, 0x38, 0x04, 0xe1, 0x10, 0x84, 0x03, 0x00,	// orp U+0197 (Ɨ)
+	0x00, 0x00, 0x64, 0xc5, 0x30, 0x14, 0x49, 0x04, 0x00,	// orp U+0198 (Ƙ)
+	0x00, 0x20, 0x14, 0x41, 0x94, 0x1c, 0x49, 0x04, 0x00,	// orp U+0199 (ƙ)
+	0x00, 0x00, 0x18, 0x04, 0xe1, 0x10, 0x84, 0x03, 0x00,	// orp U+019A (ƚ)
+	0x00, 0x00, 0x28, 0x84, 0x41, 0x28, 0x8a, 0x02, 0x00,	// orp U+019B (ƛ)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x95, 0x06, 0x00,	// orp U+019C (Ɯ)
+	0x00, 0x00, 0x48, 0x92, 0x64, 0x69, 0x92, 0x14, 0x00,	// orp U+019D (Ɲ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+019E (ƞ)
+	0x00, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x91, 0x03, 0x00,	// orp U+019F (Ɵ)
+	0x00, 0x00, 0x59, 0x49, 0x92, 0x24, 0x89, 0x01, 0x00,	// orp U+01A0 (Ơ)
+	0x00, 0x00, 0x40, 0x90, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+01A1 (ơ)
+	0x00, 0x00, 0x08, 0x4d, 0x55, 0x55, 0x95, 0x04, 0x00,	// orp U+01A2 (Ƣ)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x55, 0x95, 0x04, 0x00,	// orp U+01A3 (ƣ)
+	0x00, 0x00, 0x3c, 0x92, 0xe4, 0x08, 0x82, 0x00, 0x00,	// orp U+01A4 (Ƥ)
+	0x00, 0x00, 0x08, 0xc1, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+01A5 (ƥ)
+	0x00, 0x00, 0x04, 0x4f, 0x14, 0x3d, 0x45, 0x02, 0x01,	// orp U+01A6 (Ʀ)
+	0x00, 0x00, 0x38, 0x11, 0xe4, 0x04, 0x91, 0x03, 0x00,	// orp U+01A7 (Ƨ)
+	0x00, 0x00, 0x00, 0xc0, 0x03, 0x39, 0x81, 0x07, 0x00,	// orp U+01A8 (ƨ)
+	0x00, 0x00, 0x7c, 0x02, 0x81, 0x10, 0xc2, 0x07, 0x00,	// orp U+01A9 (Ʃ)
+	0x00, 0x00, 0x08, 0x85, 0x43, 0x10, 0x04, 0x85, 0x00,	// orp U+01AA (ƪ)
+	0x00, 0x00, 0x78, 0x45, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+01AC (Ƭ)
+	0x00, 0x80, 0x11, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x00,	// orp U+01AD (ƭ)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x81, 0x01,	// orp U+01AE (Ʈ)
+	0x00, 0x00, 0x65, 0x49, 0x92, 0x24, 0x89, 0x01, 0x00,	// orp U+01AF (Ư)
+	0x00, 0x00, 0x00, 0x50, 0x96, 0x24, 0x8d, 0x02, 0x00,	// orp U+01B0 (ư)
+	0x00, 0x00, 0x28, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01B1 (Ʊ)
+	0x00, 0x00, 0x24, 0x49, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01B2 (Ʋ)
+	0x00, 0x00, 0x44, 0x92, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+01B3 (Ƴ)
+	0x00, 0x00, 0x00, 0x48, 0x55, 0x14, 0x85, 0x21, 0x04,	// orp U+01B4 (ƴ)
+	0x00, 0x00, 0x7c, 0x10, 0xf2, 0x09, 0xc1, 0x07, 0x00,	// orp U+01B5 (Ƶ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x7c, 0xc2, 0x07, 0x00,	// orp U+01B6 (ƶ)
+	0x00, 0x00, 0x7c, 0x08, 0xe1, 0x40, 0x91, 0x03, 0x00,	// orp U+01B7 (Ʒ)
+	0x00, 0x00, 0x7c, 0x02, 0xe1, 0x04, 0x91, 0x03, 0x00,	// orp U+01B8 (Ƹ)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x10, 0x4e, 0x10, 0x39,	// orp U+01B9 (ƹ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x30, 0x90, 0x13, 0x39,	// orp U+01BA (ƺ)
+	0x00, 0x00, 0x38, 0x11, 0xe2, 0x11, 0xc2, 0x07, 0x00,	// orp U+01BB (ƻ)
+	0x00, 0x00, 0x7c, 0xd1, 0x81, 0x40, 0xd0, 0x03, 0x00,	// orp U+01BC (Ƽ)
+	0x00, 0x00, 0x00, 0x80, 0x27, 0x38, 0x90, 0x03, 0x00,	// orp U+01BD (ƽ)
+	0x00, 0x00, 0x10, 0x0e, 0xc1, 0x40, 0x91, 0x03, 0x00,	// orp U+01BE (ƾ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x25, 0xc5, 0x10, 0x04,	// orp U+01BF (ƿ)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+01C0 (ǀ)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+01C1 (ǁ)
+	0x00, 0x00, 0x10, 0x84, 0x43, 0x38, 0x04, 0x01, 0x00,	// orp U+01C2 (ǂ)
+	0x00, 0x00, 0x38, 0x8e, 0x43, 0x10, 0x00, 0x01, 0x00,	// orp U+01C3 (ǃ)
+	0x14, 0x02, 0x6c, 0x55, 0xd5, 0x34, 0xcd, 0x06, 0x00,	// orp U+01C4 (Ǆ)
+	0x00, 0x85, 0x0c, 0x45, 0x57, 0x35, 0xcd, 0x06, 0x00,	// orp U+01C5 (ǅ)
+	0x14, 0x02, 0x10, 0x84, 0x57, 0x35, 0x8d, 0x07, 0x00,	// orp U+01C6 (ǆ)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x45, 0xd5, 0x02, 0x00,	// orp U+01C7 (Ǉ)
+	0x00, 0x00, 0x44, 0x41, 0x16, 0x45, 0xd1, 0x05, 0x31,	// orp U+01C8 (ǈ)
+	0x00, 0x00, 0x4c, 0x82, 0x26, 0x49, 0xd2, 0x05, 0x31,	// orp U+01C9 (ǉ)
+	0x00, 0x00, 0x4c, 0x55, 0x55, 0x55, 0x55, 0x03, 0x00,	// orp U+01CA (Ǌ)
+	0x00, 0x00, 0x4c, 0x45, 0x57, 0x55, 0x55, 0x05, 0x31,	// orp U+01CB (ǋ)
+	0x00, 0x00, 0x40, 0xc0, 0x56, 0x55, 0x55, 0x05, 0x31,	// orp U+01CC (ǌ)
+	0x0a, 0x01, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+01CD (Ǎ)
+	0x00, 0xa0, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+01CE (ǎ)
+	0x0a, 0x01, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+01CF (Ǐ)
+	0x00, 0xa0, 0x10, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+01D0 (ǐ)
+	0x0a, 0x01, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D1 (Ǒ)
+	0x00, 0xa0, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+01D2 (ǒ)
+	0x0a, 0x01, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D3 (Ǔ)
+	0x00, 0xa0, 0x10, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D4 (ǔ)
+	0x0e, 0xa0, 0x00, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D5 (Ǖ)
+	0x80, 0x03, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D6 (ǖ)
+	0x08, 0xa1, 0x00, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D7 (Ǘ)
+	0x08, 0x01, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D8 (ǘ)
+	0x0a, 0xa1, 0x00, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01D9 (Ǚ)
+	0x0a, 0x01, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01DA (ǚ)
+	0x02, 0xa1, 0x00, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01DB (Ǜ)
+	0x02, 0x01, 0x28, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+01DC (ǜ)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x79, 0x91, 0x03, 0x00,	// orp U+01DD (ǝ)
+	0x0e, 0xa0, 0x00, 0x4e, 0x14, 0x7d, 0x51, 0x04, 0x00,	// orp U+01DE (Ǟ)
+	0x80, 0x03, 0x28, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+01DF (ǟ)
+	0x0e, 0x40, 0x00, 0x4e, 0x14, 0x7d, 0x51, 0x04, 0x00,	// orp U+01E0 (Ǡ)
+	0x80, 0x03, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+01E1 (ǡ)
+	0x80, 0x07, 0x78, 0x45, 0xf1, 0x14, 0x45, 0x07, 0x00,	// orp U+01E2 (Ǣ)
+	0x00, 0x00, 0x38, 0x80, 0x43, 0x39, 0x85, 0x07, 0x00,	// orp U+01E3 (ǣ)
+	0x00, 0x00, 0x38, 0x51, 0x90, 0x65, 0x91, 0x03, 0x00,	// orp U+01E4 (Ǥ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0xf7, 0x39,	// orp U+01E5 (ǥ)
+	0x0a, 0x01, 0x38, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00,	// orp U+01E6 (Ǧ)
+	0x00, 0xa0, 0x10, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+01E7 (ǧ)
+	0x0a, 0x01, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x00,	// orp U+01E8 (Ǩ)
+	0x80, 0x42, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x04, 0x00,	// orp U+01E9 (ǩ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x23, 0x30,	// orp U+01EA (Ǫ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0x23, 0x30,	// orp U+01EB (ǫ)
+	0x80, 0x03, 0x38, 0x51, 0x14, 0x45, 0x91, 0x23, 0x30,	// orp U+01EC (Ǭ)
+	0x00, 0x00, 0x38, 0x80, 0x13, 0x45, 0x91, 0x23, 0x30,	// orp U+01ED (ǭ)
+	0x0a, 0x01, 0x7c, 0x08, 0xe1, 0x40, 0x91, 0x03, 0x00,	// orp U+01EE (Ǯ)
+	0x00, 0xa0, 0x10, 0xc0, 0x87, 0x10, 0x0e, 0x14, 0x39,	// orp U+01EF (ǯ)
+	0x00, 0x40, 0x21, 0x00, 0x83, 0x20, 0x08, 0x92, 0x18,	// orp U+01F0 (ǰ)
+	0x00, 0x00, 0x6c, 0x55, 0xd5, 0x34, 0xcd, 0x06, 0x00,	// orp U+01F1 (Ǳ)
+	0x00, 0x00, 0x0c, 0x45, 0x57, 0x35, 0xcd, 0x06, 0x00,	// orp U+01F2 (ǲ)
+	0x00, 0x00, 0x10, 0x84, 0x57, 0x35, 0x8d, 0x07, 0x00,	// orp U+01F3 (ǳ)
+	0x08, 0x01, 0x38, 0x51, 0x10, 0x64, 0x91, 0x03, 0x00,	// orp U+01F4 (Ǵ)
+	0x00, 0x80, 0x10, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+01F5 (ǵ)
+	0x00, 0x00, 0x14, 0xc5, 0x55, 0x55, 0x55, 0x02, 0x00,	// orp U+01F6 (Ƕ)
+	0x00, 0x00, 0x34, 0x53, 0x94, 0x14, 0x43, 0x00, 0x00,	// orp U+01F7 (Ƿ)
+	0x02, 0x01, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00,	// orp U+01F8 (Ǹ)
+	0x00, 0x20, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+01F9 (ǹ)
+	0x08, 0x41, 0x28, 0x84, 0x13, 0x7d, 0x51, 0x04, 0x00,	// orp U+01FA (Ǻ)
+	0x08, 0x41, 0x28, 0x84, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+01FB (ǻ)
+	0x08, 0x01, 0x78, 0x45, 0xf1, 0x14, 0x45, 0x07, 0x00,	// orp U+01FC (Ǽ)
+	0x00, 0x80, 0x10, 0x80, 0x43, 0x39, 0x85, 0x07, 0x00,	// orp U+01FD (ǽ)
+	0x08, 0x01, 0x39, 0x59, 0x55, 0x55, 0x93, 0x13, 0x00,	// orp U+01FE (Ǿ)
+	0x00, 0x80, 0x10, 0x80, 0x97, 0x55, 0xd3, 0x03, 0x00,	// orp U+01FF (ǿ)
+	0x89, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0200 (Ȁ)
+	0x00, 0x90, 0x48, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0201 (ȁ)
+	0x4e, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0202 (Ȃ)
+	0x00, 0xe0, 0x44, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0203 (ȃ)
+	0x89, 0x04, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0204 (Ȅ)
+	0x00, 0x90, 0x48, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0205 (ȅ)
+	0x00, 0xe0, 0x44, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0207 (ȇ)
+	0x89, 0x04, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0208 (Ȉ)
+	0x00, 0x90, 0x48, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0209 (ȉ)
+	0x4e, 0x04, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+020A (Ȋ)
+	0x00, 0xe0, 0x44, 0x80, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+020B (ȋ)
+	0x89, 0x04, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+020C (Ȍ)
+	0x00, 0x90, 0x48, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+020D (ȍ)
+	0x4e, 0x04, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+020E (Ȏ)
+	0x00, 0xe0, 0x44, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+020F (ȏ)
+	0x89, 0x04, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x04, 0x00,	// orp U+0210 (Ȑ)
+	0x00, 0x90, 0x48, 0x40, 0x33, 0x05, 0x41, 0x00, 0x00,	// orp U+0211 (ȑ)
+	0x4e, 0x04, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x04, 0x00,	// orp U+0212 (Ȓ)
+	0x00, 0xe0, 0x44, 0x40, 0x33, 0x05, 0x41, 0x00, 0x00,	// orp U+0213 (ȓ)
+	0x89, 0x04, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0214 (Ȕ)
+	0x00, 0x90, 0x48, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0215 (ȕ)
+	0x4e, 0x04, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0216 (Ȗ)
+	0x00, 0xe0, 0x44, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0217 (ȗ)
+	0x00, 0x00, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x83, 0x10,	// orp U+0218 (Ș)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x83, 0x10,	// orp U+0219 (ș)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x81, 0x10,	// orp U+021A (Ț)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x86, 0x10,	// orp U+021B (ț)
+	0x00, 0x00, 0x38, 0x11, 0x42, 0x41, 0xd0, 0x03, 0x00,	// orp U+021C (Ȝ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x21, 0x14, 0x04, 0x3d,	// orp U+021D (ȝ)
+	0x0a, 0x01, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+021E (Ȟ)
+	0x80, 0x42, 0x04, 0xc1, 0x13, 0x45, 0x51, 0x04, 0x00,	// orp U+021F (ȟ)
+	0x00, 0x00, 0x34, 0x53, 0x14, 0x45, 0x51, 0x04, 0x01,	// orp U+0220 (Ƞ)
+	0x00, 0x00, 0x20, 0x88, 0x93, 0x64, 0xa9, 0x47, 0x00,	// orp U+0221 (ȡ)
+	0x00, 0x00, 0x28, 0x51, 0xe4, 0x44, 0x91, 0x03, 0x00,	// orp U+0222 (Ȣ)
+	0x00, 0x00, 0x00, 0x4a, 0xe4, 0x44, 0x91, 0x03, 0x00,	// orp U+0223 (ȣ)
+	0x00, 0x00, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x07, 0x31,	// orp U+0224 (Ȥ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xc2, 0x07, 0x31,	// orp U+0225 (ȥ)
+	0x00, 0x01, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0226 (Ȧ)
+	0x00, 0x00, 0x10, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0227 (ȧ)
+	0x00, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x31,	// orp U+0228 (Ȩ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x31,	// orp U+0229 (ȩ)
+	0x0e, 0xa0, 0x00, 0x4e, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+022A (Ȫ)
+	0x80, 0x03, 0x28, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+022B (ȫ)
+	0x8e, 0xd5, 0x00, 0x4e, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+022C (Ȭ)
+	0x0e, 0x60, 0x35, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+022D (ȭ)
+	0x00, 0x01, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+022E (Ȯ)
+	0x00, 0x00, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+022F (ȯ)
+	0x0e, 0x40, 0x00, 0x4e, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0230 (Ȱ)
+	0x80, 0x03, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+0231 (ȱ)
+	0x80, 0x03, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+0232 (Ȳ)
+	0x00, 0x00, 0x38, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+0233 (ȳ)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x30, 0x14, 0x23, 0x00,	// orp U+0234 (ȴ)
+	0x00, 0x00, 0x00, 0xc0, 0x91, 0x64, 0x69, 0x46, 0x00,	// orp U+0235 (ȵ)
+	0x00, 0x00, 0x10, 0x84, 0x47, 0x30, 0x94, 0x02, 0x00,	// orp U+0236 (ȶ)
+	0x00, 0x00, 0x20, 0x08, 0x82, 0x20, 0x08, 0x92, 0x18,	// orp U+0237 (ȷ)
+	0x00, 0x00, 0x10, 0x04, 0xe1, 0x54, 0x95, 0x03, 0x00,	// orp U+0238 (ȸ)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x55, 0x0e, 0x41, 0x10,	// orp U+0239 (ȹ)
+	0x00, 0x00, 0xb8, 0x51, 0xf6, 0x55, 0x53, 0x04, 0x00,	// orp U+023A (Ⱥ)
+	0x00, 0x00, 0xf0, 0x52, 0x92, 0x14, 0x42, 0x07, 0x00,	// orp U+023B (Ȼ)
+	0x00, 0x00, 0x00, 0x80, 0x97, 0x15, 0xd3, 0x03, 0x00,	// orp U+023C (ȼ)
+	0x00, 0x00, 0x08, 0x82, 0x70, 0x08, 0x82, 0x07, 0x00,	// orp U+023D (Ƚ)
+	0x00, 0x00, 0xfc, 0x14, 0x43, 0x10, 0x46, 0x01, 0x00,	// orp U+023E (Ⱦ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x43, 0x20,	// orp U+023F (ȿ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0x42, 0x20, 0x70,	// orp U+0240 (ɀ)
+	0x00, 0x00, 0x38, 0x11, 0xc4, 0x10, 0x04, 0x01, 0x00,	// orp U+0241 (Ɂ)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x41, 0x0c, 0x01, 0x00,	// orp U+0242 (ɂ)
+	0x00, 0x00, 0x38, 0x92, 0x23, 0x5d, 0x92, 0x03, 0x00,	// orp U+0243 (Ƀ)
+	0x00, 0x00, 0x48, 0x92, 0xf4, 0x4b, 0x12, 0x03, 0x00,	// orp U+0244 (Ʉ)
+	0x00, 0x00, 0x10, 0x8a, 0xa2, 0x44, 0x51, 0x04, 0x00,	// orp U+0245 (Ʌ)
+	0x00, 0x00, 0xfc, 0x51, 0xf2, 0x14, 0xc3, 0x07, 0x00,	// orp U+0246 (Ɇ)
+	0x00, 0x00, 0x00, 0x88, 0x53, 0x3d, 0xc3, 0x03, 0x00,	// orp U+0247 (ɇ)
+	0x00, 0x00, 0x20, 0x08, 0x82, 0x20, 0x1c, 0x92, 0x18,	// orp U+0248 (Ɉ)
+	0x00, 0x00, 0x20, 0x00, 0x82, 0x20, 0x1c, 0x92, 0x18,	// orp U+0249 (ɉ)
+	0x00, 0x00, 0x58, 0x59, 0x14, 0x65, 0x16, 0x04, 0x81,	// orp U+024A (Ɋ)
+	0x00, 0x00, 0x00, 0x80, 0x95, 0x45, 0x99, 0x05, 0x81,	// orp U+024B (ɋ)
+	0x00, 0x00, 0x38, 0x92, 0xf4, 0x48, 0x92, 0x04, 0x00,	// orp U+024C (Ɍ)
+	0x00, 0x00, 0x00, 0x80, 0x62, 0x08, 0x87, 0x00, 0x00,	// orp U+024D (ɍ)
+	0x00, 0x00, 0x44, 0x9f, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+024E (Ɏ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x7d, 0x0a, 0x21, 0x04,	// orp U+024F (ɏ)
+	0x00, 0x00, 0x00, 0xc0, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0250 (ɐ)
+	0x00, 0x00, 0x00, 0x80, 0x95, 0x45, 0x99, 0x05, 0x00,	// orp U+0251 (ɑ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x53, 0x03, 0x00,	// orp U+0252 (ɒ)
+	0x00, 0x60, 0x24, 0xc1, 0x13, 0x45, 0xd1, 0x03, 0x00,	// orp U+0253 (ɓ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x41, 0x91, 0x03, 0x00,	// orp U+0254 (ɔ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x24, 0x95, 0x43, 0x00,	// orp U+0255 (ɕ)
+	0x00, 0x00, 0x20, 0x88, 0x93, 0x24, 0x89, 0x03, 0x01,	// orp U+0256 (ɖ)
+	0x00, 0x00, 0x21, 0x88, 0x93, 0x24, 0x89, 0x03, 0x00,	// orp U+0257 (ɗ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x79, 0x90, 0x03, 0x00,	// orp U+0258 (ɘ)
+	0x00, 0x00, 0x00, 0x80, 0x81, 0xb9, 0x89, 0x01, 0x00,	// orp U+025A (ɚ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+025B (ɛ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x31, 0x91, 0x03, 0x00,	// orp U+025C (ɜ)
+	0x00, 0x00, 0x00, 0x80, 0x95, 0x12, 0x89, 0x01, 0x00,	// orp U+025D (ɝ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x35, 0x91, 0x03, 0x00,	// orp U+025E (ɞ)
+	0x00, 0x00, 0x00, 0x00, 0x82, 0x20, 0x1c, 0x92, 0x18,	// orp U+025F (ɟ)
+	0x00, 0x00, 0x40, 0x90, 0x93, 0x24, 0x89, 0x83, 0x18,	// orp U+0260 (ɠ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0x07, 0x39,	// orp U+0261 (ɡ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x64, 0x91, 0x03, 0x00,	// orp U+0262 (ɢ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x0a, 0xa1, 0x10,	// orp U+0263 (ɣ)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x11, 0x0a, 0x01, 0x00,	// orp U+0264 (ɤ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x91, 0x07, 0x41,	// orp U+0265 (ɥ)
+	0x00, 0xe0, 0x44, 0xc1, 0x13, 0x45, 0x51, 0x04, 0x00,	// orp U+0266 (ɦ)
+	0x00, 0xe0, 0x44, 0xc1, 0x13, 0x45, 0x51, 0x04, 0x31,	// orp U+0267 (ɧ)
+	0x00, 0x00, 0x10, 0x80, 0x41, 0x38, 0x84, 0x03, 0x00,	// orp U+0268 (ɨ)
+	0x00, 0x00, 0x00, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+0269 (ɩ)
+	0x00, 0x00, 0x00, 0x80, 0x43, 0x10, 0x84, 0x03, 0x00,	// orp U+026A (ɪ)
+	0x00, 0x00, 0x18, 0x84, 0xd5, 0x10, 0x84, 0x03, 0x00,	// orp U+026B (ɫ)
+	0x00, 0x00, 0x18, 0x84, 0x51, 0x38, 0x84, 0x03, 0x00,	// orp U+026C (ɬ)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x10, 0x04, 0x41, 0x21,	// orp U+026D (ɭ)
+	0x00, 0x00, 0x0c, 0x82, 0x27, 0x29, 0xce, 0x25, 0x31,	// orp U+026E (ɮ)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x95, 0x06, 0x00,	// orp U+026F (ɯ)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x95, 0x06, 0x41,	// orp U+0270 (ɰ)
+	0x00, 0x00, 0x00, 0xc0, 0x52, 0x55, 0x55, 0x05, 0x31,	// orp U+0271 (ɱ)
+	0x00, 0x00, 0x00, 0x80, 0x23, 0x49, 0x92, 0x24, 0x04,	// orp U+0272 (ɲ)
+	0x00, 0x00, 0x00, 0xc0, 0x91, 0x24, 0x49, 0x82, 0x40,	// orp U+0273 (ɳ)
+	0x00, 0x00, 0x00, 0x40, 0x34, 0x55, 0x59, 0x04, 0x00,	// orp U+0274 (ɴ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x7d, 0x91, 0x03, 0x00,	// orp U+0275 (ɵ)
+	0x00, 0x00, 0x00, 0x80, 0x57, 0x34, 0x85, 0x07, 0x00,	// orp U+0276 (ɶ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x55, 0x95, 0x02, 0x00,	// orp U+0277 (ɷ)
+	0x00, 0x00, 0x10, 0x84, 0x53, 0x55, 0x95, 0x43, 0x10,	// orp U+0278 (ɸ)
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x41, 0x99, 0x05, 0x00,	// orp U+0279 (ɹ)
+	0x00, 0x00, 0x40, 0x10, 0x04, 0x41, 0x99, 0x05, 0x00,	// orp U+027A (ɺ)
+	0x00, 0x00, 0x00, 0x00, 0x82, 0x20, 0x89, 0x83, 0x40,	// orp U+027B (ɻ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x05, 0x41, 0x10, 0x04,	// orp U+027C (ɼ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x05, 0x41, 0x50, 0x08,	// orp U+027D (ɽ)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x41, 0x00, 0x00,	// orp U+027E (ɾ)
+	0x00, 0x00, 0x00, 0x80, 0x91, 0x40, 0x10, 0x04, 0x00,	// orp U+027F (ɿ)
+	0x00, 0x00, 0x00, 0xc0, 0x13, 0x3d, 0x51, 0x04, 0x00,	// orp U+0280 (ʀ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x3d, 0xd1, 0x03, 0x00,	// orp U+0281 (ʁ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x13, 0x18,	// orp U+0282 (ʂ)
+	0x00, 0x00, 0x20, 0x14, 0x41, 0x10, 0x44, 0x21, 0x00,	// orp U+0283 (ʃ)
+	0x00, 0x00, 0x20, 0x14, 0x41, 0x38, 0x44, 0x21, 0x00,	// orp U+0284 (ʄ)
+	0x00, 0x00, 0x00, 0x42, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+0285 (ʅ)
+	0x00, 0x00, 0x20, 0x14, 0x41, 0x10, 0x4e, 0x21, 0x00,	// orp U+0286 (ʆ)
+	0x00, 0x00, 0x00, 0xc0, 0x40, 0x10, 0xc4, 0x47, 0x10,	// orp U+0287 (ʇ)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x41, 0x60,	// orp U+0288 (ʈ)
+	0x00, 0x00, 0x00, 0x40, 0xf4, 0x45, 0x99, 0x05, 0x00,	// orp U+0289 (ʉ)
+	0x00, 0x00, 0x00, 0xc0, 0xa6, 0x44, 0x91, 0x03, 0x00,	// orp U+028A (ʊ)
+	0x00, 0x00, 0x00, 0x40, 0x12, 0x45, 0x89, 0x01, 0x00,	// orp U+028B (ʋ)
+	0x00, 0x00, 0x00, 0x00, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+028C (ʌ)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x55, 0x51, 0x04, 0x00,	// orp U+028D (ʍ)
+	0x00, 0x00, 0x40, 0x08, 0xa1, 0x44, 0x51, 0x04, 0x00,	// orp U+028E (ʎ)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x04, 0x01, 0x00,	// orp U+028F (ʏ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xc2, 0x47, 0x60,	// orp U+0290 (ʐ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xca, 0x47, 0x08,	// orp U+0291 (ʑ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0x0e, 0x14, 0x39,	// orp U+0292 (ʒ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x30, 0x90, 0x17, 0xb9,	// orp U+0293 (ʓ)
+	0x00, 0x00, 0x38, 0x51, 0x60, 0x10, 0x04, 0x01, 0x00,	// orp U+0295 (ʕ)
+	0x00, 0x00, 0x10, 0x04, 0xc1, 0x40, 0x91, 0x03, 0x00,	// orp U+0296 (ʖ)
+	0x00, 0x00, 0x38, 0x51, 0x10, 0x04, 0x41, 0x10, 0x39,	// orp U+0297 (ʗ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x55, 0x91, 0x03, 0x00,	// orp U+0298 (ʘ)
+	0x00, 0x00, 0x00, 0xc0, 0x13, 0x3d, 0xd1, 0x03, 0x00,	// orp U+0299 (ʙ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x59, 0x91, 0x03, 0x00,	// orp U+029A (ʚ)
+	0x00, 0x00, 0x40, 0x88, 0x17, 0x64, 0x91, 0x03, 0x00,	// orp U+029B (ʛ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x7d, 0x51, 0x04, 0x00,	// orp U+029C (ʜ)
+	0x00, 0x00, 0x20, 0x00, 0x83, 0x20, 0x88, 0x97, 0x18,	// orp U+029D (ʝ)
+	0x00, 0x00, 0x00, 0x40, 0x24, 0x71, 0x52, 0x04, 0x41,	// orp U+029E (ʞ)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0x04, 0xc1, 0x07, 0x00,	// orp U+029F (ʟ)
+	0x00, 0x00, 0x40, 0x88, 0x93, 0x24, 0x89, 0x83, 0x20,	// orp U+02A0 (ʠ)
+	0x00, 0x00, 0x38, 0x11, 0xc4, 0x10, 0x0e, 0x01, 0x00,	// orp U+02A1 (ʡ)
+	0x00, 0x00, 0x38, 0x51, 0x60, 0x10, 0x0e, 0x01, 0x00,	// orp U+02A2 (ʢ)
+	0x00, 0x00, 0x10, 0x84, 0x57, 0x35, 0x9d, 0x05, 0x31,	// orp U+02A4 (ʤ)
+	0x00, 0x00, 0x10, 0x84, 0x57, 0x35, 0x8d, 0x87, 0x00,	// orp U+02A5 (ʥ)
+	0x00, 0x00, 0x08, 0xc2, 0xa7, 0x48, 0x12, 0x03, 0x00,	// orp U+02A6 (ʦ)
+	0x00, 0x00, 0xa9, 0xca, 0xa3, 0x28, 0x0a, 0xa3, 0x10,	// orp U+02A7 (ʧ)
+	0x00, 0x00, 0x08, 0xc2, 0xa5, 0x28, 0x0a, 0x85, 0x00,	// orp U+02A8 (ʨ)
+	0x00, 0x00, 0x18, 0x49, 0xf0, 0x54, 0x55, 0x05, 0x31,	// orp U+02A9 (ʩ)
+	0x00, 0x00, 0x0c, 0x82, 0x66, 0x28, 0xd2, 0x03, 0x00,	// orp U+02AA (ʪ)
+	0x00, 0x00, 0x0c, 0x82, 0x27, 0x29, 0xc6, 0x07, 0x00,	// orp U+02AB (ʫ)
+	0x00, 0x00, 0x54, 0x95, 0x02, 0x54, 0x95, 0x02, 0x00,	// orp U+02AC (ʬ)
+	0x00, 0x00, 0x00, 0x5f, 0x04, 0x7c, 0x11, 0x00, 0x00,	// orp U+02AD (ʭ)
+	0x00, 0x10, 0x49, 0x92, 0x24, 0x49, 0x12, 0x07, 0x41,	// orp U+02AE (ʮ)
+	0x00, 0x10, 0x49, 0x92, 0x24, 0x49, 0x12, 0x07, 0x81,	// orp U+02AF (ʯ)
+	0x80, 0x20, 0x18, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02B0 (ʰ)
+	0x00, 0x21, 0x18, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02B1 (ʱ)
+	0x00, 0x02, 0x20, 0x88, 0x42, 0x00, 0x00, 0x00, 0x00,	// orp U+02B2 (ʲ)
+	0x00, 0x60, 0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02B3 (ʳ)
+	0x00, 0x80, 0x20, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+02B4 (ʴ)
+	0x00, 0x80, 0x20, 0x0a, 0x03, 0x01, 0x00, 0x00, 0x00,	// orp U+02B5 (ʵ)
+	0x80, 0xa2, 0x18, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02B6 (ʶ)
+	0x00, 0x50, 0x55, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02B7 (ʷ)
+	0x00, 0xa0, 0x28, 0x0c, 0x62, 0x00, 0x00, 0x00, 0x00,	// orp U+02B8 (ʸ)
+	0x00, 0x82, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02B9 (ʹ)
+	0x80, 0x24, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02BA (ʺ)
+	0x00, 0x80, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02BB (ʻ)
+	0x00, 0xc0, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02BC (ʼ)
+	0x00, 0xc0, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02BD (ʽ)
+	0x00, 0x40, 0x20, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02BE (ʾ)
+	0x00, 0x40, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02BF (ʿ)
+	0x00, 0xa1, 0x20, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02C0 (ˀ)
+	0x00, 0xa1, 0x08, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02C1 (ˁ)
+	0x00, 0x42, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02C2 (˂)
+	0x80, 0x40, 0x20, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C3 (˃)
+	0x00, 0x40, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C4 (˄)
+	0x00, 0xa0, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C5 (˅)
+	0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C6 (ˆ)
+	0x80, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C7 (ˇ)
+	0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C8 (ˈ)
+	0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02C9 (ˉ)
+	0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02CA (ˊ)
+	0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02CB (ˋ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00,	// orp U+02CC (ˌ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00,	// orp U+02CD (ˍ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,	// orp U+02CE (ˎ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00,	// orp U+02CF (ˏ)
+	0x00, 0x00, 0x00, 0x80, 0x43, 0x00, 0x84, 0x03, 0x00,	// orp U+02D0 (ː)
+	0x00, 0x00, 0x00, 0x80, 0x43, 0x00, 0x00, 0x00, 0x00,	// orp U+02D1 (ˑ)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x10, 0x03, 0x00,	// orp U+02D2 (˒)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x08, 0x02, 0x03, 0x00,	// orp U+02D3 (˓)
+	0x00, 0x00, 0x00, 0x04, 0xf1, 0x01, 0x00, 0x00, 0x00,	// orp U+02D4 (˔)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x11, 0x04, 0x00, 0x00,	// orp U+02D5 (˕)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x7d, 0x11, 0x00, 0x00,	// orp U+02D7 (˗)
+	0x40, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02D8 (˘)
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02D9 (˙)
+	0x00, 0xa1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02DA (˚)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30,	// orp U+02DB (˛)
+	0x00, 0x60, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02DC (˜)
+	0x80, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02DD (˝)
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x55, 0x08, 0x00, 0x00,	// orp U+02DE (˞)
+	0x80, 0x42, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02DF (˟)
+	0x00, 0xa0, 0x28, 0x84, 0x42, 0x00, 0x00, 0x00, 0x00,	// orp U+02E0 (ˠ)
+	0x80, 0x41, 0x10, 0x84, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+02E1 (ˡ)
+	0x00, 0xc0, 0x18, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02E2 (ˢ)
+	0x00, 0xa0, 0x10, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+02E3 (ˣ)
+	0x00, 0x23, 0x18, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+02E4 (ˤ)
+	0x00, 0x00, 0x38, 0x08, 0x82, 0x20, 0x08, 0x02, 0x00,	// orp U+02E5 (˥)
+	0x00, 0x00, 0x20, 0x0e, 0x82, 0x20, 0x08, 0x02, 0x00,	// orp U+02E6 (˦)
+	0x00, 0x00, 0x20, 0x08, 0xe2, 0x20, 0x08, 0x02, 0x00,	// orp U+02E7 (˧)
+	0x00, 0x00, 0x20, 0x08, 0x82, 0x20, 0x0e, 0x02, 0x00,	// orp U+02E8 (˨)
+	0x00, 0x00, 0x20, 0x08, 0x82, 0x20, 0x88, 0x03, 0x00,	// orp U+02E9 (˩)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x20,	// orp U+02EA (˪)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0x23, 0x08,	// orp U+02EB (˫)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x10,	// orp U+02EC (ˬ)
+	0x00, 0x00, 0x00, 0x0e, 0xe0, 0x00, 0x00, 0x00, 0x00,	// orp U+02ED (˭)
+	0x00, 0x00, 0x6c, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02EE (ˮ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa2, 0x10,	// orp U+02EF (˯)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xa2, 0x44,	// orp U+02F0 (˰)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x46, 0x60, 0x20,	// orp U+02F1 (˱)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x62, 0x04,	// orp U+02F2 (˲)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x48,	// orp U+02F3 (˳)
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00,	// orp U+02F4 (˴)
+	0x00, 0x00, 0x00, 0x80, 0x42, 0x01, 0x00, 0x00, 0x00,	// orp U+02F5 (˵)
+	0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00,	// orp U+02F6 (˶)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x35,	// orp U+02F7 (˷)
+	0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x0c, 0x03, 0x00,	// orp U+02F8 (˸)
+	0x00, 0x00, 0x00, 0x0c, 0x41, 0x00, 0x00, 0x00, 0x00,	// orp U+02F9 (˹)
+	0x00, 0x00, 0x30, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+02FA (˺)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0x03, 0x00,	// orp U+02FB (˻)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0x00,	// orp U+02FC (˼)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x07, 0x00,	// orp U+02FD (˽)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x03, 0x00,	// orp U+02FE (˾)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x27, 0x00,	// orp U+02FF (˿)
+	0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0300 (̀)
+	0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0301 (́)
+	0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0302 (̂)
+	0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0303 (̃)
+	0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0304 (̄)
+	0xc0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0305 (̅)
+	0x91, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0306 (̆)
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0307 (̇)
+	0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0308 (̈)
+	0x06, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0309 (̉)
+	0x84, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030A (̊)
+	0x52, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030B (̋)
+	0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030C (̌)
+	0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030D (̍)
+	0x8a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030E (̎)
+	0x89, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+030F (̏)
+	0x44, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0310 (̐)
+	0x4e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0311 (̑)
+	0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0312 (̒)
+	0x0c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0313 (̓)
+	0x06, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0314 (̔)
+	0x30, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0315 (̕)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20,	// orp U+0316 (̖)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10,	// orp U+0317 (̗)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x20,	// orp U+0318 (̘)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x10,	// orp U+0319 (̙)
+	0x38, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+031A (̚)
+	0x20, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+031B (̛)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x20,	// orp U+031C (̜)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x38,	// orp U+031D (̝)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x10,	// orp U+031E (̞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x10,	// orp U+031F (̟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,	// orp U+0320 (̠)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x21,	// orp U+0321 (̡)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x81,	// orp U+0322 (̢)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,	// orp U+0323 (̣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,	// orp U+0324 (̤)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x10,	// orp U+0325 (̥)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10,	// orp U+0329 (̩)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x49,	// orp U+032A (̪)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x29,	// orp U+032B (̫)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x31,	// orp U+032C (̬)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39,	// orp U+032E (̮)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x44,	// orp U+032F (̯)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x29,	// orp U+0330 (̰)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,	// orp U+0331 (̱)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,	// orp U+0332 (̲)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc,	// orp U+0333 (̳)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x29, 0x00, 0x00, 0x00,	// orp U+0334 (̴)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00,	// orp U+0336 (̶)
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x00,	// orp U+0337 (̷)
+	0x00, 0x04, 0x21, 0x08, 0x21, 0x08, 0x41, 0x00, 0x00,	// orp U+0338 (̸)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x10,	// orp U+0339 (̹)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x79,	// orp U+033A (̺)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa3, 0x38,	// orp U+033B (̻)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x54,	// orp U+033C (̼)
+	0x0a, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+033D (̽)
+	0x08, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+033E (̾)
+	0x3f, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+033F (̿)
+	0x0c, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0343 (̓)
+	0x08, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0344 (̈́)
+	0x8e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0346 (͆)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x07, 0x7c,	// orp U+0347 (͇)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x28,	// orp U+0348 (͈)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x20,	// orp U+0349 (͉)
+	0x00, 0x61, 0x35, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+034A (͊)
+	0x08, 0x60, 0x35, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+034B (͋)
+	0x56, 0x63, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+034C (͌)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf2, 0x29,	// orp U+034D (͍)
+	0x07, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0350 (͐)
+	0x84, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0351 (͑)
+	0x4e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0352 (͒)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x28,	// orp U+0353 (͓)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70,	// orp U+0354 (͔)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc1, 0x1d,	// orp U+0355 (͕)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xc4, 0xae,	// orp U+0356 (͖)
+	0x04, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0357 (͗)
+	0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0358 (͘)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x43, 0x38,	// orp U+0359 (͙)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x52, 0x29,	// orp U+035A (͚)
+	0x82, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+035B (͛)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x72,	// orp U+035C (͜)
+	0x9c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+035D (͝)
+	0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+035E (͞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,	// orp U+035F (͟)
+	0x8c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0360 (͠)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x43,	// orp U+0362 (͢)
+	0x84, 0xa2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0363 (ͣ)
+	0x84, 0x23, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0364 (ͤ)
+	0x04, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0365 (ͥ)
+	0x8c, 0x24, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0366 (ͦ)
+	0x8a, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0367 (ͧ)
+	0x8c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0368 (ͨ)
+	0x08, 0xa3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0369 (ͩ)
+	0x82, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+036A (ͪ)
+	0x4b, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+036B (ͫ)
+	0x8a, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+036C (ͬ)
+	0x84, 0x43, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+036D (ͭ)
+	0x8a, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+036E (ͮ)
+	0x00, 0x00, 0x04, 0x41, 0xf0, 0x04, 0x41, 0x00, 0x00,	// orp U+0370 (Ͱ)
+	0x00, 0x00, 0x00, 0x46, 0xc1, 0x11, 0x04, 0x01, 0x00,	// orp U+0371 (ͱ)
+	0x00, 0x00, 0x7c, 0x55, 0x45, 0x10, 0x84, 0x03, 0x00,	// orp U+0372 (Ͳ)
+	0x00, 0x00, 0x7c, 0x15, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+0373 (ͳ)
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0374 (ʹ)
+	0x00, 0x00, 0x44, 0x59, 0x56, 0x4d, 0x53, 0x04, 0x00,	// orp U+0376 (Ͷ)
+	0x00, 0x00, 0x00, 0x40, 0xd2, 0x2c, 0x49, 0x02, 0x01,	// orp U+0377 (ͷ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x15, 0x91, 0x03, 0x00,	// orp U+037C (ͼ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x51, 0x91, 0x03, 0x00,	// orp U+037D (ͽ)
+	0x00, 0x00, 0x00, 0x84, 0x43, 0x00, 0x0c, 0x21, 0x00,	// orp U+037E (;)
+	0x08, 0x01, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0385 (΅)
+	0x42, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0386 (Ά)
+	0x42, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0388 (Έ)
+	0x42, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0389 (Ή)
+	0x42, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+038A (Ί)
+	0x42, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+038C (Ό)
+	0x42, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+038E (Ύ)
+	0x42, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+038F (Ώ)
+	0x08, 0x01, 0x28, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+0390 (ΐ)
+	0x00, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+0391 (Α)
+	0x00, 0x00, 0x3c, 0x51, 0xf4, 0x44, 0xd1, 0x03, 0x00,	// orp U+0392 (Β)
+	0x00, 0x00, 0x7c, 0x41, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+0393 (Γ)
+	0x00, 0x00, 0x10, 0x84, 0xa2, 0x44, 0xd1, 0x07, 0x00,	// orp U+0394 (Δ)
+	0x00, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+0395 (Ε)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+0399 (Ι)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x00,	// orp U+039A (Κ)
+	0x00, 0x00, 0x10, 0x84, 0xa2, 0x44, 0x51, 0x04, 0x00,	// orp U+039B (Λ)
+	0x00, 0x00, 0x44, 0x5b, 0x15, 0x45, 0x51, 0x04, 0x00,	// orp U+039C (Μ)
+	0x00, 0x00, 0x44, 0xd1, 0x54, 0x65, 0x51, 0x04, 0x00,	// orp U+039D (Ν)
+	0x00, 0x00, 0x7c, 0x00, 0xe0, 0x00, 0xc0, 0x07, 0x00,	// orp U+039E (Ξ)
+	0x00, 0x00, 0x7c, 0x51, 0x14, 0x45, 0x51, 0x04, 0x00,	// orp U+03A0 (Π)
+	0x00, 0x00, 0x3c, 0x51, 0xf4, 0x04, 0x41, 0x00, 0x00,	// orp U+03A1 (Ρ)
+	0x00, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+03A5 (Υ)
+	0x00, 0x00, 0x10, 0x4e, 0x55, 0x55, 0x0e, 0x01, 0x00,	// orp U+03A6 (Φ)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+03A8 (Ψ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+03A9 (Ω)
+	0x00, 0x80, 0x10, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+03AC (ά)
+	0x00, 0x80, 0x10, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+03AD (έ)
+	0x00, 0x80, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+03AE (ή)
+	0x00, 0x40, 0x08, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+03AF (ί)
+	0x08, 0x01, 0x28, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+03B0 (ΰ)
+	0x00, 0x00, 0x00, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+03B1 (α)
+	0x00, 0x00, 0x18, 0x49, 0xd2, 0x44, 0xd1, 0x13, 0x04,	// orp U+03B2 (β)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x0a, 0x41, 0x10,	// orp U+03B3 (γ)
+	0x00, 0x00, 0x38, 0x81, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+03B4 (δ)
+	0x00, 0x00, 0x7c, 0x84, 0x20, 0x08, 0x0c, 0xc4, 0x00,	// orp U+03B6 (ζ)
+	0x00, 0x00, 0x30, 0x92, 0xe4, 0x49, 0x12, 0x03, 0x00,	// orp U+03B8 (θ)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+03B9 (ι)
+	0x40, 0x20, 0x08, 0x04, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+03BB (λ)
+	0x00, 0x00, 0x7c, 0x84, 0xe0, 0x04, 0x81, 0x03, 0x21,	// orp U+03BE (ξ)
+	0x00, 0x00, 0x00, 0xc0, 0xa7, 0x28, 0xaa, 0x04, 0x00,	// orp U+03C0 (π)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x53, 0x13, 0x04,	// orp U+03C1 (ρ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x81, 0x03, 0x31,	// orp U+03C2 (ς)
+	0x00, 0x00, 0x00, 0x80, 0x97, 0x44, 0x91, 0x03, 0x00,	// orp U+03C3 (σ)
+	0x00, 0x00, 0x00, 0xc0, 0x47, 0x10, 0x14, 0x02, 0x00,	// orp U+03C4 (τ)
+	0x00, 0x00, 0x00, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+03C5 (υ)
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x55, 0x95, 0x43, 0x10,	// orp U+03C6 (φ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x84, 0x12, 0x45,	// orp U+03C7 (χ)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x95, 0x43, 0x10,	// orp U+03C8 (ψ)
+	0x00, 0x00, 0x00, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+03C9 (ω)
+	0x00, 0x00, 0x28, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+03CA (ϊ)
+	0x00, 0x00, 0x28, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+03CB (ϋ)
+	0x00, 0x80, 0x10, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+03CD (ύ)
+	0x00, 0x80, 0x10, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+03CE (ώ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0xc4, 0x20,	// orp U+03CF (Ϗ)
+	0x00, 0x00, 0x18, 0x49, 0xd2, 0x4c, 0x91, 0x03, 0x00,	// orp U+03D0 (ϐ)
+	0x00, 0x00, 0x30, 0x12, 0x0f, 0x4d, 0x12, 0x03, 0x00,	// orp U+03D1 (ϑ)
+	0x00, 0x00, 0x44, 0x2a, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+03D2 (ϒ)
+	0x42, 0x00, 0x44, 0x2a, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+03D3 (ϓ)
+	0xc0, 0x06, 0x44, 0x2a, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+03D4 (ϔ)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x55, 0x95, 0x02, 0x00,	// orp U+03D6 (ϖ)
+	0x00, 0x00, 0x00, 0x40, 0x24, 0x39, 0x4a, 0x04, 0x31,	// orp U+03D7 (ϗ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x43, 0x10,	// orp U+03D8 (Ϙ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x91, 0x43, 0x10,	// orp U+03D9 (ϙ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x04, 0x0e, 0x02, 0x00,	// orp U+03DA (Ϛ)
+	0x00, 0x00, 0x00, 0x90, 0x13, 0x04, 0x81, 0x03, 0x31,	// orp U+03DB (ϛ)
+	0x00, 0x00, 0x7c, 0x41, 0x70, 0x04, 0x41, 0x00, 0x00,	// orp U+03DC (Ϝ)
+	0x00, 0x00, 0x00, 0x80, 0x27, 0x08, 0x8e, 0x20, 0x08,	// orp U+03DD (ϝ)
+	0x00, 0x00, 0x08, 0x42, 0xf0, 0x41, 0x08, 0x02, 0x00,	// orp U+03DE (Ϟ)
+	0x00, 0x00, 0x00, 0x81, 0x20, 0x69, 0x96, 0x04, 0x81,	// orp U+03DF (ϟ)
+	0x00, 0x00, 0x1c, 0x8c, 0x84, 0x51, 0x10, 0x02, 0x00,	// orp U+03E0 (Ϡ)
+	0x00, 0x00, 0x0c, 0x04, 0xc2, 0x48, 0x18, 0x05, 0x41,	// orp U+03E1 (ϡ)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x1a, 0xf4, 0x00,	// orp U+03E2 (Ϣ)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x1a, 0xf4, 0x00,	// orp U+03E3 (ϣ)
+	0x00, 0x00, 0x48, 0x51, 0x14, 0x45, 0x99, 0x05, 0x41,	// orp U+03E4 (Ϥ)
+	0x00, 0x00, 0x00, 0x80, 0x14, 0x45, 0x91, 0x07, 0x41,	// orp U+03E5 (ϥ)
+	0x00, 0x00, 0x04, 0x41, 0x33, 0x45, 0x11, 0xe4, 0x00,	// orp U+03E6 (Ϧ)
+	0x00, 0x00, 0x00, 0x76, 0x62, 0x41, 0x53, 0x03, 0x00,	// orp U+03E7 (ϧ)
+	0x00, 0x00, 0x38, 0x51, 0x84, 0x10, 0x42, 0xe4, 0x00,	// orp U+03E8 (Ϩ)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x21, 0x46, 0xe0, 0x01,	// orp U+03E9 (ϩ)
+	0x00, 0x00, 0x44, 0x0a, 0xa1, 0x28, 0xd1, 0x07, 0x00,	// orp U+03EA (Ϫ)
+	0x00, 0x00, 0x00, 0x91, 0x42, 0x28, 0xd1, 0x07, 0x00,	// orp U+03EB (ϫ)
+	0x00, 0x00, 0x70, 0x42, 0x70, 0x24, 0xd1, 0x03, 0x00,	// orp U+03EC (Ϭ)
+	0x00, 0x00, 0x00, 0x8c, 0x10, 0x1c, 0xc9, 0x01, 0x00,	// orp U+03ED (ϭ)
+	0x00, 0x00, 0x10, 0xc4, 0x57, 0x11, 0x04, 0x03, 0x00,	// orp U+03EE (Ϯ)
+	0x00, 0x00, 0x10, 0xc4, 0x57, 0x10, 0x04, 0x41, 0x10,	// orp U+03EF (ϯ)
+	0x00, 0x00, 0x00, 0x40, 0x24, 0x39, 0x4a, 0x04, 0x00,	// orp U+03F0 (ϰ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0xd1, 0x13, 0x78,	// orp U+03F1 (ϱ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x91, 0x03, 0x00,	// orp U+03F2 (ϲ)
+	0x00, 0x00, 0x20, 0x00, 0x83, 0x20, 0x08, 0xa2, 0x10,	// orp U+03F3 (ϳ)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x38, 0x02, 0x07, 0x00,	// orp U+03F5 (ϵ)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x71, 0x90, 0x03, 0x00,	// orp U+03F6 (϶)
+	0x00, 0x70, 0x08, 0x8e, 0x24, 0x39, 0xc2, 0x01, 0x00,	// orp U+03F7 (Ϸ)
+	0x00, 0x10, 0x34, 0x53, 0x14, 0x4d, 0x4d, 0x00, 0x00,	// orp U+03F8 (ϸ)
+	0x00, 0x00, 0x38, 0x51, 0x10, 0x04, 0x91, 0x03, 0x00,	// orp U+03F9 (Ϲ)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x55, 0x51, 0x14, 0x04,	// orp U+03FB (ϻ)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x49, 0x8e, 0xf0, 0x08,	// orp U+03FC (ϼ)
+	0x00, 0x00, 0x38, 0x51, 0x50, 0x04, 0x91, 0x03, 0x00,	// orp U+03FE (Ͼ)
+	0x00, 0x00, 0x38, 0x11, 0x44, 0x41, 0x91, 0x03, 0x00,	// orp U+03FF (Ͽ)
+	0x00, 0x00, 0x1c, 0x82, 0xe0, 0x48, 0x92, 0x04, 0x31,	// orp U+0402 (Ђ)
+	0x08, 0x01, 0x7c, 0x41, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+0403 (Ѓ)
+	0x00, 0x00, 0x38, 0x51, 0xf0, 0x04, 0x91, 0x03, 0x00,	// orp U+0404 (Є)
+	0x00, 0x00, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+0405 (Ѕ)
+	0x00, 0x00, 0x70, 0x08, 0x82, 0x20, 0x89, 0x01, 0x00,	// orp U+0408 (Ј)
+	0x00, 0x00, 0x18, 0x45, 0xd1, 0x54, 0x55, 0x03, 0x00,	// orp U+0409 (Љ)
+	0x00, 0x00, 0x14, 0x45, 0xf1, 0x54, 0x55, 0x03, 0x00,	// orp U+040A (Њ)
+	0x00, 0x00, 0x1c, 0x82, 0xe0, 0x48, 0x92, 0x04, 0x00,	// orp U+040B (Ћ)
+	0x08, 0x01, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x00,	// orp U+040C (Ќ)
+	0x02, 0x01, 0x44, 0x51, 0x56, 0x4d, 0x51, 0x04, 0x00,	// orp U+040D (Ѝ)
+	0x91, 0x03, 0x44, 0x51, 0x14, 0x79, 0x90, 0x03, 0x00,	// orp U+040E (Ў)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x45, 0xd1, 0x47, 0x10,	// orp U+040F (Џ)
+	0x00, 0x00, 0x3c, 0x41, 0xf0, 0x44, 0xd1, 0x03, 0x00,	// orp U+0411 (Б)
+	0x00, 0x00, 0x30, 0x8a, 0xa2, 0x28, 0xca, 0x17, 0x01,	// orp U+0414 (Д)
+	0x00, 0x00, 0x54, 0x95, 0x43, 0x38, 0x55, 0x05, 0x00,	// orp U+0416 (Ж)
+	0x00, 0x00, 0x38, 0x11, 0xe4, 0x40, 0x91, 0x03, 0x00,	// orp U+0417 (З)
+	0x00, 0x00, 0x44, 0x51, 0x56, 0x4d, 0x51, 0x04, 0x00,	// orp U+0418 (И)
+	0x91, 0x03, 0x44, 0x51, 0x56, 0x4d, 0x51, 0x04, 0x00,	// orp U+0419 (Й)
+	0x00, 0x00, 0x70, 0x92, 0x24, 0x49, 0x52, 0x04, 0x00,	// orp U+041B (Л)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x79, 0x90, 0x03, 0x00,	// orp U+0423 (У)
+	0x00, 0x00, 0x24, 0x49, 0x92, 0x24, 0xc9, 0x07, 0x41,	// orp U+0426 (Ц)
+	0x00, 0x00, 0x44, 0x51, 0xe4, 0x41, 0x10, 0x04, 0x00,	// orp U+0427 (Ч)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0xd5, 0x07, 0x00,	// orp U+0428 (Ш)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0xd5, 0x07, 0x41,	// orp U+0429 (Щ)
+	0x00, 0x00, 0x0c, 0x82, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+042A (Ъ)
+	0x00, 0x00, 0x44, 0x51, 0x34, 0x55, 0xd5, 0x04, 0x00,	// orp U+042B (Ы)
+	0x00, 0x00, 0x08, 0x82, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+042C (Ь)
+	0x00, 0x00, 0x38, 0x11, 0xe4, 0x41, 0x91, 0x03, 0x00,	// orp U+042D (Э)
+	0x00, 0x00, 0x24, 0x55, 0x75, 0x55, 0x55, 0x02, 0x00,	// orp U+042E (Ю)
+	0x00, 0x00, 0x78, 0x51, 0xe4, 0x51, 0x52, 0x04, 0x00,	// orp U+042F (Я)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x79, 0x91, 0x07, 0x00,	// orp U+0430 (а)
+	0x00, 0x00, 0x38, 0xc1, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+0431 (б)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x04, 0x41, 0x00, 0x00,	// orp U+0433 (г)
+	0x00, 0x00, 0x00, 0x00, 0xa3, 0x28, 0xca, 0x17, 0x01,	// orp U+0434 (д)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x3d, 0x81, 0x03, 0x00,	// orp U+0435 (е)
+	0x00, 0x00, 0x00, 0x40, 0xe5, 0x10, 0x4e, 0x05, 0x00,	// orp U+0436 (ж)
+	0x00, 0x00, 0x00, 0x40, 0x94, 0x55, 0x53, 0x04, 0x00,	// orp U+0438 (и)
+	0x00, 0x10, 0x39, 0x40, 0x94, 0x55, 0x53, 0x04, 0x00,	// orp U+0439 (й)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x49, 0x52, 0x04, 0x00,	// orp U+043B (л)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x55, 0x51, 0x04, 0x00,	// orp U+043C (м)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x45, 0x51, 0x04, 0x00,	// orp U+043F (п)
+	0x00, 0x00, 0x00, 0xc0, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+0440 (р)
+	0x00, 0x00, 0x00, 0xc0, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+0442 (т)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x91, 0x07, 0x39,	// orp U+0443 (у)
+	0x00, 0x00, 0x00, 0x40, 0x92, 0x24, 0xc9, 0x07, 0x41,	// orp U+0446 (ц)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x79, 0x10, 0x04, 0x00,	// orp U+0447 (ч)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0xd5, 0x07, 0x00,	// orp U+0448 (ш)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0xd5, 0x07, 0x41,	// orp U+0449 (щ)
+	0x00, 0x00, 0x00, 0xc0, 0x20, 0x38, 0x92, 0x03, 0x00,	// orp U+044A (ъ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x4d, 0xd5, 0x04, 0x00,	// orp U+044B (ы)
+	0x00, 0x00, 0x00, 0x80, 0x20, 0x38, 0x92, 0x03, 0x00,	// orp U+044C (ь)
+	0x00, 0x00, 0x00, 0x40, 0x52, 0x5d, 0x55, 0x02, 0x00,	// orp U+044E (ю)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x71, 0x94, 0x04, 0x00,	// orp U+044F (я)
+	0x00, 0x00, 0x08, 0x87, 0xe0, 0x48, 0x92, 0x04, 0x21,	// orp U+0452 (ђ)
+	0x00, 0x80, 0x10, 0xc0, 0x17, 0x04, 0x41, 0x00, 0x00,	// orp U+0453 (ѓ)
+	0x00, 0x00, 0x00, 0x04, 0x60, 0x10, 0x84, 0x03, 0x00,	// orp U+0456 (і)
+	0x00, 0x00, 0x00, 0x0a, 0x60, 0x10, 0x84, 0x03, 0x00,	// orp U+0457 (ї)
+	0x00, 0x00, 0x00, 0x10, 0x80, 0x41, 0x10, 0x24, 0x31,	// orp U+0458 (ј)
+	0x00, 0x00, 0x00, 0x80, 0x51, 0x34, 0x55, 0x03, 0x00,	// orp U+0459 (љ)
+	0x00, 0x00, 0x00, 0x40, 0x51, 0x3c, 0x55, 0x03, 0x00,	// orp U+045A (њ)
+	0x00, 0x00, 0x08, 0x87, 0xe0, 0x48, 0x92, 0x04, 0x00,	// orp U+045B (ћ)
+	0x00, 0x80, 0x10, 0x80, 0xa4, 0x18, 0x8a, 0x04, 0x00,	// orp U+045C (ќ)
+	0x00, 0x20, 0x10, 0x40, 0x94, 0x55, 0x53, 0x04, 0x00,	// orp U+045D (ѝ)
+	0x00, 0x10, 0x39, 0x40, 0x14, 0x45, 0x91, 0x07, 0x39,	// orp U+045E (ў)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0xd1, 0x47, 0x10,	// orp U+045F (џ)
+	0x00, 0x00, 0x28, 0x51, 0x54, 0x55, 0x95, 0x02, 0x00,	// orp U+0460 (Ѡ)
+	0x00, 0x00, 0x08, 0xc2, 0x23, 0x38, 0x92, 0x03, 0x00,	// orp U+0463 (ѣ)
+	0x00, 0x00, 0x64, 0x45, 0xf1, 0x15, 0x45, 0x06, 0x00,	// orp U+0464 (Ѥ)
+	0x00, 0x00, 0x00, 0x40, 0x56, 0x7c, 0x45, 0x06, 0x00,	// orp U+0465 (ѥ)
+	0x00, 0x00, 0x10, 0x8a, 0x12, 0x7d, 0x55, 0x05, 0x00,	// orp U+0466 (Ѧ)
+	0x00, 0x00, 0x00, 0x84, 0xa2, 0x44, 0x5f, 0x05, 0x00,	// orp U+0467 (ѧ)
+	0x00, 0x00, 0x24, 0x49, 0xf7, 0x75, 0x5d, 0x07, 0x00,	// orp U+0468 (Ѩ)
+	0x00, 0x00, 0x00, 0x40, 0x92, 0x7c, 0x5d, 0x07, 0x00,	// orp U+0469 (ѩ)
+	0x00, 0xf0, 0x45, 0x8a, 0xe2, 0x54, 0x55, 0x05, 0x00,	// orp U+046A (Ѫ)
+	0x00, 0x00, 0x00, 0x5f, 0xa4, 0x38, 0x55, 0x05, 0x00,	// orp U+046B (ѫ)
+	0x00, 0xf0, 0x8f, 0x55, 0xf2, 0x75, 0x5d, 0x05, 0x00,	// orp U+046C (Ѭ)
+	0x00, 0x00, 0x00, 0x7f, 0x95, 0x7c, 0x5d, 0x05, 0x00,	// orp U+046D (ѭ)
+	0x0a, 0x01, 0x38, 0x11, 0xc4, 0x40, 0x90, 0x13, 0x38,	// orp U+046E (Ѯ)
+	0x00, 0xa0, 0x10, 0x80, 0x13, 0x31, 0x90, 0x13, 0x38,	// orp U+046F (ѯ)
+	0x00, 0x00, 0x54, 0x55, 0xe5, 0x10, 0x04, 0x01, 0x00,	// orp U+0470 (Ѱ)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+0471 (ѱ)
+	0x00, 0x00, 0x44, 0x49, 0xa2, 0x28, 0x0a, 0x01, 0x00,	// orp U+0474 (Ѵ)
+	0x00, 0x00, 0x00, 0x40, 0x94, 0x28, 0x0a, 0x01, 0x00,	// orp U+0475 (ѵ)
+	0x89, 0x04, 0x44, 0x49, 0xa2, 0x28, 0x0a, 0x01, 0x00,	// orp U+0476 (Ѷ)
+	0x00, 0x90, 0x48, 0x40, 0x94, 0x28, 0x0a, 0x01, 0x00,	// orp U+0477 (ѷ)
+	0x00, 0x00, 0x08, 0x45, 0xd1, 0x75, 0x9d, 0x06, 0x21,	// orp U+0478 (Ѹ)
+	0x00, 0x00, 0x00, 0x80, 0xd6, 0x75, 0x9d, 0x06, 0x21,	// orp U+0479 (ѹ)
+	0x00, 0xe1, 0x54, 0x51, 0x14, 0x45, 0x95, 0x43, 0x00,	// orp U+047A (Ѻ)
+	0x00, 0x00, 0x10, 0x4e, 0x15, 0x45, 0x95, 0x43, 0x00,	// orp U+047B (ѻ)
+	0x80, 0x03, 0x10, 0x44, 0x14, 0x45, 0x95, 0x02, 0x00,	// orp U+047C (Ѽ)
+	0x00, 0x00, 0x38, 0x00, 0x51, 0x45, 0x95, 0x02, 0x00,	// orp U+047D (ѽ)
+	0x5f, 0x05, 0x28, 0x51, 0x54, 0x55, 0x95, 0x02, 0x00,	// orp U+047E (Ѿ)
+	0x00, 0xf0, 0x55, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+047F (ѿ)
+	0x00, 0xe0, 0x44, 0x51, 0x10, 0x04, 0x81, 0x83, 0x20,	// orp U+0480 (Ҁ)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x04, 0x0e, 0x82, 0x00,	// orp U+0481 (ҁ)
+	0x00, 0x00, 0x50, 0x48, 0x23, 0x09, 0x05, 0x00, 0x00,	// orp U+0482 (҂)
+	0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0483 (҃)
+	0x4e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0484 (҄)
+	0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0485 (҅)
+	0x4e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0486 (҆)
+	0x46, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0487 (҇)
+	0x42, 0x01, 0xa1, 0x00, 0x00, 0x00, 0x42, 0x01, 0xa1,	// orp U+0488 (҈)
+	0x42, 0x38, 0xc1, 0x00, 0x00, 0x00, 0x42, 0x38, 0xc1,	// orp U+0489 (҉)
+	0x91, 0x03, 0x44, 0x59, 0x56, 0x4d, 0x53, 0x84, 0x20,	// orp U+048A (Ҋ)
+	0x40, 0xe4, 0x00, 0x51, 0x94, 0x55, 0x53, 0x84, 0x20,	// orp U+048B (ҋ)
+	0x00, 0x20, 0x08, 0x87, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+048C (Ҍ)
+	0x00, 0x00, 0x08, 0x87, 0xe0, 0x48, 0x92, 0x03, 0x00,	// orp U+048D (ҍ)
+	0x00, 0xf0, 0x44, 0x51, 0xf5, 0x44, 0x41, 0x00, 0x00,	// orp U+048E (Ҏ)
+	0x00, 0x00, 0x00, 0x4f, 0x14, 0x55, 0x4f, 0x14, 0x04,	// orp U+048F (ҏ)
+	0x00, 0x04, 0x7d, 0x41, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+0490 (Ґ)
+	0x00, 0x00, 0x40, 0xd0, 0x17, 0x04, 0x41, 0x00, 0x00,	// orp U+0491 (ґ)
+	0x00, 0x00, 0x78, 0x82, 0xf0, 0x08, 0x82, 0x00, 0x00,	// orp U+0492 (Ғ)
+	0x00, 0x00, 0x00, 0x80, 0x27, 0x3c, 0x82, 0x00, 0x00,	// orp U+0493 (ғ)
+	0x00, 0xf0, 0x05, 0xc1, 0x13, 0x45, 0x51, 0x84, 0x00,	// orp U+0494 (Ҕ)
+	0x00, 0x00, 0x00, 0x5f, 0xf0, 0x44, 0x51, 0x84, 0x00,	// orp U+0495 (ҕ)
+	0x00, 0x00, 0x54, 0x55, 0xe5, 0x54, 0x55, 0x0d, 0x82,	// orp U+0496 (Җ)
+	0x00, 0x00, 0x00, 0x40, 0xe5, 0x10, 0x4e, 0x0d, 0x82,	// orp U+0497 (җ)
+	0x00, 0xe0, 0x44, 0x10, 0x02, 0x41, 0x91, 0x43, 0x08,	// orp U+0498 (Ҙ)
+	0x00, 0x00, 0x00, 0x4e, 0x84, 0x40, 0x91, 0x43, 0x08,	// orp U+0499 (ҙ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x82,	// orp U+049A (Қ)
+	0x00, 0x00, 0x00, 0x40, 0x52, 0x0c, 0x45, 0x02, 0x41,	// orp U+049B (қ)
+	0x00, 0x00, 0x54, 0x4d, 0x31, 0x14, 0x4d, 0x05, 0x00,	// orp U+049C (Ҝ)
+	0x00, 0x00, 0x00, 0x40, 0xd5, 0x1c, 0x4d, 0x05, 0x00,	// orp U+049D (ҝ)
+	0x00, 0x00, 0x48, 0x97, 0x62, 0x28, 0x92, 0x04, 0x00,	// orp U+049E (Ҟ)
+	0x00, 0x20, 0x08, 0x87, 0xa4, 0x18, 0x8a, 0x04, 0x00,	// orp U+049F (ҟ)
+	0x00, 0x30, 0x49, 0x8a, 0x61, 0x28, 0x92, 0x04, 0x00,	// orp U+04A0 (Ҡ)
+	0x00, 0x00, 0x00, 0xc0, 0xa4, 0x18, 0x8a, 0x04, 0x00,	// orp U+04A1 (ҡ)
+	0x00, 0x90, 0x24, 0xc9, 0x93, 0x24, 0x49, 0x06, 0x41,	// orp U+04A2 (Ң)
+	0x00, 0x00, 0x00, 0x40, 0x92, 0x3c, 0x49, 0x06, 0x41,	// orp U+04A3 (ң)
+	0x00, 0xd0, 0x15, 0xc5, 0x51, 0x14, 0x45, 0x01, 0x00,	// orp U+04A4 (Ҥ)
+	0x00, 0x00, 0x00, 0x40, 0x57, 0x1c, 0x45, 0x01, 0x00,	// orp U+04A5 (ҥ)
+	0x00, 0x70, 0x14, 0x45, 0x53, 0x55, 0x55, 0x05, 0x21,	// orp U+04A6 (Ҧ)
+	0x00, 0x00, 0x00, 0xc0, 0x51, 0x34, 0x55, 0x05, 0x21,	// orp U+04A7 (ҧ)
+	0x00, 0xe0, 0x05, 0x49, 0x55, 0x55, 0x0e, 0x81, 0x01,	// orp U+04A8 (Ҩ)
+	0x00, 0x00, 0x00, 0x4e, 0x90, 0x54, 0x0e, 0x81, 0x01,	// orp U+04A9 (ҩ)
+	0x00, 0xe0, 0x44, 0x41, 0x10, 0x04, 0x91, 0x43, 0x20,	// orp U+04AA (Ҫ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x05, 0x91, 0x43, 0x20,	// orp U+04AB (ҫ)
+	0x00, 0xf0, 0x11, 0x04, 0x41, 0x10, 0x04, 0x83, 0x20,	// orp U+04AC (Ҭ)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x11, 0x04, 0x83, 0x20,	// orp U+04AD (ҭ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x04, 0x41, 0x10,	// orp U+04AF (ү)
+	0x00, 0x00, 0x44, 0x91, 0xf2, 0x11, 0x04, 0x01, 0x00,	// orp U+04B0 (Ұ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x29, 0x1f, 0x41, 0x10,	// orp U+04B1 (ұ)
+	0x00, 0x00, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x82,	// orp U+04B2 (Ҳ)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x82,	// orp U+04B3 (ҳ)
+	0x00, 0x70, 0x49, 0x92, 0x24, 0x49, 0x92, 0x07, 0x41,	// orp U+04B4 (Ҵ)
+	0x00, 0x00, 0x00, 0x97, 0x24, 0x49, 0x92, 0x07, 0x41,	// orp U+04B5 (ҵ)
+	0x00, 0x90, 0x24, 0x49, 0x92, 0x38, 0x08, 0x06, 0x41,	// orp U+04B6 (Ҷ)
+	0x00, 0x00, 0x00, 0x49, 0x92, 0x38, 0x08, 0x06, 0x41,	// orp U+04B7 (ҷ)
+	0x00, 0x10, 0x45, 0x55, 0xe5, 0x51, 0x14, 0x04, 0x00,	// orp U+04B8 (Ҹ)
+	0x00, 0x00, 0x00, 0x51, 0x54, 0x79, 0x14, 0x04, 0x00,	// orp U+04B9 (ҹ)
+	0x00, 0x00, 0x04, 0xc1, 0x13, 0x45, 0x51, 0x04, 0x00,	// orp U+04BA (Һ)
+	0x00, 0x00, 0x08, 0x82, 0xe0, 0x48, 0x92, 0x04, 0x00,	// orp U+04BB (һ)
+	0x00, 0xc0, 0x48, 0x92, 0xf4, 0x09, 0x12, 0x03, 0x00,	// orp U+04BC (Ҽ)
+	0x00, 0x00, 0x00, 0x8c, 0xf4, 0x09, 0x12, 0x03, 0x00,	// orp U+04BD (ҽ)
+	0x00, 0xc0, 0x48, 0x92, 0xf4, 0x09, 0x12, 0x43, 0x20,	// orp U+04BE (Ҿ)
+	0x00, 0x00, 0x00, 0x8c, 0xf4, 0x09, 0x12, 0x43, 0x20,	// orp U+04BF (ҿ)
+	0x00, 0xe0, 0x10, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+04C0 (Ӏ)
+	0x91, 0x03, 0x54, 0x55, 0xe5, 0x54, 0x55, 0x05, 0x00,	// orp U+04C1 (Ӂ)
+	0x00, 0x10, 0x39, 0x40, 0xe5, 0x10, 0x4e, 0x05, 0x00,	// orp U+04C2 (ӂ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x31,	// orp U+04C3 (Ӄ)
+	0x00, 0x00, 0x00, 0x40, 0x52, 0x0c, 0x45, 0x82, 0x18,	// orp U+04C4 (ӄ)
+	0x00, 0xc0, 0x49, 0x92, 0x24, 0x49, 0x51, 0x84, 0x20,	// orp U+04C5 (Ӆ)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x49, 0x52, 0x84, 0x20,	// orp U+04C6 (ӆ)
+	0x00, 0x10, 0x45, 0xd1, 0x17, 0x45, 0x51, 0x04, 0x31,	// orp U+04C7 (Ӈ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x7d, 0x51, 0x04, 0x31,	// orp U+04C8 (ӈ)
+	0x00, 0x10, 0x45, 0xd1, 0x17, 0x45, 0x51, 0x84, 0x20,	// orp U+04C9 (Ӊ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x7d, 0x51, 0x84, 0x20,	// orp U+04CA (ӊ)
+	0x00, 0x10, 0x45, 0x51, 0x14, 0x79, 0x10, 0x86, 0x20,	// orp U+04CB (Ӌ)
+	0x00, 0x00, 0x00, 0x51, 0x14, 0x79, 0x10, 0x86, 0x20,	// orp U+04CC (ӌ)
+	0x00, 0x10, 0x6d, 0x5b, 0x55, 0x45, 0x51, 0x84, 0x20,	// orp U+04CD (Ӎ)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x55, 0x51, 0x84, 0x20,	// orp U+04CE (ӎ)
+	0x00, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x00, 0x00,	// orp U+04CF (ӏ)
+	0x40, 0xe4, 0x00, 0x4e, 0x14, 0x7d, 0x51, 0x04, 0x00,	// orp U+04D0 (Ӑ)
+	0x00, 0x00, 0x00, 0x80, 0x43, 0x39, 0x95, 0x03, 0x00,	// orp U+04D5 (ӕ)
+	0x40, 0xe4, 0x00, 0x5f, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+04D6 (Ӗ)
+	0x00, 0x00, 0x00, 0x80, 0x03, 0x7d, 0x91, 0x03, 0x00,	// orp U+04D9 (ә)
+	0x80, 0x02, 0x38, 0x11, 0xf4, 0x45, 0x91, 0x03, 0x00,	// orp U+04DA (Ӛ)
+	0x00, 0x00, 0x28, 0x80, 0x03, 0x7d, 0x91, 0x03, 0x00,	// orp U+04DB (ӛ)
+	0x80, 0x02, 0x54, 0x55, 0xe5, 0x54, 0x55, 0x05, 0x00,	// orp U+04DC (Ӝ)
+	0x00, 0x00, 0x28, 0x40, 0xe5, 0x10, 0x4e, 0x05, 0x00,	// orp U+04DD (ӝ)
+	0x80, 0x02, 0x38, 0x11, 0xc4, 0x40, 0x91, 0x03, 0x00,	// orp U+04DE (Ӟ)
+	0x00, 0x00, 0x28, 0x80, 0x13, 0x31, 0x91, 0x03, 0x00,	// orp U+04DF (ӟ)
+	0xc0, 0x07, 0x44, 0x51, 0x56, 0x4d, 0x51, 0x04, 0x00,	// orp U+04E2 (Ӣ)
+	0x00, 0x00, 0x7c, 0x40, 0x94, 0x55, 0x53, 0x04, 0x00,	// orp U+04E3 (ӣ)
+	0x80, 0x02, 0x44, 0x51, 0x56, 0x4d, 0x51, 0x04, 0x00,	// orp U+04E4 (Ӥ)
+	0x00, 0x00, 0x28, 0x40, 0x94, 0x55, 0x53, 0x04, 0x00,	// orp U+04E5 (ӥ)
+	0x80, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x91, 0x03, 0x00,	// orp U+04EA (Ӫ)
+	0x00, 0x00, 0x28, 0x80, 0x13, 0x7d, 0x91, 0x03, 0x00,	// orp U+04EB (ӫ)
+	0x80, 0x02, 0x1c, 0x08, 0xe4, 0x41, 0xc8, 0x01, 0x00,	// orp U+04EC (Ӭ)
+	0x00, 0x00, 0x28, 0x80, 0x03, 0x71, 0x90, 0x03, 0x00,	// orp U+04ED (ӭ)
+	0xc0, 0x07, 0x44, 0x51, 0x66, 0x41, 0x91, 0x03, 0x00,	// orp U+04EE (Ӯ)
+	0x00, 0x00, 0x7c, 0x40, 0x14, 0x45, 0x1e, 0x14, 0x39,	// orp U+04EF (ӯ)
+	0x80, 0x02, 0x44, 0x51, 0x66, 0x41, 0x91, 0x03, 0x00,	// orp U+04F0 (Ӱ)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x45, 0x1e, 0x14, 0x39,	// orp U+04F1 (ӱ)
+	0x52, 0x02, 0x44, 0x51, 0x66, 0x41, 0x91, 0x03, 0x00,	// orp U+04F2 (Ӳ)
+	0x00, 0x20, 0x25, 0x40, 0x14, 0x45, 0x1e, 0x14, 0x39,	// orp U+04F3 (ӳ)
+	0x80, 0x02, 0x44, 0x51, 0xe4, 0x41, 0x10, 0x04, 0x00,	// orp U+04F4 (Ӵ)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x79, 0x10, 0x04, 0x00,	// orp U+04F5 (ӵ)
+	0x00, 0x00, 0x7c, 0x41, 0x10, 0x04, 0xc1, 0x20, 0x00,	// orp U+04F6 (Ӷ)
+	0x00, 0x00, 0x00, 0x80, 0x27, 0x08, 0x82, 0x41, 0x00,	// orp U+04F7 (ӷ)
+	0x80, 0x02, 0x44, 0x51, 0x34, 0x55, 0xd5, 0x04, 0x00,	// orp U+04F8 (Ӹ)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x4d, 0xd5, 0x04, 0x00,	// orp U+04F9 (ӹ)
+	0x00, 0x00, 0x78, 0x82, 0x70, 0x08, 0x82, 0x41, 0x08,	// orp U+04FA (Ӻ)
+	0x00, 0x00, 0x00, 0x80, 0x27, 0x1c, 0x82, 0x41, 0x08,	// orp U+04FB (ӻ)
+	0x00, 0x00, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x21,	// orp U+04FC (Ӽ)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x21,	// orp U+04FD (ӽ)
+	0x00, 0x00, 0x44, 0x91, 0xf2, 0x29, 0x51, 0x04, 0x00,	// orp U+04FE (Ӿ)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x7c, 0x4a, 0x04, 0x00,	// orp U+04FF (ӿ)
+	0x00, 0x00, 0x40, 0x90, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+0500 (Ԁ)
+	0x00, 0x00, 0x40, 0x10, 0x27, 0x49, 0x12, 0x07, 0x00,	// orp U+0501 (ԁ)
+	0x00, 0x00, 0x10, 0x84, 0x51, 0x55, 0x95, 0x03, 0x00,	// orp U+0502 (Ԃ)
+	0x00, 0x00, 0x10, 0x04, 0x61, 0x54, 0x95, 0x03, 0x00,	// orp U+0503 (ԃ)
+	0x00, 0x00, 0x0c, 0x04, 0x31, 0x50, 0x14, 0x02, 0x00,	// orp U+0504 (Ԅ)
+	0x00, 0x00, 0x00, 0x03, 0x41, 0x48, 0x14, 0x02, 0x00,	// orp U+0505 (ԅ)
+	0x00, 0x00, 0x0c, 0x04, 0x31, 0x10, 0x04, 0x83, 0x20,	// orp U+0506 (Ԇ)
+	0x00, 0x00, 0x00, 0x03, 0x41, 0x08, 0x04, 0x83, 0x20,	// orp U+0507 (ԇ)
+	0x00, 0x00, 0x7c, 0x45, 0x51, 0x55, 0x55, 0x02, 0x00,	// orp U+0508 (Ԉ)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x14, 0x55, 0x02, 0x00,	// orp U+0509 (ԉ)
+	0x00, 0x00, 0x14, 0x45, 0x71, 0x55, 0x55, 0x02, 0x00,	// orp U+050A (Ԋ)
+	0x00, 0x00, 0x00, 0x40, 0x51, 0x5c, 0x55, 0x02, 0x00,	// orp U+050B (ԋ)
+	0x00, 0x00, 0x38, 0x51, 0x90, 0x45, 0x91, 0x03, 0x00,	// orp U+050C (Ԍ)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x51, 0x14, 0x02, 0x00,	// orp U+050E (Ԏ)
+	0x00, 0x00, 0x78, 0x51, 0x60, 0x04, 0x91, 0x03, 0x00,	// orp U+0510 (Ԑ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x19, 0x91, 0x03, 0x00,	// orp U+0511 (ԑ)
+	0x00, 0x00, 0xfc, 0x92, 0x24, 0x49, 0x15, 0x02, 0x00,	// orp U+0512 (Ԓ)
+	0x00, 0x00, 0x00, 0xc0, 0x2f, 0x49, 0x52, 0x84, 0x00,	// orp U+0513 (ԓ)
+	0x00, 0x00, 0xac, 0xaa, 0x2a, 0xa9, 0x6a, 0x0a, 0x00,	// orp U+0514 (Ԕ)
+	0x00, 0x00, 0x00, 0xc0, 0xaa, 0x4a, 0x6a, 0x0a, 0x00,	// orp U+0515 (ԕ)
+	0x00, 0x00, 0x4c, 0x55, 0xb3, 0x44, 0x51, 0x04, 0x00,	// orp U+0516 (Ԗ)
+	0x00, 0x00, 0x00, 0xc0, 0xd4, 0x14, 0x4b, 0x14, 0x00,	// orp U+0517 (ԗ)
+	0x00, 0x00, 0x78, 0x45, 0xe1, 0x14, 0x45, 0x07, 0x00,	// orp U+0518 (Ԙ)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x39, 0x45, 0x06, 0x00,	// orp U+0519 (ԙ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x55, 0x89, 0x05, 0x00,	// orp U+051A (Ԛ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x45, 0x91, 0x07, 0x41,	// orp U+051B (ԛ)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+051C (Ԝ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+051D (ԝ)
+	0x00, 0x00, 0x54, 0x49, 0x35, 0x14, 0x49, 0x04, 0x00,	// orp U+051E (Ԟ)
+	0x00, 0x00, 0x00, 0x40, 0x95, 0x5c, 0x49, 0x04, 0x00,	// orp U+051F (ԟ)
+	0x00, 0x00, 0x2c, 0x8a, 0xa2, 0xa9, 0x6a, 0x0a, 0x42,	// orp U+0520 (Ԡ)
+	0x00, 0x00, 0x00, 0xc0, 0xa2, 0x68, 0x6a, 0x0a, 0x02,	// orp U+0521 (ԡ)
+	0x00, 0x00, 0x14, 0x45, 0xf1, 0x54, 0x55, 0x05, 0x21,	// orp U+0522 (Ԣ)
+	0x00, 0x00, 0x00, 0x40, 0x51, 0x3c, 0x55, 0x05, 0x21,	// orp U+0523 (ԣ)
+	0x00, 0x50, 0x14, 0x45, 0x51, 0x14, 0x8d, 0x04, 0x00,	// orp U+0531 (Ա)
+	0x00, 0xe0, 0x44, 0x51, 0x10, 0x3c, 0x51, 0x00, 0x00,	// orp U+0532 (Բ)
+	0x00, 0x20, 0x14, 0x45, 0xe1, 0x50, 0x04, 0x01, 0x00,	// orp U+0533 (Գ)
+	0x00, 0x20, 0x14, 0x05, 0xc1, 0x50, 0x04, 0x01, 0x00,	// orp U+0534 (Դ)
+	0x00, 0x10, 0x04, 0x4f, 0x14, 0x44, 0x91, 0x03, 0x00,	// orp U+0535 (Ե)
+	0x00, 0x60, 0x24, 0x89, 0x83, 0x14, 0x4f, 0x04, 0x00,	// orp U+0536 (Զ)
+	0x00, 0x10, 0x04, 0x4f, 0x14, 0x04, 0x81, 0x03, 0x21,	// orp U+0537 (Է)
+	0x00, 0x60, 0x24, 0x49, 0x10, 0x04, 0xc1, 0x03, 0x01,	// orp U+0538 (Ը)
+	0x00, 0x60, 0x24, 0xdd, 0xb2, 0x14, 0x41, 0x00, 0x00,	// orp U+0539 (Թ)
+	0x00, 0x80, 0x20, 0x88, 0x97, 0x24, 0x89, 0x01, 0x00,	// orp U+053A (Ժ)
+	0x00, 0x10, 0x04, 0xc1, 0x13, 0x45, 0x41, 0x00, 0x00,	// orp U+053B (Ի)
+	0x00, 0x10, 0x04, 0x41, 0x10, 0x04, 0x81, 0x03, 0x21,	// orp U+053C (Լ)
+	0x00, 0x10, 0x04, 0x57, 0x55, 0x25, 0x41, 0x00, 0x00,	// orp U+053D (Խ)
+	0x00, 0xf0, 0x39, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+053E (Ծ)
+	0x00, 0x10, 0x44, 0x51, 0x14, 0x79, 0x10, 0x04, 0x00,	// orp U+053F (Կ)
+	0x00, 0x80, 0x10, 0x08, 0x21, 0x04, 0x03, 0x03, 0x01,	// orp U+0540 (Հ)
+	0x00, 0xc0, 0x48, 0x12, 0x07, 0x39, 0x89, 0x05, 0x00,	// orp U+0541 (Ձ)
+	0x00, 0x20, 0x14, 0x05, 0x41, 0x10, 0x04, 0x03, 0x01,	// orp U+0542 (Ղ)
+	0x00, 0x80, 0x28, 0x84, 0xa2, 0x44, 0xd1, 0x07, 0x00,	// orp U+0543 (Ճ)
+	0x00, 0xd0, 0x55, 0x45, 0x51, 0x14, 0x85, 0x00, 0x00,	// orp U+0544 (Մ)
+	0x00, 0xe0, 0x44, 0x15, 0x43, 0x45, 0x91, 0x03, 0x00,	// orp U+0545 (Յ)
+	0x00, 0x20, 0x04, 0x83, 0x20, 0x08, 0x12, 0x03, 0x00,	// orp U+0546 (Ն)
+	0x00, 0x00, 0x3d, 0x42, 0x10, 0x45, 0x91, 0x03, 0x00,	// orp U+0547 (Շ)
+	0x00, 0xe0, 0x44, 0x51, 0x14, 0x45, 0x51, 0x04, 0x00,	// orp U+0548 (Ո)
+	0x00, 0xe0, 0x44, 0x51, 0xe4, 0x21, 0xc4, 0x07, 0x00,	// orp U+0549 (Չ)
+	0x00, 0xe0, 0x54, 0x55, 0x45, 0x51, 0x10, 0x04, 0x00,	// orp U+054A (Պ)
+	0x00, 0x60, 0x24, 0x89, 0xc2, 0x14, 0x4f, 0x04, 0x00,	// orp U+054B (Ջ)
+	0x00, 0x20, 0x14, 0x45, 0x53, 0x55, 0x45, 0x01, 0x00,	// orp U+054C (Ռ)
+	0x00, 0x10, 0x45, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+054D (Ս)
+	0x00, 0x40, 0x14, 0x45, 0x51, 0x18, 0x04, 0x03, 0x01,	// orp U+054E (Վ)
+	0x00, 0xe0, 0x44, 0x81, 0x03, 0x41, 0x91, 0x03, 0x00,	// orp U+054F (Տ)
+	0x00, 0xe0, 0x44, 0x51, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+0550 (Ր)
+	0x00, 0xe0, 0x44, 0x91, 0x13, 0x41, 0x91, 0x03, 0x00,	// orp U+0551 (Ց)
+	0x00, 0x10, 0x04, 0xc1, 0x91, 0x24, 0x51, 0x00, 0x00,	// orp U+0552 (Ւ)
+	0x00, 0x40, 0x38, 0x55, 0x55, 0x39, 0x04, 0x00, 0x00,	// orp U+0553 (Փ)
+	0x00, 0x80, 0x50, 0x14, 0x53, 0x38, 0x14, 0x01, 0x00,	// orp U+0554 (Ք)
+	0x00, 0xe0, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+0555 (Օ)
+	0x00, 0x20, 0x14, 0x85, 0x43, 0x55, 0x95, 0x03, 0x00,	// orp U+0556 (Ֆ)
+	0x84, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0559 (ՙ)
+	0x00, 0x83, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+055A (՚)
+	0x90, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+055C (՜)
+	0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+055D (՝)
+	0x80, 0x13, 0x55, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+055E (՞)
+	0xc0, 0x10, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+055F (՟)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x55, 0x95, 0x06, 0x00,	// orp U+0561 (ա)
+	0x00, 0x00, 0x00, 0xc0, 0x13, 0x45, 0xc1, 0x17, 0x04,	// orp U+0562 (բ)
+	0x00, 0x00, 0x00, 0x80, 0x93, 0x24, 0x89, 0x87, 0x20,	// orp U+0563 (գ)
+	0x00, 0x00, 0x00, 0x40, 0xb1, 0x24, 0x49, 0x86, 0x20,	// orp U+0564 (դ)
+	0x00, 0x10, 0x04, 0xc1, 0x17, 0x44, 0x53, 0x03, 0x00,	// orp U+0565 (ե)
+	0x00, 0x00, 0x00, 0x80, 0x93, 0x24, 0x89, 0x83, 0x60,	// orp U+0566 (զ)
+	0x00, 0x10, 0x04, 0xc1, 0x17, 0x04, 0x81, 0x03, 0x01,	// orp U+0567 (է)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x14, 0x7c,	// orp U+0568 (ը)
+	0x00, 0x00, 0x00, 0x40, 0xb1, 0x24, 0xdd, 0x52, 0x04,	// orp U+0569 (թ)
+	0x00, 0x10, 0x04, 0x41, 0xb1, 0x24, 0x49, 0x12, 0x04,	// orp U+056B (ի)
+	0x00, 0x00, 0x00, 0xc0, 0x20, 0x08, 0x82, 0x20, 0x30,	// orp U+056C (լ)
+	0x00, 0x00, 0x04, 0xc1, 0x55, 0x55, 0x55, 0x12, 0x04,	// orp U+056D (խ)
+	0x00, 0x10, 0x08, 0x84, 0x97, 0x24, 0x89, 0x01, 0x00,	// orp U+056E (ծ)
+	0x00, 0x10, 0x04, 0x41, 0x14, 0x45, 0x91, 0x07, 0x41,	// orp U+056F (կ)
+	0x00, 0x10, 0x04, 0x41, 0x33, 0x45, 0x51, 0x04, 0x00,	// orp U+0570 (հ)
+	0x00, 0x40, 0x08, 0x84, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+0571 (ձ)
+	0x00, 0x00, 0x00, 0x40, 0xb1, 0x24, 0x49, 0x82, 0x60,	// orp U+0572 (ղ)
+	0x00, 0xc0, 0x48, 0xc2, 0x27, 0x49, 0x1a, 0x05, 0x00,	// orp U+0573 (ճ)
+	0x00, 0x00, 0x21, 0x48, 0x92, 0x24, 0x8d, 0x02, 0x00,	// orp U+0574 (մ)
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x50, 0x14, 0x39,	// orp U+0575 (յ)
+	0x00, 0xe0, 0x44, 0x41, 0x16, 0x45, 0x99, 0x05, 0x00,	// orp U+0576 (ն)
+	0x00, 0x00, 0x00, 0x8c, 0x04, 0x41, 0x08, 0x21, 0x70,	// orp U+0577 (շ)
+	0x00, 0x40, 0x08, 0x04, 0x21, 0x08, 0xc1, 0x07, 0x00,	// orp U+0579 (չ)
+	0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x95, 0x06, 0x41,	// orp U+057A (պ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x0a, 0x21, 0x70,	// orp U+057B (ջ)
+	0x00, 0x00, 0x00, 0x40, 0xb1, 0x24, 0x49, 0x06, 0x00,	// orp U+057C (ռ)
+	0x00, 0x00, 0x20, 0x48, 0x92, 0x24, 0x89, 0x83, 0x60,	// orp U+057E (վ)
+	0x00, 0x00, 0x00, 0x40, 0x53, 0x55, 0x95, 0x05, 0x00,	// orp U+057F (տ)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x14, 0x04,	// orp U+0580 (ր)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x1e, 0x14, 0x39,	// orp U+0581 (ց)
+	0x00, 0x00, 0x00, 0x80, 0x20, 0x08, 0x02, 0x07, 0x00,	// orp U+0582 (ւ)
+	0x00, 0x40, 0x10, 0x44, 0x53, 0x55, 0x95, 0x45, 0x10,	// orp U+0583 (փ)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x49, 0x8e, 0xf0, 0x09,	// orp U+0584 (ք)
+	0x00, 0x60, 0x14, 0x85, 0x43, 0x51, 0x95, 0x43, 0x10,	// orp U+0586 (ֆ)
+	0x00, 0x00, 0x04, 0x41, 0x92, 0x24, 0x89, 0x05, 0x00,	// orp U+0587 (և)
+	0x00, 0x00, 0x00, 0x0c, 0x03, 0x30, 0x0c, 0x00, 0x00,	// orp U+0589 (։)
+	0x00, 0x00, 0x00, 0x80, 0xc0, 0x01, 0x00, 0x00, 0x00,	// orp U+058A (֊)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x28,	// orp U+0591 (֑)
+	0x00, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0592 (֒)
+	0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0594 (֔)
+	0x80, 0x22, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0595 (֕)
+	0x00, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0597 (֗)
+	0x80, 0x54, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0598 (֘)
+	0x40, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+0599 (֙)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81,	// orp U+059A (֚)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21,	// orp U+059B (֛)
+	0x00, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+059C (֜)
+	0x00, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+059D (֝)
+	0x08, 0x49, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+059E (֞)
+	0x80, 0x52, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+059F (֟)
+	0x00, 0x42, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05A0 (֠)
+	0x80, 0xb2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05A1 (֡)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x38,	// orp U+05A3 (֣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x10,	// orp U+05A4 (֤)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x25,	// orp U+05A6 (֦)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x10,	// orp U+05A7 (֧)
+	0x80, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05A8 (֨)
+	0x80, 0x50, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05A9 (֩)
+	0x00, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05AB (֫)
+	0x00, 0x82, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05AC (֬)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,	// orp U+05AD (֭)
+	0x88, 0x52, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05AE (֮)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10,	// orp U+05B0 (ְ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x48,	// orp U+05B1 (ֱ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x40,	// orp U+05B2 (ֲ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x48,	// orp U+05B3 (ֳ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11,	// orp U+05B6 (ֶ)
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05B9 (ֹ)
+	0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05BA (ֺ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,	// orp U+05BB (ֻ)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,	// orp U+05BC (ּ)
+	0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00,	// orp U+05BE (־)
+	0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05BF (ֿ)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+05C0 (׀)
+	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05C1 (ׁ)
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05C2 (ׂ)
+	0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x04, 0x01, 0x00,	// orp U+05C3 (׃)
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+05C4 (ׄ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18,	// orp U+05C5 (ׅ)
+	0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x82, 0x03, 0x00,	// orp U+05C6 (׆)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x43, 0x10,	// orp U+05C7 (ׇ)
+	0x00, 0x00, 0x00, 0x40, 0x22, 0x59, 0xc9, 0x04, 0x00,	// orp U+05D0 (א)
+	0x00, 0x00, 0x00, 0xc0, 0x83, 0x20, 0xc8, 0x07, 0x00,	// orp U+05D1 (ב)
+	0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x94, 0x04, 0x00,	// orp U+05D2 (ג)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x20, 0x08, 0x02, 0x00,	// orp U+05D3 (ד)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x41, 0x51, 0x04, 0x00,	// orp U+05D4 (ה)
+	0x00, 0x00, 0x00, 0x00, 0x83, 0x20, 0x08, 0x02, 0x00,	// orp U+05D5 (ו)
+	0x00, 0x00, 0x00, 0xc0, 0x47, 0x20, 0x08, 0x02, 0x00,	// orp U+05D6 (ז)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0x92, 0x04, 0x00,	// orp U+05D7 (ח)
+	0x00, 0x00, 0x00, 0x40, 0x56, 0x45, 0xd1, 0x07, 0x00,	// orp U+05D8 (ט)
+	0x00, 0x00, 0x00, 0x00, 0x83, 0x20, 0x00, 0x00, 0x00,	// orp U+05D9 (י)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x41, 0x10, 0x04, 0x41,	// orp U+05DA (ך)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x41, 0xd0, 0x03, 0x00,	// orp U+05DB (כ)
+	0x00, 0x10, 0x04, 0xc1, 0x07, 0x41, 0x88, 0x01, 0x00,	// orp U+05DC (ל)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0x92, 0x07, 0x00,	// orp U+05DD (ם)
+	0x00, 0x00, 0x00, 0x40, 0x52, 0x49, 0x51, 0x07, 0x00,	// orp U+05DE (מ)
+	0x00, 0x00, 0x00, 0x00, 0x83, 0x20, 0x08, 0x82, 0x20,	// orp U+05DF (ן)
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x41, 0x90, 0x07, 0x00,	// orp U+05E0 (נ)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0x8a, 0x01, 0x00,	// orp U+05E1 (ס)
+	0x00, 0x00, 0x00, 0xc0, 0x26, 0x49, 0xca, 0x01, 0x00,	// orp U+05E2 (ע)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0x10, 0x04, 0x41,	// orp U+05E3 (ף)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0xd0, 0x03, 0x00,	// orp U+05E4 (פ)
+	0x00, 0x00, 0x00, 0x40, 0x22, 0x49, 0x8a, 0x21, 0x08,	// orp U+05E5 (ץ)
+	0x00, 0x00, 0x00, 0x40, 0x22, 0x51, 0xc8, 0x07, 0x00,	// orp U+05E6 (צ)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x45, 0x51, 0x13, 0x04,	// orp U+05E7 (ק)
+	0x00, 0x00, 0x00, 0xc0, 0x03, 0x41, 0x10, 0x04, 0x00,	// orp U+05E8 (ר)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x5d, 0xd1, 0x03, 0x00,	// orp U+05E9 (ש)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x49, 0xd2, 0x04, 0x00,	// orp U+05EA (ת)
+	0x00, 0x00, 0x00, 0xc0, 0x26, 0x49, 0x92, 0x04, 0x00,	// orp U+05F0 (װ)
+	0x00, 0x00, 0x00, 0xc0, 0x26, 0x49, 0x10, 0x04, 0x00,	// orp U+05F1 (ױ)
+	0x00, 0x00, 0x00, 0xc0, 0x26, 0x49, 0x00, 0x00, 0x00,	// orp U+05F2 (ײ)
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00,	// orp U+05F3 (׳)
+	0x00, 0x00, 0x00, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00,	// orp U+05F4 (״)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00,	// orp U+1680 ( )
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x43, 0x10, 0x04, 0x00,	// orp U+1681 (ᚁ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x53, 0x14, 0x05, 0x00,	// orp U+1682 (ᚂ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x73, 0x1c, 0x07, 0x00,	// orp U+1683 (ᚃ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x7b, 0x9e, 0x07, 0x00,	// orp U+1684 (ᚄ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x7f, 0xdf, 0x07, 0x00,	// orp U+1685 (ᚅ)
+	0x00, 0x00, 0x40, 0x10, 0xf4, 0x03, 0x00, 0x00, 0x00,	// orp U+1686 (ᚆ)
+	0x00, 0x00, 0x50, 0x14, 0xf5, 0x03, 0x00, 0x00, 0x00,	// orp U+1687 (ᚇ)
+	0x00, 0x00, 0x70, 0x1c, 0xf7, 0x03, 0x00, 0x00, 0x00,	// orp U+1688 (ᚈ)
+	0x00, 0x00, 0x78, 0x9e, 0xf7, 0x03, 0x00, 0x00, 0x00,	// orp U+1689 (ᚉ)
+	0x00, 0x00, 0x7c, 0xdf, 0xf7, 0x03, 0x00, 0x00, 0x00,	// orp U+168A (ᚊ)
+	0x00, 0x00, 0x20, 0x08, 0xf2, 0x13, 0x04, 0x01, 0x00,	// orp U+168B (ᚋ)
+	0x00, 0x00, 0x50, 0x14, 0xf5, 0x2b, 0x8a, 0x02, 0x00,	// orp U+168C (ᚌ)
+	0x00, 0x00, 0x70, 0x1c, 0xf7, 0x3b, 0x8e, 0x03, 0x00,	// orp U+168D (ᚍ)
+	0x00, 0x00, 0xf0, 0x3c, 0xff, 0x7b, 0x9e, 0x07, 0x00,	// orp U+168E (ᚎ)
+	0x00, 0x00, 0xf8, 0xbe, 0xff, 0x7f, 0xdf, 0x07, 0x00,	// orp U+168F (ᚏ)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x23, 0x00, 0x00, 0x00,	// orp U+1690 (ᚐ)
+	0x00, 0x00, 0x00, 0x00, 0xf5, 0x53, 0x00, 0x00, 0x00,	// orp U+1691 (ᚑ)
+	0x00, 0x00, 0x00, 0x00, 0xf7, 0x73, 0x00, 0x00, 0x00,	// orp U+1692 (ᚒ)
+	0x00, 0x00, 0x00, 0x80, 0xf7, 0x7b, 0x00, 0x00, 0x00,	// orp U+1693 (ᚓ)
+	0x00, 0x00, 0x00, 0xc0, 0xf7, 0x7f, 0x00, 0x00, 0x00,	// orp U+1694 (ᚔ)
+	0x00, 0x00, 0x50, 0x14, 0xf2, 0x23, 0x14, 0x05, 0x00,	// orp U+1695 (ᚕ)
+	0x00, 0x00, 0x30, 0x52, 0xf8, 0x87, 0x12, 0x03, 0x00,	// orp U+1696 (ᚖ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x9a, 0xe4, 0x01,	// orp U+1697 (ᚗ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x6f, 0xce, 0x06, 0x00,	// orp U+1698 (ᚘ)
+	0x00, 0xe5, 0x53, 0x3e, 0xe5, 0x03, 0x00, 0x00, 0x00,	// orp U+1699 (ᚙ)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x1e, 0x00, 0x00,	// orp U+169A (ᚚ)
+	0x00, 0x00, 0x04, 0x02, 0x81, 0x13, 0x42, 0x00, 0x00,	// orp U+169B (᚛)
+	0x00, 0x00, 0x00, 0x20, 0xf4, 0x40, 0x20, 0x00, 0x00,	// orp U+169C (᚜)
+	0x80, 0xa4, 0x18, 0x92, 0x62, 0x08, 0x82, 0x00, 0x00,	// orp U+16A0 (ᚠ)
+	0x88, 0x20, 0x29, 0x86, 0xa4, 0x18, 0x82, 0x00, 0x00,	// orp U+16A1 (ᚡ)
+	0x40, 0x30, 0x14, 0x49, 0x14, 0x45, 0x51, 0x04, 0x00,	// orp U+16A2 (ᚢ)
+	0x40, 0x30, 0x14, 0x49, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+16A3 (ᚣ)
+	0x40, 0x30, 0x14, 0x49, 0x54, 0x45, 0x51, 0x04, 0x00,	// orp U+16A4 (ᚤ)
+	0x40, 0x30, 0x14, 0xc9, 0x54, 0x55, 0x55, 0x05, 0x00,	// orp U+16A5 (ᚥ)
+	0x80, 0x20, 0x18, 0x8a, 0xa4, 0x18, 0x82, 0x00, 0x00,	// orp U+16A6 (ᚦ)
+	0x80, 0x20, 0x18, 0x8a, 0xa5, 0x18, 0x82, 0x00, 0x00,	// orp U+16A7 (ᚧ)
+	0x80, 0x60, 0x28, 0x92, 0xa1, 0x48, 0x82, 0x00, 0x00,	// orp U+16A8 (ᚨ)
+	0xc0, 0xd4, 0x04, 0x53, 0x13, 0x04, 0x41, 0x00, 0x00,	// orp U+16A9 (ᚩ)
+	0x40, 0xb4, 0x14, 0xc1, 0xd0, 0x04, 0x41, 0x00, 0x00,	// orp U+16AA (ᚪ)
+	0x00, 0x51, 0x18, 0x4c, 0x65, 0x30, 0x14, 0x01, 0x00,	// orp U+16AC (ᚬ)
+	0x80, 0x20, 0x08, 0x86, 0x22, 0x18, 0x8a, 0x00, 0x00,	// orp U+16AD (ᚭ)
+	0x00, 0x41, 0x10, 0x46, 0x41, 0x18, 0x05, 0x01, 0x00,	// orp U+16AE (ᚮ)
+	0x00, 0x41, 0x31, 0x46, 0xc5, 0x18, 0x05, 0x01, 0x00,	// orp U+16AF (ᚯ)
+	0x00, 0x41, 0x31, 0x46, 0x41, 0x18, 0x05, 0x01, 0x00,	// orp U+16B0 (ᚰ)
+	0xc0, 0xd0, 0x44, 0xcd, 0x50, 0x24, 0x51, 0x00, 0x00,	// orp U+16B1 (ᚱ)
+	0x00, 0x00, 0x21, 0x84, 0x40, 0x20, 0x10, 0x00, 0x00,	// orp U+16B2 (ᚲ)
+	0x40, 0x10, 0x04, 0x41, 0x30, 0x14, 0x49, 0x04, 0x00,	// orp U+16B3 (ᚳ)
+	0x40, 0x94, 0x14, 0x43, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+16B4 (ᚴ)
+	0x44, 0x94, 0x14, 0x43, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+16B5 (ᚵ)
+	0x80, 0x28, 0x29, 0x87, 0x20, 0x08, 0x82, 0x00, 0x00,	// orp U+16B6 (ᚶ)
+	0x40, 0x14, 0x29, 0x0a, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+16B7 (ᚷ)
+	0x40, 0x14, 0x29, 0x4a, 0xa5, 0x28, 0x51, 0x04, 0x00,	// orp U+16B8 (ᚸ)
+	0xc0, 0xd0, 0x44, 0xcd, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+16B9 (ᚹ)
+	0x40, 0x14, 0x45, 0x53, 0x95, 0x45, 0x51, 0x04, 0x00,	// orp U+16BA (ᚺ)
+	0x40, 0x14, 0x4d, 0xd5, 0x56, 0x65, 0x51, 0x04, 0x00,	// orp U+16BB (ᚻ)
+	0x00, 0x41, 0x54, 0x0e, 0xe1, 0x54, 0x04, 0x01, 0x00,	// orp U+16BC (ᚼ)
+	0x00, 0x41, 0x10, 0x8e, 0xe3, 0x10, 0x04, 0x01, 0x00,	// orp U+16BD (ᚽ)
+	0x00, 0x41, 0x14, 0x06, 0xc1, 0x50, 0x04, 0x01, 0x00,	// orp U+16BE (ᚾ)
+	0x00, 0x41, 0x10, 0x04, 0x43, 0x11, 0x04, 0x01, 0x00,	// orp U+16BF (ᚿ)
+	0x00, 0x41, 0x14, 0x8e, 0xe3, 0x50, 0x04, 0x01, 0x00,	// orp U+16C0 (ᛀ)
+	0x00, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16C1 (ᛁ)
+	0x00, 0x00, 0x00, 0x84, 0x90, 0x48, 0x08, 0x01, 0x00,	// orp U+16C3 (ᛃ)
+	0x00, 0x41, 0x10, 0x4e, 0xe5, 0x10, 0x04, 0x01, 0x00,	// orp U+16C4 (ᛄ)
+	0x00, 0x41, 0x50, 0x0c, 0x61, 0x14, 0x04, 0x01, 0x00,	// orp U+16C5 (ᛅ)
+	0x00, 0x41, 0x10, 0x04, 0x61, 0x14, 0x04, 0x01, 0x00,	// orp U+16C6 (ᛆ)
+	0x00, 0xc1, 0x50, 0x04, 0x41, 0x14, 0x06, 0x01, 0x00,	// orp U+16C7 (ᛇ)
+	0x40, 0xb4, 0x14, 0x41, 0x10, 0x14, 0x4b, 0x04, 0x00,	// orp U+16C8 (ᛈ)
+	0x40, 0xe5, 0x10, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16C9 (ᛉ)
+	0x00, 0x42, 0x08, 0x04, 0x42, 0x08, 0x04, 0x02, 0x00,	// orp U+16CA (ᛊ)
+	0x40, 0x10, 0x44, 0x59, 0x35, 0x45, 0x10, 0x04, 0x00,	// orp U+16CB (ᛋ)
+	0x00, 0x41, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+16CC (ᛌ)
+	0x00, 0x41, 0x10, 0x84, 0xe3, 0x38, 0x00, 0x00, 0x00,	// orp U+16CD (ᛍ)
+	0x00, 0x41, 0x10, 0x95, 0x43, 0x00, 0x00, 0x00, 0x00,	// orp U+16CE (ᛎ)
+	0x00, 0xe1, 0x54, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16CF (ᛏ)
+	0x00, 0xc2, 0x28, 0x08, 0x82, 0x20, 0x08, 0x02, 0x00,	// orp U+16D0 (ᛐ)
+	0x00, 0xc2, 0x28, 0x08, 0xc2, 0x71, 0x08, 0x02, 0x00,	// orp U+16D1 (ᛑ)
+	0xc0, 0x50, 0x24, 0xc5, 0x50, 0x24, 0xc5, 0x00, 0x00,	// orp U+16D2 (ᛒ)
+	0x00, 0x41, 0x50, 0x0c, 0x41, 0x31, 0x04, 0x01, 0x00,	// orp U+16D3 (ᛓ)
+	0xc0, 0x13, 0x55, 0xd1, 0x13, 0x55, 0xd1, 0x03, 0x00,	// orp U+16D4 (ᛔ)
+	0x40, 0x94, 0x14, 0x43, 0x30, 0x14, 0x49, 0x04, 0x00,	// orp U+16D5 (ᛕ)
+	0x40, 0xb4, 0x55, 0x51, 0x14, 0x45, 0x51, 0x04, 0x00,	// orp U+16D6 (ᛖ)
+	0x40, 0xb4, 0x55, 0x5b, 0x14, 0x45, 0x51, 0x04, 0x00,	// orp U+16D7 (ᛗ)
+	0x40, 0x55, 0x39, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16D8 (ᛘ)
+	0x80, 0xe3, 0x38, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16D9 (ᛙ)
+	0x00, 0xc1, 0x50, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16DA (ᛚ)
+	0x00, 0xc1, 0x50, 0x84, 0xe3, 0x10, 0x04, 0x01, 0x00,	// orp U+16DB (ᛛ)
+	0x00, 0x00, 0x10, 0x4a, 0xa4, 0x10, 0x00, 0x00, 0x00,	// orp U+16DC (ᛜ)
+	0x40, 0xa4, 0x10, 0x4a, 0xa4, 0x10, 0x4a, 0x04, 0x00,	// orp U+16DD (ᛝ)
+	0x40, 0xb4, 0x6d, 0x55, 0x55, 0x6d, 0x5b, 0x04, 0x00,	// orp U+16DE (ᛞ)
+	0x00, 0xa1, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x00,	// orp U+16DF (ᛟ)
+	0xc0, 0xe7, 0x10, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+16E0 (ᛠ)
+	0x00, 0xc5, 0x10, 0x04, 0x41, 0x10, 0x46, 0x01, 0x00,	// orp U+16E2 (ᛢ)
+	0x00, 0x41, 0x10, 0x04, 0x41, 0x10, 0x4e, 0x05, 0x00,	// orp U+16E3 (ᛣ)
+	0x40, 0x55, 0x39, 0x55, 0x55, 0x39, 0x55, 0x05, 0x00,	// orp U+16E4 (ᛤ)
+	0x40, 0xb4, 0x55, 0x5b, 0xb4, 0x55, 0x5b, 0x04, 0x00,	// orp U+16E5 (ᛥ)
+	0x00, 0x41, 0x10, 0x04, 0x41, 0x38, 0x55, 0x05, 0x00,	// orp U+16E6 (ᛦ)
+	0x00, 0xe1, 0x54, 0x04, 0x41, 0x54, 0x0e, 0x01, 0x00,	// orp U+16E8 (ᛨ)
+	0x00, 0x66, 0x45, 0x16, 0x06, 0x41, 0x10, 0x04, 0x00,	// orp U+16E9 (ᛩ)
+	0x80, 0x70, 0x08, 0x8a, 0xa3, 0x20, 0x1c, 0x02, 0x00,	// orp U+16EA (ᛪ)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+16EB (᛫)
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,	// orp U+16EC (᛬)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x00, 0x00, 0x00,	// orp U+16ED (᛭)
+	0x00, 0xc1, 0x50, 0x84, 0x51, 0x10, 0x04, 0x01, 0x00,	// orp U+16EE (ᛮ)
+	0x40, 0x55, 0x39, 0x04, 0x41, 0x38, 0x55, 0x05, 0x00,	// orp U+16EF (ᛯ)
+	0x00, 0x41, 0x38, 0x55, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+16F0 (ᛰ)
+	0x00, 0x01, 0x3c, 0x92, 0xe4, 0x48, 0xd2, 0x03, 0x00,	// orp U+1E02 (Ḃ)
+	0x00, 0x01, 0x04, 0xc1, 0x13, 0x45, 0xd1, 0x03, 0x00,	// orp U+1E03 (ḃ)
+	0x00, 0x00, 0x3c, 0x92, 0xe4, 0x48, 0xd2, 0x03, 0x10,	// orp U+1E04 (Ḅ)
+	0x00, 0x00, 0x04, 0xc1, 0x13, 0x45, 0xd1, 0x03, 0x10,	// orp U+1E05 (ḅ)
+	0x00, 0x00, 0x3c, 0x92, 0xe4, 0x48, 0xd2, 0x03, 0x7c,	// orp U+1E06 (Ḇ)
+	0x00, 0x00, 0x04, 0xc1, 0x13, 0x45, 0xd1, 0x03, 0x7c,	// orp U+1E07 (ḇ)
+	0x00, 0x01, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x03, 0x00,	// orp U+1E0A (Ḋ)
+	0x00, 0x01, 0x40, 0x90, 0x17, 0x45, 0x91, 0x07, 0x00,	// orp U+1E0B (ḋ)
+	0x00, 0x00, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x03, 0x10,	// orp U+1E0C (Ḍ)
+	0x00, 0x00, 0x40, 0x90, 0x17, 0x45, 0x91, 0x07, 0x10,	// orp U+1E0D (ḍ)
+	0x00, 0x00, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x03, 0x7c,	// orp U+1E0E (Ḏ)
+	0x00, 0x00, 0x40, 0x90, 0x17, 0x45, 0x91, 0x07, 0x7c,	// orp U+1E0F (ḏ)
+	0x00, 0x00, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x43, 0x08,	// orp U+1E10 (Ḑ)
+	0x00, 0x00, 0x40, 0x90, 0x17, 0x45, 0x91, 0x47, 0x08,	// orp U+1E11 (ḑ)
+	0x00, 0xf0, 0x48, 0x92, 0x24, 0x49, 0x0f, 0x40, 0x28,	// orp U+1E12 (Ḓ)
+	0x00, 0x00, 0x41, 0x5e, 0x14, 0x45, 0x1e, 0x40, 0x28,	// orp U+1E13 (ḓ)
+	0x00, 0x01, 0x7c, 0x41, 0xf0, 0x04, 0x41, 0x00, 0x00,	// orp U+1E1E (Ḟ)
+	0x00, 0x01, 0x30, 0x92, 0x70, 0x08, 0x82, 0x00, 0x00,	// orp U+1E1F (ḟ)
+	0x00, 0x42, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x04, 0x00,	// orp U+1E31 (ḱ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x10,	// orp U+1E32 (Ḳ)
+	0x00, 0x00, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x04, 0x10,	// orp U+1E33 (ḳ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x04, 0x7c,	// orp U+1E34 (Ḵ)
+	0x00, 0x00, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x04, 0x7c,	// orp U+1E35 (ḵ)
+	0x08, 0x01, 0x44, 0x5b, 0x15, 0x45, 0x51, 0x04, 0x00,	// orp U+1E3E (Ḿ)
+	0x00, 0x80, 0x10, 0xc0, 0x52, 0x55, 0x55, 0x05, 0x00,	// orp U+1E3F (ḿ)
+	0x00, 0x01, 0x44, 0x5b, 0x15, 0x45, 0x51, 0x04, 0x00,	// orp U+1E40 (Ṁ)
+	0x00, 0x00, 0x10, 0xc0, 0x52, 0x55, 0x55, 0x05, 0x00,	// orp U+1E41 (ṁ)
+	0x00, 0x00, 0x44, 0x5b, 0x15, 0x45, 0x51, 0x04, 0x10,	// orp U+1E42 (Ṃ)
+	0x00, 0x00, 0x00, 0xc0, 0x52, 0x55, 0x55, 0x05, 0x10,	// orp U+1E43 (ṃ)
+	0x08, 0x01, 0x3c, 0x51, 0xf4, 0x04, 0x41, 0x00, 0x00,	// orp U+1E54 (Ṕ)
+	0x00, 0x80, 0x10, 0xc0, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+1E55 (ṕ)
+	0x00, 0x01, 0x3c, 0x51, 0xf4, 0x04, 0x41, 0x00, 0x00,	// orp U+1E56 (Ṗ)
+	0x00, 0x00, 0x10, 0xc0, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+1E57 (ṗ)
+	0x00, 0x01, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+1E60 (Ṡ)
+	0x00, 0x00, 0x10, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+1E61 (ṡ)
+	0x00, 0x00, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x10,	// orp U+1E62 (Ṣ)
+	0x00, 0x00, 0x00, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x10,	// orp U+1E63 (ṣ)
+	0x12, 0x02, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+1E64 (Ṥ)
+	0x00, 0x20, 0x21, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+1E65 (ṥ)
+	0x04, 0xa0, 0x10, 0x5e, 0xe0, 0x40, 0x91, 0x03, 0x00,	// orp U+1E66 (Ṧ)
+	0x04, 0xa0, 0x10, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x00,	// orp U+1E67 (ṧ)
+	0x00, 0x01, 0x38, 0x51, 0xe0, 0x40, 0x91, 0x03, 0x10,	// orp U+1E68 (Ṩ)
+	0x00, 0x00, 0x10, 0x80, 0x17, 0x38, 0xd0, 0x03, 0x10,	// orp U+1E69 (ṩ)
+	0x00, 0x01, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+1E6A (Ṫ)
+	0x00, 0x01, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x00,	// orp U+1E6B (ṫ)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x10,	// orp U+1E6C (Ṭ)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x10,	// orp U+1E6D (ṭ)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x7c,	// orp U+1E6E (Ṯ)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x06, 0x7c,	// orp U+1E6F (ṯ)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x40, 0x28,	// orp U+1E70 (Ṱ)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x18, 0x40, 0x28,	// orp U+1E71 (ṱ)
+	0x02, 0x01, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E80 (Ẁ)
+	0x00, 0x20, 0x10, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E81 (ẁ)
+	0x08, 0x01, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E82 (Ẃ)
+	0x00, 0x80, 0x10, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E83 (ẃ)
+	0x80, 0x02, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E84 (Ẅ)
+	0x00, 0x00, 0x28, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E85 (ẅ)
+	0x00, 0x01, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E86 (Ẇ)
+	0x00, 0x00, 0x10, 0x40, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+1E87 (ẇ)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x55, 0x95, 0x02, 0x10,	// orp U+1E88 (Ẉ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x55, 0x95, 0x02, 0x10,	// orp U+1E89 (ẉ)
+	0x00, 0x01, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x00,	// orp U+1E8A (Ẋ)
+	0x00, 0x00, 0x10, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x00,	// orp U+1E8B (ẋ)
+	0x80, 0x02, 0x44, 0x91, 0x42, 0x28, 0x51, 0x04, 0x00,	// orp U+1E8C (Ẍ)
+	0x00, 0x00, 0x28, 0x40, 0xa4, 0x10, 0x4a, 0x04, 0x00,	// orp U+1E8D (ẍ)
+	0x00, 0x01, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1E8E (Ẏ)
+	0x00, 0x00, 0x10, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+1E8F (ẏ)
+	0x02, 0x01, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1EF2 (Ỳ)
+	0x00, 0x20, 0x10, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+1EF3 (ỳ)
+	0x00, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x10,	// orp U+1EF4 (Ỵ)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x44,	// orp U+1EF5 (ỵ)
+	0x84, 0x82, 0x10, 0x51, 0xa4, 0x10, 0x04, 0x01, 0x00,	// orp U+1EF6 (Ỷ)
+	0x84, 0x82, 0x10, 0x44, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+1EF7 (ỷ)
+	0x56, 0x03, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1EF8 (Ỹ)
+	0x00, 0x60, 0x35, 0x40, 0x14, 0x45, 0x0a, 0x21, 0x04,	// orp U+1EF9 (ỹ)
+	0x00, 0x60, 0x10, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F00 (ἀ)
+	0x00, 0xc0, 0x10, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F01 (ἁ)
+	0x00, 0xb0, 0x48, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F02 (ἂ)
+	0x00, 0xb0, 0x44, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F03 (ἃ)
+	0x00, 0x30, 0x29, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F04 (ἄ)
+	0x00, 0x30, 0x25, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F05 (ἅ)
+	0x56, 0x03, 0x30, 0x08, 0x60, 0x25, 0x89, 0x05, 0x00,	// orp U+1F06 (ἆ)
+	0x56, 0x03, 0x30, 0x04, 0x60, 0x25, 0x89, 0x05, 0x00,	// orp U+1F07 (ἇ)
+	0x83, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F08 (Ἀ)
+	0x43, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F09 (Ἁ)
+	0x8b, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F0A (Ἂ)
+	0x4b, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F0B (Ἃ)
+	0x93, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F0C (Ἄ)
+	0x53, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F0D (Ἅ)
+	0x56, 0x03, 0x0c, 0x01, 0x23, 0x79, 0x92, 0x04, 0x00,	// orp U+1F0E (Ἆ)
+	0x56, 0x03, 0x0c, 0x02, 0x23, 0x79, 0x92, 0x04, 0x00,	// orp U+1F0F (Ἇ)
+	0x00, 0x60, 0x10, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F10 (ἐ)
+	0x00, 0xc0, 0x10, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F11 (ἑ)
+	0x00, 0xb0, 0x48, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F12 (ἒ)
+	0x00, 0xb0, 0x44, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F13 (ἓ)
+	0x00, 0x30, 0x29, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F14 (ἔ)
+	0x00, 0x30, 0x25, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F15 (ἕ)
+	0x83, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F18 (Ἐ)
+	0x43, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F19 (Ἑ)
+	0x8b, 0x04, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F1A (Ἒ)
+	0x4b, 0x04, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F1B (Ἓ)
+	0x93, 0x02, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F1C (Ἔ)
+	0x53, 0x02, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1F1D (Ἕ)
+	0x00, 0x60, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F20 (ἠ)
+	0x00, 0xc0, 0x10, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F21 (ἡ)
+	0x00, 0xb0, 0x48, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F22 (ἢ)
+	0x00, 0xb0, 0x44, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F23 (ἣ)
+	0x00, 0x30, 0x29, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F24 (ἤ)
+	0x00, 0x30, 0x25, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F25 (ἥ)
+	0x56, 0x03, 0x30, 0x08, 0xd0, 0x4c, 0x51, 0x04, 0x41,	// orp U+1F26 (ἦ)
+	0x56, 0x03, 0x30, 0x04, 0xd0, 0x4c, 0x51, 0x04, 0x41,	// orp U+1F27 (ἧ)
+	0x83, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F28 (Ἠ)
+	0x43, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F29 (Ἡ)
+	0x8b, 0x04, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F2A (Ἢ)
+	0x4b, 0x04, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F2B (Ἣ)
+	0x93, 0x02, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F2C (Ἤ)
+	0x53, 0x02, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1F2D (Ἥ)
+	0x56, 0x03, 0x0c, 0x01, 0x45, 0x71, 0x14, 0x05, 0x00,	// orp U+1F2E (Ἦ)
+	0x56, 0x03, 0x0c, 0x02, 0x45, 0x71, 0x14, 0x05, 0x00,	// orp U+1F2F (Ἧ)
+	0x00, 0x60, 0x10, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F30 (ἰ)
+	0x00, 0x60, 0x08, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F31 (ἱ)
+	0x00, 0xb0, 0x48, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F32 (ἲ)
+	0x00, 0xb0, 0x44, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F33 (ἳ)
+	0x00, 0x30, 0x29, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F34 (ἴ)
+	0x00, 0x30, 0x25, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F35 (ἵ)
+	0x56, 0x03, 0x30, 0x88, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F36 (ἶ)
+	0x56, 0x03, 0x30, 0x84, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1F37 (ἷ)
+	0x83, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F38 (Ἰ)
+	0x43, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F39 (Ἱ)
+	0x8b, 0x04, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F3A (Ἲ)
+	0x4b, 0x04, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F3B (Ἳ)
+	0x93, 0x02, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F3C (Ἴ)
+	0x53, 0x02, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1F3D (Ἵ)
+	0x56, 0x03, 0x0c, 0x39, 0x04, 0x41, 0x10, 0x0e, 0x00,	// orp U+1F3E (Ἶ)
+	0x56, 0x03, 0x0c, 0x3a, 0x04, 0x41, 0x10, 0x0e, 0x00,	// orp U+1F3F (Ἷ)
+	0x00, 0x60, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F40 (ὀ)
+	0x00, 0xc0, 0x10, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F41 (ὁ)
+	0x00, 0xb0, 0x48, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F42 (ὂ)
+	0x00, 0xb0, 0x44, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F43 (ὃ)
+	0x00, 0x30, 0x29, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F44 (ὄ)
+	0x00, 0x30, 0x25, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F45 (ὅ)
+	0x83, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F48 (Ὀ)
+	0x43, 0x00, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F49 (Ὁ)
+	0x8b, 0x04, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F4A (Ὂ)
+	0x4b, 0x04, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F4B (Ὃ)
+	0x93, 0x02, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F4C (Ὄ)
+	0x53, 0x02, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1F4D (Ὅ)
+	0x00, 0x60, 0x10, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F50 (ὐ)
+	0x00, 0xc0, 0x10, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F51 (ὑ)
+	0x00, 0xb0, 0x48, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F52 (ὒ)
+	0x00, 0xb0, 0x44, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F53 (ὓ)
+	0x00, 0x30, 0x29, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F54 (ὔ)
+	0x00, 0x30, 0x25, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F55 (ὕ)
+	0x56, 0x03, 0x30, 0x08, 0x90, 0x44, 0x91, 0x03, 0x00,	// orp U+1F56 (ὖ)
+	0x56, 0x03, 0x30, 0x04, 0x90, 0x44, 0x91, 0x03, 0x00,	// orp U+1F57 (ὗ)
+	0x43, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1F59 (Ὑ)
+	0x4b, 0x04, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1F5B (Ὓ)
+	0x53, 0x02, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1F5D (Ὕ)
+	0x56, 0x03, 0x0c, 0x2a, 0x8a, 0x42, 0x10, 0x04, 0x00,	// orp U+1F5F (Ὗ)
+	0x00, 0x60, 0x10, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F60 (ὠ)
+	0x00, 0xc0, 0x10, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F61 (ὡ)
+	0x00, 0xb0, 0x48, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F62 (ὢ)
+	0x00, 0xb0, 0x44, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F63 (ὣ)
+	0x00, 0x30, 0x29, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F64 (ὤ)
+	0x00, 0x30, 0x25, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F65 (ὥ)
+	0x56, 0x03, 0x30, 0x08, 0xa0, 0x44, 0x95, 0x02, 0x00,	// orp U+1F66 (ὦ)
+	0x56, 0x03, 0x30, 0x04, 0xa0, 0x44, 0x95, 0x02, 0x00,	// orp U+1F67 (ὧ)
+	0x83, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F68 (Ὠ)
+	0x43, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F69 (Ὡ)
+	0x8b, 0x04, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F6A (Ὢ)
+	0x4b, 0x04, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F6B (Ὣ)
+	0x93, 0x02, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F6C (Ὤ)
+	0x53, 0x02, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1F6D (Ὥ)
+	0x56, 0x03, 0x0c, 0x01, 0x27, 0x8a, 0x22, 0x65, 0x03,	// orp U+1F6E (Ὦ)
+	0x56, 0x03, 0x0c, 0x02, 0x27, 0x8a, 0x22, 0x65, 0x03,	// orp U+1F6F (Ὧ)
+	0x00, 0x40, 0x20, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1F70 (ὰ)
+	0x00, 0x40, 0x20, 0x80, 0x13, 0x19, 0x91, 0x03, 0x00,	// orp U+1F72 (ὲ)
+	0x00, 0x40, 0x20, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1F74 (ὴ)
+	0x00, 0x20, 0x10, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1F76 (ὶ)
+	0x00, 0x80, 0x10, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1F77 (ί)
+	0x00, 0x40, 0x20, 0x80, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+1F78 (ὸ)
+	0x00, 0x40, 0x20, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1F7A (ὺ)
+	0x00, 0x40, 0x20, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1F7C (ὼ)
+	0x80, 0x41, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F80 (ᾀ)
+	0x00, 0x43, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F81 (ᾁ)
+	0xc0, 0x22, 0x01, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F82 (ᾂ)
+	0xc0, 0x12, 0x01, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F83 (ᾃ)
+	0xc0, 0xa4, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F84 (ᾄ)
+	0xc0, 0x94, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1F85 (ᾅ)
+	0x56, 0x83, 0x10, 0x80, 0x95, 0x24, 0x16, 0x40, 0x20,	// orp U+1F86 (ᾆ)
+	0x56, 0x43, 0x20, 0x80, 0x95, 0x24, 0x16, 0x40, 0x20,	// orp U+1F87 (ᾇ)
+	0x83, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F88 (ᾈ)
+	0x43, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F89 (ᾉ)
+	0x8b, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F8A (ᾊ)
+	0x4b, 0x04, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F8B (ᾋ)
+	0x93, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F8C (ᾌ)
+	0x53, 0x02, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F8D (ᾍ)
+	0x56, 0x03, 0x0c, 0x02, 0x23, 0x79, 0x92, 0x44, 0x20,	// orp U+1F8E (ᾎ)
+	0x56, 0x03, 0x0c, 0x01, 0x23, 0x79, 0x92, 0x44, 0x20,	// orp U+1F8F (ᾏ)
+	0x80, 0x41, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F90 (ᾐ)
+	0x00, 0x43, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F91 (ᾑ)
+	0xc0, 0x22, 0x01, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F92 (ᾒ)
+	0xc0, 0x12, 0x01, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F93 (ᾓ)
+	0xc0, 0xa4, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F94 (ᾔ)
+	0xc0, 0x94, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1F95 (ᾕ)
+	0x56, 0x83, 0x10, 0x40, 0x33, 0x45, 0x11, 0x14, 0x09,	// orp U+1F96 (ᾖ)
+	0x56, 0x43, 0x20, 0x40, 0x33, 0x45, 0x11, 0x14, 0x09,	// orp U+1F97 (ᾗ)
+	0x83, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F98 (ᾘ)
+	0x43, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F99 (ᾙ)
+	0x8b, 0x04, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F9A (ᾚ)
+	0x4b, 0x04, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F9B (ᾛ)
+	0x93, 0x02, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F9C (ᾜ)
+	0x53, 0x02, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1F9D (ᾝ)
+	0x56, 0x03, 0x0c, 0x02, 0x45, 0x71, 0x14, 0x45, 0x20,	// orp U+1F9E (ᾞ)
+	0x56, 0x03, 0x0c, 0x01, 0x45, 0x71, 0x14, 0x45, 0x20,	// orp U+1F9F (ᾟ)
+	0x80, 0x41, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA0 (ᾠ)
+	0x00, 0x43, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA1 (ᾡ)
+	0xc0, 0x22, 0x01, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA2 (ᾢ)
+	0xc0, 0x12, 0x01, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA3 (ᾣ)
+	0xc0, 0xa4, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA4 (ᾤ)
+	0xc0, 0x94, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA5 (ᾥ)
+	0x56, 0x83, 0x10, 0x80, 0x12, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA6 (ᾦ)
+	0x56, 0x43, 0x20, 0x80, 0x12, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FA7 (ᾧ)
+	0x83, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FA8 (ᾨ)
+	0x43, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FA9 (ᾩ)
+	0x8b, 0x04, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FAA (ᾪ)
+	0x4b, 0x04, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FAB (ᾫ)
+	0x93, 0x02, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FAC (ᾬ)
+	0x53, 0x02, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FAD (ᾭ)
+	0x56, 0x03, 0x0c, 0x02, 0x27, 0x8a, 0x94, 0x8d, 0x40,	// orp U+1FAE (ᾮ)
+	0x56, 0x03, 0x0c, 0x01, 0x27, 0x8a, 0x94, 0x8d, 0x40,	// orp U+1FAF (ᾯ)
+	0x00, 0x10, 0x39, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1FB0 (ᾰ)
+	0x00, 0x00, 0x7c, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1FB1 (ᾱ)
+	0x80, 0x40, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1FB2 (ᾲ)
+	0x00, 0x00, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1FB3 (ᾳ)
+	0x00, 0x42, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1FB4 (ᾴ)
+	0x00, 0x60, 0x35, 0x80, 0x95, 0x24, 0x89, 0x05, 0x00,	// orp U+1FB6 (ᾶ)
+	0x80, 0xd5, 0x00, 0x56, 0x92, 0x24, 0x16, 0x40, 0x20,	// orp U+1FB7 (ᾷ)
+	0xc0, 0x07, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1FB9 (Ᾱ)
+	0x81, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1FBA (Ὰ)
+	0x00, 0x00, 0x38, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1FBC (ᾼ)
+	0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FBD (᾽)
+	0x56, 0x03, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FC1 (῁)
+	0x80, 0x40, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1FC2 (ῂ)
+	0x00, 0x00, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1FC3 (ῃ)
+	0x00, 0x42, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1FC4 (ῄ)
+	0x00, 0x60, 0x35, 0x40, 0x33, 0x45, 0x51, 0x04, 0x41,	// orp U+1FC6 (ῆ)
+	0x80, 0xd5, 0x00, 0xcd, 0x14, 0x45, 0x11, 0x14, 0x09,	// orp U+1FC7 (ῇ)
+	0x81, 0x00, 0x7c, 0x41, 0xf0, 0x04, 0xc1, 0x07, 0x00,	// orp U+1FC8 (Ὲ)
+	0x81, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+1FCA (Ὴ)
+	0x00, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x44, 0x20,	// orp U+1FCC (ῌ)
+	0x00, 0xb0, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FCD (῍)
+	0x00, 0x30, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FCE (῎)
+	0x56, 0x03, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FCF (῏)
+	0x00, 0x10, 0x39, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1FD0 (ῐ)
+	0x00, 0x00, 0x7c, 0x80, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+1FD1 (ῑ)
+	0x02, 0x01, 0x28, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1FD2 (ῒ)
+	0x00, 0x60, 0x35, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1FD6 (ῖ)
+	0x56, 0x03, 0x28, 0x00, 0x41, 0x10, 0x14, 0x02, 0x00,	// orp U+1FD7 (ῗ)
+	0xc0, 0x07, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1FD9 (Ῑ)
+	0x81, 0x00, 0x38, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+1FDA (Ὶ)
+	0x00, 0xb0, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FDD (῝)
+	0x00, 0x30, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FDE (῞)
+	0x56, 0x03, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FDF (῟)
+	0x00, 0x10, 0x39, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1FE0 (ῠ)
+	0x00, 0x00, 0x7c, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1FE1 (ῡ)
+	0x02, 0x01, 0x28, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1FE2 (ῢ)
+	0x00, 0x60, 0x10, 0x80, 0x13, 0x45, 0x53, 0x13, 0x04,	// orp U+1FE4 (ῤ)
+	0x00, 0xc0, 0x10, 0x80, 0x13, 0x45, 0x53, 0x13, 0x04,	// orp U+1FE5 (ῥ)
+	0x00, 0x60, 0x35, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1FE6 (ῦ)
+	0x56, 0x03, 0x28, 0x40, 0x12, 0x45, 0x91, 0x03, 0x00,	// orp U+1FE7 (ῧ)
+	0x91, 0x03, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1FE8 (Ῠ)
+	0xc0, 0x07, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1FE9 (Ῡ)
+	0x81, 0x00, 0x44, 0x91, 0x42, 0x10, 0x04, 0x01, 0x00,	// orp U+1FEA (Ὺ)
+	0x43, 0x00, 0x3c, 0x51, 0xf4, 0x04, 0x41, 0x00, 0x00,	// orp U+1FEC (Ῥ)
+	0x02, 0x01, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FED (῭)
+	0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FEF (`)
+	0x80, 0x40, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FF2 (ῲ)
+	0x00, 0x00, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FF3 (ῳ)
+	0x00, 0x42, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FF4 (ῴ)
+	0x00, 0x60, 0x35, 0x80, 0x12, 0x55, 0x95, 0x02, 0x00,	// orp U+1FF6 (ῶ)
+	0x80, 0xd5, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0x40, 0x20,	// orp U+1FF7 (ῷ)
+	0xc0, 0x07, 0x38, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+1FF9 (Ό)
+	0x81, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x06, 0x00,	// orp U+1FFA (Ὼ)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0xca, 0x46, 0x20,	// orp U+1FFC (ῼ)
+	0x00, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+1FFE (῾)
+	0x00, 0x00, 0x20, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+2018 (‘)
+	0x00, 0x00, 0x30, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2019 (’)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x42, 0x00,	// orp U+201A (‚)
+	0x00, 0x00, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+201B (‛)
+	0x00, 0x00, 0x48, 0xc9, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+201C (“)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x94, 0x00,	// orp U+201E („)
+	0x00, 0x00, 0x6c, 0x89, 0x04, 0x00, 0x00, 0x00, 0x00,	// orp U+201F (‟)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+2020 (†)
+	0x00, 0x00, 0x10, 0x1f, 0xf1, 0x11, 0x04, 0x01, 0x00,	// orp U+2021 (‡)
+	0x00, 0x00, 0x00, 0x8c, 0xe7, 0x31, 0x00, 0x00, 0x00,	// orp U+2022 (•)
+	0x00, 0x00, 0x00, 0x82, 0xe1, 0x18, 0x02, 0x00, 0x00,	// orp U+2023 (‣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00,	// orp U+2024 (․)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00,	// orp U+2025 (‥)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00,	// orp U+2026 (…)
+	0x00, 0x00, 0x48, 0x95, 0x42, 0x58, 0x6b, 0x05, 0x00,	// orp U+2030 (‰)
+	0x00, 0x00, 0x48, 0x95, 0xc6, 0x5a, 0x6b, 0x05, 0x00,	// orp U+2031 (‱)
+	0x00, 0x00, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2032 (′)
+	0x00, 0x00, 0x48, 0x52, 0x02, 0x00, 0x00, 0x00, 0x00,	// orp U+2033 (″)
+	0x00, 0x00, 0xa8, 0x6a, 0x05, 0x00, 0x00, 0x00, 0x00,	// orp U+2034 (‴)
+	0x00, 0x00, 0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2035 (‵)
+	0x00, 0x00, 0x24, 0x89, 0x04, 0x00, 0x00, 0x00, 0x00,	// orp U+2036 (‶)
+	0x00, 0x00, 0x54, 0x95, 0x0a, 0x00, 0x00, 0x00, 0x00,	// orp U+2037 (‷)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa1, 0x28,	// orp U+2038 (‸)
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0x04, 0x02, 0x00,	// orp U+2039 (‹)
+	0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x84, 0x00, 0x00,	// orp U+203A (›)
+	0x00, 0x40, 0x44, 0x0a, 0x51, 0x11, 0x4a, 0x44, 0x00,	// orp U+203B (※)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x28, 0x80, 0x02, 0x00,	// orp U+203C (‼)
+	0x00, 0x00, 0x38, 0x15, 0xc5, 0x10, 0x00, 0x01, 0x00,	// orp U+203D (‽)
+	0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+203E (‾)
+	0x80, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2040 (⁀)
+	0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0x04, 0xa1, 0x28,	// orp U+2041 (⁁)
+	0x00, 0x00, 0x00, 0x84, 0x43, 0x28, 0x9f, 0x02, 0x00,	// orp U+2042 (⁂)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x38, 0x00, 0x00, 0x00,	// orp U+2043 (⁃)
+	0x00, 0x00, 0x40, 0x08, 0x42, 0x10, 0x82, 0x00, 0x00,	// orp U+2044 (⁄)
+	0x00, 0x00, 0x38, 0x82, 0xe0, 0x08, 0x82, 0x03, 0x00,	// orp U+2045 (⁅)
+	0x00, 0x00, 0x38, 0x08, 0xe2, 0x20, 0x88, 0x03, 0x00,	// orp U+2046 (⁆)
+	0x00, 0x00, 0x48, 0x2d, 0x29, 0x49, 0x80, 0x04, 0x00,	// orp U+2047 (⁇)
+	0x00, 0x00, 0x48, 0x15, 0x25, 0x49, 0x80, 0x04, 0x00,	// orp U+2048 (⁈)
+	0x00, 0x00, 0x24, 0x55, 0x94, 0x24, 0x40, 0x02, 0x00,	// orp U+2049 (⁉)
+	0x00, 0x00, 0x00, 0x80, 0x07, 0x41, 0x10, 0x04, 0x00,	// orp U+204A (⁊)
+	0x00, 0x00, 0x3c, 0x5d, 0xd7, 0x14, 0x45, 0x01, 0x00,	// orp U+204B (⁋)
+	0x00, 0x00, 0x00, 0xde, 0x75, 0x79, 0x00, 0x00, 0x00,	// orp U+204C (⁌)
+	0x00, 0x00, 0x00, 0x4f, 0xd7, 0x3d, 0x00, 0x00, 0x00,	// orp U+204D (⁍)
+	0x00, 0x00, 0x00, 0x44, 0xe5, 0x38, 0x15, 0x01, 0x00,	// orp U+204E (⁎)
+	0x00, 0x00, 0x00, 0x00, 0xe1, 0x10, 0x80, 0x41, 0x20,	// orp U+204F (⁏)
+	0x80, 0x13, 0x01, 0x00, 0x00, 0x00, 0x40, 0xe4, 0x00,	// orp U+2050 (⁐)
+	0x95, 0xe3, 0x54, 0x44, 0xe5, 0x38, 0x15, 0x01, 0x00,	// orp U+2051 (⁑)
+	0x00, 0x90, 0x20, 0x04, 0x21, 0x08, 0x49, 0x00, 0x00,	// orp U+2052 (⁒)
+	0x00, 0x00, 0x00, 0x80, 0xd5, 0x00, 0x00, 0x00, 0x00,	// orp U+2053 (⁓)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x13, 0x01,	// orp U+2054 (⁔)
+	0x00, 0x00, 0x54, 0xce, 0xe7, 0x54, 0x00, 0x00, 0x00,	// orp U+2055 (⁕)
+	0x00, 0x00, 0x20, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00,	// orp U+2056 (⁖)
+	0x80, 0xef, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2057 (⁗)
+	0x00, 0x00, 0x10, 0x40, 0x04, 0x10, 0x00, 0x00, 0x00,	// orp U+2058 (⁘)
+	0x00, 0x00, 0x44, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00,	// orp U+2059 (⁙)
+	0x00, 0x40, 0x10, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,	// orp U+205A (⁚)
+	0x00, 0x40, 0x10, 0x40, 0x14, 0x01, 0x04, 0x01, 0x00,	// orp U+205B (⁛)
+	0x00, 0x00, 0x54, 0xc4, 0x47, 0x54, 0x00, 0x00, 0x00,	// orp U+205C (⁜)
+	0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00,	// orp U+205D (⁝)
+	0x00, 0x00, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00,	// orp U+205E (⁞)
+	0x84, 0xa2, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2070 (⁰)
+	0x04, 0x60, 0x10, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2071 (ⁱ)
+	0x82, 0xa0, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2074 (⁴)
+	0x8e, 0x60, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2075 (⁵)
+	0x8c, 0x60, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2076 (⁶)
+	0x0e, 0x42, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2077 (⁷)
+	0x84, 0x42, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2078 (⁸)
+	0x84, 0xc2, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2079 (⁹)
+	0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+207B (⁻)
+	0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+207C (⁼)
+	0x84, 0x20, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+207D (⁽)
+	0x02, 0x41, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+207E (⁾)
+	0x80, 0xa1, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+207F (ⁿ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8a, 0xa2, 0x10,	// orp U+2080 (₀)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x41, 0x38,	// orp U+2081 (₁)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x21, 0x38,	// orp U+2082 (₂)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x81, 0x18,	// orp U+2083 (₃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x82, 0xe2, 0x20,	// orp U+2084 (₄)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x82, 0x81, 0x18,	// orp U+2085 (₅)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x82, 0xa1, 0x10,	// orp U+2086 (₆)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x08, 0x41, 0x10,	// orp U+2087 (₇)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0a, 0xa1, 0x10,	// orp U+2088 (₈)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x83, 0x18,	// orp U+2089 (₉)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x43, 0x00,	// orp U+208A (₊)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00,	// orp U+208B (₋)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0x00,	// orp U+208C (₌)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x20, 0x10,	// orp U+208D (₍)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x41, 0x08,	// orp U+208E (₎)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x46, 0x61, 0x00,	// orp U+2090 (ₐ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc5, 0x11, 0x18,	// orp U+2091 (ₑ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x92, 0x18,	// orp U+2092 (ₒ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x21, 0x14,	// orp U+2093 (ₓ)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xc4, 0x51, 0x08,	// orp U+2094 (ₔ)
+	0x00, 0x00, 0x18, 0x41, 0x57, 0x38, 0x04, 0x07, 0x00,	// orp U+20A0 (₠)
+	0x00, 0x00, 0x78, 0x55, 0xb5, 0x2c, 0x9b, 0x03, 0x00,	// orp U+20A1 (₡)
+	0x00, 0x00, 0x38, 0x51, 0xd0, 0x14, 0x95, 0x03, 0x00,	// orp U+20A2 (₢)
+	0x00, 0x00, 0x7c, 0x41, 0x70, 0x35, 0x45, 0x01, 0x00,	// orp U+20A3 (₣)
+	0x00, 0x00, 0x30, 0xd2, 0x21, 0x1c, 0x52, 0x03, 0x00,	// orp U+20A4 (₤)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x55, 0x25, 0x00,	// orp U+20A5 (₥)
+	0x00, 0x00, 0x44, 0xd3, 0x5f, 0xfd, 0x59, 0x04, 0x00,	// orp U+20A6 (₦)
+	0x00, 0x00, 0x18, 0xca, 0xa7, 0x18, 0x82, 0x00, 0x00,	// orp U+20A7 (₧)
+	0x00, 0x30, 0x14, 0xc5, 0x56, 0x34, 0x55, 0x03, 0x00,	// orp U+20A8 (₨)
+	0x00, 0x00, 0xfc, 0xd1, 0x5f, 0x55, 0x5b, 0x04, 0x00,	// orp U+20A9 (₩)
+	0x00, 0x60, 0xa4, 0x6d, 0xdb, 0xb6, 0x65, 0x06, 0x00,	// orp U+20AA (₪)
+	0x00, 0x00, 0xf1, 0x90, 0x17, 0x45, 0x91, 0x07, 0x78,	// orp U+20AB (₫)
+	0x00, 0x00, 0x70, 0xc2, 0x23, 0x3c, 0x02, 0x07, 0x00,	// orp U+20AC (€)
+	0x00, 0x00, 0x48, 0x92, 0xf2, 0x29, 0x92, 0x04, 0x00,	// orp U+20AD (₭)
+	0x00, 0x00, 0x7c, 0x04, 0x63, 0x30, 0x06, 0x01, 0x00,	// orp U+20AE (₮)
+	0x00, 0x20, 0x1c, 0x8a, 0x24, 0x49, 0xd7, 0x02, 0x00,	// orp U+20AF (₯)
+	0x00, 0x80, 0x50, 0x14, 0x82, 0x28, 0x56, 0x05, 0x21,	// orp U+20B0 (₰)
+	0x00, 0x60, 0x28, 0xdf, 0xa7, 0x18, 0x82, 0x00, 0x00,	// orp U+20B1 (₱)
+	0x00, 0x40, 0x38, 0x55, 0x51, 0x74, 0x95, 0x43, 0x00,	// orp U+20B2 (₲)
+	0x00, 0x00, 0x38, 0xd1, 0x17, 0x7d, 0x51, 0x04, 0x00,	// orp U+20B3 (₳)
+	0x00, 0x00, 0x18, 0xc8, 0x47, 0x7c, 0x02, 0x03, 0x00,	// orp U+20B4 (₴)
+	0x00, 0x40, 0x38, 0x55, 0x51, 0x14, 0x95, 0x43, 0x00,	// orp U+20B5 (₵)
+	0x84, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D0 (⃐)
+	0x04, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D1 (⃑)
+	0x00, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x00,	// orp U+20D2 (⃒)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x00,	// orp U+20D3 (⃓)
+	0x40, 0x33, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D4 (⃔)
+	0x80, 0x95, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D5 (⃕)
+	0x80, 0xf0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D6 (⃖)
+	0x00, 0xf2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20D7 (⃗)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x28, 0x04, 0x00, 0x00,	// orp U+20D8 (⃘)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x5d, 0x12, 0x03, 0x00,	// orp U+20D9 (⃙)
+	0x00, 0x00, 0x00, 0x80, 0x91, 0x74, 0x89, 0x01, 0x00,	// orp U+20DA (⃚)
+	0x40, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20DB (⃛)
+	0x40, 0xdb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20DC (⃜)
+	0x5e, 0x18, 0x86, 0x61, 0x18, 0x86, 0x61, 0x18, 0x7a,	// orp U+20DD (⃝)
+	0x7f, 0x18, 0x86, 0x61, 0x18, 0x86, 0x61, 0x18, 0xfe,	// orp U+20DE (⃞)
+	0x8c, 0x14, 0x86, 0x61, 0x18, 0x86, 0x61, 0x28, 0x31,	// orp U+20DF (⃟)
+	0xde, 0x58, 0x96, 0x65, 0x99, 0xa6, 0x69, 0x1a, 0x7b,	// orp U+20E0 (⃠)
+	0x80, 0xf2, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20E1 (⃡)
+	0x80, 0x17, 0x86, 0x61, 0x18, 0x86, 0x61, 0xe8, 0x01,	// orp U+20E2 (⃢)
+	0xff, 0x1f, 0x86, 0x61, 0x18, 0x86, 0x61, 0xf8, 0xff,	// orp U+20E3 (⃣)
+	0x04, 0x41, 0x28, 0x8a, 0xa2, 0x44, 0x51, 0x14, 0x7d,	// orp U+20E4 (⃤)
+	0x00, 0x10, 0x04, 0x02, 0x41, 0x20, 0x10, 0x04, 0x00,	// orp U+20E5 (⃥)
+	0x00, 0xa0, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+20E6 (⃦)
+	0xc0, 0x0f, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x00,	// orp U+20E7 (⃧)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,	// orp U+20E8 (⃨)
+	0x5f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20E9 (⃩)
+	0x00, 0x00, 0x00, 0x84, 0xf0, 0x0b, 0x04, 0x00, 0x00,	// orp U+20EA (⃪)
+	0x00, 0x40, 0x92, 0xa4, 0x24, 0x25, 0x49, 0x02, 0x00,	// orp U+20EB (⃫)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x21,	// orp U+20EC (⃬)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x09,	// orp U+20ED (⃭)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0x09,	// orp U+20EE (⃮)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x21,	// orp U+20EF (⃯)
+	0x85, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+20F0 (⃰)
+	0x80, 0x55, 0x39, 0x08, 0x21, 0x68, 0x45, 0x06, 0x00,	// orp U+2100 (℀)
+	0x80, 0x55, 0x39, 0x08, 0xa1, 0x19, 0x49, 0xc4, 0x00,	// orp U+2101 (℁)
+	0x00, 0x00, 0x38, 0x55, 0x51, 0x14, 0x95, 0x03, 0x00,	// orp U+2102 (ℂ)
+	0x42, 0x21, 0x70, 0x82, 0x20, 0x08, 0x02, 0x07, 0x00,	// orp U+2103 (℃)
+	0x00, 0x41, 0x38, 0x45, 0x51, 0x38, 0x04, 0x07, 0x00,	// orp U+2104 (℄)
+	0x80, 0x14, 0x29, 0x08, 0x21, 0x28, 0x55, 0x02, 0x00,	// orp U+2105 (℅)
+	0x80, 0x14, 0x29, 0x08, 0x21, 0x58, 0x55, 0x06, 0x00,	// orp U+2106 (℆)
+	0x42, 0x21, 0xf0, 0x04, 0xc1, 0x11, 0x04, 0x01, 0x00,	// orp U+2109 (℉)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x49, 0x12, 0x93, 0x18,	// orp U+210A (ℊ)
+	0x00, 0x00, 0x4c, 0x92, 0xe4, 0x24, 0x49, 0x02, 0x01,	// orp U+210B (ℋ)
+	0x80, 0x95, 0x04, 0xcd, 0x24, 0x51, 0x95, 0x84, 0x10,	// orp U+210C (ℌ)
+	0x00, 0x00, 0x54, 0x55, 0xd5, 0x55, 0x55, 0x05, 0x00,	// orp U+210D (ℍ)
+	0x00, 0x40, 0x10, 0x82, 0x23, 0x49, 0x49, 0x02, 0x00,	// orp U+210E (ℎ)
+	0x00, 0x40, 0x3c, 0x82, 0x23, 0x49, 0x49, 0x02, 0x00,	// orp U+210F (ℏ)
+	0x00, 0xc0, 0x41, 0x10, 0x82, 0x10, 0x85, 0x00, 0x00,	// orp U+2110 (ℐ)
+	0x00, 0xf0, 0x45, 0x12, 0x82, 0x40, 0x13, 0x03, 0x00,	// orp U+2111 (ℑ)
+	0x00, 0x80, 0x50, 0x04, 0x21, 0x08, 0x66, 0x06, 0x00,	// orp U+2112 (ℒ)
+	0x00, 0x00, 0x20, 0x14, 0x45, 0x21, 0x8c, 0x04, 0x00,	// orp U+2113 (ℓ)
+	0x00, 0x00, 0x14, 0x4f, 0xd1, 0x54, 0x55, 0x03, 0x00,	// orp U+2114 (℔)
+	0x00, 0x00, 0x8c, 0x63, 0xd9, 0xb6, 0x75, 0x09, 0x00,	// orp U+2115 (ℕ)
+	0x00, 0x00, 0x24, 0xc9, 0xd6, 0x66, 0x49, 0x0e, 0x00,	// orp U+2116 (№)
+	0x00, 0xe0, 0x44, 0xd7, 0x76, 0x4d, 0x91, 0x03, 0x00,	// orp U+2117 (℗)
+	0x00, 0x00, 0x00, 0x9a, 0x69, 0x7a, 0x45, 0x21, 0x00,	// orp U+2118 (℘)
+	0x00, 0x00, 0x3c, 0x55, 0xd5, 0x14, 0x45, 0x01, 0x00,	// orp U+2119 (ℙ)
+	0x00, 0x00, 0x38, 0x55, 0x55, 0x55, 0x8d, 0x05, 0x00,	// orp U+211A (ℚ)
+	0x00, 0x00, 0x3c, 0x92, 0xe4, 0x14, 0x49, 0x02, 0x00,	// orp U+211B (ℛ)
+	0x00, 0x00, 0x3c, 0x95, 0xc5, 0x30, 0x95, 0x04, 0x00,	// orp U+211C (ℜ)
+	0x00, 0x00, 0x3c, 0x55, 0xd5, 0x34, 0x55, 0x05, 0x00,	// orp U+211D (ℝ)
+	0x00, 0x00, 0x3c, 0x51, 0xf4, 0x54, 0x49, 0x05, 0x00,	// orp U+211E (℞)
+	0x80, 0x41, 0x3c, 0x55, 0xf5, 0x14, 0x4d, 0x45, 0x00,	// orp U+211F (℟)
+	0x6a, 0xae, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2120 (℠)
+	0x87, 0x20, 0x38, 0x04, 0x43, 0x30, 0x08, 0x82, 0x60,	// orp U+2121 (℡)
+	0x00, 0x00, 0xfc, 0xba, 0x0a, 0x00, 0x00, 0x00, 0x00,	// orp U+2122 (™)
+	0x07, 0x51, 0x55, 0x95, 0xa2, 0x28, 0x45, 0x11, 0x00,	// orp U+2123 (℣)
+	0x00, 0x00, 0x7c, 0x94, 0xa4, 0x24, 0xc5, 0x07, 0x00,	// orp U+2124 (ℤ)
+	0x00, 0xe0, 0x21, 0x84, 0x87, 0x10, 0x0e, 0x14, 0x39,	// orp U+2125 (℥)
+	0x00, 0x00, 0x6c, 0x4a, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+2127 (℧)
+	0x00, 0x00, 0x38, 0x11, 0xc5, 0x51, 0x91, 0x03, 0x00,	// orp U+2128 (ℨ)
+	0x00, 0x00, 0x00, 0x80, 0x81, 0x20, 0x08, 0x02, 0x00,	// orp U+2129 (℩)
+	0x00, 0x00, 0x3c, 0x92, 0xe4, 0x24, 0xc9, 0x01, 0x00,	// orp U+212C (ℬ)
+	0x00, 0x00, 0xb9, 0x49, 0x52, 0x04, 0x91, 0x03, 0x00,	// orp U+212D (ℭ)
+	0x00, 0x00, 0x00, 0x80, 0xb3, 0x3d, 0x83, 0x03, 0x00,	// orp U+212E (℮)
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x39, 0x81, 0x01, 0x00,	// orp U+212F (ℯ)
+	0x00, 0x00, 0x38, 0x51, 0x60, 0x04, 0x91, 0x03, 0x00,	// orp U+2130 (ℰ)
+	0x00, 0xe0, 0x17, 0x84, 0x47, 0x10, 0x85, 0x00, 0x00,	// orp U+2131 (ℱ)
+	0x00, 0x00, 0x40, 0x10, 0xe4, 0x41, 0xd0, 0x07, 0x00,	// orp U+2132 (Ⅎ)
+	0x00, 0x00, 0x8c, 0xb6, 0x2a, 0x4a, 0x52, 0x08, 0x00,	// orp U+2133 (ℳ)
+	0x00, 0x00, 0x00, 0x8c, 0x24, 0x25, 0x89, 0x01, 0x00,	// orp U+2134 (ℴ)
+	0x00, 0x00, 0x00, 0x0c, 0xe0, 0x30, 0x8c, 0x03, 0x00,	// orp U+2139 (ℹ)
+	0x00, 0x00, 0x00, 0xa0, 0x1f, 0x45, 0x91, 0x03, 0x00,	// orp U+213A (℺)
+	0x47, 0x30, 0x04, 0x8e, 0xe2, 0x28, 0x28, 0x84, 0x02,	// orp U+213B (℻)
+	0x00, 0x00, 0x00, 0xc0, 0x6f, 0x59, 0x96, 0x05, 0x00,	// orp U+213C (ℼ)
+	0x00, 0x00, 0x00, 0x40, 0x24, 0x55, 0x8a, 0xa2, 0x28,	// orp U+213D (ℽ)
+	0x00, 0x00, 0x7c, 0x55, 0x51, 0x14, 0x45, 0x01, 0x00,	// orp U+213E (ℾ)
+	0x00, 0x00, 0x7c, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+213F (ℿ)
+	0xc0, 0x57, 0x28, 0x0a, 0xa5, 0x28, 0xc5, 0x07, 0x00,	// orp U+2140 (⅀)
+	0x00, 0x00, 0x38, 0xd1, 0x04, 0x41, 0x91, 0x03, 0x00,	// orp U+2141 (⅁)
+	0x00, 0x00, 0x7c, 0x10, 0x04, 0x41, 0x10, 0x04, 0x00,	// orp U+2142 (⅂)
+	0x00, 0x00, 0x40, 0x10, 0x04, 0x41, 0xd0, 0x07, 0x00,	// orp U+2143 (⅃)
+	0x00, 0x00, 0x10, 0x04, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+2144 (⅄)
+	0x00, 0xe0, 0xa9, 0xaa, 0x5a, 0x55, 0xd5, 0x03, 0x00,	// orp U+2145 (ⅅ)
+	0x00, 0x00, 0xe0, 0x28, 0x6a, 0x55, 0x95, 0x07, 0x00,	// orp U+2146 (ⅆ)
+	0x00, 0x00, 0x00, 0x9c, 0xaa, 0x76, 0x85, 0x07, 0x00,	// orp U+2147 (ⅇ)
+	0x00, 0x00, 0x20, 0x80, 0x47, 0x51, 0x8a, 0x02, 0x00,	// orp U+2148 (ⅈ)
+	0x00, 0x00, 0x20, 0x80, 0x47, 0x51, 0x8a, 0xa2, 0x1c,	// orp U+2149 (ⅉ)
+	0x00, 0x40, 0x10, 0x4f, 0x55, 0x35, 0x04, 0x07, 0x00,	// orp U+214A (⅊)
+	0x00, 0x00, 0x34, 0xd2, 0x85, 0x50, 0x14, 0x02, 0x00,	// orp U+214B (⅋)
+	0x40, 0x57, 0xbe, 0xf5, 0x57, 0x15, 0x85, 0x00, 0x00,	// orp U+214C (⅌)
+	0x42, 0x75, 0x35, 0x08, 0x21, 0x29, 0x51, 0x02, 0x00,	// orp U+214D (⅍)
+	0x00, 0x00, 0x00, 0x10, 0x04, 0x71, 0x90, 0x07, 0x00,	// orp U+214E (ⅎ)
+	0x00, 0x00, 0x00, 0x80, 0xe3, 0x38, 0x15, 0x00, 0x00,	// orp U+214F (⅏)
+	0x82, 0x24, 0x29, 0x08, 0x27, 0x4a, 0x61, 0x06, 0x00,	// orp U+2153 (⅓)
+	0x42, 0x25, 0x3d, 0x08, 0x27, 0x4a, 0x61, 0x06, 0x00,	// orp U+2154 (⅔)
+	0x82, 0x24, 0x29, 0x08, 0xa1, 0x29, 0x51, 0x02, 0x00,	// orp U+2155 (⅕)
+	0x42, 0x25, 0x3d, 0x08, 0xa1, 0x29, 0x51, 0x02, 0x00,	// orp U+2156 (⅖)
+	0x03, 0x25, 0x31, 0x0b, 0xa1, 0x29, 0x51, 0x02, 0x00,	// orp U+2157 (⅗)
+	0xc1, 0x74, 0x29, 0x08, 0xa1, 0x29, 0x51, 0x02, 0x00,	// orp U+2158 (⅘)
+	0x82, 0x24, 0x29, 0x08, 0xa5, 0x68, 0x69, 0x04, 0x00,	// orp U+2159 (⅙)
+	0x43, 0x24, 0x25, 0x08, 0xa5, 0x68, 0x69, 0x04, 0x00,	// orp U+215A (⅚)
+	0x82, 0x24, 0x29, 0x08, 0xa5, 0x4a, 0x69, 0x04, 0x00,	// orp U+215B (⅛)
+	0x03, 0x25, 0x31, 0x0b, 0xa5, 0x4a, 0x69, 0x04, 0x00,	// orp U+215C (⅜)
+	0x43, 0x24, 0x25, 0x08, 0xa5, 0x4a, 0x69, 0x04, 0x00,	// orp U+215D (⅝)
+	0x07, 0x25, 0x29, 0x08, 0xa5, 0x4a, 0x69, 0x04, 0x00,	// orp U+215E (⅞)
+	0x82, 0x24, 0x29, 0x08, 0x21, 0x08, 0x41, 0x00, 0x00,	// orp U+215F (⅟)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+2162 (Ⅲ)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x25, 0x49, 0x02, 0x00,	// orp U+2163 (Ⅳ)
+	0x00, 0x10, 0x45, 0x91, 0xa2, 0x28, 0x04, 0x01, 0x00,	// orp U+2164 (Ⅴ)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x49, 0x92, 0x04, 0x00,	// orp U+2165 (Ⅵ)
+	0x00, 0x00, 0xac, 0xeb, 0xba, 0xaa, 0xaa, 0x0a, 0x00,	// orp U+2166 (Ⅶ)
+	0x00, 0x00, 0xec, 0xfb, 0xbe, 0xeb, 0xba, 0x0e, 0x00,	// orp U+2167 (Ⅷ)
+	0x00, 0x00, 0x54, 0x55, 0x95, 0x54, 0x55, 0x05, 0x00,	// orp U+2168 (Ⅸ)
+	0x00, 0x00, 0x54, 0x55, 0x25, 0x55, 0x55, 0x05, 0x00,	// orp U+216A (Ⅺ)
+	0x00, 0x00, 0xd4, 0x75, 0x2d, 0xd7, 0x75, 0x0d, 0x00,	// orp U+216B (Ⅻ)
+	0x00, 0x00, 0x3c, 0x92, 0x24, 0x49, 0xd2, 0x03, 0x00,	// orp U+216E (Ⅾ)
+	0x00, 0x00, 0x44, 0xd1, 0x56, 0x45, 0x51, 0x04, 0x00,	// orp U+216F (Ⅿ)
+	0x00, 0x00, 0x28, 0x80, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+2171 (ⅱ)
+	0x00, 0x00, 0x54, 0x40, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+2172 (ⅲ)
+	0x00, 0x00, 0x04, 0x40, 0x55, 0x55, 0x49, 0x02, 0x00,	// orp U+2173 (ⅳ)
+	0x00, 0x00, 0x40, 0x40, 0x55, 0x55, 0x92, 0x04, 0x00,	// orp U+2175 (ⅵ)
+	0x00, 0x00, 0xa0, 0xc0, 0xba, 0xae, 0xab, 0x0a, 0x00,	// orp U+2176 (ⅶ)
+	0x00, 0x00, 0xe0, 0xc0, 0xbe, 0xef, 0xbb, 0x0e, 0x00,	// orp U+2177 (ⅷ)
+	0x00, 0x00, 0x04, 0x40, 0x55, 0x25, 0x55, 0x05, 0x00,	// orp U+2178 (ⅸ)
+	0x00, 0x00, 0x40, 0x40, 0x55, 0x49, 0x55, 0x05, 0x00,	// orp U+217A (ⅺ)
+	0x00, 0x00, 0xc0, 0x40, 0x5d, 0xcb, 0x75, 0x0d, 0x00,	// orp U+217B (ⅻ)
+	0x00, 0x00, 0x18, 0x04, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+217C (ⅼ)
+	0x00, 0x00, 0x40, 0x10, 0xe4, 0x45, 0x91, 0x07, 0x00,	// orp U+217E (ⅾ)
+	0x00, 0x00, 0x00, 0xc0, 0x52, 0x55, 0x55, 0x04, 0x00,	// orp U+217F (ⅿ)
+	0x00, 0x00, 0x38, 0x55, 0x55, 0x55, 0x95, 0x03, 0x00,	// orp U+2180 (ↀ)
+	0x00, 0x00, 0x3c, 0xd1, 0x55, 0x5d, 0xd1, 0x03, 0x00,	// orp U+2181 (ↁ)
+	0x00, 0x00, 0x38, 0xd5, 0x57, 0x7d, 0x95, 0x03, 0x00,	// orp U+2182 (ↂ)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x41, 0x12, 0x03, 0x00,	// orp U+2184 (ↄ)
+	0x00, 0x00, 0x38, 0x51, 0x10, 0x44, 0x1e, 0x04, 0x01,	// orp U+2185 (ↅ)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x54, 0x0e, 0x01, 0x00,	// orp U+2186 (ↆ)
+	0x00, 0x00, 0x7c, 0xff, 0x9f, 0xff, 0xff, 0x07, 0x00,	// orp U+2187 (ↇ)
+	0x00, 0x00, 0x38, 0xdf, 0x57, 0x7d, 0x9f, 0x03, 0x00,	// orp U+2188 (ↈ)
+	0x00, 0x00, 0x00, 0x84, 0xf0, 0x09, 0x04, 0x00, 0x00,	// orp U+2190 (←)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x10, 0x04, 0x01, 0x00,	// orp U+2191 (↑)
+	0x00, 0x00, 0x00, 0x04, 0xf2, 0x21, 0x04, 0x00, 0x00,	// orp U+2192 (→)
+	0x00, 0x00, 0x00, 0x80, 0xf2, 0x29, 0x00, 0x00, 0x00,	// orp U+2194 (↔)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x54, 0x0e, 0x01, 0x00,	// orp U+2195 (↕)
+	0xc0, 0xf0, 0x1c, 0x05, 0x81, 0x20, 0x10, 0x04, 0x00,	// orp U+2196 (↖)
+	0x00, 0xe6, 0x71, 0x14, 0x21, 0x08, 0x41, 0x00, 0x00,	// orp U+2197 (↗)
+	0x40, 0x10, 0x08, 0x02, 0x41, 0x71, 0x1e, 0x06, 0x00,	// orp U+2198 (↘)
+	0x00, 0x04, 0x21, 0x08, 0x51, 0x1c, 0xcf, 0x00, 0x00,	// orp U+2199 (↙)
+	0x00, 0x00, 0x00, 0x94, 0xf4, 0x2b, 0x0c, 0x00, 0x00,	// orp U+219A (↚)
+	0x00, 0x00, 0x00, 0x0c, 0xf5, 0x4b, 0x0a, 0x00, 0x00,	// orp U+219B (↛)
+	0x00, 0x00, 0x00, 0xc0, 0xb0, 0x99, 0x00, 0x00, 0x00,	// orp U+219C (↜)
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x67, 0x00, 0x00, 0x00,	// orp U+219D (↝)
+	0x00, 0x00, 0x00, 0x94, 0xf2, 0x2b, 0x14, 0x00, 0x00,	// orp U+219E (↞)
+	0x00, 0x40, 0x38, 0x95, 0x53, 0x11, 0x04, 0x01, 0x00,	// orp U+219F (↟)
+	0x00, 0x00, 0x00, 0x0a, 0xf5, 0x53, 0x0a, 0x00, 0x00,	// orp U+21A0 (↠)
+	0x00, 0x40, 0x10, 0x44, 0xe5, 0x54, 0x0e, 0x01, 0x00,	// orp U+21A1 (↡)
+	0x00, 0x00, 0x00, 0xa4, 0xf4, 0x48, 0x24, 0x00, 0x00,	// orp U+21A2 (↢)
+	0x00, 0x00, 0x00, 0x89, 0xc4, 0x4b, 0x09, 0x00, 0x00,	// orp U+21A3 (↣)
+	0x00, 0x00, 0x00, 0x94, 0xf4, 0x49, 0x14, 0x00, 0x00,	// orp U+21A4 (↤)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x10, 0xc4, 0x07, 0x00,	// orp U+21A5 (↥)
+	0x00, 0x00, 0x00, 0x45, 0xf2, 0x25, 0x05, 0x00, 0x00,	// orp U+21A6 (↦)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x54, 0x0e, 0x01, 0x00,	// orp U+21A7 (↧)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x54, 0xce, 0x07, 0x00,	// orp U+21A8 (↨)
+	0x00, 0x00, 0x00, 0x94, 0xf8, 0x09, 0x04, 0x00, 0x00,	// orp U+21A9 (↩)
+	0x00, 0x00, 0x00, 0x4a, 0xe4, 0x43, 0x08, 0x00, 0x00,	// orp U+21AA (↪)
+	0x00, 0x00, 0x00, 0x84, 0xfc, 0x4b, 0x14, 0x00, 0x00,	// orp U+21AB (↫)
+	0x00, 0x00, 0x00, 0xc8, 0xf4, 0x4b, 0x0a, 0x00, 0x00,	// orp U+21AC (↬)
+	0x00, 0x00, 0x00, 0x80, 0xb4, 0xdf, 0x12, 0x00, 0x00,	// orp U+21AD (↭)
+	0x00, 0x00, 0x00, 0x90, 0xf6, 0x5b, 0x02, 0x00, 0x00,	// orp U+21AE (↮)
+	0x00, 0x00, 0x04, 0x49, 0xb3, 0x24, 0x1c, 0x02, 0x00,	// orp U+21AF (↯)
+	0x00, 0x40, 0x08, 0x9f, 0x44, 0x41, 0x10, 0x04, 0x00,	// orp U+21B0 (↰)
+	0x00, 0x40, 0x20, 0x5f, 0x52, 0x04, 0x41, 0x00, 0x00,	// orp U+21B1 (↱)
+	0x00, 0x00, 0x41, 0x10, 0x25, 0x7d, 0x02, 0x01, 0x00,	// orp U+21B2 (↲)
+	0x00, 0x00, 0x04, 0x41, 0x91, 0x7c, 0x08, 0x01, 0x00,	// orp U+21B3 (↳)
+	0x00, 0x00, 0x00, 0xc0, 0x83, 0x70, 0x08, 0x00, 0x00,	// orp U+21B4 (↴)
+	0x00, 0x00, 0x00, 0x10, 0x24, 0x7d, 0x02, 0x00, 0x00,	// orp U+21B5 (↵)
+	0x00, 0x00, 0x00, 0x8c, 0x24, 0x5d, 0x12, 0x00, 0x00,	// orp U+21B6 (↶)
+	0x00, 0x00, 0x00, 0x46, 0x92, 0x74, 0x08, 0x00, 0x00,	// orp U+21B7 (↷)
+	0x00, 0xf0, 0x05, 0xc7, 0x50, 0x10, 0x08, 0x02, 0x00,	// orp U+21B8 (↸)
+	0x40, 0x31, 0x7c, 0x43, 0x85, 0x7d, 0x18, 0x05, 0x00,	// orp U+21B9 (↹)
+	0x00, 0x00, 0x00, 0x1c, 0x53, 0x45, 0x91, 0x03, 0x00,	// orp U+21BA (↺)
+	0x00, 0x00, 0x00, 0x87, 0x51, 0x45, 0x91, 0x03, 0x00,	// orp U+21BB (↻)
+	0x00, 0x00, 0x00, 0x84, 0xf0, 0x01, 0x00, 0x00, 0x00,	// orp U+21BC (↼)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x09, 0x04, 0x00, 0x00,	// orp U+21BD (↽)
+	0x00, 0x40, 0x30, 0x14, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+21BE (↾)
+	0x00, 0x40, 0x18, 0x05, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+21BF (↿)
+	0x00, 0x00, 0x00, 0x04, 0xf2, 0x01, 0x00, 0x00, 0x00,	// orp U+21C0 (⇀)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x21, 0x04, 0x00, 0x00,	// orp U+21C1 (⇁)
+	0x00, 0x40, 0x10, 0x04, 0x41, 0x50, 0x0c, 0x01, 0x00,	// orp U+21C2 (⇂)
+	0x00, 0x40, 0x10, 0x04, 0x41, 0x14, 0x06, 0x01, 0x00,	// orp U+21C3 (⇃)
+	0x00, 0x81, 0x7c, 0x08, 0x21, 0x7c, 0x02, 0x01, 0x00,	// orp U+21C4 (⇄)
+	0x00, 0xa0, 0x3c, 0x8a, 0xa2, 0x28, 0x9e, 0x02, 0x00,	// orp U+21C5 (⇅)
+	0x00, 0x21, 0x7c, 0x02, 0x81, 0x7c, 0x08, 0x01, 0x00,	// orp U+21C6 (⇆)
+	0x00, 0x21, 0x7c, 0x02, 0x21, 0x7c, 0x02, 0x01, 0x00,	// orp U+21C7 (⇇)
+	0x00, 0xa0, 0x7c, 0x8a, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+21C8 (⇈)
+	0x00, 0x81, 0x7c, 0x08, 0x81, 0x7c, 0x08, 0x01, 0x00,	// orp U+21C9 (⇉)
+	0x00, 0xa0, 0x28, 0x8a, 0xa2, 0x28, 0x9f, 0x02, 0x00,	// orp U+21CA (⇊)
+	0x00, 0x00, 0x10, 0xc2, 0x07, 0x7c, 0x08, 0x01, 0x00,	// orp U+21CB (⇋)
+	0x00, 0x00, 0x10, 0xc8, 0x07, 0x7c, 0x02, 0x01, 0x00,	// orp U+21CC (⇌)
+	0x00, 0x00, 0xa0, 0x94, 0x9f, 0xf8, 0x84, 0x02, 0x00,	// orp U+21CD (⇍)
+	0x00, 0x00, 0x40, 0xda, 0x5f, 0xfe, 0x96, 0x00, 0x00,	// orp U+21CE (⇎)
+	0x00, 0x00, 0x14, 0xca, 0x47, 0x7e, 0x08, 0x05, 0x00,	// orp U+21CF (⇏)
+	0x00, 0x00, 0x00, 0x84, 0x17, 0x78, 0x04, 0x00, 0x00,	// orp U+21D0 (⇐)
+	0x00, 0x00, 0x10, 0xca, 0xa6, 0x28, 0x8a, 0x02, 0x00,	// orp U+21D1 (⇑)
+	0x00, 0x00, 0x00, 0xc4, 0x03, 0x3d, 0x04, 0x00, 0x00,	// orp U+21D2 (⇒)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x6c, 0x0a, 0x01, 0x00,	// orp U+21D3 (⇓)
+	0x00, 0x00, 0x00, 0xd2, 0x1f, 0xfe, 0x12, 0x00, 0x00,	// orp U+21D4 (⇔)
+	0x00, 0x40, 0x28, 0x9b, 0xa2, 0x6c, 0x0a, 0x01, 0x00,	// orp U+21D5 (⇕)
+	0x00, 0x00, 0x00, 0x5f, 0xb1, 0x54, 0x29, 0x04, 0x00,	// orp U+21D6 (⇖)
+	0x00, 0x00, 0x00, 0x3e, 0x4a, 0xab, 0xa5, 0x00, 0x00,	// orp U+21D7 (⇗)
+	0x00, 0x00, 0x00, 0x42, 0xa9, 0xd2, 0xa8, 0x0f, 0x00,	// orp U+21D8 (⇘)
+	0x00, 0x00, 0x00, 0x50, 0x5a, 0x2d, 0xc5, 0x07, 0x00,	// orp U+21D9 (⇙)
+	0x00, 0x00, 0x20, 0xbc, 0xf0, 0x0b, 0x3c, 0x02, 0x00,	// orp U+21DA (⇚)
+	0x00, 0x00, 0x10, 0x0f, 0xf4, 0x43, 0x0f, 0x01, 0x00,	// orp U+21DB (⇛)
+	0x00, 0x00, 0x00, 0x80, 0x70, 0xad, 0x02, 0x00, 0x00,	// orp U+21DC (⇜)
+	0x00, 0x00, 0x00, 0x00, 0xa4, 0xd7, 0x10, 0x00, 0x00,	// orp U+21DD (⇝)
+	0x00, 0x40, 0x38, 0x15, 0xe1, 0x10, 0x0e, 0x01, 0x00,	// orp U+21DE (⇞)
+	0x00, 0x40, 0x38, 0x84, 0x43, 0x54, 0x0e, 0x01, 0x00,	// orp U+21DF (⇟)
+	0x00, 0x00, 0x00, 0x84, 0xb0, 0x0a, 0x04, 0x00, 0x00,	// orp U+21E0 (⇠)
+	0x00, 0x40, 0x38, 0x11, 0x01, 0x10, 0x00, 0x01, 0x00,	// orp U+21E1 (⇡)
+	0x00, 0x00, 0x00, 0x08, 0x54, 0x43, 0x08, 0x00, 0x00,	// orp U+21E2 (⇢)
+	0x00, 0x40, 0x00, 0x04, 0x40, 0x44, 0x0e, 0x01, 0x00,	// orp U+21E3 (⇣)
+	0x00, 0x00, 0x00, 0xc5, 0xf0, 0x0d, 0x05, 0x00, 0x00,	// orp U+21E4 (⇤)
+	0x00, 0x00, 0x00, 0x14, 0xf6, 0x61, 0x14, 0x00, 0x00,	// orp U+21E5 (⇥)
+	0x00, 0x00, 0x00, 0x84, 0x17, 0x79, 0x04, 0x00, 0x00,	// orp U+21E6 (⇦)
+	0x00, 0x40, 0x28, 0x9b, 0xa2, 0x28, 0x8a, 0x03, 0x00,	// orp U+21E7 (⇧)
+	0x00, 0x00, 0x00, 0xc4, 0x13, 0x3d, 0x04, 0x00, 0x00,	// orp U+21E8 (⇨)
+	0x00, 0xe0, 0x28, 0x8a, 0xa2, 0x6c, 0x0a, 0x01, 0x00,	// orp U+21E9 (⇩)
+	0x00, 0xa1, 0x6c, 0x8a, 0x03, 0x38, 0x8a, 0x03, 0x00,	// orp U+21EA (⇪)
+	0x00, 0xa1, 0x6c, 0x8a, 0xa2, 0x6c, 0xd1, 0x07, 0x00,	// orp U+21EB (⇫)
+	0x00, 0xa1, 0x7c, 0x91, 0xa2, 0x6c, 0xd1, 0x07, 0x00,	// orp U+21EC (⇬)
+	0x00, 0xe1, 0x7c, 0x8e, 0xe3, 0x7c, 0xd5, 0x07, 0x00,	// orp U+21ED (⇭)
+	0x00, 0xa1, 0x6c, 0xca, 0xa6, 0x28, 0x8a, 0x03, 0x00,	// orp U+21EE (⇮)
+	0x00, 0xa1, 0x6c, 0xca, 0xa6, 0x6c, 0xd1, 0x07, 0x00,	// orp U+21EF (⇯)
+	0x00, 0x00, 0x00, 0xc5, 0x13, 0x3d, 0x05, 0x00, 0x00,	// orp U+21F0 (⇰)
+	0x00, 0xf0, 0x05, 0x4d, 0x91, 0x20, 0x10, 0x04, 0x00,	// orp U+21F1 (⇱)
+	0x00, 0x10, 0x04, 0x82, 0x44, 0x59, 0xd0, 0x07, 0x00,	// orp U+21F2 (⇲)
+	0x00, 0x00, 0x00, 0x88, 0xf5, 0x5b, 0x08, 0x00, 0x00,	// orp U+21F4 (⇴)
+	0x00, 0xa0, 0x78, 0x8a, 0xa2, 0x28, 0x8f, 0x02, 0x00,	// orp U+21F5 (⇵)
+	0x00, 0xf2, 0x21, 0xc8, 0x87, 0x20, 0x1f, 0x02, 0x00,	// orp U+21F6 (⇶)
+	0x00, 0x00, 0x00, 0x94, 0xf4, 0x4b, 0x14, 0x00, 0x00,	// orp U+21F7 (⇷)
+	0x00, 0x00, 0x00, 0x8a, 0xf4, 0x4b, 0x0a, 0x00, 0x00,	// orp U+21F8 (⇸)
+	0x00, 0x00, 0x00, 0x8c, 0xf7, 0x7b, 0x0c, 0x00, 0x00,	// orp U+21F9 (⇹)
+	0x00, 0x00, 0x00, 0x9c, 0xf6, 0x6b, 0x1c, 0x00, 0x00,	// orp U+21FA (⇺)
+	0x00, 0x00, 0x00, 0x8e, 0xf5, 0x5b, 0x0e, 0x00, 0x00,	// orp U+21FB (⇻)
+	0x00, 0x00, 0x00, 0x84, 0xd1, 0x19, 0x04, 0x00, 0x00,	// orp U+21FD (⇽)
+	0x00, 0x00, 0x00, 0x04, 0x73, 0x31, 0x04, 0x00, 0x00,	// orp U+21FE (⇾)
+	0x00, 0x00, 0x00, 0x8c, 0xd7, 0x7a, 0x0c, 0x00, 0x00,	// orp U+21FF (⇿)
+	0x00, 0x00, 0x44, 0xd1, 0x17, 0x29, 0x0a, 0x01, 0x00,	// orp U+2200 (∀)
+	0x00, 0x00, 0x10, 0x8a, 0x20, 0x08, 0x0a, 0x01, 0x00,	// orp U+2201 (∁)
+	0x00, 0x00, 0x30, 0x12, 0xc4, 0x49, 0x12, 0x03, 0x00,	// orp U+2202 (∂)
+	0x00, 0x82, 0x7c, 0x18, 0xe5, 0x51, 0xd2, 0x27, 0x08,	// orp U+2204 (∄)
+	0x00, 0x80, 0x20, 0x4e, 0x56, 0x4d, 0x8e, 0x20, 0x00,	// orp U+2205 (∅)
+	0x00, 0x00, 0x7c, 0x51, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2207 (∇)
+	0x00, 0x00, 0x70, 0x42, 0xf0, 0x04, 0x02, 0x07, 0x00,	// orp U+2208 (∈)
+	0x00, 0x41, 0x70, 0x46, 0xf1, 0x14, 0x06, 0x47, 0x10,	// orp U+2209 (∉)
+	0x00, 0x00, 0x00, 0x9c, 0xe0, 0x08, 0x1c, 0x00, 0x00,	// orp U+220A (∊)
+	0x00, 0x00, 0x1c, 0x08, 0xe4, 0x41, 0xc8, 0x01, 0x00,	// orp U+220B (∋)
+	0x00, 0x41, 0x1c, 0x0c, 0xe5, 0x51, 0xcc, 0x41, 0x10,	// orp U+220C (∌)
+	0x00, 0x00, 0x00, 0x0e, 0xc4, 0x41, 0x0e, 0x00, 0x00,	// orp U+220D (∍)
+	0x00, 0x00, 0x00, 0xdf, 0xf7, 0x7d, 0x1f, 0x00, 0x00,	// orp U+220E (∎)
+	0x00, 0xf0, 0x4b, 0x92, 0x24, 0x49, 0x92, 0x74, 0x03,	// orp U+220F (∏)
+	0x00, 0x70, 0x4b, 0x92, 0x24, 0x49, 0x92, 0xf4, 0x03,	// orp U+2210 (∐)
+	0x00, 0xf0, 0x05, 0x02, 0x81, 0x10, 0x42, 0xf0, 0x01,	// orp U+2211 (∑)
+	0x00, 0x00, 0x7c, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+2213 (∓)
+	0x00, 0x00, 0x10, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+2214 (∔)
+	0x00, 0x00, 0x40, 0x08, 0x42, 0x08, 0x42, 0x00, 0x00,	// orp U+2215 (∕)
+	0x00, 0x00, 0x04, 0x82, 0x40, 0x20, 0x08, 0x04, 0x00,	// orp U+2216 (∖)
+	0x00, 0x00, 0x00, 0x44, 0xe5, 0x54, 0x04, 0x00, 0x00,	// orp U+2217 (∗)
+	0x00, 0x00, 0x00, 0x00, 0xa1, 0x10, 0x00, 0x00, 0x00,	// orp U+2218 (∘)
+	0x00, 0x0c, 0x41, 0x10, 0x84, 0x2c, 0x8a, 0x42, 0x10,	// orp U+221A (√)
+	0xe0, 0x48, 0x4a, 0xd4, 0x84, 0x24, 0x89, 0x61, 0x10,	// orp U+221B (∛)
+	0x60, 0x58, 0x5e, 0x14, 0x85, 0x24, 0x89, 0x61, 0x10,	// orp U+221C (∜)
+	0x00, 0x00, 0x00, 0x80, 0x56, 0x14, 0x1a, 0x00, 0x00,	// orp U+221D (∝)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x55, 0x0a, 0x00, 0x00,	// orp U+221E (∞)
+	0x00, 0x00, 0x00, 0x10, 0x42, 0x08, 0x1f, 0x00, 0x00,	// orp U+2220 (∠)
+	0x00, 0x00, 0x00, 0x91, 0x42, 0x28, 0x1f, 0x82, 0x00,	// orp U+2221 (∡)
+	0x00, 0x84, 0x30, 0x52, 0x24, 0x31, 0x08, 0x04, 0x00,	// orp U+2222 (∢)
+	0x00, 0x40, 0x10, 0x14, 0x43, 0x18, 0x05, 0x41, 0x00,	// orp U+2224 (∤)
+	0x00, 0xa0, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x00,	// orp U+2225 (∥)
+	0x00, 0xa0, 0x28, 0x9a, 0xe2, 0x28, 0x8b, 0xa2, 0x00,	// orp U+2226 (∦)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x28, 0x4a, 0x04, 0x00,	// orp U+2227 (∧)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2228 (∨)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x51, 0x04, 0x00,	// orp U+2229 (∩)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+222A (∪)
+	0x00, 0x42, 0x11, 0x04, 0x41, 0x10, 0x44, 0x21, 0x00,	// orp U+222B (∫)
+	0x00, 0x29, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x25,	// orp U+222C (∬)
+	0x80, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2d,	// orp U+222D (∭)
+	0x00, 0x42, 0x11, 0x4e, 0x55, 0x39, 0x44, 0x21, 0x00,	// orp U+222E (∮)
+	0x00, 0x29, 0x49, 0xde, 0x3c, 0xcf, 0x9e, 0x24, 0x25,	// orp U+222F (∯)
+	0x80, 0x5a, 0x55, 0x5f, 0x5d, 0xd7, 0x5f, 0x55, 0x2d,	// orp U+2230 (∰)
+	0x08, 0x45, 0x10, 0x6e, 0xcd, 0x13, 0x04, 0x51, 0x08,	// orp U+2231 (∱)
+	0x08, 0x45, 0x10, 0x6e, 0xdd, 0x57, 0x0e, 0x51, 0x08,	// orp U+2232 (∲)
+	0x08, 0x45, 0x10, 0x4e, 0xd5, 0xd7, 0x2e, 0x51, 0x08,	// orp U+2233 (∳)
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00,	// orp U+2234 (∴)
+	0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x04, 0x00, 0x00,	// orp U+2235 (∵)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,	// orp U+2236 (∶)
+	0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x12, 0x00, 0x00,	// orp U+2237 (∷)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x7c, 0x00, 0x00, 0x00,	// orp U+2238 (∸)
+	0x00, 0x00, 0x00, 0x10, 0x70, 0x00, 0x10, 0x00, 0x00,	// orp U+2239 (∹)
+	0x00, 0x00, 0x00, 0x11, 0xf0, 0x01, 0x11, 0x00, 0x00,	// orp U+223A (∺)
+	0x00, 0x00, 0x00, 0x08, 0x60, 0x35, 0x80, 0x00, 0x00,	// orp U+223B (∻)
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x35, 0x00, 0x00, 0x00,	// orp U+223C (∼)
+	0x00, 0x00, 0x00, 0x00, 0xd0, 0x58, 0x00, 0x00, 0x00,	// orp U+223D (∽)
+	0x00, 0x00, 0x00, 0x52, 0x99, 0x4a, 0x00, 0x00, 0x00,	// orp U+223E (∾)
+	0x00, 0x00, 0x08, 0x45, 0x51, 0x51, 0x14, 0x02, 0x00,	// orp U+223F (∿)
+	0x00, 0x81, 0x20, 0x08, 0x21, 0x08, 0x02, 0x01, 0x00,	// orp U+2240 (≀)
+	0x00, 0x00, 0x00, 0x04, 0x61, 0x35, 0x04, 0x01, 0x00,	// orp U+2241 (≁)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x58, 0x0d, 0x00, 0x00,	// orp U+2242 (≂)
+	0x00, 0x00, 0x00, 0x80, 0xd5, 0x00, 0x1f, 0x00, 0x00,	// orp U+2243 (≃)
+	0x00, 0x00, 0x10, 0x84, 0xd5, 0x10, 0x1f, 0x01, 0x00,	// orp U+2244 (≄)
+	0x00, 0x00, 0x00, 0x56, 0x03, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2245 (≅)
+	0x00, 0x00, 0x58, 0x0d, 0xf0, 0x11, 0x1f, 0x01, 0x00,	// orp U+2246 (≆)
+	0x00, 0x40, 0x58, 0x0d, 0xf1, 0x11, 0x1f, 0x01, 0x00,	// orp U+2247 (≇)
+	0x00, 0x00, 0x00, 0x56, 0x03, 0x58, 0x0d, 0x00, 0x00,	// orp U+2248 (≈)
+	0x00, 0x00, 0x10, 0x56, 0x43, 0x58, 0x0d, 0x01, 0x00,	// orp U+2249 (≉)
+	0x00, 0x00, 0x58, 0x0d, 0x60, 0x35, 0xc0, 0x07, 0x00,	// orp U+224A (≊)
+	0x00, 0x60, 0x35, 0x80, 0xd5, 0x00, 0x56, 0x03, 0x00,	// orp U+224B (≋)
+	0x00, 0x00, 0x58, 0x0d, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+224C (≌)
+	0x00, 0x00, 0x00, 0x91, 0x03, 0x38, 0x11, 0x00, 0x00,	// orp U+224D (≍)
+	0x00, 0x00, 0x00, 0xc4, 0x06, 0x6c, 0x04, 0x00, 0x00,	// orp U+224E (≎)
+	0x00, 0x00, 0x00, 0xc4, 0x06, 0x7c, 0x00, 0x00, 0x00,	// orp U+224F (≏)
+	0x00, 0x00, 0x10, 0xc0, 0x07, 0x7c, 0x00, 0x00, 0x00,	// orp U+2250 (≐)
+	0x00, 0x00, 0x10, 0xc0, 0x07, 0x7c, 0x00, 0x01, 0x00,	// orp U+2251 (≑)
+	0x00, 0x00, 0x04, 0xc0, 0x07, 0x7c, 0x00, 0x04, 0x00,	// orp U+2252 (≒)
+	0x00, 0x00, 0x40, 0xc0, 0x07, 0x7c, 0x40, 0x00, 0x00,	// orp U+2253 (≓)
+	0x00, 0x00, 0x00, 0x40, 0x07, 0x74, 0x00, 0x00, 0x00,	// orp U+2254 (≔)
+	0x00, 0x00, 0x00, 0xc0, 0x05, 0x5c, 0x00, 0x00, 0x00,	// orp U+2255 (≕)
+	0x00, 0x00, 0x00, 0xc0, 0xa7, 0x7c, 0x00, 0x00, 0x00,	// orp U+2256 (≖)
+	0x00, 0x40, 0x28, 0x04, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+2257 (≗)
+	0x00, 0x00, 0x38, 0x11, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+2258 (≘)
+	0x00, 0x00, 0x10, 0x0a, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+2259 (≙)
+	0x00, 0x00, 0x28, 0x04, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+225A (≚)
+	0x40, 0xe5, 0x7c, 0x4e, 0x05, 0x7c, 0xc0, 0x07, 0x00,	// orp U+225B (≛)
+	0x00, 0x40, 0x28, 0xd1, 0x07, 0x7c, 0xc0, 0x07, 0x00,	// orp U+225C (≜)
+	0x00, 0x20, 0x7f, 0x1f, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+225D (≝)
+	0x00, 0xb0, 0x54, 0x15, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+225E (≞)
+	0x00, 0xa1, 0x20, 0x04, 0x40, 0x7c, 0xc0, 0x07, 0x00,	// orp U+225F (≟)
+	0x00, 0x00, 0x20, 0xc8, 0x47, 0x7c, 0x82, 0x00, 0x00,	// orp U+2260 (≠)
+	0x00, 0x00, 0x00, 0x1f, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+2261 (≡)
+	0x00, 0x00, 0x20, 0x1f, 0xf1, 0x11, 0x9f, 0x00, 0x00,	// orp U+2262 (≢)
+	0x00, 0x00, 0x7c, 0xc0, 0x07, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2263 (≣)
+	0x00, 0x00, 0x60, 0x46, 0x60, 0x60, 0xc0, 0x07, 0x00,	// orp U+2264 (≤)
+	0x00, 0x00, 0x0c, 0x0c, 0xc4, 0x0c, 0xc0, 0x07, 0x00,	// orp U+2265 (≥)
+	0x00, 0x00, 0x31, 0x03, 0x03, 0x7d, 0xc0, 0x07, 0x00,	// orp U+2266 (≦)
+	0x00, 0x10, 0x18, 0x98, 0x11, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2267 (≧)
+	0x00, 0x00, 0x31, 0x03, 0x83, 0x7d, 0xc4, 0x27, 0x00,	// orp U+2268 (≨)
+	0x00, 0x10, 0x18, 0x98, 0x91, 0x7c, 0xc4, 0x27, 0x00,	// orp U+2269 (≩)
+	0x00, 0xa0, 0x10, 0x8a, 0xa2, 0x28, 0x84, 0x02, 0x00,	// orp U+226C (≬)
+	0x00, 0x00, 0x10, 0x95, 0x43, 0x38, 0x15, 0x01, 0x00,	// orp U+226D (≭)
+	0x00, 0xc5, 0x10, 0x46, 0x61, 0x10, 0x0c, 0x05, 0x00,	// orp U+226E (≮)
+	0x40, 0x61, 0x10, 0x0c, 0xc5, 0x10, 0x46, 0x01, 0x00,	// orp U+226F (≯)
+	0x00, 0xc1, 0x19, 0x85, 0xc1, 0x11, 0x1f, 0x01, 0x00,	// orp U+2270 (≰)
+	0x00, 0x71, 0x30, 0x14, 0x73, 0x10, 0x1f, 0x01, 0x00,	// orp U+2271 (≱)
+	0x00, 0x80, 0x19, 0x81, 0x81, 0x01, 0x56, 0x03, 0x00,	// orp U+2272 (≲)
+	0x00, 0x30, 0x30, 0x10, 0x33, 0x00, 0x56, 0x03, 0x00,	// orp U+2273 (≳)
+	0x00, 0xc1, 0x19, 0x85, 0xc1, 0x11, 0x56, 0x43, 0x00,	// orp U+2274 (≴)
+	0x00, 0x71, 0x30, 0x14, 0x73, 0x10, 0x56, 0x43, 0x00,	// orp U+2275 (≵)
+	0x00, 0x66, 0x04, 0x06, 0x36, 0x30, 0x10, 0x33, 0x00,	// orp U+2276 (≶)
+	0xc0, 0xc0, 0x40, 0xcc, 0x80, 0x19, 0x81, 0x81, 0x01,	// orp U+2277 (≷)
+	0x08, 0xe6, 0x24, 0x06, 0x77, 0x30, 0x92, 0x33, 0x08,	// orp U+2278 (≸)
+	0xc8, 0xc2, 0x60, 0xcc, 0xc1, 0x19, 0x83, 0xa1, 0x09,	// orp U+2279 (≹)
+	0x00, 0x00, 0x00, 0x10, 0x72, 0x20, 0x10, 0x00, 0x00,	// orp U+227A (≺)
+	0x00, 0x00, 0x00, 0x81, 0xc0, 0x09, 0x01, 0x00, 0x00,	// orp U+227B (≻)
+	0x00, 0x00, 0x40, 0xc8, 0x81, 0x5c, 0x08, 0x04, 0x00,	// orp U+227C (≼)
+	0x00, 0x00, 0x04, 0x02, 0x27, 0x74, 0x42, 0x00, 0x00,	// orp U+227D (≽)
+	0x00, 0x00, 0x21, 0x07, 0x02, 0x01, 0x56, 0x03, 0x00,	// orp U+227E (≾)
+	0x00, 0x10, 0x08, 0x9c, 0x10, 0x00, 0x56, 0x03, 0x00,	// orp U+227F (≿)
+	0x00, 0x00, 0x10, 0x14, 0x73, 0x30, 0x14, 0x01, 0x00,	// orp U+2280 (⊀)
+	0x00, 0x00, 0x10, 0x85, 0xc1, 0x19, 0x05, 0x01, 0x00,	// orp U+2281 (⊁)
+	0x00, 0x00, 0x00, 0x5e, 0x10, 0x04, 0x1e, 0x00, 0x00,	// orp U+2282 (⊂)
+	0x00, 0x00, 0x00, 0x0f, 0x04, 0x41, 0x0f, 0x00, 0x00,	// orp U+2283 (⊃)
+	0x00, 0x00, 0x20, 0x5e, 0x51, 0x14, 0x9e, 0x00, 0x00,	// orp U+2284 (⊄)
+	0x00, 0x00, 0x20, 0x0f, 0x45, 0x51, 0x8f, 0x00, 0x00,	// orp U+2285 (⊅)
+	0x00, 0x00, 0x78, 0x41, 0x10, 0x78, 0xc0, 0x07, 0x00,	// orp U+2286 (⊆)
+	0x00, 0x00, 0x3c, 0x10, 0x04, 0x3d, 0xc0, 0x07, 0x00,	// orp U+2287 (⊇)
+	0x00, 0x40, 0x78, 0x45, 0x51, 0x78, 0xc4, 0x47, 0x00,	// orp U+2288 (⊈)
+	0x00, 0x40, 0x3c, 0x14, 0x45, 0x3d, 0xc4, 0x47, 0x00,	// orp U+2289 (⊉)
+	0x00, 0x00, 0x78, 0x41, 0x10, 0x78, 0xc8, 0x27, 0x00,	// orp U+228A (⊊)
+	0x00, 0x00, 0x3c, 0x10, 0x04, 0x3d, 0xc8, 0x27, 0x00,	// orp U+228B (⊋)
+	0x00, 0x10, 0x55, 0xd7, 0x77, 0x55, 0x91, 0x03, 0x00,	// orp U+228C (⊌)
+	0x00, 0x00, 0x44, 0x51, 0x54, 0x45, 0x91, 0x03, 0x00,	// orp U+228D (⊍)
+	0x00, 0x00, 0x44, 0x51, 0xf5, 0x55, 0x91, 0x03, 0x00,	// orp U+228E (⊎)
+	0x00, 0x00, 0x00, 0x5f, 0x10, 0x04, 0x1f, 0x00, 0x00,	// orp U+228F (⊏)
+	0x00, 0x00, 0x00, 0x1f, 0x04, 0x41, 0x1f, 0x00, 0x00,	// orp U+2290 (⊐)
+	0x00, 0x00, 0x7c, 0x41, 0x10, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2291 (⊑)
+	0x00, 0x00, 0x7c, 0x10, 0x04, 0x7d, 0xc0, 0x07, 0x00,	// orp U+2292 (⊒)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+2294 (⊔)
+	0x00, 0x00, 0x00, 0x4e, 0xf5, 0x55, 0x0e, 0x00, 0x00,	// orp U+2295 (⊕)
+	0x00, 0x00, 0x00, 0x4e, 0xf4, 0x45, 0x0e, 0x00, 0x00,	// orp U+2296 (⊖)
+	0x00, 0x00, 0x00, 0xce, 0x56, 0x6d, 0x0e, 0x00, 0x00,	// orp U+2297 (⊗)
+	0x00, 0x00, 0x00, 0x4e, 0x56, 0x4d, 0x0e, 0x00, 0x00,	// orp U+2298 (⊘)
+	0x00, 0x00, 0x00, 0x4e, 0x54, 0x45, 0x0e, 0x00, 0x00,	// orp U+2299 (⊙)
+	0x00, 0x00, 0x38, 0x51, 0xb5, 0x55, 0x91, 0x03, 0x00,	// orp U+229A (⊚)
+	0x00, 0x00, 0x38, 0xd1, 0x56, 0x6d, 0x91, 0x03, 0x00,	// orp U+229B (⊛)
+	0x00, 0x00, 0x38, 0xd1, 0x17, 0x7d, 0x91, 0x03, 0x00,	// orp U+229C (⊜)
+	0x00, 0x00, 0x00, 0x5f, 0xf5, 0x55, 0x1f, 0x00, 0x00,	// orp U+229E (⊞)
+	0x00, 0x00, 0x00, 0x5f, 0xf4, 0x45, 0x1f, 0x00, 0x00,	// orp U+229F (⊟)
+	0x00, 0x00, 0x00, 0xdf, 0x56, 0x6d, 0x1f, 0x00, 0x00,	// orp U+22A0 (⊠)
+	0x00, 0x00, 0x00, 0x5f, 0x54, 0x45, 0x1f, 0x00, 0x00,	// orp U+22A1 (⊡)
+	0x00, 0x00, 0x04, 0x41, 0xf0, 0x05, 0x41, 0x00, 0x00,	// orp U+22A2 (⊢)
+	0x00, 0x00, 0x40, 0x10, 0xf4, 0x41, 0x10, 0x04, 0x00,	// orp U+22A3 (⊣)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+22A5 (⊥)
+	0x00, 0x00, 0x08, 0x82, 0xe0, 0x08, 0x82, 0x00, 0x00,	// orp U+22A6 (⊦)
+	0x00, 0x00, 0x08, 0x82, 0x23, 0x38, 0x82, 0x00, 0x00,	// orp U+22A7 (⊧)
+	0x00, 0x00, 0x04, 0xc1, 0x17, 0x7c, 0x41, 0x00, 0x00,	// orp U+22A8 (⊨)
+	0x00, 0x00, 0x14, 0x45, 0xd1, 0x15, 0x45, 0x01, 0x00,	// orp U+22A9 (⊩)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x57, 0x55, 0x05, 0x00,	// orp U+22AA (⊪)
+	0x00, 0x00, 0x14, 0x45, 0x5f, 0xf4, 0x45, 0x01, 0x00,	// orp U+22AB (⊫)
+	0x00, 0x00, 0x04, 0x49, 0xf2, 0x15, 0x45, 0x00, 0x00,	// orp U+22AC (⊬)
+	0x00, 0x00, 0x04, 0xc9, 0x57, 0x7c, 0x43, 0x00, 0x00,	// orp U+22AD (⊭)
+	0x00, 0x00, 0x14, 0x55, 0xd5, 0x37, 0x4d, 0x01, 0x00,	// orp U+22AE (⊮)
+	0x00, 0x00, 0x94, 0x65, 0x5f, 0xf5, 0x4d, 0x03, 0x00,	// orp U+22AF (⊯)
+	0x00, 0x00, 0x20, 0x10, 0x72, 0x20, 0x10, 0x02, 0x00,	// orp U+22B0 (⊰)
+	0x00, 0x00, 0x08, 0x81, 0xc0, 0x09, 0x81, 0x00, 0x00,	// orp U+22B1 (⊱)
+	0x00, 0x00, 0x00, 0x98, 0x15, 0x59, 0x18, 0x00, 0x00,	// orp U+22B2 (⊲)
+	0x00, 0x00, 0x00, 0x43, 0x13, 0x35, 0x03, 0x00, 0x00,	// orp U+22B3 (⊳)
+	0x00, 0x00, 0x60, 0x56, 0x64, 0x61, 0xc0, 0x07, 0x00,	// orp U+22B4 (⊴)
+	0x00, 0x00, 0x0c, 0x4d, 0xd4, 0x0c, 0xc0, 0x07, 0x00,	// orp U+22B5 (⊵)
+	0x00, 0x00, 0x00, 0x80, 0xd2, 0x29, 0x00, 0x00, 0x00,	// orp U+22B6 (⊶)
+	0x00, 0x00, 0x00, 0x80, 0x72, 0x29, 0x00, 0x00, 0x00,	// orp U+22B7 (⊷)
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x21, 0x00, 0x00, 0x00,	// orp U+22B8 (⊸)
+	0x00, 0x00, 0x00, 0x04, 0xb1, 0x11, 0x04, 0x00, 0x00,	// orp U+22B9 (⊹)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+22BA (⊺)
+	0x00, 0x00, 0x00, 0x91, 0xa2, 0x10, 0xc0, 0x07, 0x00,	// orp U+22BB (⊻)
+	0x00, 0x00, 0x00, 0x1f, 0x40, 0x28, 0x4a, 0x04, 0x00,	// orp U+22BC (⊼)
+	0x00, 0x00, 0x00, 0x1f, 0x10, 0x29, 0x0a, 0x01, 0x00,	// orp U+22BD (⊽)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0x0c, 0xc5, 0x07, 0x00,	// orp U+22BE (⊾)
+	0x00, 0x00, 0x00, 0x00, 0x84, 0x51, 0xd2, 0x07, 0x00,	// orp U+22BF (⊿)
+	0x00, 0x40, 0x10, 0x84, 0xa2, 0x28, 0x51, 0x14, 0x01,	// orp U+22C0 (⋀)
+	0x00, 0x10, 0x45, 0x91, 0xa2, 0x28, 0x04, 0x41, 0x00,	// orp U+22C1 (⋁)
+	0x00, 0xe0, 0x44, 0x51, 0x14, 0x45, 0x51, 0x14, 0x01,	// orp U+22C2 (⋂)
+	0x00, 0x10, 0x45, 0x51, 0x14, 0x45, 0x51, 0xe4, 0x00,	// orp U+22C3 (⋃)
+	0x00, 0x00, 0x10, 0x84, 0x12, 0x29, 0x04, 0x01, 0x00,	// orp U+22C4 (⋄)
+	0x00, 0x00, 0x10, 0xc4, 0xe7, 0x38, 0x11, 0x00, 0x00,	// orp U+22C6 (⋆)
+	0x00, 0x00, 0x10, 0x91, 0xf2, 0x29, 0x11, 0x01, 0x00,	// orp U+22C7 (⋇)
+	0x00, 0x00, 0x00, 0xd1, 0x56, 0x6d, 0x11, 0x00, 0x00,	// orp U+22C8 (⋈)
+	0x00, 0x00, 0x00, 0xd1, 0x52, 0x2c, 0x11, 0x00, 0x00,	// orp U+22C9 (⋉)
+	0x00, 0x00, 0x00, 0x91, 0x46, 0x69, 0x11, 0x00, 0x00,	// orp U+22CA (⋊)
+	0x00, 0x00, 0x00, 0x81, 0x40, 0x28, 0x11, 0x00, 0x00,	// orp U+22CB (⋋)
+	0x00, 0x00, 0x00, 0x10, 0x42, 0x28, 0x11, 0x00, 0x00,	// orp U+22CC (⋌)
+	0x00, 0x00, 0x00, 0x40, 0x63, 0x01, 0x1f, 0x00, 0x00,	// orp U+22CD (⋍)
+	0x00, 0x00, 0x00, 0x91, 0xa2, 0x10, 0x04, 0x01, 0x00,	// orp U+22CE (⋎)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x28, 0x4a, 0x04, 0x00,	// orp U+22CF (⋏)
+	0x00, 0x00, 0x70, 0x42, 0x56, 0x64, 0x02, 0x07, 0x00,	// orp U+22D0 (⋐)
+	0x00, 0x00, 0x1c, 0xc8, 0x44, 0x4d, 0xc8, 0x01, 0x00,	// orp U+22D1 (⋑)
+	0x00, 0x00, 0x38, 0x51, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+22D2 (⋒)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x91, 0x03, 0x00,	// orp U+22D3 (⋓)
+	0x00, 0x40, 0x10, 0x4e, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+22D4 (⋔)
+	0x00, 0xa0, 0x28, 0x9f, 0xa2, 0x7c, 0x8a, 0x02, 0x00,	// orp U+22D5 (⋕)
+	0x00, 0x00, 0x00, 0x98, 0x11, 0x19, 0x18, 0x00, 0x00,	// orp U+22D6 (⋖)
+	0x00, 0x00, 0x00, 0x03, 0x13, 0x31, 0x03, 0x00, 0x00,	// orp U+22D7 (⋗)
+	0x00, 0x00, 0xa0, 0x94, 0x5a, 0xa9, 0x14, 0x0a, 0x00,	// orp U+22D8 (⋘)
+	0x00, 0x00, 0x14, 0x4a, 0xa5, 0x56, 0x4a, 0x01, 0x00,	// orp U+22D9 (⋙)
+	0x98, 0x11, 0x18, 0x18, 0xf0, 0x0d, 0x0c, 0xc4, 0x0c,	// orp U+22DA (⋚)
+	0x03, 0x03, 0x31, 0x03, 0xf0, 0x61, 0x46, 0x60, 0x60,	// orp U+22DB (⋛)
+	0x00, 0x00, 0x7c, 0x00, 0x66, 0x04, 0x06, 0x06, 0x00,	// orp U+22DC (⋜)
+	0x00, 0x00, 0x7c, 0xc0, 0xc0, 0x40, 0xcc, 0x00, 0x00,	// orp U+22DD (⋝)
+	0x00, 0x00, 0x40, 0xc8, 0x85, 0x1c, 0x08, 0x04, 0x00,	// orp U+22DE (⋞)
+	0x00, 0x00, 0x04, 0x42, 0x27, 0x70, 0x42, 0x00, 0x00,	// orp U+22DF (⋟)
+	0x00, 0x40, 0x50, 0xcc, 0xc1, 0x5c, 0x0c, 0x45, 0x00,	// orp U+22E0 (⋠)
+	0x00, 0x40, 0x14, 0x06, 0x67, 0x74, 0x46, 0x41, 0x00,	// orp U+22E1 (⋡)
+	0x00, 0x40, 0x7c, 0x45, 0xf1, 0x11, 0x1f, 0x01, 0x00,	// orp U+22E2 (⋢)
+	0x00, 0x40, 0x7c, 0x14, 0xf5, 0x11, 0x1f, 0x01, 0x00,	// orp U+22E3 (⋣)
+	0x00, 0x00, 0x7c, 0x41, 0xf0, 0x21, 0x9f, 0x00, 0x00,	// orp U+22E4 (⋤)
+	0x00, 0x00, 0x7c, 0x10, 0xf4, 0x21, 0x9f, 0x00, 0x00,	// orp U+22E5 (⋥)
+	0x00, 0x66, 0x04, 0x06, 0x47, 0x58, 0x0d, 0x41, 0x00,	// orp U+22E6 (⋦)
+	0xc0, 0xc0, 0x40, 0xcc, 0x41, 0x58, 0x0d, 0x41, 0x00,	// orp U+22E7 (⋧)
+	0x00, 0x00, 0x21, 0x07, 0x42, 0x11, 0x56, 0x43, 0x10,	// orp U+22E8 (⋨)
+	0x00, 0x10, 0x08, 0x9c, 0x50, 0x10, 0x56, 0x43, 0x10,	// orp U+22E9 (⋩)
+	0x00, 0x40, 0x10, 0x9c, 0x55, 0x59, 0x1c, 0x41, 0x00,	// orp U+22EA (⋪)
+	0x00, 0x40, 0x10, 0x47, 0x53, 0x35, 0x07, 0x41, 0x00,	// orp U+22EB (⋫)
+	0x00, 0x40, 0x70, 0x56, 0x65, 0x71, 0xc4, 0x47, 0x00,	// orp U+22EC (⋬)
+	0x00, 0x40, 0x1c, 0x4d, 0xd5, 0x1c, 0xc4, 0x47, 0x00,	// orp U+22ED (⋭)
+	0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00,	// orp U+22EE (⋮)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00,	// orp U+22EF (⋯)
+	0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,	// orp U+22F0 (⋰)
+	0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00,	// orp U+22F1 (⋱)
+	0x00, 0x00, 0x70, 0x82, 0xf0, 0x08, 0x02, 0x07, 0x00,	// orp U+22F2 (⋲)
+	0x00, 0x00, 0x70, 0x42, 0xf4, 0x45, 0x02, 0x07, 0x00,	// orp U+22F3 (⋳)
+	0x00, 0x02, 0x70, 0x42, 0xf0, 0x04, 0x02, 0x07, 0x00,	// orp U+22F5 (⋵)
+	0xc0, 0x07, 0x70, 0x42, 0xf0, 0x04, 0x02, 0x07, 0x00,	// orp U+22F6 (⋶)
+	0x00, 0xe0, 0x01, 0x9c, 0xe0, 0x08, 0x1c, 0x00, 0x00,	// orp U+22F7 (⋷)
+	0x00, 0x00, 0x70, 0x42, 0xf0, 0x04, 0x02, 0x07, 0x7c,	// orp U+22F8 (⋸)
+	0x00, 0x00, 0x70, 0xc2, 0x13, 0x3c, 0x02, 0x07, 0x00,	// orp U+22F9 (⋹)
+	0x00, 0x00, 0x1c, 0x08, 0xe2, 0x21, 0xc8, 0x01, 0x00,	// orp U+22FA (⋺)
+	0x00, 0x00, 0x1c, 0x48, 0xf4, 0x45, 0xc8, 0x01, 0x00,	// orp U+22FB (⋻)
+	0x00, 0x00, 0x38, 0x90, 0xe4, 0x49, 0x90, 0x03, 0x00,	// orp U+22FC (⋼)
+	0xc0, 0x07, 0x1c, 0x08, 0xe4, 0x41, 0xc8, 0x01, 0x00,	// orp U+22FD (⋽)
+	0x00, 0xe0, 0x01, 0x0e, 0xc4, 0x41, 0x0e, 0x00, 0x00,	// orp U+22FE (⋾)
+	0x00, 0x00, 0x7c, 0x41, 0xf0, 0x05, 0xc1, 0x07, 0x00,	// orp U+22FF (⋿)
+	0x00, 0x00, 0x00, 0x80, 0x95, 0x54, 0x52, 0x03, 0x00,	// orp U+2300 (⌀)
+	0x00, 0x00, 0x10, 0x4c, 0x65, 0x10, 0x00, 0x00, 0x00,	// orp U+2301 (⌁)
+	0x00, 0x00, 0x10, 0x4a, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+2302 (⌂)
+	0x00, 0xa1, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2303 (⌃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0a, 0x01, 0x00,	// orp U+2304 (⌄)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x10, 0x4a, 0x04, 0x00,	// orp U+2305 (⌅)
+	0x00, 0x00, 0x7c, 0xc0, 0x07, 0x10, 0x4a, 0x04, 0x00,	// orp U+2306 (⌆)
+	0x00, 0x82, 0x10, 0x04, 0x82, 0x10, 0x04, 0x02, 0x00,	// orp U+2307 (⌇)
+	0x00, 0xe0, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x00,	// orp U+2308 (⌈)
+	0x00, 0xe0, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x00,	// orp U+2309 (⌉)
+	0x00, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0xe0, 0x00,	// orp U+230A (⌊)
+	0x00, 0x80, 0x20, 0x08, 0x82, 0x20, 0x08, 0xe2, 0x00,	// orp U+230B (⌋)
+	0x00, 0x00, 0x00, 0x00, 0x46, 0x10, 0x00, 0x00, 0x00,	// orp U+230C (⌌)
+	0x00, 0x00, 0x00, 0xc0, 0x40, 0x10, 0x00, 0x00, 0x00,	// orp U+230D (⌍)
+	0x00, 0x00, 0x10, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+230E (⌎)
+	0x00, 0x00, 0x00, 0x04, 0x31, 0x00, 0x00, 0x00, 0x00,	// orp U+230F (⌏)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x01, 0x00, 0x00,	// orp U+2310 (⌐)
+	0x00, 0x00, 0x00, 0x91, 0xa3, 0x38, 0x11, 0x00, 0x00,	// orp U+2311 (⌑)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x45, 0x00, 0x00, 0x00,	// orp U+2312 (⌒)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x7d, 0x00, 0x00, 0x00,	// orp U+2313 (⌓)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x29, 0x04, 0x00, 0x00,	// orp U+2314 (⌔)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0xd3, 0x03, 0x00,	// orp U+2315 (⌕)
+	0x00, 0x41, 0x38, 0xd5, 0x57, 0x39, 0x04, 0x01, 0x00,	// orp U+2316 (⌖)
+	0x00, 0x00, 0x28, 0x95, 0x43, 0x38, 0x95, 0x02, 0x00,	// orp U+2318 (⌘)
+	0x00, 0x00, 0x00, 0x41, 0xf0, 0x01, 0x00, 0x00, 0x00,	// orp U+2319 (⌙)
+	0x8e, 0xa2, 0x38, 0x55, 0x17, 0x39, 0x8a, 0xe2, 0x00,	// orp U+231A (⌚)
+	0x00, 0xf0, 0x45, 0x0e, 0x41, 0x28, 0xd5, 0x07, 0x00,	// orp U+231B (⌛)
+	0x00, 0x00, 0x00, 0x47, 0x10, 0x00, 0x00, 0x00, 0x00,	// orp U+231C (⌜)
+	0x00, 0x00, 0x70, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00,	// orp U+231D (⌝)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0x1c, 0x00, 0x00, 0x00,	// orp U+231E (⌞)
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x71, 0x00, 0x00, 0x00,	// orp U+231F (⌟)
+	0x00, 0x42, 0x11, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,	// orp U+2320 (⌠)
+	0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x44, 0x21, 0x00,	// orp U+2321 (⌡)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x44, 0x00, 0x00, 0x00,	// orp U+2322 (⌢)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0x00, 0x00, 0x00,	// orp U+2323 (⌣)
+	0x00, 0x00, 0x00, 0xc0, 0x46, 0x28, 0x11, 0x00, 0x00,	// orp U+2324 (⌤)
+	0x00, 0x00, 0x00, 0x00, 0x36, 0x10, 0x18, 0x00, 0x00,	// orp U+2325 (⌥)
+	0x00, 0x00, 0x00, 0xcf, 0x56, 0x6e, 0x0f, 0x00, 0x00,	// orp U+2326 (⌦)
+	0x7f, 0x58, 0x87, 0x75, 0x58, 0x87, 0x75, 0xf8, 0x03,	// orp U+2328 (⌨)
+	0x00, 0x00, 0x00, 0xbc, 0x9d, 0xda, 0x3c, 0x00, 0x00,	// orp U+232B (⌫)
+	0x00, 0x00, 0x10, 0xce, 0x36, 0x6d, 0x0e, 0x01, 0x00,	// orp U+232C (⌬)
+	0x00, 0x00, 0x20, 0x84, 0xb1, 0x31, 0x84, 0x00, 0x00,	// orp U+232D (⌭)
+	0x00, 0xc0, 0x89, 0xba, 0xc9, 0x15, 0xc3, 0x01, 0x00,	// orp U+232E (⌮)
+	0x00, 0x00, 0x00, 0x0e, 0xf0, 0x01, 0x0e, 0x00, 0x00,	// orp U+232F (⌯)
+	0x00, 0x20, 0xfd, 0x92, 0x94, 0x24, 0xc9, 0x03, 0x00,	// orp U+2330 (⌰)
+	0x00, 0x20, 0x08, 0xd5, 0x5f, 0x09, 0x02, 0x00, 0x00,	// orp U+2331 (⌱)
+	0x00, 0x10, 0x1c, 0xd9, 0x9f, 0x1d, 0x01, 0x00, 0x00,	// orp U+2332 (⌲)
+	0x00, 0x00, 0x04, 0x43, 0x91, 0x7c, 0x00, 0x00, 0x00,	// orp U+2333 (⌳)
+	0x00, 0x00, 0x00, 0x40, 0x18, 0x86, 0xe1, 0x0f, 0x00,	// orp U+2334 (⌴)
+	0x00, 0xf0, 0x11, 0x04, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+2336 (⌶)
+	0x80, 0x27, 0x49, 0x92, 0x24, 0x49, 0x92, 0xe4, 0x01,	// orp U+2337 (⌷)
+	0xc0, 0x17, 0x45, 0x5f, 0xf4, 0x45, 0xd1, 0x07, 0x00,	// orp U+2338 (⌸)
+	0xc0, 0x17, 0x55, 0xd1, 0x17, 0x55, 0xd1, 0x07, 0x00,	// orp U+2339 (⌹)
+	0xc0, 0x17, 0x55, 0x5b, 0xb4, 0x55, 0xd1, 0x07, 0x00,	// orp U+233A (⌺)
+	0xc0, 0x17, 0x45, 0xd5, 0x56, 0x45, 0xd1, 0x07, 0x00,	// orp U+233B (⌻)
+	0xc0, 0x17, 0x7d, 0x5b, 0xb4, 0x7d, 0xd1, 0x07, 0x00,	// orp U+233C (⌼)
+	0x00, 0x00, 0x40, 0x08, 0xf2, 0x09, 0x42, 0x00, 0x00,	// orp U+233F (⌿)
+	0x00, 0x00, 0x04, 0x82, 0xf0, 0x21, 0x08, 0x04, 0x00,	// orp U+2340 (⍀)
+	0xc0, 0x97, 0x65, 0x55, 0x55, 0x4d, 0xd3, 0x07, 0x00,	// orp U+2341 (⍁)
+	0xc0, 0x37, 0x4d, 0x55, 0x55, 0x65, 0xd9, 0x07, 0x00,	// orp U+2342 (⍂)
+	0xc0, 0x17, 0x65, 0xd5, 0x54, 0x65, 0xd1, 0x07, 0x00,	// orp U+2343 (⍃)
+	0xc0, 0x17, 0x4d, 0x55, 0x56, 0x4d, 0xd1, 0x07, 0x00,	// orp U+2344 (⍄)
+	0x00, 0x00, 0x20, 0x88, 0xf2, 0x29, 0x08, 0x02, 0x00,	// orp U+2345 (⍅)
+	0x00, 0x00, 0x08, 0x82, 0xf2, 0x29, 0x82, 0x00, 0x00,	// orp U+2346 (⍆)
+	0xc0, 0x17, 0x55, 0xd3, 0x37, 0x55, 0xd1, 0x07, 0x00,	// orp U+2347 (⍇)
+	0xc0, 0x17, 0x55, 0xd9, 0x97, 0x55, 0xd1, 0x07, 0x00,	// orp U+2348 (⍈)
+	0x40, 0x10, 0x38, 0x53, 0x95, 0x39, 0x10, 0x04, 0x00,	// orp U+2349 (⍉)
+	0x00, 0x40, 0x10, 0x04, 0x41, 0x10, 0x1f, 0xf0, 0x01,	// orp U+234A (⍊)
+	0x00, 0x41, 0x10, 0x8e, 0x53, 0x55, 0x1f, 0x41, 0x00,	// orp U+234B (⍋)
+	0xc0, 0x17, 0x45, 0xdb, 0x56, 0x55, 0xd1, 0x07, 0x00,	// orp U+234C (⍌)
+	0xc0, 0x17, 0x55, 0xd5, 0xb6, 0x7d, 0xd1, 0x07, 0x00,	// orp U+234D (⍍)
+	0x00, 0x41, 0x38, 0x55, 0x55, 0x39, 0xc4, 0x07, 0x00,	// orp U+234E (⍎)
+	0x00, 0xe1, 0x54, 0xc4, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+234F (⍏)
+	0xc0, 0x57, 0x7d, 0x55, 0x55, 0x55, 0xd5, 0x07, 0x00,	// orp U+2350 (⍐)
+	0xc0, 0x07, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+2351 (⍑)
+	0x00, 0x41, 0x7c, 0x95, 0xe3, 0x10, 0x04, 0x41, 0x00,	// orp U+2352 (⍒)
+	0xc0, 0x17, 0x55, 0xd5, 0xb6, 0x45, 0xd1, 0x07, 0x00,	// orp U+2353 (⍓)
+	0xc0, 0x17, 0x7d, 0xdb, 0x56, 0x55, 0xd1, 0x07, 0x00,	// orp U+2354 (⍔)
+	0xc0, 0x47, 0x10, 0x4e, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+2355 (⍕)
+	0x00, 0x41, 0x10, 0xc4, 0x47, 0x54, 0x0e, 0x01, 0x00,	// orp U+2356 (⍖)
+	0xc0, 0x57, 0x55, 0x55, 0x55, 0x7d, 0xd5, 0x07, 0x00,	// orp U+2357 (⍗)
+	0x00, 0x40, 0x10, 0x04, 0x00, 0x00, 0x00, 0xf0, 0x01,	// orp U+2358 (⍘)
+	0x00, 0x40, 0x10, 0x8a, 0x12, 0x45, 0x1f, 0xf0, 0x01,	// orp U+2359 (⍙)
+	0x00, 0x00, 0x00, 0x84, 0x12, 0x29, 0x04, 0xf0, 0x01,	// orp U+235A (⍚)
+	0x00, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0xf0, 0x01,	// orp U+235B (⍛)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x39, 0x00, 0xf0, 0x01,	// orp U+235C (⍜)
+	0x00, 0x00, 0x38, 0x51, 0xb5, 0x55, 0x51, 0x04, 0x00,	// orp U+235D (⍝)
+	0xc0, 0x57, 0x55, 0x55, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+235E (⍞)
+	0x00, 0xe0, 0x44, 0xd5, 0x57, 0x6d, 0x91, 0x03, 0x00,	// orp U+235F (⍟)
+	0xc0, 0x17, 0x55, 0x51, 0x14, 0x55, 0xd1, 0x07, 0x00,	// orp U+2360 (⍠)
+	0x80, 0x02, 0x7c, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+2361 (⍡)
+	0x80, 0x02, 0x7c, 0x51, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2362 (⍢)
+	0x80, 0x02, 0x10, 0xc4, 0xe7, 0x38, 0x11, 0x00, 0x00,	// orp U+2363 (⍣)
+	0x80, 0x02, 0x00, 0x00, 0xa1, 0x10, 0x00, 0x00, 0x00,	// orp U+2364 (⍤)
+	0x80, 0x02, 0x00, 0x4e, 0x14, 0x45, 0x0e, 0x00, 0x00,	// orp U+2365 (⍥)
+	0x00, 0x50, 0x55, 0x55, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+2366 (⍦)
+	0x00, 0x80, 0x20, 0x5e, 0x92, 0x24, 0x1e, 0x82, 0x00,	// orp U+2367 (⍧)
+	0x80, 0x02, 0x00, 0x80, 0xd5, 0x00, 0x00, 0x00, 0x00,	// orp U+2368 (⍨)
+	0x80, 0x02, 0x00, 0x03, 0x03, 0x31, 0x03, 0x00, 0x00,	// orp U+2369 (⍩)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x0c, 0x21, 0x00,	// orp U+236A (⍪)
+	0x00, 0x00, 0x7c, 0x51, 0xe4, 0x6f, 0x05, 0x01, 0x00,	// orp U+236B (⍫)
+	0x00, 0x00, 0x38, 0x51, 0x74, 0x75, 0x91, 0x03, 0x00,	// orp U+236C (⍬)
+	0x00, 0x40, 0x10, 0x84, 0xd5, 0x10, 0x04, 0x01, 0x00,	// orp U+236D (⍭)
+	0x00, 0x00, 0x00, 0x00, 0xe1, 0x10, 0x00, 0xf3, 0x09,	// orp U+236E (⍮)
+	0xc0, 0x17, 0x65, 0x5f, 0xf5, 0x4d, 0xd1, 0x07, 0x00,	// orp U+236F (⍯)
+	0xc0, 0x57, 0x6d, 0x59, 0x15, 0x55, 0xd1, 0x07, 0x00,	// orp U+2370 (⍰)
+	0x00, 0x10, 0x75, 0x57, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2371 (⍱)
+	0x00, 0x40, 0x10, 0x8a, 0x12, 0x5d, 0x5d, 0x04, 0x00,	// orp U+2372 (⍲)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x10, 0x04, 0x02, 0x00,	// orp U+2373 (⍳)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0xd1, 0x13, 0x04,	// orp U+2374 (⍴)
+	0x00, 0x00, 0x00, 0x56, 0x92, 0x24, 0x16, 0xf0, 0x01,	// orp U+2376 (⍶)
+	0x00, 0x00, 0x00, 0x4e, 0x64, 0x44, 0x0e, 0xf0, 0x01,	// orp U+2377 (⍷)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x08, 0xf0, 0x01,	// orp U+2378 (⍸)
+	0x00, 0x00, 0x00, 0x4a, 0x54, 0x55, 0x0a, 0xf0, 0x01,	// orp U+2379 (⍹)
+	0x00, 0x00, 0x82, 0x10, 0x8f, 0x24, 0x06, 0x01, 0x00,	// orp U+237B (⍻)
+	0x86, 0x30, 0x18, 0xc2, 0x60, 0x28, 0xff, 0x70, 0x00,	// orp U+237C (⍼)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x92, 0x07, 0x00,	// orp U+237D (⍽)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x7d, 0xca, 0x06, 0x00,	// orp U+237E (⍾)
+	0x00, 0x41, 0x38, 0xdf, 0xf7, 0x39, 0x04, 0x01, 0x00,	// orp U+237F (⍿)
+	0x00, 0x00, 0x38, 0x90, 0x17, 0x79, 0x40, 0xa4, 0x10,	// orp U+2380 (⎀)
+	0x00, 0x00, 0x00, 0x80, 0x81, 0x38, 0x89, 0x0b, 0xfc,	// orp U+2381 (⎁)
+	0x00, 0x00, 0x00, 0x80, 0x44, 0xda, 0xad, 0x0d, 0xd8,	// orp U+2382 (⎂)
+	0x00, 0x00, 0x00, 0x61, 0x89, 0xb4, 0x4a, 0x1b, 0x02,	// orp U+2383 (⎃)
+	0x00, 0x00, 0x00, 0xdf, 0xba, 0xae, 0x1f, 0x00, 0x00,	// orp U+2384 (⎄)
+	0x00, 0x40, 0x7c, 0x55, 0x55, 0x55, 0x1f, 0x01, 0x00,	// orp U+2385 (⎅)
+	0x00, 0x40, 0x28, 0x11, 0xf9, 0x92, 0x91, 0x42, 0x00,	// orp U+2386 (⎆)
+	0x00, 0x00, 0x00, 0x10, 0x4e, 0x09, 0x39, 0x00, 0x00,	// orp U+2387 (⎇)
+	0x00, 0x00, 0x10, 0x95, 0x53, 0x39, 0x15, 0x01, 0x00,	// orp U+2388 (⎈)
+	0x00, 0x00, 0x00, 0x5e, 0x18, 0xce, 0xad, 0x07, 0x00,	// orp U+2389 (⎉)
+	0x00, 0x00, 0x78, 0xe1, 0x3f, 0xb7, 0xa1, 0x07, 0x00,	// orp U+238A (⎊)
+	0x00, 0x00, 0x00, 0xd7, 0x58, 0xa2, 0xa1, 0x07, 0x00,	// orp U+238B (⎋)
+	0x00, 0x00, 0x00, 0xcf, 0x04, 0x28, 0x95, 0x02, 0x00,	// orp U+238C (⎌)
+	0x00, 0x00, 0x00, 0x8e, 0xa2, 0x28, 0x1b, 0x00, 0x00,	// orp U+238D (⎍)
+	0x00, 0x00, 0x00, 0x9e, 0xa2, 0x28, 0x0f, 0x00, 0x00,	// orp U+238E (⎎)
+	0x00, 0x00, 0x7c, 0x84, 0x12, 0x29, 0x04, 0x00, 0x00,	// orp U+238F (⎏)
+	0x00, 0x00, 0x10, 0x4a, 0xa4, 0x10, 0x1f, 0x00, 0x00,	// orp U+2390 (⎐)
+	0x00, 0x00, 0x7c, 0x84, 0xf2, 0x29, 0x04, 0x00, 0x00,	// orp U+2391 (⎑)
+	0x00, 0x00, 0x10, 0xca, 0xa7, 0x10, 0x1f, 0x00, 0x00,	// orp U+2392 (⎒)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x54, 0x00, 0x00, 0x00,	// orp U+2393 (⎓)
+	0x00, 0x00, 0x00, 0x8c, 0x14, 0x4a, 0x0c, 0x00, 0x00,	// orp U+2394 (⎔)
+	0xc0, 0x17, 0x45, 0x51, 0x14, 0x45, 0x51, 0xf4, 0x01,	// orp U+2395 (⎕)
+	0x00, 0xe0, 0x39, 0x8e, 0x61, 0x08, 0x02, 0x00, 0x00,	// orp U+2396 (⎖)
+	0x15, 0xd0, 0x93, 0x21, 0xf9, 0x93, 0x21, 0xc9, 0x03,	// orp U+2397 (⎗)
+	0x5f, 0xb0, 0x06, 0x61, 0xf2, 0x27, 0x61, 0xa0, 0x02,	// orp U+2398 (⎘)
+	0x00, 0xc0, 0x59, 0xd2, 0x3c, 0xcf, 0xff, 0x0f, 0x00,	// orp U+2399 (⎙)
+	0x00, 0x00, 0x78, 0xe5, 0x5a, 0xa7, 0x1e, 0x00, 0x00,	// orp U+239A (⎚)
+	0x00, 0x42, 0x10, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,	// orp U+239B (⎛)
+	0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,	// orp U+239C (⎜)
+	0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x04, 0x81, 0x00,	// orp U+239D (⎝)
+	0x80, 0x40, 0x10, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,	// orp U+239E (⎞)
+	0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,	// orp U+239F (⎟)
+	0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x04, 0x21, 0x00,	// orp U+23A0 (⎠)
+	0x80, 0x23, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08,	// orp U+23A1 (⎡)
+	0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0xe0, 0x00,	// orp U+23A3 (⎣)
+	0x80, 0x83, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20,	// orp U+23A4 (⎤)
+	0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0xe2, 0x00,	// orp U+23A6 (⎦)
+	0x00, 0x46, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,	// orp U+23A7 (⎧)
+	0x04, 0x41, 0x10, 0xc4, 0x40, 0x10, 0x04, 0x41, 0x10,	// orp U+23A8 (⎨)
+	0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x81, 0x01,	// orp U+23A9 (⎩)
+	0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,	// orp U+23AA (⎪)
+	0xc0, 0x40, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,	// orp U+23AB (⎫)
+	0x04, 0x41, 0x10, 0x04, 0x46, 0x10, 0x04, 0x41, 0x10,	// orp U+23AC (⎬)
+	0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x31, 0x00,	// orp U+23AD (⎭)
+	0x18, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x0c,	// orp U+23B0 (⎰)
+	0x03, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x60,	// orp U+23B1 (⎱)
+	0xc0, 0x1f, 0x04, 0x82, 0x20, 0x10, 0x04, 0x81, 0x20,	// orp U+23B2 (⎲)
+	0x08, 0x42, 0x10, 0x84, 0x20, 0x08, 0x41, 0xf0, 0x03,	// orp U+23B3 (⎳)
+	0xc0, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+23B4 (⎴)
+	0x00, 0x00, 0x44, 0x1f, 0x00, 0x7c, 0x11, 0x00, 0x00,	// orp U+23B6 (⎶)
+	0x04, 0x41, 0x10, 0x45, 0x61, 0x18, 0x04, 0x01, 0x00,	// orp U+23B7 (⎷)
+	0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04,	// orp U+23B8 (⎸)
+	0x20, 0x08, 0x82, 0x20, 0x08, 0x82, 0x20, 0x08, 0x82,	// orp U+23B9 (⎹)
+	0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+23BA (⎺)
+	0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+23BB (⎻)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,	// orp U+23BC (⎼)
+	0x00, 0xf0, 0x05, 0x41, 0x10, 0x04, 0x41, 0x00, 0x00,	// orp U+23BE (⎾)
+	0x00, 0x10, 0x04, 0x41, 0x10, 0x04, 0xc1, 0x07, 0x00,	// orp U+23BF (⎿)
+	0xc0, 0x47, 0x38, 0x55, 0x55, 0x39, 0x04, 0x01, 0x00,	// orp U+23C1 (⏁)
+	0x00, 0x41, 0x10, 0x8e, 0x53, 0x7d, 0x04, 0x01, 0x00,	// orp U+23C3 (⏃)
+	0xc0, 0x47, 0x10, 0x8e, 0x53, 0x7d, 0x04, 0x01, 0x00,	// orp U+23C4 (⏄)
+	0x00, 0x41, 0x10, 0x8e, 0x53, 0x7d, 0xc4, 0x07, 0x00,	// orp U+23C5 (⏅)
+	0x00, 0xf0, 0x11, 0x84, 0xd5, 0x10, 0x04, 0x01, 0x00,	// orp U+23C7 (⏇)
+	0x00, 0x40, 0x10, 0x84, 0xd5, 0x10, 0xc4, 0x07, 0x00,	// orp U+23C8 (⏈)
+	0x00, 0xf0, 0x11, 0x04, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+23C9 (⏉)
+	0x00, 0x40, 0x10, 0x04, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+23CA (⏊)
+	0x00, 0xf0, 0x41, 0x10, 0x04, 0x41, 0x10, 0x04, 0x00,	// orp U+23CB (⏋)
+	0x00, 0x00, 0x41, 0x10, 0x04, 0x41, 0xd0, 0x07, 0x00,	// orp U+23CC (⏌)
+	0x00, 0x40, 0x54, 0x55, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+23CD (⏍)
+	0x00, 0x80, 0x61, 0x18, 0xa6, 0x7d, 0x8f, 0x00, 0x00,	// orp U+23CE (⏎)
+	0x00, 0x00, 0x10, 0xce, 0x07, 0x7c, 0x1f, 0x00, 0x00,	// orp U+23CF (⏏)
+	0x00, 0x00, 0x00, 0x1f, 0x10, 0x39, 0x00, 0x00, 0x00,	// orp U+23D2 (⏒)
+	0x00, 0x00, 0x00, 0x40, 0xe4, 0x00, 0x1f, 0x00, 0x00,	// orp U+23D3 (⏓)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0xb4, 0x12, 0x00, 0x00,	// orp U+23D4 (⏔)
+	0x00, 0x00, 0x00, 0x40, 0x2b, 0x01, 0x3f, 0x00, 0x00,	// orp U+23D5 (⏕)
+	0x00, 0x00, 0x00, 0x00, 0xd0, 0x4a, 0x00, 0x00, 0x00,	// orp U+23D6 (⏖)
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x7d, 0x00, 0x00, 0x00,	// orp U+23D7 (⏗)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x7d, 0x00, 0x00, 0x00,	// orp U+23D8 (⏘)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x7d, 0x00, 0x00, 0x00,	// orp U+23D9 (⏙)
+	0x00, 0x40, 0x10, 0x04, 0xf1, 0x01, 0x0e, 0x40, 0x00,	// orp U+23DA (⏚)
+	0x00, 0x00, 0x00, 0x9e, 0xf4, 0x4b, 0x1e, 0x00, 0x00,	// orp U+23DB (⏛)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x08, 0x00,	// orp U+23DC (⏜)
+	0x00, 0x00, 0x84, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+23DD (⏝)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x73, 0x08, 0x00,	// orp U+23DE (⏞)
+	0x00, 0x00, 0x84, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+23DF (⏟)
+	0x00, 0x00, 0x00, 0xc0, 0x91, 0x44, 0xe1, 0x0f, 0x00,	// orp U+23E2 (⏢)
+	0x00, 0xc0, 0x78, 0x73, 0x38, 0x7b, 0x0c, 0x00, 0x00,	// orp U+23E3 (⏣)
+	0x00, 0x00, 0x00, 0xbe, 0x18, 0x7d, 0x00, 0x00, 0x00,	// orp U+23E5 (⏥)
+	0x00, 0x00, 0x00, 0x42, 0xf1, 0xa3, 0x10, 0x00, 0x00,	// orp U+23E6 (⏦)
+	0x00, 0x00, 0x14, 0x65, 0xd5, 0x30, 0x52, 0x08, 0x00,	// orp U+23E7 (⏧)
+	0xc9, 0xd2, 0x24, 0x8a, 0xe2, 0x10, 0x04, 0xc1, 0x01,	// orp U+2400 (␀)
+	0x46, 0x20, 0x10, 0x87, 0xa2, 0x10, 0x14, 0x47, 0x01,	// orp U+2401 (␁)
+	0x46, 0x20, 0x10, 0x83, 0x43, 0x10, 0x14, 0x42, 0x01,	// orp U+2402 (␂)
+	0x47, 0x30, 0x04, 0x87, 0x43, 0x10, 0x14, 0x42, 0x01,	// orp U+2403 (␃)
+	0x47, 0x30, 0x04, 0x87, 0xa2, 0x10, 0x1c, 0x82, 0x00,	// orp U+2404 (␄)
+	0x47, 0x30, 0x04, 0x97, 0xa5, 0x49, 0x08, 0x45, 0x61,	// orp U+2405 (␅)
+	0x42, 0x71, 0x14, 0x8c, 0xc0, 0x00, 0x14, 0x43, 0x01,	// orp U+2406 (␆)
+	0x43, 0x31, 0x14, 0x8f, 0x60, 0x08, 0x0e, 0x41, 0x70,	// orp U+2407 (␇)
+	0xc0, 0x50, 0x0c, 0xc5, 0x80, 0x11, 0x08, 0xc4, 0x00,	// orp U+2408 (␈)
+	0x40, 0x51, 0x1c, 0x45, 0x87, 0x20, 0x08, 0x02, 0x00,	// orp U+2409 (␉)
+	0x40, 0x10, 0x04, 0x07, 0xc0, 0x11, 0x0c, 0x01, 0x00,	// orp U+240A (␊)
+	0x40, 0x51, 0x14, 0x82, 0x87, 0x20, 0x08, 0x02, 0x00,	// orp U+240B (␋)
+	0x00, 0x70, 0x04, 0x43, 0x57, 0x30, 0x04, 0x01, 0x00,	// orp U+240C (␌)
+	0x80, 0x11, 0x04, 0x81, 0x43, 0x31, 0x14, 0x05, 0x00,	// orp U+240D (␍)
+	0x80, 0x11, 0x08, 0xc4, 0x42, 0x51, 0x14, 0x02, 0x00,	// orp U+240E (␎)
+	0x80, 0x11, 0x08, 0xc4, 0xc0, 0x21, 0x08, 0x07, 0x00,	// orp U+240F (␏)
+	0x43, 0x51, 0x0c, 0x82, 0xe0, 0x70, 0x04, 0x43, 0x70,	// orp U+2410 (␐)
+	0x43, 0x51, 0x0c, 0x8c, 0xc0, 0x00, 0x08, 0x83, 0x70,	// orp U+2411 (␑)
+	0x43, 0x51, 0x0c, 0x8c, 0xc0, 0x00, 0x0c, 0x84, 0x70,	// orp U+2412 (␒)
+	0x43, 0x51, 0x0c, 0x8c, 0xc0, 0x30, 0x10, 0x02, 0x31,	// orp U+2413 (␓)
+	0x43, 0x51, 0x0c, 0x8c, 0xc0, 0x00, 0x04, 0xc5, 0x41,	// orp U+2414 (␔)
+	0xc9, 0xd2, 0x00, 0x84, 0xe2, 0x28, 0x00, 0xc5, 0x50,	// orp U+2415 (␕)
+	0x46, 0x20, 0x10, 0x83, 0xa2, 0x10, 0x84, 0x64, 0x69,	// orp U+2416 (␖)
+	0x47, 0x30, 0x04, 0x87, 0x43, 0x70, 0x2c, 0x86, 0x62,	// orp U+2417 (␗)
+	0x46, 0x60, 0x00, 0x84, 0xe2, 0x28, 0x80, 0xa5, 0x49,	// orp U+2418 (␘)
+	0xc0, 0x11, 0x0c, 0xc1, 0x01, 0x28, 0x8e, 0xa2, 0x00,	// orp U+2419 (␙)
+	0x46, 0x20, 0x1c, 0x8a, 0x42, 0x70, 0x28, 0x86, 0x62,	// orp U+241A (␚)
+	0x47, 0x30, 0x04, 0x8f, 0x40, 0x38, 0x00, 0x46, 0x60,	// orp U+241B (␛)
+	0xc0, 0x11, 0x0c, 0x41, 0x46, 0x20, 0x10, 0x03, 0x00,	// orp U+241C (␜)
+	0x4e, 0xd0, 0x24, 0x06, 0x46, 0x20, 0x10, 0x03, 0x00,	// orp U+241D (␝)
+	0x43, 0x31, 0x14, 0x05, 0x46, 0x20, 0x10, 0x03, 0x00,	// orp U+241E (␞)
+	0x40, 0x92, 0x24, 0x06, 0x46, 0x20, 0x10, 0x03, 0x00,	// orp U+241F (␟)
+	0x80, 0x11, 0x08, 0xc4, 0xc0, 0x50, 0x0c, 0x01, 0x00,	// orp U+2420 (␠)
+	0x43, 0x51, 0x3c, 0x82, 0x21, 0x38, 0x04, 0xc1, 0x01,	// orp U+2421 (␡)
+	0x00, 0xa0, 0x18, 0xc2, 0x23, 0x49, 0x92, 0x03, 0x00,	// orp U+2422 (␢)
+	0x00, 0x90, 0x2c, 0x4d, 0xd2, 0x10, 0x04, 0x07, 0x00,	// orp U+2424 (␤)
+	0x00, 0x20, 0x49, 0x49, 0x41, 0x49, 0x49, 0x02, 0x00,	// orp U+2425 (␥)
+	0x00, 0xe0, 0x44, 0x81, 0x40, 0x10, 0x00, 0x01, 0x00,	// orp U+2426 (␦)
+	0x00, 0xc0, 0x51, 0x14, 0x41, 0x14, 0xc5, 0x01, 0x00,	// orp U+2440 (⑀)
+	0x00, 0x00, 0x41, 0x10, 0xf4, 0x45, 0x51, 0x04, 0x00,	// orp U+2441 (⑁)
+	0x00, 0x10, 0x45, 0x51, 0xf4, 0x11, 0x04, 0x01, 0x00,	// orp U+2442 (⑂)
+	0x00, 0x40, 0x10, 0xc4, 0x17, 0x45, 0x51, 0x04, 0x00,	// orp U+2443 (⑃)
+	0x00, 0xf0, 0x55, 0x15, 0x41, 0x54, 0xd5, 0x07, 0x00,	// orp U+2444 (⑄)
+	0x00, 0x00, 0x44, 0x5b, 0xb5, 0x45, 0x00, 0x00, 0x00,	// orp U+2445 (⑅)
+	0x00, 0x80, 0x61, 0xdb, 0x30, 0x6c, 0x18, 0x06, 0x00,	// orp U+2446 (⑆)
+	0x00, 0x00, 0x41, 0x10, 0x41, 0x04, 0x41, 0x00, 0x00,	// orp U+2447 (⑇)
+	0x00, 0x00, 0xc0, 0x75, 0x5d, 0x17, 0x05, 0x00, 0x00,	// orp U+2448 (⑈)
+	0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,	// orp U+2449 (⑉)
+	0x00, 0x50, 0x14, 0x8a, 0x42, 0x51, 0x28, 0x0a, 0x00,	// orp U+244A (⑊)
+	0x80, 0x13, 0x55, 0x57, 0x55, 0x7d, 0x91, 0x03, 0x00,	// orp U+2460 (①)
+	0x80, 0x13, 0x55, 0x5b, 0x56, 0x7d, 0x91, 0x03, 0x00,	// orp U+2461 (②)
+	0x80, 0x13, 0x5d, 0x59, 0x95, 0x5d, 0x91, 0x03, 0x00,	// orp U+2462 (③)
+	0x80, 0x13, 0x4d, 0xd3, 0xf5, 0x55, 0x91, 0x03, 0x00,	// orp U+2463 (④)
+	0x80, 0x13, 0x7d, 0xd3, 0x95, 0x5d, 0x91, 0x03, 0x00,	// orp U+2464 (⑤)
+	0x80, 0x13, 0x75, 0xd3, 0xb5, 0x55, 0x91, 0x03, 0x00,	// orp U+2465 (⑥)
+	0x80, 0x13, 0x7d, 0x59, 0x55, 0x55, 0x91, 0x03, 0x00,	// orp U+2466 (⑦)
+	0x80, 0x13, 0x55, 0x5b, 0xb5, 0x55, 0x91, 0x03, 0x00,	// orp U+2467 (⑧)
+	0x80, 0x13, 0x55, 0x5b, 0x97, 0x5d, 0x91, 0x03, 0x00,	// orp U+2468 (⑨)
+	0x80, 0x17, 0xae, 0xf7, 0x7d, 0xaf, 0xa1, 0x07, 0x00,	// orp U+2469 (⑩)
+	0x80, 0x17, 0xae, 0xeb, 0xba, 0xae, 0xa1, 0x07, 0x00,	// orp U+246A (⑪)
+	0x80, 0x17, 0xae, 0xf3, 0xbc, 0xee, 0xa1, 0x07, 0x00,	// orp U+246B (⑫)
+	0x80, 0x17, 0xae, 0xf3, 0x3a, 0xaf, 0xa1, 0x07, 0x00,	// orp U+246C (⑬)
+	0x80, 0x17, 0xae, 0xeb, 0xbe, 0xcf, 0xa1, 0x07, 0x00,	// orp U+246D (⑭)
+	0x80, 0x17, 0xee, 0xeb, 0x3e, 0xef, 0xa1, 0x07, 0x00,	// orp U+246E (⑮)
+	0x80, 0x17, 0xae, 0xeb, 0xbe, 0xce, 0xa1, 0x07, 0x00,	// orp U+246F (⑯)
+	0x80, 0x17, 0xee, 0xf3, 0xba, 0xae, 0xa1, 0x07, 0x00,	// orp U+2470 (⑰)
+	0x80, 0x17, 0xce, 0xeb, 0xbc, 0xce, 0xa1, 0x07, 0x00,	// orp U+2471 (⑱)
+	0x80, 0x17, 0xce, 0xeb, 0x3c, 0xee, 0xa1, 0x07, 0x00,	// orp U+2472 (⑲)
+	0x80, 0x17, 0xde, 0x6d, 0xbb, 0xde, 0xa1, 0x07, 0x00,	// orp U+2473 (⑳)
+	0x80, 0x12, 0x55, 0x57, 0x55, 0x7d, 0x91, 0x02, 0x00,	// orp U+2474 (⑴)
+	0x80, 0x12, 0x55, 0x5b, 0x56, 0x7d, 0x91, 0x02, 0x00,	// orp U+2475 (⑵)
+	0x80, 0x12, 0x5d, 0x59, 0x95, 0x5d, 0x91, 0x02, 0x00,	// orp U+2476 (⑶)
+	0x80, 0x12, 0x4d, 0xd3, 0xf5, 0x55, 0x91, 0x02, 0x00,	// orp U+2477 (⑷)
+	0x80, 0x12, 0x7d, 0xd3, 0x95, 0x5d, 0x91, 0x02, 0x00,	// orp U+2478 (⑸)
+	0x80, 0x12, 0x75, 0xd3, 0xb5, 0x55, 0x91, 0x02, 0x00,	// orp U+2479 (⑹)
+	0x80, 0x12, 0x7d, 0x59, 0x55, 0x55, 0x91, 0x02, 0x00,	// orp U+247A (⑺)
+	0x80, 0x12, 0x55, 0x5b, 0xb5, 0x55, 0x91, 0x02, 0x00,	// orp U+247B (⑻)
+	0x80, 0x12, 0x55, 0x5b, 0x97, 0x5d, 0x91, 0x02, 0x00,	// orp U+247C (⑼)
+	0x80, 0x14, 0xae, 0xf7, 0x7d, 0xaf, 0xa1, 0x04, 0x00,	// orp U+247D (⑽)
+	0x80, 0x14, 0xae, 0xeb, 0xba, 0xae, 0xa1, 0x04, 0x00,	// orp U+247E (⑾)
+	0x80, 0x14, 0xae, 0xf3, 0xbc, 0xee, 0xa1, 0x04, 0x00,	// orp U+247F (⑿)
+	0x80, 0x14, 0xae, 0xf3, 0x3a, 0xaf, 0xa1, 0x04, 0x00,	// orp U+2480 (⒀)
+	0x80, 0x14, 0xae, 0xeb, 0xbe, 0xcf, 0xa1, 0x04, 0x00,	// orp U+2481 (⒁)
+	0x80, 0x14, 0xee, 0xeb, 0x3e, 0xef, 0xa1, 0x04, 0x00,	// orp U+2482 (⒂)
+	0x80, 0x14, 0xae, 0xeb, 0xbe, 0xce, 0xa1, 0x04, 0x00,	// orp U+2483 (⒃)
+	0x80, 0x14, 0xee, 0xf3, 0xba, 0xae, 0xa1, 0x04, 0x00,	// orp U+2484 (⒄)
+	0x80, 0x14, 0xce, 0xeb, 0xbc, 0xce, 0xa1, 0x04, 0x00,	// orp U+2485 (⒅)
+	0x80, 0x14, 0xce, 0xeb, 0x3c, 0xee, 0xa1, 0x04, 0x00,	// orp U+2486 (⒆)
+	0x80, 0x14, 0xde, 0x6d, 0xbb, 0xde, 0xa1, 0x04, 0x00,	// orp U+2487 (⒇)
+	0x00, 0x00, 0x10, 0x06, 0x41, 0x10, 0x84, 0x0b, 0x00,	// orp U+2488 (⒈)
+	0x00, 0x00, 0x18, 0x08, 0x42, 0x10, 0xc2, 0x0b, 0x00,	// orp U+2489 (⒉)
+	0x00, 0x00, 0x18, 0x09, 0x62, 0x20, 0xc8, 0x09, 0x00,	// orp U+248A (⒊)
+	0x00, 0x00, 0x08, 0x42, 0x92, 0x7c, 0x08, 0x0a, 0x00,	// orp U+248B (⒋)
+	0x00, 0x00, 0x3c, 0xc1, 0x81, 0x20, 0x89, 0x09, 0x00,	// orp U+248C (⒌)
+	0x00, 0x00, 0x30, 0x42, 0x70, 0x24, 0x89, 0x09, 0x00,	// orp U+248D (⒍)
+	0x00, 0x00, 0x7c, 0x10, 0x84, 0x20, 0x04, 0x09, 0x00,	// orp U+248E (⒎)
+	0x00, 0x00, 0x18, 0x49, 0x62, 0x24, 0x89, 0x09, 0x00,	// orp U+248F (⒏)
+	0x00, 0x00, 0x18, 0x49, 0xe2, 0x20, 0x88, 0x09, 0x00,	// orp U+2490 (⒐)
+	0x00, 0x00, 0x24, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00,	// orp U+2491 (⒑)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0x0a, 0x00,	// orp U+2492 (⒒)
+	0x00, 0x00, 0x34, 0x51, 0x94, 0x14, 0x45, 0x0b, 0x00,	// orp U+2493 (⒓)
+	0x00, 0x00, 0x34, 0x51, 0x94, 0x44, 0x51, 0x0b, 0x00,	// orp U+2494 (⒔)
+	0x00, 0x00, 0x14, 0x45, 0xd3, 0x74, 0x49, 0x0a, 0x00,	// orp U+2495 (⒕)
+	0x00, 0x00, 0x74, 0x45, 0x91, 0x24, 0x49, 0x09, 0x00,	// orp U+2496 (⒖)
+	0x00, 0x00, 0x44, 0x49, 0xd1, 0x54, 0x55, 0x0a, 0x00,	// orp U+2497 (⒗)
+	0x00, 0x00, 0x74, 0x51, 0x14, 0x25, 0x49, 0x0a, 0x00,	// orp U+2498 (⒘)
+	0x00, 0x00, 0x24, 0x55, 0x95, 0x54, 0x55, 0x0a, 0x00,	// orp U+2499 (⒙)
+	0x00, 0x00, 0x24, 0x55, 0x95, 0x45, 0x49, 0x09, 0x00,	// orp U+249A (⒚)
+	0x00, 0x00, 0x24, 0x96, 0x65, 0x55, 0xd5, 0x0a, 0x00,	// orp U+249B (⒛)
+	0x80, 0x14, 0x96, 0x69, 0xbb, 0xb6, 0xa1, 0x04, 0x00,	// orp U+249C (⒜)
+	0x80, 0x14, 0x96, 0x65, 0x5b, 0xb7, 0xa1, 0x04, 0x00,	// orp U+249D (⒝)
+	0x80, 0x14, 0x86, 0x61, 0x5a, 0xa6, 0xa1, 0x04, 0x00,	// orp U+249E (⒞)
+	0x80, 0x14, 0xa6, 0x69, 0xbb, 0xb6, 0xa1, 0x04, 0x00,	// orp U+249F (⒟)
+	0x80, 0x14, 0xa6, 0x75, 0x5f, 0xa6, 0xa1, 0x04, 0x00,	// orp U+24A0 (⒠)
+	0x80, 0x14, 0xa6, 0xe5, 0x5b, 0x96, 0xa1, 0x04, 0x00,	// orp U+24A1 (⒡)
+	0x80, 0x14, 0x86, 0xed, 0xda, 0xa6, 0xa5, 0x04, 0x00,	// orp U+24A2 (⒢)
+	0x80, 0x14, 0x96, 0x65, 0x5b, 0xd7, 0xa1, 0x04, 0x00,	// orp U+24A3 (⒣)
+	0x80, 0x14, 0x86, 0x69, 0x98, 0xa6, 0xa1, 0x04, 0x00,	// orp U+24A4 (⒤)
+	0x80, 0x14, 0x86, 0x69, 0x98, 0xa6, 0xa5, 0x04, 0x00,	// orp U+24A5 (⒥)
+	0x80, 0x14, 0x96, 0x65, 0x5b, 0xb6, 0xa1, 0x04, 0x00,	// orp U+24A6 (⒦)
+	0x80, 0x14, 0xa6, 0x69, 0x9a, 0xa6, 0xa1, 0x04, 0x00,	// orp U+24A7 (⒧)
+	0x80, 0x14, 0x86, 0xe1, 0xbd, 0xae, 0xa1, 0x04, 0x00,	// orp U+24A8 (⒨)
+	0x80, 0x14, 0x86, 0xe1, 0xb9, 0xae, 0xa1, 0x04, 0x00,	// orp U+24A9 (⒩)
+	0x80, 0x14, 0x86, 0x61, 0x5a, 0xa7, 0xa1, 0x04, 0x00,	// orp U+24AA (⒪)
+	0x80, 0x14, 0x86, 0x61, 0x5b, 0xb7, 0xa5, 0x04, 0x00,	// orp U+24AB (⒫)
+	0x80, 0x14, 0x86, 0x61, 0xbb, 0xb6, 0xa9, 0x04, 0x00,	// orp U+24AC (⒬)
+	0x80, 0x14, 0x86, 0x61, 0x5b, 0x96, 0xa1, 0x04, 0x00,	// orp U+24AD (⒭)
+	0x80, 0x14, 0x86, 0x6d, 0x99, 0xb6, 0xa1, 0x04, 0x00,	// orp U+24AE (⒮)
+	0x80, 0x14, 0x96, 0xe5, 0x5b, 0xa6, 0xa1, 0x04, 0x00,	// orp U+24AF (⒯)
+	0x80, 0x14, 0x86, 0xe1, 0xba, 0xb6, 0xa1, 0x04, 0x00,	// orp U+24B0 (⒰)
+	0x80, 0x14, 0x86, 0x61, 0x5d, 0xa7, 0xa1, 0x04, 0x00,	// orp U+24B1 (⒱)
+	0x80, 0x14, 0x86, 0xe1, 0xb8, 0xf6, 0xa1, 0x04, 0x00,	// orp U+24B2 (⒲)
+	0x80, 0x14, 0x86, 0x61, 0x9d, 0xd6, 0xa1, 0x04, 0x00,	// orp U+24B3 (⒳)
+	0x80, 0x14, 0x86, 0x61, 0x5d, 0xa7, 0xa5, 0x04, 0x00,	// orp U+24B4 (⒴)
+	0x80, 0x14, 0x86, 0x6d, 0x5a, 0xb6, 0xa1, 0x04, 0x00,	// orp U+24B5 (⒵)
+	0x80, 0x17, 0xa6, 0x75, 0x5f, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24B6 (Ⓐ)
+	0x80, 0x17, 0xb6, 0x75, 0x5b, 0xb7, 0xa1, 0x07, 0x00,	// orp U+24B7 (Ⓑ)
+	0x80, 0x17, 0xa6, 0x65, 0x59, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24B8 (Ⓒ)
+	0x80, 0x17, 0xb6, 0x75, 0x5d, 0xb7, 0xa1, 0x07, 0x00,	// orp U+24B9 (Ⓓ)
+	0x80, 0x17, 0xb6, 0x65, 0x5b, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24BA (Ⓔ)
+	0x80, 0x17, 0xb6, 0x65, 0x5b, 0x96, 0xa1, 0x07, 0x00,	// orp U+24BB (Ⓕ)
+	0x80, 0x17, 0xb6, 0xe3, 0xba, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24BC (Ⓖ)
+	0x80, 0x17, 0xd6, 0x75, 0x5f, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24BD (Ⓗ)
+	0x80, 0x17, 0xa6, 0x69, 0x9a, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24BE (Ⓘ)
+	0x80, 0x17, 0xb6, 0x69, 0x9a, 0x96, 0xa1, 0x07, 0x00,	// orp U+24BF (Ⓙ)
+	0x80, 0x17, 0xd6, 0x75, 0x5b, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24C0 (Ⓚ)
+	0x80, 0x17, 0x96, 0x65, 0x59, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24C1 (Ⓛ)
+	0x80, 0x17, 0xd6, 0x7d, 0x5d, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24C2 (Ⓜ)
+	0x80, 0x17, 0xd6, 0x7d, 0x5f, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24C3 (Ⓝ)
+	0x80, 0x17, 0xa6, 0x75, 0x5d, 0xa7, 0xa1, 0x07, 0x00,	// orp U+24C4 (Ⓞ)
+	0x80, 0x17, 0xb6, 0x75, 0x5b, 0x96, 0xa1, 0x07, 0x00,	// orp U+24C5 (Ⓟ)
+	0x80, 0x17, 0x96, 0xeb, 0xba, 0xb6, 0xa9, 0x07, 0x00,	// orp U+24C6 (Ⓠ)
+	0x80, 0x17, 0xb6, 0x75, 0x5b, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24C7 (Ⓡ)
+	0x80, 0x17, 0xe6, 0x65, 0x1a, 0xb7, 0xa1, 0x07, 0x00,	// orp U+24C8 (Ⓢ)
+	0x80, 0x17, 0xf6, 0x69, 0x9a, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24C9 (Ⓣ)
+	0x80, 0x17, 0xd6, 0x75, 0x5d, 0xa7, 0xa1, 0x07, 0x00,	// orp U+24CA (Ⓤ)
+	0x80, 0x17, 0xd6, 0x75, 0x9d, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24CB (Ⓥ)
+	0x80, 0x17, 0x8e, 0xeb, 0x5a, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24CC (Ⓦ)
+	0x80, 0x17, 0xd6, 0x75, 0x5a, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24CD (Ⓧ)
+	0x80, 0x17, 0xd6, 0x75, 0x9a, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24CE (Ⓨ)
+	0x80, 0x17, 0xf6, 0x71, 0x5a, 0xf6, 0xa1, 0x07, 0x00,	// orp U+24CF (Ⓩ)
+	0x80, 0x17, 0x96, 0x69, 0xbb, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24D0 (ⓐ)
+	0x80, 0x17, 0x96, 0x65, 0x5b, 0xb7, 0xa1, 0x07, 0x00,	// orp U+24D1 (ⓑ)
+	0x80, 0x17, 0x86, 0x61, 0x5a, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24D2 (ⓒ)
+	0x80, 0x17, 0xa6, 0x69, 0xbb, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24D3 (ⓓ)
+	0x80, 0x17, 0xa6, 0x75, 0x5f, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24D4 (ⓔ)
+	0x80, 0x17, 0xa6, 0xe5, 0x5b, 0x96, 0xa1, 0x07, 0x00,	// orp U+24D5 (ⓕ)
+	0x80, 0x17, 0x86, 0xed, 0xda, 0xa6, 0xa5, 0x07, 0x00,	// orp U+24D6 (ⓖ)
+	0x80, 0x17, 0x96, 0x65, 0x5b, 0xd7, 0xa1, 0x07, 0x00,	// orp U+24D7 (ⓗ)
+	0x80, 0x17, 0x86, 0x69, 0x98, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24D8 (ⓘ)
+	0x80, 0x17, 0x86, 0x69, 0x98, 0xa6, 0xa5, 0x07, 0x00,	// orp U+24D9 (ⓙ)
+	0x80, 0x17, 0x96, 0x65, 0x5b, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24DA (ⓚ)
+	0x80, 0x17, 0x86, 0xe1, 0xbd, 0xae, 0xa1, 0x07, 0x00,	// orp U+24DC (ⓜ)
+	0x80, 0x17, 0x86, 0xe1, 0xb9, 0xae, 0xa1, 0x07, 0x00,	// orp U+24DD (ⓝ)
+	0x80, 0x17, 0x86, 0x61, 0x5a, 0xa7, 0xa1, 0x07, 0x00,	// orp U+24DE (ⓞ)
+	0x80, 0x17, 0x86, 0x61, 0x5b, 0xb7, 0xa5, 0x07, 0x00,	// orp U+24DF (ⓟ)
+	0x80, 0x17, 0x86, 0x61, 0xbb, 0xb6, 0xa9, 0x07, 0x00,	// orp U+24E0 (ⓠ)
+	0x80, 0x17, 0x86, 0x61, 0x5b, 0x96, 0xa1, 0x07, 0x00,	// orp U+24E1 (ⓡ)
+	0x80, 0x17, 0x86, 0x6d, 0x99, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24E2 (ⓢ)
+	0x80, 0x17, 0x96, 0xe5, 0x5b, 0xa6, 0xa1, 0x07, 0x00,	// orp U+24E3 (ⓣ)
+	0x80, 0x17, 0x86, 0xe1, 0xba, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24E4 (ⓤ)
+	0x80, 0x17, 0x86, 0x61, 0x5d, 0xa7, 0xa1, 0x07, 0x00,	// orp U+24E5 (ⓥ)
+	0x80, 0x17, 0x86, 0xe1, 0xb8, 0xf6, 0xa1, 0x07, 0x00,	// orp U+24E6 (ⓦ)
+	0x80, 0x17, 0x86, 0x61, 0x9d, 0xd6, 0xa1, 0x07, 0x00,	// orp U+24E7 (ⓧ)
+	0x80, 0x17, 0x86, 0x61, 0x5d, 0xa7, 0xa5, 0x07, 0x00,	// orp U+24E8 (ⓨ)
+	0x80, 0x17, 0x86, 0x6d, 0x5a, 0xb6, 0xa1, 0x07, 0x00,	// orp U+24E9 (ⓩ)
+	0x80, 0xf7, 0xd7, 0x75, 0x5d, 0xd7, 0xbf, 0x07, 0x00,	// orp U+24EB (⓫)
+	0x80, 0xf7, 0xd7, 0x6d, 0x5b, 0x97, 0xbf, 0x07, 0x00,	// orp U+24EC (⓬)
+	0x80, 0xf7, 0xd7, 0x6d, 0xdd, 0xd6, 0xbf, 0x07, 0x00,	// orp U+24ED (⓭)
+	0x80, 0xf7, 0xd7, 0x75, 0x59, 0xb6, 0xbf, 0x07, 0x00,	// orp U+24EE (⓮)
+	0x80, 0xf7, 0x97, 0x75, 0xd9, 0x96, 0xbf, 0x07, 0x00,	// orp U+24EF (⓯)
+	0x80, 0xf7, 0xd7, 0x75, 0x59, 0xb5, 0xbf, 0x07, 0x00,	// orp U+24F0 (⓰)
+	0x80, 0xf7, 0x97, 0x6d, 0x5d, 0xd7, 0xbf, 0x07, 0x00,	// orp U+24F1 (⓱)
+	0x80, 0xf7, 0xb7, 0x55, 0x5b, 0xb5, 0xbf, 0x07, 0x00,	// orp U+24F2 (⓲)
+	0x80, 0xf7, 0xb7, 0x55, 0xd3, 0xb5, 0xbf, 0x07, 0x00,	// orp U+24F3 (⓳)
+	0x80, 0xf7, 0xb7, 0xd3, 0x54, 0xa5, 0xbf, 0x07, 0x00,	// orp U+24F4 (⓴)
+	0xce, 0x17, 0x55, 0x57, 0x55, 0x7d, 0xd1, 0xe7, 0x00,	// orp U+24F5 (⓵)
+	0xce, 0x17, 0x55, 0x5b, 0x56, 0x7d, 0xd1, 0xe7, 0x00,	// orp U+24F6 (⓶)
+	0xce, 0x17, 0x5d, 0x59, 0x95, 0x5d, 0xd1, 0xe7, 0x00,	// orp U+24F7 (⓷)
+	0xce, 0x17, 0x4d, 0xd3, 0xf5, 0x55, 0xd1, 0xe7, 0x00,	// orp U+24F8 (⓸)
+	0xce, 0x17, 0x7d, 0xd3, 0x95, 0x5d, 0xd1, 0xe7, 0x00,	// orp U+24F9 (⓹)
+	0xce, 0x17, 0x75, 0xd3, 0xb5, 0x55, 0xd1, 0xe7, 0x00,	// orp U+24FA (⓺)
+	0xce, 0x17, 0x7d, 0x59, 0x55, 0x55, 0xd1, 0xe7, 0x00,	// orp U+24FB (⓻)
+	0xce, 0x17, 0x55, 0x5b, 0xb5, 0x55, 0xd1, 0xe7, 0x00,	// orp U+24FC (⓼)
+	0xce, 0x17, 0x55, 0x5b, 0x97, 0x5d, 0xd1, 0xe7, 0x00,	// orp U+24FD (⓽)
+	0xde, 0x1f, 0xae, 0xf7, 0x7d, 0xaf, 0xe1, 0xef, 0x01,	// orp U+24FE (⓾)
+	0x80, 0xf7, 0xcf, 0x6d, 0xdb, 0xce, 0xbf, 0x07, 0x00,	// orp U+24FF (⓿)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00,	// orp U+2501 (━)
+	0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30,	// orp U+2503 (┃)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x00,	// orp U+2505 (┅)
+	0x00, 0x41, 0x00, 0x00, 0x41, 0x00, 0x00, 0x41, 0x00,	// orp U+2506 (┆)
+	0x00, 0xc3, 0x00, 0x00, 0xc3, 0x00, 0x00, 0xc3, 0x00,	// orp U+2507 (┇)
+	0x00, 0x41, 0x00, 0x04, 0x01, 0x10, 0x04, 0x40, 0x10,	// orp U+250A (┊)
+	0x00, 0xc3, 0x00, 0x0c, 0x03, 0x30, 0x0c, 0xc0, 0x30,	// orp U+250B (┋)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x13, 0x04, 0x41, 0x10,	// orp U+250C (┌)
+	0x00, 0x00, 0x00, 0x00, 0xcf, 0x13, 0x04, 0x41, 0x10,	// orp U+250D (┍)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x33, 0x0c, 0xc3, 0x30,	// orp U+250E (┎)
+	0x00, 0x00, 0x00, 0x00, 0xcf, 0x33, 0x0c, 0xc3, 0x30,	// orp U+250F (┏)
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x10, 0x04, 0x41, 0x10,	// orp U+2510 (┐)
+	0x00, 0x00, 0x00, 0xc0, 0x71, 0x10, 0x04, 0x41, 0x10,	// orp U+2511 (┑)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x30, 0x0c, 0xc3, 0x30,	// orp U+2512 (┒)
+	0x00, 0x00, 0x00, 0xc0, 0xf3, 0x30, 0x0c, 0xc3, 0x30,	// orp U+2513 (┓)
+	0x04, 0x41, 0x10, 0x04, 0xc1, 0x03, 0x00, 0x00, 0x00,	// orp U+2514 (└)
+	0x04, 0x41, 0x10, 0x04, 0xcf, 0x03, 0x00, 0x00, 0x00,	// orp U+2515 (┕)
+	0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x03, 0x00, 0x00, 0x00,	// orp U+2516 (┖)
+	0x0c, 0xc3, 0x30, 0x0c, 0xcf, 0x03, 0x00, 0x00, 0x00,	// orp U+2517 (┗)
+	0x04, 0x41, 0x10, 0x04, 0x71, 0x00, 0x00, 0x00, 0x00,	// orp U+2518 (┘)
+	0x04, 0x41, 0x10, 0xc4, 0x71, 0x00, 0x00, 0x00, 0x00,	// orp U+2519 (┙)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x00, 0x00, 0x00, 0x00,	// orp U+251A (┚)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x00, 0x00, 0x00, 0x00,	// orp U+251B (┛)
+	0x04, 0x41, 0x10, 0x04, 0xc1, 0x13, 0x04, 0x41, 0x10,	// orp U+251C (├)
+	0x04, 0x41, 0x10, 0x04, 0xcf, 0x13, 0x04, 0x41, 0x10,	// orp U+251D (┝)
+	0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x13, 0x04, 0x41, 0x10,	// orp U+251E (┞)
+	0x04, 0x41, 0x10, 0x04, 0xc1, 0x33, 0x0c, 0xc3, 0x30,	// orp U+251F (┟)
+	0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2520 (┠)
+	0x0c, 0xc3, 0x30, 0x0c, 0xcf, 0x13, 0x04, 0x41, 0x10,	// orp U+2521 (┡)
+	0x04, 0x41, 0x10, 0x04, 0xcf, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2522 (┢)
+	0x0c, 0xc3, 0x30, 0x0c, 0xcf, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2523 (┣)
+	0x04, 0x41, 0x10, 0x04, 0x71, 0x10, 0x04, 0x41, 0x10,	// orp U+2524 (┤)
+	0x04, 0x41, 0x10, 0xc4, 0x71, 0x10, 0x04, 0x41, 0x10,	// orp U+2525 (┥)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x10, 0x04, 0x41, 0x10,	// orp U+2526 (┦)
+	0x04, 0x41, 0x10, 0x04, 0xf1, 0x30, 0x0c, 0xc3, 0x30,	// orp U+2527 (┧)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x30, 0x0c, 0xc3, 0x30,	// orp U+2528 (┨)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x10, 0x04, 0x41, 0x10,	// orp U+2529 (┩)
+	0x04, 0x41, 0x10, 0xc4, 0xf3, 0x30, 0x0c, 0xc3, 0x30,	// orp U+252A (┪)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x30, 0x0c, 0xc3, 0x30,	// orp U+252B (┫)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x13, 0x04, 0x41, 0x10,	// orp U+252C (┬)
+	0x00, 0x00, 0x00, 0xc0, 0xf1, 0x13, 0x04, 0x41, 0x10,	// orp U+252D (┭)
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+252E (┮)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+252F (┯)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2530 (┰)
+	0x00, 0x00, 0x00, 0xc0, 0xf3, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2531 (┱)
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2532 (┲)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2533 (┳)
+	0x04, 0x41, 0x10, 0x04, 0xf1, 0x03, 0x00, 0x00, 0x00,	// orp U+2534 (┴)
+	0x04, 0x41, 0x10, 0xc4, 0xf1, 0x03, 0x00, 0x00, 0x00,	// orp U+2535 (┵)
+	0x04, 0x41, 0x10, 0x04, 0xff, 0x03, 0x00, 0x00, 0x00,	// orp U+2536 (┶)
+	0x04, 0x41, 0x10, 0xc4, 0xff, 0x03, 0x00, 0x00, 0x00,	// orp U+2537 (┷)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x03, 0x00, 0x00, 0x00,	// orp U+2538 (┸)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x03, 0x00, 0x00, 0x00,	// orp U+2539 (┹)
+	0x0c, 0xc3, 0x30, 0x0c, 0xff, 0x03, 0x00, 0x00, 0x00,	// orp U+253A (┺)
+	0x0c, 0xc3, 0x30, 0xcc, 0xff, 0x03, 0x00, 0x00, 0x00,	// orp U+253B (┻)
+	0x04, 0x41, 0x10, 0x04, 0xf1, 0x13, 0x04, 0x41, 0x10,	// orp U+253C (┼)
+	0x04, 0x41, 0x10, 0xc4, 0xf1, 0x13, 0x04, 0x41, 0x10,	// orp U+253D (┽)
+	0x04, 0x41, 0x10, 0x04, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+253E (┾)
+	0x04, 0x41, 0x10, 0xc4, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+253F (┿)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x13, 0x04, 0x41, 0x10,	// orp U+2540 (╀)
+	0x04, 0x41, 0x10, 0x04, 0xf1, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2541 (╁)
+	0x0c, 0xc3, 0x30, 0x0c, 0xf3, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2542 (╂)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x13, 0x04, 0x41, 0x10,	// orp U+2543 (╃)
+	0x0c, 0xc3, 0x30, 0x0c, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+2544 (╄)
+	0x04, 0x41, 0x10, 0xc4, 0xf3, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2545 (╅)
+	0x04, 0x41, 0x10, 0x04, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2546 (╆)
+	0x0c, 0xc3, 0x30, 0xcc, 0xff, 0x13, 0x04, 0x41, 0x10,	// orp U+2547 (╇)
+	0x04, 0x41, 0x10, 0xc4, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2548 (╈)
+	0x0c, 0xc3, 0x30, 0xcc, 0xf3, 0x33, 0x0c, 0xc3, 0x30,	// orp U+2549 (╉)
+	0x0c, 0xc3, 0x30, 0x0c, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+254A (╊)
+	0x0c, 0xc3, 0x30, 0xcc, 0xff, 0x33, 0x0c, 0xc3, 0x30,	// orp U+254B (╋)
+	0x00, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x00,	// orp U+254C (╌)
+	0x00, 0x00, 0x00, 0xc0, 0xb6, 0x01, 0x00, 0x00, 0x00,	// orp U+254D (╍)
+	0x04, 0x41, 0x10, 0x04, 0x40, 0x10, 0x04, 0x41, 0x00,	// orp U+254E (╎)
+	0x0c, 0xc3, 0x30, 0x0c, 0xc0, 0x30, 0x0c, 0xc3, 0x00,	// orp U+254F (╏)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0x00, 0x00, 0x00,	// orp U+2550 (═)
+	0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x28,	// orp U+2551 (║)
+	0x00, 0x00, 0x00, 0x00, 0x4f, 0xf0, 0x04, 0x41, 0x10,	// orp U+2552 (╒)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x2b, 0x8a, 0xa2, 0x28,	// orp U+2553 (╓)
+	0x00, 0x00, 0x00, 0x80, 0x2f, 0xe8, 0x8a, 0xa2, 0x28,	// orp U+2554 (╔)
+	0x00, 0x00, 0x00, 0xc0, 0x41, 0x1c, 0x04, 0x41, 0x10,	// orp U+2555 (╕)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x28, 0x8a, 0xa2, 0x28,	// orp U+2556 (╖)
+	0x00, 0x00, 0x00, 0xc0, 0x83, 0x2c, 0x8a, 0xa2, 0x28,	// orp U+2557 (╗)
+	0x04, 0x41, 0x10, 0x04, 0x4f, 0xf0, 0x00, 0x00, 0x00,	// orp U+2558 (╘)
+	0x8a, 0xa2, 0x28, 0x8a, 0xe2, 0x03, 0x00, 0x00, 0x00,	// orp U+2559 (╙)
+	0x8a, 0xa2, 0x28, 0x8a, 0x2e, 0xf8, 0x00, 0x00, 0x00,	// orp U+255A (╚)
+	0x04, 0x41, 0x10, 0xc4, 0x41, 0x1c, 0x00, 0x00, 0x00,	// orp U+255B (╛)
+	0x8a, 0xa2, 0x28, 0x8a, 0xf2, 0x00, 0x00, 0x00, 0x00,	// orp U+255C (╜)
+	0x8a, 0xa2, 0x28, 0xca, 0x82, 0x3c, 0x00, 0x00, 0x00,	// orp U+255D (╝)
+	0x04, 0x41, 0x10, 0x04, 0x4f, 0xf0, 0x04, 0x41, 0x10,	// orp U+255E (╞)
+	0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x2b, 0x8a, 0xa2, 0x28,	// orp U+255F (╟)
+	0x8a, 0xa2, 0x28, 0x8a, 0x2e, 0xe8, 0x8a, 0xa2, 0x28,	// orp U+2560 (╠)
+	0x04, 0x41, 0x10, 0xc4, 0x41, 0x1c, 0x04, 0x41, 0x10,	// orp U+2561 (╡)
+	0x8a, 0xa2, 0x28, 0x8a, 0xb2, 0x28, 0x8a, 0xa2, 0x28,	// orp U+2562 (╢)
+	0x8a, 0xa2, 0x28, 0xca, 0x82, 0x2c, 0x8a, 0xa2, 0x28,	// orp U+2563 (╣)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0xfc, 0x04, 0x41, 0x10,	// orp U+2564 (╤)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x2b, 0x8a, 0xa2, 0x28,	// orp U+2565 (╥)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0xec, 0x8a, 0xa2, 0x28,	// orp U+2566 (╦)
+	0x04, 0x41, 0x10, 0xc4, 0x0f, 0xfc, 0x00, 0x00, 0x00,	// orp U+2567 (╧)
+	0x8a, 0xa2, 0x28, 0x8a, 0xf2, 0x03, 0x00, 0x00, 0x00,	// orp U+2568 (╨)
+	0x8a, 0xa2, 0x28, 0xca, 0x0e, 0xfc, 0x00, 0x00, 0x00,	// orp U+2569 (╩)
+	0x04, 0x41, 0x10, 0xc4, 0x4f, 0xfc, 0x04, 0x41, 0x10,	// orp U+256A (╪)
+	0x8a, 0xa2, 0x28, 0x8a, 0xf2, 0x2b, 0x8a, 0xa2, 0x28,	// orp U+256B (╫)
+	0x8a, 0xa2, 0x28, 0xca, 0x0e, 0xec, 0x8a, 0xa2, 0x28,	// orp U+256C (╬)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x04, 0x41, 0x10,	// orp U+256D (╭)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x41, 0x10,	// orp U+256E (╮)
+	0x04, 0x41, 0x10, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00,	// orp U+256F (╯)
+	0x04, 0x41, 0x10, 0x04, 0x02, 0x03, 0x00, 0x00, 0x00,	// orp U+2570 (╰)
+	0x20, 0x08, 0x41, 0x08, 0x42, 0x10, 0x82, 0x10, 0x04,	// orp U+2571 (╱)
+	0x41, 0x20, 0x08, 0x04, 0x81, 0x20, 0x10, 0x04, 0x82,	// orp U+2572 (╲)
+	0x61, 0x28, 0x49, 0x0c, 0xc3, 0x30, 0x92, 0x14, 0x86,	// orp U+2573 (╳)
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00,	// orp U+2574 (╴)
+	0x04, 0x41, 0x10, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2575 (╵)
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00,	// orp U+2576 (╶)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x04, 0x41, 0x10,	// orp U+2577 (╷)
+	0x00, 0x00, 0x00, 0xc0, 0x71, 0x00, 0x00, 0x00, 0x00,	// orp U+2578 (╸)
+	0x0c, 0xc3, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+2579 (╹)
+	0x00, 0x00, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x00, 0x00,	// orp U+257A (╺)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0xc3, 0x30,	// orp U+257B (╻)
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0x00,	// orp U+257C (╼)
+	0x04, 0x41, 0x10, 0x04, 0xc1, 0x30, 0x0c, 0xc3, 0x30,	// orp U+257D (╽)
+	0x00, 0x00, 0x00, 0xc0, 0xf1, 0x03, 0x00, 0x00, 0x00,	// orp U+257E (╾)
+	0x0c, 0xc3, 0x30, 0x0c, 0x43, 0x10, 0x04, 0x41, 0x10,	// orp U+257F (╿)
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00,	// orp U+2580 (▀)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff,	// orp U+2581 (▁)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff,	// orp U+2582 (▂)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff,	// orp U+2583 (▃)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,	// orp U+2584 (▄)
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	// orp U+2585 (▅)
+	0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	// orp U+2586 (▆)
+	0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	// orp U+2587 (▇)
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	// orp U+2588 (█)
+	0xdf, 0xf7, 0x7d, 0xdf, 0xf7, 0x7d, 0xdf, 0xf7, 0x7d,	// orp U+2589 (▉)
+	0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c,	// orp U+258A (▊)
+	0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c,	// orp U+258C (▌)
+	0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c,	// orp U+258D (▍)
+	0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3,	// orp U+2590 (▐)
+	0x15, 0xa0, 0x02, 0x15, 0xa0, 0x02, 0x15, 0xa0, 0x02,	// orp U+2591 (░)
+	0x95, 0x5a, 0xa9, 0x95, 0x5a, 0xa9, 0x95, 0x5a, 0xa9,	// orp U+2592 (▒)
+	0xea, 0x5f, 0xfd, 0xea, 0x5f, 0xfd, 0xea, 0x5f, 0xfd,	// orp U+2593 (▓)
+	0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2594 (▔)
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0xc7, 0x71, 0x1c,	// orp U+2596 (▖)
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xe3, 0x38, 0x8e, 0xe3,	// orp U+2597 (▗)
+	0xc7, 0x71, 0x1c, 0xc7, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2598 (▘)
+	0xc7, 0x71, 0x1c, 0xc7, 0xf1, 0xff, 0xff, 0xff, 0xff,	// orp U+2599 (▙)
+	0xc7, 0x71, 0x1c, 0xc7, 0x81, 0xe3, 0x38, 0x8e, 0xe3,	// orp U+259A (▚)
+	0xff, 0xff, 0xff, 0xff, 0x7f, 0x1c, 0xc7, 0x71, 0x1c,	// orp U+259B (▛)
+	0xff, 0xff, 0xff, 0xff, 0x8f, 0xe3, 0x38, 0x8e, 0xe3,	// orp U+259C (▜)
+	0x38, 0x8e, 0xe3, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00,	// orp U+259D (▝)
+	0x38, 0x8e, 0xe3, 0x38, 0x7e, 0x1c, 0xc7, 0x71, 0x1c,	// orp U+259E (▞)
+	0x38, 0x8e, 0xe3, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff,	// orp U+259F (▟)
+	0x00, 0x00, 0x00, 0xc0, 0xf7, 0x7d, 0xdf, 0x07, 0x00,	// orp U+25A0 (■)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x45, 0xd1, 0x07, 0x00,	// orp U+25A1 (□)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x55, 0xd1, 0x07, 0x00,	// orp U+25A3 (▣)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x7d, 0xd1, 0x07, 0x00,	// orp U+25A4 (▤)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x55, 0xd5, 0x07, 0x00,	// orp U+25A5 (▥)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x7d, 0xd5, 0x07, 0x00,	// orp U+25A6 (▦)
+	0x00, 0x00, 0x00, 0xc0, 0x37, 0x55, 0xd9, 0x07, 0x00,	// orp U+25A7 (▧)
+	0x00, 0x00, 0x00, 0xc0, 0x97, 0x55, 0xd3, 0x07, 0x00,	// orp U+25A8 (▨)
+	0x00, 0x00, 0x00, 0xc0, 0xb7, 0x55, 0xdb, 0x07, 0x00,	// orp U+25A9 (▩)
+	0x00, 0x00, 0x00, 0x80, 0xe3, 0x38, 0x00, 0x00, 0x00,	// orp U+25AA (▪)
+	0x00, 0x00, 0x00, 0x80, 0xa3, 0x38, 0x00, 0x00, 0x00,	// orp U+25AB (▫)
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,	// orp U+25AC (▬)
+	0x00, 0x00, 0x00, 0x7f, 0x18, 0x86, 0x3f, 0x00, 0x00,	// orp U+25AD (▭)
+	0x80, 0xe7, 0x79, 0x9e, 0xe7, 0x79, 0x9e, 0xe7, 0x01,	// orp U+25AE (▮)
+	0x00, 0x00, 0x00, 0x00, 0xef, 0x3d, 0x00, 0x00, 0x00,	// orp U+25B0 (▰)
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x3d, 0x00, 0x00, 0x00,	// orp U+25B1 (▱)
+	0x00, 0x00, 0x10, 0x84, 0xe3, 0x7c, 0xdf, 0x07, 0x00,	// orp U+25B2 (▲)
+	0x00, 0x00, 0x00, 0x04, 0xe1, 0x38, 0x1f, 0x00, 0x00,	// orp U+25B4 (▴)
+	0x00, 0x00, 0x00, 0x04, 0xa1, 0x28, 0x1f, 0x00, 0x00,	// orp U+25B5 (▵)
+	0x00, 0x10, 0x0c, 0xc7, 0xf3, 0x3d, 0xc7, 0x10, 0x00,	// orp U+25B6 (▶)
+	0x00, 0x00, 0x08, 0x86, 0x22, 0x29, 0x86, 0x00, 0x00,	// orp U+25B7 (▷)
+	0x00, 0x00, 0x00, 0x82, 0xa1, 0x18, 0x02, 0x00, 0x00,	// orp U+25B9 (▹)
+	0x00, 0x00, 0x00, 0xc3, 0xf3, 0x3f, 0x03, 0x00, 0x00,	// orp U+25BA (►)
+	0x00, 0x00, 0x00, 0x43, 0x13, 0x37, 0x03, 0x00, 0x00,	// orp U+25BB (▻)
+	0x00, 0x00, 0x7c, 0xdf, 0xe7, 0x38, 0x04, 0x01, 0x00,	// orp U+25BC (▼)
+	0x00, 0x00, 0x00, 0xc0, 0xe7, 0x38, 0x04, 0x01, 0x00,	// orp U+25BE (▾)
+	0x00, 0x00, 0x00, 0xc0, 0xa7, 0x28, 0x04, 0x01, 0x00,	// orp U+25BF (▿)
+	0x00, 0x00, 0xc2, 0x38, 0xef, 0xf3, 0x38, 0x0c, 0x02,	// orp U+25C0 (◀)
+	0x00, 0x00, 0x40, 0x18, 0x25, 0x51, 0x18, 0x04, 0x00,	// orp U+25C1 (◁)
+	0x00, 0x00, 0x00, 0x08, 0xe3, 0x30, 0x08, 0x00, 0x00,	// orp U+25C2 (◂)
+	0x00, 0x00, 0x00, 0x08, 0xa3, 0x30, 0x08, 0x00, 0x00,	// orp U+25C3 (◃)
+	0x00, 0x00, 0x00, 0x30, 0xff, 0xf3, 0x30, 0x00, 0x00,	// orp U+25C4 (◄)
+	0x00, 0x00, 0x00, 0x30, 0x3b, 0xb2, 0x30, 0x00, 0x00,	// orp U+25C5 (◅)
+	0x00, 0x00, 0x00, 0x84, 0xf3, 0x39, 0x04, 0x00, 0x00,	// orp U+25C6 (◆)
+	0x00, 0x00, 0x00, 0x84, 0x12, 0x29, 0x04, 0x00, 0x00,	// orp U+25C7 (◇)
+	0x00, 0x00, 0x00, 0x84, 0x52, 0x29, 0x04, 0x00, 0x00,	// orp U+25C8 (◈)
+	0x00, 0x00, 0x00, 0x8c, 0xd4, 0xb6, 0x12, 0x03, 0x00,	// orp U+25C9 (◉)
+	0x00, 0x00, 0x10, 0x8a, 0x12, 0x29, 0x0a, 0x01, 0x00,	// orp U+25CA (◊)
+	0x00, 0x00, 0x00, 0x8c, 0x14, 0x86, 0x12, 0x03, 0x00,	// orp U+25CB (○)
+	0x00, 0x00, 0x00, 0x04, 0x14, 0x80, 0x02, 0x02, 0x00,	// orp U+25CC (◌)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x55, 0x95, 0x03, 0x00,	// orp U+25CD (◍)
+	0x00, 0x00, 0x00, 0x8c, 0xf7, 0xff, 0x1e, 0x03, 0x00,	// orp U+25CF (●)
+	0x00, 0x00, 0x00, 0x8c, 0x75, 0x9e, 0x16, 0x03, 0x00,	// orp U+25D0 (◐)
+	0x00, 0x00, 0x00, 0x8c, 0x96, 0xe7, 0x1a, 0x03, 0x00,	// orp U+25D1 (◑)
+	0x00, 0x00, 0x00, 0x8c, 0x14, 0xfe, 0x1e, 0x03, 0x00,	// orp U+25D2 (◒)
+	0x00, 0x00, 0x00, 0x8c, 0xf7, 0x87, 0x12, 0x03, 0x00,	// orp U+25D3 (◓)
+	0x00, 0x00, 0x00, 0x8c, 0x96, 0x87, 0x12, 0x03, 0x00,	// orp U+25D4 (◔)
+	0x00, 0x00, 0x00, 0x8c, 0x75, 0x86, 0x12, 0x03, 0x00,	// orp U+25D5 (◕)
+	0x00, 0x88, 0xf3, 0xbc, 0xcf, 0xf3, 0x38, 0x08, 0x00,	// orp U+25D6 (◖)
+	0x40, 0x70, 0x3c, 0xcf, 0xf7, 0x3c, 0x47, 0x00, 0x00,	// orp U+25D7 (◗)
+	0xff, 0xff, 0xff, 0x73, 0x18, 0xce, 0xff, 0xff, 0xff,	// orp U+25D8 (◘)
+	0xff, 0xff, 0xcf, 0xad, 0xe7, 0xb5, 0xf3, 0xff, 0xff,	// orp U+25D9 (◙)
+	0xff, 0xff, 0xcf, 0xad, 0x07, 0x00, 0x00, 0x00, 0x00,	// orp U+25DA (◚)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0xb5, 0xf3, 0xff, 0xff,	// orp U+25DB (◛)
+	0x00, 0x00, 0x00, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00,	// orp U+25DC (◜)
+	0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00,	// orp U+25DD (◝)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x02, 0x00,	// orp U+25DE (◞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00,	// orp U+25DF (◟)
+	0x00, 0x00, 0x00, 0x8c, 0x14, 0x02, 0x00, 0x00, 0x00,	// orp U+25E0 (◠)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x12, 0x03, 0x00,	// orp U+25E1 (◡)
+	0x00, 0x00, 0x00, 0x00, 0x84, 0x71, 0xde, 0x07, 0x00,	// orp U+25E2 (◢)
+	0x00, 0x00, 0x00, 0x40, 0x30, 0x1c, 0xcf, 0x07, 0x00,	// orp U+25E3 (◣)
+	0x00, 0x00, 0x00, 0xc0, 0xf7, 0x1c, 0x43, 0x00, 0x00,	// orp U+25E4 (◤)
+	0x00, 0x00, 0x00, 0xc0, 0xe7, 0x71, 0x18, 0x04, 0x00,	// orp U+25E5 (◥)
+	0x00, 0x00, 0x00, 0xc0, 0x77, 0x5d, 0xd7, 0x07, 0x00,	// orp U+25E7 (◧)
+	0x00, 0x00, 0x00, 0xc0, 0xd7, 0x75, 0xdd, 0x07, 0x00,	// orp U+25E8 (◨)
+	0x00, 0x00, 0x00, 0xc0, 0xf7, 0x5d, 0xd3, 0x07, 0x00,	// orp U+25E9 (◩)
+	0x00, 0x00, 0x00, 0xc0, 0x97, 0x75, 0xdf, 0x07, 0x00,	// orp U+25EA (◪)
+	0x00, 0x00, 0x10, 0x84, 0xe2, 0x54, 0xd1, 0x07, 0x00,	// orp U+25EC (◬)
+	0x00, 0x00, 0x10, 0x84, 0xe3, 0x5c, 0xd7, 0x07, 0x00,	// orp U+25ED (◭)
+	0x00, 0x00, 0x10, 0x84, 0xe3, 0x74, 0xdd, 0x07, 0x00,	// orp U+25EE (◮)
+	0x00, 0x00, 0x30, 0x52, 0x18, 0x86, 0x12, 0x03, 0x00,	// orp U+25EF (◯)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x5d, 0xd1, 0x07, 0x00,	// orp U+25F0 (◰)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x5d, 0xd5, 0x07, 0x00,	// orp U+25F1 (◱)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x75, 0xd5, 0x07, 0x00,	// orp U+25F2 (◲)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x75, 0xd1, 0x07, 0x00,	// orp U+25F3 (◳)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x5d, 0x91, 0x03, 0x00,	// orp U+25F4 (◴)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x5d, 0x95, 0x03, 0x00,	// orp U+25F5 (◵)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x75, 0x95, 0x03, 0x00,	// orp U+25F6 (◶)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x75, 0x91, 0x03, 0x00,	// orp U+25F7 (◷)
+	0x00, 0x00, 0x00, 0x5f, 0x52, 0x0c, 0x01, 0x00, 0x00,	// orp U+25F8 (◸)
+	0x00, 0x00, 0x00, 0x9f, 0x44, 0x61, 0x10, 0x00, 0x00,	// orp U+25F9 (◹)
+	0x00, 0x00, 0x00, 0xc1, 0x50, 0x24, 0x1f, 0x00, 0x00,	// orp U+25FA (◺)
+	0x00, 0x00, 0x00, 0x9e, 0x24, 0x79, 0x00, 0x00, 0x00,	// orp U+25FB (◻)
+	0x00, 0x00, 0x00, 0x80, 0xe7, 0x79, 0x1e, 0x00, 0x00,	// orp U+25FC (◼)
+	0x00, 0x00, 0x00, 0x9e, 0xe7, 0x79, 0x00, 0x00, 0x00,	// orp U+25FE (◾)
+	0x00, 0x00, 0x00, 0x10, 0x46, 0x49, 0x1f, 0x00, 0x00,	// orp U+25FF (◿)
+	0x00, 0x41, 0x44, 0x84, 0x43, 0x44, 0x04, 0x01, 0x00,	// orp U+2600 (☀)
+	0x00, 0x00, 0x00, 0xc6, 0xf7, 0x03, 0x00, 0x00, 0x00,	// orp U+2601 (☁)
+	0x00, 0xe1, 0x7c, 0x1f, 0x41, 0x10, 0x84, 0x00, 0x00,	// orp U+2602 (☂)
+	0x85, 0xab, 0x54, 0x8a, 0xea, 0x44, 0x91, 0x03, 0x00,	// orp U+2603 (☃)
+	0x90, 0xa4, 0xa8, 0x22, 0x64, 0x24, 0x89, 0x01, 0x00,	// orp U+2604 (☄)
+	0x00, 0x00, 0x10, 0xc4, 0xa7, 0x38, 0x11, 0x00, 0x00,	// orp U+2606 (☆)
+	0x00, 0x84, 0x10, 0x42, 0x20, 0x50, 0x18, 0x07, 0x00,	// orp U+2607 (☇)
+	0xc0, 0x17, 0x25, 0x49, 0x51, 0x64, 0x59, 0x07, 0x00,	// orp U+2608 (☈)
+	0x00, 0x00, 0x38, 0x51, 0xa4, 0x28, 0x95, 0x02, 0x00,	// orp U+260A (☊)
+	0x00, 0x00, 0x28, 0x95, 0xa2, 0x44, 0x91, 0x03, 0x00,	// orp U+260B (☋)
+	0x00, 0x00, 0x00, 0x00, 0xe4, 0x24, 0x89, 0x01, 0x00,	// orp U+260C (☌)
+	0x00, 0x23, 0x49, 0x0c, 0x61, 0x24, 0x89, 0x01, 0x00,	// orp U+260D (☍)
+	0x00, 0x00, 0x38, 0x5f, 0xe5, 0x7c, 0xdf, 0x07, 0x00,	// orp U+260E (☎)
+	0x00, 0x00, 0x38, 0x55, 0xe5, 0x44, 0xd1, 0x07, 0x00,	// orp U+260F (☏)
+	0xc0, 0x1f, 0x86, 0x61, 0x18, 0x86, 0xe1, 0x0f, 0x00,	// orp U+2610 (☐)
+	0xc0, 0x1f, 0xc6, 0x71, 0x9a, 0xae, 0xe5, 0x0f, 0x00,	// orp U+2611 (☑)
+	0xc0, 0x3f, 0xcf, 0x6d, 0xdb, 0xce, 0xf3, 0x0f, 0x00,	// orp U+2612 (☒)
+	0x00, 0x40, 0x28, 0x51, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+2616 (☖)
+	0x00, 0x40, 0x38, 0xdf, 0xf7, 0x7d, 0xdf, 0x07, 0x00,	// orp U+2617 (☗)
+	0x00, 0x00, 0x91, 0xee, 0x77, 0xbd, 0x2e, 0x05, 0x00,	// orp U+2619 (☙)
+	0x00, 0x00, 0x00, 0xc0, 0xef, 0xfb, 0x3c, 0x00, 0x00,	// orp U+261A (☚)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0x7d, 0x0f, 0x00, 0x00,	// orp U+261B (☛)
+	0x00, 0x00, 0x00, 0xc0, 0x2f, 0xcb, 0x3c, 0x00, 0x00,	// orp U+261C (☜)
+	0x00, 0x00, 0x61, 0x9e, 0x25, 0x49, 0x9e, 0x07, 0x00,	// orp U+261D (☝)
+	0x00, 0x00, 0x00, 0xc0, 0x3f, 0x4d, 0x0f, 0x00, 0x00,	// orp U+261E (☞)
+	0x80, 0xe7, 0x49, 0x92, 0xe5, 0x61, 0x10, 0x04, 0x00,	// orp U+261F (☟)
+	0x80, 0x53, 0x7d, 0x8e, 0x42, 0x44, 0x4e, 0x04, 0x00,	// orp U+2620 (☠)
+	0x00, 0xe0, 0x40, 0x10, 0x42, 0x08, 0x02, 0x07, 0x00,	// orp U+2621 (☡)
+	0x00, 0x00, 0x00, 0xce, 0xb6, 0x55, 0x95, 0x03, 0x00,	// orp U+2622 (☢)
+	0x00, 0x00, 0x00, 0xd2, 0x2f, 0x49, 0x8c, 0x04, 0x00,	// orp U+2623 (☣)
+	0x00, 0xf1, 0x39, 0x8a, 0xa3, 0x38, 0x0a, 0x01, 0x00,	// orp U+2624 (☤)
+	0x00, 0x40, 0x28, 0x0a, 0xf1, 0x11, 0x04, 0x01, 0x00,	// orp U+2625 (☥)
+	0x00, 0x40, 0x38, 0xc4, 0x47, 0x18, 0x0c, 0x01, 0x00,	// orp U+2626 (☦)
+	0x00, 0xc0, 0x50, 0x4c, 0xe5, 0x10, 0x4e, 0x05, 0x00,	// orp U+2627 (☧)
+	0x00, 0x40, 0x38, 0xc4, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+2628 (☨)
+	0x00, 0x00, 0x38, 0x44, 0xf5, 0x55, 0x84, 0x03, 0x00,	// orp U+2629 (☩)
+	0x80, 0x77, 0x4e, 0xfb, 0xb4, 0x0e, 0xa7, 0x07, 0x00,	// orp U+262A (☪)
+	0x40, 0xa5, 0x00, 0x44, 0x55, 0x55, 0x8e, 0x03, 0x00,	// orp U+262B (☫)
+	0x00, 0x40, 0x38, 0x95, 0x13, 0x39, 0x4e, 0x05, 0x00,	// orp U+262C (☬)
+	0x80, 0x13, 0x51, 0xd6, 0x54, 0x61, 0x52, 0x0b, 0x00,	// orp U+262D (☭)
+	0x00, 0x00, 0x38, 0x55, 0x55, 0x7d, 0x95, 0x03, 0x00,	// orp U+262E (☮)
+	0x00, 0x00, 0x00, 0x5e, 0x78, 0x97, 0xbf, 0x07, 0x00,	// orp U+262F (☯)
+	0x00, 0xf0, 0x7d, 0xc0, 0xf7, 0x01, 0xdf, 0x07, 0x00,	// orp U+2630 (☰)
+	0x00, 0xb0, 0x6d, 0xc0, 0xf7, 0x01, 0xdf, 0x07, 0x00,	// orp U+2631 (☱)
+	0x00, 0xf0, 0x7d, 0xc0, 0xb6, 0x01, 0xdf, 0x07, 0x00,	// orp U+2632 (☲)
+	0x00, 0xf0, 0x7d, 0xc0, 0xf7, 0x01, 0xdb, 0x06, 0x00,	// orp U+2633 (☳)
+	0x00, 0xb0, 0x6d, 0xc0, 0xb6, 0x01, 0xdf, 0x07, 0x00,	// orp U+2634 (☴)
+	0x00, 0xb0, 0x6d, 0xc0, 0xf7, 0x01, 0xdb, 0x06, 0x00,	// orp U+2635 (☵)
+	0x00, 0xf0, 0x7d, 0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00,	// orp U+2636 (☶)
+	0x00, 0xb0, 0x6d, 0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00,	// orp U+2637 (☷)
+	0x00, 0x00, 0x10, 0x95, 0xb3, 0x39, 0x15, 0x01, 0x00,	// orp U+2638 (☸)
+	0x00, 0xe0, 0xfd, 0x7f, 0xfb, 0xcf, 0xed, 0xef, 0x01,	// orp U+2639 (☹)
+	0x00, 0xe0, 0x44, 0xdb, 0x16, 0x6d, 0x55, 0xe4, 0x00,	// orp U+263A (☺)
+	0x00, 0xe0, 0x7c, 0x55, 0xf5, 0x55, 0xdb, 0xe7, 0x00,	// orp U+263B (☻)
+	0x00, 0x40, 0x10, 0x11, 0xa1, 0x10, 0x11, 0x41, 0x00,	// orp U+263C (☼)
+	0x00, 0x00, 0x38, 0x13, 0x45, 0x51, 0x93, 0x03, 0x00,	// orp U+263D (☽)
+	0x00, 0x00, 0x38, 0x59, 0x51, 0x14, 0x99, 0x03, 0x00,	// orp U+263E (☾)
+	0x00, 0x10, 0x39, 0x51, 0xe4, 0x10, 0x0e, 0x01, 0x00,	// orp U+263F (☿)
+	0x00, 0x00, 0x00, 0x4e, 0x14, 0x45, 0x0e, 0xe1, 0x10,	// orp U+2640 (♀)
+	0x00, 0x40, 0x38, 0x84, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+2641 (♁)
+	0x00, 0x00, 0xe0, 0xb0, 0x1b, 0x45, 0x91, 0x03, 0x00,	// orp U+2642 (♂)
+	0x00, 0x00, 0x48, 0x15, 0x45, 0x49, 0x1f, 0x04, 0x00,	// orp U+2643 (♃)
+	0x00, 0x00, 0x08, 0x87, 0xa0, 0x58, 0x92, 0x04, 0x00,	// orp U+2644 (♄)
+	0x00, 0x00, 0x44, 0xd5, 0x57, 0x55, 0x84, 0x42, 0x00,	// orp U+2645 (♅)
+	0x00, 0x50, 0xfd, 0x55, 0xe5, 0x10, 0x0e, 0x01, 0x00,	// orp U+2646 (♆)
+	0x00, 0x00, 0x38, 0x92, 0xe4, 0x08, 0x82, 0x07, 0x00,	// orp U+2647 (♇)
+	0x00, 0x00, 0x28, 0x55, 0x45, 0x10, 0x04, 0x01, 0x00,	// orp U+2648 (♈)
+	0x00, 0x00, 0x00, 0xa1, 0xc4, 0x48, 0x12, 0x03, 0x00,	// orp U+2649 (♉)
+	0x00, 0x00, 0x7c, 0x8a, 0xa2, 0x28, 0xca, 0x07, 0x00,	// orp U+264A (♊)
+	0x00, 0x00, 0x70, 0x62, 0x21, 0xa1, 0x91, 0x03, 0x00,	// orp U+264B (♋)
+	0x00, 0x00, 0x38, 0x91, 0x44, 0x59, 0x95, 0x04, 0x02,	// orp U+264C (♌)
+	0x00, 0x00, 0xd4, 0x7f, 0x5d, 0xd7, 0x55, 0x85, 0x51,	// orp U+264D (♍)
+	0x00, 0x00, 0x38, 0x51, 0xa4, 0x6c, 0xc0, 0x07, 0x00,	// orp U+264E (♎)
+	0x00, 0x00, 0x54, 0x5f, 0x55, 0x55, 0x55, 0x05, 0x03,	// orp U+264F (♏)
+	0x00, 0x00, 0x00, 0x00, 0x87, 0x55, 0x42, 0x01, 0x00,	// orp U+2650 (♐)
+	0x00, 0x00, 0x04, 0x49, 0xd5, 0x4c, 0x11, 0x03, 0x00,	// orp U+2651 (♑)
+	0x00, 0x00, 0x00, 0x80, 0x5a, 0x01, 0x6a, 0x05, 0x00,	// orp U+2652 (♒)
+	0x00, 0x00, 0x44, 0x8a, 0xf2, 0x29, 0x4a, 0x04, 0x00,	// orp U+2653 (♓)
+	0x84, 0xe3, 0x54, 0x5f, 0xa4, 0x28, 0xd1, 0x07, 0x00,	// orp U+2654 (♔)
+	0x40, 0xf5, 0x45, 0x9f, 0xa2, 0x28, 0xd1, 0x07, 0x00,	// orp U+2655 (♕)
+	0x00, 0x00, 0x54, 0x9f, 0xa2, 0x28, 0xd1, 0x07, 0x00,	// orp U+2656 (♖)
+	0x00, 0xa1, 0x38, 0x5b, 0xa4, 0x28, 0xd1, 0x07, 0x00,	// orp U+2657 (♗)
+	0x00, 0xc2, 0x59, 0xd1, 0x45, 0x51, 0xa2, 0x0f, 0x00,	// orp U+2658 (♘)
+	0x00, 0x40, 0x28, 0x84, 0xa2, 0x28, 0xd1, 0x07, 0x00,	// orp U+2659 (♙)
+	0x84, 0xe3, 0x54, 0xdf, 0xe7, 0x38, 0xdf, 0x07, 0x00,	// orp U+265A (♚)
+	0x40, 0xf5, 0x7d, 0x9f, 0xe3, 0x38, 0xdf, 0x07, 0x00,	// orp U+265B (♛)
+	0x00, 0x00, 0x54, 0x9f, 0xe3, 0x38, 0xdf, 0x07, 0x00,	// orp U+265C (♜)
+	0x00, 0xe1, 0x38, 0x5b, 0xa4, 0x38, 0xdf, 0x07, 0x00,	// orp U+265D (♝)
+	0x00, 0xc2, 0x69, 0xdf, 0xc7, 0x71, 0xbe, 0x0f, 0x00,	// orp U+265E (♞)
+	0x00, 0x40, 0x38, 0x84, 0xe3, 0x38, 0xdf, 0x07, 0x00,	// orp U+265F (♟)
+	0x00, 0x40, 0x10, 0x8e, 0xf3, 0x7d, 0x84, 0x03, 0x00,	// orp U+2660 (♠)
+	0x00, 0x00, 0x28, 0x55, 0x15, 0x29, 0x04, 0x01, 0x00,	// orp U+2661 (♡)
+	0x00, 0xe0, 0x38, 0xd5, 0xf7, 0x55, 0x84, 0x03, 0x00,	// orp U+2663 (♣)
+	0x00, 0x00, 0x28, 0xdf, 0xf7, 0x39, 0x04, 0x01, 0x00,	// orp U+2664 (♤)
+	0x00, 0xa0, 0x7c, 0xdf, 0xf7, 0x39, 0x0e, 0x01, 0x00,	// orp U+2665 (♥)
+	0x00, 0x40, 0x38, 0xce, 0xf7, 0x39, 0x0e, 0x01, 0x00,	// orp U+2666 (♦)
+	0x00, 0x40, 0x28, 0x84, 0x53, 0x39, 0x84, 0x03, 0x00,	// orp U+2667 (♧)
+	0x00, 0x90, 0x48, 0x89, 0x04, 0x28, 0x91, 0x03, 0x00,	// orp U+2668 (♨)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0xc7, 0x00, 0x00,	// orp U+2669 (♩)
+	0x00, 0x00, 0x10, 0x0c, 0x45, 0x10, 0xc7, 0x00, 0x00,	// orp U+266A (♪)
+	0x00, 0x60, 0x68, 0x92, 0x24, 0x4d, 0x1b, 0x06, 0x00,	// orp U+266B (♫)
+	0x00, 0x60, 0x68, 0x96, 0x26, 0x4d, 0x1b, 0x06, 0x00,	// orp U+266C (♬)
+	0x00, 0x00, 0x08, 0x82, 0x62, 0x49, 0x8a, 0x01, 0x00,	// orp U+266D (♭)
+	0x00, 0x20, 0x48, 0x9a, 0x25, 0x69, 0x96, 0x04, 0x01,	// orp U+266E (♮)
+	0x00, 0x80, 0x68, 0xce, 0xa2, 0x39, 0x8b, 0x00, 0x00,	// orp U+266F (♯)
+	0x00, 0xa0, 0x10, 0x95, 0x53, 0x11, 0x84, 0x02, 0x00,	// orp U+2670 (♰)
+	0x00, 0x40, 0x28, 0xc4, 0x56, 0x11, 0x84, 0x42, 0x00,	// orp U+2671 (♱)
+	0x00, 0x80, 0x4c, 0x62, 0x1c, 0xa4, 0x1c, 0x02, 0x00,	// orp U+2672 (♲)
+	0x00, 0x00, 0x30, 0x92, 0x86, 0xa4, 0xe1, 0x0e, 0x00,	// orp U+2673 (♳)
+	0x00, 0x00, 0x30, 0x92, 0x87, 0xb4, 0xe1, 0x0e, 0x00,	// orp U+2674 (♴)
+	0x00, 0x00, 0x30, 0x92, 0xc7, 0xb4, 0xe1, 0x0e, 0x00,	// orp U+2675 (♵)
+	0x00, 0x00, 0x30, 0x92, 0xc7, 0xa4, 0xe1, 0x0e, 0x00,	// orp U+2676 (♶)
+	0x00, 0x00, 0x30, 0x92, 0x47, 0xb4, 0xe1, 0x0e, 0x00,	// orp U+2677 (♷)
+	0x00, 0x00, 0x30, 0x92, 0xc5, 0xb4, 0xe1, 0x0e, 0x00,	// orp U+2678 (♸)
+	0x00, 0x00, 0x30, 0x92, 0x87, 0xa4, 0xe1, 0x0e, 0x00,	// orp U+2679 (♹)
+	0x00, 0x00, 0x30, 0x92, 0x04, 0x84, 0xe1, 0x0e, 0x00,	// orp U+267A (♺)
+	0x00, 0xc0, 0x50, 0xf3, 0x1c, 0xa4, 0x1d, 0x02, 0x00,	// orp U+267B (♻)
+	0xde, 0x3f, 0xae, 0x0c, 0xe3, 0x5b, 0xe2, 0xfd, 0x7b,	// orp U+267C (♼)
+	0x5e, 0xc8, 0x50, 0xf3, 0x1c, 0xa4, 0x1d, 0x12, 0x7a,	// orp U+267D (♽)
+	0x00, 0xe0, 0x44, 0x80, 0x52, 0x29, 0x40, 0xe4, 0x00,	// orp U+267E (♾)
+	0x00, 0x60, 0x18, 0x82, 0x27, 0x3c, 0x99, 0x09, 0x00,	// orp U+267F (♿)
+	0xc0, 0x17, 0x45, 0x51, 0x15, 0x45, 0xd1, 0x07, 0x00,	// orp U+2680 (⚀)
+	0xc0, 0x17, 0x4d, 0x51, 0x14, 0x65, 0xd1, 0x07, 0x00,	// orp U+2681 (⚁)
+	0xc0, 0x17, 0x4d, 0x51, 0x15, 0x65, 0xd1, 0x07, 0x00,	// orp U+2682 (⚂)
+	0xc0, 0x17, 0x6d, 0x51, 0x14, 0x6d, 0xd1, 0x07, 0x00,	// orp U+2683 (⚃)
+	0xc0, 0x17, 0x6d, 0x51, 0x15, 0x6d, 0xd1, 0x07, 0x00,	// orp U+2684 (⚄)
+	0xc0, 0x17, 0x6d, 0xd1, 0x16, 0x6d, 0xd1, 0x07, 0x00,	// orp U+2685 (⚅)
+	0x00, 0x00, 0x00, 0x4e, 0x94, 0x45, 0x0e, 0x00, 0x00,	// orp U+2686 (⚆)
+	0x00, 0x00, 0x00, 0x4e, 0xb4, 0x45, 0x0e, 0x00, 0x00,	// orp U+2687 (⚇)
+	0x00, 0x00, 0x00, 0xce, 0x77, 0x7d, 0x0e, 0x00, 0x00,	// orp U+2688 (⚈)
+	0x00, 0x00, 0x00, 0xce, 0x57, 0x7d, 0x0e, 0x00, 0x00,	// orp U+2689 (⚉)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x7d, 0x00, 0x00, 0x00,	// orp U+268A (⚊)
+	0x00, 0x00, 0x00, 0x00, 0xb0, 0x6d, 0x00, 0x00, 0x00,	// orp U+268B (⚋)
+	0x00, 0x00, 0x00, 0xdf, 0x07, 0x7c, 0x1f, 0x00, 0x00,	// orp U+268C (⚌)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x7c, 0x1f, 0x00, 0x00,	// orp U+268D (⚍)
+	0x00, 0x00, 0x00, 0xdf, 0x07, 0x6c, 0x1b, 0x00, 0x00,	// orp U+268E (⚎)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+268F (⚏)
+	0x00, 0x00, 0x1c, 0x59, 0x34, 0x75, 0x41, 0x00, 0x00,	// orp U+2690 (⚐)
+	0x00, 0x00, 0x1c, 0xdf, 0xf7, 0x75, 0x41, 0x00, 0x00,	// orp U+2691 (⚑)
+	0x00, 0x00, 0x00, 0xd2, 0xdc, 0x32, 0x52, 0x08, 0x00,	// orp U+2692 (⚒)
+	0x00, 0x40, 0x28, 0xc4, 0x47, 0x54, 0x95, 0x03, 0x00,	// orp U+2693 (⚓)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x5b, 0x04, 0x00,	// orp U+2694 (⚔)
+	0x00, 0x40, 0x38, 0x85, 0x43, 0x31, 0x06, 0x43, 0x00,	// orp U+2695 (⚕)
+	0x00, 0x00, 0x10, 0x5f, 0x15, 0x45, 0xdb, 0x06, 0x00,	// orp U+2696 (⚖)
+	0x00, 0x00, 0x00, 0x9c, 0x1e, 0x01, 0x38, 0x0a, 0x00,	// orp U+2697 (⚗)
+	0x00, 0x40, 0x28, 0x44, 0xf5, 0x39, 0x04, 0x01, 0x00,	// orp U+2698 (⚘)
+	0x00, 0x00, 0x10, 0x5f, 0x54, 0x45, 0x1f, 0x01, 0x00,	// orp U+2699 (⚙)
+	0x00, 0xa1, 0x10, 0xd5, 0x47, 0x10, 0x04, 0x01, 0x00,	// orp U+269A (⚚)
+	0x00, 0x00, 0x54, 0xce, 0xe6, 0x6c, 0x4e, 0x05, 0x00,	// orp U+269B (⚛)
+	0x00, 0x40, 0x28, 0x5b, 0x54, 0x29, 0x0a, 0x01, 0x00,	// orp U+269C (⚜)
+	0x00, 0xa1, 0x44, 0x55, 0x15, 0x55, 0xd1, 0x07, 0x00,	// orp U+26A0 (⚠)
+	0x00, 0x00, 0x40, 0x08, 0xe1, 0x21, 0x84, 0x00, 0x00,	// orp U+26A1 (⚡)
+	0x00, 0x00, 0x00, 0x4e, 0x55, 0x39, 0xca, 0xa7, 0x00,	// orp U+26A2 (⚢)
+	0x00, 0x00, 0x30, 0x84, 0x9d, 0x55, 0x12, 0x03, 0x00,	// orp U+26A3 (⚣)
+	0x00, 0x00, 0xc3, 0x98, 0x59, 0x66, 0x86, 0x70, 0x08,	// orp U+26A4 (⚤)
+	0x00, 0x0c, 0x23, 0x4e, 0x14, 0x45, 0x0e, 0xe1, 0x10,	// orp U+26A5 (⚥)
+	0x00, 0x0c, 0x63, 0x98, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+26A6 (⚦)
+	0x00, 0x00, 0xcc, 0x33, 0x23, 0x49, 0x0c, 0xe1, 0x10,	// orp U+26A7 (⚧)
+	0x00, 0xe1, 0x54, 0x84, 0x13, 0x45, 0x91, 0x03, 0x00,	// orp U+26A8 (⚨)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xf5, 0x12, 0x00, 0x00,	// orp U+26A9 (⚩)
+	0x00, 0x00, 0x00, 0x80, 0xf3, 0x7d, 0x9f, 0x03, 0x00,	// orp U+26AB (⚫)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x55, 0x95, 0x02, 0x00,	// orp U+26AE (⚮)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xb5, 0x12, 0x00, 0x00,	// orp U+26AF (⚯)
+	0x80, 0xa3, 0x44, 0x51, 0xa4, 0x28, 0x8a, 0x03, 0x00,	// orp U+26B0 (⚰)
+	0xc0, 0xa7, 0x38, 0x51, 0x14, 0x29, 0x8a, 0x03, 0x00,	// orp U+26B1 (⚱)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x39, 0x04, 0x01, 0x00,	// orp U+26B2 (⚲)
+	0x00, 0x00, 0x38, 0x10, 0x04, 0x31, 0x84, 0x43, 0x00,	// orp U+26B3 (⚳)
+	0x00, 0x00, 0x10, 0x4a, 0xa4, 0x10, 0x84, 0x43, 0x00,	// orp U+26B4 (⚴)
+	0x00, 0x50, 0x39, 0x9f, 0x53, 0x11, 0x84, 0x43, 0x00,	// orp U+26B5 (⚵)
+	0x00, 0x40, 0x10, 0x44, 0xa4, 0x10, 0xc0, 0x46, 0x00,	// orp U+26B6 (⚶)
+	0x00, 0x40, 0x31, 0x04, 0x43, 0x11, 0x4e, 0xe4, 0x00,	// orp U+26B7 (⚷)
+	0x00, 0xe0, 0x0c, 0xc3, 0x30, 0x38, 0x84, 0x43, 0x00,	// orp U+26B8 (⚸)
+	0x00, 0x00, 0x00, 0x91, 0xf2, 0x29, 0x11, 0x00, 0x00,	// orp U+26B9 (⚹)
+	0x00, 0x00, 0x00, 0x51, 0xa4, 0x28, 0xc4, 0x07, 0x00,	// orp U+26BA (⚺)
+	0x00, 0x00, 0x00, 0x1f, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+26BB (⚻)
+	0x00, 0x00, 0x7c, 0x51, 0x54, 0x7d, 0x04, 0x03, 0x00,	// orp U+26BC (⚼)
+	0x00, 0x00, 0x38, 0xdf, 0xe7, 0x44, 0x9f, 0x03, 0x00,	// orp U+26C3 (⛃)
+	0x00, 0x00, 0x00, 0xc9, 0x4f, 0x08, 0x06, 0x00, 0x00,	// orp U+2701 (✁)
+	0x00, 0x00, 0x00, 0xe3, 0xc4, 0x4c, 0x23, 0x00, 0x00,	// orp U+2702 (✂)
+	0x00, 0x00, 0x00, 0x86, 0x40, 0xfc, 0x09, 0x00, 0x00,	// orp U+2703 (✃)
+	0x00, 0x00, 0xcc, 0xe9, 0xc5, 0x5c, 0xe9, 0x0c, 0x00,	// orp U+2704 (✄)
+	0x00, 0xe0, 0x85, 0x6d, 0x5b, 0xb6, 0x6d, 0xe8, 0x01,	// orp U+2706 (✆)
+	0x00, 0xe0, 0x85, 0x6d, 0xd8, 0x86, 0x73, 0xe8, 0x01,	// orp U+2707 (✇)
+	0x00, 0x00, 0x00, 0x44, 0xf3, 0x37, 0x04, 0x00, 0x00,	// orp U+2708 (✈)
+	0x00, 0x00, 0x00, 0xc0, 0x3f, 0xb7, 0xe1, 0x0f, 0x00,	// orp U+2709 (✉)
+	0x00, 0x20, 0x49, 0x14, 0xe7, 0x79, 0x1e, 0x07, 0x00,	// orp U+270C (✌)
+	0x00, 0x00, 0x80, 0x9c, 0xef, 0x0b, 0x01, 0x00, 0x00,	// orp U+270D (✍)
+	0x00, 0x00, 0x00, 0xc2, 0xa1, 0x50, 0x28, 0x0c, 0x00,	// orp U+270E (✎)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xc5, 0x1f, 0x00, 0x00,	// orp U+270F (✏)
+	0x00, 0x00, 0x00, 0x30, 0x4a, 0x29, 0x87, 0x00, 0x00,	// orp U+2710 (✐)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x86, 0x1f, 0x00, 0x00,	// orp U+2711 (✑)
+	0x00, 0x00, 0x00, 0xc0, 0xf7, 0x7e, 0x00, 0x00, 0x00,	// orp U+2712 (✒)
+	0x00, 0x00, 0x40, 0x10, 0x82, 0x14, 0x87, 0x00, 0x00,	// orp U+2713 (✓)
+	0x00, 0x00, 0xc0, 0x30, 0xbe, 0x7d, 0x0e, 0x03, 0x00,	// orp U+2714 (✔)
+	0x00, 0x00, 0x00, 0xdb, 0x47, 0x7c, 0x1b, 0x00, 0x00,	// orp U+2716 (✖)
+	0x00, 0x00, 0x00, 0x91, 0x42, 0x28, 0x51, 0x00, 0x00,	// orp U+2717 (✗)
+	0x00, 0x00, 0x00, 0xf3, 0xec, 0x39, 0xff, 0x3c, 0x00,	// orp U+2718 (✘)
+	0x00, 0x00, 0x00, 0xde, 0x5c, 0xbe, 0xe5, 0xec, 0x01,	// orp U+2719 (✙)
+	0x00, 0x00, 0x00, 0x0c, 0xf3, 0xff, 0x0c, 0x03, 0x00,	// orp U+271A (✚)
+	0x00, 0x00, 0x00, 0x0c, 0x33, 0xcf, 0x0c, 0x03, 0x00,	// orp U+271C (✜)
+	0x80, 0xa3, 0x6c, 0xd1, 0xa6, 0x28, 0x8a, 0xe2, 0x00,	// orp U+271E (✞)
+	0x80, 0xb7, 0xf7, 0xbb, 0xa6, 0x69, 0x9e, 0x07, 0x00,	// orp U+271F (✟)
+	0x00, 0x00, 0x10, 0x9f, 0xa2, 0x28, 0x1f, 0x01, 0x00,	// orp U+2721 (✡)
+	0x00, 0x00, 0x30, 0xcc, 0xff, 0x33, 0x0c, 0x00, 0x00,	// orp U+2723 (✣)
+	0x00, 0xc0, 0x78, 0xcc, 0xff, 0x33, 0x1e, 0x03, 0x00,	// orp U+2724 (✤)
+	0x00, 0x00, 0x10, 0x4e, 0xf5, 0x55, 0x0e, 0x01, 0x00,	// orp U+2725 (✥)
+	0x00, 0x00, 0x00, 0x84, 0xb3, 0x39, 0x04, 0x00, 0x00,	// orp U+2727 (✧)
+	0x00, 0x00, 0x00, 0xc4, 0xa6, 0x10, 0x0a, 0x00, 0x00,	// orp U+2729 (✩)
+	0x00, 0x00, 0x38, 0x5b, 0xb4, 0x55, 0x9f, 0x03, 0x00,	// orp U+272A (✪)
+	0x00, 0x00, 0x10, 0xc4, 0x46, 0x28, 0x11, 0x00, 0x00,	// orp U+272C (✬)
+	0x00, 0x00, 0x10, 0xc4, 0xc5, 0x28, 0x11, 0x00, 0x00,	// orp U+272F (✯)
+	0x00, 0x00, 0x00, 0x8c, 0x16, 0x6b, 0xb5, 0x06, 0x00,	// orp U+2730 (✰)
+	0x00, 0x00, 0x10, 0x95, 0xa3, 0x38, 0x15, 0x01, 0x00,	// orp U+2732 (✲)
+	0x00, 0x00, 0x10, 0x95, 0xf3, 0x39, 0x15, 0x01, 0x00,	// orp U+2733 (✳)
+	0x00, 0x00, 0x28, 0x44, 0xe5, 0x38, 0x15, 0xa1, 0x00,	// orp U+2737 (✷)
+	0x00, 0x00, 0x28, 0x9f, 0xff, 0xf9, 0x9f, 0x02, 0x00,	// orp U+2739 (✹)
+	0x00, 0x00, 0x28, 0x95, 0xfb, 0xb9, 0x95, 0x02, 0x00,	// orp U+273A (✺)
+	0x00, 0x00, 0x54, 0x9b, 0x52, 0xb9, 0x15, 0x01, 0x00,	// orp U+273E (✾)
+	0x00, 0x40, 0x38, 0xdf, 0xe6, 0x7c, 0x1b, 0x00, 0x00,	// orp U+273F (✿)
+	0x00, 0x40, 0x38, 0x5b, 0xa5, 0x7c, 0x1b, 0x00, 0x00,	// orp U+2740 (❀)
+	0x00, 0x00, 0x10, 0xce, 0xe6, 0x7c, 0x04, 0x00, 0x00,	// orp U+2741 (❁)
+	0x00, 0x00, 0x38, 0x5f, 0xb5, 0x55, 0x9f, 0x03, 0x00,	// orp U+2742 (❂)
+	0x00, 0x00, 0x00, 0x5e, 0x1c, 0xc7, 0x1e, 0x00, 0x00,	// orp U+274D (❍)
+	0x00, 0x00, 0x00, 0x5f, 0x1c, 0xc7, 0xbf, 0x0f, 0x00,	// orp U+274F (❏)
+	0x00, 0x00, 0x00, 0xfe, 0x1f, 0xc7, 0xf1, 0x07, 0x00,	// orp U+2750 (❐)
+	0x00, 0x00, 0x20, 0x9c, 0x7a, 0xab, 0x1c, 0x02, 0x00,	// orp U+2756 (❖)
+	0x00, 0x00, 0x18, 0x86, 0x61, 0x18, 0x86, 0x01, 0x00,	// orp U+2759 (❙)
+	0x00, 0x00, 0x78, 0x9e, 0xe7, 0x79, 0x9e, 0x07, 0x00,	// orp U+275A (❚)
+	0x00, 0x23, 0x38, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+275B (❛)
+	0x00, 0xe3, 0x71, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,	// orp U+275C (❜)
+	0x80, 0x94, 0x6c, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00,	// orp U+275D (❝)
+	0x80, 0xf4, 0xdb, 0xa4, 0x04, 0x00, 0x00, 0x00, 0x00,	// orp U+275E (❞)
+	0x00, 0xe4, 0x4f, 0xd3, 0xe4, 0x41, 0x53, 0xe4, 0x00,	// orp U+2761 (❡)
+	0x80, 0xf3, 0x7d, 0x0e, 0x01, 0x10, 0x0e, 0x01, 0x00,	// orp U+2762 (❢)
+	0x00, 0xb0, 0x7d, 0x0e, 0x01, 0x10, 0x0e, 0x01, 0x00,	// orp U+2763 (❣)
+	0x00, 0x00, 0x00, 0xc0, 0xf6, 0x7d, 0x0e, 0x01, 0x00,	// orp U+2764 (❤)
+	0x00, 0x00, 0x18, 0xcf, 0xe3, 0x3d, 0x8f, 0x01, 0x00,	// orp U+2765 (❥)
+	0x00, 0x60, 0x76, 0xc4, 0xf6, 0x3d, 0xa7, 0x07, 0x00,	// orp U+2766 (❦)
+	0x00, 0x00, 0x00, 0x81, 0xe6, 0xed, 0x99, 0x00, 0x00,	// orp U+2767 (❧)
+	0x00, 0x80, 0x10, 0x86, 0x61, 0x18, 0x04, 0x02, 0x00,	// orp U+2768 (❨)
+	0x00, 0x20, 0x10, 0x0c, 0xc3, 0x30, 0x84, 0x00, 0x00,	// orp U+2769 (❩)
+	0x00, 0x40, 0x18, 0x86, 0x61, 0x18, 0x06, 0x01, 0x00,	// orp U+276A (❪)
+	0x00, 0x20, 0x18, 0x86, 0x61, 0x18, 0x86, 0x00, 0x00,	// orp U+276B (❫)
+	0x00, 0x80, 0x61, 0x0c, 0x63, 0x30, 0x0c, 0x86, 0x01,	// orp U+276C (❬)
+	0x00, 0x60, 0x18, 0x0c, 0x83, 0x31, 0x8c, 0x61, 0x00,	// orp U+276D (❭)
+	0x00, 0x00, 0x60, 0x8c, 0x31, 0x18, 0x0c, 0x06, 0x00,	// orp U+276E (❮)
+	0x00, 0x00, 0x0c, 0x06, 0x83, 0x31, 0xc6, 0x00, 0x00,	// orp U+276F (❯)
+	0x00, 0xc0, 0x71, 0x8e, 0x73, 0x38, 0x0e, 0xc7, 0x01,	// orp U+2770 (❰)
+	0x00, 0x70, 0x1c, 0x8e, 0xc3, 0x39, 0xce, 0x71, 0x00,	// orp U+2771 (❱)
+	0x00, 0x80, 0x31, 0x0c, 0x63, 0x30, 0x0c, 0x83, 0x01,	// orp U+2774 (❴)
+	0x00, 0x60, 0x30, 0x0c, 0x83, 0x31, 0x0c, 0x63, 0x00,	// orp U+2775 (❵)
+	0x80, 0xf3, 0x6d, 0xd9, 0xb6, 0x45, 0x9f, 0x03, 0x00,	// orp U+2776 (❶)
+	0x80, 0xf3, 0x6d, 0xd5, 0xb5, 0x45, 0x9f, 0x03, 0x00,	// orp U+2777 (❷)
+	0x80, 0xf3, 0x65, 0xd7, 0x76, 0x65, 0x9f, 0x03, 0x00,	// orp U+2778 (❸)
+	0x80, 0xf3, 0x75, 0x5d, 0x16, 0x6d, 0x9f, 0x03, 0x00,	// orp U+2779 (❹)
+	0x80, 0xf3, 0x45, 0x5d, 0x76, 0x65, 0x9f, 0x03, 0x00,	// orp U+277A (❺)
+	0x80, 0xf3, 0x4d, 0x5d, 0x56, 0x6d, 0x9f, 0x03, 0x00,	// orp U+277B (❻)
+	0x80, 0xf3, 0x45, 0xd7, 0xb6, 0x6d, 0x9f, 0x03, 0x00,	// orp U+277C (❼)
+	0x80, 0xf3, 0x6d, 0xd5, 0x56, 0x6d, 0x9f, 0x03, 0x00,	// orp U+277D (❽)
+	0x80, 0xf3, 0x6d, 0xd5, 0x74, 0x65, 0x9f, 0x03, 0x00,	// orp U+277E (❾)
+	0x80, 0xf7, 0xd7, 0x69, 0x9a, 0xd6, 0xbf, 0x07, 0x00,	// orp U+277F (❿)
+	0x80, 0xf3, 0x6d, 0xd9, 0xb6, 0x6d, 0x9f, 0x03, 0x00,	// orp U+278A (➊)
+	0x00, 0x00, 0x00, 0x0c, 0xf6, 0x63, 0x0c, 0x00, 0x00,	// orp U+2794 (➔)
+	0x00, 0x00, 0x00, 0x40, 0x20, 0x50, 0x18, 0x07, 0x00,	// orp U+2798 (➘)
+	0x00, 0x00, 0x00, 0x04, 0xf3, 0x31, 0x04, 0x00, 0x00,	// orp U+2799 (➙)
+	0x00, 0x00, 0x00, 0x00, 0x87, 0x51, 0x42, 0x00, 0x00,	// orp U+279A (➚)
+	0x00, 0x00, 0x00, 0x02, 0xf3, 0x33, 0x02, 0x00, 0x00,	// orp U+279B (➛)
+	0x00, 0x00, 0x00, 0x0c, 0xf7, 0xff, 0x1c, 0x03, 0x00,	// orp U+279C (➜)
+	0x00, 0x00, 0x00, 0x00, 0xf4, 0x43, 0x00, 0x00, 0x00,	// orp U+279D (➝)
+	0x00, 0x00, 0x00, 0x08, 0xf6, 0xff, 0x18, 0x02, 0x00,	// orp U+279E (➞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x10, 0x00, 0x00,	// orp U+279F (➟)
+	0x00, 0x00, 0x00, 0x08, 0xd6, 0xf7, 0x18, 0x02, 0x00,	// orp U+27A0 (➠)
+	0x00, 0x00, 0x00, 0xc8, 0xf7, 0x7f, 0x08, 0x00, 0x00,	// orp U+27A1 (➡)
+	0x00, 0x00, 0x0c, 0x8d, 0xc4, 0x7b, 0xcf, 0x00, 0x00,	// orp U+27A2 (➢)
+	0x00, 0x00, 0x0c, 0x8f, 0xc7, 0x4b, 0xcd, 0x00, 0x00,	// orp U+27A3 (➣)
+	0x00, 0x00, 0x00, 0x87, 0xc7, 0x7b, 0x07, 0x00, 0x00,	// orp U+27A4 (➤)
+	0x00, 0x00, 0x04, 0xc9, 0xf7, 0x7b, 0x08, 0x00, 0x00,	// orp U+27A5 (➥)
+	0x00, 0x00, 0x00, 0x88, 0xf7, 0x7f, 0x49, 0x00, 0x00,	// orp U+27A6 (➦)
+	0x00, 0x00, 0x10, 0xcf, 0xf7, 0x7f, 0x0f, 0x01, 0x00,	// orp U+27A7 (➧)
+	0x00, 0x00, 0x00, 0xc4, 0xf3, 0x3f, 0x04, 0x00, 0x00,	// orp U+27A8 (➨)
+	0x00, 0x00, 0x00, 0xc8, 0x15, 0x5e, 0x08, 0x00, 0x00,	// orp U+27A9 (➩)
+	0x00, 0x00, 0x00, 0xc8, 0x15, 0x86, 0x17, 0x02, 0x00,	// orp U+27AD (➭)
+	0x00, 0x00, 0x78, 0x3b, 0x0c, 0xc2, 0xbb, 0x07, 0x00,	// orp U+27B2 (➲)
+	0x00, 0x00, 0x00, 0x00, 0x70, 0xf9, 0x17, 0x00, 0x00,	// orp U+27B3 (➳)
+	0x00, 0x00, 0x00, 0xc2, 0x61, 0x20, 0x30, 0x0c, 0x00,	// orp U+27B4 (➴)
+	0x00, 0x00, 0x00, 0x30, 0x8c, 0x18, 0x87, 0x00, 0x00,	// orp U+27B6 (➶)
+	0x00, 0x00, 0x00, 0xc6, 0x71, 0xa0, 0x30, 0x0e, 0x00,	// orp U+27B7 (➷)
+	0x00, 0x00, 0x00, 0xc0, 0x70, 0xf9, 0xd7, 0x00, 0x00,	// orp U+27B8 (➸)
+	0x00, 0x00, 0x00, 0x38, 0x8c, 0x1e, 0x87, 0x01, 0x00,	// orp U+27B9 (➹)
+	0x00, 0x00, 0x00, 0x00, 0x32, 0xfd, 0x13, 0x02, 0x00,	// orp U+27BA (➺)
+	0x00, 0x00, 0x00, 0xc0, 0xf5, 0xff, 0x17, 0x00, 0x00,	// orp U+27BD (➽)
+	0x00, 0x00, 0x00, 0x80, 0x72, 0x81, 0x97, 0x02, 0x00,	// orp U+27BE (➾)
+	0x00, 0x00, 0x00, 0x40, 0x94, 0x14, 0xc3, 0x07, 0x00,	// orp U+27C0 (⟀)
+	0x00, 0x00, 0x00, 0x04, 0xa1, 0x38, 0xd5, 0x07, 0x00,	// orp U+27C1 (⟁)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x10, 0xc4, 0x07, 0x00,	// orp U+27C2 (⟂)
+	0x00, 0x00, 0x78, 0x41, 0x52, 0x25, 0x81, 0x07, 0x00,	// orp U+27C3 (⟃)
+	0x00, 0x00, 0x3c, 0x90, 0x54, 0x49, 0xd0, 0x03, 0x00,	// orp U+27C4 (⟄)
+	0x00, 0xa1, 0x28, 0x08, 0x42, 0x10, 0x04, 0x06, 0x00,	// orp U+27C5 (⟅)
+	0x00, 0x42, 0x51, 0x04, 0x81, 0x20, 0x88, 0x01, 0x00,	// orp U+27C6 (⟆)
+	0x00, 0x00, 0x44, 0x55, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+27C7 (⟇)
+	0x00, 0x10, 0xe4, 0x45, 0x51, 0xe8, 0x82, 0x00, 0x00,	// orp U+27C8 (⟈)
+	0x00, 0x00, 0x9e, 0x28, 0x8a, 0x5e, 0x10, 0x04, 0x00,	// orp U+27C9 (⟉)
+	0x00, 0x00, 0x10, 0x04, 0xe1, 0x10, 0x04, 0x01, 0x00,	// orp U+27CA (⟊)
+	0x00, 0x00, 0xfc, 0x02, 0x41, 0x10, 0x84, 0x00, 0x00,	// orp U+27CC (⟌)
+	0x00, 0x00, 0x10, 0x84, 0xa2, 0x44, 0x55, 0x04, 0x00,	// orp U+27D1 (⟑)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x95, 0x03, 0x00,	// orp U+27D2 (⟒)
+	0x00, 0x00, 0x00, 0x10, 0x44, 0x41, 0x1f, 0x00, 0x00,	// orp U+27D3 (⟓)
+	0x00, 0x00, 0x00, 0x5f, 0x50, 0x04, 0x01, 0x00, 0x00,	// orp U+27D4 (⟔)
+	0x00, 0x00, 0x00, 0xa3, 0xad, 0xda, 0x23, 0x00, 0x00,	// orp U+27D5 (⟕)
+	0x00, 0x00, 0x00, 0xf1, 0x56, 0x6d, 0x31, 0x00, 0x00,	// orp U+27D6 (⟖)
+	0x00, 0x00, 0x00, 0xc0, 0xec, 0x49, 0xde, 0x0c, 0x00,	// orp U+27D7 (⟗)
+	0x00, 0x00, 0x00, 0xca, 0xa6, 0x6c, 0x0a, 0x00, 0x00,	// orp U+27DA (⟚)
+	0x00, 0x00, 0x00, 0x8a, 0xb2, 0x29, 0x0a, 0x00, 0x00,	// orp U+27DB (⟛)
+	0x00, 0x00, 0x00, 0x80, 0xd0, 0x0b, 0x00, 0x00, 0x00,	// orp U+27DC (⟜)
+	0x00, 0x00, 0x00, 0x40, 0xf0, 0x07, 0x00, 0x00, 0x00,	// orp U+27DD (⟝)
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x83, 0x00, 0x00, 0x00,	// orp U+27DE (⟞)
+	0x00, 0x00, 0x10, 0x0a, 0x41, 0x10, 0x84, 0x03, 0x00,	// orp U+27DF (⟟)
+	0x00, 0x00, 0x00, 0x84, 0xf2, 0x29, 0x04, 0x00, 0x00,	// orp U+27E0 (⟠)
+	0x00, 0x00, 0x00, 0x08, 0x35, 0x52, 0x08, 0x00, 0x00,	// orp U+27E2 (⟢)
+	0x00, 0x00, 0x00, 0x84, 0x12, 0x2b, 0x04, 0x00, 0x00,	// orp U+27E3 (⟣)
+	0x00, 0x00, 0x00, 0xbe, 0x38, 0x8a, 0x3e, 0x00, 0x00,	// orp U+27E4 (⟤)
+	0x00, 0x00, 0x00, 0x5f, 0x14, 0x47, 0x1f, 0x00, 0x00,	// orp U+27E5 (⟥)
+	0xc0, 0x57, 0x14, 0x45, 0x51, 0x14, 0x45, 0xf1, 0x01,	// orp U+27E6 (⟦)
+	0xc0, 0x47, 0x51, 0x14, 0x45, 0x51, 0x14, 0xf5, 0x01,	// orp U+27E7 (⟧)
+	0x00, 0x80, 0x20, 0x04, 0x21, 0x10, 0x04, 0x82, 0x00,	// orp U+27E8 (⟨)
+	0x00, 0x20, 0x08, 0x04, 0x81, 0x10, 0x84, 0x20, 0x00,	// orp U+27E9 (⟩)
+	0x00, 0x4a, 0x51, 0x8a, 0x52, 0x28, 0x0a, 0x45, 0xa1,	// orp U+27EA (⟪)
+	0x40, 0xa1, 0x28, 0x14, 0x85, 0x52, 0x94, 0xa2, 0x14,	// orp U+27EB (⟫)
+	0x00, 0x84, 0x30, 0x8a, 0xa2, 0x28, 0x0a, 0x83, 0x40,	// orp U+27EC (⟬)
+	0x02, 0xc1, 0x50, 0x14, 0x45, 0x51, 0x14, 0x43, 0x08,	// orp U+27ED (⟭)
+	0x00, 0x20, 0x10, 0x04, 0x41, 0x10, 0x04, 0x21, 0x00,	// orp U+27EE (⟮)
+	0x00, 0x40, 0x08, 0x82, 0x20, 0x08, 0x82, 0x40, 0x00,	// orp U+27EF (⟯)
+	0x00, 0x00, 0x10, 0x4e, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+27F0 (⟰)
+	0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x0e, 0x01, 0x00,	// orp U+27F1 (⟱)
+	0x00, 0x00, 0x70, 0xe2, 0x29, 0x82, 0x22, 0x07, 0x00,	// orp U+27F2 (⟲)
+	0x00, 0x00, 0x38, 0x51, 0x1e, 0x05, 0x91, 0x03, 0x00,	// orp U+27F3 (⟳)
+	0x00, 0x00, 0x00, 0x80, 0xf5, 0x5b, 0x00, 0x00, 0x00,	// orp U+27F4 (⟴)
+	0x00, 0x00, 0x00, 0x08, 0xf4, 0x43, 0x08, 0x00, 0x00,	// orp U+27F6 (⟶)
+	0x00, 0x00, 0x00, 0x80, 0xf4, 0x4b, 0x00, 0x00, 0x00,	// orp U+27F7 (⟷)
+	0x00, 0x00, 0x20, 0x84, 0x1f, 0xf8, 0x04, 0x02, 0x00,	// orp U+27F8 (⟸)
+	0x00, 0x00, 0x10, 0xc8, 0x07, 0x7e, 0x08, 0x01, 0x00,	// orp U+27F9 (⟹)
+	0x00, 0x00, 0x00, 0xa4, 0xf8, 0x8b, 0x24, 0x00, 0x00,	// orp U+27FB (⟻)
+	0x00, 0x00, 0x00, 0x49, 0xf4, 0x47, 0x09, 0x00, 0x00,	// orp U+27FC (⟼)
+	0x00, 0x00, 0xa0, 0xa4, 0x1f, 0xfa, 0x24, 0x0a, 0x00,	// orp U+27FD (⟽)
+	0x00, 0x00, 0x14, 0xc9, 0x17, 0x7e, 0x49, 0x01, 0x00,	// orp U+27FE (⟾)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2801 (⠁)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2802 (⠂)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2803 (⠃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+2804 (⠄)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+2805 (⠅)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+2806 (⠆)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+2807 (⠇)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2808 (⠈)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2809 (⠉)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+280A (⠊)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+280B (⠋)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+280C (⠌)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+280D (⠍)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+280E (⠎)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x00, 0x00,	// orp U+280F (⠏)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2810 (⠐)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2811 (⠑)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2812 (⠒)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2813 (⠓)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+2814 (⠔)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+2815 (⠕)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+2816 (⠖)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+2817 (⠗)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2818 (⠘)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+2819 (⠙)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+281A (⠚)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x00, 0x00,	// orp U+281B (⠛)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+281C (⠜)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+281D (⠝)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+281E (⠞)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x00, 0x00,	// orp U+281F (⠟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2820 (⠠)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2821 (⠡)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2822 (⠢)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2823 (⠣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2824 (⠤)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2825 (⠥)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2826 (⠦)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2827 (⠧)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2828 (⠨)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+2829 (⠩)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+282A (⠪)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x00, 0x00,	// orp U+282B (⠫)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+282C (⠬)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+282D (⠭)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+282E (⠮)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x00, 0x00,	// orp U+282F (⠯)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2830 (⠰)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2831 (⠱)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2832 (⠲)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2833 (⠳)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2834 (⠴)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2835 (⠵)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+2837 (⠷)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2838 (⠸)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+2839 (⠹)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+283A (⠺)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x00, 0x00,	// orp U+283B (⠻)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+283C (⠼)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+283D (⠽)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+283E (⠾)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x00, 0x00,	// orp U+283F (⠿)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2840 (⡀)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2841 (⡁)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2842 (⡂)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2843 (⡃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2844 (⡄)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2845 (⡅)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2846 (⡆)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2847 (⡇)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2848 (⡈)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+2849 (⡉)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+284A (⡊)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x30, 0x0c,	// orp U+284B (⡋)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+284C (⡌)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+284D (⡍)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+284E (⡎)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x30, 0x0c,	// orp U+284F (⡏)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2850 (⡐)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2851 (⡑)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2852 (⡒)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2853 (⡓)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2854 (⡔)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2855 (⡕)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2856 (⡖)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+2857 (⡗)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2858 (⡘)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+2859 (⡙)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+285A (⡚)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x30, 0x0c,	// orp U+285B (⡛)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+285C (⡜)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+285D (⡝)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+285E (⡞)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x30, 0x0c,	// orp U+285F (⡟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2860 (⡠)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2861 (⡡)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2862 (⡢)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2863 (⡣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2864 (⡤)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2865 (⡥)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2866 (⡦)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2867 (⡧)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2868 (⡨)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+2869 (⡩)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+286A (⡪)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x30, 0x0c,	// orp U+286B (⡫)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+286C (⡬)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+286D (⡭)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+286E (⡮)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+286F (⡯)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2870 (⡰)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2871 (⡱)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2872 (⡲)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2873 (⡳)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2874 (⡴)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2875 (⡵)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2876 (⡶)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+2877 (⡷)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2878 (⡸)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+2879 (⡹)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+287A (⡺)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x30, 0x0c,	// orp U+287B (⡻)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+287C (⡼)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+287D (⡽)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+287E (⡾)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x30, 0x0c,	// orp U+287F (⡿)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2880 (⢀)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2881 (⢁)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2882 (⢂)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2883 (⢃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+2884 (⢄)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+2885 (⢅)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+2886 (⢆)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+2887 (⢇)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2888 (⢈)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+2889 (⢉)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+288A (⢊)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x00, 0x00, 0x80, 0x61,	// orp U+288B (⢋)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+288C (⢌)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+288D (⢍)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+288E (⢎)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0x80, 0x61,	// orp U+288F (⢏)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2890 (⢐)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2891 (⢑)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2892 (⢒)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2893 (⢓)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+2894 (⢔)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+2895 (⢕)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+2896 (⢖)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+2897 (⢗)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2898 (⢘)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+2899 (⢙)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+289A (⢚)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00, 0x00, 0x80, 0x61,	// orp U+289B (⢛)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+289C (⢜)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+289D (⢝)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+289E (⢞)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0x80, 0x61,	// orp U+289F (⢟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A0 (⢠)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A1 (⢡)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A2 (⢢)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A3 (⢣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28A4 (⢤)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28A5 (⢥)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28A6 (⢦)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28A7 (⢧)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A8 (⢨)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28A9 (⢩)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28AA (⢪)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x60, 0x18, 0x80, 0x61,	// orp U+28AB (⢫)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28AC (⢬)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28AD (⢭)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28AE (⢮)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28AF (⢯)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B0 (⢰)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B1 (⢱)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B2 (⢲)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B3 (⢳)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28B4 (⢴)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28B5 (⢵)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28B6 (⢶)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28B7 (⢷)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B8 (⢸)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28B9 (⢹)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28BA (⢺)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x60, 0x18, 0x80, 0x61,	// orp U+28BB (⢻)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28BC (⢼)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28BD (⢽)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28BE (⢾)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0x80, 0x61,	// orp U+28BF (⢿)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C0 (⣀)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C1 (⣁)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C2 (⣂)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C3 (⣃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28C4 (⣄)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28C5 (⣅)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28C6 (⣆)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28C7 (⣇)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C8 (⣈)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28C9 (⣉)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28CA (⣊)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28CB (⣋)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28CC (⣌)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28CD (⣍)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28CE (⣎)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28CF (⣏)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D0 (⣐)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D1 (⣑)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D2 (⣒)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D3 (⣓)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28D4 (⣔)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28D5 (⣕)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28D6 (⣖)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28D7 (⣗)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D8 (⣘)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28D9 (⣙)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28DA (⣚)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x00, 0x00, 0xb0, 0x6d,	// orp U+28DB (⣛)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28DC (⣜)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28DD (⣝)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28DE (⣞)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x0c, 0x03, 0xb0, 0x6d,	// orp U+28DF (⣟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E0 (⣠)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E1 (⣡)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E2 (⣢)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E3 (⣣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28E4 (⣤)
+	0xc0, 0x30, 0x00, 0x00, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28E5 (⣥)
+	0x00, 0x00, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28E6 (⣦)
+	0xc0, 0x30, 0x00, 0xc3, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28E7 (⣧)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E8 (⣨)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28E9 (⣩)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28EA (⣪)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28EB (⣫)
+	0x00, 0x86, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28EC (⣬)
+	0xc0, 0xb6, 0x01, 0x00, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28ED (⣭)
+	0x00, 0x86, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28EE (⣮)
+	0xc0, 0xb6, 0x01, 0xc3, 0x00, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28EF (⣯)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F0 (⣰)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F1 (⣱)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F2 (⣲)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F3 (⣳)
+	0x00, 0x00, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28F4 (⣴)
+	0xc0, 0x30, 0x00, 0x18, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28F5 (⣵)
+	0x00, 0x00, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28F6 (⣶)
+	0xc0, 0x30, 0x00, 0xdb, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28F7 (⣷)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F8 (⣸)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28F9 (⣹)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28FA (⣺)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x60, 0x18, 0xb0, 0x6d,	// orp U+28FB (⣻)
+	0x00, 0x86, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28FC (⣼)
+	0xc0, 0xb6, 0x01, 0x18, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28FD (⣽)
+	0x00, 0x86, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28FE (⣾)
+	0xc0, 0xb6, 0x01, 0xdb, 0x06, 0x6c, 0x1b, 0xb0, 0x6d,	// orp U+28FF (⣿)
+	0x00, 0x00, 0x00, 0x82, 0xf6, 0x6b, 0x02, 0x00, 0x00,	// orp U+2900 (⤀)
+	0x00, 0x00, 0x00, 0x86, 0xf5, 0x5b, 0x06, 0x00, 0x00,	// orp U+2901 (⤁)
+	0x00, 0x00, 0x00, 0x94, 0x1f, 0xf9, 0x14, 0x00, 0x00,	// orp U+2902 (⤂)
+	0x00, 0x00, 0x00, 0xca, 0x27, 0x7e, 0x0a, 0x00, 0x00,	// orp U+2903 (⤃)
+	0x00, 0x00, 0x00, 0x84, 0x57, 0x7a, 0x04, 0x00, 0x00,	// orp U+2904 (⤄)
+	0x00, 0x00, 0x00, 0x40, 0xf6, 0x67, 0x00, 0x00, 0x00,	// orp U+2905 (⤅)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x54, 0x0e, 0x01, 0x00,	// orp U+2908 (⤈)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x7c, 0x04, 0x01, 0x00,	// orp U+2909 (⤉)
+	0x00, 0x40, 0x38, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+290A (⤊)
+	0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x0e, 0x01, 0x00,	// orp U+290B (⤋)
+	0x00, 0x00, 0x00, 0x84, 0x70, 0x0b, 0x04, 0x00, 0x00,	// orp U+290C (⤌)
+	0x00, 0x00, 0x00, 0x08, 0xb4, 0x43, 0x08, 0x00, 0x00,	// orp U+290D (⤍)
+	0x00, 0x00, 0x00, 0x00, 0x90, 0xd9, 0x19, 0x00, 0x00,	// orp U+2910 (⤐)
+	0x00, 0x00, 0x00, 0x00, 0x81, 0x54, 0x08, 0x01, 0x00,	// orp U+2911 (⤑)
+	0x00, 0x00, 0x7c, 0x84, 0x53, 0x11, 0x04, 0x01, 0x00,	// orp U+2912 (⤒)
+	0x00, 0x00, 0x10, 0x04, 0x51, 0x39, 0xc4, 0x07, 0x00,	// orp U+2913 (⤓)
+	0x00, 0x00, 0x00, 0x44, 0xe5, 0x57, 0x04, 0x00, 0x00,	// orp U+2914 (⤔)
+	0x00, 0x00, 0x00, 0x4c, 0xe7, 0x77, 0x0c, 0x00, 0x00,	// orp U+2915 (⤕)
+	0x00, 0x00, 0x00, 0x40, 0xe6, 0x67, 0x00, 0x00, 0x00,	// orp U+2916 (⤖)
+	0x00, 0x00, 0x00, 0x44, 0xe7, 0x77, 0x04, 0x00, 0x00,	// orp U+2917 (⤗)
+	0x00, 0x00, 0x00, 0xc6, 0xe7, 0x7f, 0x06, 0x00, 0x00,	// orp U+2918 (⤘)
+	0x00, 0x00, 0x00, 0x00, 0x84, 0x1c, 0x08, 0x04, 0x00,	// orp U+2919 (⤙)
+	0x00, 0x00, 0x00, 0x40, 0x20, 0xf0, 0x42, 0x00, 0x00,	// orp U+291A (⤚)
+	0x00, 0x00, 0x00, 0x00, 0xa5, 0x3c, 0x0a, 0x05, 0x00,	// orp U+291B (⤛)
+	0x00, 0x00, 0x00, 0x40, 0xa1, 0xf0, 0x4a, 0x01, 0x00,	// orp U+291C (⤜)
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xf4, 0x08, 0x00, 0x00,	// orp U+291D (⤝)
+	0x00, 0x00, 0x00, 0x00, 0x40, 0xbc, 0x04, 0x00, 0x00,	// orp U+291E (⤞)
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xf6, 0x28, 0x00, 0x00,	// orp U+291F (⤟)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0xbc, 0x05, 0x00, 0x00,	// orp U+2920 (⤠)
+	0x00, 0x00, 0x00, 0xc0, 0x31, 0x54, 0x18, 0x07, 0x00,	// orp U+2921 (⤡)
+	0x00, 0x00, 0x00, 0x00, 0x87, 0x55, 0xc3, 0x01, 0x00,	// orp U+2922 (⤢)
+	0x00, 0x00, 0x00, 0xc7, 0x50, 0x20, 0x10, 0x06, 0x00,	// orp U+2923 (⤣)
+	0x00, 0x00, 0x00, 0x1c, 0x46, 0x09, 0xc1, 0x00, 0x00,	// orp U+2924 (⤤)
+	0x00, 0x00, 0x00, 0x43, 0x20, 0x50, 0x18, 0x07, 0x00,	// orp U+2925 (⤥)
+	0x00, 0x00, 0x00, 0x18, 0x84, 0x14, 0xc3, 0x01, 0x00,	// orp U+2926 (⤦)
+	0x00, 0x00, 0x00, 0xc0, 0xb6, 0x11, 0x4a, 0x04, 0x00,	// orp U+2927 (⤧)
+	0x00, 0x00, 0x00, 0x40, 0xa6, 0x11, 0x5a, 0x06, 0x00,	// orp U+2928 (⤨)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0xdb, 0x06, 0x00,	// orp U+2929 (⤩)
+	0x00, 0x00, 0x00, 0xc0, 0xb4, 0x10, 0xcb, 0x04, 0x00,	// orp U+292A (⤪)
+	0x00, 0x00, 0x00, 0x40, 0xa6, 0x11, 0x4a, 0x04, 0x00,	// orp U+292F (⤯)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x5a, 0x06, 0x00,	// orp U+2930 (⤰)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xf5, 0x10, 0x00, 0x00,	// orp U+2933 (⤳)
+	0x00, 0x00, 0x10, 0x4e, 0x45, 0x0c, 0x00, 0x00, 0x00,	// orp U+2934 (⤴)
+	0x00, 0x00, 0x00, 0xc0, 0x40, 0x54, 0x0e, 0x01, 0x00,	// orp U+2935 (⤵)
+	0x00, 0x00, 0x40, 0x10, 0x25, 0x3d, 0x02, 0x01, 0x00,	// orp U+2936 (⤶)
+	0x00, 0x00, 0x04, 0x41, 0x91, 0x78, 0x08, 0x01, 0x00,	// orp U+2937 (⤷)
+	0x00, 0x40, 0x20, 0x10, 0x04, 0x29, 0x86, 0x03, 0x00,	// orp U+2938 (⤸)
+	0x00, 0x80, 0x10, 0x82, 0x20, 0x50, 0x18, 0x07, 0x00,	// orp U+2939 (⤹)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x1d, 0x00, 0x00, 0x00,	// orp U+293A (⤺)
+	0x00, 0x00, 0x00, 0x00, 0x97, 0x59, 0x00, 0x00, 0x00,	// orp U+293B (⤻)
+	0x00, 0x00, 0x58, 0x19, 0x07, 0x7c, 0x00, 0x00, 0x00,	// orp U+293C (⤼)
+	0x40, 0x33, 0x1d, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+293D (⤽)
+	0x00, 0x00, 0x00, 0x08, 0x74, 0x4d, 0x0d, 0x00, 0x00,	// orp U+293E (⤾)
+	0x00, 0x00, 0x00, 0x42, 0xd0, 0x65, 0x16, 0x00, 0x00,	// orp U+293F (⤿)
+	0x00, 0x80, 0x10, 0x5e, 0x99, 0x86, 0xa1, 0x07, 0x00,	// orp U+2940 (⥀)
+	0x00, 0x40, 0x20, 0x5e, 0x5a, 0x86, 0xa1, 0x07, 0x00,	// orp U+2941 (⥁)
+	0x00, 0x02, 0xfd, 0x10, 0x02, 0x08, 0x8f, 0x00, 0x00,	// orp U+2942 (⥂)
+	0x00, 0x40, 0x08, 0xbf, 0x40, 0x40, 0x3c, 0x04, 0x00,	// orp U+2943 (⥃)
+	0x00, 0x00, 0xf1, 0x10, 0x21, 0xfc, 0x02, 0x01, 0x00,	// orp U+2944 (⥄)
+	0x00, 0x00, 0x00, 0xc8, 0x87, 0x08, 0x87, 0x00, 0x00,	// orp U+2945 (⥅)
+	0x00, 0x00, 0x00, 0xc2, 0x27, 0x20, 0x1c, 0x02, 0x00,	// orp U+2946 (⥆)
+	0x00, 0x00, 0x00, 0x00, 0x60, 0xfd, 0x16, 0x00, 0x00,	// orp U+2947 (⥇)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0xfd, 0x1e, 0x00, 0x00,	// orp U+2948 (⥈)
+	0x00, 0xe1, 0x54, 0x4e, 0x45, 0x10, 0x84, 0x42, 0x00,	// orp U+2949 (⥉)
+	0x00, 0x00, 0x00, 0x80, 0xf0, 0x21, 0x00, 0x00, 0x00,	// orp U+294A (⥊)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x09, 0x00, 0x00, 0x00,	// orp U+294B (⥋)
+	0x00, 0x40, 0x30, 0x14, 0x41, 0x10, 0x85, 0x41, 0x00,	// orp U+294C (⥌)
+	0x00, 0x40, 0x18, 0x05, 0x41, 0x10, 0x14, 0x43, 0x00,	// orp U+294D (⥍)
+	0x00, 0x00, 0x00, 0x00, 0xa0, 0x7c, 0x00, 0x00, 0x00,	// orp U+294E (⥎)
+	0x00, 0x40, 0x30, 0x14, 0x41, 0x10, 0x14, 0x43, 0x00,	// orp U+294F (⥏)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x0a, 0x00, 0x00,	// orp U+2950 (⥐)
+	0x00, 0x80, 0x30, 0x0a, 0x82, 0x20, 0x0a, 0x83, 0x00,	// orp U+2951 (⥑)
+	0x00, 0x00, 0x00, 0x40, 0x52, 0xfc, 0x41, 0x00, 0x00,	// orp U+2952 (⥒)
+	0x00, 0x00, 0x00, 0x00, 0x89, 0xfe, 0x20, 0x08, 0x00,	// orp U+2953 (⥓)
+	0x00, 0x00, 0x7c, 0x04, 0x43, 0x11, 0x04, 0x01, 0x00,	// orp U+2954 (⥔)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x31, 0xc4, 0x07, 0x00,	// orp U+2955 (⥕)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0xfc, 0x45, 0x02, 0x00,	// orp U+2956 (⥖)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0x28, 0x09, 0x00,	// orp U+2957 (⥗)
+	0x00, 0x00, 0x7c, 0x84, 0x51, 0x10, 0x04, 0x01, 0x00,	// orp U+2958 (⥘)
+	0x00, 0x00, 0x10, 0x04, 0x51, 0x18, 0xc4, 0x07, 0x00,	// orp U+2959 (⥙)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x7d, 0x10, 0x00, 0x00,	// orp U+295A (⥚)
+	0x00, 0x00, 0x00, 0x00, 0x90, 0x7c, 0x01, 0x00, 0x00,	// orp U+295B (⥛)
+	0x00, 0x00, 0x10, 0x0c, 0x45, 0x10, 0xc4, 0x07, 0x00,	// orp U+295C (⥜)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x50, 0x0c, 0x01, 0x00,	// orp U+295D (⥝)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x12, 0x00, 0x00,	// orp U+295E (⥞)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x7c, 0x09, 0x00, 0x00,	// orp U+295F (⥟)
+	0x00, 0x00, 0x7c, 0x04, 0x41, 0x14, 0x06, 0x01, 0x00,	// orp U+2961 (⥡)
+	0x00, 0x00, 0x00, 0x80, 0xf0, 0x01, 0x9f, 0x00, 0x00,	// orp U+2962 (⥢)
+	0x00, 0x00, 0x28, 0x9b, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+2963 (⥣)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x1f, 0x02, 0x00,	// orp U+2964 (⥤)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x28, 0x9b, 0x02, 0x00,	// orp U+2965 (⥥)
+	0x00, 0x00, 0x00, 0xc2, 0x07, 0x20, 0x1f, 0x00, 0x00,	// orp U+2966 (⥦)
+	0x00, 0x00, 0x00, 0xc0, 0x27, 0x00, 0x1f, 0x02, 0x00,	// orp U+2967 (⥧)
+	0x00, 0x00, 0x00, 0xc8, 0x07, 0x08, 0x1f, 0x00, 0x00,	// orp U+2968 (⥨)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x00, 0x9f, 0x00, 0x00,	// orp U+2969 (⥩)
+	0x00, 0x00, 0x00, 0x80, 0xf0, 0x01, 0x1f, 0x00, 0x00,	// orp U+296A (⥪)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x9f, 0x00, 0x00,	// orp U+296B (⥫)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x1f, 0x00, 0x00,	// orp U+296C (⥬)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x1f, 0x02, 0x00,	// orp U+296D (⥭)
+	0x00, 0x00, 0x28, 0x8b, 0xa2, 0x28, 0x9a, 0x02, 0x00,	// orp U+296E (⥮)
+	0x00, 0x00, 0x28, 0x9a, 0xa2, 0x28, 0x8b, 0x02, 0x00,	// orp U+296F (⥯)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x40, 0x0f, 0x00, 0x00,	// orp U+2970 (⥰)
+	0x00, 0x70, 0x00, 0x07, 0x80, 0x7c, 0x08, 0x00, 0x00,	// orp U+2971 (⥱)
+	0x00, 0x00, 0x58, 0x0d, 0x80, 0x7c, 0x08, 0x00, 0x00,	// orp U+2972 (⥲)
+	0x00, 0x00, 0x00, 0xc2, 0x27, 0x00, 0x56, 0x03, 0x00,	// orp U+2973 (⥳)
+	0x00, 0x00, 0x00, 0xc8, 0x87, 0x00, 0x56, 0x03, 0x00,	// orp U+2974 (⥴)
+	0x00, 0x80, 0x7c, 0x08, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2975 (⥵)
+	0x00, 0x80, 0x19, 0x81, 0x81, 0x01, 0xc2, 0x27, 0x00,	// orp U+2976 (⥶)
+	0x00, 0x00, 0x00, 0x00, 0xa4, 0x7c, 0x0a, 0x04, 0x00,	// orp U+2977 (⥷)
+	0x00, 0x30, 0x30, 0x10, 0x33, 0x20, 0x1f, 0x02, 0x00,	// orp U+2978 (⥸)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x20, 0x1f, 0x02, 0x00,	// orp U+2979 (⥹)
+	0x00, 0x00, 0x00, 0x00, 0xac, 0x7c, 0x0a, 0x0c, 0x00,	// orp U+297A (⥺)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x08, 0x9f, 0x00, 0x00,	// orp U+297B (⥻)
+	0x00, 0x00, 0x00, 0x80, 0x10, 0x78, 0x81, 0x00, 0x00,	// orp U+297C (⥼)
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x3d, 0x10, 0x02, 0x00,	// orp U+297D (⥽)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x11, 0x04, 0x01, 0x00,	// orp U+297E (⥾)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x95, 0x02, 0x00,	// orp U+297F (⥿)
+	0x00, 0x00, 0x00, 0x00, 0xe3, 0x79, 0x0c, 0x00, 0x00,	// orp U+2981 (⦁)
+	0x00, 0x00, 0x10, 0x0a, 0x01, 0x10, 0x0a, 0x01, 0x00,	// orp U+2982 (⦂)
+	0x00, 0xc0, 0x29, 0x8a, 0x92, 0x28, 0x8a, 0xc2, 0x01,	// orp U+2983 (⦃)
+	0x00, 0x70, 0x28, 0x8a, 0x22, 0x29, 0x8a, 0x72, 0x00,	// orp U+2984 (⦄)
+	0x00, 0x84, 0x30, 0x8c, 0xa2, 0x30, 0x0c, 0x02, 0x01,	// orp U+2985 (⦅)
+	0x80, 0x40, 0x30, 0x0c, 0x45, 0x31, 0x0c, 0x21, 0x00,	// orp U+2986 (⦆)
+	0x00, 0xc2, 0x30, 0x8a, 0xa2, 0x28, 0x0c, 0x83, 0x00,	// orp U+2987 (⦇)
+	0x80, 0x60, 0x18, 0x8a, 0xa2, 0x28, 0x86, 0x21, 0x00,	// orp U+2988 (⦈)
+	0x00, 0x84, 0x61, 0x14, 0x25, 0x51, 0x14, 0x86, 0x41,	// orp U+2989 (⦉)
+	0x80, 0x60, 0x18, 0x8a, 0x22, 0x29, 0x8a, 0x61, 0x08,	// orp U+298A (⦊)
+	0x80, 0x23, 0x08, 0x82, 0x20, 0x08, 0x82, 0x03, 0x38,	// orp U+298B (⦋)
+	0x80, 0x83, 0x20, 0x08, 0x82, 0x20, 0x88, 0x03, 0x38,	// orp U+298C (⦌)
+	0x80, 0x63, 0x28, 0x82, 0x20, 0x08, 0x82, 0xe0, 0x00,	// orp U+298D (⦍)
+	0x80, 0x83, 0x20, 0x08, 0x82, 0x20, 0x0a, 0xe3, 0x00,	// orp U+298E (⦎)
+	0x80, 0x23, 0x08, 0x82, 0x20, 0x08, 0x8a, 0xe1, 0x00,	// orp U+298F (⦏)
+	0x80, 0xc3, 0x28, 0x08, 0x82, 0x20, 0x08, 0xe2, 0x00,	// orp U+2990 (⦐)
+	0x00, 0x84, 0x20, 0x04, 0x21, 0x11, 0x04, 0x82, 0x40,	// orp U+2991 (⦑)
+	0x80, 0x40, 0x10, 0x08, 0x22, 0x21, 0x08, 0x41, 0x08,	// orp U+2992 (⦒)
+	0x00, 0x80, 0x10, 0x9c, 0x51, 0x18, 0x1c, 0x81, 0x00,	// orp U+2993 (⦓)
+	0x00, 0x20, 0x10, 0x07, 0x43, 0x31, 0x07, 0x21, 0x00,	// orp U+2994 (⦔)
+	0x00, 0x40, 0x29, 0x8b, 0xa3, 0x39, 0x8b, 0x42, 0x01,	// orp U+2995 (⦕)
+	0x00, 0x50, 0x28, 0x9a, 0xb3, 0x38, 0x9a, 0x52, 0x00,	// orp U+2996 (⦖)
+	0x00, 0x42, 0x18, 0x86, 0x61, 0x18, 0x06, 0x81, 0x00,	// orp U+2997 (⦗)
+	0x80, 0x40, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0x21, 0x00,	// orp U+2998 (⦘)
+	0x00, 0x20, 0x10, 0x02, 0x21, 0x10, 0x02, 0x01, 0x00,	// orp U+299A (⦚)
+	0x00, 0x00, 0x00, 0x02, 0x81, 0x50, 0x3f, 0x00, 0x00,	// orp U+299B (⦛)
+	0x00, 0x00, 0x00, 0x41, 0x10, 0x1c, 0xc5, 0x07, 0x00,	// orp U+299C (⦜)
+	0x00, 0x00, 0x04, 0xc1, 0x91, 0x54, 0xd1, 0x0f, 0x00,	// orp U+299D (⦝)
+	0x00, 0x82, 0x10, 0xb4, 0x24, 0xc6, 0xc1, 0x0f, 0x00,	// orp U+299E (⦞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xc6, 0x0f, 0x00,	// orp U+299F (⦟)
+	0x00, 0x00, 0x24, 0x06, 0x47, 0x72, 0x46, 0x02, 0x00,	// orp U+29A0 (⦠)
+	0x00, 0x00, 0x00, 0x40, 0x14, 0x39, 0x1b, 0x01, 0x00,	// orp U+29A1 (⦡)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0x21, 0x84, 0x00, 0x00,	// orp U+29A2 (⦢)
+	0x00, 0x00, 0x00, 0x02, 0x81, 0x40, 0x3f, 0x00, 0x00,	// orp U+29A3 (⦣)
+	0x00, 0x00, 0x40, 0x08, 0x21, 0xfc, 0xc0, 0x0f, 0x00,	// orp U+29A4 (⦤)
+	0x00, 0x00, 0x08, 0x04, 0x02, 0xfd, 0xc0, 0x0f, 0x00,	// orp U+29A5 (⦥)
+	0x00, 0x00, 0x00, 0x40, 0x20, 0x70, 0x00, 0x00, 0x00,	// orp U+29A6 (⦦)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x09, 0x01, 0x00, 0x00,	// orp U+29A7 (⦧)
+	0x00, 0x00, 0x00, 0x18, 0x46, 0x28, 0x3f, 0x00, 0x00,	// orp U+29A8 (⦨)
+	0x00, 0x00, 0x00, 0x86, 0x81, 0x50, 0x3f, 0x00, 0x00,	// orp U+29A9 (⦩)
+	0x00, 0x00, 0x00, 0xbf, 0x42, 0x60, 0x18, 0x00, 0x00,	// orp U+29AA (⦪)
+	0x00, 0x00, 0x00, 0x3f, 0x85, 0x18, 0x06, 0x00, 0x00,	// orp U+29AB (⦫)
+	0x00, 0x00, 0x00, 0x41, 0xb6, 0x15, 0x43, 0x00, 0x00,	// orp U+29AC (⦬)
+	0x00, 0x00, 0x00, 0xd0, 0xb4, 0x51, 0x18, 0x04, 0x00,	// orp U+29AD (⦭)
+	0x00, 0x00, 0x00, 0xc1, 0x50, 0x6c, 0x59, 0x00, 0x00,	// orp U+29AE (⦮)
+	0x00, 0x00, 0x00, 0x10, 0x46, 0x6d, 0x13, 0x04, 0x00,	// orp U+29AF (⦯)
+	0x00, 0x00, 0x00, 0x81, 0x63, 0x69, 0x1c, 0x08, 0x00,	// orp U+29B0 (⦰)
+	0x00, 0xe0, 0x01, 0x20, 0xa7, 0x59, 0x4e, 0x00, 0x00,	// orp U+29B1 (⦱)
+	0x00, 0xa1, 0x10, 0x20, 0xa7, 0x59, 0x4e, 0x00, 0x00,	// orp U+29B2 (⦲)
+	0x00, 0xe2, 0x21, 0x20, 0xa7, 0x59, 0x4e, 0x00, 0x00,	// orp U+29B3 (⦳)
+	0x00, 0xe1, 0x11, 0x20, 0xa7, 0x59, 0x4e, 0x00, 0x00,	// orp U+29B4 (⦴)
+	0x00, 0x00, 0x00, 0x5e, 0xdb, 0xb6, 0xad, 0x07, 0x00,	// orp U+29B7 (⦷)
+	0x00, 0x00, 0x00, 0x80, 0x33, 0x55, 0x99, 0x03, 0x00,	// orp U+29B8 (⦸)
+	0x00, 0x00, 0x00, 0x4e, 0x55, 0x7d, 0x91, 0x03, 0x00,	// orp U+29B9 (⦹)
+	0x00, 0x00, 0x00, 0x80, 0x53, 0x7d, 0x91, 0x03, 0x00,	// orp U+29BA (⦺)
+	0x00, 0x00, 0x00, 0x80, 0xb3, 0x55, 0x9b, 0x03, 0x00,	// orp U+29BB (⦻)
+	0x00, 0x00, 0x00, 0xde, 0x9c, 0x96, 0xb3, 0x07, 0x00,	// orp U+29BC (⦼)
+	0x00, 0x40, 0x38, 0x84, 0x53, 0x55, 0x95, 0x43, 0x00,	// orp U+29BD (⦽)
+	0x00, 0x00, 0x00, 0x5e, 0xd8, 0xa6, 0xa1, 0x07, 0x00,	// orp U+29BE (⦾)
+	0x00, 0x00, 0x00, 0x5e, 0xd8, 0xb6, 0xa1, 0x07, 0x00,	// orp U+29BF (⦿)
+	0x00, 0x00, 0x78, 0x61, 0x99, 0x96, 0xa1, 0x07, 0x00,	// orp U+29C0 (⧀)
+	0x00, 0x00, 0x00, 0x80, 0x91, 0xa5, 0x99, 0x01, 0x00,	// orp U+29C2 (⧂)
+	0x00, 0x00, 0x00, 0x80, 0x91, 0x27, 0xb9, 0x01, 0x00,	// orp U+29C3 (⧃)
+	0x00, 0x00, 0xfc, 0x61, 0xf9, 0x96, 0xe1, 0x0f, 0x00,	// orp U+29C6 (⧆)
+	0x00, 0x00, 0xfc, 0x61, 0xb9, 0x96, 0xe1, 0x0f, 0x00,	// orp U+29C7 (⧇)
+	0x00, 0x00, 0x00, 0xff, 0x3f, 0xcf, 0xff, 0x0f, 0x00,	// orp U+29C8 (⧈)
+	0x00, 0x00, 0x00, 0x4f, 0xd2, 0x9f, 0x24, 0x0f, 0x00,	// orp U+29C9 (⧉)
+	0x00, 0x00, 0x10, 0x00, 0xa1, 0x28, 0xd1, 0x07, 0x00,	// orp U+29CA (⧊)
+	0x00, 0x00, 0x10, 0x8a, 0x12, 0x7d, 0xc0, 0x07, 0x00,	// orp U+29CB (⧋)
+	0x00, 0xc0, 0x48, 0x6d, 0x99, 0xb6, 0xe1, 0x0f, 0x00,	// orp U+29CC (⧌)
+	0x00, 0x00, 0x00, 0x84, 0xa2, 0x44, 0xd1, 0x0f, 0x00,	// orp U+29CD (⧍)
+	0xc0, 0xd0, 0x44, 0xcd, 0x80, 0x59, 0x91, 0x85, 0x01,	// orp U+29CE (⧎)
+	0x00, 0x00, 0xa0, 0xac, 0x9a, 0xaa, 0x2c, 0x0a, 0x00,	// orp U+29CF (⧏)
+	0x00, 0x00, 0x14, 0x4d, 0x55, 0x56, 0x4d, 0x01, 0x00,	// orp U+29D0 (⧐)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x5d, 0x5b, 0x04, 0x00,	// orp U+29D1 (⧑)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x75, 0x5b, 0x04, 0x00,	// orp U+29D2 (⧒)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x7d, 0x5b, 0x04, 0x00,	// orp U+29D3 (⧓)
+	0x00, 0x00, 0x00, 0x40, 0xb4, 0x1c, 0x4b, 0x04, 0x00,	// orp U+29D4 (⧔)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x71, 0x5a, 0x04, 0x00,	// orp U+29D5 (⧕)
+	0x00, 0x00, 0x00, 0xc0, 0xa7, 0x10, 0xca, 0x07, 0x00,	// orp U+29D6 (⧖)
+	0x00, 0x00, 0x00, 0xc0, 0xe7, 0x10, 0xce, 0x07, 0x00,	// orp U+29D7 (⧗)
+	0x00, 0x00, 0x10, 0x08, 0x81, 0x10, 0x08, 0x01, 0x00,	// orp U+29D8 (⧘)
+	0x00, 0x00, 0x20, 0x04, 0x42, 0x20, 0x04, 0x02, 0x00,	// orp U+29D9 (⧙)
+	0x00, 0x00, 0x24, 0x52, 0x22, 0x25, 0x52, 0x02, 0x00,	// orp U+29DA (⧚)
+	0x00, 0x00, 0x48, 0x89, 0x94, 0x48, 0x89, 0x04, 0x00,	// orp U+29DB (⧛)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x54, 0x0a, 0x00, 0x00,	// orp U+29DC (⧜)
+	0x00, 0x00, 0x00, 0x00, 0xa1, 0x54, 0x0a, 0x00, 0x00,	// orp U+29DD (⧝)
+	0x00, 0x00, 0x00, 0x00, 0xe1, 0x54, 0x0e, 0x01, 0x00,	// orp U+29DE (⧞)
+	0x00, 0x00, 0x00, 0xc0, 0xf3, 0x4d, 0xd3, 0x07, 0x00,	// orp U+29E0 (⧠)
+	0x00, 0x00, 0x40, 0x18, 0x25, 0x7d, 0xc0, 0x07, 0x00,	// orp U+29E1 (⧡)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0xd5, 0x07, 0x00,	// orp U+29E2 (⧢)
+	0x00, 0x00, 0x00, 0x00, 0xf2, 0x11, 0x9f, 0x00, 0x00,	// orp U+29E3 (⧣)
+	0x00, 0x60, 0x35, 0x00, 0xf2, 0x11, 0x9f, 0x00, 0x00,	// orp U+29E4 (⧤)
+	0x00, 0x80, 0x20, 0x1f, 0xf1, 0x11, 0x9f, 0x20, 0x00,	// orp U+29E5 (⧥)
+	0x00, 0x00, 0x00, 0x40, 0xf4, 0x45, 0x5f, 0x04, 0x00,	// orp U+29E6 (⧦)
+	0x00, 0x00, 0x00, 0x00, 0xe1, 0x10, 0x0e, 0x01, 0x00,	// orp U+29E7 (⧧)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x4d, 0x0a, 0x01, 0x00,	// orp U+29E8 (⧨)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x65, 0x0a, 0x01, 0x00,	// orp U+29E9 (⧩)
+	0x00, 0x40, 0x38, 0x9f, 0x43, 0x10, 0x0e, 0x01, 0x00,	// orp U+29EA (⧪)
+	0x00, 0x41, 0x38, 0xce, 0xe7, 0x38, 0x04, 0x01, 0x00,	// orp U+29EB (⧫)
+	0x00, 0xe0, 0x44, 0x91, 0x43, 0x54, 0x0e, 0x01, 0x00,	// orp U+29EC (⧬)
+	0x00, 0xe0, 0x7c, 0x9f, 0x43, 0x54, 0x0e, 0x01, 0x00,	// orp U+29ED (⧭)
+	0x00, 0x00, 0x38, 0x84, 0xa3, 0x38, 0x84, 0x03, 0x00,	// orp U+29EE (⧮)
+	0x00, 0x00, 0x38, 0x84, 0xe3, 0x38, 0x84, 0x03, 0x00,	// orp U+29EF (⧯)
+	0x80, 0x43, 0x10, 0x4a, 0xa4, 0x10, 0x84, 0x03, 0x00,	// orp U+29F0 (⧰)
+	0x80, 0x43, 0x10, 0xce, 0xe7, 0x10, 0x84, 0x03, 0x00,	// orp U+29F1 (⧱)
+	0x00, 0xe0, 0x10, 0x4e, 0x14, 0x39, 0x84, 0x03, 0x00,	// orp U+29F2 (⧲)
+	0x00, 0xe0, 0x10, 0xce, 0xf7, 0x39, 0x84, 0x03, 0x00,	// orp U+29F3 (⧳)
+	0x00, 0x00, 0x00, 0x40, 0x81, 0x7c, 0x48, 0x01, 0x00,	// orp U+29F4 (⧴)
+	0x00, 0x20, 0x08, 0x04, 0x81, 0x20, 0x10, 0x04, 0x00,	// orp U+29F5 (⧵)
+	0x80, 0x07, 0x40, 0x10, 0x82, 0x10, 0x84, 0x20, 0x00,	// orp U+29F6 (⧶)
+	0x00, 0x20, 0x08, 0x84, 0x87, 0x20, 0x10, 0x04, 0x00,	// orp U+29F7 (⧷)
+	0x00, 0x00, 0x41, 0x08, 0x42, 0x10, 0x82, 0x00, 0x00,	// orp U+29F8 (⧸)
+	0x00, 0x00, 0x00, 0x80, 0xa2, 0x7c, 0x8a, 0x02, 0x00,	// orp U+29FA (⧺)
+	0x00, 0x00, 0x00, 0x80, 0xaa, 0xfe, 0xaa, 0x0a, 0x00,	// orp U+29FB (⧻)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+29FE (⧾)
+	0x00, 0x00, 0x00, 0x40, 0xf4, 0x45, 0x00, 0x00, 0x00,	// orp U+29FF (⧿)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x55, 0x91, 0x03, 0x00,	// orp U+2A03 (⨃)
+	0x00, 0x00, 0x44, 0x51, 0x14, 0x45, 0xd1, 0x07, 0x00,	// orp U+2A06 (⨆)
+	0x00, 0x00, 0x00, 0x0c, 0xe3, 0x79, 0xf3, 0x0c, 0x00,	// orp U+2A07 (⨇)
+	0x00, 0x00, 0x00, 0xf3, 0xec, 0x79, 0x0c, 0x03, 0x00,	// orp U+2A08 (⨈)
+	0x00, 0x00, 0x7c, 0x81, 0xa1, 0x18, 0xc1, 0x07, 0x00,	// orp U+2A0A (⨊)
+	0x08, 0x45, 0x10, 0x9f, 0x41, 0x18, 0x1f, 0x51, 0x08,	// orp U+2A0B (⨋)
+	0x00, 0xe7, 0x7b, 0x9e, 0xe7, 0x79, 0xde, 0xe7, 0x00,	// orp U+2A0C (⨌)
+	0x08, 0x45, 0x10, 0x84, 0x43, 0x10, 0x04, 0x51, 0x08,	// orp U+2A0D (⨍)
+	0x08, 0x45, 0x10, 0x84, 0x43, 0x38, 0x04, 0x51, 0x08,	// orp U+2A0E (⨎)
+	0x08, 0x45, 0x10, 0x14, 0x63, 0x14, 0x04, 0x51, 0x08,	// orp U+2A0F (⨏)
+	0x08, 0x45, 0x10, 0x4e, 0x51, 0x14, 0x06, 0x51, 0x08,	// orp U+2A10 (⨐)
+	0x08, 0x45, 0x10, 0x04, 0x5f, 0xbb, 0x04, 0x51, 0x08,	// orp U+2A11 (⨑)
+	0x08, 0x45, 0x10, 0x1c, 0x44, 0x41, 0x1c, 0x51, 0x08,	// orp U+2A12 (⨒)
+	0x08, 0x45, 0x10, 0x0c, 0x44, 0x41, 0x0c, 0x51, 0x08,	// orp U+2A13 (⨓)
+	0x08, 0x45, 0x10, 0x1c, 0x88, 0x82, 0x1c, 0x51, 0x08,	// orp U+2A14 (⨔)
+	0x08, 0x45, 0x10, 0x4e, 0x54, 0x45, 0x0e, 0x51, 0x08,	// orp U+2A15 (⨕)
+	0x08, 0x45, 0x10, 0x5f, 0x55, 0x7d, 0x04, 0x51, 0x08,	// orp U+2A16 (⨖)
+	0x10, 0x8a, 0x20, 0xca, 0xaf, 0x22, 0x08, 0xa2, 0x10,	// orp U+2A17 (⨗)
+	0x08, 0x45, 0x54, 0x0e, 0xe1, 0x54, 0x04, 0x51, 0x08,	// orp U+2A18 (⨘)
+	0x08, 0x45, 0x10, 0x4e, 0x55, 0x55, 0x04, 0x51, 0x08,	// orp U+2A19 (⨙)
+	0x08, 0x45, 0x10, 0x55, 0x55, 0x39, 0x04, 0x51, 0x08,	// orp U+2A1A (⨚)
+	0x1e, 0x80, 0x50, 0x04, 0x41, 0x10, 0x04, 0x51, 0x08,	// orp U+2A1B (⨛)
+	0x08, 0x45, 0x10, 0x04, 0x41, 0x10, 0x85, 0x00, 0x7c,	// orp U+2A1C (⨜)
+	0x00, 0x00, 0x84, 0x73, 0xdb, 0xb6, 0x73, 0x08, 0x00,	// orp U+2A1D (⨝)
+	0x00, 0x00, 0x20, 0x8c, 0x92, 0x28, 0x0c, 0x02, 0x00,	// orp U+2A1E (⨞)
+	0x00, 0x00, 0x10, 0x0a, 0x01, 0x10, 0x0a, 0x21, 0x00,	// orp U+2A1F (⨟)
+	0x00, 0x00, 0x00, 0x89, 0x44, 0x4a, 0x09, 0x00, 0x00,	// orp U+2A20 (⨠)
+	0x00, 0x00, 0x08, 0x86, 0x22, 0x08, 0x82, 0x00, 0x00,	// orp U+2A21 (⨡)
+	0x00, 0xa1, 0x10, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+2A22 (⨢)
+	0x00, 0x40, 0x28, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+2A23 (⨣)
+	0x00, 0x60, 0x35, 0x00, 0x41, 0x7c, 0x04, 0x01, 0x00,	// orp U+2A24 (⨤)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x00, 0x01, 0x00,	// orp U+2A25 (⨥)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0x10, 0x80, 0xd5, 0x00,	// orp U+2A26 (⨦)
+	0x00, 0x00, 0x10, 0xc4, 0x47, 0xd0, 0x20, 0x84, 0x03,	// orp U+2A27 (⨧)
+	0x00, 0x00, 0x00, 0x04, 0xf1, 0x11, 0x0e, 0x01, 0x00,	// orp U+2A28 (⨨)
+	0x00, 0x00, 0x00, 0x0c, 0x83, 0x10, 0xc0, 0x07, 0x00,	// orp U+2A29 (⨩)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x04, 0x00, 0x00,	// orp U+2A2A (⨪)
+	0x00, 0x00, 0x00, 0x02, 0xf0, 0x01, 0x08, 0x00, 0x00,	// orp U+2A2B (⨫)
+	0x00, 0x00, 0x00, 0x08, 0xf0, 0x01, 0x02, 0x00, 0x00,	// orp U+2A2C (⨬)
+	0x00, 0x00, 0x70, 0x42, 0xd2, 0x25, 0x02, 0x07, 0x00,	// orp U+2A2D (⨭)
+	0x00, 0x00, 0x18, 0x88, 0x74, 0x49, 0x88, 0x01, 0x00,	// orp U+2A2E (⨮)
+	0x00, 0x00, 0x00, 0x44, 0xa4, 0x10, 0x4a, 0x04, 0x00,	// orp U+2A30 (⨰)
+	0x00, 0x00, 0x44, 0x0a, 0xa1, 0x44, 0xc0, 0x07, 0x00,	// orp U+2A31 (⨱)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0xca, 0x07, 0x00,	// orp U+2A32 (⨲)
+	0x00, 0x00, 0x00, 0xc0, 0xec, 0x31, 0xde, 0x0c, 0x00,	// orp U+2A33 (⨳)
+	0x00, 0x00, 0x38, 0x41, 0x95, 0x54, 0x81, 0x03, 0x00,	// orp U+2A34 (⨴)
+	0x00, 0x00, 0x38, 0x50, 0x25, 0x55, 0x90, 0x03, 0x00,	// orp U+2A35 (⨵)
+	0x84, 0x02, 0x38, 0xd1, 0x56, 0x6d, 0x91, 0x03, 0x00,	// orp U+2A36 (⨶)
+	0x80, 0x13, 0x55, 0xd1, 0x17, 0x55, 0x91, 0x03, 0x00,	// orp U+2A38 (⨸)
+	0x00, 0x00, 0x30, 0x92, 0xe4, 0xb5, 0xe1, 0x0f, 0x00,	// orp U+2A39 (⨹)
+	0x00, 0x00, 0x30, 0x92, 0x24, 0xb5, 0xe1, 0x0f, 0x00,	// orp U+2A3A (⨺)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0x7c, 0x00, 0x00, 0x00,	// orp U+2A3D (⨽)
+	0x00, 0x40, 0x28, 0x04, 0x40, 0x28, 0x0c, 0x42, 0x00,	// orp U+2A3E (⨾)
+	0x00, 0x00, 0xec, 0x51, 0x14, 0x45, 0xd1, 0x0f, 0x00,	// orp U+2A3F (⨿)
+	0x00, 0x00, 0x38, 0x51, 0x15, 0x45, 0x51, 0x04, 0x00,	// orp U+2A40 (⩀)
+	0x00, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x91, 0x03, 0x00,	// orp U+2A41 (⩁)
+	0xc0, 0x07, 0x44, 0x51, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+2A42 (⩂)
+	0x00, 0xe0, 0x44, 0x51, 0x14, 0x45, 0x11, 0xf0, 0x01,	// orp U+2A43 (⩃)
+	0x00, 0x00, 0x38, 0x51, 0x14, 0x45, 0xd5, 0x06, 0x00,	// orp U+2A44 (⩄)
+	0x00, 0x00, 0x6c, 0x55, 0x14, 0x45, 0x91, 0x03, 0x00,	// orp U+2A45 (⩅)
+	0x00, 0x00, 0x24, 0x89, 0x01, 0x18, 0x49, 0x02, 0x00,	// orp U+2A46 (⩆)
+	0x00, 0x00, 0x18, 0x49, 0x02, 0x24, 0x89, 0x01, 0x00,	// orp U+2A47 (⩇)
+	0x00, 0x90, 0x24, 0x06, 0xf0, 0x00, 0x46, 0x92, 0x00,	// orp U+2A48 (⩈)
+	0x00, 0x60, 0x24, 0x09, 0xf0, 0x00, 0x49, 0x62, 0x00,	// orp U+2A49 (⩉)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x0a, 0x00, 0x00,	// orp U+2A4A (⩊)
+	0x00, 0x00, 0x00, 0x80, 0x52, 0x55, 0x00, 0x00, 0x00,	// orp U+2A4B (⩋)
+	0x00, 0x00, 0xfc, 0x92, 0x24, 0x49, 0x12, 0x03, 0x00,	// orp U+2A4C (⩌)
+	0x00, 0x00, 0x30, 0x92, 0x24, 0x49, 0xd2, 0x0f, 0x00,	// orp U+2A4D (⩍)
+	0x00, 0x00, 0x7c, 0xdf, 0xb6, 0x6d, 0xdb, 0x06, 0x00,	// orp U+2A4E (⩎)
+	0x00, 0x00, 0x6c, 0xdb, 0xb6, 0x6d, 0xdf, 0x07, 0x00,	// orp U+2A4F (⩏)
+	0x00, 0x00, 0x7c, 0xd1, 0x56, 0x6d, 0x91, 0x03, 0x00,	// orp U+2A50 (⩐)
+	0x00, 0x40, 0x00, 0x04, 0xa1, 0x28, 0x51, 0x04, 0x00,	// orp U+2A51 (⩑)
+	0x00, 0x00, 0x10, 0x51, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2A52 (⩒)
+	0x80, 0xa2, 0x10, 0x55, 0xa4, 0x28, 0x04, 0x01, 0x00,	// orp U+2A53 (⩓)
+	0x00, 0x41, 0x28, 0x4a, 0x54, 0x11, 0x8a, 0x02, 0x00,	// orp U+2A54 (⩔)
+	0x00, 0x00, 0x30, 0x8c, 0xe7, 0x79, 0xf3, 0x0c, 0x00,	// orp U+2A55 (⩕)
+	0x00, 0x00, 0xcc, 0xb3, 0xe7, 0x79, 0x0c, 0x03, 0x00,	// orp U+2A56 (⩖)
+	0x00, 0x00, 0x00, 0x61, 0x94, 0x14, 0x43, 0x00, 0x00,	// orp U+2A57 (⩗)
+	0x00, 0x00, 0x00, 0x20, 0x8c, 0x92, 0x62, 0x08, 0x00,	// orp U+2A58 (⩘)
+	0x00, 0x00, 0x44, 0x95, 0xa3, 0x38, 0x55, 0x04, 0x00,	// orp U+2A59 (⩙)
+	0x00, 0x00, 0x00, 0x04, 0xe1, 0x38, 0x55, 0x05, 0x00,	// orp U+2A5A (⩚)
+	0x00, 0x00, 0x00, 0x55, 0xe5, 0x38, 0x04, 0x01, 0x00,	// orp U+2A5B (⩛)
+	0x00, 0x00, 0x10, 0x84, 0xf2, 0x29, 0x51, 0x04, 0x00,	// orp U+2A5C (⩜)
+	0x00, 0x00, 0x44, 0x91, 0xf2, 0x29, 0x04, 0x01, 0x00,	// orp U+2A5D (⩝)
+	0xc0, 0x07, 0x7c, 0x00, 0x41, 0x28, 0x4a, 0x14, 0x01,	// orp U+2A5E (⩞)
+	0x00, 0x00, 0x10, 0x84, 0xa2, 0x44, 0x11, 0xf0, 0x01,	// orp U+2A5F (⩟)
+	0x00, 0x41, 0x28, 0x4a, 0x14, 0x01, 0x1f, 0xf0, 0x01,	// orp U+2A60 (⩠)
+	0x00, 0x00, 0x00, 0x00, 0xa0, 0x10, 0xc0, 0x07, 0x00,	// orp U+2A61 (⩡)
+	0xc0, 0x07, 0x7c, 0x40, 0x14, 0x29, 0x0a, 0x41, 0x00,	// orp U+2A62 (⩢)
+	0x40, 0x14, 0x29, 0x0a, 0x41, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2A63 (⩣)
+	0x00, 0x00, 0x61, 0x94, 0xf4, 0x49, 0x14, 0x06, 0x01,	// orp U+2A64 (⩤)
+	0x00, 0x10, 0x0c, 0x45, 0xf2, 0x25, 0xc5, 0x10, 0x00,	// orp U+2A65 (⩥)
+	0x00, 0x00, 0x00, 0x1f, 0xf0, 0x01, 0x04, 0x00, 0x00,	// orp U+2A66 (⩦)
+	0x00, 0x00, 0x10, 0xc0, 0x07, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2A67 (⩧)
+	0x00, 0x00, 0x28, 0x9f, 0xf2, 0x29, 0x9f, 0x02, 0x00,	// orp U+2A68 (⩨)
+	0x00, 0x00, 0x54, 0x7f, 0xf5, 0x57, 0x7f, 0x05, 0x00,	// orp U+2A69 (⩩)
+	0x00, 0x00, 0x00, 0x04, 0x60, 0x35, 0x00, 0x00, 0x00,	// orp U+2A6A (⩪)
+	0x00, 0x00, 0x58, 0x0d, 0xf0, 0x01, 0x56, 0x03, 0x00,	// orp U+2A6C (⩬)
+	0x00, 0x40, 0x00, 0x56, 0x03, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2A6D (⩭)
+	0x00, 0x50, 0x39, 0x9f, 0x53, 0x01, 0x1f, 0xf0, 0x01,	// orp U+2A6E (⩮)
+	0x00, 0x40, 0x28, 0x80, 0xd5, 0x00, 0x56, 0x03, 0x00,	// orp U+2A6F (⩯)
+	0x00, 0x60, 0x35, 0x80, 0xd5, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2A70 (⩰)
+	0x00, 0xf0, 0x01, 0x1f, 0x40, 0x10, 0x1f, 0x41, 0x00,	// orp U+2A71 (⩱)
+	0x00, 0x40, 0x10, 0x1f, 0x41, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2A72 (⩲)
+	0x00, 0x00, 0x00, 0x1f, 0xf0, 0x01, 0x56, 0x03, 0x00,	// orp U+2A73 (⩳)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x03, 0x35, 0x00, 0x00,	// orp U+2A74 (⩴)
+	0x00, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x1b, 0x00, 0x00,	// orp U+2A75 (⩵)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x15, 0x00, 0x00,	// orp U+2A76 (⩶)
+	0x00, 0x00, 0x28, 0xc0, 0x07, 0x7c, 0x80, 0x02, 0x00,	// orp U+2A77 (⩷)
+	0x00, 0x00, 0x54, 0xc0, 0x07, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2A78 (⩸)
+	0x00, 0x00, 0x20, 0x84, 0x94, 0x4a, 0x04, 0x02, 0x00,	// orp U+2A79 (⩹)
+	0x00, 0x00, 0x10, 0x88, 0x54, 0x4a, 0x08, 0x01, 0x00,	// orp U+2A7A (⩺)
+	0x03, 0x21, 0x00, 0x02, 0xcc, 0x0c, 0x0c, 0x0c, 0x00,	// orp U+2A7B (⩻)
+	0x18, 0x08, 0x01, 0xd0, 0xc0, 0xc0, 0xcc, 0x00, 0x00,	// orp U+2A7C (⩼)
+	0x00, 0x00, 0xc0, 0xcc, 0xc0, 0xcc, 0x0c, 0x0c, 0x00,	// orp U+2A7D (⩽)
+	0x00, 0x00, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0x00, 0x00,	// orp U+2A7E (⩾)
+	0x00, 0x00, 0xc0, 0xcc, 0xc8, 0xcc, 0x0c, 0x0c, 0x00,	// orp U+2A7F (⩿)
+	0x00, 0x00, 0x0c, 0x4c, 0xcc, 0xcc, 0xcc, 0x00, 0x00,	// orp U+2A80 (⪀)
+	0x00, 0x20, 0xc0, 0xcc, 0xc0, 0xcc, 0x0c, 0x0c, 0x00,	// orp U+2A81 (⪁)
+	0x00, 0x00, 0x0d, 0x0c, 0xcc, 0xcc, 0xcc, 0x00, 0x00,	// orp U+2A82 (⪂)
+	0x00, 0x08, 0xc0, 0xcc, 0xc0, 0xcc, 0x0c, 0x0c, 0x00,	// orp U+2A83 (⪃)
+	0x40, 0x00, 0x0c, 0x0c, 0xcc, 0xcc, 0xcc, 0x00, 0x00,	// orp U+2A84 (⪄)
+	0x00, 0xc0, 0x0d, 0x1c, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2A85 (⪅)
+	0xc0, 0x81, 0x1d, 0x80, 0xd5, 0x00, 0x56, 0x03, 0x00,	// orp U+2A86 (⪆)
+	0x00, 0x00, 0x33, 0x03, 0x03, 0x03, 0xc8, 0x2f, 0x00,	// orp U+2A87 (⪇)
+	0x00, 0x30, 0x30, 0x30, 0x33, 0x00, 0xc8, 0x2f, 0x00,	// orp U+2A88 (⪈)
+	0x00, 0x37, 0x70, 0x00, 0xe2, 0x35, 0x84, 0xf5, 0x08,	// orp U+2A89 (⪉)
+	0xc0, 0x81, 0x1d, 0x00, 0xe2, 0x35, 0x84, 0xf5, 0x08,	// orp U+2A8A (⪊)
+	0x00, 0x37, 0x70, 0xc0, 0x07, 0x7c, 0xc0, 0x81, 0x1d,	// orp U+2A8B (⪋)
+	0xc0, 0x81, 0x1d, 0xc0, 0x07, 0x7c, 0x00, 0x37, 0x70,	// orp U+2A8C (⪌)
+	0x00, 0xc0, 0x0d, 0x1c, 0x60, 0x35, 0xc0, 0x07, 0x00,	// orp U+2A8D (⪍)
+	0x00, 0x70, 0x60, 0x07, 0x60, 0x35, 0xc0, 0x07, 0x00,	// orp U+2A8E (⪎)
+	0x00, 0x37, 0x70, 0x80, 0xd5, 0x00, 0x07, 0x76, 0x00,	// orp U+2A8F (⪏)
+	0xc0, 0x81, 0x1d, 0x80, 0xd5, 0x00, 0xdc, 0xc0, 0x01,	// orp U+2A90 (⪐)
+	0x00, 0x37, 0x70, 0x07, 0x76, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2A91 (⪑)
+	0xc0, 0x81, 0x1d, 0xdc, 0xc0, 0x01, 0x1f, 0xf0, 0x01,	// orp U+2A92 (⪒)
+	0x00, 0x7e, 0xe0, 0x07, 0x7e, 0xe0, 0x07, 0x7e, 0x00,	// orp U+2A93 (⪓)
+	0xc0, 0x81, 0x1f, 0xf8, 0x81, 0x1f, 0xf8, 0x81, 0x03,	// orp U+2A94 (⪔)
+	0x00, 0x00, 0xc0, 0xcc, 0xcc, 0x0c, 0x0c, 0x0c, 0x00,	// orp U+2A95 (⪕)
+	0x00, 0x00, 0x0c, 0xcc, 0xcc, 0xc0, 0xcc, 0x00, 0x00,	// orp U+2A96 (⪖)
+	0x00, 0x00, 0xc0, 0xcc, 0xcc, 0x8c, 0x0c, 0x0c, 0x00,	// orp U+2A97 (⪗)
+	0x00, 0x00, 0x0c, 0xcc, 0xcc, 0xc4, 0xcc, 0x00, 0x00,	// orp U+2A98 (⪘)
+	0x00, 0x00, 0x7c, 0xc0, 0x07, 0x1c, 0xd8, 0x01, 0x00,	// orp U+2A99 (⪙)
+	0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x03, 0x03, 0x03,	// orp U+2A9B (⪛)
+	0x00, 0x30, 0x30, 0x33, 0x33, 0x33, 0x30, 0x33, 0x00,	// orp U+2A9C (⪜)
+	0x00, 0x00, 0x00, 0x56, 0x03, 0x70, 0x03, 0x07, 0x00,	// orp U+2A9D (⪝)
+	0x00, 0x00, 0x00, 0x56, 0x03, 0x1c, 0xd8, 0x01, 0x00,	// orp U+2A9E (⪞)
+	0x80, 0xd5, 0x00, 0xdc, 0xc0, 0x01, 0x1f, 0xf0, 0x01,	// orp U+2A9F (⪟)
+	0x80, 0xd5, 0x00, 0x07, 0x76, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2AA0 (⪠)
+	0x00, 0x00, 0x20, 0x84, 0x94, 0x48, 0x04, 0x02, 0x00,	// orp U+2AA1 (⪡)
+	0x00, 0x00, 0x08, 0x44, 0x22, 0x25, 0x84, 0x00, 0x00,	// orp U+2AA2 (⪢)
+	0x00, 0x00, 0x90, 0x52, 0x22, 0x91, 0xc0, 0x0f, 0x00,	// orp U+2AA3 (⪣)
+	0x00, 0x00, 0x00, 0x33, 0x23, 0x31, 0x33, 0x00, 0x00,	// orp U+2AA4 (⪤)
+	0x00, 0x00, 0x00, 0xa1, 0xc4, 0x48, 0x21, 0x00, 0x00,	// orp U+2AA5 (⪥)
+	0x00, 0x00, 0x00, 0x10, 0x3b, 0xb2, 0x10, 0x00, 0x00,	// orp U+2AA6 (⪦)
+	0x00, 0x00, 0x00, 0x42, 0x13, 0x37, 0x02, 0x00, 0x00,	// orp U+2AA7 (⪧)
+	0x00, 0x00, 0x40, 0xec, 0xc8, 0x4e, 0x0c, 0x0c, 0x00,	// orp U+2AA8 (⪨)
+	0x00, 0x00, 0x08, 0x4d, 0xdc, 0xc8, 0xcc, 0x00, 0x00,	// orp U+2AA9 (⪩)
+	0x00, 0x00, 0x00, 0x30, 0xf3, 0x33, 0x30, 0x00, 0x00,	// orp U+2AAA (⪪)
+	0x00, 0x00, 0x00, 0x03, 0xf3, 0x33, 0x03, 0x00, 0x00,	// orp U+2AAB (⪫)
+	0x00, 0x00, 0xc0, 0xcc, 0xcf, 0xc0, 0xc0, 0x0f, 0x00,	// orp U+2AAC (⪬)
+	0x00, 0x00, 0x0c, 0xcc, 0xcf, 0x0c, 0xc0, 0x0f, 0x00,	// orp U+2AAD (⪭)
+	0x00, 0x00, 0x00, 0xc4, 0x06, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2AAE (⪮)
+	0x00, 0x00, 0x40, 0xcc, 0xc0, 0x40, 0xc0, 0x07, 0x00,	// orp U+2AAF (⪯)
+	0x00, 0x00, 0x04, 0x06, 0x66, 0x04, 0xc0, 0x07, 0x00,	// orp U+2AB0 (⪰)
+	0x00, 0x00, 0x40, 0xcc, 0xc0, 0x40, 0xc8, 0x27, 0x00,	// orp U+2AB1 (⪱)
+	0x00, 0x00, 0x04, 0x06, 0x66, 0x04, 0xc8, 0x27, 0x00,	// orp U+2AB2 (⪲)
+	0x00, 0x00, 0x31, 0x03, 0x03, 0x01, 0x1f, 0xf0, 0x01,	// orp U+2AB3 (⪳)
+	0x00, 0x10, 0x18, 0x98, 0x11, 0x00, 0x1f, 0xf0, 0x01,	// orp U+2AB4 (⪴)
+	0x00, 0xc4, 0x0c, 0x0c, 0x84, 0x7c, 0xc4, 0x27, 0x00,	// orp U+2AB5 (⪵)
+	0x40, 0x60, 0x60, 0x46, 0x80, 0x7c, 0xc4, 0x27, 0x00,	// orp U+2AB6 (⪶)
+	0x10, 0x33, 0x30, 0x10, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2AB7 (⪷)
+	0x81, 0x81, 0x19, 0x01, 0xd0, 0x58, 0x40, 0x63, 0x01,	// orp U+2AB8 (⪸)
+	0x10, 0x33, 0x30, 0x10, 0xe2, 0x35, 0x84, 0xf5, 0x08,	// orp U+2AB9 (⪹)
+	0x81, 0x81, 0x19, 0x01, 0xe2, 0x35, 0x84, 0xf5, 0x08,	// orp U+2ABA (⪺)
+	0x00, 0x00, 0x50, 0x94, 0x52, 0x28, 0x14, 0x05, 0x00,	// orp U+2ABB (⪻)
+	0x00, 0x00, 0x14, 0x85, 0x42, 0x29, 0x45, 0x01, 0x00,	// orp U+2ABC (⪼)
+	0x00, 0x00, 0x00, 0x5e, 0x50, 0x04, 0x1e, 0x00, 0x00,	// orp U+2ABD (⪽)
+	0x00, 0x00, 0x00, 0x0f, 0x44, 0x41, 0x0f, 0x00, 0x00,	// orp U+2ABE (⪾)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x10, 0x0e, 0x01, 0x00,	// orp U+2ABF (⪿)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x10, 0x0e, 0x01, 0x00,	// orp U+2AC0 (⫀)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x28, 0x84, 0x02, 0x00,	// orp U+2AC1 (⫁)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x28, 0x84, 0x02, 0x00,	// orp U+2AC2 (⫂)
+	0x00, 0x40, 0x00, 0x5e, 0x10, 0x78, 0xc0, 0x07, 0x00,	// orp U+2AC3 (⫃)
+	0x00, 0x40, 0x00, 0x0f, 0x04, 0x3d, 0xc0, 0x07, 0x00,	// orp U+2AC4 (⫄)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2AC5 (⫅)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2AC6 (⫆)
+	0x00, 0x00, 0x78, 0x41, 0xe0, 0x01, 0x56, 0x03, 0x00,	// orp U+2AC7 (⫇)
+	0x00, 0x00, 0x3c, 0x10, 0xf4, 0x00, 0x56, 0x03, 0x00,	// orp U+2AC8 (⫈)
+	0x80, 0x17, 0x04, 0x1e, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2AC9 (⫉)
+	0xc0, 0x03, 0x41, 0x0f, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2ACA (⫊)
+	0x80, 0x17, 0x04, 0x1e, 0x80, 0x7c, 0xc4, 0x27, 0x00,	// orp U+2ACB (⫋)
+	0xc0, 0x03, 0x41, 0x0f, 0x80, 0x7c, 0xc4, 0x27, 0x00,	// orp U+2ACC (⫌)
+	0x00, 0x00, 0x00, 0xc0, 0x1f, 0x04, 0x0f, 0x00, 0x00,	// orp U+2ACD (⫍)
+	0x00, 0x00, 0x00, 0xc0, 0x0f, 0x82, 0x3c, 0x00, 0x00,	// orp U+2ACE (⫎)
+	0x00, 0x00, 0x70, 0x52, 0x14, 0x45, 0x12, 0x07, 0x00,	// orp U+2ACF (⫏)
+	0x00, 0x00, 0x1c, 0x49, 0x14, 0x45, 0xc9, 0x01, 0x00,	// orp U+2AD0 (⫐)
+	0x00, 0xc0, 0x49, 0x51, 0x14, 0x49, 0x1c, 0xf0, 0x01,	// orp U+2AD1 (⫑)
+	0x00, 0x70, 0x24, 0x51, 0x14, 0x25, 0x07, 0xf0, 0x01,	// orp U+2AD2 (⫒)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x3c, 0x10, 0xf4, 0x00,	// orp U+2AD3 (⫓)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x78, 0x41, 0xe0, 0x01,	// orp U+2AD4 (⫔)
+	0x00, 0xe0, 0x05, 0x81, 0x07, 0x78, 0x41, 0xe0, 0x01,	// orp U+2AD5 (⫕)
+	0x00, 0xf0, 0x40, 0xd0, 0x03, 0x3c, 0x10, 0xf4, 0x00,	// orp U+2AD6 (⫖)
+	0x00, 0x00, 0x00, 0xc0, 0xcc, 0x30, 0x33, 0x00, 0x00,	// orp U+2AD7 (⫗)
+	0x00, 0x00, 0x00, 0x33, 0xe3, 0x31, 0x33, 0x00, 0x00,	// orp U+2AD8 (⫘)
+	0x00, 0x00, 0x38, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+2AD9 (⫙)
+	0x00, 0xe0, 0x10, 0x4e, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+2ADA (⫚)
+	0x00, 0x00, 0x10, 0x4e, 0x55, 0x55, 0x15, 0x01, 0x00,	// orp U+2ADB (⫛)
+	0x00, 0x00, 0x00, 0x04, 0xc5, 0x54, 0xd7, 0x03, 0x00,	// orp U+2ADC (⫝̸)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x54, 0x95, 0x03, 0x00,	// orp U+2ADD (⫝)
+	0x00, 0x00, 0x20, 0x08, 0xf2, 0x20, 0x08, 0x02, 0x00,	// orp U+2ADE (⫞)
+	0x00, 0x00, 0x00, 0xc0, 0x47, 0x10, 0x04, 0x00, 0x00,	// orp U+2ADF (⫟)
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x1f, 0x00, 0x00,	// orp U+2AE0 (⫠)
+	0x00, 0x00, 0x10, 0x24, 0x45, 0x52, 0xc4, 0x0f, 0x00,	// orp U+2AE1 (⫡)
+	0x00, 0x00, 0x04, 0x5f, 0xf0, 0x05, 0x5f, 0x00, 0x00,	// orp U+2AE2 (⫢)
+	0x00, 0x00, 0x50, 0x14, 0x75, 0x51, 0x14, 0x05, 0x00,	// orp U+2AE3 (⫣)
+	0x00, 0x00, 0x40, 0xd0, 0x07, 0x7d, 0x10, 0x04, 0x00,	// orp U+2AE4 (⫤)
+	0x00, 0x00, 0x50, 0xd4, 0x45, 0x5d, 0x14, 0x05, 0x00,	// orp U+2AE5 (⫥)
+	0x00, 0x00, 0x14, 0x45, 0xf1, 0x15, 0x45, 0x01, 0x00,	// orp U+2AE6 (⫦)
+	0x00, 0x00, 0x00, 0x1f, 0xf0, 0x11, 0x04, 0x01, 0x00,	// orp U+2AE7 (⫧)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x7c, 0xc0, 0x07, 0x00,	// orp U+2AE8 (⫨)
+	0x00, 0x00, 0x10, 0xc4, 0x07, 0x7c, 0x04, 0x01, 0x00,	// orp U+2AE9 (⫩)
+	0x00, 0x00, 0x7c, 0x8a, 0xa2, 0x28, 0x8a, 0x02, 0x00,	// orp U+2AEA (⫪)
+	0x00, 0x00, 0x28, 0x8a, 0xa2, 0x28, 0xca, 0x07, 0x00,	// orp U+2AEB (⫫)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x7d, 0x10, 0x00, 0x00,	// orp U+2AEC (⫬)
+	0x00, 0x00, 0x00, 0x80, 0x2f, 0xf8, 0x02, 0x00, 0x00,	// orp U+2AED (⫭)
+	0x00, 0x00, 0x10, 0x84, 0x41, 0x30, 0x04, 0x01, 0x00,	// orp U+2AEE (⫮)
+	0x00, 0x00, 0x10, 0x0a, 0x41, 0x10, 0x04, 0x01, 0x00,	// orp U+2AEF (⫯)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x0a, 0x01, 0x00,	// orp U+2AF0 (⫰)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0x0a, 0x01, 0x00,	// orp U+2AF1 (⫱)
+	0x00, 0x00, 0x28, 0x8a, 0xf2, 0x29, 0x8a, 0x02, 0x00,	// orp U+2AF2 (⫲)
+	0x00, 0x00, 0x28, 0x8a, 0xf7, 0x28, 0x8a, 0x02, 0x00,	// orp U+2AF3 (⫳)
+	0x00, 0x00, 0x54, 0x55, 0xf5, 0x57, 0x55, 0x05, 0x00,	// orp U+2AF5 (⫵)
+	0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x04, 0x00, 0x00,	// orp U+2AF6 (⫶)
+	0x00, 0x00, 0x00, 0x80, 0x5a, 0xa9, 0x00, 0x00, 0x00,	// orp U+2AF7 (⫷)
+	0x00, 0x00, 0x00, 0x40, 0xa5, 0x56, 0x00, 0x00, 0x00,	// orp U+2AF8 (⫸)
+	0x00, 0x00, 0x33, 0x03, 0x33, 0x33, 0x33, 0x03, 0x03,	// orp U+2AF9 (⫹)
+	0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x00,	// orp U+2AFA (⫺)
+	0x00, 0xa0, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x05, 0x00,	// orp U+2AFB (⫻)
+	0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,	// orp U+2AFC (⫼)
+	0x00, 0x20, 0x49, 0x92, 0x94, 0x24, 0x49, 0x02, 0x00,	// orp U+2AFD (⫽)
+	0x00, 0x00, 0x00, 0x8e, 0xa2, 0x28, 0x8a, 0x03, 0x00,	// orp U+2AFE (⫾)
+	0x80, 0xa3, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0x03, 0x00,	// orp U+2AFF (⫿)
+	0x00, 0x00, 0x00, 0x38, 0x4a, 0x2b, 0x85, 0x00, 0x00,	// orp U+2B00 (⬀)
+	0x00, 0x00, 0x00, 0x47, 0xb1, 0x50, 0x28, 0x04, 0x00,	// orp U+2B01 (⬁)
+	0x00, 0x00, 0x00, 0x42, 0xa1, 0xd0, 0x28, 0x0e, 0x00,	// orp U+2B02 (⬂)
+	0x00, 0x00, 0x00, 0x10, 0x4a, 0x2d, 0xc5, 0x01, 0x00,	// orp U+2B03 (⬃)
+	0x00, 0x00, 0x00, 0x80, 0xd4, 0x86, 0xad, 0x04, 0x00,	// orp U+2B04 (⬄)
+	0x00, 0x00, 0x00, 0x84, 0xf1, 0x7d, 0x06, 0x01, 0x00,	// orp U+2B05 (⬅)
+	0x00, 0x00, 0x30, 0xde, 0xcf, 0x30, 0x0c, 0x03, 0x00,	// orp U+2B06 (⬆)
+	0x00, 0x00, 0x30, 0x0c, 0xc3, 0xfc, 0x1e, 0x03, 0x00,	// orp U+2B07 (⬇)
+	0x00, 0x00, 0x00, 0x38, 0xce, 0x3b, 0x87, 0x00, 0x00,	// orp U+2B08 (⬈)
+	0x00, 0x00, 0x00, 0xc7, 0xf1, 0x70, 0x38, 0x04, 0x00,	// orp U+2B09 (⬉)
+	0x00, 0x00, 0x00, 0xc2, 0xe1, 0xf0, 0x38, 0x0e, 0x00,	// orp U+2B0A (⬊)
+	0x00, 0x00, 0x00, 0x10, 0xce, 0x3d, 0xc7, 0x01, 0x00,	// orp U+2B0B (⬋)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xfd, 0x12, 0x00, 0x00,	// orp U+2B0C (⬌)
+	0x00, 0xc0, 0x78, 0x3f, 0xc3, 0x30, 0xbf, 0xc7, 0x00,	// orp U+2B0D (⬍)
+	0x00, 0x00, 0x00, 0x07, 0x41, 0x54, 0x0e, 0x01, 0x00,	// orp U+2B0E (⬎)
+	0x00, 0x00, 0x00, 0x84, 0x53, 0x11, 0xc4, 0x01, 0x00,	// orp U+2B0F (⬏)
+	0x00, 0x00, 0x00, 0x1c, 0x41, 0x54, 0x0e, 0x01, 0x00,	// orp U+2B10 (⬐)
+	0x00, 0x00, 0x00, 0x84, 0x53, 0x11, 0x04, 0x07, 0x00,	// orp U+2B11 (⬑)
+	0x00, 0x00, 0x00, 0xdf, 0xf7, 0x45, 0xd1, 0x07, 0x00,	// orp U+2B12 (⬒)
+	0x00, 0x00, 0x00, 0x5f, 0x14, 0x7d, 0xdf, 0x07, 0x00,	// orp U+2B13 (⬓)
+	0x00, 0x00, 0x00, 0xc0, 0xd7, 0x65, 0xd1, 0x07, 0x00,	// orp U+2B14 (⬔)
+	0x00, 0x00, 0x00, 0xc0, 0x17, 0x4d, 0xd7, 0x07, 0x00,	// orp U+2B15 (⬕)
+	0x00, 0x00, 0x00, 0x00, 0x63, 0xdd, 0x16, 0x03, 0x00,	// orp U+2B16 (⬖)
+	0x00, 0x00, 0x00, 0x00, 0xa3, 0xe5, 0x1a, 0x03, 0x00,	// orp U+2B17 (⬗)
+	0x00, 0x00, 0x00, 0x84, 0xf3, 0x45, 0x0a, 0x01, 0x00,	// orp U+2B18 (⬘)
+	0x00, 0x00, 0x00, 0x84, 0x12, 0x7d, 0x0e, 0x01, 0x00,	// orp U+2B19 (⬙)
+	0x00, 0x00, 0x00, 0x40, 0x05, 0x44, 0x40, 0x05, 0x00,	// orp U+2B1A (⬚)
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,	// orp U+2B1D (⬝)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x28, 0x0e, 0x00, 0x00,	// orp U+2B1E (⬞)
+	0x00, 0x00, 0x00, 0x84, 0xf3, 0x7d, 0x8e, 0x03, 0x00,	// orp U+2B1F (⬟)
+	0x00, 0x00, 0x00, 0x84, 0x12, 0x45, 0x8a, 0x03, 0x00,	// orp U+2B20 (⬠)
+	0x00, 0x00, 0x10, 0x4a, 0x14, 0x45, 0x0a, 0x01, 0x00,	// orp U+2B21 (⬡)
+	0x00, 0x00, 0x10, 0xce, 0xf7, 0x7d, 0x0e, 0x01, 0x00,	// orp U+2B22 (⬢)
+	0x00, 0x00, 0x00, 0x00, 0xe0, 0x7c, 0x0e, 0x00, 0x00,	// orp U+2B23 (⬣)
+	0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xbf, 0x07, 0x00,	// orp U+2B24 (⬤)
+	0x00, 0x00, 0x00, 0x04, 0xe1, 0x38, 0x04, 0x01, 0x00,	// orp U+2B27 (⬧)
+	0x00, 0x00, 0x10, 0x8a, 0x12, 0x45, 0x8a, 0x42, 0x00,	// orp U+2B28 (⬨)
+	0x00, 0x00, 0x00, 0x04, 0xe1, 0x10, 0x04, 0x00, 0x00,	// orp U+2B2A (⬪)
+	0x00, 0x00, 0x00, 0x80, 0xf3, 0x7d, 0x0e, 0x00, 0x00,	// orp U+2B2C (⬬)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x45, 0x0e, 0x00, 0x00,	// orp U+2B2D (⬭)
+	0x00, 0x00, 0x38, 0xdf, 0xf7, 0x7d, 0x9f, 0x03, 0x00,	// orp U+2B2E (⬮)
+	0x00, 0x00, 0x00, 0x00, 0xa0, 0xfd, 0x1a, 0x00, 0x00,	// orp U+2B30 (⬰)
+	0xc2, 0x27, 0x00, 0xc2, 0x27, 0x00, 0xc2, 0x27, 0x00,	// orp U+2B31 (⬱)
+	0x00, 0x00, 0x00, 0x00, 0xa0, 0x5e, 0x02, 0x00, 0x00,	// orp U+2B33 (⬳)
+	0x00, 0x00, 0x00, 0x00, 0x64, 0xfd, 0x16, 0x04, 0x00,	// orp U+2B34 (⬴)
+	0x00, 0x00, 0x00, 0x00, 0xe6, 0xfd, 0x1e, 0x06, 0x00,	// orp U+2B35 (⬵)
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x7d, 0x16, 0x04, 0x00,	// orp U+2B36 (⬶)
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x6e, 0x26, 0x00, 0x00,	// orp U+2B37 (⬷)
+	0x00, 0x00, 0x00, 0x00, 0x21, 0x54, 0x02, 0x01, 0x00,	// orp U+2B38 (⬸)
+	0x00, 0x00, 0x00, 0x00, 0xa2, 0x7e, 0x2a, 0x02, 0x00,	// orp U+2B39 (⬹)
+	0x00, 0x00, 0x00, 0x00, 0xe3, 0x7e, 0x2e, 0x03, 0x00,	// orp U+2B3A (⬺)
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x7e, 0x26, 0x00, 0x00,	// orp U+2B3B (⬻)
+	0x00, 0x00, 0x00, 0x00, 0xe2, 0x7e, 0x2e, 0x02, 0x00,	// orp U+2B3C (⬼)
+	0x00, 0x00, 0x00, 0x00, 0xe6, 0x7f, 0x3e, 0x06, 0x00,	// orp U+2B3D (⬽)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xbd, 0x02, 0x00, 0x00,	// orp U+2B3F (⬿)
+	0x00, 0xc0, 0x01, 0x1c, 0x20, 0x7c, 0x02, 0x00, 0x00,	// orp U+2B40 (⭀)
+	0x00, 0x00, 0x58, 0x0d, 0x20, 0x7c, 0x02, 0x00, 0x00,	// orp U+2B41 (⭁)
+	0x00, 0x20, 0x7c, 0x02, 0x60, 0x35, 0x80, 0xd5, 0x00,	// orp U+2B42 (⭂)
+	0x00, 0x00, 0x00, 0x81, 0x40, 0xfd, 0x94, 0x10, 0x00,	// orp U+2B43 (⭃)
+	0x00, 0x00, 0x00, 0xc0, 0x40, 0xfd, 0xd4, 0x00, 0x00,	// orp U+2B44 (⭄)
+	0xc3, 0xb4, 0x4e, 0xd3, 0xb4, 0x14, 0xc2, 0x30, 0x0c,	// orp U+2B60 (⭠)
+	0x40, 0x10, 0x04, 0xc1, 0x0b, 0x92, 0x2c, 0x4d, 0x92,	// orp U+2B61 (⭡)
+	0x00, 0x00, 0x00, 0x7f, 0x14, 0x5d, 0x51, 0x04, 0x00,	// orp U+2B62 (⭢)
+	0xc0, 0xff, 0x03, 0x2e, 0xea, 0xba, 0xee, 0xff, 0xff,	// orp U+2B63 (⭣)
+	0x00, 0xe0, 0x85, 0xe1, 0x7f, 0xcf, 0xfb, 0x0f, 0x00,	// orp U+2B64 (⭤)
+	0x40, 0x30, 0x1c, 0xcf, 0xf7, 0x7f, 0xcf, 0x31, 0x04,	// orp U+2B80 (⮀)
+	0x00, 0x00, 0x10, 0xcc, 0xf7, 0x7f, 0x0c, 0x01, 0x00,	// orp U+2B81 (⮁)
+	0x00, 0x08, 0xe3, 0xbc, 0xff, 0xfb, 0x3c, 0x0e, 0x83,	// orp U+2B82 (⮂)
+	0x00, 0x08, 0x21, 0x84, 0x10, 0x08, 0x04, 0x02, 0x81,	// orp U+2B83 (⮃)
+	0x00, 0x00, 0x08, 0xc2, 0x21, 0x1c, 0x82, 0x07, 0x00,	// orp U+2C60 (Ⱡ)
+	0x00, 0x00, 0x10, 0x06, 0xe1, 0x10, 0x0e, 0x01, 0x00,	// orp U+2C61 (ⱡ)
+	0x00, 0x00, 0x10, 0x84, 0xd5, 0x10, 0x04, 0x07, 0x00,	// orp U+2C62 (Ɫ)
+	0x00, 0x00, 0x38, 0xd2, 0x25, 0x39, 0x82, 0x00, 0x00,	// orp U+2C63 (Ᵽ)
+	0x00, 0x00, 0x3c, 0x51, 0xf4, 0x14, 0x49, 0x54, 0x08,	// orp U+2C64 (Ɽ)
+	0x00, 0x00, 0x40, 0x90, 0x83, 0x79, 0x95, 0x27, 0x00,	// orp U+2C65 (ⱥ)
+	0x00, 0x00, 0x50, 0xd4, 0xc7, 0x10, 0x84, 0x26, 0x00,	// orp U+2C66 (ⱦ)
+	0x00, 0x00, 0x44, 0x51, 0xf4, 0x45, 0x51, 0x0c, 0x02,	// orp U+2C67 (Ⱨ)
+	0x00, 0x00, 0x04, 0xc1, 0x13, 0x45, 0x51, 0x0c, 0x02,	// orp U+2C68 (ⱨ)
+	0x00, 0x00, 0x44, 0x49, 0x31, 0x14, 0x49, 0x0c, 0x02,	// orp U+2C69 (Ⱪ)
+	0x00, 0x00, 0x04, 0x41, 0x94, 0x1c, 0x49, 0x0c, 0x02,	// orp U+2C6A (ⱪ)
+	0x00, 0x00, 0x7c, 0x10, 0x42, 0x08, 0xc1, 0x0f, 0x02,	// orp U+2C6B (Ⱬ)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xc2, 0x0f, 0x02,	// orp U+2C6C (ⱬ)
+	0x00, 0x00, 0x58, 0x59, 0x14, 0x45, 0x91, 0x0b, 0x00,	// orp U+2C6D (Ɑ)
+	0x00, 0x00, 0x44, 0x5b, 0x15, 0x45, 0x51, 0x44, 0x21,	// orp U+2C6E (Ɱ)
+	0x00, 0x00, 0x00, 0x40, 0x18, 0x45, 0x0a, 0x01, 0x00,	// orp U+2C71 (ⱱ)
+	0x00, 0x00, 0x84, 0x51, 0x14, 0x55, 0x95, 0x02, 0x00,	// orp U+2C72 (Ⱳ)
+	0x00, 0x00, 0x00, 0x40, 0x18, 0x55, 0x95, 0x02, 0x00,	// orp U+2C73 (ⱳ)
+	0x00, 0x00, 0x00, 0x80, 0x54, 0x4d, 0x0a, 0x01, 0x00,	// orp U+2C74 (ⱴ)
+	0x00, 0x00, 0x00, 0x80, 0x20, 0x38, 0x82, 0x00, 0x00,	// orp U+2C76 (ⱶ)
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x55, 0x95, 0x03, 0x00,	// orp U+2C77 (ⱷ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x3d, 0x81, 0x8b, 0x01,	// orp U+2C78 (ⱸ)
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x08, 0x03, 0x00,	// orp U+2C79 (ⱹ)
+	0x00, 0x00, 0x00, 0x80, 0x13, 0x55, 0x9b, 0x03, 0x00,	// orp U+2C7A (ⱺ)
+	0x00, 0x00, 0x00, 0x80, 0x07, 0x71, 0x90, 0x07, 0x00,	// orp U+2C7B (ⱻ)
+	0x00, 0x00, 0x00, 0x04, 0x60, 0x10, 0x04, 0x51, 0x08,	// orp U+2C7C (ⱼ)
+	0x40, 0x14, 0x45, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2C7D (ⱽ)
+	0xc6, 0x50, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE0 (ⷠ)
+	0x43, 0x31, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE1 (ⷡ)
+	0x47, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE2 (ⷢ)
+	0x8e, 0xa2, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE3 (ⷣ)
+	0x95, 0x53, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE4 (ⷤ)
+	0x03, 0x21, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE5 (ⷥ)
+	0xc5, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE6 (ⷦ)
+	0x8e, 0xa2, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE7 (ⷧ)
+	0xc5, 0x51, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE8 (ⷨ)
+	0xc9, 0x93, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DE9 (ⷩ)
+	0x46, 0x92, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DEA (ⷪ)
+	0x45, 0x51, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DEB (ⷫ)
+	0x43, 0x31, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DEC (ⷬ)
+	0x46, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DED (ⷭ)
+	0x87, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DEE (ⷮ)
+	0x85, 0x50, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DEF (ⷯ)
+	0x45, 0x51, 0x34, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF0 (ⷰ)
+	0x85, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF1 (ⷱ)
+	0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF2 (ⷲ)
+	0x55, 0x55, 0xd5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF3 (ⷳ)
+	0xc6, 0xd2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF4 (ⷴ)
+	0x7e, 0x14, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF5 (ⷵ)
+	0x83, 0x51, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF6 (ⷶ)
+	0x46, 0x31, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF7 (ⷷ)
+	0xc2, 0x21, 0x14, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF8 (ⷸ)
+	0x44, 0x51, 0x08, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DF9 (ⷹ)
+	0xc2, 0x21, 0x18, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFA (ⷺ)
+	0x59, 0x79, 0x96, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFB (ⷻ)
+	0x4d, 0xf4, 0x55, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFC (ⷼ)
+	0x84, 0xf2, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFD (ⷽ)
+	0x9f, 0xe2, 0x54, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFE (ⷾ)
+	0x7f, 0xd5, 0xad, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+2DFF (ⷿ)
+	0xc1, 0x70, 0x3c, 0xdf, 0xff, 0x3d, 0xc7, 0x10, 0x00,	// orp U+E0B2 ()
+	0x00, 0x00, 0x70, 0x8a, 0xf2, 0x29, 0x8a, 0x02, 0x00,	// orp U+FB00 (ﬀ)
+	0x00, 0x00, 0x30, 0x92, 0xf0, 0x49, 0x92, 0x04, 0x00,	// orp U+FB01 (ﬁ)
+	0x00, 0x00, 0x70, 0x92, 0xf4, 0x49, 0x92, 0x04, 0x00,	// orp U+FB02 (ﬂ)
+	0x00, 0x00, 0x38, 0x55, 0xf1, 0x55, 0x55, 0x05, 0x00,	// orp U+FB03 (ﬃ)
+	0x00, 0x00, 0x78, 0x55, 0xf5, 0x55, 0x55, 0x05, 0x00,	// orp U+FB04 (ﬄ)
+	0x00, 0x00, 0x10, 0x8a, 0xb7, 0x28, 0x8a, 0x04, 0x00,	// orp U+FB05 (ﬅ)
+	0x00, 0x00, 0x30, 0x8a, 0x97, 0x28, 0x4a, 0x04, 0x00,	// orp U+FB06 (ﬆ)
+	0xb8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+FE20 (︠)
+	0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+FE21 (︡)
+	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+FE22 (︢)
+	0xd0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// orp U+FE23 (︣)
+	0x00, 0xe0, 0x6c, 0xd5, 0xb5, 0x6d, 0xdf, 0xe6, 0x00,	// orp U+FFFD (�)
+	0x00, 0x00, 0x30, 0x0c, 0xc3, 0x00, 0x0c, 0x03, 0x00,	// orpb U+0021 (!)
+	0x00, 0xb0, 0x6d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,	// orpb U+0022 (")
+	0x00, 0x00, 0x10, 0xde, 0xe1, 0x70, 0x0f, 0x01, 0x00,	// orpb U+0024 ($)
+	0x00, 0x00, 0x00, 0xd3, 0xc6, 0x18, 0x5b, 0x06, 0x00,	// orpb U+0025 (%)
+	0x00, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,	// orpb U+0027 (')
+	0x00, 0x80, 0x31, 0x86, 0x61, 0x18, 0x06, 0x83, 0x01,	// orpb U+0028 (()
+	0x00, 0x60, 0x30, 0x18, 0x86, 0x61, 0x18, 0x63, 0x00,	// orpb U+0029 ())
+	0x00, 0x00, 0xc0, 0x30, 0xc6, 0x18, 0xc3, 0x00, 0x00,	// orpb U+002F (/)
+	0x00, 0x00, 0x38, 0x5f, 0x54, 0x45, 0x9f, 0x03, 0x00,	// orpb U+0030 (0)
+	0x00, 0x00, 0x20, 0x8c, 0xc3, 0x30, 0x8c, 0x07, 0x00,	// orpb U+0031 (1)
+	0x00, 0x00, 0x38, 0x1b, 0x86, 0x31, 0xc6, 0x07, 0x00,	// orpb U+0032 (2)
+	0x00, 0x00, 0x7c, 0x18, 0xe3, 0x61, 0x9b, 0x03, 0x00,	// orpb U+0033 (3)
+	0x00, 0x00, 0x20, 0x8c, 0xb3, 0x7c, 0x8c, 0x07, 0x00,	// orpb U+0034 (4)
+	0x00, 0x00, 0x7c, 0xc3, 0x83, 0x61, 0x9b, 0x03, 0x00,	// orpb U+0035 (5)
+	0x00, 0x00, 0x78, 0xc3, 0xb3, 0x6d, 0x9b, 0x03, 0x00,	// orpb U+0036 (6)
+	0x00, 0x00, 0x7c, 0x18, 0xc3, 0x18, 0x86, 0x01, 0x00,	// orpb U+0037 (7)
+	0x00, 0x00, 0x38, 0xdb, 0xe6, 0x6c, 0x9b, 0x03, 0x00,	// orpb U+0038 (8)
+	0x00, 0x00, 0x38, 0xdb, 0xb6, 0x79, 0x98, 0x03, 0x00,	// orpb U+0039 (9)
+	0x00, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x0c, 0x03, 0x00,	// orpb U+003A (:)
+	0x00, 0x00, 0x00, 0x8c, 0x31, 0x18, 0x0c, 0x00, 0x00,	// orpb U+003C (<)
+	0x00, 0x00, 0x00, 0x06, 0x83, 0x31, 0x06, 0x00, 0x00,	// orpb U+003E (>)
+	0x00, 0x00, 0x38, 0x1b, 0xc6, 0x30, 0x00, 0x03, 0x00,	// orpb U+003F (?)
+	0x00, 0x00, 0x10, 0xce, 0xb6, 0x7d, 0xdb, 0x06, 0x00,	// orpb U+0041 (A)
+	0x00, 0x00, 0x3c, 0xdb, 0xf6, 0x6c, 0xdb, 0x03, 0x00,	// orpb U+0042 (B)
+	0x00, 0x00, 0x38, 0xdb, 0x30, 0x0c, 0x9b, 0x03, 0x00,	// orpb U+0043 (C)
+	0x00, 0x00, 0x3c, 0xdb, 0xb6, 0x6d, 0xdb, 0x03, 0x00,	// orpb U+0044 (D)
+	0x00, 0x00, 0x7c, 0xc3, 0xf0, 0x0c, 0xc3, 0x07, 0x00,	// orpb U+0045 (E)
+	0x00, 0x00, 0xfc, 0xc3, 0xf0, 0x0c, 0xc3, 0x00, 0x00,	// orpb U+0046 (F)
+	0x00, 0x00, 0x38, 0xdb, 0xb0, 0x6d, 0x9b, 0x07, 0x00,	// orpb U+0047 (G)
+	0x00, 0x00, 0x6c, 0xdb, 0xf6, 0x6d, 0xdb, 0x06, 0x00,	// orpb U+0048 (H)
+	0x00, 0x00, 0x78, 0x0c, 0xc3, 0x30, 0x8c, 0x07, 0x00,	// orpb U+0049 (I)
+	0x00, 0x00, 0x70, 0x18, 0x86, 0x61, 0xd8, 0x03, 0x00,	// orpb U+004A (J)
+	0x00, 0x00, 0x6c, 0xcf, 0x71, 0x3c, 0xdb, 0x06, 0x00,	// orpb U+004B (K)
+	0x00, 0x00, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x07, 0x00,	// orpb U+004C (L)
+	0x00, 0x00, 0x6c, 0xdf, 0x57, 0x6d, 0xdb, 0x06, 0x00,	// orpb U+004D (M)
+	0x00, 0x00, 0x44, 0xd3, 0xb5, 0x4d, 0xd3, 0x04, 0x00,	// orpb U+004E (N)
+	0x00, 0x00, 0x38, 0xdb, 0xb6, 0x6d, 0x9b, 0x03, 0x00,	// orpb U+004F (O)
+	0x00, 0x00, 0x3c, 0xdb, 0xf6, 0x0c, 0xc3, 0x00, 0x00,	// orpb U+0050 (P)
+	0x00, 0x00, 0x38, 0xdb, 0xb6, 0x6d, 0x9f, 0x03, 0x01,	// orpb U+0051 (Q)
+	0x00, 0x00, 0x3c, 0xdb, 0xf6, 0x2d, 0xdb, 0x06, 0x00,	// orpb U+0052 (R)
+	0x00, 0x00, 0x38, 0xdb, 0xe0, 0x60, 0x9b, 0x03, 0x00,	// orpb U+0053 (S)
+	0x00, 0x00, 0xfc, 0x0c, 0xc3, 0x30, 0x0c, 0x03, 0x00,	// orpb U+0054 (T)
+	0x00, 0x00, 0x6c, 0xdb, 0xb6, 0x6d, 0x9b, 0x03, 0x00,	// orpb U+0055 (U)
+	0x00, 0x00, 0x6c, 0xdb, 0xb6, 0x6d, 0x0e, 0x01, 0x00,	// orpb U+0056 (V)
+	0x00, 0x00, 0x6c, 0xdb, 0xb6, 0x55, 0xdf, 0x06, 0x00,	// orpb U+0057 (W)
+	0x00, 0x00, 0x6c, 0x9b, 0x43, 0x38, 0xdb, 0x06, 0x00,	// orpb U+0058 (X)
+	0x00, 0x00, 0x48, 0x92, 0xc7, 0x30, 0x0c, 0x03, 0x00,	// orpb U+0059 (Y)
+	0x00, 0x00, 0x7c, 0x18, 0xe7, 0x1c, 0xc3, 0x07, 0x00,	// orpb U+005A (Z)
+	0x00, 0xe0, 0x19, 0x86, 0x61, 0x18, 0x86, 0xe1, 0x01,	// orpb U+005B ([)
+	0x00, 0x00, 0x0c, 0x83, 0xc1, 0x60, 0x30, 0x0c, 0x00,	// orpb U+005C (\)
+	0x00, 0xe0, 0x61, 0x18, 0x86, 0x61, 0x18, 0xe6, 0x01,	// orpb U+005D (])
+	0x00, 0x40, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,	// orpb U+005E (^)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x7d,	// orpb U+005F (_)
+	0x00, 0x20, 0x18, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00,	// orpb U+0060 (`)
+	0x00, 0x00, 0x00, 0x80, 0xb7, 0x6d, 0x9f, 0x05, 0x00,	// orpb U+0061 (a)
+	0x00, 0x00, 0x0c, 0xc3, 0xb3, 0x6d, 0x5b, 0x03, 0x00,	// orpb U+0062 (b)
+	0x00, 0x00, 0x00, 0x80, 0x33, 0x0d, 0x83, 0x07, 0x00,	// orpb U+0063 (c)
+	0x00, 0x00, 0x60, 0x98, 0xb7, 0x6d, 0x9b, 0x05, 0x00,	// orpb U+0064 (d)
+	0x00, 0x00, 0x00, 0x80, 0xb3, 0x7d, 0x83, 0x07, 0x00,	// orpb U+0065 (e)
+	0x00, 0xc0, 0x1b, 0xc6, 0x67, 0x18, 0x86, 0x01, 0x00,	// orpb U+0066 (f)
+	0x00, 0x00, 0x00, 0x80, 0xb5, 0x6d, 0x9b, 0x97, 0x39,	// orpb U+0067 (g)
+	0x00, 0x00, 0x0c, 0xc3, 0xb3, 0x6d, 0xdb, 0x06, 0x00,	// orpb U+0068 (h)
+	0x00, 0x00, 0x18, 0xc0, 0x61, 0x18, 0x06, 0x07, 0x00,	// orpb U+0069 (i)
+	0x00, 0x00, 0x30, 0x80, 0xc3, 0x30, 0x0c, 0xc3, 0x1c,	// orpb U+006A (j)
+	0x00, 0x00, 0x0c, 0xc3, 0xb6, 0x3d, 0xdf, 0x06, 0x00,	// orpb U+006B (k)
+	0x00, 0x00, 0x1c, 0x86, 0x61, 0x18, 0x06, 0x07, 0x00,	// orpb U+006C (l)
+	0x00, 0x00, 0x00, 0xc0, 0xf3, 0x55, 0x55, 0x05, 0x00,	// orpb U+006D (m)
+	0x00, 0x00, 0x00, 0x40, 0xb3, 0x6d, 0xdb, 0x06, 0x00,	// orpb U+006E (n)
+	0x00, 0x00, 0x00, 0x80, 0xb3, 0x6d, 0x9b, 0x03, 0x00,	// orpb U+006F (o)
+	0x00, 0x00, 0x00, 0x40, 0xb3, 0x6d, 0xdb, 0x33, 0x0c,	// orpb U+0070 (p)
+	0x00, 0x00, 0x00, 0x80, 0xb5, 0x6d, 0x9b, 0x87, 0x61,	// orpb U+0071 (q)
+	0x00, 0x00, 0x00, 0x40, 0xb7, 0x0d, 0xc3, 0x00, 0x00,	// orpb U+0072 (r)
+	0x00, 0x00, 0x00, 0x80, 0x37, 0x7c, 0xd8, 0x03, 0x00,	// orpb U+0073 (s)
+	0x00, 0x00, 0x18, 0xc6, 0x67, 0x18, 0x06, 0x07, 0x00,	// orpb U+0074 (t)
+	0x00, 0x00, 0x00, 0xc0, 0xb6, 0x6d, 0x9b, 0x05, 0x00,	// orpb U+0075 (u)
+	0x00, 0x00, 0x00, 0xc0, 0xb6, 0x39, 0x0e, 0x01, 0x00,	// orpb U+0076 (v)
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x9f, 0x03, 0x00,	// orpb U+0077 (w)
+	0x00, 0x00, 0x00, 0xc0, 0xe6, 0x10, 0xce, 0x06, 0x00,	// orpb U+0078 (x)
+	0x00, 0x00, 0x00, 0xc0, 0xb6, 0x6d, 0x9b, 0x63, 0x0c,	// orpb U+0079 (y)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x39, 0xc3, 0x07, 0x00,	// orpb U+007A (z)
+	0x00, 0x80, 0x31, 0x0c, 0x73, 0x30, 0x0c, 0x83, 0x01,	// orpb U+007B ({)
+	0x00, 0xc0, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x00,	// orpb U+007C (|)
+	0x00, 0x60, 0x30, 0x0c, 0x83, 0x33, 0x0c, 0x63, 0x00,	// orpb U+007D (})
+	0x00, 0x00, 0x00, 0x80, 0xfd, 0x6f, 0x00, 0x00, 0x00,	// orpb U+007E (~)
+	0x00, 0x00, 0x00, 0x00, 0xa5, 0x14, 0x0a, 0x05, 0x00,	// orpb U+00AB («)
+	0x00, 0x00, 0x00, 0x40, 0xa1, 0x50, 0x4a, 0x01, 0x00,	// orpb U+00BB (»)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,	// orpb U+2024 (․)
+	0x00, 0x00, 0x08, 0x86, 0xe3, 0x39, 0x86, 0x00, 0x00,	// orpb U+25B6 (▶)
+	0x00, 0x00, 0x40, 0x18, 0xe7, 0x71, 0x18, 0x04, 0x00,	// orpb U+25C0 (◀)
+	0x00, 0xe0, 0x44, 0xdb, 0x16, 0x55, 0x5b, 0xe4, 0x00,	// orpb U+2639 (☹)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x10, 0x00, 0x01, 0x00,	// orpi U+0021 (!)
+	0x00, 0x00, 0x30, 0x52, 0x14, 0x75, 0x51, 0x04, 0x00,	// orpi U+0041 (A)
+	0x00, 0x00, 0x18, 0x49, 0xd2, 0x44, 0xd0, 0x03, 0x00,	// orpi U+0042 (B)
+	0x00, 0x00, 0x10, 0x4a, 0x10, 0x04, 0x91, 0x03, 0x00,	// orpi U+0043 (C)
+	0x00, 0x00, 0x18, 0x49, 0x14, 0x45, 0xd0, 0x03, 0x00,	// orpi U+0044 (D)
+	0x00, 0x00, 0x38, 0x41, 0x70, 0x04, 0x41, 0x07, 0x00,	// orpi U+0045 (E)
+	0x00, 0x00, 0x38, 0x41, 0x70, 0x04, 0x41, 0x00, 0x00,	// orpi U+0046 (F)
+	0x00, 0x00, 0x10, 0x4a, 0xd0, 0x44, 0x91, 0x03, 0x00,	// orpi U+0047 (G)
+	0x00, 0x00, 0x40, 0x51, 0xd4, 0x45, 0x51, 0x04, 0x00,	// orpi U+0048 (H)
+	0x00, 0x00, 0x38, 0x04, 0x41, 0x10, 0xc0, 0x07, 0x00,	// orpi U+0049 (I)
+	0x00, 0x00, 0x24, 0x49, 0x11, 0x14, 0x49, 0x04, 0x00,	// orpi U+004B (K)
+	0x00, 0x00, 0x04, 0x41, 0x10, 0x04, 0x41, 0x07, 0x00,	// orpi U+004C (L)
+	0x00, 0x00, 0x44, 0x4a, 0x55, 0x45, 0x51, 0x04, 0x00,	// orpi U+004D (M)
+	0x00, 0x00, 0x44, 0x52, 0x95, 0x45, 0x51, 0x04, 0x00,	// orpi U+004E (N)
+	0x00, 0x00, 0x30, 0x52, 0x14, 0x45, 0x91, 0x03, 0x00,	// orpi U+004F (O)
+	0x00, 0x00, 0x18, 0x49, 0x52, 0x04, 0x41, 0x00, 0x00,	// orpi U+0050 (P)
+	0x00, 0x00, 0x30, 0x52, 0x14, 0x45, 0x95, 0x02, 0x01,	// orpi U+0051 (Q)
+	0x00, 0x00, 0x18, 0x49, 0xd2, 0x44, 0x51, 0x04, 0x00,	// orpi U+0052 (R)
+	0x00, 0x00, 0x7c, 0x00, 0x41, 0x10, 0x04, 0x01, 0x00,	// orpi U+0054 (T)
+	0x00, 0x00, 0x40, 0x51, 0x14, 0x45, 0x91, 0x07, 0x00,	// orpi U+0055 (U)
+	0x00, 0x00, 0x40, 0x51, 0x14, 0x29, 0x0a, 0x01, 0x00,	// orpi U+0056 (V)
+	0x00, 0x00, 0x40, 0x51, 0x14, 0x55, 0xd5, 0x06, 0x00,	// orpi U+0057 (W)
+	0x00, 0x00, 0x40, 0x91, 0x42, 0x28, 0x51, 0x04, 0x00,	// orpi U+0058 (X)
+	0x00, 0x00, 0x44, 0x51, 0xe4, 0x00, 0x04, 0x01, 0x00,	// orpi U+0059 (Y)
+	0x00, 0x00, 0x78, 0x10, 0x42, 0x08, 0xd0, 0x03, 0x00,	// orpi U+005A (Z)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x99, 0x05, 0x00,	// orpi U+0061 (a)
+	0x00, 0x10, 0x04, 0xc1, 0x13, 0x45, 0xc8, 0x01, 0x00,	// orpi U+0062 (b)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x81, 0x07, 0x00,	// orpi U+0063 (c)
+	0x00, 0x00, 0x42, 0x10, 0x27, 0x45, 0x81, 0x07, 0x00,	// orpi U+0064 (d)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x3d, 0x22, 0x07, 0x00,	// orpi U+0065 (e)
+	0x00, 0x80, 0x11, 0x84, 0x43, 0x10, 0x04, 0x21, 0x00,	// orpi U+0066 (f)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x05, 0x91, 0x17, 0x39,	// orpi U+0067 (g)
+	0x00, 0x10, 0x08, 0x82, 0x23, 0x49, 0x92, 0x04, 0x00,	// orpi U+0068 (h)
+	0x00, 0x40, 0x00, 0x02, 0x41, 0x10, 0x04, 0x06, 0x00,	// orpi U+0069 (i)
+	0x00, 0x40, 0x00, 0x02, 0x41, 0x10, 0x04, 0x51, 0x0c,	// orpi U+006A (j)
+	0x00, 0x00, 0x08, 0x82, 0xa4, 0x18, 0x8a, 0x0c, 0x00,	// orpi U+006B (k)
+	0x00, 0x20, 0x10, 0x04, 0x41, 0x10, 0x04, 0x06, 0x00,	// orpi U+006C (l)
+	0x00, 0x00, 0x00, 0xc0, 0x53, 0x55, 0x55, 0x05, 0x02,	// orpi U+006D (m)
+	0x00, 0x00, 0x00, 0x40, 0xb1, 0x24, 0x49, 0x04, 0x00,	// orpi U+006E (n)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x45, 0x91, 0x03, 0x00,	// orpi U+006F (o)
+	0x00, 0x00, 0x00, 0x40, 0x33, 0x45, 0x51, 0x13, 0x04,	// orpi U+0070 (p)
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x45, 0x91, 0x05, 0x81,	// orpi U+0071 (q)
+	0x00, 0x00, 0x00, 0x50, 0x23, 0x08, 0x82, 0x00, 0x00,	// orpi U+0072 (r)
+	0x00, 0x00, 0x00, 0x90, 0x13, 0x38, 0xd0, 0x03, 0x00,	// orpi U+0073 (s)
+	0x00, 0x20, 0x10, 0x84, 0x43, 0x10, 0x04, 0x06, 0x00,	// orpi U+0074 (t)
+	0x00, 0x00, 0x00, 0x50, 0x92, 0x24, 0x89, 0x05, 0x00,	// orpi U+0075 (u)
+	0x00, 0x00, 0x00, 0x40, 0x18, 0x29, 0x0a, 0x01, 0x00,	// orpi U+0076 (v)
+	0x00, 0x00, 0x00, 0x60, 0x54, 0x55, 0x95, 0x02, 0x00,	// orpi U+0077 (w)
+	0x00, 0x00, 0x00, 0x40, 0xa4, 0x10, 0x4a, 0x0c, 0x00,	// orpi U+0078 (x)
+	0x00, 0x00, 0x00, 0x00, 0x94, 0x24, 0x89, 0x82, 0x1c,	// orpi U+0079 (y)
+	0x00, 0x00, 0x00, 0xc0, 0x87, 0x10, 0xd2, 0x03, 0x00,	// orpi U+007A (z)
+}; // 4322
 
-static const unsigned char orp_block2[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
-	{ 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x00 },	// U+0021 (!)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x00, 0x00, 0x00 },	// U+0023 (#)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1e, 0x05, 0x0e, 0x14, 0x0f, 0x04, 0x00, 0x00 },	// U+0024 ($)
-	{ 0x00, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x04, 0x1a, 0x19, 0x00, 0x00, 0x00 },	// U+0025 (%)
-	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00, 0x00 },	// U+0026 (&)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0027 (')
-	{ 0x00, 0x00, 0x08, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00 },	// U+0028 (()
-	{ 0x00, 0x00, 0x02, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00 },	// U+0029 ())
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+002A (*)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+002B (+)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x03, 0x00 },	// U+002C (,)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+002D (-)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00 },	// U+002E (.)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00 },	// U+002F (/)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x15, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0030 (0)
-	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+0031 (1)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+0032 (2)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x0c, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0033 (3)
-	{ 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0a, 0x09, 0x1f, 0x08, 0x1c, 0x00, 0x00 },	// U+0034 (4)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x0f, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0035 (5)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+0036 (6)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0037 (7)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0038 (8)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x1e, 0x10, 0x0e, 0x00, 0x00 },	// U+0039 (9)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x00 },	// U+003A (:)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x03, 0x00 },	// U+003B (;)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00 },	// U+003C (<)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+003D (=)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00 },	// U+003E (>)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x08, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+003F (?)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1d, 0x15, 0x1d, 0x01, 0x0e, 0x00, 0x00 },	// U+0040 (@)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0041 (A)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x0f, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0042 (B)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0043 (C)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0044 (D)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0045 (E)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0046 (F)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x19, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0047 (G)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0048 (H)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+0049 (I)
-	{ 0x00, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+004A (J)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+004B (K)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+004C (L)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+004D (M)
-	{ 0x00, 0x00, 0x00, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+004E (N)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+004F (O)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0050 (P)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x15, 0x0a, 0x10, 0x00 },	// U+0051 (Q)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x0f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0052 (R)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0053 (S)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0054 (T)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0055 (U)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0056 (V)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x1b, 0x00, 0x00 },	// U+0057 (W)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+0058 (X)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0059 (Y)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+005A (Z)
-	{ 0x00, 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00 },	// U+005B ([)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+005C (\)
-	{ 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00 },	// U+005D (])
-	{ 0x00, 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+005E (^)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00 },	// U+005F (_)
-	{ 0x00, 0x00, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0060 (`)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0061 (a)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0062 (b)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x1e, 0x00, 0x00 },	// U+0063 (c)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0064 (d)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x01, 0x1e, 0x00, 0x00 },	// U+0065 (e)
-	{ 0x00, 0x00, 0x38, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0066 (f)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x11, 0x0e },	// U+0067 (g)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0068 (h)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+0069 (i)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07 },	// U+006A (j)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x05, 0x0b, 0x11, 0x00, 0x00 },	// U+006B (k)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+006C (l)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+006D (m)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+006E (n)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+006F (o)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+0070 (p)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x19, 0x16, 0x10, 0x10 },	// U+0071 (q)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0072 (r)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+0073 (s)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+0074 (t)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0075 (u)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0076 (v)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0077 (w)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+0078 (x)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+0079 (y)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+007A (z)
-	{ 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x08, 0x00 },	// U+007B ({)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+007C (|)
-	{ 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+007D (})
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
+static const uint16_t orp_ids[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	1, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126,
+	127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+	143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+	175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+	191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+	207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+	223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+	239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+	255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+	271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+	319, 320, 321, 322, 323, 324, 325, 326, 327, 207, 328, 329, 330, 331, 332, 333,
+	334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+	350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 290, 361, 362, 363, 364,
+	365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+	397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+	413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+	429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+	445, 446, 447, 448, 449, 450, 449, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+	460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+	476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+	492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+	508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+	524, 525, 526, 527, 528, 529, 530, 531, 532, 410, 533, 534, 535, 536, 537, 538,
+	539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+	555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570,
+	571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+	587, 588, 589, 590, 509, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+	602, 603, 604, 432, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+	617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632,
+	633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+	649, 650, 651, 652, 653, 654, 12, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+	664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+	680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+	696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+	712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+	728, 729, 730, 731, 732, 733, 719, 719, 718, 734, 735, 736, 737, 683, 738, 739,
+	740, 741, 742, 743, 744, 108, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754,
+	696, 697, 699, 755, 756, 731, 757, 758, 759, 760, 761, 762, 763, 764, 725, 1,
+	765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780,
+	781, 778, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 752,
+	795, 796, 797, 798, 799, 719, 800, 801, 659, 528, 802, 803, 804, 799, 805, 806,
+	118, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 59, 41, 349,
+	819, 820, 821, 822, 823, 824, 48, 825, 826, 359, 53, 827, 828, 57, 829, 830,
+	142, 311, 831, 832, 833, 834, 835, 836, 837, 838, 839, 534, 840, 348, 841, 842,
+	247, 843, 116, 87, 844, 80, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854,
+	855, 856, 178, 857, 858, 859, 860, 861, 862, 863, 864, 563, 865, 866, 867, 868,
+	869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+	885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 349, 895, 896, 897, 898, 899,
+	822, 900, 901, 325, 902, 903, 135, 138, 904, 905, 906, 907, 819, 142, 908, 909,
+	910, 911, 912, 913, 914, 915, 814, 916, 815, 816, 917, 818, 918, 919, 920, 921,
+	820, 922, 822, 41, 48, 825, 826, 899, 53, 923, 828, 57, 924, 925, 926, 927,
+	928, 929, 930, 931, 932, 933, 934, 935, 595, 936, 937, 938, 939, 535, 940, 941,
+	247, 942, 943, 598, 80, 944, 945, 893, 946, 947, 563, 89, 948, 949, 950, 951,
+	952, 953, 954, 896, 955, 956, 167, 170, 957, 958, 895, 84, 959, 960, 961, 962,
+	963, 964, 965, 966, 967, 968, 969, 854, 319, 970, 971, 972, 973, 974, 975, 976,
+	977, 978, 979, 980, 981, 982, 983, 984, 349, 560, 985, 986, 987, 988, 989, 990,
+	991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+	1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+	1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+	1039, 1040, 1041, 1042, 827, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+	1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+	1070, 1071, 1072, 1073, 1074, 1075, 1076, 194, 131, 163, 133, 1077, 1078, 212, 333, 1079,
+	1080, 1081, 1082, 1083, 1084, 1085, 372, 589, 1086, 1087, 1088, 1089, 149, 181, 349, 560,
+	1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+	1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+	1122, 1123, 1124, 541, 1125, 849, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+	1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+	1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+	1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+	1184, 1185, 799, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+	1155, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 79, 1212,
+	1213, 1214, 1215, 86, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 80, 1223, 1224, 1225, 1226,
+	1227, 1228, 753, 1229, 1230, 718, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
+	1241, 676, 1242, 1243, 719, 1244, 1245, 1246, 1247, 676, 1248, 1249, 1250, 1251, 658, 1252,
+	1253, 1254, 1255, 731, 732, 1256, 728, 726, 1257, 1258, 1259, 1260, 734, 1261, 1262, 1263,
+	1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+	1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+	1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+	1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1340,
+	1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+	1359, 1360, 1361, 1362, 1363, 1364, 1360, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+	1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+	1390, 1391, 1392, 1393, 1394, 1359, 1395, 1396, 1397, 1398, 1399, 1263, 1400, 1401, 1402, 1403,
+	1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+	1420, 1421, 1422, 1423, 1424, 1425, 1426, 912, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+	1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+	1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
+	1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
+	1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+	1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+	1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+	1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+	1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+	1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
+	1579, 1580, 1581, 1582, 1583, 1584, 831, 1585, 832, 1586, 833, 1587, 1588, 1589, 178, 1590,
+	857, 1591, 858, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+	1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,
+	1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+	1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 193, 1647, 1648, 806, 1649, 1650,
+	718, 1650, 660, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 807, 1658, 808, 1659, 1660, 1661,
+	1662, 1663, 1664, 1665, 1665, 1666, 1667, 235, 1668, 1669, 809, 1670, 1671, 1672, 1673, 1674,
+	1675, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 811, 1683, 1684, 805, 1685, 1686, 1687,
+	1688, 1689, 1690, 269, 1691, 1692, 812, 1693, 644, 1694, 108, 108, 745, 745, 1303, 1303,
+	382, 743, 1695, 1696, 1697, 1698, 1699, 678, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707,
+	1708, 118, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722,
+	1723, 738, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+	1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+	1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1231, 1763, 1764, 1765, 1766, 1767, 1768,
+	1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+	1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+	1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+	1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+	1849, 1126, 931, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862,
+	1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+	830, 1879, 1880, 1881, 820, 132, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1271,
+	1272, 1273, 1274, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+	1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+	1920, 1921, 1922, 1923, 1924, 1925, 1926, 381, 382, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+	57, 1934, 1935, 45, 899, 1936, 1937, 96, 1938, 1939, 1940, 87, 1941, 1942, 1943, 1944,
+	89, 1945, 1946, 1947, 893, 1948, 1949, 1950, 1951, 1952, 325, 1953, 1954, 1955, 1956, 1957,
+	1958, 1959, 1960, 1955, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972,
+	1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988,
+	1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+	2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020,
+	2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+	2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052,
+	2053, 2054, 2055, 2026, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2061, 2064, 2065, 2066,
+	2067, 2068, 2069, 332, 2070, 2071, 817, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+	2081, 2082, 745, 2083, 2084, 2085, 2086, 2087, 2088, 118, 2089, 2090, 2091, 2092, 2093, 601,
+	2094, 2095, 2096, 93, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+	2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+	2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+	2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+	2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 106, 122, 2167, 2168, 2169, 2170,
+	2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+	2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202,
+	2203, 2204, 2205, 944, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 349, 2215, 2216,
+	2217, 2218, 2219, 2220, 53, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231,
+	2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+	2248, 2249, 2250, 2251, 2252, 1260, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262,
+	2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278,
+	2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+	2295, 2296, 2297, 2298, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309,
+	2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325,
+	2326, 2327, 2328, 2329, 2330, 2331, 2332, 2268, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340,
+	2341, 2342, 2343, 2344, 2345, 2346, 2347, 2217, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355,
+	2356, 2357, 2358, 2314, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 1408, 2212, 2366, 2367, 2368,
+	2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384,
+	2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400,
+	2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416,
+	2417, 2418, 2419, 854, 2420, 2421, 2422, 2423, 836, 2424, 2425, 2426, 2427, 2428, 2429, 2430,
+	2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446,
+	2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462,
+	2457, 2463, 2464, 2460, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2469, 1303, 2473, 2474,
+	2475, 2476, 2477, 693, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 742, 2485, 2486, 1408, 2487,
+	2381, 2488, 2489, 2490, 2412, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2469, 2344,
+	2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2510, 2511,
+	2514, 2515, 1303, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+	2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544,
+	2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 693, 2554, 2555, 2556, 2557, 2558, 2559,
+	2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+	2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591,
+	2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+	2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+	2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639,
+	2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+	2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+	2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687,
+	2688, 2689, 2690, 2662, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
+	2703, 2704, 2668, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717,
+	2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 1303, 2726, 2469, 2727, 2294, 2728, 2729, 2730,
+	2294, 2728, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744,
+	2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760,
+	2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776,
+	2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792,
+	2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808,
+	2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+	2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840,
+	2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856,
+	2857, 2858, 2859, 2859, 2860, 2861, 2861, 2480, 2862, 2863, 2864, 2865, 2866, 2481, 2867, 2868,
+	2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 80, 2879, 2880, 2881, 2882, 2883,
+	2884, 2885, 2886, 2887, 2888, 2889, 2890, 2360, 2891, 2892, 2893, 817, 2894, 2895, 2896, 2897,
+	1705, 2898, 2899, 2900, 2901, 2072, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
+	2912, 2913, 2914, 2915, 2916, 2917, 2212, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926,
+	2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 80, 2941,
+	2942, 2943, 2944, 2881, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+	2957, 2958, 2959, 2960, 2961, 2960, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2253, 2969, 2970,
+	2971, 2211, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 1354, 2981, 2982, 2983, 2984,
+	2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000,
+	3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016,
+	3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032,
+	3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048,
+	3049, 3050, 3051, 3052, 3053, 3054, 3055, 2914, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+	3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079,
+	3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095,
+	3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111,
+	3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 80, 3124, 80, 2917,
+	3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 560,
+	2214, 3124, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153,
+	3154, 3155, 3156, 3157, 89, 3158, 3159, 3160, 3161, 3162, 2241, 3163, 1702, 3164, 3165, 2999,
+	3166, 12, 3167, 3168, 3169, 2910, 3170, 3171, 3172, 2969, 3173, 2253, 2253, 3174, 3175, 1738,
+	3176, 3177, 3177, 3177, 1738, 3178, 3178, 3179, 3180, 1738, 3176, 1738, 3181, 3182, 3183, 3184,
+	3185, 1738, 1738, 1738, 1738, 3177, 3177, 3177, 3177, 3177, 3186, 3187, 3188, 3187, 3188, 3189,
+	381, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+	3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 9, 10, 3213, 3214, 3215, 3216, 3217, 3218,
+	3219, 3220, 3221, 3222, 3223, 3224, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577,
+	3225, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3226, 3227, 3228, 3229, 3230, 3231,
+	3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3244, 3244, 3244,
+	3245, 3245, 3244, 3244, 3246, 3247, 3248, 3247, 3249, 3250, 3251, 3252, 3253, 3253, 3247, 3254,
+	3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 2912, 3268, 3269,
+	3270, 3271, 3272, 3273, 3274, 2221, 53, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 2911, 3282,
+	3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298,
+	3299, 3300, 1836, 3301, 3302, 3303, 3304, 2025, 3305, 3306, 3307, 3308, 2034, 1, 3309, 3310,
+	3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326,
+	3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342,
+	3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358,
+	3359, 3360, 3361, 3100, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373,
+	3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389,
+	3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+	3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421,
+	3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+	3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+	3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469,
+	3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485,
+	3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501,
+	3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517,
+	3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533,
+	3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549,
+	3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565,
+	3566, 3567, 3568, 3307, 3308, 3569, 3570, 3571, 3572, 3573, 3574, 2037, 2039, 3575, 3576, 3577,
+	3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593,
+	3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 89, 89, 3599, 3599, 3602, 3603, 3598, 3598,
+	3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619,
+	3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635,
+	3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 18, 3649, 3650,
+	3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666,
+	3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 1927, 3680, 3681,
+	3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697,
+	3698, 3699, 3700, 3701, 3702, 3703, 1754, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712,
+	3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728,
+	3729, 3730, 560, 2917, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 104, 3741,
+	3742, 2884, 2883, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+	3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3126, 3768, 3769, 3770,
+	3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786,
+	3787, 3788, 3789, 3790, 3791, 3792, 3789, 3793, 3794, 3288, 3289, 3795, 3796, 2211, 2207, 2209,
+	3797, 2201, 825, 3798, 3799, 3800, 150, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809,
+	3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
+	3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 89, 3838, 3839, 3840,
+	3841, 3842, 3843, 3844, 2213, 3845, 3846, 3847, 3846, 2505, 3848, 3849, 3850, 3851, 3852, 3853,
+	3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869,
+	3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885,
+	3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 2120, 3894, 3895, 3896, 3897, 3898, 3899, 3900,
+	3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916,
+	3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932,
+	3933, 3934, 3935, 3936, 3937, 3938, 3939, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947,
+	3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
+	3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979,
+	3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995,
+	3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011,
+	4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027,
+	4028, 1927, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042,
+	4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058,
+	4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 2877, 2878, 4067, 4068, 4069, 4070, 4071, 4072,
+	4073, 4074, 2910, 2911, 4075, 4076, 2910, 4077, 2914, 4078, 4079, 4080, 48, 4081, 4082, 4081,
+	4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4081, 4094, 4095, 4096, 4097,
+	4098, 4099, 2031, 2032, 3666, 3669, 4096, 4097, 3667, 3668, 4100, 4101, 4102, 4103, 4104, 4105,
+	4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121,
+	4122, 4123, 3852, 4124, 4125, 4126, 4127, 795, 4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135,
+	4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4151,
+	4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163, 4164, 4165, 4166, 4167,
+	4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180,
+};
+static const uint16_t orp_chunks[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+	51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+	67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 0,
+	0, 82, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 87,
+};
+static const uint64_t orp_coverage[] = {
+	0x0000000000000000, 0xffffffff00000001, 0x7fffffffffffffff, 0xffffffff00000000,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x7cffffffffffffff, 0xfffffffbffffd7f0,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xfffe000fffffffff, 0xfffffffefe7fffff, 0xfffffffffffe06ff,
+	0x001f07ffffff00ff, 0xffffffff1fffffff, 0x0001ffffffffffff, 0xc03f0000c00ffcfc,
+	0x0003ffff00f0000f, 0x000000000000ffff, 0x03fc000000000000, 0xffffffff3f3fffff,
+	0x3fffffffaaff3f3f, 0xffdfffffffffffff, 0x7fdcffffefcfffdf, 0xffff00ffffff0000,
+	0xfff300007fffffff, 0x003fffff001f7fff, 0x0001ffffffff0000, 0xffffffffffffffff,
+	0xfffffffffff8ffff, 0xffffffffffff01ff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffff9ffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x000000ffffffffff, 0x0000007fffffffff,
+	0xffffffff000007ff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffecfffff,
+	0xffffffffffffffff, 0x1fffffff1fffffff, 0x000000000000000f, 0xfffffefffffff3de,
+	0xfffffffe7f47afff, 0x7ffeffffff1fffff, 0xffffffffffff17ff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0x0000001f00001fff, 0x000000000000000f, 0x3ffeffff00000000, 0xffffffff00000000,
+	0x0004000000000000, 0x000000000000007f, 0x0000000f00000000, 0x2000000000000000,
+};
+static const uint16_t orp_ranks[] = {
+	0, 0, 33, 96, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 829,
+	886, 950, 1014, 1078, 1142, 1206, 1257, 1318, 1375, 1415, 1476, 1525, 1551, 1577, 1593, 1601,
+	1661, 1715, 1778, 1834, 1874, 1919, 1961, 1994, 2058, 2119, 2176, 2240, 2304, 2368, 2432, 2496,
+	2558, 2622, 2686, 2726, 2765, 2808, 2872, 2936, 3000, 3064, 3128, 3192, 3253, 3317, 3375, 3379,
+	3438, 3494, 3553, 3613, 3677, 3741, 3805, 3869, 3933, 3997, 4061, 4125, 4189, 4253, 4317, 4381,
+	4445, 4463, 4467, 4496, 4528, 4529, 4536, 4540,
+};
+static const FBInkFont orp_font = {
+	.map =
+	    {
+		.chunks      = orp_chunks,
+		.coverage    = orp_coverage,
+		.ranks       = orp_ranks,
+		.chunk_count = 1024U,
+	    },
+	.ids         = orp_ids,
+	.bitmaps     = orp_bitmaps,
+	.width       = 6U,
+	.height      = 12U,
+	.bitmap_size = 9U,
+};
 
-static const unsigned char orp_block3[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A1 (¡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x15, 0x0e, 0x04, 0x00 },	// U+00A2 (¢)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x02, 0x07, 0x02, 0x12, 0x0d, 0x00, 0x00 },	// U+00A3 (£)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x11, 0x0a, 0x15, 0x00, 0x00 },	// U+00A4 (¤)
-	{ 0x00, 0x00, 0x00, 0x11, 0x0a, 0x1f, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+00A5 (¥)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A6 (¦)
-	{ 0x00, 0x00, 0x1c, 0x02, 0x0c, 0x12, 0x12, 0x0c, 0x10, 0x0e, 0x00, 0x00 },	// U+00A7 (§)
-	{ 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A8 (¨)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x21, 0x29, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+00A9 (©)
-	{ 0x00, 0x0c, 0x0a, 0x0c, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AA (ª)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x05, 0x0a, 0x14, 0x00, 0x00, 0x00 },	// U+00AB («)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AD (­)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x25, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+00AE (®)
-	{ 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
-	{ 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x1f, 0x00, 0x00 },	// U+00B1 (±)
-	{ 0x04, 0x0a, 0x08, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B2 (²)
-	{ 0x06, 0x08, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B3 (³)
-	{ 0x00, 0x00, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B4 (´)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x17, 0x01, 0x01 },	// U+00B5 (µ)
-	{ 0x00, 0x00, 0x1e, 0x17, 0x17, 0x17, 0x16, 0x14, 0x14, 0x14, 0x00, 0x00 },	// U+00B6 (¶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B7 (·)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06 },	// U+00B8 (¸)
-	{ 0x04, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B9 (¹)
-	{ 0x04, 0x0a, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00BA (º)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x14, 0x0a, 0x05, 0x00, 0x00, 0x00 },	// U+00BB (»)
-	{ 0x02, 0x03, 0x02, 0x02, 0x0a, 0x0c, 0x0a, 0x1e, 0x08, 0x08, 0x00, 0x00 },	// U+00BC (¼)
-	{ 0x02, 0x03, 0x02, 0x02, 0x0a, 0x14, 0x10, 0x08, 0x04, 0x1c, 0x00, 0x00 },	// U+00BD (½)
-	{ 0x03, 0x04, 0x02, 0x04, 0x0b, 0x0c, 0x0a, 0x1e, 0x08, 0x08, 0x00, 0x00 },	// U+00BE (¾)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x02, 0x11, 0x0e, 0x00, 0x00 },	// U+00BF (¿)
-	{ 0x02, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C0 (À)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C1 (Á)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C2 (Â)
-	{ 0x16, 0x0d, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C3 (Ã)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C4 (Ä)
-	{ 0x04, 0x0a, 0x04, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00C5 (Å)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x0f, 0x05, 0x05, 0x1d, 0x00, 0x00 },	// U+00C6 (Æ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x08, 0x06 },	// U+00C7 (Ç)
-	{ 0x02, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+00C8 (È)
-	{ 0x08, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+00C9 (É)
-	{ 0x04, 0x0a, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+00CA (Ê)
-	{ 0x00, 0x0a, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+00CB (Ë)
-	{ 0x02, 0x04, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00CC (Ì)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00CD (Í)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00CE (Î)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00CF (Ï)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x17, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+00D0 (Ð)
-	{ 0x16, 0x0d, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+00D1 (Ñ)
-	{ 0x02, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D2 (Ò)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D3 (Ó)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D4 (Ô)
-	{ 0x16, 0x0d, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D5 (Õ)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D6 (Ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+00D7 (×)
-	{ 0x00, 0x00, 0x10, 0x0e, 0x19, 0x15, 0x15, 0x15, 0x13, 0x0e, 0x01, 0x00 },	// U+00D8 (Ø)
-	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00D9 (Ù)
-	{ 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00DA (Ú)
-	{ 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00DB (Û)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00DC (Ü)
-	{ 0x08, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00DD (Ý)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x0e, 0x02, 0x00, 0x00 },	// U+00DE (Þ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x09, 0x05, 0x09, 0x11, 0x0d, 0x00, 0x00 },	// U+00DF (ß)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E0 (à)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E1 (á)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E2 (â)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E3 (ã)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E4 (ä)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+00E5 (å)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x14, 0x0e, 0x05, 0x1e, 0x00, 0x00 },	// U+00E6 (æ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x08, 0x06 },	// U+00E7 (ç)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00E8 (è)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00E9 (é)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00EA (ê)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00EB (ë)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00EC (ì)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00ED (í)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00EE (î)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+00EF (ï)
-	{ 0x00, 0x0a, 0x04, 0x0a, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F0 (ð)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+00F1 (ñ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F2 (ò)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F3 (ó)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F4 (ô)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F5 (õ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F6 (ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+00F7 (÷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x19, 0x15, 0x13, 0x0f, 0x00, 0x00 },	// U+00F8 (ø)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00F9 (ù)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00FA (ú)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00FB (û)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+00FC (ü)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+00FD (ý)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+00FE (þ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+00FF (ÿ)
-	{ 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0100 (Ā)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0101 (ā)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0102 (Ă)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0103 (ă)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x08, 0x10 },	// U+0104 (Ą)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x04, 0x0c },	// U+0105 (ą)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0106 (Ć)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0107 (ć)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0108 (Ĉ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x1e, 0x00, 0x00 },	// U+0109 (ĉ)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+010A (Ċ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+010B (ċ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+010C (Č)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+010D (č)
-	{ 0x0a, 0x04, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+010E (Ď)
-	{ 0x28, 0x10, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+010F (ď)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x17, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+0110 (Đ)
-	{ 0x00, 0x00, 0x10, 0x38, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+0111 (đ)
-	{ 0x00, 0x0e, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0112 (Ē)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0113 (ē)
-	{ 0x11, 0x0e, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0114 (Ĕ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0115 (ĕ)
-	{ 0x00, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0116 (Ė)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0117 (ė)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x04, 0x0c },	// U+0118 (Ę)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x04, 0x0c },	// U+0119 (ę)
-	{ 0x0a, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+011A (Ě)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+011B (ě)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x01, 0x19, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+011C (Ĝ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+011D (ĝ)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+011E (Ğ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+011F (ğ)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+0120 (Ġ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+0121 (ġ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x08, 0x06 },	// U+0122 (Ģ)
-	{ 0x00, 0x04, 0x02, 0x06, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+0123 (ģ)
-	{ 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0124 (Ĥ)
-	{ 0x04, 0x0a, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0125 (ĥ)
-	{ 0x00, 0x00, 0x00, 0x12, 0x3f, 0x12, 0x1e, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+0126 (Ħ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0f, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+0127 (ħ)
-	{ 0x14, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0128 (Ĩ)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0129 (ĩ)
-	{ 0x00, 0x0e, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+012A (Ī)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+012B (ī)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+012C (Ĭ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+012D (ĭ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x0c },	// U+012E (Į)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x0c },	// U+012F (į)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0130 (İ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0131 (ı)
-	{ 0x00, 0x00, 0x00, 0x19, 0x11, 0x11, 0x11, 0x11, 0x15, 0x09, 0x00, 0x00 },	// U+0132 (Ĳ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x00, 0x19, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0c },	// U+0133 (ĳ)
-	{ 0x08, 0x14, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x00, 0x00 },	// U+0134 (Ĵ)
-	{ 0x00, 0x00, 0x08, 0x14, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x06 },	// U+0135 (ĵ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x08, 0x06 },	// U+0136 (Ķ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x08, 0x06 },	// U+0137 (ķ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+0138 (ĸ)
-	{ 0x08, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0139 (Ĺ)
-	{ 0x08, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+013A (ĺ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x08, 0x06 },	// U+013B (Ļ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x08, 0x06 },	// U+013C (ļ)
-	{ 0x0a, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+013D (Ľ)
-	{ 0x0a, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+013E (ľ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+013F (Ŀ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x14, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0140 (ŀ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x06, 0x03, 0x02, 0x02, 0x1e, 0x00, 0x00 },	// U+0141 (Ł)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x0c, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0142 (ł)
-	{ 0x08, 0x04, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+0143 (Ń)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0144 (ń)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x04, 0x02 },	// U+0145 (Ņ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x04, 0x02 },	// U+0146 (ņ)
-	{ 0x0a, 0x04, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+0147 (Ň)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0148 (ň)
-	{ 0x00, 0x00, 0x03, 0x02, 0x01, 0x0a, 0x16, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+0149 (ŉ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x10, 0x0c },	// U+014A (Ŋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x0c },	// U+014B (ŋ)
-	{ 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+014C (Ō)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+014D (ō)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+014E (Ŏ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+014F (ŏ)
-	{ 0x12, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0150 (Ő)
-	{ 0x00, 0x00, 0x12, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0151 (ő)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x0d, 0x05, 0x05, 0x1e, 0x00, 0x00 },	// U+0152 (Œ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x0d, 0x05, 0x1e, 0x00, 0x00 },	// U+0153 (œ)
-	{ 0x08, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+0154 (Ŕ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0155 (ŕ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x04, 0x02 },	// U+0156 (Ŗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x04, 0x02 },	// U+0157 (ŗ)
-	{ 0x0a, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+0158 (Ř)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0159 (ř)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+015A (Ś)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+015B (ś)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+015C (Ŝ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+015D (ŝ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x08, 0x06 },	// U+015E (Ş)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x08, 0x06 },	// U+015F (ş)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0160 (Š)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+0161 (š)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x06 },	// U+0162 (Ţ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x10, 0x0c },	// U+0163 (ţ)
-	{ 0x0a, 0x04, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0164 (Ť)
-	{ 0x0a, 0x04, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+0165 (ť)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0166 (Ŧ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x04, 0x1f, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+0167 (ŧ)
-	{ 0x16, 0x0d, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0168 (Ũ)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0169 (ũ)
-	{ 0x00, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+016A (Ū)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+016B (ū)
-	{ 0x11, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+016C (Ŭ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+016D (ŭ)
-	{ 0x04, 0x0a, 0x04, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+016E (Ů)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+016F (ů)
-	{ 0x12, 0x09, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0170 (Ű)
-	{ 0x00, 0x00, 0x12, 0x09, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0171 (ű)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0c },	// U+0172 (Ų)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0c },	// U+0173 (ų)
-	{ 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0174 (Ŵ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0175 (ŵ)
-	{ 0x04, 0x0a, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0176 (Ŷ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+0177 (ŷ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0178 (Ÿ)
-	{ 0x08, 0x04, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+0179 (Ź)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+017A (ź)
-	{ 0x00, 0x04, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+017B (Ż)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+017C (ż)
-	{ 0x0a, 0x04, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+017D (Ž)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+017E (ž)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+017F (ſ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0f, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+0180 (ƀ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x0c, 0x14, 0x14, 0x0c, 0x00, 0x00 },	// U+0181 (Ɓ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+0182 (Ƃ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0183 (ƃ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+0184 (Ƅ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x03, 0x0e, 0x12, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+0185 (ƅ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0186 (Ɔ)
-	{ 0x00, 0x00, 0x30, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0187 (Ƈ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0188 (ƈ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x17, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+0189 (Ɖ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x14, 0x14, 0x14, 0x0c, 0x00, 0x00 },	// U+018A (Ɗ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+018B (Ƌ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+018C (ƌ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0e, 0x10, 0x11, 0x0e },	// U+018D (ƍ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00, 0x00 },	// U+018E (Ǝ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+018F (Ə)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0190 (Ɛ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x02, 0x02, 0x0e, 0x02, 0x02, 0x02, 0x01, 0x00 },	// U+0191 (Ƒ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x14, 0x04, 0x0e, 0x04, 0x04, 0x05, 0x02, 0x00 },	// U+0192 (ƒ)
-	{ 0x00, 0x00, 0x30, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+0193 (Ɠ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+0194 (Ɣ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x13, 0x15, 0x15, 0x15, 0x09, 0x00, 0x00 },	// U+0195 (ƕ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+0196 (Ɩ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0197 (Ɨ)
-	{ 0x00, 0x00, 0x00, 0x19, 0x05, 0x03, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+0198 (Ƙ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x00 },	// U+0199 (ƙ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+019A (ƚ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x06, 0x04, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+019B (ƛ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1a, 0x00, 0x00 },	// U+019C (Ɯ)
-	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x16, 0x1a, 0x12, 0x12, 0x01, 0x00 },	// U+019D (Ɲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+019E (ƞ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+019F (Ɵ)
-	{ 0x00, 0x00, 0x10, 0x16, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01A0 (Ơ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01A1 (ơ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0d, 0x15, 0x15, 0x15, 0x15, 0x12, 0x00, 0x00 },	// U+01A2 (Ƣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x15, 0x12, 0x00, 0x00 },	// U+01A3 (ƣ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+01A4 (Ƥ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+01A5 (ƥ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x10, 0x00 },	// U+01A6 (Ʀ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x0e, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+01A7 (Ƨ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x0e, 0x01, 0x1e, 0x00, 0x00 },	// U+01A8 (ƨ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+01A9 (Ʃ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x0e, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00 },	// U+01AA (ƪ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x10, 0x0c },	// U+01AB (ƫ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+01AC (Ƭ)
-	{ 0x00, 0x00, 0x18, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+01AD (ƭ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00 },	// U+01AE (Ʈ)
-	{ 0x00, 0x00, 0x10, 0x19, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01AF (Ư)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x19, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+01B0 (ư)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01B1 (Ʊ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01B2 (Ʋ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x12, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+01B3 (Ƴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x05, 0x05, 0x05, 0x06, 0x02, 0x01 },	// U+01B4 (ƴ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x1f, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+01B5 (Ƶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x1f, 0x02, 0x1f, 0x00, 0x00 },	// U+01B6 (ƶ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+01B7 (Ʒ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x0e, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+01B8 (Ƹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x0e, 0x01, 0x11, 0x0e },	// U+01B9 (ƹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x0c, 0x10, 0x0e, 0x11, 0x0e },	// U+01BA (ƺ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x08, 0x1e, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+01BB (ƻ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x07, 0x08, 0x10, 0x10, 0x0f, 0x00, 0x00 },	// U+01BC (Ƽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x0e, 0x10, 0x0e, 0x00, 0x00 },	// U+01BD (ƽ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0c, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+01BE (ƾ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x09, 0x05, 0x03, 0x01, 0x01 },	// U+01BF (ƿ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+01C0 (ǀ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+01C1 (ǁ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+01C2 (ǂ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+01C3 (ǃ)
-	{ 0x14, 0x08, 0x00, 0x1b, 0x15, 0x15, 0x0d, 0x0d, 0x0d, 0x1b, 0x00, 0x00 },	// U+01C4 (Ǆ)
-	{ 0x00, 0x14, 0x08, 0x03, 0x05, 0x1d, 0x15, 0x0d, 0x0d, 0x1b, 0x00, 0x00 },	// U+01C5 (ǅ)
-	{ 0x14, 0x08, 0x00, 0x04, 0x04, 0x1e, 0x15, 0x0d, 0x0d, 0x1e, 0x00, 0x00 },	// U+01C6 (ǆ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x0b, 0x00, 0x00 },	// U+01C7 (Ǉ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x01, 0x19, 0x11, 0x11, 0x11, 0x17, 0x10, 0x0c },	// U+01C8 (ǈ)
-	{ 0x00, 0x00, 0x00, 0x13, 0x02, 0x1a, 0x12, 0x12, 0x12, 0x17, 0x10, 0x0c },	// U+01C9 (ǉ)
-	{ 0x00, 0x00, 0x00, 0x13, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0d, 0x00, 0x00 },	// U+01CA (Ǌ)
-	{ 0x00, 0x00, 0x00, 0x13, 0x05, 0x1d, 0x15, 0x15, 0x15, 0x15, 0x10, 0x0c },	// U+01CB (ǋ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x15, 0x15, 0x15, 0x15, 0x10, 0x0c },	// U+01CC (ǌ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+01CD (Ǎ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+01CE (ǎ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+01CF (Ǐ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+01D0 (ǐ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D1 (Ǒ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D2 (ǒ)
-	{ 0x0a, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D3 (Ǔ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D4 (ǔ)
-	{ 0x0e, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D5 (Ǖ)
-	{ 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D6 (ǖ)
-	{ 0x08, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D7 (Ǘ)
-	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D8 (ǘ)
-	{ 0x0a, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01D9 (Ǚ)
-	{ 0x0a, 0x04, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01DA (ǚ)
-	{ 0x02, 0x04, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01DB (Ǜ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01DC (ǜ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x0e, 0x00, 0x00 },	// U+01DD (ǝ)
-	{ 0x0e, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+01DE (Ǟ)
-	{ 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+01DF (ǟ)
-	{ 0x0e, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+01E0 (Ǡ)
-	{ 0x00, 0x0e, 0x00, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+01E1 (ǡ)
-	{ 0x00, 0x1e, 0x00, 0x1e, 0x05, 0x05, 0x0f, 0x05, 0x05, 0x1d, 0x00, 0x00 },	// U+01E2 (Ǣ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x14, 0x0e, 0x05, 0x1e, 0x00, 0x00 },	// U+01E3 (ǣ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x19, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+01E4 (Ǥ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x1f, 0x0e },	// U+01E5 (ǥ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+01E6 (Ǧ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+01E7 (ǧ)
-	{ 0x0a, 0x04, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+01E8 (Ǩ)
-	{ 0x00, 0x0a, 0x04, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x00 },	// U+01E9 (ǩ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x02, 0x0c },	// U+01EA (Ǫ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x02, 0x0c },	// U+01EB (ǫ)
-	{ 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x02, 0x0c },	// U+01EC (Ǭ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x02, 0x0c },	// U+01ED (ǭ)
-	{ 0x0a, 0x04, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+01EE (Ǯ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e },	// U+01EF (ǯ)
-	{ 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06 },	// U+01F0 (ǰ)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x15, 0x15, 0x0d, 0x0d, 0x0d, 0x1b, 0x00, 0x00 },	// U+01F1 (Ǳ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x05, 0x1d, 0x15, 0x0d, 0x0d, 0x1b, 0x00, 0x00 },	// U+01F2 (ǲ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x15, 0x0d, 0x0d, 0x1e, 0x00, 0x00 },	// U+01F3 (ǳ)
-	{ 0x08, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+01F4 (Ǵ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+01F5 (ǵ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x17, 0x15, 0x15, 0x15, 0x09, 0x00, 0x00 },	// U+01F6 (Ƕ)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x09, 0x05, 0x03, 0x01, 0x00, 0x00 },	// U+01F7 (Ƿ)
-	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+01F8 (Ǹ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+01F9 (ǹ)
-	{ 0x08, 0x04, 0x04, 0x0a, 0x04, 0x0e, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+01FA (Ǻ)
-	{ 0x08, 0x04, 0x04, 0x0a, 0x04, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+01FB (ǻ)
-	{ 0x08, 0x04, 0x00, 0x1e, 0x05, 0x05, 0x0f, 0x05, 0x05, 0x1d, 0x00, 0x00 },	// U+01FC (Ǽ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x14, 0x0e, 0x05, 0x1e, 0x00, 0x00 },	// U+01FD (ǽ)
-	{ 0x08, 0x04, 0x10, 0x0e, 0x19, 0x15, 0x15, 0x15, 0x13, 0x0e, 0x01, 0x00 },	// U+01FE (Ǿ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x1e, 0x19, 0x15, 0x13, 0x0f, 0x00, 0x00 },	// U+01FF (ǿ)
-	{ 0x09, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0200 (Ȁ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0201 (ȁ)
-	{ 0x0e, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0202 (Ȃ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0203 (ȃ)
-	{ 0x09, 0x12, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0204 (Ȅ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0205 (ȅ)
-	{ 0x09, 0x12, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0206 (Ȇ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0207 (ȇ)
-	{ 0x09, 0x12, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0208 (Ȉ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0209 (ȉ)
-	{ 0x0e, 0x11, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+020A (Ȋ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+020B (ȋ)
-	{ 0x09, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+020C (Ȍ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+020D (ȍ)
-	{ 0x0e, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+020E (Ȏ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+020F (ȏ)
-	{ 0x09, 0x12, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+0210 (Ȑ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0211 (ȑ)
-	{ 0x0e, 0x11, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+0212 (Ȓ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0213 (ȓ)
-	{ 0x09, 0x12, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0214 (Ȕ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0215 (ȕ)
-	{ 0x0e, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0216 (Ȗ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0217 (ȗ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x08, 0x04 },	// U+0218 (Ș)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x08, 0x04 },	// U+0219 (ș)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04 },	// U+021A (Ț)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x08, 0x04 },	// U+021B (ț)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x08, 0x14, 0x10, 0x10, 0x0f, 0x00, 0x00 },	// U+021C (Ȝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x08, 0x14, 0x10, 0x10, 0x0f },	// U+021D (ȝ)
-	{ 0x0a, 0x04, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+021E (Ȟ)
-	{ 0x00, 0x0a, 0x04, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+021F (ȟ)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x00 },	// U+0220 (Ƞ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x0e, 0x09, 0x19, 0x29, 0x1e, 0x04, 0x00 },	// U+0221 (ȡ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0222 (Ȣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0223 (ȣ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x10, 0x0c },	// U+0224 (Ȥ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x10, 0x0c },	// U+0225 (ȥ)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0226 (Ȧ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0227 (ȧ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x10, 0x0c },	// U+0228 (Ȩ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x10, 0x0c },	// U+0229 (ȩ)
-	{ 0x0e, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022A (Ȫ)
-	{ 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022B (ȫ)
-	{ 0x0e, 0x16, 0x0d, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022C (Ȭ)
-	{ 0x0e, 0x00, 0x16, 0x0d, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022D (ȭ)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022E (Ȯ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+022F (ȯ)
-	{ 0x0e, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0230 (Ȱ)
-	{ 0x00, 0x0e, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0231 (ȱ)
-	{ 0x00, 0x0e, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0232 (Ȳ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+0233 (ȳ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x14, 0x0c, 0x02, 0x00 },	// U+0234 (ȴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x19, 0x29, 0x19, 0x04, 0x00 },	// U+0235 (ȵ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x04, 0x0c, 0x14, 0x0a, 0x00, 0x00 },	// U+0236 (ȶ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06 },	// U+0237 (ȷ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+0238 (ȸ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04 },	// U+0239 (ȹ)
-	{ 0x00, 0x00, 0x00, 0x2e, 0x11, 0x19, 0x1f, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+023A (Ⱥ)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x12, 0x09, 0x09, 0x05, 0x02, 0x1d, 0x00, 0x00 },	// U+023B (Ȼ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x19, 0x05, 0x13, 0x0f, 0x00, 0x00 },	// U+023C (ȼ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x07, 0x02, 0x02, 0x1e, 0x00, 0x00 },	// U+023D (Ƚ)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x14, 0x0c, 0x04, 0x04, 0x06, 0x05, 0x00, 0x00 },	// U+023E (Ⱦ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x04, 0x08 },	// U+023F (ȿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x01, 0x02, 0x1c },	// U+0240 (ɀ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x0c, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0241 (Ɂ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x10, 0x0c, 0x04, 0x00, 0x00 },	// U+0242 (ɂ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x0e, 0x12, 0x17, 0x12, 0x0e, 0x00, 0x00 },	// U+0243 (Ƀ)
-	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x3f, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+0244 (Ʉ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x0a, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0245 (Ʌ)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x11, 0x09, 0x0f, 0x05, 0x03, 0x1f, 0x00, 0x00 },	// U+0246 (Ɇ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x15, 0x0f, 0x03, 0x0f, 0x00, 0x00 },	// U+0247 (ɇ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x08, 0x09, 0x06 },	// U+0248 (Ɉ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x1c, 0x08, 0x09, 0x06 },	// U+0249 (ɉ)
-	{ 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x19, 0x16, 0x10, 0x10, 0x20 },	// U+024A (Ɋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x10, 0x20 },	// U+024B (ɋ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x0f, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+024C (Ɍ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x02, 0x07, 0x02, 0x00, 0x00 },	// U+024D (ɍ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1f, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+024E (Ɏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x0a, 0x04, 0x02, 0x01 },	// U+024F (ɏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0250 (ɐ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0251 (ɑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x13, 0x0d, 0x00, 0x00 },	// U+0252 (ɒ)
-	{ 0x00, 0x00, 0x06, 0x09, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0253 (ɓ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0254 (ɔ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x09, 0x15, 0x0e, 0x04, 0x00 },	// U+0255 (ɕ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x10, 0x00 },	// U+0256 (ɖ)
-	{ 0x00, 0x00, 0x10, 0x08, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0257 (ɗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1e, 0x10, 0x0e, 0x00, 0x00 },	// U+0258 (ɘ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x0e, 0x00, 0x00 },	// U+0259 (ə)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x18, 0x2e, 0x09, 0x06, 0x00, 0x00 },	// U+025A (ɚ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+025B (ɛ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0c, 0x11, 0x0e, 0x00, 0x00 },	// U+025C (ɜ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x29, 0x04, 0x09, 0x06, 0x00, 0x00 },	// U+025D (ɝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0d, 0x11, 0x0e, 0x00, 0x00 },	// U+025E (ɞ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x1c, 0x08, 0x09, 0x06 },	// U+025F (ɟ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x06 },	// U+0260 (ɠ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+0261 (ɡ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+0262 (ɢ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x0a, 0x04 },	// U+0263 (ɣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+0264 (ɤ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10 },	// U+0265 (ɥ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0266 (ɦ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0c },	// U+0267 (ɧ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+0268 (ɨ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+0269 (ɩ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+026A (ɪ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+026B (ɫ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x06, 0x05, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+026C (ɬ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x14, 0x08 },	// U+026D (ɭ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x1e, 0x12, 0x0a, 0x0e, 0x17, 0x12, 0x0c },	// U+026E (ɮ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x1a, 0x00, 0x00 },	// U+026F (ɯ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x1a, 0x10, 0x10 },	// U+0270 (ɰ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x10, 0x0c },	// U+0271 (ɱ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x12, 0x12, 0x02, 0x01 },	// U+0272 (ɲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x08, 0x10 },	// U+0273 (ɳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x13, 0x15, 0x19, 0x11, 0x00, 0x00 },	// U+0274 (ɴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+0275 (ɵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x05, 0x0d, 0x05, 0x1e, 0x00, 0x00 },	// U+0276 (ɶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0277 (ɷ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+0278 (ɸ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x19, 0x16, 0x00, 0x00 },	// U+0279 (ɹ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x16, 0x00, 0x00 },	// U+027A (ɺ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x09, 0x0e, 0x08, 0x10 },	// U+027B (ɻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+027C (ɼ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x01, 0x01, 0x01, 0x05, 0x02 },	// U+027D (ɽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+027E (ɾ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+027F (ɿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x0f, 0x11, 0x11, 0x00, 0x00 },	// U+0280 (ʀ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0f, 0x11, 0x0f, 0x00, 0x00 },	// U+0281 (ʁ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x01, 0x06 },	// U+0282 (ʂ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x00 },	// U+0283 (ʃ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x0e, 0x04, 0x05, 0x02, 0x00 },	// U+0284 (ʄ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+0285 (ʅ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x0e, 0x05, 0x02, 0x00 },	// U+0286 (ʆ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x1f, 0x04, 0x04 },	// U+0287 (ʇ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18 },	// U+0288 (ʈ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0289 (ʉ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+028A (ʊ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x11, 0x09, 0x06, 0x00, 0x00 },	// U+028B (ʋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+028C (ʌ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x11, 0x11, 0x00, 0x00 },	// U+028D (ʍ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+028E (ʎ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+028F (ʏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x04, 0x18 },	// U+0290 (ʐ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x0a, 0x1f, 0x04, 0x02 },	// U+0291 (ʑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e },	// U+0292 (ʒ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x0c, 0x10, 0x1e, 0x11, 0x2e },	// U+0293 (ʓ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x0c, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0294 (ʔ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x06, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0295 (ʕ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0c, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0296 (ʖ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x0e },	// U+0297 (ʗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+0298 (ʘ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x0f, 0x11, 0x0f, 0x00, 0x00 },	// U+0299 (ʙ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x16, 0x11, 0x0e, 0x00, 0x00 },	// U+029A (ʚ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x1e, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+029B (ʛ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+029C (ʜ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x1e, 0x09, 0x06 },	// U+029D (ʝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x1c, 0x12, 0x11, 0x10, 0x10 },	// U+029E (ʞ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+029F (ʟ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x08 },	// U+02A0 (ʠ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x0c, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+02A1 (ʡ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x06, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+02A2 (ʢ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x15, 0x0d, 0x0d, 0x1e, 0x00, 0x00 },	// U+02A3 (ʣ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x15, 0x0d, 0x1d, 0x16, 0x10, 0x0c },	// U+02A4 (ʤ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1e, 0x15, 0x0d, 0x0d, 0x1e, 0x08, 0x00 },	// U+02A5 (ʥ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x1f, 0x0a, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+02A6 (ʦ)
-	{ 0x00, 0x00, 0x10, 0x2a, 0x0a, 0x0f, 0x0a, 0x0a, 0x0a, 0x0c, 0x0a, 0x04 },	// U+02A7 (ʧ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x17, 0x0a, 0x0a, 0x0a, 0x14, 0x08, 0x00 },	// U+02A8 (ʨ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x0f, 0x15, 0x15, 0x15, 0x10, 0x0c },	// U+02A9 (ʩ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x1a, 0x06, 0x0a, 0x12, 0x0f, 0x00, 0x00 },	// U+02AA (ʪ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x1e, 0x12, 0x0a, 0x06, 0x1f, 0x00, 0x00 },	// U+02AB (ʫ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x0a, 0x00, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+02AC (ʬ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x00, 0x1f, 0x11, 0x00, 0x00, 0x00 },	// U+02AD (ʭ)
-	{ 0x00, 0x00, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1c, 0x10, 0x10 },	// U+02AE (ʮ)
-	{ 0x00, 0x00, 0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1c, 0x10, 0x20 },	// U+02AF (ʯ)
-	{ 0x00, 0x02, 0x02, 0x06, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B0 (ʰ)
-	{ 0x00, 0x04, 0x02, 0x06, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B1 (ʱ)
-	{ 0x00, 0x08, 0x00, 0x08, 0x08, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B2 (ʲ)
-	{ 0x00, 0x00, 0x06, 0x0a, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B3 (ʳ)
-	{ 0x00, 0x00, 0x08, 0x08, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B4 (ʴ)
-	{ 0x00, 0x00, 0x08, 0x08, 0x0a, 0x0c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B5 (ʵ)
-	{ 0x00, 0x0a, 0x0a, 0x06, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B6 (ʶ)
-	{ 0x00, 0x00, 0x15, 0x15, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B7 (ʷ)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x0c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B8 (ʸ)
-	{ 0x00, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02B9 (ʹ)
-	{ 0x00, 0x12, 0x12, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BA (ʺ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BB (ʻ)
-	{ 0x00, 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BC (ʼ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BD (ʽ)
-	{ 0x00, 0x00, 0x04, 0x08, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BE (ʾ)
-	{ 0x00, 0x00, 0x04, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02BF (ʿ)
-	{ 0x00, 0x04, 0x0a, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C0 (ˀ)
-	{ 0x00, 0x04, 0x0a, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C1 (ˁ)
-	{ 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C2 (˂)
-	{ 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C3 (˃)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C4 (˄)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C5 (˅)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C6 (ˆ)
-	{ 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-	{ 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C8 (ˈ)
-	{ 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C9 (ˉ)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02CA (ˊ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02CB (ˋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00 },	// U+02CC (ˌ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00 },	// U+02CD (ˍ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00 },	// U+02CE (ˎ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00 },	// U+02CF (ˏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x00, 0x00 },	// U+02D0 (ː)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D1 (ˑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x10, 0x0c, 0x00, 0x00 },	// U+02D2 (˒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+02D3 (˓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D4 (˔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+02D5 (˕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+02D6 (˖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x11, 0x00, 0x00, 0x00 },	// U+02D7 (˗)
-	{ 0x00, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D8 (˘)
-	{ 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02D9 (˙)
-	{ 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c },	// U+02DB (˛)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DC (˜)
-	{ 0x00, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DD (˝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x16, 0x15, 0x08, 0x00, 0x00, 0x00 },	// U+02DE (˞)
-	{ 0x00, 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DF (˟)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E0 (ˠ)
-	{ 0x00, 0x06, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E1 (ˡ)
-	{ 0x00, 0x00, 0x0c, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E2 (ˢ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E3 (ˣ)
-	{ 0x00, 0x0c, 0x02, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02E4 (ˤ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+02E5 (˥)
-	{ 0x00, 0x00, 0x00, 0x08, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+02E6 (˦)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+02E7 (˧)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x08, 0x00, 0x00 },	// U+02E8 (˨)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00, 0x00 },	// U+02E9 (˩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x08 },	// U+02EA (˪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x02, 0x02 },	// U+02EB (˫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04 },	// U+02EC (ˬ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02ED (˭)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02EE (ˮ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x04 },	// U+02EF (˯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11 },	// U+02F0 (˰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x01, 0x06, 0x08 },	// U+02F1 (˱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x06, 0x01 },	// U+02F2 (˲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12 },	// U+02F3 (˳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02F4 (˴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02F5 (˵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02F6 (˶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d },	// U+02F7 (˷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00 },	// U+02F8 (˸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02F9 (˹)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02FA (˺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0c, 0x00, 0x00 },	// U+02FB (˻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x0c, 0x00, 0x00 },	// U+02FC (˼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x00, 0x00 },	// U+02FD (˽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00 },	// U+02FE (˾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00 },	// U+02FF (˿)
-	{ 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0300 (̀)
-	{ 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0301 (́)
-	{ 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0302 (̂)
-	{ 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0303 (̃)
-	{ 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0304 (̄)
-	{ 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0305 (̅)
-	{ 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0306 (̆)
-	{ 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0307 (̇)
-	{ 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0308 (̈)
-	{ 0x06, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0309 (̉)
-	{ 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030A (̊)
-	{ 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030B (̋)
-	{ 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030C (̌)
-	{ 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030D (̍)
-	{ 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030E (̎)
-	{ 0x09, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+030F (̏)
-	{ 0x04, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0310 (̐)
-	{ 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0311 (̑)
-	{ 0x08, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0312 (̒)
-	{ 0x0c, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0313 (̓)
-	{ 0x06, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0314 (̔)
-	{ 0x30, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0315 (̕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08 },	// U+0316 (̖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+0317 (̗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x08 },	// U+0318 (̘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x04 },	// U+0319 (̙)
-	{ 0x38, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+031A (̚)
-	{ 0x20, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+031B (̛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x08 },	// U+031C (̜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e },	// U+031D (̝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04 },	// U+031E (̞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04 },	// U+031F (̟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e },	// U+0320 (̠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x14, 0x08 },	// U+0321 (̡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x20 },	// U+0322 (̢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+0323 (̣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a },	// U+0324 (̤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04 },	// U+0325 (̥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+0326 (̦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+0327 (̧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08 },	// U+0328 (̨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04 },	// U+0329 (̩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x12 },	// U+032A (̪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a },	// U+032B (̫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0c },	// U+032C (̬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12 },	// U+032D (̭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e },	// U+032E (̮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11 },	// U+032F (̯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a },	// U+0330 (̰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f },	// U+0331 (̱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f },	// U+0332 (̲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f },	// U+0333 (̳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+0334 (̴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0335 (̵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0336 (̶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+0337 (̷)
-	{ 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00 },	// U+0338 (̸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04 },	// U+0339 (̹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1e },	// U+033A (̺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0e },	// U+033B (̻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15 },	// U+033C (̼)
-	{ 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+033D (̽)
-	{ 0x08, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+033E (̾)
-	{ 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+033F (̿)
-	{ 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0340 (̀)
-	{ 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0341 (́)
-	{ 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0342 (͂)
-	{ 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0343 (̓)
-	{ 0x08, 0x04, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0344 (̈́)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+0345 (ͅ)
-	{ 0x0e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0346 (͆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f },	// U+0347 (͇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a },	// U+0348 (͈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08 },	// U+0349 (͉)
-	{ 0x00, 0x04, 0x16, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034A (͊)
-	{ 0x08, 0x00, 0x16, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034B (͋)
-	{ 0x16, 0x0d, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034C (͌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a },	// U+034D (͍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e },	// U+034E (͎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+034F (͏)
-	{ 0x07, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0350 (͐)
-	{ 0x04, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0351 (͑)
-	{ 0x0e, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0352 (͒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x0a },	// U+0353 (͓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x07, 0x1c },	// U+0354 (͔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x07 },	// U+0355 (͕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x13, 0x2c, 0x2b },	// U+0356 (͖)
-	{ 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0357 (͗)
-	{ 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0358 (͘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x0e },	// U+0359 (͙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x0a },	// U+035A (͚)
-	{ 0x02, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+035B (͛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x1c },	// U+035C (͜)
-	{ 0x1c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+035D (͝)
-	{ 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+035E (͞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e },	// U+035F (͟)
-	{ 0x0c, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0360 (͠)
-	{ 0x1c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0361 (͡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3e, 0x10 },	// U+0362 (͢)
-	{ 0x04, 0x0a, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0363 (ͣ)
-	{ 0x04, 0x0e, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0364 (ͤ)
-	{ 0x04, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0365 (ͥ)
-	{ 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0366 (ͦ)
-	{ 0x0a, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0367 (ͧ)
-	{ 0x0c, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0368 (ͨ)
-	{ 0x08, 0x0c, 0x0a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0369 (ͩ)
-	{ 0x02, 0x06, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036A (ͪ)
-	{ 0x0b, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036B (ͫ)
-	{ 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036C (ͬ)
-	{ 0x04, 0x0e, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036D (ͭ)
-	{ 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036E (ͮ)
-	{ 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+036F (ͯ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0370 (Ͱ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x1c, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0371 (ͱ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0372 (Ͳ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0373 (ͳ)
-	{ 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0374 (ʹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+0375 (͵)
-	{ 0x00, 0x00, 0x00, 0x11, 0x19, 0x19, 0x15, 0x13, 0x13, 0x11, 0x00, 0x00 },	// U+0376 (Ͷ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0b, 0x09, 0x09, 0x10, 0x00 },	// U+0377 (ͷ)
-}; // 728
+static const uint16_t orpb_ids[] = {
+	0, 1, 4181, 4182, 4, 4183, 4184, 7, 4185, 4186, 4187, 11, 3167, 13, 3095, 15,
+	4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 28, 4200, 3097, 4201,
+	4202, 33, 4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216,
+	4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232,
+	4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248,
+	4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264,
+	1, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 4265, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 4266, 123, 124, 125, 126,
+	127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+	143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+	175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+	191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+	207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+	223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+	239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+	255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+	271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+	319, 320, 321, 322, 323, 324, 325, 326, 327, 207, 328, 329, 330, 331, 332, 333,
+	334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+	350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 290, 361, 362, 363, 364,
+	365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+	397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+	413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+	429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+	445, 446, 447, 448, 449, 450, 449, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+	460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+	476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+	492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+	508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+	524, 525, 526, 527, 528, 529, 530, 531, 532, 410, 533, 534, 535, 536, 537, 538,
+	539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+	555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570,
+	571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+	587, 588, 589, 590, 509, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+	602, 603, 604, 432, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+	617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632,
+	633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+	649, 650, 651, 652, 653, 654, 12, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+	664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+	680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+	696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+	712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+	728, 729, 730, 731, 732, 733, 719, 719, 718, 734, 735, 736, 737, 683, 738, 739,
+	740, 741, 742, 743, 744, 108, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754,
+	696, 697, 699, 755, 756, 731, 757, 758, 759, 760, 761, 762, 763, 764, 725, 1,
+	765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780,
+	781, 778, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 752,
+	795, 796, 797, 798, 799, 719, 800, 801, 659, 528, 802, 803, 804, 799, 805, 806,
+	118, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 59, 41, 349,
+	819, 820, 821, 822, 823, 824, 48, 825, 826, 359, 53, 827, 828, 57, 829, 830,
+	142, 311, 831, 832, 833, 834, 835, 836, 837, 838, 839, 534, 840, 348, 841, 842,
+	247, 843, 116, 87, 844, 80, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854,
+	855, 856, 178, 857, 858, 859, 860, 861, 862, 863, 864, 563, 865, 866, 867, 868,
+	869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+	885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 349, 895, 896, 897, 898, 899,
+	822, 900, 901, 325, 902, 903, 135, 138, 904, 905, 906, 907, 819, 142, 908, 909,
+	910, 911, 912, 913, 914, 915, 814, 916, 815, 816, 917, 818, 918, 919, 920, 921,
+	820, 922, 822, 41, 48, 825, 826, 899, 53, 923, 828, 57, 924, 925, 926, 927,
+	928, 929, 930, 931, 932, 933, 934, 935, 595, 936, 937, 938, 939, 535, 940, 941,
+	247, 942, 943, 598, 80, 944, 945, 893, 946, 947, 563, 89, 948, 949, 950, 951,
+	952, 953, 954, 896, 955, 956, 167, 170, 957, 958, 895, 84, 959, 960, 961, 962,
+	963, 964, 965, 966, 967, 968, 969, 854, 319, 970, 971, 972, 973, 974, 975, 976,
+	977, 978, 979, 980, 981, 982, 983, 984, 349, 560, 985, 986, 987, 988, 989, 990,
+	991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+	1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+	1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+	1039, 1040, 1041, 1042, 827, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+	1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+	1070, 1071, 1072, 1073, 1074, 1075, 1076, 194, 131, 163, 133, 1077, 1078, 212, 333, 1079,
+	1080, 1081, 1082, 1083, 1084, 1085, 372, 589, 1086, 1087, 1088, 1089, 149, 181, 349, 560,
+	1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+	1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+	1122, 1123, 1124, 541, 1125, 849, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+	1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+	1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+	1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+	1184, 1185, 799, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+	1155, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 79, 1212,
+	1213, 1214, 1215, 86, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 80, 1223, 1224, 1225, 1226,
+	1227, 1228, 753, 1229, 1230, 718, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
+	1241, 676, 1242, 1243, 719, 1244, 1245, 1246, 1247, 676, 1248, 1249, 1250, 1251, 658, 1252,
+	1253, 1254, 1255, 731, 732, 1256, 728, 726, 1257, 1258, 1259, 1260, 734, 1261, 1262, 1263,
+	1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+	1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+	1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+	1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1340,
+	1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+	1359, 1360, 1361, 1362, 1363, 1364, 1360, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+	1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+	1390, 1391, 1392, 1393, 1394, 1359, 1395, 1396, 1397, 1398, 1399, 1263, 1400, 1401, 1402, 1403,
+	1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+	1420, 1421, 1422, 1423, 1424, 1425, 1426, 912, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+	1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+	1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
+	1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
+	1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+	1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+	1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+	1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+	1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+	1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
+	1579, 1580, 1581, 1582, 1583, 1584, 831, 1585, 832, 1586, 833, 1587, 1588, 1589, 178, 1590,
+	857, 1591, 858, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+	1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,
+	1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+	1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 193, 1647, 1648, 806, 1649, 1650,
+	718, 1650, 660, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 807, 1658, 808, 1659, 1660, 1661,
+	1662, 1663, 1664, 1665, 1665, 1666, 1667, 235, 1668, 1669, 809, 1670, 1671, 1672, 1673, 1674,
+	1675, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 811, 1683, 1684, 805, 1685, 1686, 1687,
+	1688, 1689, 1690, 269, 1691, 1692, 812, 1693, 644, 1694, 108, 108, 745, 745, 1303, 1303,
+	382, 743, 1695, 1696, 1697, 1698, 1699, 678, 1700, 1701, 1702, 1703, 1704, 1705, 4267, 1707,
+	1708, 1260, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722,
+	1723, 738, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+	1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+	1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1231, 1763, 1764, 1765, 1766, 1767, 1768,
+	1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+	1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+	1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+	1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+	1849, 1126, 931, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862,
+	1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+	830, 1879, 1880, 1881, 820, 132, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1271,
+	1272, 1273, 1274, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+	1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+	1920, 1921, 1922, 1923, 1924, 1925, 1926, 381, 382, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+	57, 1934, 1935, 45, 899, 1936, 1937, 96, 1938, 1939, 1940, 87, 1941, 1942, 1943, 1944,
+	89, 1945, 1946, 1947, 893, 1948, 1949, 1950, 1951, 1952, 325, 1953, 1954, 1955, 1956, 1957,
+	1958, 1959, 1960, 1955, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972,
+	1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988,
+	1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+	2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020,
+	2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+	2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052,
+	2053, 2054, 2055, 2026, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2061, 2064, 2065, 2066,
+	2067, 2068, 2069, 332, 2070, 2071, 817, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+	2081, 2082, 745, 2083, 2084, 2085, 2086, 2087, 2088, 118, 2089, 2090, 2091, 2092, 2093, 601,
+	2094, 2095, 2096, 93, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+	2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+	2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+	2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+	2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 106, 122, 2167, 2168, 2169, 2170,
+	2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+	2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202,
+	2203, 2204, 2205, 944, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 349, 2215, 2216,
+	2217, 2218, 2219, 2220, 53, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231,
+	2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+	2248, 2249, 2250, 2251, 2252, 1260, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262,
+	2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278,
+	2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+	2295, 2296, 2297, 2298, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309,
+	2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325,
+	2326, 2327, 2328, 2329, 2330, 2331, 2332, 2268, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340,
+	2341, 2342, 2343, 2344, 2345, 2346, 2347, 2217, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355,
+	2356, 2357, 2358, 2314, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 1408, 2212, 2366, 2367, 2368,
+	2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384,
+	2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400,
+	2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416,
+	2417, 2418, 2419, 854, 2420, 2421, 2422, 2423, 836, 2424, 2425, 2426, 2427, 2428, 2429, 2430,
+	2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446,
+	2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462,
+	2457, 2463, 2464, 2460, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2469, 1303, 2473, 2474,
+	2475, 2476, 2477, 693, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 742, 2485, 2486, 1408, 2487,
+	2381, 2488, 2489, 2490, 2412, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2469, 2344,
+	2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2510, 2511,
+	2514, 2515, 1303, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+	2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544,
+	2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 693, 2554, 2555, 2556, 2557, 2558, 2559,
+	2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+	2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591,
+	2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+	2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+	2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639,
+	2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+	2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+	2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687,
+	2688, 2689, 2690, 2662, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
+	2703, 2704, 2668, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717,
+	2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 1303, 2726, 2469, 2727, 2294, 2728, 2729, 2730,
+	2294, 2728, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744,
+	2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760,
+	2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776,
+	2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792,
+	2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808,
+	2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+	2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840,
+	2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856,
+	2857, 2858, 2859, 2859, 2860, 2861, 2861, 2480, 2862, 2863, 2864, 2865, 2866, 2481, 2867, 2868,
+	2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 80, 2879, 2880, 2881, 2882, 2883,
+	2884, 2885, 2886, 2887, 2888, 2889, 2890, 2360, 2891, 2892, 2893, 817, 2894, 2895, 4268, 2897,
+	1705, 2898, 2899, 2900, 2901, 2072, 2902, 2903, 4269, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
+	2912, 2913, 2914, 2915, 2916, 2917, 2212, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926,
+	2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 80, 2941,
+	2942, 2943, 2944, 2881, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+	2957, 2958, 2959, 2960, 2961, 2960, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2253, 2969, 2970,
+	2971, 2211, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 1354, 2981, 2982, 2983, 2984,
+	2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000,
+	3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 4270, 3016,
+	3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032,
+	3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048,
+	3049, 3050, 3051, 3052, 3053, 3054, 3055, 2914, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+	3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079,
+	3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095,
+	3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111,
+	3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 80, 3124, 80, 2917,
+	3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 560,
+	2214, 3124, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153,
+	3154, 3155, 3156, 3157, 89, 3158, 3159, 3160, 3161, 3162, 2241, 3163, 1702, 3164, 3165, 2999,
+	3166, 12, 3167, 3168, 3169, 2910, 3170, 3171, 3172, 2969, 3173, 2253, 2253, 3174, 3175, 1738,
+	3176, 3177, 3177, 3177, 1738, 3178, 3178, 3179, 3180, 1738, 3176, 1738, 3181, 3182, 3183, 3184,
+	3185, 1738, 1738, 1738, 1738, 3177, 3177, 3177, 3177, 3177, 3186, 3187, 3188, 3187, 3188, 3189,
+	381, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+	3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 9, 10, 3213, 3214, 3215, 3216, 3217, 3218,
+	3219, 3220, 3221, 3222, 3223, 3224, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577,
+	3225, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3226, 3227, 3228, 3229, 3230, 3231,
+	3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3244, 3244, 3244,
+	3245, 3245, 3244, 3244, 3246, 3247, 3248, 3247, 3249, 3250, 3251, 3252, 3253, 3253, 3247, 3254,
+	3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 2912, 3268, 3269,
+	3270, 3271, 3272, 3273, 3274, 2221, 53, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 2911, 3282,
+	3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298,
+	3299, 3300, 1836, 3301, 3302, 3303, 3304, 2025, 3305, 3306, 3307, 3308, 2034, 1, 3309, 3310,
+	3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326,
+	3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342,
+	3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358,
+	3359, 3360, 3361, 3100, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373,
+	3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389,
+	3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+	3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421,
+	3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+	3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+	3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469,
+	3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485,
+	3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501,
+	3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517,
+	3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533,
+	3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549,
+	3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565,
+	3566, 3567, 3568, 3307, 3308, 3569, 3570, 3571, 3572, 3573, 3574, 2037, 2039, 3575, 3576, 3577,
+	3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593,
+	3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 89, 89, 3599, 3599, 3602, 3603, 3598, 3598,
+	3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619,
+	3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635,
+	3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 18, 3649, 3650,
+	3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666,
+	3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 1927, 3680, 3681,
+	3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697,
+	3698, 3699, 3700, 3701, 3702, 3703, 1754, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712,
+	3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728,
+	3729, 3730, 560, 2917, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 104, 3741,
+	3742, 2884, 2883, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+	3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3126, 3768, 3769, 3770,
+	3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786,
+	3787, 3788, 3789, 3790, 3791, 3792, 3789, 3793, 3794, 3288, 3289, 3795, 3796, 2211, 2207, 2209,
+	3797, 2201, 825, 3798, 3799, 3800, 150, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809,
+	3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
+	3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 89, 3838, 3839, 3840,
+	3841, 3842, 3843, 3844, 2213, 3845, 3846, 3847, 3846, 2505, 3848, 3849, 3850, 3851, 3852, 3853,
+	3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869,
+	3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885,
+	3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 2120, 3894, 3895, 3896, 3897, 3898, 3899, 3900,
+	3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916,
+	3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932,
+	3933, 3934, 3935, 3936, 3937, 3938, 3939, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947,
+	3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
+	3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979,
+	3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995,
+	3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011,
+	4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027,
+	4028, 1927, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042,
+	4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058,
+	4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 2877, 2878, 4067, 4068, 4069, 4070, 4071, 4072,
+	4073, 4074, 2910, 2911, 4075, 4076, 2910, 4077, 2914, 4078, 4079, 4080, 48, 4081, 4082, 4081,
+	4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4081, 4094, 4095, 4096, 4097,
+	4098, 4099, 2031, 2032, 3666, 3669, 4096, 4097, 3667, 3668, 4109, 4110, 4111, 4112, 4113, 4114,
+	4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 3852, 4124, 4125, 4126, 4127, 795, 4128,
+	4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144,
+	4145, 4146, 4147, 4148, 4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160,
+	4161, 4162, 4163, 4164, 4165, 4166, 4167, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177,
+	4178, 4179, 4180,
+};
+static const uint16_t orpb_chunks[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+	51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+	67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 0, 0,
+	0, 81, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 85,
+};
+static const uint64_t orpb_coverage[] = {
+	0x0000000000000000, 0xffffffff00000001, 0x7fffffffffffffff, 0xffffffff00000000,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x7cffffffffffffff, 0xfffffffbffffd7f0,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xfffe000fffffffff, 0xfffffffefe7fffff, 0xfffffffffffe06ff,
+	0x001f07ffffff00ff, 0xffffffff1fffffff, 0x0001ffffffffffff, 0xc03f0000c00ffcfc,
+	0x0003ffff00f0000f, 0x000000000000ffff, 0x03fc000000000000, 0xffffffff3f3fffff,
+	0x3fffffffaaff3f3f, 0xffdfffffffffffff, 0x7fdcffffefcfffdf, 0xffff00ffffff0000,
+	0xfff300007fffffff, 0x003fffff001f7fff, 0x0001ffffffff0000, 0xffffffffffffffff,
+	0xfffffffffff8ffff, 0xffffffffffff01ff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffff9ffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x000000ffffffffff, 0x0000007fffffffff,
+	0xffffffff000007ff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffecfffff,
+	0xffffffffffffffff, 0x1fffffff1fffffff, 0x000000000000000f, 0xfffffefffffff3de,
+	0xfffffffe7f47afff, 0x7ffeffffff1fffff, 0xffffffffffff17ff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0x0000000000001fff, 0x3ffeffff00000000, 0xffffffff00000000, 0x000000000000007f,
+	0x0000000f00000000, 0x2000000000000000,
+};
+static const uint16_t orpb_ranks[] = {
+	0, 0, 33, 96, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 829,
+	886, 950, 1014, 1078, 1142, 1206, 1257, 1318, 1375, 1415, 1476, 1525, 1551, 1577, 1593, 1601,
+	1661, 1715, 1778, 1834, 1874, 1919, 1961, 1994, 2058, 2119, 2176, 2240, 2304, 2368, 2432, 2496,
+	2558, 2622, 2686, 2726, 2765, 2808, 2872, 2936, 3000, 3064, 3128, 3192, 3253, 3317, 3375, 3379,
+	3438, 3494, 3553, 3613, 3677, 3741, 3805, 3869, 3933, 3997, 4061, 4125, 4189, 4253, 4317, 4381,
+	4445, 4458, 4487, 4519, 4526, 4530,
+};
+static const FBInkFont orpb_font = {
+	.map =
+	    {
+		.chunks      = orpb_chunks,
+		.coverage    = orpb_coverage,
+		.ranks       = orpb_ranks,
+		.chunk_count = 1024U,
+	    },
+	.ids         = orpb_ids,
+	.bitmaps     = orp_bitmaps,
+	.width       = 6U,
+	.height      = 12U,
+	.bitmap_size = 9U,
+};
 
-static const unsigned char orp_block4[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c },	// U+037A (ͺ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+037B (ͻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x05, 0x11, 0x0e, 0x00, 0x00 },	// U+037C (ͼ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x14, 0x11, 0x0e, 0x00, 0x00 },	// U+037D (ͽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x0c, 0x04, 0x02, 0x00 },	// U+037E (;)
-}; // 5
-
-static const unsigned char orp_block5[][12] = {
-	{ 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0384 (΄)
-	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0385 (΅)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0386 (Ά)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0387 (·)
-	{ 0x02, 0x01, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0388 (Έ)
-	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0389 (Ή)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+038A (Ί)
-}; // 7
-
-static const unsigned char orp_block6[][12] = {
-	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+038C (Ό)
-}; // 1
-
-static const unsigned char orp_block7[][12] = {
-	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+038E (Ύ)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+038F (Ώ)
-	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+0390 (ΐ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0391 (Α)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0392 (Β)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0393 (Γ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+0394 (Δ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0395 (Ε)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+0396 (Ζ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0397 (Η)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0398 (Θ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0399 (Ι)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+039A (Κ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+039B (Λ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+039C (Μ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+039D (Ν)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x1f, 0x00, 0x00 },	// U+039E (Ξ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+039F (Ο)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+03A0 (Π)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+03A1 (Ρ)
-}; // 20
-
-static const unsigned char orp_block8[][12] = {
-	{ 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00 },	// U+03A3 (Σ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A4 (Τ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A5 (Υ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+03A6 (Φ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+03A7 (Χ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+03A8 (Ψ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+03A9 (Ω)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+03AA (Ϊ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03AB (Ϋ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+03AC (ά)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+03AD (έ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+03AE (ή)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+03AF (ί)
-	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03B0 (ΰ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+03B1 (α)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0d, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+03B2 (β)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x04 },	// U+03B3 (γ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03B4 (δ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+03B5 (ε)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x02, 0x02, 0x02, 0x0c, 0x10, 0x0c, 0x00 },	// U+03B6 (ζ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+03B7 (η)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x1e, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+03B8 (θ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+03B9 (ι)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+03BA (κ)
-	{ 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+03BB (λ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x17, 0x01, 0x01 },	// U+03BC (μ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+03BD (ν)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x02, 0x0e, 0x01, 0x01, 0x0e, 0x10, 0x08 },	// U+03BE (ξ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03BF (ο)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x2a, 0x12, 0x00, 0x00 },	// U+03C0 (π)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x13, 0x0d, 0x01, 0x01 },	// U+03C1 (ρ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x0e, 0x10, 0x0c },	// U+03C2 (ς)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x09, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03C3 (σ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+03C4 (τ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03C5 (υ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+03C6 (φ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11 },	// U+03C7 (χ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+03C8 (ψ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+03C9 (ω)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+03CA (ϊ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03CB (ϋ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03CC (ό)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03CD (ύ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+03CE (ώ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x0c, 0x08 },	// U+03CF (Ϗ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0d, 0x13, 0x11, 0x0e, 0x00, 0x00 },	// U+03D0 (ϐ)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x3c, 0x10, 0x13, 0x12, 0x0c, 0x00, 0x00 },	// U+03D1 (ϑ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x2a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03D2 (ϒ)
-	{ 0x02, 0x01, 0x00, 0x11, 0x2a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03D3 (ϓ)
-	{ 0x00, 0x1b, 0x00, 0x11, 0x2a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03D4 (ϔ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+03D5 (ϕ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+03D6 (ϖ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x0e, 0x0a, 0x11, 0x10, 0x0c },	// U+03D7 (ϗ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x04 },	// U+03D8 (Ϙ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x04 },	// U+03D9 (ϙ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x01, 0x01, 0x0e, 0x08, 0x00, 0x00 },	// U+03DA (Ϛ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x01, 0x01, 0x01, 0x0e, 0x10, 0x0c },	// U+03DB (ϛ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+03DC (Ϝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x02, 0x0e, 0x02, 0x02, 0x02 },	// U+03DD (ϝ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x1f, 0x10, 0x08, 0x08, 0x00, 0x00 },	// U+03DE (Ϟ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x12, 0x1a, 0x16, 0x12, 0x10, 0x20 },	// U+03DF (ϟ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x0c, 0x12, 0x18, 0x14, 0x10, 0x08, 0x00, 0x00 },	// U+03E0 (Ϡ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x04, 0x08, 0x0c, 0x12, 0x18, 0x14, 0x10, 0x10 },	// U+03E1 (ϡ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1a, 0x10, 0x0f, 0x00 },	// U+03E2 (Ϣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x1a, 0x10, 0x0f, 0x00 },	// U+03E3 (ϣ)
-	{ 0x00, 0x00, 0x00, 0x12, 0x11, 0x11, 0x11, 0x11, 0x19, 0x16, 0x10, 0x10 },	// U+03E4 (Ϥ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10 },	// U+03E5 (ϥ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x10, 0x0e, 0x00 },	// U+03E6 (Ϧ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x36, 0x09, 0x16, 0x10, 0x13, 0x0d, 0x00, 0x00 },	// U+03E7 (ϧ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x08, 0x04, 0x02, 0x11, 0x0e, 0x00 },	// U+03E8 (Ϩ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x08, 0x06, 0x01, 0x1e, 0x00 },	// U+03E9 (ϩ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+03EA (Ϫ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+03EB (ϫ)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x01, 0x07, 0x09, 0x11, 0x0f, 0x00, 0x00 },	// U+03EC (Ϭ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x01, 0x07, 0x09, 0x07, 0x00, 0x00 },	// U+03ED (ϭ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x15, 0x04, 0x04, 0x0c, 0x00, 0x00 },	// U+03EE (Ϯ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+03EF (ϯ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x0e, 0x0a, 0x11, 0x00, 0x00 },	// U+03F0 (ϰ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x1e },	// U+03F1 (ϱ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+03F2 (ϲ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x04 },	// U+03F3 (ϳ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+03F4 (ϴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0e, 0x02, 0x1c, 0x00, 0x00 },	// U+03F5 (ϵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1c, 0x10, 0x0e, 0x00, 0x00 },	// U+03F6 (϶)
-	{ 0x00, 0x00, 0x07, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x02, 0x07, 0x00, 0x00 },	// U+03F7 (Ϸ)
-	{ 0x00, 0x00, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x13, 0x0d, 0x01, 0x00, 0x00 },	// U+03F8 (ϸ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+03F9 (Ϲ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+03FA (Ϻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x01, 0x01 },	// U+03FB (ϻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x0e, 0x02, 0x0f, 0x02 },	// U+03FC (ϼ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+03FD (Ͻ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x05, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+03FE (Ͼ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x14, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+03FF (Ͽ)
-	{ 0x02, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0400 (Ѐ)
-	{ 0x00, 0x0a, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0401 (Ё)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x10, 0x0c },	// U+0402 (Ђ)
-	{ 0x08, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0403 (Ѓ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0f, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0404 (Є)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0405 (Ѕ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0406 (І)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0407 (Ї)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x08, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0408 (Ј)
-	{ 0x00, 0x00, 0x00, 0x06, 0x05, 0x05, 0x0d, 0x15, 0x15, 0x0d, 0x00, 0x00 },	// U+0409 (Љ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0f, 0x15, 0x15, 0x0d, 0x00, 0x00 },	// U+040A (Њ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+040B (Ћ)
-	{ 0x08, 0x04, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+040C (Ќ)
-	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },	// U+040D (Ѝ)
-	{ 0x11, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e, 0x00, 0x00 },	// U+040E (Ў)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x04, 0x04 },	// U+040F (Џ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0410 (А)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0411 (Б)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+0412 (В)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0413 (Г)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x11, 0x00 },	// U+0414 (Д)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+0415 (Е)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+0416 (Ж)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0417 (З)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },	// U+0418 (И)
-	{ 0x11, 0x0e, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },	// U+0419 (Й)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+041A (К)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x00, 0x00 },	// U+041B (Л)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+041C (М)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+041D (Н)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+041E (О)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+041F (П)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0420 (Р)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0421 (С)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0422 (Т)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e, 0x00, 0x00 },	// U+0423 (У)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+0424 (Ф)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+0425 (Х)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x1f, 0x10, 0x10 },	// U+0426 (Ц)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+0427 (Ч)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+0428 (Ш)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x10, 0x10 },	// U+0429 (Щ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+042A (Ъ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x15, 0x15, 0x13, 0x00, 0x00 },	// U+042B (Ы)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+042C (Ь)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x1e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+042D (Э)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x17, 0x15, 0x15, 0x09, 0x00, 0x00 },	// U+042E (Ю)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11, 0x00, 0x00 },	// U+042F (Я)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+0430 (а)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0431 (б)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x0f, 0x11, 0x0f, 0x00, 0x00 },	// U+0432 (в)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0433 (г)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x0a, 0x0a, 0x1f, 0x11, 0x00 },	// U+0434 (д)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0435 (е)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x00, 0x00 },	// U+0436 (ж)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0c, 0x11, 0x0e, 0x00, 0x00 },	// U+0437 (з)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+0438 (и)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+0439 (й)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+043A (к)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x11, 0x00, 0x00 },	// U+043B (л)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x00, 0x00 },	// U+043C (м)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+043D (н)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+043E (о)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+043F (п)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+0440 (р)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0441 (с)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0442 (т)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+0443 (у)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+0444 (ф)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+0445 (х)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x1f, 0x10, 0x10 },	// U+0446 (ц)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x00, 0x00 },	// U+0447 (ч)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+0448 (ш)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x10, 0x10 },	// U+0449 (щ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x0e, 0x12, 0x0e, 0x00, 0x00 },	// U+044A (ъ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x13, 0x15, 0x13, 0x00, 0x00 },	// U+044B (ы)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x12, 0x0e, 0x00, 0x00 },	// U+044C (ь)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1c, 0x10, 0x0e, 0x00, 0x00 },	// U+044D (э)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x17, 0x15, 0x09, 0x00, 0x00 },	// U+044E (ю)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x1c, 0x14, 0x12, 0x00, 0x00 },	// U+044F (я)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0450 (ѐ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0451 (ё)
-	{ 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x10, 0x08 },	// U+0452 (ђ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0453 (ѓ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0e, 0x02, 0x1c, 0x00, 0x00 },	// U+0454 (є)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+0455 (ѕ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0456 (і)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0457 (ї)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x10, 0x10, 0x10, 0x12, 0x0c },	// U+0458 (ј)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x0d, 0x15, 0x0d, 0x00, 0x00 },	// U+0459 (љ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0f, 0x15, 0x0d, 0x00, 0x00 },	// U+045A (њ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+045B (ћ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+045C (ќ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+045D (ѝ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x0e },	// U+045E (ў)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x04, 0x04 },	// U+045F (џ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0460 (Ѡ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+0461 (ѡ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0f, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+0462 (Ѣ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x0e, 0x12, 0x0e, 0x00, 0x00 },	// U+0463 (ѣ)
-	{ 0x00, 0x00, 0x00, 0x19, 0x05, 0x05, 0x1f, 0x05, 0x05, 0x19, 0x00, 0x00 },	// U+0464 (Ѥ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x05, 0x1f, 0x05, 0x19, 0x00, 0x00 },	// U+0465 (ѥ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x15, 0x15, 0x00, 0x00 },	// U+0466 (Ѧ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x15, 0x00, 0x00 },	// U+0467 (ѧ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x1d, 0x1f, 0x1d, 0x1d, 0x1d, 0x00, 0x00 },	// U+0468 (Ѩ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x1f, 0x1d, 0x1d, 0x00, 0x00 },	// U+0469 (ѩ)
-	{ 0x00, 0x00, 0x1f, 0x11, 0x0a, 0x0a, 0x0e, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+046A (Ѫ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x0a, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+046B (ѫ)
-	{ 0x00, 0x00, 0x3f, 0x23, 0x15, 0x09, 0x1f, 0x1d, 0x1d, 0x15, 0x00, 0x00 },	// U+046C (Ѭ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x15, 0x09, 0x1f, 0x1d, 0x15, 0x00, 0x00 },	// U+046D (ѭ)
-	{ 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x10, 0x0c, 0x10, 0x10, 0x0e, 0x01, 0x0e },	// U+046E (Ѯ)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x11, 0x0c, 0x10, 0x0e, 0x01, 0x0e },	// U+046F (ѯ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0470 (Ѱ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+0471 (ѱ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0472 (Ѳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+0473 (ѳ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0474 (Ѵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0475 (ѵ)
-	{ 0x09, 0x12, 0x00, 0x11, 0x09, 0x09, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0476 (Ѷ)
-	{ 0x00, 0x00, 0x09, 0x12, 0x00, 0x11, 0x09, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+0477 (ѷ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x1d, 0x1d, 0x1d, 0x1a, 0x10, 0x08 },	// U+0478 (Ѹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1d, 0x1d, 0x1d, 0x1a, 0x10, 0x08 },	// U+0479 (ѹ)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x11, 0x11, 0x11, 0x11, 0x15, 0x0e, 0x04, 0x00 },	// U+047A (Ѻ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x11, 0x11, 0x15, 0x0e, 0x04, 0x00 },	// U+047B (ѻ)
-	{ 0x00, 0x0e, 0x00, 0x04, 0x04, 0x11, 0x11, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+047C (Ѽ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x15, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+047D (ѽ)
-	{ 0x1f, 0x15, 0x00, 0x0a, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+047E (Ѿ)
-	{ 0x00, 0x00, 0x1f, 0x15, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+047F (ѿ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x08, 0x08 },	// U+0480 (Ҁ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x0e, 0x08, 0x08, 0x00 },	// U+0481 (ҁ)
-	{ 0x00, 0x00, 0x00, 0x14, 0x08, 0x0d, 0x12, 0x02, 0x05, 0x00, 0x00, 0x00 },	// U+0482 (҂)
-	{ 0x20, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0483 (҃)
-	{ 0x0e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0484 (҄)
-	{ 0x0e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0485 (҅)
-	{ 0x0e, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0486 (҆)
-	{ 0x06, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0487 (҇)
-	{ 0x02, 0x05, 0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x10, 0x28 },	// U+0488 (҈)
-	{ 0x02, 0x21, 0x13, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x13, 0x30 },	// U+0489 (҉)
-	{ 0x11, 0x0e, 0x00, 0x11, 0x19, 0x19, 0x15, 0x13, 0x13, 0x11, 0x08, 0x08 },	// U+048A (Ҋ)
-	{ 0x00, 0x11, 0x0e, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x08, 0x08 },	// U+048B (ҋ)
-	{ 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+048C (Ҍ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x0e, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+048D (ҍ)
-	{ 0x00, 0x00, 0x0f, 0x11, 0x11, 0x15, 0x0f, 0x11, 0x01, 0x01, 0x00, 0x00 },	// U+048E (Ҏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x15, 0x0f, 0x11, 0x01, 0x01 },	// U+048F (ҏ)
-	{ 0x00, 0x10, 0x10, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0490 (Ґ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0491 (ґ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+0492 (Ғ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x0f, 0x02, 0x02, 0x00, 0x00 },	// U+0493 (ғ)
-	{ 0x00, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x08, 0x00 },	// U+0494 (Ҕ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x08, 0x00 },	// U+0495 (ҕ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x15, 0x15, 0x35, 0x20, 0x20 },	// U+0496 (Җ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0e, 0x04, 0x0e, 0x35, 0x20, 0x20 },	// U+0497 (җ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x10, 0x08, 0x10, 0x10, 0x11, 0x0e, 0x04, 0x02 },	// U+0498 (Ҙ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x08, 0x10, 0x11, 0x0e, 0x04, 0x02 },	// U+0499 (ҙ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x20, 0x20 },	// U+049A (Қ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x05, 0x09, 0x10, 0x10 },	// U+049B (қ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x0d, 0x05, 0x03, 0x05, 0x0d, 0x15, 0x00, 0x00 },	// U+049C (Ҝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0d, 0x07, 0x0d, 0x15, 0x00, 0x00 },	// U+049D (ҝ)
-	{ 0x00, 0x00, 0x00, 0x12, 0x17, 0x0a, 0x06, 0x0a, 0x12, 0x12, 0x00, 0x00 },	// U+049E (Ҟ)
-	{ 0x00, 0x00, 0x02, 0x02, 0x07, 0x12, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+049F (ҟ)
-	{ 0x00, 0x00, 0x13, 0x12, 0x0a, 0x06, 0x06, 0x0a, 0x12, 0x12, 0x00, 0x00 },	// U+04A0 (Ҡ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0a, 0x06, 0x0a, 0x12, 0x00, 0x00 },	// U+04A1 (ҡ)
-	{ 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x19, 0x10, 0x10 },	// U+04A2 (Ң)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x0f, 0x09, 0x19, 0x10, 0x10 },	// U+04A3 (ң)
-	{ 0x00, 0x00, 0x1d, 0x05, 0x05, 0x07, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+04A4 (Ҥ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x05, 0x07, 0x05, 0x05, 0x00, 0x00 },	// U+04A5 (ҥ)
-	{ 0x00, 0x00, 0x07, 0x05, 0x05, 0x0d, 0x15, 0x15, 0x15, 0x15, 0x10, 0x08 },	// U+04A6 (Ҧ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x0d, 0x15, 0x15, 0x10, 0x08 },	// U+04A7 (ҧ)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x09, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x18, 0x00 },	// U+04A8 (Ҩ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x09, 0x15, 0x0e, 0x04, 0x18, 0x00 },	// U+04A9 (ҩ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x04, 0x08 },	// U+04AA (Ҫ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x04, 0x08 },	// U+04AB (ҫ)
-	{ 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x08, 0x08 },	// U+04AC (Ҭ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x04, 0x04, 0x0c, 0x08, 0x08 },	// U+04AD (ҭ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+04AE (Ү)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04 },	// U+04AF (ү)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+04B0 (Ұ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x1f, 0x04, 0x04, 0x04 },	// U+04B1 (ұ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x20, 0x20 },	// U+04B2 (Ҳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x20, 0x20 },	// U+04B3 (ҳ)
-	{ 0x00, 0x00, 0x17, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1e, 0x10, 0x10 },	// U+04B4 (Ҵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x17, 0x12, 0x12, 0x12, 0x12, 0x1e, 0x10, 0x10 },	// U+04B5 (ҵ)
-	{ 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x18, 0x10, 0x10 },	// U+04B6 (Ҷ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x18, 0x10, 0x10 },	// U+04B7 (ҷ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x1e, 0x14, 0x14, 0x10, 0x00, 0x00 },	// U+04B8 (Ҹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x1e, 0x14, 0x10, 0x00, 0x00 },	// U+04B9 (ҹ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+04BA (Һ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0e, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+04BB (һ)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x1f, 0x02, 0x12, 0x0c, 0x00, 0x00 },	// U+04BC (Ҽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1f, 0x02, 0x12, 0x0c, 0x00, 0x00 },	// U+04BD (ҽ)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x1f, 0x02, 0x12, 0x0c, 0x04, 0x08 },	// U+04BE (Ҿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1f, 0x02, 0x12, 0x0c, 0x04, 0x08 },	// U+04BF (ҿ)
-	{ 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+04C0 (Ӏ)
-	{ 0x11, 0x0e, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+04C1 (Ӂ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x00, 0x00 },	// U+04C2 (ӂ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x10, 0x0c },	// U+04C3 (Ӄ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x05, 0x09, 0x08, 0x06 },	// U+04C4 (ӄ)
-	{ 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x08, 0x08 },	// U+04C5 (Ӆ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x11, 0x08, 0x08 },	// U+04C6 (ӆ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0c },	// U+04C7 (Ӈ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x10, 0x0c },	// U+04C8 (ӈ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x08, 0x08 },	// U+04C9 (Ӊ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x08, 0x08 },	// U+04CA (ӊ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x18, 0x08, 0x08 },	// U+04CB (Ӌ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x18, 0x08, 0x08 },	// U+04CC (ӌ)
-	{ 0x00, 0x00, 0x11, 0x1b, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, 0x08, 0x08 },	// U+04CD (Ӎ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x08, 0x08 },	// U+04CE (ӎ)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+04CF (ӏ)
-	{ 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+04D0 (Ӑ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+04D1 (ӑ)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+04D2 (Ӓ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x00 },	// U+04D3 (ӓ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x0f, 0x05, 0x05, 0x1d, 0x00, 0x00 },	// U+04D4 (Ӕ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x14, 0x0e, 0x15, 0x0e, 0x00, 0x00 },	// U+04D5 (ӕ)
-	{ 0x00, 0x11, 0x0e, 0x00, 0x1f, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+04D6 (Ӗ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+04D7 (ӗ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04D8 (Ә)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+04D9 (ә)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x10, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04DA (Ӛ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+04DB (ӛ)
-	{ 0x00, 0x0a, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+04DC (Ӝ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x00, 0x00 },	// U+04DD (ӝ)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x10, 0x0c, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+04DE (Ӟ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x0c, 0x11, 0x0e, 0x00, 0x00 },	// U+04DF (ӟ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+04E0 (Ӡ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e },	// U+04E1 (ӡ)
-	{ 0x00, 0x1f, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },	// U+04E2 (Ӣ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+04E3 (ӣ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, 0x00, 0x00 },	// U+04E4 (Ӥ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x19, 0x15, 0x13, 0x11, 0x00, 0x00 },	// U+04E5 (ӥ)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04E6 (Ӧ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04E7 (ӧ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04E8 (Ө)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+04E9 (ө)
-	{ 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+04EA (Ӫ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+04EB (ӫ)
-	{ 0x00, 0x0a, 0x00, 0x07, 0x08, 0x10, 0x1e, 0x10, 0x08, 0x07, 0x00, 0x00 },	// U+04EC (Ӭ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0e, 0x10, 0x1c, 0x10, 0x0e, 0x00, 0x00 },	// U+04ED (ӭ)
-	{ 0x00, 0x1f, 0x00, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+04EE (Ӯ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x11, 0x0e },	// U+04EF (ӯ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+04F0 (Ӱ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x11, 0x0e },	// U+04F1 (ӱ)
-	{ 0x12, 0x09, 0x00, 0x11, 0x11, 0x19, 0x16, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+04F2 (Ӳ)
-	{ 0x00, 0x00, 0x12, 0x09, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x11, 0x0e },	// U+04F3 (ӳ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+04F4 (Ӵ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x00, 0x00 },	// U+04F5 (ӵ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x00 },	// U+04F6 (Ӷ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x02, 0x02, 0x06, 0x04, 0x00 },	// U+04F7 (ӷ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x13, 0x15, 0x15, 0x13, 0x00, 0x00 },	// U+04F8 (Ӹ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x13, 0x15, 0x13, 0x00, 0x00 },	// U+04F9 (ӹ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x02, 0x02, 0x07, 0x02, 0x02, 0x06, 0x04, 0x02 },	// U+04FA (Ӻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x07, 0x02, 0x06, 0x04, 0x02 },	// U+04FB (ӻ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x10, 0x08 },	// U+04FC (Ӽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x10, 0x08 },	// U+04FD (ӽ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+04FE (Ӿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x00, 0x00 },	// U+04FF (ӿ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+0500 (Ԁ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1c, 0x12, 0x12, 0x12, 0x1c, 0x00, 0x00 },	// U+0501 (ԁ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x06, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+0502 (Ԃ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x06, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+0503 (ԃ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x03, 0x14, 0x14, 0x08, 0x00, 0x00 },	// U+0504 (Ԅ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x12, 0x14, 0x08, 0x00, 0x00 },	// U+0505 (ԅ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x0c, 0x08, 0x08 },	// U+0506 (Ԇ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x02, 0x04, 0x0c, 0x08, 0x08 },	// U+0507 (ԇ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x05, 0x05, 0x15, 0x15, 0x15, 0x09, 0x00, 0x00 },	// U+0508 (Ԉ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x05, 0x05, 0x15, 0x09, 0x00, 0x00 },	// U+0509 (ԉ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x17, 0x15, 0x15, 0x09, 0x00, 0x00 },	// U+050A (Ԋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x17, 0x15, 0x09, 0x00, 0x00 },	// U+050B (ԋ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x19, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+050C (Ԍ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x19, 0x11, 0x0e, 0x00, 0x00 },	// U+050D (ԍ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00 },	// U+050E (Ԏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+050F (ԏ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+0510 (Ԑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+0511 (ԑ)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x12, 0x12, 0x12, 0x12, 0x15, 0x08, 0x00, 0x00 },	// U+0512 (Ԓ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x12, 0x12, 0x12, 0x11, 0x08, 0x00 },	// U+0513 (ԓ)
-	{ 0x00, 0x00, 0x00, 0x2b, 0x2a, 0x2a, 0x12, 0x2a, 0x2a, 0x29, 0x00, 0x00 },	// U+0514 (Ԕ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2a, 0x12, 0x2a, 0x29, 0x00, 0x00 },	// U+0515 (ԕ)
-	{ 0x00, 0x00, 0x00, 0x13, 0x15, 0x0d, 0x0b, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0516 (Ԗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0d, 0x05, 0x0b, 0x11, 0x01, 0x00 },	// U+0517 (ԗ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x0e, 0x05, 0x05, 0x1d, 0x00, 0x00 },	// U+0518 (Ԙ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x0e, 0x05, 0x19, 0x00, 0x00 },	// U+0519 (ԙ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00, 0x00 },	// U+051A (Ԛ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10 },	// U+051B (ԛ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+051C (Ԝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+051D (ԝ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x09, 0x15, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+051E (Ԟ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x09, 0x17, 0x09, 0x11, 0x00, 0x00 },	// U+051F (ԟ)
-	{ 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x0a, 0x1a, 0x2a, 0x2a, 0x29, 0x20, 0x10 },	// U+0520 (Ԡ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x1a, 0x2a, 0x29, 0x20, 0x00 },	// U+0521 (ԡ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x0f, 0x15, 0x15, 0x15, 0x10, 0x08 },	// U+0522 (Ԣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x0f, 0x15, 0x15, 0x10, 0x08 },	// U+0523 (ԣ)
-}; // 385
-
-static const unsigned char orp_block9[][12] = {
-	{ 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x12, 0x00, 0x00 },	// U+0531 (Ա)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x01, 0x01, 0x0f, 0x11, 0x01, 0x00, 0x00 },	// U+0532 (Բ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x05, 0x0e, 0x14, 0x04, 0x04, 0x00, 0x00 },	// U+0533 (Գ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x00, 0x00 },	// U+0534 (Դ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x01, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0535 (Ե)
-	{ 0x00, 0x00, 0x06, 0x09, 0x09, 0x0e, 0x08, 0x05, 0x0f, 0x11, 0x00, 0x00 },	// U+0536 (Զ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x01, 0x01, 0x01, 0x0e, 0x10, 0x08 },	// U+0537 (Է)
-	{ 0x00, 0x00, 0x06, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x10, 0x00 },	// U+0538 (Ը)
-	{ 0x00, 0x00, 0x06, 0x09, 0x1d, 0x0b, 0x0b, 0x05, 0x01, 0x01, 0x00, 0x00 },	// U+0539 (Թ)
-	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x1e, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+053A (Ժ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x01, 0x01, 0x00, 0x00 },	// U+053B (Ի)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x10, 0x08 },	// U+053C (Լ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x17, 0x15, 0x15, 0x09, 0x01, 0x01, 0x00, 0x00 },	// U+053D (Խ)
-	{ 0x00, 0x00, 0x1f, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+053E (Ծ)
-	{ 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x00, 0x00 },	// U+053F (Կ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x08, 0x04, 0x02, 0x01, 0x03, 0x0c, 0x10, 0x00 },	// U+0540 (Հ)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x12, 0x1c, 0x10, 0x0e, 0x09, 0x16, 0x00, 0x00 },	// U+0541 (Ձ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x10, 0x00 },	// U+0542 (Ղ)
-	{ 0x00, 0x00, 0x08, 0x0a, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+0543 (Ճ)
-	{ 0x00, 0x00, 0x1d, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x00, 0x00 },	// U+0544 (Մ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x15, 0x0c, 0x14, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0545 (Յ)
-	{ 0x00, 0x00, 0x02, 0x01, 0x03, 0x02, 0x02, 0x02, 0x12, 0x0c, 0x00, 0x00 },	// U+0546 (Ն)
-	{ 0x00, 0x00, 0x10, 0x0f, 0x02, 0x01, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0547 (Շ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0548 (Ո)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1e, 0x08, 0x04, 0x1f, 0x00, 0x00 },	// U+0549 (Չ)
-	{ 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x14, 0x14, 0x10, 0x10, 0x00, 0x00 },	// U+054A (Պ)
-	{ 0x00, 0x00, 0x06, 0x09, 0x09, 0x0a, 0x0c, 0x05, 0x0f, 0x11, 0x00, 0x00 },	// U+054B (Ջ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x0d, 0x15, 0x15, 0x05, 0x05, 0x00, 0x00 },	// U+054C (Ռ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+054D (Ս)
-	{ 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x04, 0x0c, 0x10, 0x00 },	// U+054E (Վ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+054F (Տ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0550 (Ր)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+0551 (Ց)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x09, 0x09, 0x11, 0x01, 0x00, 0x00 },	// U+0552 (Ւ)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+0553 (Փ)
-	{ 0x00, 0x00, 0x08, 0x14, 0x14, 0x0c, 0x05, 0x0e, 0x14, 0x04, 0x00, 0x00 },	// U+0554 (Ք)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0555 (Օ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x05, 0x0e, 0x14, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+0556 (Ֆ)
-}; // 38
-
-static const unsigned char orp_block10[][12] = {
-	{ 0x04, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0559 (ՙ)
-	{ 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055A (՚)
-	{ 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055B (՛)
-	{ 0x10, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055C (՜)
-	{ 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055D (՝)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x15, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055E (՞)
-	{ 0x00, 0x03, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+055F (՟)
-}; // 7
-
-static const unsigned char orp_block11[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x15, 0x1a, 0x00, 0x00 },	// U+0561 (ա)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x01, 0x1f, 0x01, 0x01 },	// U+0562 (բ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x1e, 0x08, 0x08 },	// U+0563 (գ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x09, 0x09, 0x19, 0x08, 0x08 },	// U+0564 (դ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x01, 0x11, 0x13, 0x0d, 0x00, 0x00 },	// U+0565 (ե)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x18 },	// U+0566 (զ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x01, 0x01, 0x01, 0x0e, 0x10, 0x00 },	// U+0567 (է)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x01, 0x1f },	// U+0568 (ը)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x09, 0x1d, 0x0b, 0x05, 0x01 },	// U+0569 (թ)
-	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x1e, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+056A (ժ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x0b, 0x09, 0x09, 0x09, 0x01, 0x01 },	// U+056B (ի)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0c },	// U+056C (լ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x17, 0x15, 0x15, 0x15, 0x09, 0x01, 0x01 },	// U+056D (խ)
-	{ 0x00, 0x00, 0x01, 0x02, 0x04, 0x1e, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+056E (ծ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x10, 0x10 },	// U+056F (կ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0570 (հ)
-	{ 0x00, 0x00, 0x04, 0x02, 0x04, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+0571 (ձ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x09, 0x09, 0x09, 0x08, 0x18 },	// U+0572 (ղ)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x02, 0x1f, 0x12, 0x12, 0x1a, 0x14, 0x00, 0x00 },	// U+0573 (ճ)
-	{ 0x00, 0x00, 0x10, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+0574 (մ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x11, 0x11, 0x0e },	// U+0575 (յ)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x19, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+0576 (ն)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x10, 0x08, 0x04, 0x02, 0x1c },	// U+0577 (շ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+0578 (ո)
-	{ 0x00, 0x00, 0x04, 0x02, 0x04, 0x04, 0x02, 0x02, 0x01, 0x1f, 0x00, 0x00 },	// U+0579 (չ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x15, 0x15, 0x15, 0x1a, 0x10, 0x10 },	// U+057A (պ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x1c },	// U+057B (ջ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x09, 0x09, 0x19, 0x00, 0x00 },	// U+057C (ռ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x19, 0x16, 0x00, 0x00 },	// U+057D (ս)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x18 },	// U+057E (վ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x15, 0x15, 0x15, 0x16, 0x00, 0x00 },	// U+057F (տ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x01, 0x01 },	// U+0580 (ր)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1e, 0x10, 0x11, 0x0e },	// U+0581 (ց)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x00, 0x00 },	// U+0582 (ւ)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x0d, 0x15, 0x15, 0x15, 0x16, 0x04, 0x04 },	// U+0583 (փ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x0e, 0x02, 0x1f, 0x02 },	// U+0584 (ք)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0585 (օ)
-	{ 0x00, 0x00, 0x06, 0x05, 0x05, 0x0e, 0x14, 0x14, 0x15, 0x0e, 0x04, 0x04 },	// U+0586 (ֆ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+0587 (և)
-}; // 39
-
-static const unsigned char orp_block12[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+0589 (։)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+058A (֊)
-}; // 2
-
-static const unsigned char orp_block13[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a },	// U+0591 (֑)
-	{ 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0592 (֒)
-	{ 0x08, 0x04, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0593 (֓)
-	{ 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0594 (֔)
-	{ 0x00, 0x0a, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0595 (֕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08 },	// U+0596 (֖)
-	{ 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0597 (֗)
-	{ 0x00, 0x12, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0598 (֘)
-	{ 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0599 (֙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x20 },	// U+059A (֚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08 },	// U+059B (֛)
-	{ 0x00, 0x18, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+059C (֜)
-	{ 0x00, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+059D (֝)
-	{ 0x08, 0x24, 0x14, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+059E (֞)
-	{ 0x00, 0x0a, 0x15, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+059F (֟)
-	{ 0x00, 0x08, 0x14, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05A0 (֠)
-	{ 0x00, 0x0a, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05A1 (֡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04 },	// U+05A2 (֢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e },	// U+05A3 (֣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x04 },	// U+05A4 (֤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04 },	// U+05A5 (֥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09 },	// U+05A6 (֦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x08, 0x04 },	// U+05A7 (֧)
-	{ 0x00, 0x02, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05A8 (֨)
-	{ 0x00, 0x02, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05A9 (֩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04 },	// U+05AA (֪)
-	{ 0x00, 0x04, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05AB (֫)
-	{ 0x00, 0x08, 0x08, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05AC (֬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20 },	// U+05AD (֭)
-	{ 0x08, 0x0a, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05AE (֮)
-	{ 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05AF (֯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04 },	// U+05B0 (ְ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x12 },	// U+05B1 (ֱ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x10 },	// U+05B2 (ֲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x12 },	// U+05B3 (ֳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+05B4 (ִ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a },	// U+05B5 (ֵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x04 },	// U+05B6 (ֶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e },	// U+05B7 (ַ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04 },	// U+05B8 (ָ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05B9 (ֹ)
-	{ 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BA (ֺ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x10 },	// U+05BB (ֻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BC (ּ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04 },	// U+05BD (ֽ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BE (־)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05BF (ֿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+05C0 (׀)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05C1 (ׁ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05C2 (ׂ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00 },	// U+05C3 (׃)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05C4 (ׄ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06 },	// U+05C5 (ׅ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x00 },	// U+05C6 (׆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04 },	// U+05C7 (ׇ)
-}; // 55
-
-static const unsigned char orp_block14[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x16, 0x09, 0x13, 0x00, 0x00 },	// U+05D0 (א)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x1f, 0x00, 0x00 },	// U+05D1 (ב)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x14, 0x12, 0x00, 0x00 },	// U+05D2 (ג)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+05D3 (ד)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x11, 0x11, 0x00, 0x00 },	// U+05D4 (ה)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+05D5 (ו)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+05D6 (ז)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+05D7 (ח)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x15, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+05D8 (ט)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+05D9 (י)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },	// U+05DA (ך)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x00 },	// U+05DB (כ)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x10, 0x10, 0x08, 0x06, 0x00, 0x00 },	// U+05DC (ל)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x12, 0x1e, 0x00, 0x00 },	// U+05DD (ם)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x12, 0x11, 0x1d, 0x00, 0x00 },	// U+05DE (מ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+05DF (ן)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10, 0x1e, 0x00, 0x00 },	// U+05E0 (נ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x0a, 0x06, 0x00, 0x00 },	// U+05E1 (ס)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x0a, 0x07, 0x00, 0x00 },	// U+05E2 (ע)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x10, 0x10, 0x10, 0x10 },	// U+05E3 (ף)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x10, 0x0f, 0x00, 0x00 },	// U+05E4 (פ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x12, 0x0a, 0x06, 0x02, 0x02 },	// U+05E5 (ץ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x14, 0x08, 0x1f, 0x00, 0x00 },	// U+05E6 (צ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x11, 0x11, 0x0d, 0x01, 0x01 },	// U+05E7 (ק)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+05E8 (ר)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x17, 0x11, 0x0f, 0x00, 0x00 },	// U+05E9 (ש)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x12, 0x12, 0x13, 0x00, 0x00 },	// U+05EA (ת)
-}; // 27
-
-static const unsigned char orp_block15[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+05F0 (װ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x10, 0x10, 0x00, 0x00 },	// U+05F1 (ױ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+05F2 (ײ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F3 (׳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+05F4 (״)
-}; // 5
-
-static const unsigned char orp_block16[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1680 ( )
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+1681 (ᚁ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x14, 0x14, 0x14, 0x00, 0x00 },	// U+1682 (ᚂ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1c, 0x1c, 0x1c, 0x00, 0x00 },	// U+1683 (ᚃ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1e, 0x1e, 0x1e, 0x00, 0x00 },	// U+1684 (ᚄ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+1685 (ᚅ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1686 (ᚆ)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1687 (ᚇ)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1688 (ᚈ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1689 (ᚉ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+168A (ᚊ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x3f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+168B (ᚋ)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x3f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+168C (ᚌ)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x3f, 0x0e, 0x0e, 0x0e, 0x00, 0x00 },	// U+168D (ᚍ)
-	{ 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3f, 0x1e, 0x1e, 0x1e, 0x00, 0x00 },	// U+168E (ᚎ)
-	{ 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+168F (ᚏ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+1690 (ᚐ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3f, 0x14, 0x00, 0x00, 0x00, 0x00 },	// U+1691 (ᚑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3f, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+1692 (ᚒ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+1693 (ᚓ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+1694 (ᚔ)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x08, 0x3f, 0x08, 0x14, 0x14, 0x00, 0x00 },	// U+1695 (ᚕ)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x3f, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+1696 (ᚖ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x02, 0x1a, 0x12, 0x1e, 0x00 },	// U+1697 (ᚗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1b, 0x0e, 0x1b, 0x00, 0x00 },	// U+1698 (ᚘ)
-	{ 0x00, 0x14, 0x3e, 0x14, 0x3e, 0x14, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1699 (ᚙ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x1e, 0x00, 0x00, 0x00 },	// U+169A (ᚚ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x38, 0x04, 0x02, 0x01, 0x00, 0x00 },	// U+169B (᚛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x0f, 0x10, 0x20, 0x00, 0x00, 0x00 },	// U+169C (᚜)
-}; // 29
-
-static const unsigned char orp_block17[][12] = {
-	{ 0x00, 0x12, 0x0a, 0x06, 0x12, 0x0a, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+16A0 (ᚠ)
-	{ 0x08, 0x02, 0x12, 0x0a, 0x06, 0x12, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+16A1 (ᚡ)
-	{ 0x00, 0x01, 0x03, 0x05, 0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16A2 (ᚢ)
-	{ 0x00, 0x01, 0x03, 0x05, 0x09, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+16A3 (ᚣ)
-	{ 0x00, 0x01, 0x03, 0x05, 0x09, 0x11, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16A4 (ᚤ)
-	{ 0x00, 0x01, 0x03, 0x05, 0x09, 0x13, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+16A5 (ᚥ)
-	{ 0x00, 0x02, 0x02, 0x06, 0x0a, 0x12, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+16A6 (ᚦ)
-	{ 0x00, 0x02, 0x02, 0x06, 0x0a, 0x16, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+16A7 (ᚧ)
-	{ 0x00, 0x02, 0x06, 0x0a, 0x12, 0x06, 0x0a, 0x12, 0x02, 0x02, 0x00, 0x00 },	// U+16A8 (ᚨ)
-	{ 0x00, 0x13, 0x0d, 0x01, 0x13, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+16A9 (ᚩ)
-	{ 0x00, 0x11, 0x0b, 0x05, 0x01, 0x03, 0x0d, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+16AA (ᚪ)
-	{ 0x00, 0x02, 0x06, 0x0a, 0x12, 0x06, 0x0a, 0x12, 0x02, 0x02, 0x00, 0x00 },	// U+16AB (ᚫ)
-	{ 0x00, 0x04, 0x05, 0x06, 0x0c, 0x15, 0x06, 0x0c, 0x14, 0x04, 0x00, 0x00 },	// U+16AC (ᚬ)
-	{ 0x00, 0x02, 0x02, 0x02, 0x06, 0x0a, 0x02, 0x06, 0x0a, 0x02, 0x00, 0x00 },	// U+16AD (ᚭ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x06, 0x05, 0x04, 0x06, 0x05, 0x04, 0x00, 0x00 },	// U+16AE (ᚮ)
-	{ 0x00, 0x04, 0x14, 0x0c, 0x06, 0x15, 0x0c, 0x06, 0x05, 0x04, 0x00, 0x00 },	// U+16AF (ᚯ)
-	{ 0x00, 0x04, 0x14, 0x0c, 0x06, 0x05, 0x04, 0x06, 0x05, 0x04, 0x00, 0x00 },	// U+16B0 (ᚰ)
-	{ 0x00, 0x03, 0x0d, 0x11, 0x0d, 0x03, 0x05, 0x09, 0x11, 0x01, 0x00, 0x00 },	// U+16B1 (ᚱ)
-	{ 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00 },	// U+16B2 (ᚲ)
-	{ 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+16B3 (ᚳ)
-	{ 0x00, 0x11, 0x09, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+16B4 (ᚴ)
-	{ 0x04, 0x11, 0x09, 0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+16B5 (ᚵ)
-	{ 0x00, 0x22, 0x12, 0x0a, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+16B6 (ᚶ)
-	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+16B7 (ᚷ)
-	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x15, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+16B8 (ᚸ)
-	{ 0x00, 0x03, 0x0d, 0x11, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+16B9 (ᚹ)
-	{ 0x00, 0x11, 0x11, 0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16BA (ᚺ)
-	{ 0x00, 0x11, 0x11, 0x13, 0x15, 0x1b, 0x15, 0x19, 0x11, 0x11, 0x00, 0x00 },	// U+16BB (ᚻ)
-	{ 0x00, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00 },	// U+16BC (ᚼ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16BD (ᚽ)
-	{ 0x00, 0x04, 0x04, 0x05, 0x06, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x00, 0x00 },	// U+16BE (ᚾ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16BF (ᚿ)
-	{ 0x00, 0x04, 0x04, 0x05, 0x0e, 0x0e, 0x0e, 0x14, 0x04, 0x04, 0x00, 0x00 },	// U+16C0 (ᛀ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16C1 (ᛁ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16C2 (ᛂ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x09, 0x12, 0x08, 0x04, 0x00, 0x00 },	// U+16C3 (ᛃ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16C4 (ᛄ)
-	{ 0x00, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x06, 0x05, 0x04, 0x04, 0x00, 0x00 },	// U+16C5 (ᛅ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x04, 0x04, 0x00, 0x00 },	// U+16C6 (ᛆ)
-	{ 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00 },	// U+16C7 (ᛇ)
-	{ 0x00, 0x11, 0x0b, 0x05, 0x01, 0x01, 0x01, 0x05, 0x0b, 0x11, 0x00, 0x00 },	// U+16C8 (ᛈ)
-	{ 0x00, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16C9 (ᛉ)
-	{ 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00 },	// U+16CA (ᛊ)
-	{ 0x00, 0x01, 0x01, 0x11, 0x19, 0x15, 0x13, 0x11, 0x10, 0x10, 0x00, 0x00 },	// U+16CB (ᛋ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+16CC (ᛌ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+16CD (ᛍ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+16CE (ᛎ)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16CF (ᛏ)
-	{ 0x00, 0x08, 0x0c, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+16D0 (ᛐ)
-	{ 0x00, 0x08, 0x0c, 0x0a, 0x08, 0x08, 0x1c, 0x1c, 0x08, 0x08, 0x00, 0x00 },	// U+16D1 (ᛑ)
-	{ 0x00, 0x03, 0x05, 0x09, 0x05, 0x03, 0x05, 0x09, 0x05, 0x03, 0x00, 0x00 },	// U+16D2 (ᛒ)
-	{ 0x00, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x14, 0x0c, 0x04, 0x04, 0x00, 0x00 },	// U+16D3 (ᛓ)
-	{ 0x00, 0x0f, 0x11, 0x15, 0x11, 0x0f, 0x11, 0x15, 0x11, 0x0f, 0x00, 0x00 },	// U+16D4 (ᛔ)
-	{ 0x00, 0x11, 0x09, 0x05, 0x03, 0x01, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+16D5 (ᛕ)
-	{ 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16D6 (ᛖ)
-	{ 0x00, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+16D7 (ᛗ)
-	{ 0x00, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16D8 (ᛘ)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16D9 (ᛙ)
-	{ 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16DA (ᛚ)
-	{ 0x00, 0x04, 0x0c, 0x14, 0x04, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16DB (ᛛ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+16DC (ᛜ)
-	{ 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+16DD (ᛝ)
-	{ 0x00, 0x11, 0x1b, 0x1b, 0x15, 0x15, 0x15, 0x1b, 0x1b, 0x11, 0x00, 0x00 },	// U+16DE (ᛞ)
-	{ 0x00, 0x04, 0x0a, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+16DF (ᛟ)
-	{ 0x00, 0x1f, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16E0 (ᛠ)
-	{ 0x00, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00 },	// U+16E1 (ᛡ)
-	{ 0x00, 0x14, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x05, 0x00, 0x00 },	// U+16E2 (ᛢ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x00, 0x00 },	// U+16E3 (ᛣ)
-	{ 0x00, 0x15, 0x15, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+16E4 (ᛤ)
-	{ 0x00, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x00, 0x00 },	// U+16E5 (ᛥ)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+16E6 (ᛦ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16E7 (ᛧ)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+16E8 (ᛨ)
-	{ 0x00, 0x18, 0x16, 0x11, 0x16, 0x18, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+16E9 (ᛩ)
-	{ 0x00, 0x02, 0x07, 0x02, 0x0a, 0x0e, 0x0a, 0x08, 0x1c, 0x08, 0x00, 0x00 },	// U+16EA (ᛪ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+16EB (᛫)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+16EC (᛬)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+16ED (᛭)
-	{ 0x00, 0x04, 0x0c, 0x14, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+16EE (ᛮ)
-	{ 0x00, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+16EF (ᛯ)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+16F0 (ᛰ)
-}; // 81
-
-static const unsigned char orp_block18[][12] = {
-	{ 0x00, 0x04, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+1E02 (Ḃ)
-	{ 0x00, 0x04, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x00 },	// U+1E03 (ḃ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x04 },	// U+1E04 (Ḅ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x04 },	// U+1E05 (ḅ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x12, 0x12, 0x0f, 0x00, 0x1f },	// U+1E06 (Ḇ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x00, 0x1f },	// U+1E07 (ḇ)
-}; // 6
-
-static const unsigned char orp_block19[][12] = {
-	{ 0x00, 0x04, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+1E0A (Ḋ)
-	{ 0x00, 0x04, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+1E0B (ḋ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x04 },	// U+1E0C (Ḍ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x04 },	// U+1E0D (ḍ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x1f },	// U+1E0E (Ḏ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x1f },	// U+1E0F (ḏ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x04, 0x02 },	// U+1E10 (Ḑ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x04, 0x02 },	// U+1E11 (ḑ)
-	{ 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x04, 0x0a },	// U+1E12 (Ḓ)
-	{ 0x00, 0x00, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x04, 0x0a },	// U+1E13 (ḓ)
-}; // 10
-
-static const unsigned char orp_block20[][12] = {
-	{ 0x00, 0x04, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E1E (Ḟ)
-	{ 0x00, 0x04, 0x00, 0x0c, 0x12, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+1E1F (ḟ)
-}; // 2
-
-static const unsigned char orp_block21[][12] = {
-	{ 0x08, 0x04, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+1E30 (Ḱ)
-	{ 0x00, 0x08, 0x04, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x00 },	// U+1E31 (ḱ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x04 },	// U+1E32 (Ḳ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x04 },	// U+1E33 (ḳ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x1f },	// U+1E34 (Ḵ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x11, 0x00, 0x1f },	// U+1E35 (ḵ)
-}; // 6
-
-static const unsigned char orp_block22[][12] = {
-	{ 0x08, 0x04, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1E3E (Ḿ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+1E3F (ḿ)
-	{ 0x00, 0x04, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1E40 (Ṁ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+1E41 (ṁ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x04 },	// U+1E42 (Ṃ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x15, 0x00, 0x04 },	// U+1E43 (ṃ)
-}; // 6
-
-static const unsigned char orp_block23[][12] = {
-	{ 0x08, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E54 (Ṕ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+1E55 (ṕ)
-	{ 0x00, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1E56 (Ṗ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+1E57 (ṗ)
-}; // 4
-
-static const unsigned char orp_block24[][12] = {
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+1E60 (Ṡ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+1E61 (ṡ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x04 },	// U+1E62 (Ṣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x04 },	// U+1E63 (ṣ)
-	{ 0x12, 0x08, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+1E64 (Ṥ)
-	{ 0x00, 0x00, 0x12, 0x08, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+1E65 (ṥ)
-	{ 0x04, 0x00, 0x0a, 0x04, 0x1e, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+1E66 (Ṧ)
-	{ 0x04, 0x00, 0x0a, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x00 },	// U+1E67 (ṧ)
-	{ 0x00, 0x04, 0x00, 0x0e, 0x11, 0x01, 0x0e, 0x10, 0x11, 0x0e, 0x00, 0x04 },	// U+1E68 (Ṩ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x01, 0x0e, 0x10, 0x0f, 0x00, 0x04 },	// U+1E69 (ṩ)
-	{ 0x00, 0x04, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1E6A (Ṫ)
-	{ 0x00, 0x04, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+1E6B (ṫ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 },	// U+1E6C (Ṭ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x04 },	// U+1E6D (ṭ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x1f },	// U+1E6E (Ṯ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x18, 0x00, 0x1f },	// U+1E6F (ṯ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x0a },	// U+1E70 (Ṱ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x18, 0x00, 0x04, 0x0a },	// U+1E71 (ṱ)
-}; // 18
-
-static const unsigned char orp_block25[][12] = {
-	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E80 (Ẁ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E81 (ẁ)
-	{ 0x08, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E82 (Ẃ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E83 (ẃ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E84 (Ẅ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E85 (ẅ)
-	{ 0x00, 0x04, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E86 (Ẇ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1E87 (ẇ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04 },	// U+1E88 (Ẉ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04 },	// U+1E89 (ẉ)
-	{ 0x00, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+1E8A (Ẋ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+1E8B (ẋ)
-	{ 0x00, 0x0a, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+1E8C (Ẍ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+1E8D (ẍ)
-	{ 0x00, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1E8E (Ẏ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1E8F (ẏ)
-}; // 16
-
-static const unsigned char orp_block26[][12] = {
-	{ 0x02, 0x04, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1EF2 (Ỳ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF3 (ỳ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 },	// U+1EF4 (Ỵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x11 },	// U+1EF5 (ỵ)
-	{ 0x04, 0x0a, 0x08, 0x04, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1EF6 (Ỷ)
-	{ 0x04, 0x0a, 0x08, 0x04, 0x04, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF7 (ỷ)
-	{ 0x16, 0x0d, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1EF8 (Ỹ)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x02, 0x01 },	// U+1EF9 (ỹ)
-}; // 8
-
-static const unsigned char orp_block27[][12] = {
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F00 (ἀ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F01 (ἁ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F02 (ἂ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F03 (ἃ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F04 (ἄ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F05 (ἅ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x16, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F06 (ἆ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x16, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F07 (ἇ)
-	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F08 (Ἀ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F09 (Ἁ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F0A (Ἂ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F0B (Ἃ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F0C (Ἄ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F0D (Ἅ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x0c, 0x12, 0x1e, 0x12, 0x12, 0x00, 0x00 },	// U+1F0E (Ἆ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x0c, 0x12, 0x1e, 0x12, 0x12, 0x00, 0x00 },	// U+1F0F (Ἇ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F10 (ἐ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F11 (ἑ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F12 (ἒ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F13 (ἓ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F14 (ἔ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F15 (ἕ)
-}; // 22
-
-static const unsigned char orp_block28[][12] = {
-	{ 0x03, 0x02, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F18 (Ἐ)
-	{ 0x03, 0x01, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F19 (Ἑ)
-	{ 0x0b, 0x12, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1A (Ἒ)
-	{ 0x0b, 0x11, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1B (Ἓ)
-	{ 0x13, 0x0a, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1C (Ἔ)
-	{ 0x13, 0x09, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1F1D (Ἕ)
-}; // 6
-
-static const unsigned char orp_block29[][12] = {
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F20 (ἠ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F21 (ἡ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F22 (ἢ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F23 (ἣ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F24 (ἤ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F25 (ἥ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x10, 0x10 },	// U+1F26 (ἦ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x10, 0x10 },	// U+1F27 (ἧ)
-	{ 0x03, 0x02, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F28 (Ἠ)
-	{ 0x03, 0x01, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F29 (Ἡ)
-	{ 0x0b, 0x12, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F2A (Ἢ)
-	{ 0x0b, 0x11, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F2B (Ἣ)
-	{ 0x13, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F2C (Ἤ)
-	{ 0x13, 0x09, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1F2D (Ἥ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x14, 0x14, 0x1c, 0x14, 0x14, 0x00, 0x00 },	// U+1F2E (Ἦ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x14, 0x14, 0x1c, 0x14, 0x14, 0x00, 0x00 },	// U+1F2F (Ἧ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F30 (ἰ)
-	{ 0x00, 0x00, 0x06, 0x02, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F31 (ἱ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F32 (ἲ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F33 (ἳ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F34 (ἴ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F35 (ἵ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F36 (ἶ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1F37 (ἷ)
-	{ 0x03, 0x02, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F38 (Ἰ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F39 (Ἱ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F3A (Ἲ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F3B (Ἳ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F3C (Ἴ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1F3D (Ἵ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x39, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00 },	// U+1F3E (Ἶ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x3a, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00 },	// U+1F3F (Ἷ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F40 (ὀ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F41 (ὁ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F42 (ὂ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F43 (ὃ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F44 (ὄ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F45 (ὅ)
-}; // 38
-
-static const unsigned char orp_block30[][12] = {
-	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F48 (Ὀ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F49 (Ὁ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4A (Ὂ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4B (Ὃ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4C (Ὄ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F4D (Ὅ)
-}; // 6
-
-static const unsigned char orp_block31[][12] = {
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F50 (ὐ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F51 (ὑ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F52 (ὒ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F53 (ὓ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F54 (ὔ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F55 (ὕ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x09, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F56 (ὖ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x09, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F57 (ὗ)
-}; // 8
-
-static const unsigned char orp_block32[][12] = {
-	{ 0x03, 0x01, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F59 (Ὑ)
-}; // 1
-
-static const unsigned char orp_block33[][12] = {
-	{ 0x0b, 0x11, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F5B (Ὓ)
-}; // 1
-
-static const unsigned char orp_block34[][12] = {
-	{ 0x13, 0x09, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1F5D (Ὕ)
-}; // 1
-
-static const unsigned char orp_block35[][12] = {
-	{ 0x16, 0x0d, 0x00, 0x03, 0x2a, 0x28, 0x28, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+1F5F (Ὗ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F60 (ὠ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F61 (ὡ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F62 (ὢ)
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F63 (ὣ)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F64 (ὤ)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F65 (ὥ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x0a, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+1F66 (ὦ)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+1F67 (ὧ)
-	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F68 (Ὠ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F69 (Ὡ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F6A (Ὢ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F6B (Ὣ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F6C (Ὤ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1F6D (Ὥ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x1c, 0x22, 0x22, 0x22, 0x14, 0x36, 0x00 },	// U+1F6E (Ὦ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x1c, 0x22, 0x22, 0x22, 0x14, 0x36, 0x00 },	// U+1F6F (Ὧ)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F70 (ὰ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1F71 (ά)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F72 (ὲ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x00 },	// U+1F73 (έ)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F74 (ὴ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1F75 (ή)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1F76 (ὶ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1F77 (ί)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F78 (ὸ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F79 (ό)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F7A (ὺ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1F7B (ύ)
-	{ 0x00, 0x00, 0x04, 0x08, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F7C (ὼ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1F7D (ώ)
-}; // 31
-
-static const unsigned char orp_block36[][12] = {
-	{ 0x00, 0x06, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F80 (ᾀ)
-	{ 0x00, 0x0c, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F81 (ᾁ)
-	{ 0x00, 0x0b, 0x12, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F82 (ᾂ)
-	{ 0x00, 0x0b, 0x11, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F83 (ᾃ)
-	{ 0x00, 0x13, 0x0a, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F84 (ᾄ)
-	{ 0x00, 0x13, 0x09, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F85 (ᾅ)
-	{ 0x16, 0x0d, 0x08, 0x04, 0x00, 0x16, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F86 (ᾆ)
-	{ 0x16, 0x0d, 0x04, 0x08, 0x00, 0x16, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1F87 (ᾇ)
-	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F88 (ᾈ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F89 (ᾉ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F8A (ᾊ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F8B (ᾋ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F8C (ᾌ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F8D (ᾍ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x0c, 0x12, 0x1e, 0x12, 0x12, 0x04, 0x08 },	// U+1F8E (ᾎ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x0c, 0x12, 0x1e, 0x12, 0x12, 0x04, 0x08 },	// U+1F8F (ᾏ)
-	{ 0x00, 0x06, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F90 (ᾐ)
-	{ 0x00, 0x0c, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F91 (ᾑ)
-	{ 0x00, 0x0b, 0x12, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F92 (ᾒ)
-	{ 0x00, 0x0b, 0x11, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F93 (ᾓ)
-	{ 0x00, 0x13, 0x0a, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F94 (ᾔ)
-	{ 0x00, 0x13, 0x09, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F95 (ᾕ)
-	{ 0x16, 0x0d, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F96 (ᾖ)
-	{ 0x16, 0x0d, 0x04, 0x08, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1F97 (ᾗ)
-	{ 0x03, 0x02, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F98 (ᾘ)
-	{ 0x03, 0x01, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F99 (ᾙ)
-	{ 0x0b, 0x12, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F9A (ᾚ)
-	{ 0x0b, 0x11, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F9B (ᾛ)
-	{ 0x13, 0x0a, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F9C (ᾜ)
-	{ 0x13, 0x09, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1F9D (ᾝ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x14, 0x14, 0x1c, 0x14, 0x14, 0x04, 0x08 },	// U+1F9E (ᾞ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x14, 0x14, 0x1c, 0x14, 0x14, 0x04, 0x08 },	// U+1F9F (ᾟ)
-	{ 0x00, 0x06, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA0 (ᾠ)
-	{ 0x00, 0x0c, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA1 (ᾡ)
-	{ 0x00, 0x0b, 0x12, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA2 (ᾢ)
-	{ 0x00, 0x0b, 0x11, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA3 (ᾣ)
-	{ 0x00, 0x13, 0x0a, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA4 (ᾤ)
-	{ 0x00, 0x13, 0x09, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA5 (ᾥ)
-	{ 0x16, 0x0d, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA6 (ᾦ)
-	{ 0x16, 0x0d, 0x04, 0x08, 0x00, 0x0a, 0x11, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FA7 (ᾧ)
-	{ 0x03, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FA8 (ᾨ)
-	{ 0x03, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FA9 (ᾩ)
-	{ 0x0b, 0x12, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FAA (ᾪ)
-	{ 0x0b, 0x11, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FAB (ᾫ)
-	{ 0x13, 0x0a, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FAC (ᾬ)
-	{ 0x13, 0x09, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FAD (ᾭ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x02, 0x1c, 0x22, 0x22, 0x14, 0x36, 0x08, 0x10 },	// U+1FAE (ᾮ)
-	{ 0x16, 0x0d, 0x00, 0x03, 0x01, 0x1c, 0x22, 0x22, 0x14, 0x36, 0x08, 0x10 },	// U+1FAF (ᾯ)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1FB0 (ᾰ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1FB1 (ᾱ)
-	{ 0x00, 0x02, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB2 (ᾲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB3 (ᾳ)
-	{ 0x00, 0x08, 0x04, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB4 (ᾴ)
-}; // 53
-
-static const unsigned char orp_block37[][12] = {
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+1FB6 (ᾶ)
-	{ 0x00, 0x16, 0x0d, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x04, 0x08 },	// U+1FB7 (ᾷ)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FB8 (Ᾰ)
-	{ 0x00, 0x1f, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FB9 (Ᾱ)
-	{ 0x01, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FBA (Ὰ)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FBB (Ά)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1FBC (ᾼ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FBD (᾽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08 },	// U+1FBE (ι)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FBF (᾿)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FC0 (῀)
-	{ 0x16, 0x0d, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FC1 (῁)
-	{ 0x00, 0x02, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC2 (ῂ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC3 (ῃ)
-	{ 0x00, 0x08, 0x04, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC4 (ῄ)
-}; // 15
-
-static const unsigned char orp_block38[][12] = {
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x10 },	// U+1FC6 (ῆ)
-	{ 0x00, 0x16, 0x0d, 0x00, 0x0d, 0x13, 0x11, 0x11, 0x11, 0x10, 0x11, 0x02 },	// U+1FC7 (ῇ)
-	{ 0x01, 0x02, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1FC8 (Ὲ)
-	{ 0x02, 0x01, 0x00, 0x1f, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+1FC9 (Έ)
-	{ 0x01, 0x02, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FCA (Ὴ)
-	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+1FCB (Ή)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x04, 0x08 },	// U+1FCC (ῌ)
-	{ 0x00, 0x00, 0x0b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FCD (῍)
-	{ 0x00, 0x00, 0x13, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FCE (῎)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FCF (῏)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD0 (ῐ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+1FD1 (ῑ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD2 (ῒ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD3 (ΐ)
-}; // 14
-
-static const unsigned char orp_block39[][12] = {
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD6 (ῖ)
-	{ 0x16, 0x0d, 0x00, 0x0a, 0x00, 0x04, 0x04, 0x04, 0x14, 0x08, 0x00, 0x00 },	// U+1FD7 (ῗ)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FD8 (Ῐ)
-	{ 0x00, 0x1f, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FD9 (Ῑ)
-	{ 0x01, 0x02, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FDA (Ὶ)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+1FDB (Ί)
-}; // 6
-
-static const unsigned char orp_block40[][12] = {
-	{ 0x00, 0x00, 0x0b, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDD (῝)
-	{ 0x00, 0x00, 0x13, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDE (῞)
-	{ 0x16, 0x0d, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FDF (῟)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE0 (ῠ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE1 (ῡ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE2 (ῢ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE3 (ΰ)
-	{ 0x00, 0x00, 0x06, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x13, 0x0d, 0x01, 0x01 },	// U+1FE4 (ῤ)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x0e, 0x11, 0x11, 0x13, 0x0d, 0x01, 0x01 },	// U+1FE5 (ῥ)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE6 (ῦ)
-	{ 0x16, 0x0d, 0x00, 0x0a, 0x00, 0x09, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FE7 (ῧ)
-	{ 0x11, 0x0e, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1FE8 (Ῠ)
-	{ 0x00, 0x1f, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1FE9 (Ῡ)
-	{ 0x01, 0x02, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1FEA (Ὺ)
-	{ 0x02, 0x01, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+1FEB (Ύ)
-	{ 0x03, 0x01, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+1FEC (Ῥ)
-	{ 0x02, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FED (῭)
-	{ 0x08, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEE (΅)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FEF (`)
-}; // 19
-
-static const unsigned char orp_block41[][12] = {
-	{ 0x00, 0x02, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF2 (ῲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF3 (ῳ)
-	{ 0x00, 0x08, 0x04, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF4 (ῴ)
-}; // 3
-
-static const unsigned char orp_block42[][12] = {
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+1FF6 (ῶ)
-	{ 0x00, 0x16, 0x0d, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x04, 0x08 },	// U+1FF7 (ῷ)
-	{ 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FF8 (Ὸ)
-	{ 0x00, 0x1f, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+1FF9 (Ό)
-	{ 0x01, 0x02, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1FFA (Ὼ)
-	{ 0x02, 0x01, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+1FFB (Ώ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x04, 0x08 },	// U+1FFC (ῼ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFD (´)
-	{ 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+1FFE (῾)
-}; // 9
-
-static const unsigned char orp_block43[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2016 (‖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f },	// U+2017 (‗)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08, 0x04, 0x00 },	// U+201A (‚)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201B (‛)
-	{ 0x00, 0x00, 0x00, 0x12, 0x09, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x12, 0x09, 0x00 },	// U+201E („)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x09, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201F (‟)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2020 (†)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2021 (‡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2022 (•)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00 },	// U+2023 (‣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00 },	// U+2024 (․)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00 },	// U+2025 (‥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00 },	// U+2026 (…)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char orp_block44[][12] = {
-	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x0a, 0x04, 0x16, 0x2b, 0x15, 0x00, 0x00 },	// U+2030 (‰)
-	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x1a, 0x2c, 0x16, 0x2b, 0x15, 0x00, 0x00 },	// U+2031 (‱)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
-	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
-	{ 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2034 (‴)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2035 (‵)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2036 (‶)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2037 (‷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a },	// U+2038 (‸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00 },	// U+2039 (‹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00 },	// U+203A (›)
-	{ 0x00, 0x00, 0x04, 0x11, 0x0a, 0x04, 0x15, 0x04, 0x0a, 0x11, 0x04, 0x00 },	// U+203B (※)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x0a, 0x00, 0x00 },	// U+203C (‼)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x0c, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+203D (‽)
-	{ 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e },	// U+203F (‿)
-	{ 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2040 (⁀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x04, 0x04, 0x0a, 0x0a },	// U+2041 (⁁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0a, 0x1f, 0x0a, 0x00, 0x00 },	// U+2042 (⁂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2043 (⁃)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00 },	// U+2044 (⁄)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x02, 0x02, 0x0e, 0x02, 0x02, 0x0e, 0x00, 0x00 },	// U+2045 (⁅)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x0e, 0x00, 0x00 },	// U+2046 (⁆)
-	{ 0x00, 0x00, 0x00, 0x12, 0x2d, 0x24, 0x12, 0x12, 0x00, 0x12, 0x00, 0x00 },	// U+2047 (⁇)
-	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x14, 0x12, 0x12, 0x00, 0x12, 0x00, 0x00 },	// U+2048 (⁈)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x11, 0x09, 0x09, 0x00, 0x09, 0x00, 0x00 },	// U+2049 (⁉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+204A (⁊)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x1d, 0x1d, 0x0d, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+204B (⁋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x17, 0x17, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+204C (⁌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1d, 0x1d, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+204D (⁍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+204E (⁎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x06, 0x04, 0x08 },	// U+204F (⁏)
-	{ 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00 },	// U+2050 (⁐)
-	{ 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2051 (⁑)
-	{ 0x00, 0x00, 0x09, 0x08, 0x04, 0x04, 0x02, 0x02, 0x09, 0x01, 0x00, 0x00 },	// U+2052 (⁒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2053 (⁓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x00 },	// U+2054 (⁔)
-	{ 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2055 (⁕)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+2056 (⁖)
-	{ 0x00, 0x3e, 0x3e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2057 (⁗)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2058 (⁘)
-	{ 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2059 (⁙)
-	{ 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00 },	// U+205A (⁚)
-	{ 0x00, 0x00, 0x04, 0x04, 0x00, 0x11, 0x11, 0x00, 0x04, 0x04, 0x00, 0x00 },	// U+205B (⁛)
-	{ 0x00, 0x00, 0x00, 0x15, 0x04, 0x1f, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+205C (⁜)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+205D (⁝)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+205E (⁞)
-}; // 47
-
-static const unsigned char orp_block45[][12] = {
-	{ 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2070 (⁰)
-	{ 0x04, 0x00, 0x06, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2071 (ⁱ)
-}; // 2
-
-static const unsigned char orp_block46[][12] = {
-	{ 0x02, 0x02, 0x0a, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2074 (⁴)
-	{ 0x0e, 0x02, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2075 (⁵)
-	{ 0x0c, 0x02, 0x06, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2076 (⁶)
-	{ 0x0e, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2077 (⁷)
-	{ 0x04, 0x0a, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2078 (⁸)
-	{ 0x04, 0x0a, 0x0c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2079 (⁹)
-	{ 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207A (⁺)
-	{ 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207B (⁻)
-	{ 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207C (⁼)
-	{ 0x04, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207D (⁽)
-	{ 0x02, 0x04, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207E (⁾)
-	{ 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+207F (ⁿ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x0a, 0x04 },	// U+2080 (₀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x0e },	// U+2081 (₁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x04, 0x02, 0x0e },	// U+2082 (₂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x04, 0x08, 0x06 },	// U+2083 (₃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0a, 0x0e, 0x08 },	// U+2084 (₄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x02, 0x06, 0x08, 0x06 },	// U+2085 (₅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x06, 0x0a, 0x04 },	// U+2086 (₆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x08, 0x04, 0x04, 0x04 },	// U+2087 (₇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x0a, 0x04 },	// U+2088 (₈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0c, 0x08, 0x06 },	// U+2089 (₉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00 },	// U+208A (₊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00 },	// U+208B (₋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x00 },	// U+208C (₌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x04 },	// U+208D (₍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x02 },	// U+208E (₎)
-}; // 27
-
-static const unsigned char orp_block47[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x05, 0x06, 0x00 },	// U+2090 (ₐ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x07, 0x01, 0x06 },	// U+2091 (ₑ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06 },	// U+2092 (ₒ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05 },	// U+2093 (ₓ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x07, 0x05, 0x02 },	// U+2094 (ₔ)
-}; // 5
-
-static const unsigned char orp_block48[][12] = {
-	{ 0x00, 0x00, 0x00, 0x06, 0x01, 0x1d, 0x05, 0x0e, 0x04, 0x1c, 0x00, 0x00 },	// U+20A0 (₠)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x15, 0x15, 0x0b, 0x0b, 0x1b, 0x0e, 0x00, 0x00 },	// U+20A1 (₡)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x0d, 0x05, 0x15, 0x0e, 0x00, 0x00 },	// U+20A2 (₢)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x17, 0x0d, 0x05, 0x05, 0x00, 0x00 },	// U+20A3 (₣)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x07, 0x02, 0x07, 0x12, 0x0d, 0x00, 0x00 },	// U+20A4 (₤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x15, 0x15, 0x15, 0x02, 0x00 },	// U+20A5 (₥)
-	{ 0x00, 0x00, 0x00, 0x11, 0x13, 0x3f, 0x15, 0x3f, 0x19, 0x11, 0x00, 0x00 },	// U+20A6 (₦)
-	{ 0x00, 0x00, 0x00, 0x06, 0x0a, 0x1f, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+20A7 (₧)
-	{ 0x00, 0x00, 0x03, 0x05, 0x05, 0x1b, 0x05, 0x0d, 0x15, 0x0d, 0x00, 0x00 },	// U+20A8 (₨)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x11, 0x3f, 0x15, 0x15, 0x1b, 0x11, 0x00, 0x00 },	// U+20A9 (₩)
-	{ 0x00, 0x00, 0x06, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x19, 0x00, 0x00 },	// U+20AA (₪)
-	{ 0x00, 0x00, 0x10, 0x3c, 0x10, 0x1e, 0x11, 0x11, 0x11, 0x1e, 0x00, 0x1e },	// U+20AB (₫)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0f, 0x02, 0x0f, 0x02, 0x1c, 0x00, 0x00 },	// U+20AC (€)
-	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x0a, 0x1f, 0x0a, 0x12, 0x12, 0x00, 0x00 },	// U+20AD (₭)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0c, 0x06, 0x0c, 0x06, 0x04, 0x00, 0x00 },	// U+20AE (₮)
-	{ 0x00, 0x00, 0x02, 0x07, 0x0a, 0x12, 0x12, 0x12, 0x17, 0x0b, 0x00, 0x00 },	// U+20AF (₯)
-	{ 0x00, 0x00, 0x08, 0x14, 0x14, 0x08, 0x08, 0x0a, 0x16, 0x15, 0x10, 0x08 },	// U+20B0 (₰)
-	{ 0x00, 0x00, 0x06, 0x0a, 0x1f, 0x1f, 0x0a, 0x06, 0x02, 0x02, 0x00, 0x00 },	// U+20B1 (₱)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x05, 0x1d, 0x15, 0x0e, 0x04, 0x00 },	// U+20B2 (₲)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x11, 0x00, 0x00 },	// U+20B3 (₳)
-	{ 0x00, 0x00, 0x00, 0x06, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x0c, 0x00, 0x00 },	// U+20B4 (₴)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x04, 0x00 },	// U+20B5 (₵)
-}; // 22
-
-static const unsigned char orp_block49[][12] = {
-	{ 0x04, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D0 (⃐)
-	{ 0x04, 0x08, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D1 (⃑)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+20D2 (⃒)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+20D3 (⃓)
-	{ 0x00, 0x0d, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D4 (⃔)
-	{ 0x00, 0x16, 0x19, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D5 (⃕)
-	{ 0x00, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D6 (⃖)
-	{ 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20D7 (⃗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+20D8 (⃘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x17, 0x12, 0x0c, 0x00, 0x00 },	// U+20D9 (⃙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x1d, 0x09, 0x06, 0x00, 0x00 },	// U+20DA (⃚)
-	{ 0x00, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20DB (⃛)
-	{ 0x00, 0x2d, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20DC (⃜)
-	{ 0x1e, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e },	// U+20DD (⃝)
-	{ 0x3f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x3f },	// U+20DE (⃞)
-	{ 0x0c, 0x12, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x12, 0x0c },	// U+20DF (⃟)
-	{ 0x1e, 0x23, 0x25, 0x25, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29, 0x31, 0x1e },	// U+20E0 (⃠)
-	{ 0x00, 0x0a, 0x1f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20E1 (⃡)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x00 },	// U+20E2 (⃢)
-	{ 0x3f, 0x3f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x3f, 0x3f },	// U+20E3 (⃣)
-	{ 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x1f },	// U+20E4 (⃤)
-	{ 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x04, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+20E5 (⃥)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+20E6 (⃦)
-	{ 0x00, 0x3f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00 },	// U+20E7 (⃧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15 },	// U+20E8 (⃨)
-	{ 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20E9 (⃩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+20EA (⃪)
-	{ 0x00, 0x00, 0x24, 0x24, 0x24, 0x12, 0x12, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+20EB (⃫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08 },	// U+20EC (⃬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02 },	// U+20ED (⃭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02 },	// U+20EE (⃮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08 },	// U+20EF (⃯)
-	{ 0x05, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+20F0 (⃰)
-}; // 33
-
-static const unsigned char orp_block50[][12] = {
-	{ 0x00, 0x16, 0x15, 0x0e, 0x08, 0x04, 0x02, 0x1a, 0x05, 0x19, 0x00, 0x00 },	// U+2100 (℀)
-	{ 0x00, 0x16, 0x15, 0x0e, 0x08, 0x04, 0x1a, 0x06, 0x09, 0x11, 0x0c, 0x00 },	// U+2101 (℁)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x05, 0x05, 0x05, 0x15, 0x0e, 0x00, 0x00 },	// U+2102 (ℂ)
-	{ 0x02, 0x05, 0x02, 0x1c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x00, 0x00 },	// U+2103 (℃)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x05, 0x05, 0x05, 0x0e, 0x04, 0x1c, 0x00, 0x00 },	// U+2104 (℄)
-	{ 0x00, 0x12, 0x11, 0x0a, 0x08, 0x04, 0x02, 0x0a, 0x15, 0x09, 0x00, 0x00 },	// U+2105 (℅)
-	{ 0x00, 0x12, 0x11, 0x0a, 0x08, 0x04, 0x02, 0x16, 0x15, 0x19, 0x00, 0x00 },	// U+2106 (℆)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+2107 (ℇ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x1e, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+2108 (℈)
-	{ 0x02, 0x05, 0x02, 0x3c, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2109 (℉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x12, 0x0c, 0x09, 0x06 },	// U+210A (ℊ)
-	{ 0x00, 0x00, 0x00, 0x13, 0x12, 0x12, 0x0e, 0x09, 0x09, 0x09, 0x10, 0x00 },	// U+210B (ℋ)
-	{ 0x00, 0x16, 0x09, 0x01, 0x0d, 0x13, 0x12, 0x14, 0x15, 0x12, 0x08, 0x04 },	// U+210C (ℌ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x1d, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+210D (ℍ)
-	{ 0x00, 0x00, 0x04, 0x04, 0x02, 0x0e, 0x12, 0x12, 0x09, 0x09, 0x00, 0x00 },	// U+210E (ℎ)
-	{ 0x00, 0x00, 0x04, 0x0f, 0x02, 0x0e, 0x12, 0x12, 0x09, 0x09, 0x00, 0x00 },	// U+210F (ℏ)
-	{ 0x00, 0x00, 0x1c, 0x10, 0x10, 0x08, 0x08, 0x04, 0x05, 0x02, 0x00, 0x00 },	// U+2110 (ℐ)
-	{ 0x00, 0x00, 0x1f, 0x11, 0x12, 0x08, 0x08, 0x10, 0x13, 0x0c, 0x00, 0x00 },	// U+2111 (ℑ)
-	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x02, 0x02, 0x26, 0x19, 0x00, 0x00 },	// U+2112 (ℒ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x14, 0x14, 0x14, 0x08, 0x0c, 0x12, 0x00, 0x00 },	// U+2113 (ℓ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x0f, 0x05, 0x0d, 0x15, 0x15, 0x0d, 0x00, 0x00 },	// U+2114 (℔)
-	{ 0x00, 0x00, 0x00, 0x23, 0x23, 0x25, 0x2d, 0x2d, 0x35, 0x25, 0x00, 0x00 },	// U+2115 (ℕ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x1b, 0x2d, 0x19, 0x09, 0x39, 0x00, 0x00 },	// U+2116 (№)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x17, 0x1b, 0x17, 0x13, 0x11, 0x0e, 0x00, 0x00 },	// U+2117 (℗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1a, 0x26, 0x26, 0x1e, 0x05, 0x05, 0x02, 0x00 },	// U+2118 (℘)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x15, 0x15, 0x0d, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+2119 (ℙ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x0d, 0x16, 0x00, 0x00 },	// U+211A (ℚ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x05, 0x09, 0x09, 0x00, 0x00 },	// U+211B (ℛ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x15, 0x16, 0x0c, 0x0c, 0x15, 0x12, 0x00, 0x00 },	// U+211C (ℜ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x15, 0x15, 0x0d, 0x0d, 0x15, 0x15, 0x00, 0x00 },	// U+211D (ℝ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x15, 0x09, 0x15, 0x00, 0x00 },	// U+211E (℞)
-	{ 0x00, 0x06, 0x04, 0x0f, 0x15, 0x15, 0x0f, 0x05, 0x0d, 0x15, 0x04, 0x00 },	// U+211F (℟)
-	{ 0x2a, 0x39, 0x2a, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2120 (℠)
-	{ 0x07, 0x02, 0x02, 0x0e, 0x04, 0x0c, 0x04, 0x0c, 0x08, 0x08, 0x08, 0x18 },	// U+2121 (℡)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x3a, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2122 (™)
-	{ 0x07, 0x04, 0x15, 0x15, 0x15, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x01, 0x00 },	// U+2123 (℣)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x14, 0x12, 0x0a, 0x09, 0x05, 0x1f, 0x00, 0x00 },	// U+2124 (ℤ)
-	{ 0x00, 0x00, 0x1e, 0x08, 0x04, 0x1e, 0x08, 0x04, 0x0e, 0x10, 0x11, 0x0e },	// U+2125 (℥)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x00 },	// U+2126 (Ω)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2127 (℧)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x14, 0x1c, 0x14, 0x11, 0x0e, 0x00, 0x00 },	// U+2128 (ℨ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+2129 (℩)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, 0x00 },	// U+212A (K)
-	{ 0x04, 0x0a, 0x04, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+212B (Å)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x0e, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+212C (ℬ)
-	{ 0x00, 0x00, 0x10, 0x2e, 0x09, 0x09, 0x05, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+212D (ℭ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x0f, 0x03, 0x0e, 0x00, 0x00 },	// U+212E (℮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x0e, 0x01, 0x06, 0x00, 0x00 },	// U+212F (ℯ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x06, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+2130 (ℰ)
-	{ 0x00, 0x00, 0x3e, 0x05, 0x04, 0x1e, 0x04, 0x04, 0x05, 0x02, 0x00, 0x00 },	// U+2131 (ℱ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00, 0x00 },	// U+2132 (Ⅎ)
-	{ 0x00, 0x00, 0x00, 0x23, 0x36, 0x2a, 0x22, 0x12, 0x12, 0x21, 0x00, 0x00 },	// U+2133 (ℳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2134 (ℴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x16, 0x09, 0x13, 0x00, 0x00 },	// U+2135 (ℵ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x1f, 0x00, 0x00 },	// U+2136 (ℶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x14, 0x12, 0x00, 0x00 },	// U+2137 (ℷ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+2138 (ℸ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0e, 0x0c, 0x0c, 0x0e, 0x00, 0x00 },	// U+2139 (ℹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x3e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+213A (℺)
-	{ 0x07, 0x01, 0x03, 0x01, 0x0e, 0x0a, 0x0e, 0x0a, 0x28, 0x10, 0x28, 0x00 },	// U+213B (℻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x16, 0x16, 0x16, 0x16, 0x00, 0x00 },	// U+213C (ℼ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x12, 0x15, 0x0a, 0x0a, 0x0a, 0x0a },	// U+213D (ℽ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x15, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+213E (ℾ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+213F (ℿ)
-	{ 0x00, 0x1f, 0x05, 0x0a, 0x0a, 0x14, 0x0a, 0x0a, 0x05, 0x1f, 0x00, 0x00 },	// U+2140 (⅀)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x13, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+2141 (⅁)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+2142 (⅂)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00 },	// U+2143 (⅃)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2144 (⅄)
-	{ 0x00, 0x00, 0x1e, 0x2a, 0x2a, 0x2a, 0x15, 0x15, 0x15, 0x0f, 0x00, 0x00 },	// U+2145 (ⅅ)
-	{ 0x00, 0x00, 0x00, 0x38, 0x28, 0x28, 0x16, 0x15, 0x15, 0x1e, 0x00, 0x00 },	// U+2146 (ⅆ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x2a, 0x2a, 0x1d, 0x05, 0x1e, 0x00, 0x00 },	// U+2147 (ⅇ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x14, 0x14, 0x0a, 0x0a, 0x00, 0x00 },	// U+2148 (ⅈ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x00, 0x1e, 0x14, 0x14, 0x0a, 0x0a, 0x0a, 0x07 },	// U+2149 (ⅉ)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0f, 0x15, 0x15, 0x0d, 0x04, 0x1c, 0x00, 0x00 },	// U+214A (⅊)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x12, 0x17, 0x08, 0x14, 0x14, 0x08, 0x00, 0x00 },	// U+214B (⅋)
-	{ 0x00, 0x1d, 0x25, 0x2f, 0x35, 0x1f, 0x15, 0x05, 0x05, 0x02, 0x00, 0x00 },	// U+214C (⅌)
-	{ 0x02, 0x15, 0x17, 0x0d, 0x08, 0x04, 0x12, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+214D (⅍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1c, 0x10, 0x1e, 0x00, 0x00 },	// U+214E (ⅎ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x15, 0x00, 0x00, 0x00 },	// U+214F (⅏)
-}; // 80
-
-static const unsigned char orp_block51[][12] = {
-	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x1c, 0x22, 0x12, 0x21, 0x19, 0x00, 0x00 },	// U+2153 (⅓)
-	{ 0x02, 0x15, 0x12, 0x0f, 0x08, 0x1c, 0x22, 0x12, 0x21, 0x19, 0x00, 0x00 },	// U+2154 (⅔)
-	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x04, 0x1a, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+2155 (⅕)
-	{ 0x02, 0x15, 0x12, 0x0f, 0x08, 0x04, 0x1a, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+2156 (⅖)
-	{ 0x03, 0x14, 0x12, 0x0c, 0x0b, 0x04, 0x1a, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+2157 (⅗)
-	{ 0x01, 0x13, 0x17, 0x0a, 0x08, 0x04, 0x1a, 0x0a, 0x11, 0x09, 0x00, 0x00 },	// U+2158 (⅘)
-	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x14, 0x0a, 0x1a, 0x29, 0x11, 0x00, 0x00 },	// U+2159 (⅙)
-	{ 0x03, 0x11, 0x12, 0x09, 0x08, 0x14, 0x0a, 0x1a, 0x29, 0x11, 0x00, 0x00 },	// U+215A (⅚)
-	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x14, 0x2a, 0x12, 0x29, 0x11, 0x00, 0x00 },	// U+215B (⅛)
-	{ 0x03, 0x14, 0x12, 0x0c, 0x0b, 0x14, 0x2a, 0x12, 0x29, 0x11, 0x00, 0x00 },	// U+215C (⅜)
-	{ 0x03, 0x11, 0x12, 0x09, 0x08, 0x14, 0x2a, 0x12, 0x29, 0x11, 0x00, 0x00 },	// U+215D (⅝)
-	{ 0x07, 0x14, 0x12, 0x0a, 0x08, 0x14, 0x2a, 0x12, 0x29, 0x11, 0x00, 0x00 },	// U+215E (⅞)
-	{ 0x02, 0x12, 0x12, 0x0a, 0x08, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00 },	// U+215F (⅟)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2160 (Ⅰ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2161 (Ⅱ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2162 (Ⅲ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+2163 (Ⅳ)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2164 (Ⅴ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+2165 (Ⅵ)
-	{ 0x00, 0x00, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x2a, 0x2a, 0x00, 0x00 },	// U+2166 (Ⅶ)
-	{ 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x3a, 0x3a, 0x00, 0x00 },	// U+2167 (Ⅷ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x09, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2168 (Ⅸ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2169 (Ⅹ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x12, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+216A (Ⅺ)
-	{ 0x00, 0x00, 0x00, 0x35, 0x35, 0x35, 0x32, 0x35, 0x35, 0x35, 0x00, 0x00 },	// U+216B (Ⅻ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+216C (Ⅼ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+216D (Ⅽ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0f, 0x00, 0x00 },	// U+216E (Ⅾ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+216F (Ⅿ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2170 (ⅰ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2171 (ⅱ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2172 (ⅲ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x15, 0x15, 0x09, 0x09, 0x00, 0x00 },	// U+2173 (ⅳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+2174 (ⅴ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x15, 0x15, 0x12, 0x12, 0x00, 0x00 },	// U+2175 (ⅵ)
-	{ 0x00, 0x00, 0x00, 0x28, 0x00, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x00, 0x00 },	// U+2176 (ⅶ)
-	{ 0x00, 0x00, 0x00, 0x38, 0x00, 0x3b, 0x3b, 0x3b, 0x3b, 0x3a, 0x00, 0x00 },	// U+2177 (ⅷ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x15, 0x09, 0x15, 0x15, 0x00, 0x00 },	// U+2178 (ⅸ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2179 (ⅹ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x15, 0x15, 0x12, 0x15, 0x15, 0x00, 0x00 },	// U+217A (ⅺ)
-	{ 0x00, 0x00, 0x00, 0x30, 0x00, 0x35, 0x35, 0x32, 0x35, 0x35, 0x00, 0x00 },	// U+217B (ⅻ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+217C (ⅼ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+217D (ⅽ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1e, 0x11, 0x11, 0x1e, 0x00, 0x00 },	// U+217E (ⅾ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x15, 0x15, 0x15, 0x11, 0x00, 0x00 },	// U+217F (ⅿ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+2180 (ↀ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x17, 0x15, 0x17, 0x11, 0x0f, 0x00, 0x00 },	// U+2181 (ↁ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00 },	// U+2182 (ↂ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, 0x00, 0x00 },	// U+2183 (Ↄ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x12, 0x0c, 0x00, 0x00 },	// U+2184 (ↄ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x01, 0x01, 0x11, 0x1e, 0x10, 0x10, 0x00 },	// U+2185 (ↅ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2186 (ↆ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x3f, 0x39, 0x3f, 0x3f, 0x1f, 0x00, 0x00 },	// U+2187 (ↇ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x15, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+2188 (ↈ)
-}; // 54
-
-static const unsigned char orp_block52[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+2190 (←)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2191 (↑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x00 },	// U+2192 (→)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2193 (↓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+2194 (↔)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2195 (↕)
-	{ 0x00, 0x03, 0x0f, 0x07, 0x05, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+2196 (↖)
-	{ 0x00, 0x18, 0x1e, 0x1c, 0x14, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00 },	// U+2197 (↗)
-	{ 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x14, 0x1c, 0x1e, 0x18, 0x00, 0x00 },	// U+2198 (↘)
-	{ 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x05, 0x07, 0x0f, 0x03, 0x00, 0x00 },	// U+2199 (↙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x3f, 0x0a, 0x0c, 0x00, 0x00, 0x00 },	// U+219A (↚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x3f, 0x12, 0x0a, 0x00, 0x00, 0x00 },	// U+219B (↛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x26, 0x00, 0x00, 0x00, 0x00 },	// U+219C (↜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00 },	// U+219D (↝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x3f, 0x0a, 0x14, 0x00, 0x00, 0x00 },	// U+219E (↞)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+219F (↟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x14, 0x3f, 0x14, 0x0a, 0x00, 0x00, 0x00 },	// U+21A0 (↠)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+21A1 (↡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x12, 0x0f, 0x12, 0x24, 0x00, 0x00, 0x00 },	// U+21A2 (↢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x3c, 0x12, 0x09, 0x00, 0x00, 0x00 },	// U+21A3 (↣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x1f, 0x12, 0x14, 0x00, 0x00, 0x00 },	// U+21A4 (↤)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+21A5 (↥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x1f, 0x09, 0x05, 0x00, 0x00, 0x00 },	// U+21A6 (↦)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+21A7 (↧)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x15, 0x0e, 0x1f, 0x00, 0x00 },	// U+21A8 (↨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x22, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+21A9 (↩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x3e, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+21AA (↪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x32, 0x3f, 0x12, 0x14, 0x00, 0x00, 0x00 },	// U+21AB (↫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x3f, 0x12, 0x0a, 0x00, 0x00, 0x00 },	// U+21AC (↬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3b, 0x37, 0x12, 0x00, 0x00, 0x00 },	// U+21AD (↭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x1a, 0x3f, 0x16, 0x02, 0x00, 0x00, 0x00 },	// U+21AE (↮)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x0d, 0x0b, 0x09, 0x1c, 0x08, 0x00, 0x00 },	// U+21AF (↯)
-	{ 0x00, 0x00, 0x04, 0x02, 0x1f, 0x12, 0x14, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+21B0 (↰)
-	{ 0x00, 0x00, 0x04, 0x08, 0x1f, 0x09, 0x05, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+21B1 (↱)
-	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x14, 0x12, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+21B2 (↲)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x09, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21B3 (↳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x1c, 0x08, 0x00, 0x00, 0x00 },	// U+21B4 (↴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x12, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+21B5 (↵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x17, 0x12, 0x00, 0x00, 0x00 },	// U+21B6 (↶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x1d, 0x08, 0x00, 0x00, 0x00 },	// U+21B7 (↷)
-	{ 0x00, 0x00, 0x1f, 0x01, 0x07, 0x03, 0x05, 0x04, 0x08, 0x08, 0x00, 0x00 },	// U+21B8 (↸)
-	{ 0x00, 0x05, 0x03, 0x1f, 0x03, 0x15, 0x18, 0x1f, 0x18, 0x14, 0x00, 0x00 },	// U+21B9 (↹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x15, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+21BA (↺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x15, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+21BB (↻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21BC (↼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+21BD (↽)
-	{ 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+21BE (↾)
-	{ 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+21BF (↿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21C0 (⇀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x00, 0x00, 0x00 },	// U+21C1 (⇁)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x00, 0x00 },	// U+21C2 (⇂)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00 },	// U+21C3 (⇃)
-	{ 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+21C4 (⇄)
-	{ 0x00, 0x00, 0x0a, 0x0f, 0x0a, 0x0a, 0x0a, 0x0a, 0x1e, 0x0a, 0x00, 0x00 },	// U+21C5 (⇅)
-	{ 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21C6 (⇆)
-	{ 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+21C7 (⇇)
-	{ 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+21C8 (⇈)
-	{ 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21C9 (⇉)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x0a, 0x00, 0x00 },	// U+21CA (⇊)
-	{ 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x00, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+21CB (⇋)
-	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x00, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+21CC (⇌)
-	{ 0x00, 0x00, 0x00, 0x28, 0x14, 0x3e, 0x09, 0x3e, 0x04, 0x0a, 0x00, 0x00 },	// U+21CD (⇍)
-	{ 0x00, 0x00, 0x00, 0x10, 0x1a, 0x3f, 0x25, 0x3f, 0x16, 0x02, 0x00, 0x00 },	// U+21CE (⇎)
-	{ 0x00, 0x00, 0x00, 0x05, 0x0a, 0x1f, 0x24, 0x1f, 0x08, 0x14, 0x00, 0x00 },	// U+21CF (⇏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x1e, 0x04, 0x00, 0x00, 0x00 },	// U+21D0 (⇐)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+21D1 (⇑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x0f, 0x04, 0x00, 0x00, 0x00 },	// U+21D2 (⇒)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00 },	// U+21D3 (⇓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x3f, 0x21, 0x3f, 0x12, 0x00, 0x00, 0x00 },	// U+21D4 (⇔)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00 },	// U+21D5 (⇕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x05, 0x0b, 0x15, 0x29, 0x10, 0x00, 0x00 },	// U+21D6 (⇖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x28, 0x34, 0x2a, 0x25, 0x02, 0x00, 0x00 },	// U+21D7 (⇗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x2a, 0x34, 0x28, 0x3e, 0x00, 0x00 },	// U+21D8 (⇘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x15, 0x0b, 0x05, 0x1f, 0x00, 0x00 },	// U+21D9 (⇙)
-	{ 0x00, 0x00, 0x00, 0x08, 0x3c, 0x02, 0x3f, 0x02, 0x3c, 0x08, 0x00, 0x00 },	// U+21DA (⇚)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x3f, 0x10, 0x0f, 0x04, 0x00, 0x00 },	// U+21DB (⇛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x2b, 0x02, 0x00, 0x00, 0x00 },	// U+21DC (⇜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x35, 0x10, 0x00, 0x00, 0x00 },	// U+21DD (⇝)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+21DE (⇞)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+21DF (⇟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x2b, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+21E0 (⇠)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x11, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+21E1 (⇡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x35, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+21E2 (⇢)
-	{ 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x11, 0x0e, 0x04, 0x00, 0x00 },	// U+21E3 (⇣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x1f, 0x03, 0x05, 0x00, 0x00, 0x00 },	// U+21E4 (⇤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x18, 0x1f, 0x18, 0x14, 0x00, 0x00, 0x00 },	// U+21E5 (⇥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x11, 0x1e, 0x04, 0x00, 0x00, 0x00 },	// U+21E6 (⇦)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+21E7 (⇧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x11, 0x0f, 0x04, 0x00, 0x00, 0x00 },	// U+21E8 (⇨)
-	{ 0x00, 0x00, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00 },	// U+21E9 (⇩)
-	{ 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0e, 0x00, 0x0e, 0x0a, 0x0e, 0x00, 0x00 },	// U+21EA (⇪)
-	{ 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+21EB (⇫)
-	{ 0x00, 0x04, 0x0a, 0x1f, 0x11, 0x0a, 0x0a, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+21EC (⇬)
-	{ 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x0e, 0x0e, 0x1f, 0x15, 0x1f, 0x00, 0x00 },	// U+21ED (⇭)
-	{ 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+21EE (⇮)
-	{ 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x1b, 0x0a, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+21EF (⇯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00 },	// U+21F0 (⇰)
-	{ 0x00, 0x00, 0x1f, 0x01, 0x0d, 0x05, 0x09, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+21F1 (⇱)
-	{ 0x00, 0x00, 0x01, 0x01, 0x02, 0x12, 0x14, 0x16, 0x10, 0x1f, 0x00, 0x00 },	// U+21F2 (⇲)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00, 0x00 },	// U+21F3 (⇳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x16, 0x3f, 0x16, 0x08, 0x00, 0x00, 0x00 },	// U+21F4 (⇴)
-	{ 0x00, 0x00, 0x0a, 0x1e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0f, 0x0a, 0x00, 0x00 },	// U+21F5 (⇵)
-	{ 0x00, 0x08, 0x1f, 0x08, 0x08, 0x1f, 0x08, 0x08, 0x1f, 0x08, 0x00, 0x00 },	// U+21F6 (⇶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x3f, 0x12, 0x14, 0x00, 0x00, 0x00 },	// U+21F7 (⇷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x12, 0x3f, 0x12, 0x0a, 0x00, 0x00, 0x00 },	// U+21F8 (⇸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+21F9 (⇹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1a, 0x3f, 0x1a, 0x1c, 0x00, 0x00, 0x00 },	// U+21FA (⇺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x16, 0x3f, 0x16, 0x0e, 0x00, 0x00, 0x00 },	// U+21FB (⇻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+21FC (⇼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x1d, 0x06, 0x04, 0x00, 0x00, 0x00 },	// U+21FD (⇽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x17, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+21FE (⇾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x2d, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+21FF (⇿)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+2200 (∀)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x02, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+2201 (∁)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x10, 0x1c, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+2202 (∂)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, 0x00, 0x00 },	// U+2203 (∃)
-	{ 0x00, 0x08, 0x08, 0x1f, 0x18, 0x14, 0x1e, 0x14, 0x12, 0x1f, 0x02, 0x02 },	// U+2204 (∄)
-	{ 0x00, 0x00, 0x08, 0x08, 0x0e, 0x19, 0x15, 0x13, 0x0e, 0x02, 0x02, 0x00 },	// U+2205 (∅)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2206 (∆)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2207 (∇)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x01, 0x0f, 0x01, 0x02, 0x1c, 0x00, 0x00 },	// U+2208 (∈)
-	{ 0x00, 0x04, 0x04, 0x1c, 0x06, 0x05, 0x0f, 0x05, 0x06, 0x1c, 0x04, 0x04 },	// U+2209 (∉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0e, 0x02, 0x1c, 0x00, 0x00, 0x00 },	// U+220A (∊)
-	{ 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x1e, 0x10, 0x08, 0x07, 0x00, 0x00 },	// U+220B (∋)
-	{ 0x00, 0x04, 0x04, 0x07, 0x0c, 0x14, 0x1e, 0x14, 0x0c, 0x07, 0x04, 0x04 },	// U+220C (∌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1c, 0x10, 0x0e, 0x00, 0x00, 0x00 },	// U+220D (∍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+220E (∎)
-	{ 0x00, 0x00, 0x3f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x37, 0x00 },	// U+220F (∏)
-	{ 0x00, 0x00, 0x37, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x3f, 0x00 },	// U+2210 (∐)
-	{ 0x00, 0x00, 0x1f, 0x01, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x1f, 0x00 },	// U+2211 (∑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2213 (∓)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2214 (∔)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x04, 0x02, 0x02, 0x01, 0x00, 0x00 },	// U+2215 (∕)
-	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x04, 0x08, 0x08, 0x10, 0x00, 0x00 },	// U+2216 (∖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+2217 (∗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2218 (∘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2219 (∙)
-	{ 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0b, 0x0a, 0x0a, 0x04, 0x04 },	// U+221A (√)
-	{ 0x20, 0x23, 0x24, 0x12, 0x14, 0x13, 0x08, 0x09, 0x09, 0x06, 0x06, 0x04 },	// U+221B (∛)
-	{ 0x20, 0x21, 0x25, 0x17, 0x14, 0x14, 0x08, 0x09, 0x09, 0x06, 0x06, 0x04 },	// U+221C (∜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x05, 0x1a, 0x00, 0x00, 0x00 },	// U+221D (∝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+221E (∞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+221F (∟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x1f, 0x00, 0x00, 0x00 },	// U+2220 (∠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x1f, 0x08, 0x08, 0x00 },	// U+2221 (∡)
-	{ 0x00, 0x10, 0x08, 0x0c, 0x12, 0x11, 0x12, 0x0c, 0x08, 0x10, 0x00, 0x00 },	// U+2222 (∢)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+2223 (∣)
-	{ 0x00, 0x00, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x06, 0x05, 0x04, 0x04, 0x00 },	// U+2224 (∤)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00 },	// U+2225 (∥)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x1a, 0x0a, 0x0e, 0x0a, 0x0b, 0x0a, 0x0a, 0x00 },	// U+2226 (∦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+2227 (∧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2228 (∨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2229 (∩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+222A (∪)
-	{ 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x00 },	// U+222B (∫)
-	{ 0x00, 0x24, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x09 },	// U+222C (∬)
-	{ 0x00, 0x2a, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0b },	// U+222D (∭)
-	{ 0x00, 0x08, 0x14, 0x04, 0x0e, 0x15, 0x15, 0x0e, 0x04, 0x05, 0x02, 0x00 },	// U+222E (∮)
-	{ 0x00, 0x24, 0x12, 0x12, 0x1e, 0x33, 0x33, 0x33, 0x1e, 0x12, 0x12, 0x09 },	// U+222F (∯)
-	{ 0x00, 0x2a, 0x15, 0x15, 0x1f, 0x35, 0x35, 0x35, 0x1f, 0x15, 0x15, 0x0b },	// U+2230 (∰)
-	{ 0x08, 0x14, 0x04, 0x04, 0x2e, 0x35, 0x3c, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+2231 (∱)
-	{ 0x08, 0x14, 0x04, 0x04, 0x2e, 0x35, 0x3d, 0x15, 0x0e, 0x04, 0x05, 0x02 },	// U+2232 (∲)
-	{ 0x08, 0x14, 0x04, 0x04, 0x0e, 0x15, 0x3d, 0x35, 0x2e, 0x04, 0x05, 0x02 },	// U+2233 (∳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2234 (∴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2235 (∵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2236 (∶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00 },	// U+2237 (∷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2238 (∸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00 },	// U+2239 (∹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x11, 0x00, 0x00, 0x00 },	// U+223A (∺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x02, 0x00, 0x00 },	// U+223B (∻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00 },	// U+223C (∼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x00, 0x00, 0x00 },	// U+223D (∽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+223E (∾)
-	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x05, 0x15, 0x14, 0x14, 0x08, 0x00, 0x00 },	// U+223F (∿)
-	{ 0x00, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00 },	// U+2240 (≀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x00, 0x00 },	// U+2241 (≁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00 },	// U+2242 (≂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+2243 (≃)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+2244 (≄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2245 (≅)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+2246 (≆)
-	{ 0x00, 0x00, 0x04, 0x16, 0x0d, 0x04, 0x1f, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+2247 (≇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00 },	// U+2248 (≈)
-	{ 0x00, 0x00, 0x00, 0x04, 0x16, 0x0d, 0x04, 0x16, 0x0d, 0x04, 0x00, 0x00 },	// U+2249 (≉)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x00 },	// U+224A (≊)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+224B (≋)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+224C (≌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+224D (≍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x00 },	// U+224E (≎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+224F (≏)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2250 (≐)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x04, 0x00, 0x00 },	// U+2251 (≑)
-	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x10, 0x00, 0x00 },	// U+2252 (≒)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x00 },	// U+2253 (≓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00 },	// U+2254 (≔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00 },	// U+2255 (≕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2256 (≖)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+2257 (≗)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+2258 (≘)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+2259 (≙)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+225A (≚)
-	{ 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+225B (≛)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x11, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+225C (≜)
-	{ 0x00, 0x00, 0x32, 0x1f, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+225D (≝)
-	{ 0x00, 0x00, 0x0b, 0x15, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+225E (≞)
-	{ 0x00, 0x04, 0x0a, 0x08, 0x04, 0x00, 0x04, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+225F (≟)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x02, 0x00, 0x00 },	// U+2260 (≠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+2261 (≡)
-	{ 0x00, 0x00, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x04, 0x1f, 0x02, 0x00, 0x00 },	// U+2262 (≢)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2263 (≣)
-	{ 0x00, 0x00, 0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x1f, 0x00, 0x00 },	// U+2264 (≤)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x1f, 0x00, 0x00 },	// U+2265 (≥)
-	{ 0x00, 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2266 (≦)
-	{ 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2267 (≧)
-	{ 0x00, 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x18, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2268 (≨)
-	{ 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x09, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2269 (≩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x05, 0x0a, 0x14, 0x00, 0x00, 0x00 },	// U+226A (≪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x14, 0x0a, 0x05, 0x00, 0x00, 0x00 },	// U+226B (≫)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x0a, 0x00, 0x00 },	// U+226C (≬)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+226D (≭)
-	{ 0x00, 0x14, 0x0c, 0x04, 0x06, 0x05, 0x06, 0x04, 0x0c, 0x14, 0x00, 0x00 },	// U+226E (≮)
-	{ 0x00, 0x05, 0x06, 0x04, 0x0c, 0x14, 0x0c, 0x04, 0x06, 0x05, 0x00, 0x00 },	// U+226F (≯)
-	{ 0x00, 0x04, 0x1c, 0x06, 0x05, 0x06, 0x1c, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+2270 (≰)
-	{ 0x00, 0x04, 0x07, 0x0c, 0x14, 0x0c, 0x07, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+2271 (≱)
-	{ 0x00, 0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2272 (≲)
-	{ 0x00, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2273 (≳)
-	{ 0x00, 0x04, 0x1c, 0x06, 0x05, 0x06, 0x1c, 0x04, 0x16, 0x0d, 0x04, 0x00 },	// U+2274 (≴)
-	{ 0x00, 0x04, 0x07, 0x0c, 0x14, 0x0c, 0x07, 0x04, 0x16, 0x0d, 0x04, 0x00 },	// U+2275 (≵)
-	{ 0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00 },	// U+2276 (≶)
-	{ 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00 },	// U+2277 (≷)
-	{ 0x08, 0x18, 0x0e, 0x09, 0x06, 0x1c, 0x07, 0x0c, 0x12, 0x0e, 0x03, 0x02 },	// U+2278 (≸)
-	{ 0x08, 0x0b, 0x0c, 0x18, 0x0c, 0x07, 0x1c, 0x06, 0x03, 0x06, 0x1a, 0x02 },	// U+2279 (≹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00, 0x00 },	// U+227A (≺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x00, 0x00 },	// U+227B (≻)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x17, 0x08, 0x10, 0x00, 0x00 },	// U+227C (≼)
-	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x01, 0x00, 0x00 },	// U+227D (≽)
-	{ 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+227E (≾)
-	{ 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+227F (≿)
-	{ 0x00, 0x00, 0x00, 0x04, 0x14, 0x0c, 0x07, 0x0c, 0x14, 0x04, 0x00, 0x00 },	// U+2280 (⊀)
-	{ 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x1c, 0x06, 0x05, 0x04, 0x00, 0x00 },	// U+2281 (⊁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x01, 0x01, 0x1e, 0x00, 0x00, 0x00 },	// U+2282 (⊂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+2283 (⊃)
-	{ 0x00, 0x00, 0x00, 0x08, 0x1e, 0x05, 0x05, 0x05, 0x1e, 0x02, 0x00, 0x00 },	// U+2284 (⊄)
-	{ 0x00, 0x00, 0x00, 0x08, 0x0f, 0x14, 0x14, 0x14, 0x0f, 0x02, 0x00, 0x00 },	// U+2285 (⊅)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x01, 0x01, 0x01, 0x1e, 0x00, 0x1f, 0x00, 0x00 },	// U+2286 (⊆)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x00, 0x1f, 0x00, 0x00 },	// U+2287 (⊇)
-	{ 0x00, 0x00, 0x04, 0x1e, 0x05, 0x05, 0x05, 0x1e, 0x04, 0x1f, 0x04, 0x00 },	// U+2288 (⊈)
-	{ 0x00, 0x00, 0x04, 0x0f, 0x14, 0x14, 0x14, 0x0f, 0x04, 0x1f, 0x04, 0x00 },	// U+2289 (⊉)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x01, 0x01, 0x01, 0x1e, 0x08, 0x1f, 0x02, 0x00 },	// U+228A (⊊)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x10, 0x0f, 0x08, 0x1f, 0x02, 0x00 },	// U+228B (⊋)
-	{ 0x00, 0x00, 0x11, 0x15, 0x17, 0x1f, 0x17, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+228C (⊌)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+228D (⊍)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x1f, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+228E (⊎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00, 0x00 },	// U+228F (⊏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00 },	// U+2290 (⊐)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2291 (⊑)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2292 (⊒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2293 (⊓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2294 (⊔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+2295 (⊕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2296 (⊖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+2297 (⊗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x19, 0x15, 0x13, 0x0e, 0x00, 0x00, 0x00 },	// U+2298 (⊘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2299 (⊙)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+229A (⊚)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x0e, 0x00, 0x00 },	// U+229B (⊛)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+229C (⊜)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+229D (⊝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00, 0x00 },	// U+229E (⊞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1f, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+229F (⊟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1b, 0x15, 0x1b, 0x1f, 0x00, 0x00, 0x00 },	// U+22A0 (⊠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+22A1 (⊡)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x1f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+22A2 (⊢)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+22A3 (⊣)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+22A4 (⊤)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+22A5 (⊥)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0e, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+22A6 (⊦)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x02, 0x0e, 0x02, 0x02, 0x00, 0x00 },	// U+22A7 (⊧)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x01, 0x00, 0x00 },	// U+22A8 (⊨)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x1d, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+22A9 (⊩)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x35, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+22AA (⊪)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x3d, 0x05, 0x3d, 0x05, 0x05, 0x00, 0x00 },	// U+22AB (⊫)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x09, 0x1f, 0x05, 0x05, 0x01, 0x00, 0x00 },	// U+22AC (⊬)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x1f, 0x05, 0x1f, 0x03, 0x01, 0x00, 0x00 },	// U+22AD (⊭)
-	{ 0x00, 0x00, 0x00, 0x05, 0x15, 0x15, 0x3d, 0x0d, 0x0d, 0x05, 0x00, 0x00 },	// U+22AE (⊮)
-	{ 0x00, 0x00, 0x00, 0x25, 0x25, 0x3d, 0x15, 0x3d, 0x0d, 0x0d, 0x00, 0x00 },	// U+22AF (⊯)
-	{ 0x00, 0x00, 0x00, 0x08, 0x10, 0x08, 0x07, 0x08, 0x10, 0x08, 0x00, 0x00 },	// U+22B0 (⊰)
-	{ 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x02, 0x00, 0x00 },	// U+22B1 (⊱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x16, 0x11, 0x16, 0x18, 0x00, 0x00, 0x00 },	// U+22B2 (⊲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0d, 0x11, 0x0d, 0x03, 0x00, 0x00, 0x00 },	// U+22B3 (⊳)
-	{ 0x00, 0x00, 0x00, 0x18, 0x16, 0x11, 0x16, 0x18, 0x00, 0x1f, 0x00, 0x00 },	// U+22B4 (⊴)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0d, 0x11, 0x0d, 0x03, 0x00, 0x1f, 0x00, 0x00 },	// U+22B5 (⊵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+22B6 (⊶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00 },	// U+22B7 (⊷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+22B8 (⊸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+22B9 (⊹)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+22BA (⊺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x1f, 0x00, 0x00 },	// U+22BB (⊻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+22BC (⊼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+22BD (⊽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x1f, 0x00, 0x00 },	// U+22BE (⊾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x12, 0x1f, 0x00, 0x00 },	// U+22BF (⊿)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x11, 0x11, 0x11, 0x00 },	// U+22C0 (⋀)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x00 },	// U+22C1 (⋁)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00 },	// U+22C2 (⋂)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00 },	// U+22C3 (⋃)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+22C4 (⋄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+22C6 (⋆)
-	{ 0x00, 0x00, 0x00, 0x04, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x04, 0x00, 0x00 },	// U+22C7 (⋇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x00, 0x00, 0x00 },	// U+22C8 (⋈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0b, 0x05, 0x0b, 0x11, 0x00, 0x00, 0x00 },	// U+22C9 (⋉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x1a, 0x14, 0x1a, 0x11, 0x00, 0x00, 0x00 },	// U+22CA (⋊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+22CB (⋋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+22CC (⋌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x16, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+22CD (⋍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+22CE (⋎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+22CF (⋏)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x19, 0x05, 0x19, 0x02, 0x1c, 0x00, 0x00 },	// U+22D0 (⋐)
-	{ 0x00, 0x00, 0x00, 0x07, 0x08, 0x13, 0x14, 0x13, 0x08, 0x07, 0x00, 0x00 },	// U+22D1 (⋑)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+22D2 (⋒)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+22D3 (⋓)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+22D4 (⋔)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, 0x00 },	// U+22D5 (⋕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x11, 0x06, 0x18, 0x00, 0x00, 0x00 },	// U+22D6 (⋖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x11, 0x0c, 0x03, 0x00, 0x00, 0x00 },	// U+22D7 (⋗)
-	{ 0x00, 0x00, 0x00, 0x28, 0x14, 0x2a, 0x15, 0x2a, 0x14, 0x28, 0x00, 0x00 },	// U+22D8 (⋘)
-	{ 0x00, 0x00, 0x00, 0x05, 0x0a, 0x15, 0x2a, 0x15, 0x0a, 0x05, 0x00, 0x00 },	// U+22D9 (⋙)
-	{ 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x1f, 0x03, 0x0c, 0x10, 0x0c, 0x03 },	// U+22DA (⋚)
-	{ 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x1f, 0x18, 0x06, 0x01, 0x06, 0x18 },	// U+22DB (⋛)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x00 },	// U+22DC (⋜)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x00 },	// U+22DD (⋝)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x17, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00 },	// U+22DE (⋞)
-	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x1d, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x00 },	// U+22DF (⋟)
-	{ 0x00, 0x00, 0x04, 0x14, 0x0c, 0x07, 0x0c, 0x17, 0x0c, 0x14, 0x04, 0x00 },	// U+22E0 (⋠)
-	{ 0x00, 0x00, 0x04, 0x05, 0x06, 0x1c, 0x06, 0x1d, 0x06, 0x05, 0x04, 0x00 },	// U+22E1 (⋡)
-	{ 0x00, 0x00, 0x04, 0x1f, 0x05, 0x05, 0x1f, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+22E2 (⋢)
-	{ 0x00, 0x00, 0x04, 0x1f, 0x14, 0x14, 0x1f, 0x04, 0x1f, 0x04, 0x00, 0x00 },	// U+22E3 (⋣)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x1f, 0x08, 0x1f, 0x02, 0x00, 0x00 },	// U+22E4 (⋤)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x1f, 0x08, 0x1f, 0x02, 0x00, 0x00 },	// U+22E5 (⋥)
-	{ 0x00, 0x18, 0x06, 0x01, 0x06, 0x1c, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x00 },	// U+22E6 (⋦)
-	{ 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x07, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x00 },	// U+22E7 (⋧)
-	{ 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x14, 0x04, 0x16, 0x0d, 0x04, 0x04 },	// U+22E8 (⋨)
-	{ 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x05, 0x04, 0x16, 0x0d, 0x04, 0x04 },	// U+22E9 (⋩)
-	{ 0x00, 0x00, 0x04, 0x04, 0x1c, 0x16, 0x15, 0x16, 0x1c, 0x04, 0x04, 0x00 },	// U+22EA (⋪)
-	{ 0x00, 0x00, 0x04, 0x04, 0x07, 0x0d, 0x15, 0x0d, 0x07, 0x04, 0x04, 0x00 },	// U+22EB (⋫)
-	{ 0x00, 0x00, 0x04, 0x1c, 0x16, 0x15, 0x16, 0x1c, 0x04, 0x1f, 0x04, 0x00 },	// U+22EC (⋬)
-	{ 0x00, 0x00, 0x04, 0x07, 0x0d, 0x15, 0x0d, 0x07, 0x04, 0x1f, 0x04, 0x00 },	// U+22ED (⋭)
-	{ 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00 },	// U+22EE (⋮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+22EF (⋯)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00 },	// U+22F0 (⋰)
-	{ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00 },	// U+22F1 (⋱)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x1c, 0x00, 0x00 },	// U+22F2 (⋲)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x11, 0x1f, 0x11, 0x02, 0x1c, 0x00, 0x00 },	// U+22F3 (⋳)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x11, 0x1f, 0x11, 0x02, 0x1c, 0x00, 0x00 },	// U+22F4 (⋴)
-	{ 0x00, 0x08, 0x00, 0x1c, 0x02, 0x01, 0x0f, 0x01, 0x02, 0x1c, 0x00, 0x00 },	// U+22F5 (⋵)
-	{ 0x00, 0x1f, 0x00, 0x1c, 0x02, 0x01, 0x0f, 0x01, 0x02, 0x1c, 0x00, 0x00 },	// U+22F6 (⋶)
-	{ 0x00, 0x00, 0x1e, 0x00, 0x1c, 0x02, 0x0e, 0x02, 0x1c, 0x00, 0x00, 0x00 },	// U+22F7 (⋷)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x01, 0x0f, 0x01, 0x02, 0x1c, 0x00, 0x1f },	// U+22F8 (⋸)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x0f, 0x01, 0x0f, 0x02, 0x1c, 0x00, 0x00 },	// U+22F9 (⋹)
-	{ 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x1e, 0x08, 0x08, 0x07, 0x00, 0x00 },	// U+22FA (⋺)
-	{ 0x00, 0x00, 0x00, 0x07, 0x08, 0x11, 0x1f, 0x11, 0x08, 0x07, 0x00, 0x00 },	// U+22FB (⋻)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x10, 0x12, 0x1e, 0x12, 0x10, 0x0e, 0x00, 0x00 },	// U+22FC (⋼)
-	{ 0x00, 0x1f, 0x00, 0x07, 0x08, 0x10, 0x1e, 0x10, 0x08, 0x07, 0x00, 0x00 },	// U+22FD (⋽)
-	{ 0x00, 0x00, 0x1e, 0x00, 0x0e, 0x10, 0x1c, 0x10, 0x0e, 0x00, 0x00, 0x00 },	// U+22FE (⋾)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x1f, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+22FF (⋿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x15, 0x12, 0x0d, 0x00, 0x00 },	// U+2300 (⌀)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x15, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2301 (⌁)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2302 (⌂)
-	{ 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2303 (⌃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2304 (⌄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2305 (⌅)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2306 (⌆)
-	{ 0x00, 0x08, 0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+2307 (⌇)
-	{ 0x00, 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00 },	// U+2308 (⌈)
-	{ 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 },	// U+2309 (⌉)
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00 },	// U+230A (⌊)
-	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00 },	// U+230B (⌋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+230C (⌌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+230D (⌍)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+230E (⌎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+230F (⌏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+2310 (⌐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x0a, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+2311 (⌑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2312 (⌒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2313 (⌓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2314 (⌔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x13, 0x0f, 0x00, 0x00 },	// U+2315 (⌕)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2316 (⌖)
-	{ 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, 0x00 },	// U+2317 (⌗)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x0a, 0x00, 0x00 },	// U+2318 (⌘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2319 (⌙)
-	{ 0x0e, 0x0a, 0x0a, 0x0e, 0x15, 0x1d, 0x11, 0x0e, 0x0a, 0x0a, 0x0e, 0x00 },	// U+231A (⌚)
-	{ 0x00, 0x00, 0x1f, 0x11, 0x0e, 0x04, 0x04, 0x0a, 0x15, 0x1f, 0x00, 0x00 },	// U+231B (⌛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+231C (⌜)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+231D (⌝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+231E (⌞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+231F (⌟)
-	{ 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2320 (⌠)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x00 },	// U+2321 (⌡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2322 (⌢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+2323 (⌣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+2324 (⌤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x04, 0x18, 0x00, 0x00, 0x00 },	// U+2325 (⌥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1b, 0x25, 0x1b, 0x0f, 0x00, 0x00, 0x00 },	// U+2326 (⌦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1b, 0x15, 0x1b, 0x1f, 0x00, 0x00, 0x00 },	// U+2327 (⌧)
-	{ 0x3f, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x3f, 0x00 },	// U+2328 (⌨)
-}; // 409
-
-static const unsigned char orp_block53[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x3c, 0x36, 0x29, 0x36, 0x3c, 0x00, 0x00, 0x00 },	// U+232B (⌫)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x13, 0x1b, 0x0e, 0x04, 0x00, 0x00 },	// U+232C (⌬)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x06, 0x1b, 0x0c, 0x04, 0x02, 0x00, 0x00 },	// U+232D (⌭)
-	{ 0x00, 0x00, 0x1c, 0x22, 0x3a, 0x26, 0x1c, 0x05, 0x03, 0x07, 0x00, 0x00 },	// U+232E (⌮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x0e, 0x00, 0x00, 0x00 },	// U+232F (⌯)
-	{ 0x00, 0x00, 0x12, 0x3f, 0x12, 0x12, 0x09, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+2330 (⌰)
-	{ 0x00, 0x00, 0x02, 0x02, 0x15, 0x3f, 0x15, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+2331 (⌱)
-	{ 0x00, 0x00, 0x01, 0x07, 0x19, 0x3f, 0x19, 0x07, 0x01, 0x00, 0x00, 0x00 },	// U+2332 (⌲)
-	{ 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x09, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2333 (⌳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x21, 0x21, 0x21, 0x3f, 0x00, 0x00 },	// U+2334 (⌴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2335 (⌵)
-	{ 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+2336 (⌶)
-	{ 0x00, 0x1e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1e, 0x00 },	// U+2337 (⌷)
-	{ 0x00, 0x1f, 0x11, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2338 (⌸)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2339 (⌹)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x1b, 0x11, 0x1b, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+233A (⌺)
-	{ 0x00, 0x1f, 0x11, 0x11, 0x15, 0x1b, 0x15, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+233B (⌻)
-	{ 0x00, 0x1f, 0x11, 0x1f, 0x1b, 0x11, 0x1b, 0x1f, 0x11, 0x1f, 0x00, 0x00 },	// U+233C (⌼)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+233D (⌽)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+233E (⌾)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x1f, 0x02, 0x02, 0x01, 0x00, 0x00 },	// U+233F (⌿)
-	{ 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x1f, 0x08, 0x08, 0x10, 0x00, 0x00 },	// U+2340 (⍀)
-	{ 0x00, 0x1f, 0x19, 0x19, 0x15, 0x15, 0x15, 0x13, 0x13, 0x1f, 0x00, 0x00 },	// U+2341 (⍁)
-	{ 0x00, 0x1f, 0x13, 0x13, 0x15, 0x15, 0x15, 0x19, 0x19, 0x1f, 0x00, 0x00 },	// U+2342 (⍂)
-	{ 0x00, 0x1f, 0x11, 0x19, 0x15, 0x13, 0x15, 0x19, 0x11, 0x1f, 0x00, 0x00 },	// U+2343 (⍃)
-	{ 0x00, 0x1f, 0x11, 0x13, 0x15, 0x19, 0x15, 0x13, 0x11, 0x1f, 0x00, 0x00 },	// U+2344 (⍄)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x0a, 0x1f, 0x0a, 0x08, 0x08, 0x00, 0x00 },	// U+2345 (⍅)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0a, 0x1f, 0x0a, 0x02, 0x02, 0x00, 0x00 },	// U+2346 (⍆)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x13, 0x1f, 0x13, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2347 (⍇)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x19, 0x1f, 0x19, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2348 (⍈)
-	{ 0x00, 0x01, 0x01, 0x0e, 0x13, 0x15, 0x19, 0x0e, 0x10, 0x10, 0x00, 0x00 },	// U+2349 (⍉)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x1f, 0x00 },	// U+234A (⍊)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x15, 0x15, 0x1f, 0x04, 0x04, 0x00 },	// U+234B (⍋)
-	{ 0x00, 0x1f, 0x11, 0x11, 0x1b, 0x1b, 0x15, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+234C (⍌)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x15, 0x1b, 0x1b, 0x1f, 0x11, 0x1f, 0x00, 0x00 },	// U+234D (⍍)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x1f, 0x00, 0x00 },	// U+234E (⍎)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+234F (⍏)
-	{ 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+2350 (⍐)
-	{ 0x00, 0x1f, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2351 (⍑)
-	{ 0x00, 0x04, 0x04, 0x1f, 0x15, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+2352 (⍒)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x15, 0x1b, 0x1b, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2353 (⍓)
-	{ 0x00, 0x1f, 0x11, 0x1f, 0x1b, 0x1b, 0x15, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2354 (⍔)
-	{ 0x00, 0x1f, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2355 (⍕)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2356 (⍖)
-	{ 0x00, 0x1f, 0x15, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00 },	// U+2357 (⍗)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00 },	// U+2358 (⍘)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x1f, 0x00, 0x1f, 0x00 },	// U+2359 (⍙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x1f, 0x00 },	// U+235A (⍚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x1f, 0x00 },	// U+235B (⍛)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x1f, 0x00 },	// U+235C (⍜)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x11, 0x11, 0x00, 0x00 },	// U+235D (⍝)
-	{ 0x00, 0x1f, 0x15, 0x15, 0x15, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+235E (⍞)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1f, 0x15, 0x1b, 0x11, 0x0e, 0x00, 0x00 },	// U+235F (⍟)
-	{ 0x00, 0x1f, 0x11, 0x15, 0x11, 0x11, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2360 (⍠)
-	{ 0x00, 0x0a, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2361 (⍡)
-	{ 0x00, 0x0a, 0x00, 0x1f, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2362 (⍢)
-	{ 0x00, 0x0a, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+2363 (⍣)
-	{ 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2364 (⍤)
-	{ 0x00, 0x0a, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2365 (⍥)
-	{ 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2366 (⍦)
-	{ 0x00, 0x00, 0x08, 0x08, 0x1e, 0x09, 0x09, 0x09, 0x1e, 0x08, 0x08, 0x00 },	// U+2367 (⍧)
-	{ 0x00, 0x0a, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2368 (⍨)
-	{ 0x00, 0x0a, 0x00, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x00, 0x00, 0x00 },	// U+2369 (⍩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x0c, 0x04, 0x02, 0x00 },	// U+236A (⍪)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x3e, 0x1b, 0x05, 0x04, 0x00, 0x00 },	// U+236B (⍫)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x17, 0x1d, 0x11, 0x0e, 0x00, 0x00 },	// U+236C (⍬)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+236D (⍭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x0c, 0x1f, 0x02 },	// U+236E (⍮)
-	{ 0x00, 0x1f, 0x11, 0x19, 0x1f, 0x15, 0x1f, 0x13, 0x11, 0x1f, 0x00, 0x00 },	// U+236F (⍯)
-	{ 0x00, 0x1f, 0x15, 0x1b, 0x19, 0x15, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+2370 (⍰)
-	{ 0x00, 0x00, 0x11, 0x1d, 0x17, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2371 (⍱)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x17, 0x1d, 0x11, 0x00, 0x00 },	// U+2372 (⍲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+2373 (⍳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0f, 0x01, 0x01 },	// U+2374 (⍴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+2375 (⍵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x1f, 0x00 },	// U+2376 (⍶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x06, 0x11, 0x0e, 0x00, 0x1f, 0x00 },	// U+2377 (⍷)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x1f, 0x00 },	// U+2378 (⍸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x1f, 0x00 },	// U+2379 (⍹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x09, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+237A (⍺)
-	{ 0x00, 0x00, 0x20, 0x20, 0x10, 0x3c, 0x08, 0x09, 0x06, 0x04, 0x00, 0x00 },	// U+237B (⍻)
-	{ 0x06, 0x02, 0x03, 0x06, 0x02, 0x03, 0x06, 0x0a, 0x3f, 0x03, 0x07, 0x00 },	// U+237C (⍼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x12, 0x1e, 0x00, 0x00 },	// U+237D (⍽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x1f, 0x0a, 0x1b, 0x00, 0x00 },	// U+237E (⍾)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+237F (⍿)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x10, 0x1e, 0x11, 0x1e, 0x00, 0x11, 0x0a, 0x04 },	// U+2380 (⎀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x0e, 0x09, 0x2e, 0x00, 0x3f },	// U+2381 (⎁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x36, 0x2d, 0x36, 0x00, 0x36 },	// U+2382 (⎂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x21, 0x25, 0x08, 0x2d, 0x0a, 0x2d, 0x21, 0x00 },	// U+2383 (⎃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x2b, 0x2b, 0x2b, 0x1f, 0x00, 0x00, 0x00 },	// U+2384 (⎄)
-	{ 0x00, 0x00, 0x04, 0x1f, 0x15, 0x15, 0x15, 0x15, 0x1f, 0x04, 0x00, 0x00 },	// U+2385 (⎅)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x11, 0x24, 0x2f, 0x24, 0x11, 0x0a, 0x04, 0x00 },	// U+2386 (⎆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x14, 0x02, 0x39, 0x00, 0x00, 0x00 },	// U+2387 (⎇)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x15, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2388 (⎈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x21, 0x33, 0x2d, 0x1e, 0x00, 0x00 },	// U+2389 (⎉)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x21, 0x3f, 0x33, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+238A (⎊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x17, 0x23, 0x25, 0x28, 0x21, 0x1e, 0x00, 0x00 },	// U+238B (⎋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x13, 0x00, 0x0a, 0x15, 0x0a, 0x00, 0x00 },	// U+238C (⎌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0a, 0x0a, 0x1b, 0x00, 0x00, 0x00 },	// U+238D (⎍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0a, 0x0a, 0x0a, 0x0f, 0x00, 0x00, 0x00 },	// U+238E (⎎)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+238F (⎏)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x1f, 0x00, 0x00, 0x00 },	// U+2390 (⎐)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0a, 0x1f, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2391 (⎑)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x0a, 0x04, 0x1f, 0x00, 0x00, 0x00 },	// U+2392 (⎒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2393 (⎓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x12, 0x0c, 0x00, 0x00, 0x00 },	// U+2394 (⎔)
-	{ 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00 },	// U+2395 (⎕)
-	{ 0x00, 0x00, 0x1e, 0x0e, 0x0e, 0x06, 0x06, 0x02, 0x02, 0x00, 0x00, 0x00 },	// U+2396 (⎖)
-	{ 0x15, 0x00, 0x3d, 0x24, 0x21, 0x24, 0x3f, 0x24, 0x21, 0x24, 0x3c, 0x00 },	// U+2397 (⎗)
-	{ 0x1f, 0x01, 0x2b, 0x01, 0x21, 0x09, 0x3f, 0x09, 0x21, 0x01, 0x2a, 0x00 },	// U+2398 (⎘)
-	{ 0x00, 0x00, 0x1c, 0x16, 0x12, 0x33, 0x33, 0x33, 0x3f, 0x3f, 0x00, 0x00 },	// U+2399 (⎙)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x25, 0x2b, 0x35, 0x29, 0x1e, 0x00, 0x00, 0x00 },	// U+239A (⎚)
-	{ 0x00, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+239B (⎛)
-	{ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+239C (⎜)
-	{ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x00 },	// U+239D (⎝)
-	{ 0x00, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239E (⎞)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239F (⎟)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x00 },	// U+23A0 (⎠)
-	{ 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+23A1 (⎡)
-	{ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+23A2 (⎢)
-	{ 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00 },	// U+23A3 (⎣)
-	{ 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+23A4 (⎤)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+23A5 (⎥)
-	{ 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00 },	// U+23A6 (⎦)
-	{ 0x00, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23A7 (⎧)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23A8 (⎨)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00 },	// U+23A9 (⎩)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AA (⎪)
-	{ 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AB (⎫)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AC (⎬)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00 },	// U+23AD (⎭)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AE (⎮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23AF (⎯)
-	{ 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03 },	// U+23B0 (⎰)
-	{ 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18 },	// U+23B1 (⎱)
-	{ 0x00, 0x3f, 0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08 },	// U+23B2 (⎲)
-	{ 0x08, 0x08, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x01, 0x01, 0x3f, 0x00 },	// U+23B3 (⎳)
-	{ 0x00, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23B4 (⎴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x00, 0x00 },	// U+23B5 (⎵)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1f, 0x00, 0x00, 0x1f, 0x11, 0x00, 0x00, 0x00 },	// U+23B6 (⎶)
-	{ 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x04, 0x04, 0x00, 0x00 },	// U+23B7 (⎷)
-	{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+23B8 (⎸)
-	{ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },	// U+23B9 (⎹)
-	{ 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f },	// U+23BD (⎽)
-	{ 0x00, 0x00, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+23BE (⎾)
-	{ 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00, 0x00 },	// U+23BF (⎿)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+23C0 (⏀)
-	{ 0x00, 0x1f, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+23C1 (⏁)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x1f, 0x00, 0x00 },	// U+23C2 (⏂)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x15, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+23C3 (⏃)
-	{ 0x00, 0x1f, 0x04, 0x04, 0x0e, 0x0e, 0x15, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+23C4 (⏄)
-	{ 0x00, 0x04, 0x04, 0x04, 0x0e, 0x0e, 0x15, 0x1f, 0x04, 0x1f, 0x00, 0x00 },	// U+23C5 (⏅)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+23C6 (⏆)
-	{ 0x00, 0x00, 0x1f, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+23C7 (⏇)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+23C8 (⏈)
-	{ 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+23C9 (⏉)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+23CA (⏊)
-	{ 0x00, 0x00, 0x1f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00 },	// U+23CB (⏋)
-	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x00, 0x00 },	// U+23CC (⏌)
-	{ 0x00, 0x00, 0x04, 0x15, 0x15, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+23CD (⏍)
-	{ 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1a, 0x1f, 0x0f, 0x02, 0x00, 0x00 },	// U+23CE (⏎)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+23CF (⏏)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23D0 (⏐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+23D1 (⏑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x11, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+23D2 (⏒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+23D3 (⏓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x2d, 0x12, 0x00, 0x00, 0x00 },	// U+23D4 (⏔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x12, 0x00, 0x3f, 0x00, 0x00, 0x00 },	// U+23D5 (⏕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+23D6 (⏖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+23D7 (⏗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+23D8 (⏘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+23D9 (⏙)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x0e, 0x00, 0x04, 0x00 },	// U+23DA (⏚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x12, 0x3f, 0x12, 0x1e, 0x00, 0x00, 0x00 },	// U+23DB (⏛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x00, 0x00 },	// U+23DC (⏜)
-	{ 0x00, 0x00, 0x00, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23DD (⏝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x33, 0x21, 0x00, 0x00 },	// U+23DE (⏞)
-	{ 0x00, 0x00, 0x00, 0x21, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23DF (⏟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x00, 0x00 },	// U+23E0 (⏠)
-	{ 0x00, 0x00, 0x00, 0x21, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23E1 (⏡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x11, 0x21, 0x3f, 0x00, 0x00 },	// U+23E2 (⏢)
-	{ 0x00, 0x00, 0x0c, 0x1e, 0x33, 0x21, 0x33, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+23E3 (⏣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23E4 (⏤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x22, 0x11, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+23E5 (⏥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x3f, 0x28, 0x10, 0x00, 0x00, 0x00 },	// U+23E6 (⏦)
-	{ 0x00, 0x00, 0x00, 0x05, 0x25, 0x15, 0x0d, 0x0c, 0x12, 0x21, 0x00, 0x00 },	// U+23E7 (⏧)
-}; // 189
-
-static const unsigned char orp_block54[][12] = {
-	{ 0x09, 0x0b, 0x0d, 0x09, 0x0a, 0x0a, 0x0e, 0x04, 0x04, 0x04, 0x1c, 0x00 },	// U+2400 (␀)
-	{ 0x06, 0x01, 0x02, 0x04, 0x07, 0x0a, 0x0a, 0x04, 0x14, 0x1c, 0x14, 0x00 },	// U+2401 (␁)
-	{ 0x06, 0x01, 0x02, 0x04, 0x03, 0x0e, 0x04, 0x04, 0x14, 0x08, 0x14, 0x00 },	// U+2402 (␂)
-	{ 0x07, 0x01, 0x03, 0x01, 0x07, 0x0e, 0x04, 0x04, 0x14, 0x08, 0x14, 0x00 },	// U+2403 (␃)
-	{ 0x07, 0x01, 0x03, 0x01, 0x07, 0x0a, 0x0a, 0x04, 0x1c, 0x08, 0x08, 0x00 },	// U+2404 (␄)
-	{ 0x07, 0x01, 0x03, 0x01, 0x17, 0x16, 0x1a, 0x12, 0x08, 0x14, 0x14, 0x18 },	// U+2405 (␅)
-	{ 0x02, 0x05, 0x07, 0x05, 0x0c, 0x02, 0x0c, 0x00, 0x14, 0x0c, 0x14, 0x00 },	// U+2406 (␆)
-	{ 0x03, 0x05, 0x03, 0x05, 0x0f, 0x02, 0x06, 0x02, 0x0e, 0x04, 0x04, 0x1c },	// U+2407 (␇)
-	{ 0x00, 0x03, 0x05, 0x03, 0x05, 0x03, 0x18, 0x04, 0x08, 0x10, 0x0c, 0x00 },	// U+2408 (␈)
-	{ 0x00, 0x05, 0x05, 0x07, 0x05, 0x1d, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+2409 (␉)
-	{ 0x00, 0x01, 0x01, 0x01, 0x07, 0x00, 0x1c, 0x04, 0x0c, 0x04, 0x00, 0x00 },	// U+240A (␊)
-	{ 0x00, 0x05, 0x05, 0x05, 0x02, 0x1e, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+240B (␋)
-	{ 0x00, 0x00, 0x07, 0x01, 0x03, 0x1d, 0x05, 0x0c, 0x04, 0x04, 0x00, 0x00 },	// U+240C (␌)
-	{ 0x00, 0x06, 0x01, 0x01, 0x01, 0x0e, 0x14, 0x0c, 0x14, 0x14, 0x00, 0x00 },	// U+240D (␍)
-	{ 0x00, 0x06, 0x01, 0x02, 0x04, 0x0b, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00 },	// U+240E (␎)
-	{ 0x00, 0x06, 0x01, 0x02, 0x04, 0x03, 0x1c, 0x08, 0x08, 0x1c, 0x00, 0x00 },	// U+240F (␏)
-	{ 0x03, 0x05, 0x05, 0x03, 0x02, 0x02, 0x0e, 0x1c, 0x04, 0x0c, 0x04, 0x1c },	// U+2410 (␐)
-	{ 0x03, 0x05, 0x05, 0x03, 0x0c, 0x02, 0x0c, 0x00, 0x08, 0x0c, 0x08, 0x1c },	// U+2411 (␑)
-	{ 0x03, 0x05, 0x05, 0x03, 0x0c, 0x02, 0x0c, 0x00, 0x0c, 0x10, 0x08, 0x1c },	// U+2412 (␒)
-	{ 0x03, 0x05, 0x05, 0x03, 0x0c, 0x02, 0x0c, 0x0c, 0x10, 0x08, 0x10, 0x0c },	// U+2413 (␓)
-	{ 0x03, 0x05, 0x05, 0x03, 0x0c, 0x02, 0x0c, 0x00, 0x04, 0x14, 0x1c, 0x10 },	// U+2414 (␔)
-	{ 0x09, 0x0b, 0x0d, 0x00, 0x04, 0x0a, 0x0e, 0x0a, 0x00, 0x14, 0x0c, 0x14 },	// U+2415 (␕)
-	{ 0x06, 0x01, 0x02, 0x04, 0x03, 0x0a, 0x0a, 0x04, 0x04, 0x12, 0x16, 0x1a },	// U+2416 (␖)
-	{ 0x07, 0x01, 0x03, 0x01, 0x07, 0x0e, 0x04, 0x1c, 0x2c, 0x18, 0x28, 0x18 },	// U+2417 (␗)
-	{ 0x06, 0x01, 0x06, 0x00, 0x04, 0x0a, 0x0e, 0x0a, 0x00, 0x16, 0x1a, 0x12 },	// U+2418 (␘)
-	{ 0x00, 0x07, 0x01, 0x03, 0x01, 0x07, 0x00, 0x0a, 0x0e, 0x0a, 0x0a, 0x00 },	// U+2419 (␙)
-	{ 0x06, 0x01, 0x02, 0x07, 0x0a, 0x0a, 0x04, 0x1c, 0x28, 0x18, 0x28, 0x18 },	// U+241A (␚)
-	{ 0x07, 0x01, 0x03, 0x01, 0x0f, 0x02, 0x04, 0x0e, 0x00, 0x18, 0x04, 0x18 },	// U+241B (␛)
-	{ 0x00, 0x07, 0x01, 0x03, 0x01, 0x19, 0x04, 0x08, 0x10, 0x0c, 0x00, 0x00 },	// U+241C (␜)
-	{ 0x0e, 0x01, 0x0d, 0x09, 0x06, 0x18, 0x04, 0x08, 0x10, 0x0c, 0x00, 0x00 },	// U+241D (␝)
-	{ 0x03, 0x05, 0x03, 0x05, 0x05, 0x18, 0x04, 0x08, 0x10, 0x0c, 0x00, 0x00 },	// U+241E (␞)
-	{ 0x00, 0x09, 0x09, 0x09, 0x06, 0x18, 0x04, 0x08, 0x10, 0x0c, 0x00, 0x00 },	// U+241F (␟)
-	{ 0x00, 0x06, 0x01, 0x02, 0x04, 0x03, 0x0c, 0x14, 0x0c, 0x04, 0x00, 0x00 },	// U+2420 (␠)
-	{ 0x03, 0x05, 0x05, 0x0f, 0x02, 0x06, 0x02, 0x0e, 0x04, 0x04, 0x1c, 0x00 },	// U+2421 (␡)
-	{ 0x00, 0x00, 0x0a, 0x06, 0x02, 0x0f, 0x12, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+2422 (␢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x00, 0x00 },	// U+2423 (␣)
-	{ 0x00, 0x00, 0x09, 0x0b, 0x0d, 0x09, 0x0d, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2424 (␤)
-	{ 0x00, 0x00, 0x12, 0x12, 0x09, 0x05, 0x14, 0x12, 0x09, 0x09, 0x00, 0x00 },	// U+2425 (␥)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x01, 0x02, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+2426 (␦)
-}; // 39
-
-static const unsigned char orp_block55[][12] = {
-	{ 0x00, 0x00, 0x1c, 0x14, 0x14, 0x04, 0x04, 0x05, 0x05, 0x07, 0x00, 0x00 },	// U+2440 (⑀)
-	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x1f, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2441 (⑁)
-	{ 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2442 (⑂)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2443 (⑃)
-	{ 0x00, 0x00, 0x1f, 0x15, 0x15, 0x04, 0x04, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+2444 (⑄)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+2445 (⑅)
-	{ 0x00, 0x00, 0x18, 0x18, 0x1b, 0x03, 0x03, 0x1b, 0x18, 0x18, 0x00, 0x00 },	// U+2446 (⑆)
-	{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x04, 0x04, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+2447 (⑇)
-	{ 0x00, 0x00, 0x00, 0x30, 0x35, 0x35, 0x35, 0x05, 0x05, 0x00, 0x00, 0x00 },	// U+2448 (⑈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2449 (⑉)
-	{ 0x00, 0x00, 0x05, 0x05, 0x0a, 0x0a, 0x14, 0x14, 0x28, 0x28, 0x00, 0x00 },	// U+244A (⑊)
-}; // 11
-
-static const unsigned char orp_block56[][12] = {
-	{ 0x00, 0x0e, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2460 (①)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2461 (②)
-	{ 0x00, 0x0e, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2462 (③)
-	{ 0x00, 0x0e, 0x11, 0x13, 0x13, 0x17, 0x1f, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2463 (④)
-	{ 0x00, 0x0e, 0x11, 0x1f, 0x13, 0x17, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2464 (⑤)
-	{ 0x00, 0x0e, 0x11, 0x1d, 0x13, 0x17, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2465 (⑥)
-	{ 0x00, 0x0e, 0x11, 0x1f, 0x19, 0x15, 0x15, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2466 (⑦)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2467 (⑧)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x1d, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2468 (⑨)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x37, 0x37, 0x37, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+2469 (⑩)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+246A (⑪)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x33, 0x33, 0x2b, 0x3b, 0x21, 0x1e, 0x00, 0x00 },	// U+246B (⑫)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x33, 0x2b, 0x33, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+246C (⑬)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x2b, 0x3b, 0x3b, 0x33, 0x21, 0x1e, 0x00, 0x00 },	// U+246D (⑭)
-	{ 0x00, 0x1e, 0x21, 0x3b, 0x2b, 0x3b, 0x33, 0x3b, 0x21, 0x1e, 0x00, 0x00 },	// U+246E (⑮)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x2b, 0x3b, 0x2b, 0x33, 0x21, 0x1e, 0x00, 0x00 },	// U+246F (⑯)
-	{ 0x00, 0x1e, 0x21, 0x3b, 0x33, 0x2b, 0x2b, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+2470 (⑰)
-	{ 0x00, 0x1e, 0x21, 0x33, 0x2b, 0x33, 0x2b, 0x33, 0x21, 0x1e, 0x00, 0x00 },	// U+2471 (⑱)
-	{ 0x00, 0x1e, 0x21, 0x33, 0x2b, 0x33, 0x23, 0x3b, 0x21, 0x1e, 0x00, 0x00 },	// U+2472 (⑲)
-	{ 0x00, 0x1e, 0x21, 0x37, 0x2d, 0x2d, 0x2b, 0x37, 0x21, 0x1e, 0x00, 0x00 },	// U+2473 (⑳)
-	{ 0x00, 0x0a, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x0a, 0x00, 0x00 },	// U+2474 (⑴)
-	{ 0x00, 0x0a, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x0a, 0x00, 0x00 },	// U+2475 (⑵)
-	{ 0x00, 0x0a, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x0a, 0x00, 0x00 },	// U+2476 (⑶)
-	{ 0x00, 0x0a, 0x11, 0x13, 0x13, 0x17, 0x1f, 0x15, 0x11, 0x0a, 0x00, 0x00 },	// U+2477 (⑷)
-	{ 0x00, 0x0a, 0x11, 0x1f, 0x13, 0x17, 0x19, 0x17, 0x11, 0x0a, 0x00, 0x00 },	// U+2478 (⑸)
-	{ 0x00, 0x0a, 0x11, 0x1d, 0x13, 0x17, 0x1b, 0x15, 0x11, 0x0a, 0x00, 0x00 },	// U+2479 (⑹)
-	{ 0x00, 0x0a, 0x11, 0x1f, 0x19, 0x15, 0x15, 0x15, 0x11, 0x0a, 0x00, 0x00 },	// U+247A (⑺)
-	{ 0x00, 0x0a, 0x11, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x11, 0x0a, 0x00, 0x00 },	// U+247B (⑻)
-	{ 0x00, 0x0a, 0x11, 0x15, 0x1b, 0x1d, 0x19, 0x17, 0x11, 0x0a, 0x00, 0x00 },	// U+247C (⑼)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x37, 0x37, 0x37, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+247D (⑽)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+247E (⑾)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x33, 0x33, 0x2b, 0x3b, 0x21, 0x12, 0x00, 0x00 },	// U+247F (⑿)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x33, 0x2b, 0x33, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+2480 (⒀)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x2b, 0x3b, 0x3b, 0x33, 0x21, 0x12, 0x00, 0x00 },	// U+2481 (⒁)
-	{ 0x00, 0x12, 0x21, 0x3b, 0x2b, 0x3b, 0x33, 0x3b, 0x21, 0x12, 0x00, 0x00 },	// U+2482 (⒂)
-	{ 0x00, 0x12, 0x21, 0x2b, 0x2b, 0x3b, 0x2b, 0x33, 0x21, 0x12, 0x00, 0x00 },	// U+2483 (⒃)
-	{ 0x00, 0x12, 0x21, 0x3b, 0x33, 0x2b, 0x2b, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+2484 (⒄)
-	{ 0x00, 0x12, 0x21, 0x33, 0x2b, 0x33, 0x2b, 0x33, 0x21, 0x12, 0x00, 0x00 },	// U+2485 (⒅)
-	{ 0x00, 0x12, 0x21, 0x33, 0x2b, 0x33, 0x23, 0x3b, 0x21, 0x12, 0x00, 0x00 },	// U+2486 (⒆)
-	{ 0x00, 0x12, 0x21, 0x37, 0x2d, 0x2d, 0x2b, 0x37, 0x21, 0x12, 0x00, 0x00 },	// U+2487 (⒇)
-	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x2e, 0x00, 0x00 },	// U+2488 (⒈)
-	{ 0x00, 0x00, 0x00, 0x06, 0x08, 0x08, 0x04, 0x04, 0x02, 0x2f, 0x00, 0x00 },	// U+2489 (⒉)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x06, 0x08, 0x08, 0x27, 0x00, 0x00 },	// U+248A (⒊)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x09, 0x09, 0x1f, 0x08, 0x28, 0x00, 0x00 },	// U+248B (⒋)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x07, 0x08, 0x08, 0x09, 0x26, 0x00, 0x00 },	// U+248C (⒌)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x02, 0x01, 0x07, 0x09, 0x09, 0x26, 0x00, 0x00 },	// U+248D (⒍)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x10, 0x08, 0x08, 0x04, 0x24, 0x00, 0x00 },	// U+248E (⒎)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x09, 0x09, 0x26, 0x00, 0x00 },	// U+248F (⒏)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0e, 0x08, 0x08, 0x26, 0x00, 0x00 },	// U+2490 (⒐)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x15, 0x15, 0x15, 0x29, 0x00, 0x00 },	// U+2491 (⒑)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x2a, 0x00, 0x00 },	// U+2492 (⒒)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x11, 0x11, 0x09, 0x05, 0x05, 0x2d, 0x00, 0x00 },	// U+2493 (⒓)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x11, 0x11, 0x09, 0x11, 0x11, 0x2d, 0x00, 0x00 },	// U+2494 (⒔)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x0d, 0x0d, 0x1d, 0x09, 0x29, 0x00, 0x00 },	// U+2495 (⒕)
-	{ 0x00, 0x00, 0x00, 0x1d, 0x05, 0x05, 0x09, 0x09, 0x09, 0x25, 0x00, 0x00 },	// U+2496 (⒖)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x0d, 0x15, 0x15, 0x29, 0x00, 0x00 },	// U+2497 (⒗)
-	{ 0x00, 0x00, 0x00, 0x1d, 0x11, 0x11, 0x11, 0x09, 0x09, 0x29, 0x00, 0x00 },	// U+2498 (⒘)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x09, 0x15, 0x15, 0x29, 0x00, 0x00 },	// U+2499 (⒙)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x15, 0x19, 0x11, 0x09, 0x25, 0x00, 0x00 },	// U+249A (⒚)
-	{ 0x00, 0x00, 0x00, 0x09, 0x16, 0x16, 0x16, 0x15, 0x15, 0x2b, 0x00, 0x00 },	// U+249B (⒛)
-	{ 0x00, 0x12, 0x21, 0x25, 0x29, 0x2d, 0x2b, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+249C (⒜)
-	{ 0x00, 0x12, 0x21, 0x25, 0x25, 0x2d, 0x35, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+249D (⒝)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x29, 0x25, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+249E (⒞)
-	{ 0x00, 0x12, 0x21, 0x29, 0x29, 0x2d, 0x2b, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+249F (⒟)
-	{ 0x00, 0x12, 0x21, 0x29, 0x35, 0x3d, 0x25, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24A0 (⒠)
-	{ 0x00, 0x12, 0x21, 0x29, 0x25, 0x2f, 0x25, 0x25, 0x21, 0x12, 0x00, 0x00 },	// U+24A1 (⒡)
-	{ 0x00, 0x12, 0x21, 0x21, 0x2d, 0x2b, 0x2d, 0x29, 0x25, 0x12, 0x00, 0x00 },	// U+24A2 (⒢)
-	{ 0x00, 0x12, 0x21, 0x25, 0x25, 0x2d, 0x35, 0x35, 0x21, 0x12, 0x00, 0x00 },	// U+24A3 (⒣)
-	{ 0x00, 0x12, 0x21, 0x21, 0x29, 0x21, 0x29, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24A4 (⒤)
-	{ 0x00, 0x12, 0x21, 0x21, 0x29, 0x21, 0x29, 0x29, 0x25, 0x12, 0x00, 0x00 },	// U+24A5 (⒥)
-	{ 0x00, 0x12, 0x21, 0x25, 0x25, 0x2d, 0x25, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+24A6 (⒦)
-	{ 0x00, 0x12, 0x21, 0x29, 0x29, 0x29, 0x29, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24A7 (⒧)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x37, 0x2b, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+24A8 (⒨)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x27, 0x2b, 0x2b, 0x21, 0x12, 0x00, 0x00 },	// U+24A9 (⒩)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x29, 0x35, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24AA (⒪)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x2d, 0x35, 0x2d, 0x25, 0x12, 0x00, 0x00 },	// U+24AB (⒫)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x2d, 0x2b, 0x2d, 0x29, 0x12, 0x00, 0x00 },	// U+24AC (⒬)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x2d, 0x25, 0x25, 0x21, 0x12, 0x00, 0x00 },	// U+24AD (⒭)
-	{ 0x00, 0x12, 0x21, 0x21, 0x2d, 0x25, 0x29, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+24AE (⒮)
-	{ 0x00, 0x12, 0x21, 0x25, 0x25, 0x2f, 0x25, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24AF (⒯)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x2b, 0x2b, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+24B0 (⒰)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x35, 0x35, 0x29, 0x21, 0x12, 0x00, 0x00 },	// U+24B1 (⒱)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x23, 0x2b, 0x3d, 0x21, 0x12, 0x00, 0x00 },	// U+24B2 (⒲)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x35, 0x29, 0x35, 0x21, 0x12, 0x00, 0x00 },	// U+24B3 (⒳)
-	{ 0x00, 0x12, 0x21, 0x21, 0x21, 0x35, 0x35, 0x29, 0x25, 0x12, 0x00, 0x00 },	// U+24B4 (⒴)
-	{ 0x00, 0x12, 0x21, 0x21, 0x2d, 0x29, 0x25, 0x2d, 0x21, 0x12, 0x00, 0x00 },	// U+24B5 (⒵)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x35, 0x3d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24B6 (Ⓐ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x35, 0x2d, 0x35, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24B7 (Ⓑ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x25, 0x25, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24B8 (Ⓒ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x35, 0x35, 0x35, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24B9 (Ⓓ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x25, 0x2d, 0x25, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24BA (Ⓔ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x25, 0x2d, 0x25, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+24BB (Ⓕ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x23, 0x2b, 0x2b, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24BC (Ⓖ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x3d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24BD (Ⓗ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x29, 0x29, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24BE (Ⓘ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x29, 0x29, 0x29, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+24BF (Ⓙ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x2d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24C0 (Ⓚ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x25, 0x25, 0x25, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24C1 (Ⓛ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x3d, 0x35, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24C2 (Ⓜ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x3d, 0x3d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24C3 (Ⓝ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x35, 0x35, 0x35, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24C4 (Ⓞ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x35, 0x2d, 0x25, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+24C5 (Ⓟ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x2b, 0x2b, 0x2b, 0x2d, 0x29, 0x1e, 0x00, 0x00 },	// U+24C6 (Ⓠ)
-	{ 0x00, 0x1e, 0x21, 0x2d, 0x35, 0x2d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24C7 (Ⓡ)
-	{ 0x00, 0x1e, 0x21, 0x39, 0x25, 0x29, 0x31, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24C8 (Ⓢ)
-	{ 0x00, 0x1e, 0x21, 0x3d, 0x29, 0x29, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24C9 (Ⓣ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x35, 0x35, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24CA (Ⓤ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x35, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24CB (Ⓥ)
-	{ 0x00, 0x1e, 0x21, 0x23, 0x2b, 0x2b, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24CC (Ⓦ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x29, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24CD (Ⓧ)
-	{ 0x00, 0x1e, 0x21, 0x35, 0x35, 0x29, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24CE (Ⓨ)
-	{ 0x00, 0x1e, 0x21, 0x3d, 0x31, 0x29, 0x25, 0x3d, 0x21, 0x1e, 0x00, 0x00 },	// U+24CF (Ⓩ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x29, 0x2d, 0x2b, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24D0 (ⓐ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x25, 0x2d, 0x35, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24D1 (ⓑ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x29, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24D2 (ⓒ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x29, 0x2d, 0x2b, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24D3 (ⓓ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x35, 0x3d, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24D4 (ⓔ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x25, 0x2f, 0x25, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+24D5 (ⓕ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x2d, 0x2b, 0x2d, 0x29, 0x25, 0x1e, 0x00, 0x00 },	// U+24D6 (ⓖ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x25, 0x2d, 0x35, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24D7 (ⓗ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x29, 0x21, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24D8 (ⓘ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x29, 0x21, 0x29, 0x29, 0x25, 0x1e, 0x00, 0x00 },	// U+24D9 (ⓙ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x25, 0x2d, 0x25, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24DA (ⓚ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x29, 0x29, 0x29, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24DB (ⓛ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x37, 0x2b, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+24DC (ⓜ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x27, 0x2b, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+24DD (ⓝ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x29, 0x35, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24DE (ⓞ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x2d, 0x35, 0x2d, 0x25, 0x1e, 0x00, 0x00 },	// U+24DF (ⓟ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x2d, 0x2b, 0x2d, 0x29, 0x1e, 0x00, 0x00 },	// U+24E0 (ⓠ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x2d, 0x25, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+24E1 (ⓡ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x2d, 0x25, 0x29, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24E2 (ⓢ)
-	{ 0x00, 0x1e, 0x21, 0x25, 0x25, 0x2f, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24E3 (ⓣ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x2b, 0x2b, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24E4 (ⓤ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x35, 0x35, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24E5 (ⓥ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x23, 0x2b, 0x3d, 0x21, 0x1e, 0x00, 0x00 },	// U+24E6 (ⓦ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x35, 0x29, 0x35, 0x21, 0x1e, 0x00, 0x00 },	// U+24E7 (ⓧ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x21, 0x35, 0x35, 0x29, 0x25, 0x1e, 0x00, 0x00 },	// U+24E8 (ⓨ)
-	{ 0x00, 0x1e, 0x21, 0x21, 0x2d, 0x29, 0x25, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+24E9 (ⓩ)
-	{ 0x00, 0x1e, 0x21, 0x29, 0x35, 0x35, 0x35, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+24EA (⓪)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x35, 0x35, 0x35, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+24EB (⓫)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x2d, 0x2d, 0x35, 0x25, 0x3f, 0x1e, 0x00, 0x00 },	// U+24EC (⓬)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x2d, 0x35, 0x2d, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+24ED (⓭)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x35, 0x25, 0x25, 0x2d, 0x3f, 0x1e, 0x00, 0x00 },	// U+24EE (⓮)
-	{ 0x00, 0x1e, 0x3f, 0x25, 0x35, 0x25, 0x2d, 0x25, 0x3f, 0x1e, 0x00, 0x00 },	// U+24EF (⓯)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x35, 0x25, 0x15, 0x2d, 0x3f, 0x1e, 0x00, 0x00 },	// U+24F0 (⓰)
-	{ 0x00, 0x1e, 0x3f, 0x25, 0x2d, 0x35, 0x35, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+24F1 (⓱)
-	{ 0x00, 0x1e, 0x3f, 0x2d, 0x15, 0x2d, 0x15, 0x2d, 0x3f, 0x1e, 0x00, 0x00 },	// U+24F2 (⓲)
-	{ 0x00, 0x1e, 0x3f, 0x2d, 0x15, 0x0d, 0x1d, 0x2d, 0x3f, 0x1e, 0x00, 0x00 },	// U+24F3 (⓳)
-	{ 0x00, 0x1e, 0x3f, 0x2d, 0x13, 0x13, 0x15, 0x29, 0x3f, 0x1e, 0x00, 0x00 },	// U+24F4 (⓴)
-	{ 0x0e, 0x1f, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x1f, 0x0e, 0x00 },	// U+24F5 (⓵)
-	{ 0x0e, 0x1f, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x1f, 0x0e, 0x00 },	// U+24F6 (⓶)
-	{ 0x0e, 0x1f, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x1f, 0x0e, 0x00 },	// U+24F7 (⓷)
-	{ 0x0e, 0x1f, 0x11, 0x13, 0x13, 0x17, 0x1f, 0x15, 0x11, 0x1f, 0x0e, 0x00 },	// U+24F8 (⓸)
-	{ 0x0e, 0x1f, 0x11, 0x1f, 0x13, 0x17, 0x19, 0x17, 0x11, 0x1f, 0x0e, 0x00 },	// U+24F9 (⓹)
-	{ 0x0e, 0x1f, 0x11, 0x1d, 0x13, 0x17, 0x1b, 0x15, 0x11, 0x1f, 0x0e, 0x00 },	// U+24FA (⓺)
-	{ 0x0e, 0x1f, 0x11, 0x1f, 0x19, 0x15, 0x15, 0x15, 0x11, 0x1f, 0x0e, 0x00 },	// U+24FB (⓻)
-	{ 0x0e, 0x1f, 0x11, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x11, 0x1f, 0x0e, 0x00 },	// U+24FC (⓼)
-	{ 0x0e, 0x1f, 0x11, 0x15, 0x1b, 0x1d, 0x19, 0x17, 0x11, 0x1f, 0x0e, 0x00 },	// U+24FD (⓽)
-	{ 0x1e, 0x3f, 0x21, 0x2b, 0x37, 0x37, 0x37, 0x2b, 0x21, 0x3f, 0x1e, 0x00 },	// U+24FE (⓾)
-	{ 0x00, 0x1e, 0x3f, 0x33, 0x2d, 0x2d, 0x2d, 0x33, 0x3f, 0x1e, 0x00, 0x00 },	// U+24FF (⓿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2502 (│)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2503 (┃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2504 (┄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2505 (┅)
-	{ 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00 },	// U+2506 (┆)
-	{ 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x0c, 0x00 },	// U+2507 (┇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2508 (┈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2509 (┉)
-	{ 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04 },	// U+250A (┊)
-	{ 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c },	// U+250B (┋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+250C (┌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+250D (┍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+250E (┎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+250F (┏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2510 (┐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2511 (┑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2512 (┒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2513 (┓)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2515 (┕)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2516 (┖)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2517 (┗)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2519 (┙)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251A (┚)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251B (┛)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251C (├)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251D (┝)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251E (┞)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+251F (┟)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2520 (┠)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2521 (┡)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2522 (┢)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2523 (┣)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2524 (┤)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2525 (┥)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2526 (┦)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2527 (┧)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2528 (┨)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2529 (┩)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+252A (┪)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+252B (┫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252C (┬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252D (┭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252E (┮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252F (┯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2530 (┰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2531 (┱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2532 (┲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2533 (┳)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2535 (┵)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2536 (┶)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2537 (┷)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2538 (┸)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2539 (┹)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+253A (┺)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+253B (┻)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253C (┼)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253D (┽)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253E (┾)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253F (┿)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2540 (╀)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2541 (╁)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2542 (╂)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2543 (╃)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2544 (╄)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x0f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2545 (╅)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2546 (╆)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x3f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2547 (╇)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2548 (╈)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+2549 (╉)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+254A (╊)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+254B (╋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+254C (╌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+254D (╍)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+254E (╎)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00 },	// U+254F (╏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2551 (║)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x04, 0x3c, 0x04, 0x04, 0x04, 0x04 },	// U+2552 (╒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2553 (╓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x3a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2554 (╔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04 },	// U+2555 (╕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2556 (╖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2557 (╗)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x04, 0x3c, 0x00, 0x00, 0x00, 0x00 },	// U+2558 (╘)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2559 (╙)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3a, 0x02, 0x3e, 0x00, 0x00, 0x00, 0x00 },	// U+255A (╚)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+255B (╛)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+255C (╜)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+255D (╝)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x04, 0x3c, 0x04, 0x04, 0x04, 0x04 },	// U+255E (╞)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+255F (╟)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3a, 0x02, 0x3a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2560 (╠)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04 },	// U+2561 (╡)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2562 (╢)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2563 (╣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x04, 0x04, 0x04, 0x04 },	// U+2564 (╤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2565 (╥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3b, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2566 (╦)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+2567 (╧)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2568 (╨)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00 },	// U+2569 (╩)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x3f, 0x04, 0x3f, 0x04, 0x04, 0x04, 0x04 },	// U+256A (╪)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+256B (╫)
-	{ 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x3b, 0x00, 0x3b, 0x0a, 0x0a, 0x0a, 0x0a },	// U+256C (╬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x08, 0x04, 0x04, 0x04, 0x04 },	// U+256D (╭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04 },	// U+256E (╮)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+256F (╯)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2570 (╰)
-	{ 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01 },	// U+2571 (╱)
-	{ 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20 },	// U+2572 (╲)
-	{ 0x21, 0x21, 0x12, 0x12, 0x0c, 0x0c, 0x0c, 0x0c, 0x12, 0x12, 0x21, 0x21 },	// U+2573 (╳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2574 (╴)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2575 (╵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2576 (╶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2577 (╷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2578 (╸)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2579 (╹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257A (╺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+257B (╻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257C (╼)
-	{ 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c },	// U+257D (╽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257E (╾)
-	{ 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+257F (╿)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2580 (▀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f },	// U+2581 (▁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f },	// U+2582 (▂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2583 (▃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2584 (▄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2585 (▅)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2586 (▆)
-	{ 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2587 (▇)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2588 (█)
-	{ 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+2589 (▉)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+258A (▊)
-	{ 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f },	// U+258B (▋)
-	{ 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+258C (▌)
-	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+258D (▍)
-	{ 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03 },	// U+258E (▎)
-	{ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },	// U+258F (▏)
-	{ 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2590 (▐)
-	{ 0x15, 0x00, 0x2a, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x15, 0x00, 0x2a, 0x00 },	// U+2591 (░)
-	{ 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a, 0x15, 0x2a },	// U+2592 (▒)
-	{ 0x2a, 0x3f, 0x15, 0x3f, 0x2a, 0x3f, 0x15, 0x3f, 0x2a, 0x3f, 0x15, 0x3f },	// U+2593 (▓)
-	{ 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2594 (▔)
-	{ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },	// U+2595 (▕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+2596 (▖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+2597 (▗)
-	{ 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2598 (▘)
-	{ 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+2599 (▙)
-	{ 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+259A (▚)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+259B (▛)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38 },	// U+259C (▜)
-	{ 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+259D (▝)
-	{ 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07 },	// U+259E (▞)
-	{ 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f },	// U+259F (▟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+25A0 (■)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+25A1 (□)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+25A2 (▢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+25A3 (▣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1f, 0x11, 0x1f, 0x00, 0x00 },	// U+25A4 (▤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+25A5 (▥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00 },	// U+25A6 (▦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x13, 0x15, 0x19, 0x1f, 0x00, 0x00 },	// U+25A7 (▧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x19, 0x15, 0x13, 0x1f, 0x00, 0x00 },	// U+25A8 (▨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1b, 0x15, 0x1b, 0x1f, 0x00, 0x00 },	// U+25A9 (▩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0e, 0x00, 0x00, 0x00, 0x00 },	// U+25AB (▫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00 },	// U+25AC (▬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x21, 0x21, 0x21, 0x3f, 0x00, 0x00, 0x00 },	// U+25AD (▭)
-	{ 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00 },	// U+25AE (▮)
-	{ 0x00, 0x1e, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1e, 0x00 },	// U+25AF (▯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x1e, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+25B0 (▰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x12, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+25B1 (▱)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+25B2 (▲)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+25B3 (△)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x1f, 0x00, 0x00, 0x00 },	// U+25B5 (▵)
-	{ 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+25B6 (▶)
-	{ 0x00, 0x00, 0x00, 0x02, 0x06, 0x0a, 0x12, 0x0a, 0x06, 0x02, 0x00, 0x00 },	// U+25B7 (▷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0e, 0x06, 0x02, 0x00, 0x00, 0x00 },	// U+25B8 (▸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0a, 0x06, 0x02, 0x00, 0x00, 0x00 },	// U+25B9 (▹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00 },	// U+25BA (►)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0d, 0x31, 0x0d, 0x03, 0x00, 0x00, 0x00 },	// U+25BB (▻)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+25BC (▼)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+25BD (▽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+25BE (▾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+25BF (▿)
-	{ 0x00, 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x30, 0x20, 0x00 },	// U+25C0 (◀)
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x12, 0x14, 0x18, 0x10, 0x00, 0x00 },	// U+25C1 (◁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0e, 0x0c, 0x08, 0x00, 0x00, 0x00 },	// U+25C2 (◂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0a, 0x0c, 0x08, 0x00, 0x00, 0x00 },	// U+25C3 (◃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x3f, 0x3c, 0x30, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x2c, 0x23, 0x2c, 0x30, 0x00, 0x00, 0x00 },	// U+25C5 (◅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+25C6 (◆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+25C7 (◇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x15, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+25C8 (◈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x2d, 0x2d, 0x12, 0x0c, 0x00, 0x00 },	// U+25C9 (◉)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+25CA (◊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25CB (○)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x01, 0x20, 0x02, 0x08, 0x00, 0x00 },	// U+25CC (◌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+25CD (◍)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+25CE (◎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x3f, 0x1e, 0x0c, 0x00, 0x00 },	// U+25CF (●)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x27, 0x27, 0x16, 0x0c, 0x00, 0x00 },	// U+25D0 (◐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x39, 0x39, 0x1a, 0x0c, 0x00, 0x00 },	// U+25D1 (◑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x3f, 0x1e, 0x0c, 0x00, 0x00 },	// U+25D2 (◒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25D3 (◓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x39, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25D4 (◔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x27, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25D5 (◕)
-	{ 0x00, 0x20, 0x38, 0x3c, 0x3c, 0x3e, 0x3c, 0x3c, 0x38, 0x20, 0x00, 0x00 },	// U+25D6 (◖)
-	{ 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x0f, 0x0f, 0x07, 0x01, 0x00, 0x00 },	// U+25D7 (◗)
-	{ 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x21, 0x21, 0x33, 0x3f, 0x3f, 0x3f, 0x3f },	// U+25D8 (◘)
-	{ 0x3f, 0x3f, 0x3f, 0x33, 0x2d, 0x1e, 0x1e, 0x2d, 0x33, 0x3f, 0x3f, 0x3f },	// U+25D9 (◙)
-	{ 0x3f, 0x3f, 0x3f, 0x33, 0x2d, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25DA (◚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x2d, 0x33, 0x3f, 0x3f, 0x3f },	// U+25DB (◛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25DC (◜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25DD (◝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x00, 0x00 },	// U+25DE (◞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00 },	// U+25DF (◟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25E0 (◠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25E1 (◡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f, 0x00, 0x00 },	// U+25E2 (◢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x00, 0x00 },	// U+25E3 (◣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+25E4 (◤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+25E5 (◥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+25E6 (◦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x17, 0x17, 0x17, 0x1f, 0x00, 0x00 },	// U+25E7 (◧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x00, 0x00 },	// U+25E8 (◨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x17, 0x13, 0x1f, 0x00, 0x00 },	// U+25E9 (◩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x19, 0x1d, 0x1f, 0x1f, 0x00, 0x00 },	// U+25EA (◪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+25EB (◫)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0e, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+25EC (◬)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x17, 0x17, 0x1f, 0x00, 0x00 },	// U+25ED (◭)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1d, 0x1d, 0x1f, 0x00, 0x00 },	// U+25EE (◮)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x21, 0x21, 0x21, 0x12, 0x0c, 0x00, 0x00 },	// U+25EF (◯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x17, 0x11, 0x1f, 0x00, 0x00 },	// U+25F0 (◰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x17, 0x15, 0x1f, 0x00, 0x00 },	// U+25F1 (◱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1d, 0x15, 0x1f, 0x00, 0x00 },	// U+25F2 (◲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1d, 0x11, 0x1f, 0x00, 0x00 },	// U+25F3 (◳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+25F4 (◴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x17, 0x15, 0x0e, 0x00, 0x00 },	// U+25F5 (◵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1d, 0x15, 0x0e, 0x00, 0x00 },	// U+25F6 (◶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1d, 0x11, 0x0e, 0x00, 0x00 },	// U+25F7 (◷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x09, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00 },	// U+25F8 (◸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x12, 0x14, 0x18, 0x10, 0x00, 0x00, 0x00 },	// U+25F9 (◹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x09, 0x1f, 0x00, 0x00, 0x00 },	// U+25FA (◺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x12, 0x12, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+25FB (◻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00 },	// U+25FC (◼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x12, 0x12, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+25FD (◽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+25FE (◾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x12, 0x1f, 0x00, 0x00, 0x00 },	// U+25FF (◿)
-	{ 0x00, 0x04, 0x04, 0x11, 0x04, 0x0e, 0x04, 0x11, 0x04, 0x04, 0x00, 0x00 },	// U+2600 (☀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x1f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2601 (☁)
-	{ 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00, 0x00 },	// U+2602 (☂)
-	{ 0x05, 0x2e, 0x0a, 0x15, 0x0a, 0x2a, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2603 (☃)
-	{ 0x10, 0x12, 0x0a, 0x2a, 0x22, 0x10, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2604 (☄)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+2605 (★)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0a, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+2606 (☆)
-	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00 },	// U+2607 (☇)
-	{ 0x00, 0x1f, 0x11, 0x09, 0x09, 0x05, 0x05, 0x19, 0x19, 0x1d, 0x00, 0x00 },	// U+2608 (☈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2609 (☉)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0a, 0x0a, 0x15, 0x0a, 0x00, 0x00 },	// U+260A (☊)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x0a, 0x0a, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+260B (☋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+260C (☌)
-	{ 0x00, 0x0c, 0x12, 0x12, 0x0c, 0x04, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+260D (☍)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x15, 0x0e, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+260E (☎)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x0e, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+260F (☏)
-	{ 0x00, 0x3f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x3f, 0x00, 0x00 },	// U+2610 (☐)
-	{ 0x00, 0x3f, 0x21, 0x31, 0x31, 0x29, 0x29, 0x2b, 0x25, 0x3f, 0x00, 0x00 },	// U+2611 (☑)
-	{ 0x00, 0x3f, 0x33, 0x33, 0x2d, 0x2d, 0x2d, 0x33, 0x33, 0x3f, 0x00, 0x00 },	// U+2612 (☒)
-	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2613 (☓)
-}; // 436
-
-static const unsigned char orp_block57[][12] = {
-	{ 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2616 (☖)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2617 (☗)
-}; // 2
-
-static const unsigned char orp_block58[][12] = {
-	{ 0x00, 0x00, 0x10, 0x24, 0x2e, 0x1f, 0x17, 0x2f, 0x2e, 0x14, 0x00, 0x00 },	// U+2619 (☙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3e, 0x3e, 0x3c, 0x00, 0x00, 0x00 },	// U+261A (☚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x0f, 0x00, 0x00, 0x00 },	// U+261B (☛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x32, 0x32, 0x3c, 0x00, 0x00, 0x00 },	// U+261C (☜)
-	{ 0x00, 0x00, 0x10, 0x18, 0x1e, 0x16, 0x12, 0x12, 0x1e, 0x1e, 0x00, 0x00 },	// U+261D (☝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x13, 0x13, 0x0f, 0x00, 0x00, 0x00 },	// U+261E (☞)
-	{ 0x00, 0x1e, 0x1e, 0x12, 0x12, 0x16, 0x1e, 0x18, 0x10, 0x10, 0x00, 0x00 },	// U+261F (☟)
-	{ 0x00, 0x0e, 0x15, 0x1f, 0x0e, 0x0a, 0x04, 0x11, 0x0e, 0x11, 0x00, 0x00 },	// U+2620 (☠)
-	{ 0x00, 0x00, 0x0e, 0x10, 0x10, 0x08, 0x04, 0x02, 0x02, 0x1c, 0x00, 0x00 },	// U+2621 (☡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x1b, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+2622 (☢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x3f, 0x12, 0x12, 0x0c, 0x12, 0x00, 0x00 },	// U+2623 (☣)
-	{ 0x00, 0x04, 0x1f, 0x0e, 0x0a, 0x0e, 0x0a, 0x0e, 0x0a, 0x04, 0x00, 0x00 },	// U+2624 (☤)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2625 (☥)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x1f, 0x04, 0x06, 0x0c, 0x04, 0x00, 0x00 },	// U+2626 (☦)
-	{ 0x00, 0x00, 0x0c, 0x14, 0x0c, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x00, 0x00 },	// U+2627 (☧)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2628 (☨)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x15, 0x1f, 0x15, 0x04, 0x0e, 0x00, 0x00 },	// U+2629 (☩)
-	{ 0x00, 0x1e, 0x27, 0x13, 0x3b, 0x13, 0x2b, 0x03, 0x27, 0x1e, 0x00, 0x00 },	// U+262A (☪)
-	{ 0x00, 0x15, 0x0a, 0x00, 0x04, 0x15, 0x15, 0x15, 0x0e, 0x0e, 0x00, 0x00 },	// U+262B (☫)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x11, 0x0e, 0x0e, 0x15, 0x00, 0x00 },	// U+262C (☬)
-	{ 0x00, 0x0e, 0x11, 0x14, 0x16, 0x13, 0x15, 0x18, 0x12, 0x2d, 0x00, 0x00 },	// U+262D (☭)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00 },	// U+262E (☮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x37, 0x25, 0x3f, 0x1e, 0x00, 0x00 },	// U+262F (☯)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00 },	// U+2630 (☰)
-	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00 },	// U+2631 (☱)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x00 },	// U+2632 (☲)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x00 },	// U+2633 (☳)
-	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x00 },	// U+2634 (☴)
-	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x00 },	// U+2635 (☵)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00 },	// U+2636 (☶)
-	{ 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00 },	// U+2637 (☷)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1b, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2638 (☸)
-	{ 0x00, 0x00, 0x1e, 0x3f, 0x3f, 0x2d, 0x3f, 0x33, 0x2d, 0x3f, 0x1e, 0x00 },	// U+2639 (☹)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x1b, 0x1b, 0x11, 0x1b, 0x15, 0x11, 0x0e, 0x00 },	// U+263A (☺)
-	{ 0x00, 0x00, 0x0e, 0x1f, 0x15, 0x15, 0x1f, 0x15, 0x1b, 0x1f, 0x0e, 0x00 },	// U+263B (☻)
-	{ 0x00, 0x00, 0x04, 0x04, 0x11, 0x04, 0x0a, 0x04, 0x11, 0x04, 0x04, 0x00 },	// U+263C (☼)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x13, 0x14, 0x14, 0x14, 0x13, 0x0e, 0x00, 0x00 },	// U+263D (☽)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x19, 0x05, 0x05, 0x05, 0x19, 0x0e, 0x00, 0x00 },	// U+263E (☾)
-	{ 0x00, 0x00, 0x11, 0x0e, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+263F (☿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x04 },	// U+2640 (♀)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2641 (♁)
-	{ 0x00, 0x00, 0x00, 0x38, 0x30, 0x2e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2642 (♂)
-	{ 0x00, 0x00, 0x00, 0x12, 0x15, 0x14, 0x14, 0x12, 0x1f, 0x10, 0x00, 0x00 },	// U+2643 (♃)
-	{ 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x0a, 0x16, 0x12, 0x12, 0x00, 0x00 },	// U+2644 (♄)
-	{ 0x00, 0x00, 0x00, 0x11, 0x15, 0x1f, 0x15, 0x15, 0x04, 0x0a, 0x04, 0x00 },	// U+2645 (♅)
-	{ 0x00, 0x00, 0x15, 0x3f, 0x15, 0x15, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2646 (♆)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x0e, 0x02, 0x02, 0x1e, 0x00, 0x00 },	// U+2647 (♇)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2648 (♈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x0c, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+2649 (♉)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x00, 0x00 },	// U+264A (♊)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x22, 0x05, 0x12, 0x28, 0x11, 0x0e, 0x00, 0x00 },	// U+264B (♋)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x12, 0x14, 0x16, 0x15, 0x12, 0x20, 0x00 },	// U+264C (♌)
-	{ 0x00, 0x00, 0x00, 0x35, 0x3f, 0x35, 0x35, 0x35, 0x15, 0x15, 0x18, 0x14 },	// U+264D (♍)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0a, 0x1b, 0x00, 0x1f, 0x00, 0x00 },	// U+264E (♎)
-	{ 0x00, 0x00, 0x00, 0x15, 0x1f, 0x15, 0x15, 0x15, 0x15, 0x15, 0x30, 0x00 },	// U+264F (♏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x15, 0x02, 0x05, 0x00, 0x00 },	// U+2650 (♐)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x15, 0x0d, 0x13, 0x11, 0x0c, 0x00, 0x00 },	// U+2651 (♑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x15, 0x00, 0x2a, 0x15, 0x00, 0x00 },	// U+2652 (♒)
-	{ 0x00, 0x00, 0x00, 0x11, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+2653 (♓)
-	{ 0x04, 0x0e, 0x0e, 0x15, 0x1f, 0x11, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+2654 (♔)
-	{ 0x00, 0x15, 0x1f, 0x11, 0x1f, 0x0a, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+2655 (♕)
-	{ 0x00, 0x00, 0x00, 0x15, 0x1f, 0x0a, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+2656 (♖)
-	{ 0x00, 0x04, 0x0a, 0x0e, 0x1b, 0x11, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+2657 (♗)
-	{ 0x00, 0x08, 0x1c, 0x16, 0x11, 0x17, 0x14, 0x14, 0x22, 0x3e, 0x00, 0x00 },	// U+2658 (♘)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+2659 (♙)
-	{ 0x04, 0x0e, 0x0e, 0x15, 0x1f, 0x1f, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00 },	// U+265A (♚)
-	{ 0x00, 0x15, 0x1f, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00 },	// U+265B (♛)
-	{ 0x00, 0x00, 0x00, 0x15, 0x1f, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00 },	// U+265C (♜)
-	{ 0x00, 0x04, 0x0e, 0x0e, 0x1b, 0x11, 0x0a, 0x0e, 0x1f, 0x1f, 0x00, 0x00 },	// U+265D (♝)
-	{ 0x00, 0x08, 0x1c, 0x1a, 0x1f, 0x1f, 0x1c, 0x1c, 0x3e, 0x3e, 0x00, 0x00 },	// U+265E (♞)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00 },	// U+265F (♟)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x1f, 0x04, 0x0e, 0x00, 0x00 },	// U+2660 (♠)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x11, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2661 (♡)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+2662 (♢)
-	{ 0x00, 0x00, 0x0e, 0x0e, 0x15, 0x1f, 0x1f, 0x15, 0x04, 0x0e, 0x00, 0x00 },	// U+2663 (♣)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x1f, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2664 (♤)
-	{ 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x1f, 0x1f, 0x0e, 0x0e, 0x04, 0x00, 0x00 },	// U+2665 (♥)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x0e, 0x1f, 0x1f, 0x0e, 0x0e, 0x04, 0x00, 0x00 },	// U+2666 (♦)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x0e, 0x15, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+2667 (♧)
-	{ 0x00, 0x00, 0x09, 0x12, 0x09, 0x12, 0x00, 0x0a, 0x11, 0x0e, 0x00, 0x00 },	// U+2668 (♨)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00 },	// U+2669 (♩)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x07, 0x03, 0x00, 0x00 },	// U+266A (♪)
-	{ 0x00, 0x00, 0x06, 0x1a, 0x12, 0x12, 0x12, 0x13, 0x1b, 0x18, 0x00, 0x00 },	// U+266B (♫)
-	{ 0x00, 0x00, 0x06, 0x1a, 0x16, 0x1a, 0x12, 0x13, 0x1b, 0x18, 0x00, 0x00 },	// U+266C (♬)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0a, 0x16, 0x12, 0x0a, 0x06, 0x00, 0x00 },	// U+266D (♭)
-	{ 0x00, 0x00, 0x02, 0x12, 0x1a, 0x16, 0x12, 0x1a, 0x16, 0x12, 0x10, 0x00 },	// U+266E (♮)
-	{ 0x00, 0x00, 0x08, 0x1a, 0x0e, 0x0b, 0x1a, 0x0e, 0x0b, 0x02, 0x00, 0x00 },	// U+266F (♯)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x04, 0x0a, 0x00, 0x00 },	// U+2670 (♰)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x1b, 0x15, 0x04, 0x04, 0x0a, 0x04, 0x00 },	// U+2671 (♱)
-	{ 0x00, 0x00, 0x08, 0x13, 0x22, 0x31, 0x01, 0x29, 0x1c, 0x08, 0x00, 0x00 },	// U+2672 (♲)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1a, 0x08, 0x29, 0x21, 0x3b, 0x00, 0x00 },	// U+2673 (♳)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1e, 0x08, 0x2d, 0x21, 0x3b, 0x00, 0x00 },	// U+2674 (♴)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1e, 0x0c, 0x2d, 0x21, 0x3b, 0x00, 0x00 },	// U+2675 (♵)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1e, 0x0c, 0x29, 0x21, 0x3b, 0x00, 0x00 },	// U+2676 (♶)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1e, 0x04, 0x2d, 0x21, 0x3b, 0x00, 0x00 },	// U+2677 (♷)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x16, 0x0c, 0x2d, 0x21, 0x3b, 0x00, 0x00 },	// U+2678 (♸)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x1e, 0x08, 0x29, 0x21, 0x3b, 0x00, 0x00 },	// U+2679 (♹)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x00, 0x21, 0x21, 0x3b, 0x00, 0x00 },	// U+267A (♺)
-	{ 0x00, 0x00, 0x0c, 0x14, 0x33, 0x33, 0x01, 0x29, 0x1d, 0x08, 0x00, 0x00 },	// U+267B (♻)
-	{ 0x1e, 0x3f, 0x23, 0x2b, 0x0c, 0x0c, 0x3e, 0x16, 0x22, 0x37, 0x3f, 0x1e },	// U+267C (♼)
-	{ 0x1e, 0x21, 0x0c, 0x14, 0x33, 0x33, 0x01, 0x29, 0x1d, 0x08, 0x21, 0x1e },	// U+267D (♽)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x00, 0x0a, 0x15, 0x0a, 0x00, 0x11, 0x0e, 0x00 },	// U+267E (♾)
-	{ 0x00, 0x00, 0x06, 0x06, 0x02, 0x1e, 0x02, 0x0f, 0x19, 0x26, 0x00, 0x00 },	// U+267F (♿)
-	{ 0x00, 0x1f, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2680 (⚀)
-	{ 0x00, 0x1f, 0x11, 0x13, 0x11, 0x11, 0x11, 0x19, 0x11, 0x1f, 0x00, 0x00 },	// U+2681 (⚁)
-	{ 0x00, 0x1f, 0x11, 0x13, 0x11, 0x15, 0x11, 0x19, 0x11, 0x1f, 0x00, 0x00 },	// U+2682 (⚂)
-	{ 0x00, 0x1f, 0x11, 0x1b, 0x11, 0x11, 0x11, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+2683 (⚃)
-	{ 0x00, 0x1f, 0x11, 0x1b, 0x11, 0x15, 0x11, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+2684 (⚄)
-	{ 0x00, 0x1f, 0x11, 0x1b, 0x11, 0x1b, 0x11, 0x1b, 0x11, 0x1f, 0x00, 0x00 },	// U+2685 (⚅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x19, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2686 (⚆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1b, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2687 (⚇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x17, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+2688 (⚈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x15, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+2689 (⚉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+268A (⚊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00 },	// U+268B (⚋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+268C (⚌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+268D (⚍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+268E (⚎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+268F (⚏)
-	{ 0x00, 0x00, 0x00, 0x07, 0x19, 0x11, 0x13, 0x1d, 0x01, 0x01, 0x00, 0x00 },	// U+2690 (⚐)
-	{ 0x00, 0x00, 0x00, 0x07, 0x1f, 0x1f, 0x1f, 0x1d, 0x01, 0x01, 0x00, 0x00 },	// U+2691 (⚑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x33, 0x2d, 0x0c, 0x12, 0x21, 0x00, 0x00 },	// U+2692 (⚒)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x1f, 0x04, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+2693 (⚓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x1b, 0x11, 0x00, 0x00 },	// U+2694 (⚔)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x05, 0x0e, 0x14, 0x0c, 0x06, 0x0c, 0x04, 0x00 },	// U+2695 (⚕)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x15, 0x11, 0x11, 0x1b, 0x1b, 0x00, 0x00 },	// U+2696 (⚖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x11, 0x00, 0x38, 0x28, 0x00, 0x00 },	// U+2697 (⚗)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x15, 0x1f, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2698 (⚘)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x04, 0x00, 0x00 },	// U+2699 (⚙)
-	{ 0x00, 0x04, 0x0a, 0x04, 0x15, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+269A (⚚)
-	{ 0x00, 0x00, 0x00, 0x15, 0x0e, 0x1b, 0x0e, 0x1b, 0x0e, 0x15, 0x00, 0x00 },	// U+269B (⚛)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x11, 0x15, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+269C (⚜)
-}; // 132
-
-static const unsigned char orp_block59[][12] = {
-	{ 0x00, 0x04, 0x0a, 0x11, 0x15, 0x15, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+26A0 (⚠)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x1e, 0x08, 0x04, 0x02, 0x00, 0x00 },	// U+26A1 (⚡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x0e, 0x0a, 0x1f, 0x0a, 0x00 },	// U+26A2 (⚢)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x04, 0x36, 0x19, 0x15, 0x12, 0x0c, 0x00, 0x00 },	// U+26A3 (⚣)
-	{ 0x00, 0x00, 0x30, 0x30, 0x18, 0x26, 0x25, 0x19, 0x06, 0x02, 0x07, 0x02 },	// U+26A4 (⚤)
-	{ 0x00, 0x30, 0x30, 0x08, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x04 },	// U+26A5 (⚥)
-	{ 0x00, 0x30, 0x30, 0x18, 0x18, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+26A6 (⚦)
-	{ 0x00, 0x00, 0x00, 0x33, 0x33, 0x0c, 0x12, 0x12, 0x0c, 0x04, 0x0e, 0x04 },	// U+26A7 (⚧)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+26A8 (⚨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3d, 0x12, 0x00, 0x00, 0x00 },	// U+26A9 (⚩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+26AA (⚪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+26AB (⚫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+26AC (⚬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+26AD (⚭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+26AE (⚮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x12, 0x00, 0x00, 0x00 },	// U+26AF (⚯)
-	{ 0x00, 0x0e, 0x0a, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+26B0 (⚰)
-	{ 0x00, 0x1f, 0x0a, 0x0e, 0x11, 0x11, 0x11, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+26B1 (⚱)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+26B2 (⚲)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x10, 0x10, 0x10, 0x0c, 0x04, 0x0e, 0x04, 0x00 },	// U+26B3 (⚳)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x04, 0x0e, 0x04, 0x00 },	// U+26B4 (⚴)
-	{ 0x00, 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x04, 0x0e, 0x04, 0x00 },	// U+26B5 (⚵)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x11, 0x0a, 0x04, 0x00, 0x1b, 0x04, 0x00 },	// U+26B6 (⚶)
-	{ 0x00, 0x00, 0x14, 0x0c, 0x04, 0x0c, 0x14, 0x04, 0x0e, 0x11, 0x0e, 0x00 },	// U+26B7 (⚷)
-	{ 0x00, 0x00, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x04, 0x0e, 0x04, 0x00 },	// U+26B8 (⚸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x1f, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+26B9 (⚹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x1f, 0x00, 0x00 },	// U+26BA (⚺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+26BB (⚻)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x15, 0x1f, 0x04, 0x0c, 0x00, 0x00 },	// U+26BC (⚼)
-}; // 29
-
-static const unsigned char orp_block60[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+26C0 (⛀)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+26C1 (⛁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+26C2 (⛂)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x11, 0x1f, 0x0e, 0x00, 0x00 },	// U+26C3 (⛃)
-}; // 4
-
-static const unsigned char orp_block61[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x3f, 0x04, 0x02, 0x06, 0x00, 0x00, 0x00 },	// U+2701 (✁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x23, 0x13, 0x0c, 0x13, 0x23, 0x00, 0x00, 0x00 },	// U+2702 (✂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x04, 0x3f, 0x09, 0x00, 0x00, 0x00 },	// U+2703 (✃)
-	{ 0x00, 0x00, 0x00, 0x33, 0x29, 0x17, 0x0c, 0x17, 0x29, 0x33, 0x00, 0x00 },	// U+2704 (✄)
-}; // 4
-
-static const unsigned char orp_block62[][12] = {
-	{ 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x2d, 0x25, 0x2d, 0x2d, 0x21, 0x1e, 0x00 },	// U+2706 (✆)
-	{ 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x21, 0x2d, 0x21, 0x33, 0x21, 0x1e, 0x00 },	// U+2707 (✇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x3f, 0x0d, 0x04, 0x00, 0x00, 0x00 },	// U+2708 (✈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x33, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+2709 (✉)
-}; // 4
-
-static const unsigned char orp_block63[][12] = {
-	{ 0x00, 0x00, 0x12, 0x12, 0x14, 0x1c, 0x1e, 0x1e, 0x1e, 0x1c, 0x00, 0x00 },	// U+270C (✌)
-	{ 0x00, 0x00, 0x00, 0x20, 0x1c, 0x3e, 0x3e, 0x02, 0x01, 0x00, 0x00, 0x00 },	// U+270D (✍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0a, 0x14, 0x28, 0x30, 0x00, 0x00 },	// U+270E (✎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x1f, 0x00, 0x00, 0x00 },	// U+270F (✏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0x14, 0x0a, 0x07, 0x02, 0x00, 0x00 },	// U+2710 (✐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x21, 0x21, 0x1f, 0x00, 0x00, 0x00 },	// U+2711 (✑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x2f, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2712 (✒)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x08, 0x05, 0x07, 0x02, 0x00, 0x00 },	// U+2713 (✓)
-	{ 0x00, 0x00, 0x00, 0x30, 0x30, 0x38, 0x1b, 0x1f, 0x0e, 0x0c, 0x00, 0x00 },	// U+2714 (✔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2715 (✕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x04, 0x1f, 0x1b, 0x00, 0x00, 0x00 },	// U+2716 (✖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x01, 0x00, 0x00 },	// U+2717 (✗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x1e, 0x0e, 0x3f, 0x33, 0x03, 0x00 },	// U+2718 (✘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x33, 0x25, 0x2f, 0x25, 0x33, 0x1e, 0x00 },	// U+2719 (✙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00 },	// U+271A (✚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+271B (✛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x33, 0x33, 0x0c, 0x0c, 0x00, 0x00 },	// U+271C (✜)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+271D (✝)
-	{ 0x00, 0x0e, 0x0a, 0x1b, 0x11, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x00 },	// U+271E (✞)
-	{ 0x00, 0x1e, 0x3b, 0x3d, 0x3b, 0x1a, 0x1a, 0x1a, 0x1e, 0x1e, 0x00, 0x00 },	// U+271F (✟)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x15, 0x1f, 0x15, 0x04, 0x0e, 0x00, 0x00 },	// U+2720 (✠)
-	{ 0x00, 0x00, 0x00, 0x04, 0x1f, 0x0a, 0x0a, 0x0a, 0x1f, 0x04, 0x00, 0x00 },	// U+2721 (✡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2722 (✢)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x3f, 0x0c, 0x0c, 0x00, 0x00, 0x00 },	// U+2723 (✣)
-	{ 0x00, 0x00, 0x0c, 0x1e, 0x0c, 0x3f, 0x3f, 0x0c, 0x1e, 0x0c, 0x00, 0x00 },	// U+2724 (✤)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2725 (✥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2726 (✦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2727 (✧)
-}; // 28
-
-static const unsigned char orp_block64[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00 },	// U+2729 (✩)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x11, 0x1b, 0x15, 0x1f, 0x0e, 0x00, 0x00 },	// U+272A (✪)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0a, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+272B (✫)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+272C (✬)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+272D (✭)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00, 0x00 },	// U+272E (✮)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x17, 0x0c, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+272F (✯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x31, 0x1a, 0x35, 0x1a, 0x00, 0x00 },	// U+2730 (✰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2731 (✱)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0a, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2732 (✲)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2733 (✳)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2734 (✴)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2735 (✵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2736 (✶)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x0a, 0x00 },	// U+2737 (✷)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x0a, 0x00 },	// U+2738 (✸)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x3e, 0x1f, 0x3e, 0x1f, 0x0a, 0x00, 0x00 },	// U+2739 (✹)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x2e, 0x1f, 0x2e, 0x15, 0x0a, 0x00, 0x00 },	// U+273A (✺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+273B (✻)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0a, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+273C (✼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+273D (✽)
-	{ 0x00, 0x00, 0x00, 0x15, 0x1b, 0x0a, 0x15, 0x2e, 0x15, 0x04, 0x00, 0x00 },	// U+273E (✾)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1b, 0x0e, 0x1f, 0x1b, 0x00, 0x00, 0x00 },	// U+273F (✿)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x15, 0x0a, 0x1f, 0x1b, 0x00, 0x00, 0x00 },	// U+2740 (❀)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1b, 0x0e, 0x1f, 0x04, 0x00, 0x00, 0x00 },	// U+2741 (❁)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x15, 0x1b, 0x15, 0x1f, 0x0e, 0x00, 0x00 },	// U+2742 (❂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2743 (❃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2744 (❄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2745 (❅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2746 (❆)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2747 (❇)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2748 (❈)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+2749 (❉)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+274A (❊)
-	{ 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00, 0x00 },	// U+274B (❋)
-}; // 35
-
-static const unsigned char orp_block65[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x31, 0x31, 0x31, 0x1e, 0x00, 0x00, 0x00 },	// U+274D (❍)
-}; // 1
-
-static const unsigned char orp_block66[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00 },	// U+274F (❏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00 },	// U+2750 (❐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x31, 0x31, 0x31, 0x3f, 0x3e, 0x00, 0x00 },	// U+2751 (❑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3f, 0x31, 0x31, 0x31, 0x1f, 0x00, 0x00 },	// U+2752 (❒)
-}; // 4
-
-static const unsigned char orp_block67[][12] = {
-	{ 0x00, 0x00, 0x00, 0x08, 0x1c, 0x2a, 0x37, 0x2a, 0x1c, 0x08, 0x00, 0x00 },	// U+2756 (❖)
-}; // 1
-
-static const unsigned char orp_block68[][12] = {
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2758 (❘)
-	{ 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 },	// U+2759 (❙)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00 },	// U+275A (❚)
-	{ 0x00, 0x0c, 0x02, 0x0e, 0x1e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275B (❛)
-	{ 0x00, 0x0c, 0x1e, 0x1c, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275C (❜)
-	{ 0x00, 0x12, 0x09, 0x1b, 0x3f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275D (❝)
-	{ 0x00, 0x12, 0x3f, 0x36, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+275E (❞)
-}; // 7
-
-static const unsigned char orp_block69[][12] = {
-	{ 0x00, 0x10, 0x3e, 0x13, 0x13, 0x13, 0x1e, 0x10, 0x13, 0x11, 0x0e, 0x00 },	// U+2761 (❡)
-	{ 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2762 (❢)
-	{ 0x00, 0x00, 0x1b, 0x1f, 0x0e, 0x04, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2763 (❣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2764 (❤)
-	{ 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x1e, 0x0f, 0x0f, 0x06, 0x00, 0x00 },	// U+2765 (❥)
-	{ 0x00, 0x00, 0x26, 0x1d, 0x04, 0x1b, 0x1f, 0x0f, 0x27, 0x1e, 0x00, 0x00 },	// U+2766 (❦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x1e, 0x3b, 0x19, 0x02, 0x00, 0x00 },	// U+2767 (❧)
-	{ 0x00, 0x00, 0x08, 0x04, 0x06, 0x06, 0x06, 0x06, 0x04, 0x08, 0x00, 0x00 },	// U+2768 (❨)
-	{ 0x00, 0x00, 0x02, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x02, 0x00, 0x00 },	// U+2769 (❩)
-	{ 0x00, 0x00, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x00, 0x00 },	// U+276A (❪)
-	{ 0x00, 0x00, 0x02, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02, 0x00, 0x00 },	// U+276B (❫)
-	{ 0x00, 0x00, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x00 },	// U+276C (❬)
-	{ 0x00, 0x00, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x00 },	// U+276D (❭)
-	{ 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+276E (❮)
-	{ 0x00, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00 },	// U+276F (❯)
-	{ 0x00, 0x00, 0x1c, 0x1c, 0x0e, 0x0e, 0x07, 0x0e, 0x0e, 0x1c, 0x1c, 0x00 },	// U+2770 (❰)
-	{ 0x00, 0x00, 0x07, 0x07, 0x0e, 0x0e, 0x1c, 0x0e, 0x0e, 0x07, 0x07, 0x00 },	// U+2771 (❱)
-	{ 0x00, 0x00, 0x08, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00 },	// U+2772 (❲)
-	{ 0x00, 0x00, 0x02, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x02, 0x00 },	// U+2773 (❳)
-	{ 0x00, 0x00, 0x18, 0x0c, 0x0c, 0x0c, 0x06, 0x0c, 0x0c, 0x0c, 0x18, 0x00 },	// U+2774 (❴)
-	{ 0x00, 0x00, 0x06, 0x0c, 0x0c, 0x0c, 0x18, 0x0c, 0x0c, 0x0c, 0x06, 0x00 },	// U+2775 (❵)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x19, 0x1b, 0x1b, 0x11, 0x1f, 0x0e, 0x00, 0x00 },	// U+2776 (❶)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x17, 0x1b, 0x11, 0x1f, 0x0e, 0x00, 0x00 },	// U+2777 (❷)
-	{ 0x00, 0x0e, 0x1f, 0x19, 0x17, 0x1b, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+2778 (❸)
-	{ 0x00, 0x0e, 0x1f, 0x1d, 0x1d, 0x19, 0x11, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+2779 (❹)
-	{ 0x00, 0x0e, 0x1f, 0x11, 0x1d, 0x19, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+277A (❺)
-	{ 0x00, 0x0e, 0x1f, 0x13, 0x1d, 0x19, 0x15, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+277B (❻)
-	{ 0x00, 0x0e, 0x1f, 0x11, 0x17, 0x1b, 0x1b, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+277C (❼)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x1b, 0x15, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+277D (❽)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x13, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+277E (❾)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x29, 0x29, 0x29, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+277F (❿)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x17, 0x15, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2780 (➀)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x19, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2781 (➁)
-	{ 0x00, 0x0e, 0x11, 0x17, 0x19, 0x15, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2782 (➂)
-	{ 0x00, 0x0e, 0x11, 0x13, 0x13, 0x17, 0x1f, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2783 (➃)
-	{ 0x00, 0x0e, 0x11, 0x1f, 0x13, 0x17, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2784 (➄)
-	{ 0x00, 0x0e, 0x11, 0x1d, 0x13, 0x17, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2785 (➅)
-	{ 0x00, 0x0e, 0x11, 0x1f, 0x19, 0x15, 0x15, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2786 (➆)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x15, 0x1b, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2787 (➇)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x1d, 0x19, 0x17, 0x11, 0x0e, 0x00, 0x00 },	// U+2788 (➈)
-	{ 0x00, 0x1e, 0x21, 0x2b, 0x37, 0x37, 0x37, 0x2b, 0x21, 0x1e, 0x00, 0x00 },	// U+2789 (➉)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x19, 0x1b, 0x1b, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+278A (➊)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x17, 0x1b, 0x11, 0x1f, 0x0e, 0x00, 0x00 },	// U+278B (➋)
-	{ 0x00, 0x0e, 0x1f, 0x19, 0x17, 0x1b, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+278C (➌)
-	{ 0x00, 0x0e, 0x1f, 0x1d, 0x1d, 0x19, 0x11, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+278D (➍)
-	{ 0x00, 0x0e, 0x1f, 0x11, 0x1d, 0x19, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+278E (➎)
-	{ 0x00, 0x0e, 0x1f, 0x13, 0x1d, 0x19, 0x15, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+278F (➏)
-	{ 0x00, 0x0e, 0x1f, 0x11, 0x17, 0x1b, 0x1b, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+2790 (➐)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x1b, 0x15, 0x1b, 0x1f, 0x0e, 0x00, 0x00 },	// U+2791 (➑)
-	{ 0x00, 0x0e, 0x1f, 0x1b, 0x15, 0x13, 0x17, 0x19, 0x1f, 0x0e, 0x00, 0x00 },	// U+2792 (➒)
-	{ 0x00, 0x1e, 0x3f, 0x35, 0x29, 0x29, 0x29, 0x35, 0x3f, 0x1e, 0x00, 0x00 },	// U+2793 (➓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x3f, 0x18, 0x0c, 0x00, 0x00, 0x00 },	// U+2794 (➔)
-}; // 52
-
-static const unsigned char orp_block70[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00 },	// U+2798 (➘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1f, 0x0c, 0x04, 0x00, 0x00, 0x00 },	// U+2799 (➙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x01, 0x00, 0x00 },	// U+279A (➚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x3f, 0x0c, 0x02, 0x00, 0x00, 0x00 },	// U+279B (➛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x3f, 0x3f, 0x1c, 0x0c, 0x00, 0x00 },	// U+279C (➜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3f, 0x10, 0x00, 0x00, 0x00, 0x00 },	// U+279D (➝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x3f, 0x3f, 0x18, 0x08, 0x00, 0x00 },	// U+279E (➞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3d, 0x10, 0x00, 0x00, 0x00 },	// U+279F (➟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x3d, 0x3d, 0x18, 0x08, 0x00, 0x00 },	// U+27A0 (➠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x3f, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+27A1 (➡)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0d, 0x12, 0x3c, 0x1e, 0x0f, 0x03, 0x00, 0x00 },	// U+27A2 (➢)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1e, 0x3c, 0x12, 0x0d, 0x03, 0x00, 0x00 },	// U+27A3 (➣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x3c, 0x1e, 0x07, 0x00, 0x00, 0x00 },	// U+27A4 (➤)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x1f, 0x3f, 0x1e, 0x08, 0x00, 0x00, 0x00 },	// U+27A5 (➥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x3f, 0x1f, 0x09, 0x01, 0x00, 0x00 },	// U+27A6 (➦)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0f, 0x1f, 0x3f, 0x1f, 0x0f, 0x04, 0x00, 0x00 },	// U+27A7 (➧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x3f, 0x0f, 0x04, 0x00, 0x00, 0x00 },	// U+27A8 (➨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27A9 (➩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27AA (➪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27AB (➫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27AC (➬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x21, 0x17, 0x08, 0x00, 0x00 },	// U+27AD (➭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x21, 0x17, 0x08, 0x00, 0x00 },	// U+27AE (➮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27AF (➯)
-}; // 24
-
-static const unsigned char orp_block71[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x21, 0x17, 0x08, 0x00, 0x00, 0x00 },	// U+27B1 (➱)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x3b, 0x30, 0x20, 0x30, 0x3b, 0x1e, 0x00, 0x00 },	// U+27B2 (➲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x17, 0x00, 0x00, 0x00 },	// U+27B3 (➳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x06, 0x08, 0x30, 0x30, 0x00, 0x00 },	// U+27B4 (➴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x17, 0x00, 0x00, 0x00 },	// U+27B5 (➵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x08, 0x06, 0x07, 0x02, 0x00, 0x00 },	// U+27B6 (➶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x28, 0x30, 0x38, 0x00, 0x00 },	// U+27B7 (➷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x17, 0x3e, 0x17, 0x03, 0x00, 0x00 },	// U+27B8 (➸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x28, 0x07, 0x07, 0x06, 0x00, 0x00 },	// U+27B9 (➹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x3f, 0x13, 0x08, 0x00, 0x00 },	// U+27BA (➺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x3f, 0x13, 0x08, 0x00, 0x00 },	// U+27BB (➻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3e, 0x17, 0x00, 0x00, 0x00 },	// U+27BC (➼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3f, 0x3f, 0x17, 0x00, 0x00, 0x00 },	// U+27BD (➽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x17, 0x20, 0x17, 0x0a, 0x00, 0x00 },	// U+27BE (➾)
-}; // 14
-
-static const unsigned char orp_block72[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x1f, 0x00, 0x00 },	// U+27C0 (⟀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0e, 0x15, 0x1f, 0x00, 0x00 },	// U+27C1 (⟁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+27C2 (⟂)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x01, 0x09, 0x15, 0x09, 0x01, 0x1e, 0x00, 0x00 },	// U+27C3 (⟃)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x12, 0x15, 0x12, 0x10, 0x0f, 0x00, 0x00 },	// U+27C4 (⟄)
-	{ 0x00, 0x04, 0x0a, 0x0a, 0x08, 0x08, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00 },	// U+27C5 (⟅)
-	{ 0x00, 0x08, 0x14, 0x14, 0x04, 0x04, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00 },	// U+27C6 (⟆)
-	{ 0x00, 0x00, 0x00, 0x11, 0x15, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+27C7 (⟇)
-	{ 0x00, 0x00, 0x01, 0x39, 0x05, 0x05, 0x05, 0x3a, 0x02, 0x02, 0x00, 0x00 },	// U+27C8 (⟈)
-	{ 0x00, 0x00, 0x20, 0x27, 0x28, 0x28, 0x28, 0x17, 0x10, 0x10, 0x00, 0x00 },	// U+27C9 (⟉)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+27CA (⟊)
-}; // 11
-
-static const unsigned char orp_block73[][12] = {
-	{ 0x00, 0x00, 0x00, 0x3f, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00, 0x00 },	// U+27CC (⟌)
-}; // 1
-
-static const unsigned char orp_block74[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x15, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+27D0 (⟐)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x15, 0x11, 0x00, 0x00 },	// U+27D1 (⟑)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+27D2 (⟒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x14, 0x10, 0x1f, 0x00, 0x00, 0x00 },	// U+27D3 (⟓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00 },	// U+27D4 (⟔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x23, 0x36, 0x2a, 0x36, 0x23, 0x00, 0x00, 0x00 },	// U+27D5 (⟕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x31, 0x1b, 0x15, 0x1b, 0x31, 0x00, 0x00, 0x00 },	// U+27D6 (⟖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1e, 0x12, 0x1e, 0x33, 0x00, 0x00 },	// U+27D7 (⟗)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+27D8 (⟘)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+27D9 (⟙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1b, 0x0a, 0x1b, 0x0a, 0x00, 0x00, 0x00 },	// U+27DA (⟚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1b, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+27DB (⟛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3d, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+27DC (⟜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x00 },	// U+27DD (⟝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x00 },	// U+27DE (⟞)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+27DF (⟟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+27E0 (⟠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+27E1 (⟡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x23, 0x14, 0x08, 0x00, 0x00, 0x00 },	// U+27E2 (⟢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x31, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+27E3 (⟣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3e, 0x22, 0x23, 0x22, 0x3e, 0x00, 0x00, 0x00 },	// U+27E4 (⟤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x31, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+27E5 (⟥)
-	{ 0x00, 0x1f, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x1f, 0x00 },	// U+27E6 (⟦)
-	{ 0x00, 0x1f, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1f, 0x00 },	// U+27E7 (⟧)
-	{ 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00 },	// U+27E8 (⟨)
-	{ 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00 },	// U+27E9 (⟩)
-	{ 0x00, 0x28, 0x14, 0x14, 0x0a, 0x0a, 0x05, 0x0a, 0x0a, 0x14, 0x14, 0x28 },	// U+27EA (⟪)
-	{ 0x00, 0x05, 0x0a, 0x0a, 0x14, 0x14, 0x28, 0x14, 0x14, 0x0a, 0x0a, 0x05 },	// U+27EB (⟫)
-	{ 0x00, 0x10, 0x08, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0c, 0x08, 0x10 },	// U+27EC (⟬)
-	{ 0x02, 0x04, 0x0c, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0c, 0x04, 0x02 },	// U+27ED (⟭)
-	{ 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+27EE (⟮)
-	{ 0x00, 0x00, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00 },	// U+27EF (⟯)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+27F0 (⟰)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+27F1 (⟱)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x22, 0x27, 0x22, 0x20, 0x22, 0x1c, 0x00, 0x00 },	// U+27F2 (⟲)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x39, 0x11, 0x01, 0x11, 0x0e, 0x00, 0x00 },	// U+27F3 (⟳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x3f, 0x16, 0x00, 0x00, 0x00, 0x00 },	// U+27F4 (⟴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+27F5 (⟵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x3f, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+27F6 (⟶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3f, 0x12, 0x00, 0x00, 0x00, 0x00 },	// U+27F7 (⟷)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x3e, 0x01, 0x3e, 0x04, 0x08, 0x00, 0x00 },	// U+27F8 (⟸)
-	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x20, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+27F9 (⟹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x12, 0x3f, 0x21, 0x3f, 0x12, 0x00, 0x00, 0x00 },	// U+27FA (⟺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x24, 0x22, 0x3f, 0x22, 0x24, 0x00, 0x00, 0x00 },	// U+27FB (⟻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x3f, 0x11, 0x09, 0x00, 0x00, 0x00 },	// U+27FC (⟼)
-	{ 0x00, 0x00, 0x00, 0x28, 0x24, 0x3e, 0x21, 0x3e, 0x24, 0x28, 0x00, 0x00 },	// U+27FD (⟽)
-	{ 0x00, 0x00, 0x00, 0x05, 0x09, 0x1f, 0x21, 0x1f, 0x09, 0x05, 0x00, 0x00 },	// U+27FE (⟾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x35, 0x10, 0x00, 0x00, 0x00 },	// U+27FF (⟿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2800 (⠀)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2801 (⠁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2802 (⠂)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2803 (⠃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2804 (⠄)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2805 (⠅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2806 (⠆)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2807 (⠇)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2808 (⠈)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2809 (⠉)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+280A (⠊)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+280B (⠋)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+280C (⠌)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+280D (⠍)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+280E (⠎)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+280F (⠏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2810 (⠐)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2811 (⠑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2812 (⠒)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2813 (⠓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2814 (⠔)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2815 (⠕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2816 (⠖)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+2817 (⠗)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2818 (⠘)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2819 (⠙)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+281A (⠚)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+281B (⠛)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+281C (⠜)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+281D (⠝)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+281E (⠞)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00 },	// U+281F (⠟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2820 (⠠)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2821 (⠡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2822 (⠢)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2823 (⠣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2824 (⠤)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2825 (⠥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2826 (⠦)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2827 (⠧)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2828 (⠨)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2829 (⠩)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+282A (⠪)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+282B (⠫)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+282C (⠬)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+282D (⠭)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+282E (⠮)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+282F (⠯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2830 (⠰)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2831 (⠱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2832 (⠲)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2833 (⠳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2834 (⠴)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2835 (⠵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2836 (⠶)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+2837 (⠷)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2838 (⠸)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+2839 (⠹)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+283A (⠺)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+283B (⠻)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+283C (⠼)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+283D (⠽)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+283E (⠾)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00 },	// U+283F (⠿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2840 (⡀)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2841 (⡁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2842 (⡂)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2843 (⡃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2844 (⡄)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2845 (⡅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2846 (⡆)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2847 (⡇)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2848 (⡈)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2849 (⡉)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+284A (⡊)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+284B (⡋)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+284C (⡌)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+284D (⡍)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+284E (⡎)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+284F (⡏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2850 (⡐)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2851 (⡑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2852 (⡒)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2853 (⡓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2854 (⡔)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2855 (⡕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2856 (⡖)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+2857 (⡗)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2858 (⡘)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+2859 (⡙)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+285A (⡚)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03 },	// U+285B (⡛)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+285C (⡜)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+285D (⡝)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+285E (⡞)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03 },	// U+285F (⡟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2860 (⡠)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2861 (⡡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2862 (⡢)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2863 (⡣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2864 (⡤)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2865 (⡥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2866 (⡦)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2867 (⡧)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2868 (⡨)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2869 (⡩)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+286A (⡪)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+286B (⡫)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+286C (⡬)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+286D (⡭)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+286E (⡮)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+286F (⡯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2870 (⡰)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2871 (⡱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2872 (⡲)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2873 (⡳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2874 (⡴)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2875 (⡵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2876 (⡶)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+2877 (⡷)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2878 (⡸)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+2879 (⡹)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+287A (⡺)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03 },	// U+287B (⡻)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+287C (⡼)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+287D (⡽)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+287E (⡾)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03 },	// U+287F (⡿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2880 (⢀)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2881 (⢁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2882 (⢂)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2883 (⢃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2884 (⢄)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2885 (⢅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2886 (⢆)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2887 (⢇)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2888 (⢈)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2889 (⢉)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+288A (⢊)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+288B (⢋)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+288C (⢌)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+288D (⢍)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+288E (⢎)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+288F (⢏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2890 (⢐)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2891 (⢑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2892 (⢒)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2893 (⢓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2894 (⢔)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2895 (⢕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2896 (⢖)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+2897 (⢗)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2898 (⢘)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+2899 (⢙)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+289A (⢚)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18 },	// U+289B (⢛)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+289C (⢜)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+289D (⢝)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+289E (⢞)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18 },	// U+289F (⢟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A0 (⢠)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A1 (⢡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A2 (⢢)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A3 (⢣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28A4 (⢤)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28A5 (⢥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28A6 (⢦)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28A7 (⢧)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A8 (⢨)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28A9 (⢩)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28AA (⢪)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28AB (⢫)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28AC (⢬)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28AD (⢭)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28AE (⢮)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28AF (⢯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B0 (⢰)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B1 (⢱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B2 (⢲)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B3 (⢳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28B4 (⢴)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28B5 (⢵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28B6 (⢶)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28B7 (⢷)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B8 (⢸)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28B9 (⢹)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28BA (⢺)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18 },	// U+28BB (⢻)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28BC (⢼)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28BD (⢽)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28BE (⢾)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18 },	// U+28BF (⢿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C0 (⣀)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C1 (⣁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C2 (⣂)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C3 (⣃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28C4 (⣄)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28C5 (⣅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28C6 (⣆)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28C7 (⣇)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C8 (⣈)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28C9 (⣉)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28CA (⣊)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28CB (⣋)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28CC (⣌)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28CD (⣍)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28CE (⣎)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28CF (⣏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D0 (⣐)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D1 (⣑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D2 (⣒)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D3 (⣓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28D4 (⣔)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28D5 (⣕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28D6 (⣖)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28D7 (⣗)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D8 (⣘)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28D9 (⣙)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28DA (⣚)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b },	// U+28DB (⣛)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28DC (⣜)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28DD (⣝)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28DE (⣞)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b },	// U+28DF (⣟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E0 (⣠)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E1 (⣡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E2 (⣢)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E3 (⣣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28E4 (⣤)
-	{ 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28E5 (⣥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28E6 (⣦)
-	{ 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28E7 (⣧)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E8 (⣨)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28E9 (⣩)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28EA (⣪)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28EB (⣫)
-	{ 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28EC (⣬)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28ED (⣭)
-	{ 0x00, 0x18, 0x18, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28EE (⣮)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28EF (⣯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F0 (⣰)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F1 (⣱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F2 (⣲)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F3 (⣳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28F4 (⣴)
-	{ 0x00, 0x03, 0x03, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28F5 (⣵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28F6 (⣶)
-	{ 0x00, 0x03, 0x03, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28F7 (⣷)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F8 (⣸)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28F9 (⣹)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28FA (⣺)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b },	// U+28FB (⣻)
-	{ 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28FC (⣼)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28FD (⣽)
-	{ 0x00, 0x18, 0x18, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28FE (⣾)
-	{ 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b, 0x00, 0x1b, 0x1b },	// U+28FF (⣿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1a, 0x3f, 0x1a, 0x02, 0x00, 0x00, 0x00 },	// U+2900 (⤀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x16, 0x3f, 0x16, 0x06, 0x00, 0x00, 0x00 },	// U+2901 (⤁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x3e, 0x11, 0x3e, 0x14, 0x00, 0x00, 0x00 },	// U+2902 (⤂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x22, 0x1f, 0x0a, 0x00, 0x00, 0x00 },	// U+2903 (⤃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x25, 0x1e, 0x04, 0x00, 0x00, 0x00 },	// U+2904 (⤄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3f, 0x19, 0x00, 0x00, 0x00, 0x00 },	// U+2905 (⤅)
-	{ 0x00, 0x00, 0x00, 0x28, 0x24, 0x3e, 0x21, 0x3e, 0x24, 0x28, 0x00, 0x00 },	// U+2906 (⤆)
-	{ 0x00, 0x00, 0x00, 0x05, 0x09, 0x1f, 0x21, 0x1f, 0x09, 0x05, 0x00, 0x00 },	// U+2907 (⤇)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2908 (⤈)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2909 (⤉)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+290A (⤊)
-	{ 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+290B (⤋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x37, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+290C (⤌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x3b, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+290D (⤍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x2b, 0x02, 0x04, 0x00, 0x00, 0x00 },	// U+290E (⤎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x35, 0x10, 0x08, 0x00, 0x00, 0x00 },	// U+290F (⤏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x36, 0x19, 0x00, 0x00, 0x00 },	// U+2910 (⤐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x15, 0x08, 0x04, 0x00, 0x00 },	// U+2911 (⤑)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2912 (⤒)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x1f, 0x00, 0x00 },	// U+2913 (⤓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x3e, 0x15, 0x04, 0x00, 0x00, 0x00 },	// U+2914 (⤔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x3e, 0x1d, 0x0c, 0x00, 0x00, 0x00 },	// U+2915 (⤕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0x19, 0x00, 0x00, 0x00, 0x00 },	// U+2916 (⤖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x3e, 0x1d, 0x04, 0x00, 0x00, 0x00 },	// U+2917 (⤗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x1f, 0x3e, 0x1f, 0x06, 0x00, 0x00, 0x00 },	// U+2918 (⤘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00 },	// U+2919 (⤙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x3c, 0x02, 0x01, 0x00, 0x00 },	// U+291A (⤚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x0f, 0x0a, 0x14, 0x00, 0x00 },	// U+291B (⤛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0a, 0x3c, 0x0a, 0x05, 0x00, 0x00 },	// U+291C (⤜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3d, 0x08, 0x00, 0x00, 0x00 },	// U+291D (⤝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2f, 0x04, 0x00, 0x00, 0x00 },	// U+291E (⤞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x3d, 0x28, 0x00, 0x00, 0x00 },	// U+291F (⤟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2f, 0x05, 0x00, 0x00, 0x00 },	// U+2920 (⤠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x15, 0x18, 0x1c, 0x00, 0x00 },	// U+2921 (⤡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x15, 0x03, 0x07, 0x00, 0x00 },	// U+2922 (⤢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x08, 0x10, 0x18, 0x00, 0x00 },	// U+2923 (⤣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x18, 0x14, 0x02, 0x01, 0x03, 0x00, 0x00 },	// U+2924 (⤤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00 },	// U+2925 (⤥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x08, 0x05, 0x03, 0x07, 0x00, 0x00 },	// U+2926 (⤦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2927 (⤧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x04, 0x1a, 0x19, 0x00, 0x00 },	// U+2928 (⤨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x1b, 0x1b, 0x00, 0x00 },	// U+2929 (⤩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0b, 0x04, 0x0b, 0x13, 0x00, 0x00 },	// U+292A (⤪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+292B (⤫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+292C (⤬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x04, 0x1a, 0x19, 0x00, 0x00 },	// U+292D (⤭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x04, 0x1a, 0x19, 0x00, 0x00 },	// U+292E (⤮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x1a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+292F (⤯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x1a, 0x19, 0x00, 0x00 },	// U+2930 (⤰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2931 (⤱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2932 (⤲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3d, 0x10, 0x00, 0x00, 0x00 },	// U+2933 (⤳)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00 },	// U+2934 (⤴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2935 (⤵)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x14, 0x12, 0x0f, 0x02, 0x04, 0x00, 0x00 },	// U+2936 (⤶)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x09, 0x1e, 0x08, 0x04, 0x00, 0x00 },	// U+2937 (⤷)
-	{ 0x00, 0x00, 0x04, 0x08, 0x10, 0x10, 0x10, 0x0a, 0x06, 0x0e, 0x00, 0x00 },	// U+2938 (⤸)
-	{ 0x00, 0x00, 0x08, 0x04, 0x02, 0x02, 0x02, 0x14, 0x18, 0x1c, 0x00, 0x00 },	// U+2939 (⤹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x13, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+293A (⤺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x19, 0x16, 0x00, 0x00, 0x00, 0x00 },	// U+293B (⤻)
-	{ 0x00, 0x00, 0x00, 0x16, 0x19, 0x1c, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+293C (⤼)
-	{ 0x00, 0x0d, 0x13, 0x07, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+293D (⤽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x17, 0x13, 0x0d, 0x00, 0x00, 0x00 },	// U+293E (⤾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x1d, 0x19, 0x16, 0x00, 0x00, 0x00 },	// U+293F (⤿)
-	{ 0x00, 0x00, 0x08, 0x04, 0x1e, 0x25, 0x29, 0x21, 0x21, 0x1e, 0x00, 0x00 },	// U+2940 (⥀)
-	{ 0x00, 0x00, 0x04, 0x08, 0x1e, 0x29, 0x25, 0x21, 0x21, 0x1e, 0x00, 0x00 },	// U+2941 (⥁)
-	{ 0x00, 0x08, 0x10, 0x3f, 0x10, 0x08, 0x00, 0x02, 0x0f, 0x02, 0x00, 0x00 },	// U+2942 (⥂)
-	{ 0x00, 0x00, 0x04, 0x02, 0x3f, 0x02, 0x04, 0x10, 0x3c, 0x10, 0x00, 0x00 },	// U+2943 (⥃)
-	{ 0x00, 0x00, 0x10, 0x3c, 0x10, 0x04, 0x02, 0x3f, 0x02, 0x04, 0x00, 0x00 },	// U+2944 (⥄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x02, 0x07, 0x02, 0x00, 0x00 },	// U+2945 (⥅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x08, 0x1c, 0x08, 0x00, 0x00 },	// U+2946 (⥆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x3f, 0x16, 0x00, 0x00, 0x00 },	// U+2947 (⥇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x1e, 0x00, 0x00, 0x00 },	// U+2948 (⥈)
-	{ 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x15, 0x04, 0x04, 0x04, 0x0a, 0x04, 0x00 },	// U+2949 (⥉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+294A (⥊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+294B (⥋)
-	{ 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x00 },	// U+294C (⥌)
-	{ 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x00 },	// U+294D (⥍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+294E (⥎)
-	{ 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x00 },	// U+294F (⥏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x00, 0x00, 0x00 },	// U+2950 (⥐)
-	{ 0x00, 0x00, 0x08, 0x0c, 0x0a, 0x08, 0x08, 0x08, 0x0a, 0x0c, 0x08, 0x00 },	// U+2951 (⥑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x3f, 0x01, 0x01, 0x00, 0x00 },	// U+2952 (⥒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x28, 0x3f, 0x20, 0x20, 0x00, 0x00 },	// U+2953 (⥓)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2954 (⥔)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x1f, 0x00, 0x00 },	// U+2955 (⥕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3f, 0x05, 0x09, 0x00, 0x00 },	// U+2956 (⥖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3f, 0x28, 0x24, 0x00, 0x00 },	// U+2957 (⥗)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2958 (⥘)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x1f, 0x00, 0x00 },	// U+2959 (⥙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1f, 0x10, 0x00, 0x00, 0x00 },	// U+295A (⥚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1f, 0x01, 0x00, 0x00, 0x00 },	// U+295B (⥛)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x14, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+295C (⥜)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x14, 0x0c, 0x04, 0x00, 0x00 },	// U+295D (⥝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x12, 0x00, 0x00, 0x00 },	// U+295E (⥞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x09, 0x00, 0x00, 0x00 },	// U+295F (⥟)
-	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+2960 (⥠)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x00, 0x00 },	// U+2961 (⥡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x00, 0x1f, 0x02, 0x00, 0x00 },	// U+2962 (⥢)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2963 (⥣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x1f, 0x08, 0x00, 0x00 },	// U+2964 (⥤)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1b, 0x0a, 0x00, 0x00 },	// U+2965 (⥥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x00, 0x08, 0x1f, 0x00, 0x00, 0x00 },	// U+2966 (⥦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x1f, 0x08, 0x00, 0x00 },	// U+2967 (⥧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x02, 0x1f, 0x00, 0x00, 0x00 },	// U+2968 (⥨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x00, 0x1f, 0x02, 0x00, 0x00 },	// U+2969 (⥩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+296A (⥪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x02, 0x00, 0x00 },	// U+296B (⥫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+296C (⥬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x08, 0x00, 0x00 },	// U+296D (⥭)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0b, 0x0a, 0x0a, 0x0a, 0x1a, 0x0a, 0x00, 0x00 },	// U+296E (⥮)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x1a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x00, 0x00 },	// U+296F (⥯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+2970 (⥰)
-	{ 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+2971 (⥱)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+2972 (⥲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2973 (⥳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2974 (⥴)
-	{ 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2975 (⥵)
-	{ 0x00, 0x00, 0x18, 0x06, 0x01, 0x06, 0x18, 0x00, 0x02, 0x1f, 0x02, 0x00 },	// U+2976 (⥶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0a, 0x1f, 0x0a, 0x10, 0x00, 0x00 },	// U+2977 (⥷)
-	{ 0x00, 0x00, 0x03, 0x0c, 0x10, 0x0c, 0x03, 0x08, 0x1f, 0x08, 0x00, 0x00 },	// U+2978 (⥸)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00 },	// U+2979 (⥹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0a, 0x1f, 0x0a, 0x30, 0x00, 0x00 },	// U+297A (⥺)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x00 },	// U+297B (⥻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x1e, 0x01, 0x02, 0x00, 0x00 },	// U+297C (⥼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x0f, 0x10, 0x08, 0x00, 0x00 },	// U+297D (⥽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+297E (⥾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x15, 0x0a, 0x00, 0x00 },	// U+297F (⥿)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2980 (⦀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x1e, 0x0c, 0x00, 0x00, 0x00 },	// U+2981 (⦁)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+2982 (⦂)
-	{ 0x00, 0x00, 0x1c, 0x0a, 0x0a, 0x0a, 0x09, 0x0a, 0x0a, 0x0a, 0x1c, 0x00 },	// U+2983 (⦃)
-	{ 0x00, 0x00, 0x07, 0x0a, 0x0a, 0x0a, 0x12, 0x0a, 0x0a, 0x0a, 0x07, 0x00 },	// U+2984 (⦄)
-	{ 0x00, 0x10, 0x08, 0x0c, 0x0c, 0x0a, 0x0a, 0x0c, 0x0c, 0x08, 0x10, 0x00 },	// U+2985 (⦅)
-	{ 0x00, 0x02, 0x04, 0x0c, 0x0c, 0x14, 0x14, 0x0c, 0x0c, 0x04, 0x02, 0x00 },	// U+2986 (⦆)
-	{ 0x00, 0x08, 0x0c, 0x0c, 0x0a, 0x0a, 0x0a, 0x0a, 0x0c, 0x0c, 0x08, 0x00 },	// U+2987 (⦇)
-	{ 0x00, 0x02, 0x06, 0x06, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x06, 0x02, 0x00 },	// U+2988 (⦈)
-	{ 0x00, 0x10, 0x18, 0x18, 0x14, 0x14, 0x12, 0x14, 0x14, 0x18, 0x18, 0x10 },	// U+2989 (⦉)
-	{ 0x00, 0x02, 0x06, 0x06, 0x0a, 0x0a, 0x12, 0x0a, 0x0a, 0x06, 0x06, 0x02 },	// U+298A (⦊)
-	{ 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00, 0x0e },	// U+298B (⦋)
-	{ 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00, 0x0e },	// U+298C (⦌)
-	{ 0x00, 0x0e, 0x06, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00 },	// U+298D (⦍)
-	{ 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x0c, 0x0e, 0x00 },	// U+298E (⦎)
-	{ 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0a, 0x06, 0x0e, 0x00 },	// U+298F (⦏)
-	{ 0x00, 0x0e, 0x0c, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00 },	// U+2990 (⦐)
-	{ 0x00, 0x10, 0x08, 0x08, 0x04, 0x04, 0x12, 0x04, 0x04, 0x08, 0x08, 0x10 },	// U+2991 (⦑)
-	{ 0x00, 0x02, 0x04, 0x04, 0x08, 0x08, 0x12, 0x08, 0x08, 0x04, 0x04, 0x02 },	// U+2992 (⦒)
-	{ 0x00, 0x00, 0x08, 0x04, 0x1c, 0x06, 0x05, 0x06, 0x1c, 0x04, 0x08, 0x00 },	// U+2993 (⦓)
-	{ 0x00, 0x00, 0x02, 0x04, 0x07, 0x0c, 0x14, 0x0c, 0x07, 0x04, 0x02, 0x00 },	// U+2994 (⦔)
-	{ 0x00, 0x00, 0x14, 0x0a, 0x0b, 0x0e, 0x1a, 0x0e, 0x0b, 0x0a, 0x14, 0x00 },	// U+2995 (⦕)
-	{ 0x00, 0x00, 0x05, 0x0a, 0x1a, 0x0e, 0x0b, 0x0e, 0x1a, 0x0a, 0x05, 0x00 },	// U+2996 (⦖)
-	{ 0x00, 0x08, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x08, 0x00 },	// U+2997 (⦗)
-	{ 0x00, 0x02, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x04, 0x02, 0x00 },	// U+2998 (⦘)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+2999 (⦙)
-	{ 0x00, 0x00, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x00, 0x00 },	// U+299A (⦚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x14, 0x3f, 0x00, 0x00, 0x00 },	// U+299B (⦛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x05, 0x1f, 0x00, 0x00 },	// U+299C (⦜)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x09, 0x15, 0x11, 0x3f, 0x00, 0x00 },	// U+299D (⦝)
-	{ 0x00, 0x08, 0x08, 0x04, 0x34, 0x12, 0x22, 0x31, 0x01, 0x3f, 0x00, 0x00 },	// U+299E (⦞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x06, 0x3f, 0x00, 0x00 },	// U+299F (⦟)
-	{ 0x00, 0x00, 0x00, 0x09, 0x06, 0x1c, 0x24, 0x1c, 0x06, 0x09, 0x00, 0x00 },	// U+29A0 (⦠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0e, 0x1b, 0x04, 0x00, 0x00 },	// U+29A1 (⦡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00 },	// U+29A2 (⦢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x3f, 0x00, 0x00, 0x00 },	// U+29A3 (⦣)
-	{ 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x3f, 0x00, 0x3f, 0x00, 0x00 },	// U+29A4 (⦤)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x3f, 0x00, 0x3f, 0x00, 0x00 },	// U+29A5 (⦥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00 },	// U+29A6 (⦦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x01, 0x00, 0x00, 0x00 },	// U+29A7 (⦧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x04, 0x0a, 0x3f, 0x00, 0x00, 0x00 },	// U+29A8 (⦨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x08, 0x14, 0x3f, 0x00, 0x00, 0x00 },	// U+29A9 (⦩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0a, 0x04, 0x18, 0x18, 0x00, 0x00, 0x00 },	// U+29AA (⦪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x14, 0x08, 0x06, 0x06, 0x00, 0x00, 0x00 },	// U+29AB (⦫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x1b, 0x05, 0x03, 0x01, 0x00, 0x00 },	// U+29AC (⦬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x13, 0x1b, 0x14, 0x18, 0x10, 0x00, 0x00 },	// U+29AD (⦭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x1b, 0x19, 0x01, 0x00, 0x00 },	// U+29AE (⦮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x1b, 0x13, 0x10, 0x00, 0x00 },	// U+29AF (⦯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x1a, 0x1c, 0x20, 0x00, 0x00 },	// U+29B0 (⦰)
-	{ 0x00, 0x00, 0x1e, 0x00, 0x20, 0x1c, 0x1a, 0x16, 0x0e, 0x01, 0x00, 0x00 },	// U+29B1 (⦱)
-	{ 0x00, 0x04, 0x0a, 0x04, 0x20, 0x1c, 0x1a, 0x16, 0x0e, 0x01, 0x00, 0x00 },	// U+29B2 (⦲)
-	{ 0x00, 0x08, 0x1e, 0x08, 0x20, 0x1c, 0x1a, 0x16, 0x0e, 0x01, 0x00, 0x00 },	// U+29B3 (⦳)
-	{ 0x00, 0x04, 0x1e, 0x04, 0x20, 0x1c, 0x1a, 0x16, 0x0e, 0x01, 0x00, 0x00 },	// U+29B4 (⦴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+29B5 (⦵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+29B6 (⦶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x2d, 0x2d, 0x2d, 0x2d, 0x1e, 0x00, 0x00 },	// U+29B7 (⦷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x13, 0x15, 0x19, 0x0e, 0x00, 0x00 },	// U+29B8 (⦸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+29B9 (⦹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+29BA (⦺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x1b, 0x0e, 0x00, 0x00 },	// U+29BB (⦻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x33, 0x29, 0x25, 0x33, 0x1e, 0x00, 0x00 },	// U+29BC (⦼)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00 },	// U+29BD (⦽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+29BE (⦾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x21, 0x2d, 0x2d, 0x21, 0x1e, 0x00, 0x00 },	// U+29BF (⦿)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x21, 0x25, 0x29, 0x25, 0x21, 0x1e, 0x00, 0x00 },	// U+29C0 (⧀)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x21, 0x29, 0x25, 0x29, 0x21, 0x1e, 0x00, 0x00 },	// U+29C1 (⧁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x29, 0x19, 0x06, 0x00, 0x00 },	// U+29C2 (⧂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x39, 0x09, 0x39, 0x06, 0x00, 0x00 },	// U+29C3 (⧃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x19, 0x15, 0x13, 0x1f, 0x00, 0x00 },	// U+29C4 (⧄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x13, 0x15, 0x19, 0x1f, 0x00, 0x00 },	// U+29C5 (⧅)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x21, 0x25, 0x2f, 0x25, 0x21, 0x3f, 0x00, 0x00 },	// U+29C6 (⧆)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x21, 0x25, 0x2b, 0x25, 0x21, 0x3f, 0x00, 0x00 },	// U+29C7 (⧇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x00, 0x00 },	// U+29C8 (⧈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x3d, 0x27, 0x24, 0x3c, 0x00, 0x00 },	// U+29C9 (⧉)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+29CA (⧊)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+29CB (⧋)
-	{ 0x00, 0x00, 0x0c, 0x12, 0x2d, 0x25, 0x29, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+29CC (⧌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x3f, 0x00, 0x00 },	// U+29CD (⧍)
-	{ 0x00, 0x03, 0x0d, 0x11, 0x0d, 0x03, 0x18, 0x16, 0x11, 0x16, 0x18, 0x00 },	// U+29CE (⧎)
-	{ 0x00, 0x00, 0x00, 0x28, 0x2c, 0x2a, 0x29, 0x2a, 0x2c, 0x28, 0x00, 0x00 },	// U+29CF (⧏)
-	{ 0x00, 0x00, 0x00, 0x05, 0x0d, 0x15, 0x25, 0x15, 0x0d, 0x05, 0x00, 0x00 },	// U+29D0 (⧐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x17, 0x1b, 0x11, 0x00, 0x00 },	// U+29D1 (⧑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1d, 0x1b, 0x11, 0x00, 0x00 },	// U+29D2 (⧒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1b, 0x1f, 0x1b, 0x11, 0x00, 0x00 },	// U+29D3 (⧓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0b, 0x07, 0x0b, 0x11, 0x00, 0x00 },	// U+29D4 (⧔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1a, 0x1c, 0x1a, 0x11, 0x00, 0x00 },	// U+29D5 (⧕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x04, 0x0a, 0x1f, 0x00, 0x00 },	// U+29D6 (⧖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x04, 0x0e, 0x1f, 0x00, 0x00 },	// U+29D7 (⧗)
-	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x00, 0x00 },	// U+29D8 (⧘)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x08, 0x00, 0x00 },	// U+29D9 (⧙)
-	{ 0x00, 0x00, 0x00, 0x09, 0x12, 0x09, 0x12, 0x09, 0x12, 0x09, 0x00, 0x00 },	// U+29DA (⧚)
-	{ 0x00, 0x00, 0x00, 0x12, 0x09, 0x12, 0x09, 0x12, 0x09, 0x12, 0x00, 0x00 },	// U+29DB (⧛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+29DC (⧜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+29DD (⧝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+29DE (⧞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x12, 0x00, 0x00, 0x00 },	// U+29DF (⧟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x13, 0x13, 0x1f, 0x00, 0x00 },	// U+29E0 (⧠)
-	{ 0x00, 0x00, 0x00, 0x10, 0x18, 0x14, 0x12, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+29E1 (⧡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+29E2 (⧢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00, 0x00 },	// U+29E3 (⧣)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00, 0x00 },	// U+29E4 (⧤)
-	{ 0x00, 0x00, 0x08, 0x08, 0x1f, 0x04, 0x1f, 0x04, 0x1f, 0x02, 0x02, 0x00 },	// U+29E5 (⧥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x11, 0x1f, 0x11, 0x00, 0x00 },	// U+29E6 (⧦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+29E7 (⧧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x13, 0x0a, 0x04, 0x00, 0x00 },	// U+29E8 (⧨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x19, 0x0a, 0x04, 0x00, 0x00 },	// U+29E9 (⧩)
-	{ 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+29EA (⧪)
-	{ 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+29EB (⧫)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0e, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+29EC (⧬)
-	{ 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+29ED (⧭)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x0a, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+29EE (⧮)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x0e, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+29EF (⧯)
-	{ 0x00, 0x0e, 0x04, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+29F0 (⧰)
-	{ 0x00, 0x0e, 0x04, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+29F1 (⧱)
-	{ 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x11, 0x11, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+29F2 (⧲)
-	{ 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x1f, 0x1f, 0x0e, 0x04, 0x0e, 0x00, 0x00 },	// U+29F3 (⧳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x1f, 0x08, 0x05, 0x00, 0x00 },	// U+29F4 (⧴)
-	{ 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+29F5 (⧵)
-	{ 0x00, 0x1e, 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00 },	// U+29F6 (⧶)
-	{ 0x00, 0x00, 0x02, 0x02, 0x04, 0x1e, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+29F7 (⧷)
-	{ 0x00, 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00 },	// U+29F8 (⧸)
-	{ 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00 },	// U+29F9 (⧹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x00, 0x00 },	// U+29FA (⧺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x3f, 0x2a, 0x2a, 0x00, 0x00 },	// U+29FB (⧻)
-	{ 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00 },	// U+29FC (⧼)
-	{ 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00 },	// U+29FD (⧽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+29FE (⧾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00 },	// U+29FF (⧿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2A00 (⨀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00, 0x00 },	// U+2A01 (⨁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x1b, 0x0e, 0x00, 0x00, 0x00 },	// U+2A02 (⨂)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2A03 (⨃)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x15, 0x1f, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2A04 (⨄)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2A05 (⨅)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2A06 (⨆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x1e, 0x1e, 0x33, 0x33, 0x00, 0x00 },	// U+2A07 (⨇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x1e, 0x1e, 0x0c, 0x0c, 0x00, 0x00 },	// U+2A08 (⨈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00 },	// U+2A09 (⨉)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x01, 0x06, 0x0a, 0x06, 0x01, 0x1f, 0x00, 0x00 },	// U+2A0A (⨊)
-	{ 0x08, 0x14, 0x04, 0x04, 0x1f, 0x06, 0x04, 0x06, 0x1f, 0x04, 0x05, 0x02 },	// U+2A0B (⨋)
-	{ 0x00, 0x1c, 0x3e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x0e, 0x00 },	// U+2A0C (⨌)
-	{ 0x08, 0x14, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+2A0D (⨍)
-	{ 0x08, 0x14, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x04, 0x05, 0x02 },	// U+2A0E (⨎)
-	{ 0x08, 0x14, 0x04, 0x04, 0x14, 0x0c, 0x06, 0x05, 0x04, 0x04, 0x05, 0x02 },	// U+2A0F (⨏)
-	{ 0x08, 0x14, 0x04, 0x04, 0x0e, 0x05, 0x05, 0x05, 0x06, 0x04, 0x05, 0x02 },	// U+2A10 (⨐)
-	{ 0x08, 0x14, 0x04, 0x04, 0x04, 0x3c, 0x35, 0x2e, 0x04, 0x04, 0x05, 0x02 },	// U+2A11 (⨑)
-	{ 0x08, 0x14, 0x04, 0x04, 0x1c, 0x10, 0x14, 0x10, 0x1c, 0x04, 0x05, 0x02 },	// U+2A12 (⨒)
-	{ 0x08, 0x14, 0x04, 0x04, 0x0c, 0x10, 0x14, 0x10, 0x0c, 0x04, 0x05, 0x02 },	// U+2A13 (⨓)
-	{ 0x08, 0x14, 0x04, 0x04, 0x1c, 0x20, 0x28, 0x20, 0x1c, 0x04, 0x05, 0x02 },	// U+2A14 (⨔)
-	{ 0x08, 0x14, 0x04, 0x04, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x04, 0x05, 0x02 },	// U+2A15 (⨕)
-	{ 0x08, 0x14, 0x04, 0x04, 0x1f, 0x15, 0x15, 0x1f, 0x04, 0x04, 0x05, 0x02 },	// U+2A16 (⨖)
-	{ 0x10, 0x28, 0x08, 0x08, 0x0a, 0x3f, 0x2a, 0x08, 0x08, 0x08, 0x0a, 0x04 },	// U+2A17 (⨗)
-	{ 0x08, 0x14, 0x04, 0x15, 0x0e, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x05, 0x02 },	// U+2A18 (⨘)
-	{ 0x08, 0x14, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x04, 0x04, 0x05, 0x02 },	// U+2A19 (⨙)
-	{ 0x08, 0x14, 0x04, 0x04, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x05, 0x02 },	// U+2A1A (⨚)
-	{ 0x1e, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+2A1B (⨛)
-	{ 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x00, 0x1f },	// U+2A1C (⨜)
-	{ 0x00, 0x00, 0x00, 0x21, 0x33, 0x2d, 0x2d, 0x2d, 0x33, 0x21, 0x00, 0x00 },	// U+2A1D (⨝)
-	{ 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0a, 0x09, 0x0a, 0x0c, 0x08, 0x00, 0x00 },	// U+2A1E (⨞)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x04, 0x0a, 0x04, 0x02, 0x00 },	// U+2A1F (⨟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x24, 0x12, 0x09, 0x00, 0x00, 0x00 },	// U+2A20 (⨠)
-	{ 0x00, 0x00, 0x00, 0x02, 0x06, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+2A21 (⨡)
-	{ 0x00, 0x04, 0x0a, 0x04, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2A22 (⨢)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2A23 (⨣)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2A24 (⨤)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+2A25 (⨥)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x16, 0x0d, 0x00 },	// U+2A26 (⨦)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x34, 0x20, 0x10, 0x38, 0x00 },	// U+2A27 (⨧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2A28 (⨨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x08, 0x04, 0x00, 0x1f, 0x00, 0x00 },	// U+2A29 (⨩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2A2A (⨪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x00, 0x08, 0x00, 0x00, 0x00 },	// U+2A2B (⨫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1f, 0x00, 0x02, 0x00, 0x00, 0x00 },	// U+2A2C (⨬)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x02, 0x09, 0x1d, 0x09, 0x02, 0x1c, 0x00, 0x00 },	// U+2A2D (⨭)
-	{ 0x00, 0x00, 0x00, 0x06, 0x08, 0x12, 0x17, 0x12, 0x08, 0x06, 0x00, 0x00 },	// U+2A2E (⨮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2A2F (⨯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2A30 (⨰)
-	{ 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x1f, 0x00, 0x00 },	// U+2A31 (⨱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x1f, 0x00, 0x00 },	// U+2A32 (⨲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1e, 0x0c, 0x1e, 0x33, 0x00, 0x00 },	// U+2A33 (⨳)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x15, 0x09, 0x15, 0x01, 0x0e, 0x00, 0x00 },	// U+2A34 (⨴)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x10, 0x15, 0x12, 0x15, 0x10, 0x0e, 0x00, 0x00 },	// U+2A35 (⨵)
-	{ 0x04, 0x0a, 0x00, 0x0e, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x0e, 0x00, 0x00 },	// U+2A36 (⨶)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x0e, 0x00, 0x00 },	// U+2A37 (⨷)
-	{ 0x00, 0x0e, 0x11, 0x15, 0x11, 0x1f, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2A38 (⨸)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x1e, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+2A39 (⨹)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+2A3A (⨺)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x1e, 0x2d, 0x21, 0x3f, 0x00, 0x00 },	// U+2A3B (⨻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2A3C (⨼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2A3D (⨽)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x04, 0x0a, 0x0c, 0x08, 0x04, 0x00 },	// U+2A3E (⨾)
-	{ 0x00, 0x00, 0x00, 0x3b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x3f, 0x00, 0x00 },	// U+2A3F (⨿)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+2A40 (⩀)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2A41 (⩁)
-	{ 0x00, 0x1f, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2A42 (⩂)
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x1f, 0x00 },	// U+2A43 (⩃)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x15, 0x1b, 0x00, 0x00 },	// U+2A44 (⩄)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2A45 (⩅)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x06, 0x00, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+2A46 (⩆)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x00, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2A47 (⩇)
-	{ 0x00, 0x00, 0x09, 0x09, 0x06, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x09, 0x00 },	// U+2A48 (⩈)
-	{ 0x00, 0x00, 0x06, 0x09, 0x09, 0x00, 0x0f, 0x00, 0x09, 0x09, 0x06, 0x00 },	// U+2A49 (⩉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x0a, 0x00, 0x00, 0x00 },	// U+2A4A (⩊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2A4B (⩋)
-	{ 0x00, 0x00, 0x00, 0x3f, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+2A4C (⩌)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x3f, 0x00, 0x00 },	// U+2A4D (⩍)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00, 0x00 },	// U+2A4E (⩎)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1f, 0x1f, 0x00, 0x00 },	// U+2A4F (⩏)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1b, 0x15, 0x1b, 0x11, 0x0e, 0x00, 0x00 },	// U+2A50 (⩐)
-	{ 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2A51 (⩑)
-	{ 0x00, 0x00, 0x00, 0x04, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2A52 (⩒)
-	{ 0x00, 0x0a, 0x0a, 0x04, 0x15, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2A53 (⩓)
-	{ 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x15, 0x04, 0x0a, 0x0a, 0x00, 0x00 },	// U+2A54 (⩔)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x1e, 0x1e, 0x1e, 0x33, 0x33, 0x00, 0x00 },	// U+2A55 (⩕)
-	{ 0x00, 0x00, 0x00, 0x33, 0x33, 0x1e, 0x1e, 0x1e, 0x0c, 0x0c, 0x00, 0x00 },	// U+2A56 (⩖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x09, 0x05, 0x03, 0x01, 0x00, 0x00 },	// U+2A57 (⩗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x24, 0x22, 0x21, 0x00, 0x00 },	// U+2A58 (⩘)
-	{ 0x00, 0x00, 0x00, 0x11, 0x15, 0x0e, 0x0a, 0x0e, 0x15, 0x11, 0x00, 0x00 },	// U+2A59 (⩙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x15, 0x15, 0x00, 0x00 },	// U+2A5A (⩚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2A5B (⩛)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x1f, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2A5C (⩜)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x1f, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2A5D (⩝)
-	{ 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00 },	// U+2A5E (⩞)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x1f, 0x00 },	// U+2A5F (⩟)
-	{ 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A60 (⩠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x1f, 0x00, 0x00 },	// U+2A61 (⩡)
-	{ 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00 },	// U+2A62 (⩢)
-	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A63 (⩣)
-	{ 0x00, 0x00, 0x10, 0x18, 0x14, 0x12, 0x1f, 0x12, 0x14, 0x18, 0x10, 0x00 },	// U+2A64 (⩤)
-	{ 0x00, 0x00, 0x01, 0x03, 0x05, 0x09, 0x1f, 0x09, 0x05, 0x03, 0x01, 0x00 },	// U+2A65 (⩥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2A66 (⩦)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2A67 (⩧)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x00, 0x00 },	// U+2A68 (⩨)
-	{ 0x00, 0x00, 0x00, 0x15, 0x3f, 0x15, 0x3f, 0x15, 0x3f, 0x15, 0x00, 0x00 },	// U+2A69 (⩩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x00 },	// U+2A6A (⩪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x02, 0x00, 0x00 },	// U+2A6B (⩫)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2A6C (⩬)
-	{ 0x00, 0x00, 0x04, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2A6D (⩭)
-	{ 0x00, 0x00, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A6E (⩮)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2A6F (⩯)
-	{ 0x00, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A70 (⩰)
-	{ 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00 },	// U+2A71 (⩱)
-	{ 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A72 (⩲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2A73 (⩳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x35, 0x00, 0x00, 0x00 },	// U+2A74 (⩴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x00, 0x00 },	// U+2A75 (⩵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x00, 0x00 },	// U+2A76 (⩶)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x0a, 0x00, 0x00 },	// U+2A77 (⩷)
-	{ 0x00, 0x00, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2A78 (⩸)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x12, 0x29, 0x12, 0x04, 0x08, 0x00, 0x00 },	// U+2A79 (⩹)
-	{ 0x00, 0x00, 0x00, 0x04, 0x08, 0x12, 0x25, 0x12, 0x08, 0x04, 0x00, 0x00 },	// U+2A7A (⩺)
-	{ 0x03, 0x04, 0x02, 0x00, 0x02, 0x30, 0x0c, 0x03, 0x0c, 0x30, 0x00, 0x00 },	// U+2A7B (⩻)
-	{ 0x18, 0x20, 0x10, 0x00, 0x10, 0x03, 0x0c, 0x30, 0x0c, 0x03, 0x00, 0x00 },	// U+2A7C (⩼)
-	{ 0x00, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x0c, 0x33, 0x0c, 0x30, 0x00, 0x00 },	// U+2A7D (⩽)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x30, 0x0c, 0x33, 0x0c, 0x03, 0x00, 0x00 },	// U+2A7E (⩾)
-	{ 0x00, 0x00, 0x00, 0x30, 0x0c, 0x23, 0x0c, 0x33, 0x0c, 0x30, 0x00, 0x00 },	// U+2A7F (⩿)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x31, 0x0c, 0x33, 0x0c, 0x03, 0x00, 0x00 },	// U+2A80 (⪀)
-	{ 0x00, 0x00, 0x02, 0x30, 0x0c, 0x03, 0x0c, 0x33, 0x0c, 0x30, 0x00, 0x00 },	// U+2A81 (⪁)
-	{ 0x00, 0x00, 0x10, 0x03, 0x0c, 0x30, 0x0c, 0x33, 0x0c, 0x03, 0x00, 0x00 },	// U+2A82 (⪂)
-	{ 0x00, 0x20, 0x00, 0x30, 0x0c, 0x03, 0x0c, 0x33, 0x0c, 0x30, 0x00, 0x00 },	// U+2A83 (⪃)
-	{ 0x00, 0x01, 0x00, 0x03, 0x0c, 0x30, 0x0c, 0x33, 0x0c, 0x03, 0x00, 0x00 },	// U+2A84 (⪄)
-	{ 0x00, 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2A85 (⪅)
-	{ 0x00, 0x07, 0x18, 0x07, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2A86 (⪆)
-	{ 0x00, 0x00, 0x30, 0x0c, 0x03, 0x0c, 0x30, 0x00, 0x08, 0x3f, 0x02, 0x00 },	// U+2A87 (⪇)
-	{ 0x00, 0x00, 0x03, 0x0c, 0x30, 0x0c, 0x03, 0x00, 0x08, 0x3f, 0x02, 0x00 },	// U+2A88 (⪈)
-	{ 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x08, 0x1e, 0x0d, 0x04, 0x16, 0x0f, 0x02 },	// U+2A89 (⪉)
-	{ 0x00, 0x07, 0x18, 0x07, 0x00, 0x08, 0x1e, 0x0d, 0x04, 0x16, 0x0f, 0x02 },	// U+2A8A (⪊)
-	{ 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x07, 0x18, 0x07 },	// U+2A8B (⪋)
-	{ 0x00, 0x07, 0x18, 0x07, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1c, 0x03, 0x1c },	// U+2A8C (⪌)
-	{ 0x00, 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x00 },	// U+2A8D (⪍)
-	{ 0x00, 0x00, 0x07, 0x18, 0x07, 0x00, 0x16, 0x0d, 0x00, 0x1f, 0x00, 0x00 },	// U+2A8E (⪎)
-	{ 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x16, 0x0d, 0x00, 0x07, 0x18, 0x07, 0x00 },	// U+2A8F (⪏)
-	{ 0x00, 0x07, 0x18, 0x07, 0x00, 0x16, 0x0d, 0x00, 0x1c, 0x03, 0x1c, 0x00 },	// U+2A90 (⪐)
-	{ 0x00, 0x1c, 0x03, 0x1c, 0x07, 0x18, 0x07, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A91 (⪑)
-	{ 0x00, 0x07, 0x18, 0x07, 0x1c, 0x03, 0x1c, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A92 (⪒)
-	{ 0x00, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x00 },	// U+2A93 (⪓)
-	{ 0x00, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x00 },	// U+2A94 (⪔)
-	{ 0x00, 0x00, 0x00, 0x30, 0x0c, 0x33, 0x0c, 0x03, 0x0c, 0x30, 0x00, 0x00 },	// U+2A95 (⪕)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x33, 0x0c, 0x30, 0x0c, 0x03, 0x00, 0x00 },	// U+2A96 (⪖)
-	{ 0x00, 0x00, 0x00, 0x30, 0x0c, 0x33, 0x0c, 0x23, 0x0c, 0x30, 0x00, 0x00 },	// U+2A97 (⪗)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x33, 0x0c, 0x31, 0x0c, 0x03, 0x00, 0x00 },	// U+2A98 (⪘)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x07, 0x18, 0x07, 0x00, 0x00 },	// U+2A99 (⪙)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x07, 0x18, 0x07, 0x00, 0x00 },	// U+2A9A (⪚)
-	{ 0x00, 0x00, 0x30, 0x0c, 0x33, 0x0c, 0x33, 0x0c, 0x03, 0x0c, 0x30, 0x00 },	// U+2A9B (⪛)
-	{ 0x00, 0x00, 0x03, 0x0c, 0x33, 0x0c, 0x33, 0x0c, 0x30, 0x0c, 0x03, 0x00 },	// U+2A9C (⪜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x00 },	// U+2A9D (⪝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x07, 0x18, 0x07, 0x00, 0x00 },	// U+2A9E (⪞)
-	{ 0x00, 0x16, 0x0d, 0x00, 0x1c, 0x03, 0x1c, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2A9F (⪟)
-	{ 0x00, 0x16, 0x0d, 0x00, 0x07, 0x18, 0x07, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2AA0 (⪠)
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x12, 0x09, 0x12, 0x04, 0x08, 0x00, 0x00 },	// U+2AA1 (⪡)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x09, 0x12, 0x09, 0x04, 0x02, 0x00, 0x00 },	// U+2AA2 (⪢)
-	{ 0x00, 0x00, 0x00, 0x24, 0x12, 0x09, 0x12, 0x24, 0x00, 0x3f, 0x00, 0x00 },	// U+2AA3 (⪣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0x12, 0x0c, 0x33, 0x00, 0x00, 0x00 },	// U+2AA4 (⪤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x21, 0x12, 0x0c, 0x12, 0x21, 0x00, 0x00, 0x00 },	// U+2AA5 (⪥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x23, 0x2c, 0x10, 0x00, 0x00, 0x00 },	// U+2AA6 (⪦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x31, 0x0d, 0x02, 0x00, 0x00, 0x00 },	// U+2AA7 (⪧)
-	{ 0x00, 0x00, 0x00, 0x10, 0x2c, 0x23, 0x2c, 0x13, 0x0c, 0x30, 0x00, 0x00 },	// U+2AA8 (⪨)
-	{ 0x00, 0x00, 0x00, 0x02, 0x0d, 0x31, 0x0d, 0x32, 0x0c, 0x03, 0x00, 0x00 },	// U+2AA9 (⪩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x3f, 0x0c, 0x30, 0x00, 0x00, 0x00 },	// U+2AAA (⪪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x3f, 0x0c, 0x03, 0x00, 0x00, 0x00 },	// U+2AAB (⪫)
-	{ 0x00, 0x00, 0x00, 0x30, 0x0c, 0x3f, 0x0c, 0x30, 0x00, 0x3f, 0x00, 0x00 },	// U+2AAC (⪬)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0c, 0x3f, 0x0c, 0x03, 0x00, 0x3f, 0x00, 0x00 },	// U+2AAD (⪭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x1b, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2AAE (⪮)
-	{ 0x00, 0x00, 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x00, 0x1f, 0x00, 0x00 },	// U+2AAF (⪯)
-	{ 0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x00, 0x1f, 0x00, 0x00 },	// U+2AB0 (⪰)
-	{ 0x00, 0x00, 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x08, 0x1f, 0x02, 0x00 },	// U+2AB1 (⪱)
-	{ 0x00, 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x08, 0x1f, 0x02, 0x00 },	// U+2AB2 (⪲)
-	{ 0x00, 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2AB3 (⪳)
-	{ 0x00, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x00, 0x1f, 0x00, 0x1f, 0x00 },	// U+2AB4 (⪴)
-	{ 0x00, 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2AB5 (⪵)
-	{ 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2AB6 (⪶)
-	{ 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2AB7 (⪷)
-	{ 0x01, 0x06, 0x18, 0x06, 0x01, 0x00, 0x0d, 0x16, 0x00, 0x0d, 0x16, 0x00 },	// U+2AB8 (⪸)
-	{ 0x10, 0x0c, 0x03, 0x0c, 0x10, 0x08, 0x1e, 0x0d, 0x04, 0x16, 0x0f, 0x02 },	// U+2AB9 (⪹)
-	{ 0x01, 0x06, 0x18, 0x06, 0x01, 0x08, 0x1e, 0x0d, 0x04, 0x16, 0x0f, 0x02 },	// U+2ABA (⪺)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x0a, 0x05, 0x0a, 0x14, 0x14, 0x00, 0x00 },	// U+2ABB (⪻)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x0a, 0x14, 0x0a, 0x05, 0x05, 0x00, 0x00 },	// U+2ABC (⪼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x05, 0x01, 0x1e, 0x00, 0x00, 0x00 },	// U+2ABD (⪽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x10, 0x14, 0x10, 0x0f, 0x00, 0x00, 0x00 },	// U+2ABE (⪾)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2ABF (⪿)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2AC0 (⫀)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x0a, 0x04, 0x0a, 0x00, 0x00 },	// U+2AC1 (⫁)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x0a, 0x04, 0x0a, 0x00, 0x00 },	// U+2AC2 (⫂)
-	{ 0x00, 0x00, 0x04, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x1f, 0x00, 0x00 },	// U+2AC3 (⫃)
-	{ 0x00, 0x00, 0x04, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x1f, 0x00, 0x00 },	// U+2AC4 (⫄)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2AC5 (⫅)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2AC6 (⫆)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2AC7 (⫇)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2AC8 (⫈)
-	{ 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2AC9 (⫉)
-	{ 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2ACA (⫊)
-	{ 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2ACB (⫋)
-	{ 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x00 },	// U+2ACC (⫌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x00 },	// U+2ACD (⫍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x20, 0x3c, 0x00, 0x00, 0x00 },	// U+2ACE (⫎)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c, 0x00, 0x00 },	// U+2ACF (⫏)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x11, 0x11, 0x11, 0x09, 0x07, 0x00, 0x00 },	// U+2AD0 (⫐)
-	{ 0x00, 0x00, 0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c, 0x00, 0x1f, 0x00 },	// U+2AD1 (⫑)
-	{ 0x00, 0x00, 0x07, 0x09, 0x11, 0x11, 0x11, 0x09, 0x07, 0x00, 0x1f, 0x00 },	// U+2AD2 (⫒)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00 },	// U+2AD3 (⫓)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00 },	// U+2AD4 (⫔)
-	{ 0x00, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00, 0x1e, 0x01, 0x01, 0x1e, 0x00 },	// U+2AD5 (⫕)
-	{ 0x00, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00, 0x0f, 0x10, 0x10, 0x0f, 0x00 },	// U+2AD6 (⫖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0x0c, 0x33, 0x00, 0x00, 0x00 },	// U+2AD7 (⫗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0x1e, 0x0c, 0x33, 0x00, 0x00, 0x00 },	// U+2AD8 (⫘)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2AD9 (⫙)
-	{ 0x00, 0x00, 0x0e, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2ADA (⫚)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x04, 0x00, 0x00 },	// U+2ADB (⫛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x14, 0x0c, 0x15, 0x17, 0x0f, 0x00, 0x00 },	// U+2ADC (⫝̸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+2ADD (⫝)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0f, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+2ADE (⫞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2ADF (⫟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00, 0x00 },	// U+2AE0 (⫠)
-	{ 0x00, 0x00, 0x00, 0x04, 0x24, 0x14, 0x24, 0x14, 0x04, 0x3f, 0x00, 0x00 },	// U+2AE1 (⫡)
-	{ 0x00, 0x00, 0x00, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x00, 0x00 },	// U+2AE2 (⫢)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x00, 0x00 },	// U+2AE3 (⫣)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x10, 0x1f, 0x10, 0x10, 0x00, 0x00 },	// U+2AE4 (⫤)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x17, 0x14, 0x17, 0x14, 0x14, 0x00, 0x00 },	// U+2AE5 (⫥)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x1f, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+2AE6 (⫦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2AE7 (⫧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2AE8 (⫨)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x00, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2AE9 (⫩)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2AEA (⫪)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x00, 0x00 },	// U+2AEB (⫫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10, 0x1f, 0x10, 0x00, 0x00, 0x00 },	// U+2AEC (⫬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x3e, 0x02, 0x00, 0x00, 0x00 },	// U+2AED (⫭)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x06, 0x04, 0x0c, 0x04, 0x04, 0x00, 0x00 },	// U+2AEE (⫮)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+2AEF (⫯)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+2AF0 (⫰)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x0a, 0x04, 0x00, 0x00 },	// U+2AF1 (⫱)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2AF2 (⫲)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1e, 0x0f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2AF3 (⫳)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2AF4 (⫴)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x3f, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2AF5 (⫵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+2AF6 (⫶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x15, 0x2a, 0x00, 0x00, 0x00, 0x00 },	// U+2AF7 (⫷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x00 },	// U+2AF8 (⫸)
-	{ 0x00, 0x00, 0x30, 0x0c, 0x03, 0x0c, 0x33, 0x0c, 0x33, 0x0c, 0x30, 0x00 },	// U+2AF9 (⫹)
-	{ 0x00, 0x00, 0x03, 0x0c, 0x30, 0x0c, 0x33, 0x0c, 0x33, 0x0c, 0x03, 0x00 },	// U+2AFA (⫺)
-	{ 0x00, 0x00, 0x2a, 0x2a, 0x2a, 0x2a, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2AFB (⫻)
-	{ 0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+2AFC (⫼)
-	{ 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+2AFD (⫽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+2AFE (⫾)
-	{ 0x00, 0x0e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x00, 0x00 },	// U+2AFF (⫿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x28, 0x34, 0x0a, 0x05, 0x02, 0x00, 0x00 },	// U+2B00 (⬀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x05, 0x0b, 0x14, 0x28, 0x10, 0x00, 0x00 },	// U+2B01 (⬁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x34, 0x28, 0x38, 0x00, 0x00 },	// U+2B02 (⬂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x14, 0x0b, 0x05, 0x07, 0x00, 0x00 },	// U+2B03 (⬃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x21, 0x2d, 0x12, 0x00, 0x00 },	// U+2B04 (⬄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x1f, 0x1f, 0x06, 0x04, 0x00, 0x00 },	// U+2B05 (⬅)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00 },	// U+2B06 (⬆)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x3f, 0x1e, 0x0c, 0x00, 0x00 },	// U+2B07 (⬇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x3c, 0x0e, 0x07, 0x02, 0x00, 0x00 },	// U+2B08 (⬈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0f, 0x1c, 0x38, 0x10, 0x00, 0x00 },	// U+2B09 (⬉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x0e, 0x3c, 0x38, 0x38, 0x00, 0x00 },	// U+2B0A (⬊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x38, 0x1c, 0x0f, 0x07, 0x07, 0x00, 0x00 },	// U+2B0B (⬋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x3f, 0x12, 0x00, 0x00, 0x00 },	// U+2B0C (⬌)
-	{ 0x00, 0x00, 0x0c, 0x1e, 0x3f, 0x0c, 0x0c, 0x0c, 0x3f, 0x1e, 0x0c, 0x00 },	// U+2B0D (⬍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2B0E (⬎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x07, 0x00, 0x00 },	// U+2B0F (⬏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2B10 (⬐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2B11 (⬑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2B12 (⬒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2B13 (⬓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1d, 0x19, 0x11, 0x1f, 0x00, 0x00 },	// U+2B14 (⬔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x13, 0x17, 0x1f, 0x00, 0x00 },	// U+2B15 (⬕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x16, 0x37, 0x16, 0x0c, 0x00, 0x00 },	// U+2B16 (⬖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1a, 0x39, 0x1a, 0x0c, 0x00, 0x00 },	// U+2B17 (⬗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2B18 (⬘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2B19 (⬙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00 },	// U+2B1A (⬚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2B1B (⬛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x11, 0x11, 0x1f, 0x00, 0x00 },	// U+2B1C (⬜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00 },	// U+2B1D (⬝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0a, 0x0e, 0x00, 0x00, 0x00 },	// U+2B1E (⬞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x0e, 0x0e, 0x00, 0x00 },	// U+2B1F (⬟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x0a, 0x0e, 0x00, 0x00 },	// U+2B20 (⬠)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2B21 (⬡)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2B22 (⬢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+2B23 (⬣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x3f, 0x3f, 0x3f, 0x1e, 0x00, 0x00 },	// U+2B24 (⬤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2B25 (⬥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2B26 (⬦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x04, 0x04, 0x00, 0x00 },	// U+2B27 (⬧)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x00 },	// U+2B28 (⬨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2B29 (⬩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x00, 0x00, 0x00 },	// U+2B2A (⬪)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x11, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+2B2B (⬫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+2B2C (⬬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+2B2D (⬭)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0e, 0x00, 0x00 },	// U+2B2E (⬮)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2B2F (⬯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3f, 0x1a, 0x00, 0x00, 0x00 },	// U+2B30 (⬰)
-	{ 0x02, 0x1f, 0x02, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x02, 0x1f, 0x02, 0x00 },	// U+2B31 (⬱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3f, 0x1a, 0x00, 0x00, 0x00 },	// U+2B32 (⬲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x17, 0x02, 0x00, 0x00, 0x00 },	// U+2B33 (⬳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x3f, 0x16, 0x10, 0x00, 0x00 },	// U+2B34 (⬴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1e, 0x3f, 0x1e, 0x18, 0x00, 0x00 },	// U+2B35 (⬵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x1f, 0x16, 0x10, 0x00, 0x00 },	// U+2B36 (⬶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x1b, 0x26, 0x00, 0x00, 0x00 },	// U+2B37 (⬷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x15, 0x02, 0x04, 0x00, 0x00 },	// U+2B38 (⬸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2a, 0x1f, 0x2a, 0x08, 0x00, 0x00 },	// U+2B39 (⬹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2e, 0x1f, 0x2e, 0x0c, 0x00, 0x00 },	// U+2B3A (⬺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x1f, 0x26, 0x00, 0x00, 0x00 },	// U+2B3B (⬻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2e, 0x1f, 0x2e, 0x08, 0x00, 0x00 },	// U+2B3C (⬼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3e, 0x1f, 0x3e, 0x18, 0x00, 0x00 },	// U+2B3D (⬽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x3f, 0x1a, 0x00, 0x00, 0x00 },	// U+2B3E (⬾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2f, 0x02, 0x00, 0x00, 0x00 },	// U+2B3F (⬿)
-	{ 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+2B40 (⭀)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+2B41 (⭁)
-	{ 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2B42 (⭂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x14, 0x3f, 0x14, 0x02, 0x01, 0x00 },	// U+2B43 (⭃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x3f, 0x14, 0x03, 0x00, 0x00 },	// U+2B44 (⭄)
-	{ 0x00, 0x00, 0x00, 0x08, 0x3c, 0x02, 0x3f, 0x02, 0x3c, 0x08, 0x00, 0x00 },	// U+2B45 (⭅)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x3f, 0x10, 0x0f, 0x04, 0x00, 0x00 },	// U+2B46 (⭆)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+2B47 (⭇)
-	{ 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2B48 (⭈)
-	{ 0x00, 0x00, 0x00, 0x16, 0x0d, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+2B49 (⭉)
-	{ 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x16, 0x0d, 0x00 },	// U+2B4A (⭊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2B4B (⭋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x00, 0x16, 0x0d, 0x00, 0x00 },	// U+2B4C (⭌)
-}; // 893
-
-static const unsigned char orp_block75[][12] = {
-	{ 0x03, 0x13, 0x2b, 0x13, 0x13, 0x13, 0x0b, 0x05, 0x02, 0x03, 0x03, 0x03 },	// U+2B60 (⭠)
-	{ 0x00, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x20, 0x24, 0x2c, 0x34, 0x24, 0x24 },	// U+2B61 (⭡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x3f, 0x11, 0x11, 0x17, 0x11, 0x11, 0x00, 0x00 },	// U+2B62 (⭢)
-	{ 0x00, 0x3f, 0x3f, 0x00, 0x2e, 0x28, 0x2e, 0x2e, 0x2e, 0x3f, 0x3f, 0x3f },	// U+2B63 (⭣)
-	{ 0x00, 0x00, 0x1e, 0x21, 0x21, 0x3f, 0x37, 0x33, 0x3b, 0x3f, 0x00, 0x00 },	// U+2B64 (⭤)
-}; // 5
-
-static const unsigned char orp_block76[][12] = {
-	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 },	// U+2B80 (⮀)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0c, 0x1f, 0x3f, 0x1f, 0x0c, 0x04, 0x00, 0x00 },	// U+2B81 (⮁)
-	{ 0x00, 0x20, 0x30, 0x38, 0x3c, 0x3e, 0x3f, 0x3e, 0x3c, 0x38, 0x30, 0x20 },	// U+2B82 (⮂)
-	{ 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20 },	// U+2B83 (⮃)
-}; // 4
-
-static const unsigned char orp_block77[][12] = {
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x1e, 0x00, 0x00 },	// U+2C60 (Ⱡ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x0e, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+2C61 (ⱡ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x16, 0x0d, 0x04, 0x04, 0x1c, 0x00, 0x00 },	// U+2C62 (Ɫ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x17, 0x12, 0x0e, 0x02, 0x02, 0x00, 0x00 },	// U+2C63 (Ᵽ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x11, 0x11, 0x0f, 0x05, 0x09, 0x11, 0x05, 0x02 },	// U+2C64 (Ɽ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x0e, 0x18, 0x1e, 0x15, 0x1e, 0x02, 0x00 },	// U+2C65 (ⱥ)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x1f, 0x0c, 0x04, 0x04, 0x1a, 0x02, 0x00 },	// U+2C66 (ⱦ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x31, 0x20, 0x00 },	// U+2C67 (Ⱨ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x11, 0x11, 0x11, 0x31, 0x20, 0x00 },	// U+2C68 (ⱨ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x31, 0x20, 0x00 },	// U+2C69 (Ⱪ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x09, 0x07, 0x09, 0x31, 0x20, 0x00 },	// U+2C6A (ⱪ)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x10, 0x08, 0x04, 0x02, 0x01, 0x3f, 0x20, 0x00 },	// U+2C6B (Ⱬ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x04, 0x02, 0x3f, 0x20, 0x00 },	// U+2C6C (ⱬ)
-	{ 0x00, 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, 0x11, 0x2e, 0x00, 0x00 },	// U+2C6D (Ɑ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x1b, 0x15, 0x11, 0x11, 0x11, 0x11, 0x14, 0x08 },	// U+2C6E (Ɱ)
-	{ 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+2C6F (Ɐ)
-}; // 16
-
-static const unsigned char orp_block78[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2C71 (ⱱ)
-	{ 0x00, 0x00, 0x00, 0x21, 0x11, 0x11, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+2C72 (Ⱳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x11, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+2C73 (ⱳ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x15, 0x13, 0x0a, 0x04, 0x00, 0x00 },	// U+2C74 (ⱴ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+2C75 (Ⱶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x02, 0x02, 0x00, 0x00 },	// U+2C76 (ⱶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00 },	// U+2C77 (ⱷ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0f, 0x01, 0x2e, 0x18, 0x00 },	// U+2C78 (ⱸ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0c, 0x00, 0x00 },	// U+2C79 (ⱹ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x1b, 0x0e, 0x00, 0x00 },	// U+2C7A (ⱺ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x10, 0x1c, 0x10, 0x1e, 0x00, 0x00 },	// U+2C7B (ⱻ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+2C7C (ⱼ)
-	{ 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2C7D (ⱽ)
-}; // 13
-
-static const unsigned char orp_block79[][12] = {
-	{ 0x06, 0x03, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE0 (ⷠ)
-	{ 0x03, 0x05, 0x03, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE1 (ⷡ)
-	{ 0x07, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE2 (ⷢ)
-	{ 0x0e, 0x0a, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE3 (ⷣ)
-	{ 0x15, 0x0e, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE4 (ⷤ)
-	{ 0x03, 0x04, 0x02, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE5 (ⷥ)
-	{ 0x05, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE6 (ⷦ)
-	{ 0x0e, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE7 (ⷧ)
-	{ 0x05, 0x07, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE8 (ⷨ)
-	{ 0x09, 0x0f, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DE9 (ⷩ)
-	{ 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DEA (ⷪ)
-	{ 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DEB (ⷫ)
-	{ 0x03, 0x05, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DEC (ⷬ)
-	{ 0x06, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DED (ⷭ)
-	{ 0x07, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DEE (ⷮ)
-	{ 0x05, 0x02, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DEF (ⷯ)
-	{ 0x05, 0x05, 0x05, 0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF0 (ⷰ)
-	{ 0x05, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF1 (ⷱ)
-	{ 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF2 (ⷲ)
-	{ 0x15, 0x15, 0x15, 0x35, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF3 (ⷳ)
-	{ 0x06, 0x0b, 0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF4 (ⷴ)
-	{ 0x3e, 0x11, 0x11, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF5 (ⷵ)
-	{ 0x03, 0x06, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF6 (ⷶ)
-	{ 0x06, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF7 (ⷷ)
-	{ 0x02, 0x07, 0x02, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF8 (ⷸ)
-	{ 0x04, 0x05, 0x05, 0x02, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DF9 (ⷹ)
-	{ 0x02, 0x07, 0x02, 0x06, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFA (ⷺ)
-	{ 0x19, 0x25, 0x27, 0x25, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFB (ⷻ)
-	{ 0x0d, 0x11, 0x1f, 0x15, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFC (ⷼ)
-	{ 0x04, 0x0a, 0x1f, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFD (ⷽ)
-	{ 0x1f, 0x0a, 0x0e, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFE (ⷾ)
-	{ 0x3f, 0x15, 0x1d, 0x2b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2DFF (ⷿ)
-}; // 32
-
-static const unsigned char orp_block80[][12] = {
-	{ 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+E0B2 ()
-}; // 1
-
-static const unsigned char orp_block81[][12] = {
-	{ 0x00, 0x00, 0x00, 0x1c, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+FB00 (ﬀ)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x12, 0x02, 0x1f, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+FB01 (ﬁ)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x12, 0x12, 0x1f, 0x12, 0x12, 0x12, 0x00, 0x00 },	// U+FB02 (ﬂ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x05, 0x1f, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+FB03 (ﬃ)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x15, 0x15, 0x1f, 0x15, 0x15, 0x15, 0x00, 0x00 },	// U+FB04 (ﬄ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1e, 0x0b, 0x0a, 0x0a, 0x12, 0x00, 0x00 },	// U+FB05 (ﬅ)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x0a, 0x1e, 0x09, 0x0a, 0x0a, 0x11, 0x00, 0x00 },	// U+FB06 (ﬆ)
-}; // 7
-
-static const unsigned char orp_block82[][12] = {
-	{ 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE20 (︠)
-	{ 0x07, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE21 (︡)
-	{ 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE22 (︢)
-	{ 0x10, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+FE23 (︣)
-}; // 4
-
-static const unsigned char orp_block83[][12] = {
-	{ 0x00, 0x00, 0x0e, 0x1b, 0x15, 0x17, 0x1b, 0x1b, 0x1f, 0x1b, 0x0e, 0x00 },	// U+FFFD (�)
-}; // 1
+static const uint16_t orpi_ids[] = {
+	0, 1, 4271, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 745, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 43, 4281, 4282, 4283, 4284,
+	4285, 4286, 4287, 4288, 52, 4289, 4290, 4291, 4292, 4293, 4294, 4295, 60, 61, 62, 63,
+	64, 65, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309,
+	4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 92, 93, 94, 95,
+	1, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 4265, 107, 108, 109, 110,
+	111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 4266, 123, 124, 125, 126,
+	127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+	143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+	175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+	191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+	207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+	223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+	239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+	255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+	271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+	319, 320, 321, 322, 323, 324, 325, 326, 327, 207, 328, 329, 330, 331, 332, 333,
+	334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+	350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 290, 361, 362, 363, 364,
+	365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+	397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+	413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+	429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+	445, 446, 447, 448, 449, 450, 449, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+	460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+	476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+	492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+	508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+	524, 525, 526, 527, 528, 529, 530, 531, 532, 410, 533, 534, 535, 536, 537, 538,
+	539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+	555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570,
+	571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586,
+	587, 588, 589, 590, 509, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601,
+	602, 603, 604, 432, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+	617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632,
+	633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+	649, 650, 651, 652, 653, 654, 12, 655, 656, 657, 658, 659, 660, 661, 662, 663,
+	664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679,
+	680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+	696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711,
+	712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727,
+	728, 729, 730, 731, 732, 733, 719, 719, 718, 734, 735, 736, 737, 683, 738, 739,
+	740, 741, 742, 743, 744, 108, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754,
+	696, 697, 699, 755, 756, 731, 757, 758, 759, 760, 761, 762, 763, 764, 725, 1,
+	765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780,
+	781, 778, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 752,
+	795, 796, 797, 798, 799, 719, 800, 801, 659, 528, 802, 803, 804, 799, 805, 806,
+	118, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 59, 41, 349,
+	819, 820, 821, 822, 823, 824, 48, 825, 826, 359, 53, 827, 828, 57, 829, 830,
+	142, 311, 831, 832, 833, 834, 835, 836, 837, 838, 839, 534, 840, 348, 841, 842,
+	247, 843, 116, 87, 844, 80, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854,
+	855, 856, 178, 857, 858, 859, 860, 861, 862, 863, 864, 563, 865, 866, 867, 868,
+	869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+	885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 349, 895, 896, 897, 898, 899,
+	822, 900, 901, 325, 902, 903, 135, 138, 904, 905, 906, 907, 819, 142, 908, 909,
+	910, 911, 912, 913, 914, 915, 814, 916, 815, 816, 917, 818, 918, 919, 920, 921,
+	820, 922, 822, 41, 48, 825, 826, 899, 53, 923, 828, 57, 924, 925, 926, 927,
+	928, 929, 930, 931, 932, 933, 934, 935, 595, 936, 937, 938, 939, 535, 940, 941,
+	247, 942, 943, 598, 80, 944, 945, 893, 946, 947, 563, 89, 948, 949, 950, 951,
+	952, 953, 954, 896, 955, 956, 167, 170, 957, 958, 895, 84, 959, 960, 961, 962,
+	963, 964, 965, 966, 967, 968, 969, 854, 319, 970, 971, 972, 973, 974, 975, 976,
+	977, 978, 979, 980, 981, 982, 983, 984, 349, 560, 985, 986, 987, 988, 989, 990,
+	991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+	1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+	1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+	1039, 1040, 1041, 1042, 827, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+	1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+	1070, 1071, 1072, 1073, 1074, 1075, 1076, 194, 131, 163, 133, 1077, 1078, 212, 333, 1079,
+	1080, 1081, 1082, 1083, 1084, 1085, 372, 589, 1086, 1087, 1088, 1089, 149, 181, 349, 560,
+	1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+	1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+	1122, 1123, 1124, 541, 1125, 849, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
+	1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151,
+	1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+	1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+	1184, 1185, 799, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+	1155, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 79, 1212,
+	1213, 1214, 1215, 86, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 80, 1223, 1224, 1225, 1226,
+	1227, 1228, 753, 1229, 1230, 718, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240,
+	1241, 676, 1242, 1243, 719, 1244, 1245, 1246, 1247, 676, 1248, 1249, 1250, 1251, 658, 1252,
+	1253, 1254, 1255, 731, 732, 1256, 728, 726, 1257, 1258, 1259, 1260, 734, 1261, 1262, 1263,
+	1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+	1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+	1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+	1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+	1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1340,
+	1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+	1359, 1360, 1361, 1362, 1363, 1364, 1360, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+	1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+	1390, 1391, 1392, 1393, 1394, 1359, 1395, 1396, 1397, 1398, 1399, 1263, 1400, 1401, 1402, 1403,
+	1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+	1420, 1421, 1422, 1423, 1424, 1425, 1426, 912, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+	1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+	1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466,
+	1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482,
+	1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+	1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+	1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+	1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+	1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+	1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
+	1579, 1580, 1581, 1582, 1583, 1584, 831, 1585, 832, 1586, 833, 1587, 1588, 1589, 178, 1590,
+	857, 1591, 858, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+	1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,
+	1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+	1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 193, 1647, 1648, 806, 1649, 1650,
+	718, 1650, 660, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 807, 1658, 808, 1659, 1660, 1661,
+	1662, 1663, 1664, 1665, 1665, 1666, 1667, 235, 1668, 1669, 809, 1670, 1671, 1672, 1673, 1674,
+	1675, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 811, 1683, 1684, 805, 1685, 1686, 1687,
+	1688, 1689, 1690, 269, 1691, 1692, 812, 1693, 644, 1694, 108, 108, 745, 745, 1303, 1303,
+	382, 743, 1695, 1696, 1697, 1698, 1699, 678, 1700, 1701, 1702, 1703, 1704, 1705, 4267, 1707,
+	1708, 1260, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722,
+	1723, 738, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+	1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+	1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1231, 1763, 1764, 1765, 1766, 1767, 1768,
+	1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+	1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+	1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+	1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+	1849, 1126, 931, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862,
+	1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+	830, 1879, 1880, 1881, 820, 132, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1271,
+	1272, 1273, 1274, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+	1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+	1920, 1921, 1922, 1923, 1924, 1925, 1926, 381, 382, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+	57, 1934, 1935, 45, 899, 1936, 1937, 96, 1938, 1939, 1940, 87, 1941, 1942, 1943, 1944,
+	89, 1945, 1946, 1947, 893, 1948, 1949, 1950, 1951, 1952, 325, 1953, 1954, 1955, 1956, 1957,
+	1958, 1959, 1960, 1955, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972,
+	1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988,
+	1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+	2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020,
+	2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036,
+	2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052,
+	2053, 2054, 2055, 2026, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2061, 2064, 2065, 2066,
+	2067, 2068, 2069, 332, 2070, 2071, 817, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+	2081, 2082, 745, 2083, 2084, 2085, 2086, 2087, 2088, 118, 2089, 2090, 2091, 2092, 2093, 601,
+	2094, 2095, 2096, 93, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+	2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+	2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+	2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+	2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 106, 122, 2167, 2168, 2169, 2170,
+	2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+	2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202,
+	2203, 2204, 2205, 944, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 349, 2215, 2216,
+	2217, 2218, 2219, 2220, 53, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231,
+	2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247,
+	2248, 2249, 2250, 2251, 2252, 1260, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262,
+	2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278,
+	2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294,
+	2295, 2296, 2297, 2298, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309,
+	2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325,
+	2326, 2327, 2328, 2329, 2330, 2331, 2332, 2268, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340,
+	2341, 2342, 2343, 2344, 2345, 2346, 2347, 2217, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355,
+	2356, 2357, 2358, 2314, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 1408, 2212, 2366, 2367, 2368,
+	2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384,
+	2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400,
+	2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416,
+	2417, 2418, 2419, 854, 2420, 2421, 2422, 2423, 836, 2424, 2425, 2426, 2427, 2428, 2429, 2430,
+	2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446,
+	2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462,
+	2457, 2463, 2464, 2460, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2469, 1303, 2473, 2474,
+	2475, 2476, 2477, 693, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 742, 2485, 2486, 1408, 2487,
+	2381, 2488, 2489, 2490, 2412, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2469, 2344,
+	2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2510, 2511,
+	2514, 2515, 1303, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+	2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544,
+	2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 693, 2554, 2555, 2556, 2557, 2558, 2559,
+	2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575,
+	2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591,
+	2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+	2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+	2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639,
+	2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655,
+	2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+	2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687,
+	2688, 2689, 2690, 2662, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702,
+	2703, 2704, 2668, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717,
+	2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 1303, 2726, 2469, 2727, 2294, 2728, 2729, 2730,
+	2294, 2728, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744,
+	2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760,
+	2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776,
+	2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792,
+	2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808,
+	2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+	2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840,
+	2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856,
+	2857, 2858, 2859, 2859, 2860, 2861, 2861, 2480, 2862, 2863, 2864, 2865, 2866, 2481, 2867, 2868,
+	2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 80, 2879, 2880, 2881, 2882, 2883,
+	2884, 2885, 2886, 2887, 2888, 2889, 2890, 2360, 2891, 2892, 2893, 817, 2894, 2895, 4268, 2897,
+	1705, 2898, 2899, 2900, 2901, 2072, 2902, 2903, 4269, 2905, 2906, 2907, 2908, 2909, 2910, 2911,
+	2912, 2913, 2914, 2915, 2916, 2917, 2212, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926,
+	2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 80, 2941,
+	2942, 2943, 2944, 2881, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956,
+	2957, 2958, 2959, 2960, 2961, 2960, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2253, 2969, 2970,
+	2971, 2211, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 1354, 2981, 2982, 2983, 2984,
+	2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000,
+	3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 4270, 3016,
+	3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032,
+	3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048,
+	3049, 3050, 3051, 3052, 3053, 3054, 3055, 2914, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+	3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079,
+	3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095,
+	3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111,
+	3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 80, 3124, 80, 2917,
+	3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 560,
+	2214, 3124, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153,
+	3154, 3155, 3156, 3157, 89, 3158, 3159, 3160, 3161, 3162, 2241, 3163, 1702, 3164, 3165, 2999,
+	3166, 12, 3167, 3168, 3169, 2910, 3170, 3171, 3172, 2969, 3173, 2253, 2253, 3174, 3175, 1738,
+	3176, 3177, 3177, 3177, 1738, 3178, 3178, 3179, 3180, 1738, 3176, 1738, 3181, 3182, 3183, 3184,
+	3185, 1738, 1738, 1738, 1738, 3177, 3177, 3177, 3177, 3177, 3186, 3187, 3188, 3187, 3188, 3189,
+	381, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+	3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 9, 10, 3213, 3214, 3215, 3216, 3217, 3218,
+	3219, 3220, 3221, 3222, 3223, 3224, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577,
+	3225, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224, 3226, 3227, 3228, 3229, 3230, 3231,
+	3232, 3233, 3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3244, 3244, 3244,
+	3245, 3245, 3244, 3244, 3246, 3247, 3248, 3247, 3249, 3250, 3251, 3252, 3253, 3253, 3247, 3254,
+	3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 2912, 3268, 3269,
+	3270, 3271, 3272, 3273, 3274, 2221, 53, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 2911, 3282,
+	3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298,
+	3299, 3300, 1836, 3301, 3302, 3303, 3304, 2025, 3305, 3306, 3307, 3308, 2034, 1, 3309, 3310,
+	3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326,
+	3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342,
+	3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358,
+	3359, 3360, 3361, 3100, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373,
+	3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389,
+	3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+	3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421,
+	3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+	3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+	3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469,
+	3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485,
+	3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501,
+	3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517,
+	3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533,
+	3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549,
+	3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565,
+	3566, 3567, 3568, 3307, 3308, 3569, 3570, 3571, 3572, 3573, 3574, 2037, 2039, 3575, 3576, 3577,
+	3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593,
+	3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 89, 89, 3599, 3599, 3602, 3603, 3598, 3598,
+	3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619,
+	3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635,
+	3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 18, 3649, 3650,
+	3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666,
+	3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 1927, 3680, 3681,
+	3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697,
+	3698, 3699, 3700, 3701, 3702, 3703, 1754, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712,
+	3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728,
+	3729, 3730, 560, 2917, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 104, 3741,
+	3742, 2884, 2883, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+	3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3126, 3768, 3769, 3770,
+	3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786,
+	3787, 3788, 3789, 3790, 3791, 3792, 3789, 3793, 3794, 3288, 3289, 3795, 3796, 2211, 2207, 2209,
+	3797, 2201, 825, 3798, 3799, 3800, 150, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809,
+	3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825,
+	3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 89, 3838, 3839, 3840,
+	3841, 3842, 3843, 3844, 2213, 3845, 3846, 3847, 3846, 2505, 3848, 3849, 3850, 3851, 3852, 3853,
+	3854, 3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869,
+	3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885,
+	3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 2120, 3894, 3895, 3896, 3897, 3898, 3899, 3900,
+	3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916,
+	3917, 3918, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932,
+	3933, 3934, 3935, 3936, 3937, 3938, 3939, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947,
+	3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963,
+	3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979,
+	3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995,
+	3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011,
+	4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027,
+	4028, 1927, 4029, 4030, 4031, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042,
+	4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058,
+	4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 2877, 2878, 4067, 4068, 4069, 4070, 4071, 4072,
+	4073, 4074, 2910, 2911, 4075, 4076, 2910, 4077, 2914, 4078, 4079, 4080, 48, 4081, 4082, 4081,
+	4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4081, 4094, 4095, 4096, 4097,
+	4098, 4099, 2031, 2032, 3666, 3669, 4096, 4097, 3667, 3668, 4109, 4110, 4111, 4112, 4113, 4114,
+	4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 3852, 4124, 4125, 4126, 4127, 795, 4128,
+	4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144,
+	4145, 4146, 4147, 4148, 4149, 4150, 4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160,
+	4161, 4162, 4163, 4164, 4165, 4166, 4167, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177,
+	4178, 4179, 4180,
+};
+static const uint16_t orpi_chunks[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 26, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34,
+	35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+	51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+	67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 0, 0,
+	0, 81, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 85,
+};
+static const uint64_t orpi_coverage[] = {
+	0x0000000000000000, 0xffffffff00000001, 0x7fffffffffffffff, 0xffffffff00000000,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x7cffffffffffffff, 0xfffffffbffffd7f0,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xfffe000fffffffff, 0xfffffffefe7fffff, 0xfffffffffffe06ff,
+	0x001f07ffffff00ff, 0xffffffff1fffffff, 0x0001ffffffffffff, 0xc03f0000c00ffcfc,
+	0x0003ffff00f0000f, 0x000000000000ffff, 0x03fc000000000000, 0xffffffff3f3fffff,
+	0x3fffffffaaff3f3f, 0xffdfffffffffffff, 0x7fdcffffefcfffdf, 0xffff00ffffff0000,
+	0xfff300007fffffff, 0x003fffff001f7fff, 0x0001ffffffff0000, 0xffffffffffffffff,
+	0xfffffffffff8ffff, 0xffffffffffff01ff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffff9ffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0x000000ffffffffff, 0x0000007fffffffff,
+	0xffffffff000007ff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xfffffffffecfffff,
+	0xffffffffffffffff, 0x1fffffff1fffffff, 0x000000000000000f, 0xfffffefffffff3de,
+	0xfffffffe7f47afff, 0x7ffeffffff1fffff, 0xffffffffffff17ff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+	0x0000000000001fff, 0x3ffeffff00000000, 0xffffffff00000000, 0x000000000000007f,
+	0x0000000f00000000, 0x2000000000000000,
+};
+static const uint16_t orpi_ranks[] = {
+	0, 0, 33, 96, 128, 192, 256, 320, 384, 448, 512, 576, 640, 704, 768, 829,
+	886, 950, 1014, 1078, 1142, 1206, 1257, 1318, 1375, 1415, 1476, 1525, 1551, 1577, 1593, 1601,
+	1661, 1715, 1778, 1834, 1874, 1919, 1961, 1994, 2058, 2119, 2176, 2240, 2304, 2368, 2432, 2496,
+	2558, 2622, 2686, 2726, 2765, 2808, 2872, 2936, 3000, 3064, 3128, 3192, 3253, 3317, 3375, 3379,
+	3438, 3494, 3553, 3613, 3677, 3741, 3805, 3869, 3933, 3997, 4061, 4125, 4189, 4253, 4317, 4381,
+	4445, 4458, 4487, 4519, 4526, 4530,
+};
+static const FBInkFont orpi_font = {
+	.map =
+	    {
+		.chunks      = orpi_chunks,
+		.coverage    = orpi_coverage,
+		.ranks       = orpi_ranks,
+		.chunk_count = 1024U,
+	    },
+	.ids         = orpi_ids,
+	.bitmaps     = orp_bitmaps,
+	.width       = 6U,
+	.height      = 12U,
+	.bitmap_size = 9U,
+};
 
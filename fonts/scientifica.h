@@ -1,1421 +1,1533 @@
 /*
 * C Header for use with https://github.com/NiLuJe/FBInk
-* Converted from Hex font ../fonts/scientifica-5x12.hex
+* Converted from Hex fonts ../fonts/scientifica-5x12.hex, ../fonts/scientifica-5x12b.hex
 * With FBInk's tools/hextoc.py
 */
 
-static const unsigned char scientifica_block1[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0020 ( )
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00 },	// U+0021 (!)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0022 (")
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x00, 0x00 },	// U+0023 (#)
-	{ 0x00, 0x00, 0x04, 0x04, 0x0e, 0x02, 0x0e, 0x08, 0x0e, 0x04, 0x04, 0x00 },	// U+0024 ($)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x02, 0x09, 0x00, 0x00, 0x00 },	// U+0025 (%)
-	{ 0x00, 0x00, 0x00, 0x06, 0x01, 0x09, 0x1e, 0x09, 0x09, 0x16, 0x00, 0x00 },	// U+0026 (&)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0027 (')
-	{ 0x00, 0x00, 0x0c, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0c, 0x00 },	// U+0028 (()
-	{ 0x00, 0x00, 0x03, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x03, 0x00 },	// U+0029 ())
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x1f, 0x04, 0x0a, 0x00, 0x00 },	// U+002A (*)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+002B (+)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00 },	// U+002C (,)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+002D (-)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+002E (.)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00 },	// U+002F (/)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x0d, 0x0b, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0030 (0)
-	{ 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0031 (1)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+0032 (2)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x0a, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0033 (3)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x05, 0x0f, 0x04, 0x04, 0x00, 0x00 },	// U+0034 (4)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x07, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0035 (5)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x07, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0036 (6)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x00, 0x00 },	// U+0037 (7)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0038 (8)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0039 (9)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00 },	// U+003A (:)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00 },	// U+003B (;)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00 },	// U+003C (<)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00 },	// U+003D (=)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x00 },	// U+003E (>)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x04, 0x02, 0x00, 0x02, 0x00, 0x00 },	// U+003F (?)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x0d, 0x0d, 0x0d, 0x01, 0x0e, 0x00, 0x00 },	// U+0040 (@)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0041 (A)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0042 (B)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0043 (C)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0044 (D)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0045 (E)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0046 (F)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x0d, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0047 (G)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0048 (H)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x00, 0x00 },	// U+0049 (I)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0e, 0x00, 0x00 },	// U+004A (J)
-	{ 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x05, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+004B (K)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+004C (L)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0f, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+004D (M)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0b, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x00, 0x00 },	// U+004E (N)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+004F (O)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0050 (P)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x04, 0x08 },	// U+0051 (Q)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0052 (R)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0053 (S)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+0054 (T)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0055 (U)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x06, 0x00, 0x00 },	// U+0056 (V)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x0f, 0x09, 0x00, 0x00 },	// U+0057 (W)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0058 (X)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x0e, 0x00, 0x00 },	// U+0059 (Y)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x02, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+005A (Z)
-	{ 0x00, 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x00 },	// U+005B ([)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00 },	// U+005C (\)
-	{ 0x00, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, 0x00 },	// U+005D (])
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+005E (^)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00 },	// U+005F (_)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+0060 (`)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+0061 (a)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0062 (b)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0063 (c)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0064 (d)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0065 (e)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x02, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+0066 (f)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x06 },	// U+0067 (g)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0068 (h)
-	{ 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+0069 (i)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03 },	// U+006A (j)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00, 0x00 },	// U+006B (k)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+006C (l)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+006D (m)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+006E (n)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+006F (o)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x07, 0x01, 0x01 },	// U+0070 (p)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x08 },	// U+0071 (q)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0072 (r)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x00, 0x00 },	// U+0073 (s)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+0074 (t)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0075 (u)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x06, 0x06, 0x00, 0x00 },	// U+0076 (v)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x00, 0x00 },	// U+0077 (w)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+0078 (x)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x06 },	// U+0079 (y)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+007A (z)
-	{ 0x00, 0x00, 0x08, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x08, 0x00 },	// U+007B ({)
-	{ 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 },	// U+007C (|)
-	{ 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x02, 0x00 },	// U+007D (})
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x08, 0x00, 0x00, 0x00 },	// U+007E (~)
-}; // 95
-
-static const unsigned char scientifica_block2[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A0 ( )
-	{ 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A1 (¡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x0b, 0x03, 0x0b, 0x06, 0x02, 0x00 },	// U+00A2 (¢)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x03, 0x01, 0x0b, 0x0d, 0x00, 0x00 },	// U+00A3 (£)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0e, 0x0a, 0x0e, 0x11, 0x00, 0x00 },	// U+00A4 (¤)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+00A5 (¥)
-	{ 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+00A6 (¦)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x07, 0x09, 0x0e, 0x08, 0x07, 0x00, 0x00 },	// U+00A7 (§)
-	{ 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00A8 (¨)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0d, 0x05, 0x0d, 0x11, 0x0e, 0x00, 0x00 },	// U+00A9 (©)
-	{ 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+00AA (ª)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x12, 0x00, 0x00, 0x00 },	// U+00AB («)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00 },	// U+00AC (¬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+00AD (­)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x0d, 0x05, 0x05, 0x11, 0x0e, 0x00, 0x00 },	// U+00AE (®)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00AF (¯)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B0 (°)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x04, 0x1f, 0x00, 0x00 },	// U+00B1 (±)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x08, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B2 (²)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B3 (³)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B4 (´)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x11, 0x01 },	// U+00B5 (µ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x00 },	// U+00B6 (¶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+00B7 (·)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06 },	// U+00B8 (¸)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+00B9 (¹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x00, 0x07, 0x00, 0x00, 0x00 },	// U+00BA (º)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x09, 0x00, 0x00, 0x00 },	// U+00BB (»)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x0f, 0x00, 0x02, 0x0a, 0x0e, 0x08 },	// U+00BC (¼)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x0f, 0x00, 0x0e, 0x08, 0x04, 0x0e },	// U+00BD (½)
-	{ 0x00, 0x0e, 0x04, 0x08, 0x06, 0x00, 0x0f, 0x00, 0x02, 0x0a, 0x0e, 0x08 },	// U+00BE (¾)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x02, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+00BF (¿)
-	{ 0x00, 0x02, 0x04, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C0 (À)
-	{ 0x00, 0x04, 0x02, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C1 (Á)
-	{ 0x00, 0x04, 0x0a, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C2 (Â)
-	{ 0x00, 0x0a, 0x05, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C3 (Ã)
-	{ 0x00, 0x09, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C4 (Ä)
-	{ 0x00, 0x02, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00C5 (Å)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x05, 0x05, 0x0f, 0x05, 0x05, 0x0d, 0x00, 0x00 },	// U+00C6 (Æ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x04, 0x06 },	// U+00C7 (Ç)
-	{ 0x00, 0x02, 0x04, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+00C8 (È)
-	{ 0x00, 0x04, 0x02, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+00C9 (É)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x0f, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+00CA (Ê)
-	{ 0x00, 0x0a, 0x00, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+00CB (Ë)
-	{ 0x00, 0x01, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+00CC (Ì)
-	{ 0x00, 0x04, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+00CD (Í)
-	{ 0x00, 0x02, 0x05, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+00CE (Î)
-	{ 0x00, 0x05, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+00CF (Ï)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x12, 0x12, 0x17, 0x12, 0x12, 0x0e, 0x00, 0x00 },	// U+00D0 (Ð)
-	{ 0x00, 0x0a, 0x05, 0x09, 0x09, 0x0b, 0x0b, 0x0d, 0x0d, 0x09, 0x00, 0x00 },	// U+00D1 (Ñ)
-	{ 0x00, 0x02, 0x04, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D2 (Ò)
-	{ 0x00, 0x04, 0x02, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D3 (Ó)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D4 (Ô)
-	{ 0x00, 0x0a, 0x05, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D5 (Õ)
-	{ 0x00, 0x09, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D6 (Ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+00D7 (×)
-	{ 0x00, 0x00, 0x00, 0x16, 0x19, 0x0d, 0x0b, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00D8 (Ø)
-	{ 0x00, 0x02, 0x04, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00D9 (Ù)
-	{ 0x00, 0x04, 0x02, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00DA (Ú)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00DB (Û)
-	{ 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00DC (Ü)
-	{ 0x00, 0x04, 0x02, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+00DD (Ý)
-	{ 0x00, 0x00, 0x00, 0x01, 0x07, 0x09, 0x09, 0x09, 0x07, 0x01, 0x00, 0x00 },	// U+00DE (Þ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x0b, 0x09, 0x07, 0x01, 0x00 },	// U+00DF (ß)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E0 (à)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E1 (á)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E2 (â)
-	{ 0x00, 0x00, 0x14, 0x0a, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E3 (ã)
-	{ 0x00, 0x00, 0x00, 0x09, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E4 (ä)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+00E5 (å)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x05, 0x0f, 0x05, 0x0d, 0x00, 0x00 },	// U+00E6 (æ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x04, 0x06 },	// U+00E7 (ç)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00E8 (è)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00E9 (é)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00EA (ê)
-	{ 0x00, 0x00, 0x00, 0x09, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+00EB (ë)
-	{ 0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+00EC (ì)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+00ED (í)
-	{ 0x00, 0x00, 0x02, 0x05, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+00EE (î)
-	{ 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+00EF (ï)
-	{ 0x00, 0x00, 0x00, 0x06, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F0 (ð)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+00F1 (ñ)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F2 (ò)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F3 (ó)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F4 (ô)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F5 (õ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+00F6 (ö)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x06, 0x00, 0x00 },	// U+00F7 (÷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x0d, 0x0b, 0x09, 0x06, 0x00, 0x00 },	// U+00F8 (ø)
-	{ 0x00, 0x00, 0x02, 0x04, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00F9 (ù)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00FA (ú)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00FB (û)
-	{ 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+00FC (ü)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x09, 0x06 },	// U+00FD (ý)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x09, 0x09, 0x07, 0x01, 0x01 },	// U+00FE (þ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x09, 0x06 },	// U+00FF (ÿ)
-	{ 0x00, 0x0f, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0100 (Ā)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+0101 (ā)
-	{ 0x00, 0x09, 0x06, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0102 (Ă)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x00, 0x00 },	// U+0103 (ă)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x04, 0x0c },	// U+0104 (Ą)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x0d, 0x0a, 0x02, 0x06 },	// U+0105 (ą)
-	{ 0x00, 0x08, 0x04, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0106 (Ć)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0107 (ć)
-	{ 0x00, 0x04, 0x0a, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0108 (Ĉ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0109 (ĉ)
-	{ 0x00, 0x04, 0x00, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+010A (Ċ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+010B (ċ)
-	{ 0x00, 0x0a, 0x04, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+010C (Č)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+010D (č)
-	{ 0x00, 0x0a, 0x04, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+010E (Ď)
-	{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x06, 0x05, 0x05, 0x05, 0x06, 0x00, 0x00 },	// U+010F (ď)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x0b, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0110 (Đ)
-	{ 0x00, 0x00, 0x08, 0x0e, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0111 (đ)
-	{ 0x00, 0x0f, 0x00, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0112 (Ē)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0113 (ē)
-	{ 0x00, 0x09, 0x06, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0114 (Ĕ)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0115 (ĕ)
-	{ 0x00, 0x04, 0x00, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0116 (Ė)
-	{ 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+0117 (ė)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x04, 0x0c },	// U+0118 (Ę)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x04, 0x0c },	// U+0119 (ę)
-	{ 0x00, 0x0a, 0x04, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+011A (Ě)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x06, 0x09, 0x0f, 0x01, 0x0e, 0x00, 0x00 },	// U+011B (ě)
-	{ 0x00, 0x04, 0x0a, 0x06, 0x09, 0x01, 0x01, 0x0d, 0x09, 0x06, 0x00, 0x00 },	// U+011C (Ĝ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x06 },	// U+011D (ĝ)
-	{ 0x00, 0x09, 0x06, 0x06, 0x09, 0x01, 0x01, 0x0d, 0x09, 0x06, 0x00, 0x00 },	// U+011E (Ğ)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x06 },	// U+011F (ğ)
-	{ 0x00, 0x02, 0x00, 0x06, 0x09, 0x01, 0x01, 0x0d, 0x09, 0x06, 0x00, 0x00 },	// U+0120 (Ġ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x0e },	// U+0121 (ġ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x01, 0x0d, 0x09, 0x06, 0x04, 0x06 },	// U+0122 (Ģ)
-	{ 0x00, 0x00, 0x08, 0x04, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x0e },	// U+0123 (ģ)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0124 (Ĥ)
-	{ 0x00, 0x02, 0x05, 0x01, 0x01, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0125 (ĥ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0f, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0126 (Ħ)
-	{ 0x00, 0x00, 0x01, 0x07, 0x01, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0127 (ħ)
-	{ 0x00, 0x0a, 0x05, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+0128 (Ĩ)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+0129 (ĩ)
-	{ 0x00, 0x07, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+012A (Ī)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+012B (ī)
-	{ 0x00, 0x09, 0x06, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+012C (Ĭ)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+012D (ĭ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x04, 0x0c },	// U+012E (Į)
-	{ 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x01, 0x03 },	// U+012F (į)
-	{ 0x00, 0x02, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+0130 (İ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+0131 (ı)
-	{ 0x00, 0x00, 0x00, 0x0d, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x0d, 0x00, 0x00 },	// U+0132 (Ĳ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02 },	// U+0133 (ĳ)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x08, 0x08, 0x08, 0x09, 0x0e, 0x00, 0x00 },	// U+0134 (Ĵ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02 },	// U+0135 (ĵ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x05, 0x09, 0x09, 0x09, 0x04, 0x06 },	// U+0136 (Ķ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x04, 0x06 },	// U+0137 (ķ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x07, 0x05, 0x09, 0x09, 0x00, 0x00 },	// U+0138 (ĸ)
-	{ 0x00, 0x04, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0139 (Ĺ)
-	{ 0x00, 0x04, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+013A (ĺ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x04, 0x06 },	// U+013B (Ļ)
-	{ 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0c, 0x02, 0x03 },	// U+013C (ļ)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+013D (Ľ)
-	{ 0x00, 0x00, 0x00, 0x0b, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+013E (ľ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+013F (Ŀ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x0a, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+0140 (ŀ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0141 (Ł)
-	{ 0x00, 0x00, 0x00, 0x03, 0x0a, 0x06, 0x02, 0x03, 0x02, 0x0c, 0x00, 0x00 },	// U+0142 (ł)
-	{ 0x00, 0x08, 0x04, 0x09, 0x09, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x00, 0x00 },	// U+0143 (Ń)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0144 (ń)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x04, 0x0c },	// U+0145 (Ņ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x04, 0x0c },	// U+0146 (ņ)
-	{ 0x00, 0x0a, 0x04, 0x09, 0x0b, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x00, 0x00 },	// U+0147 (Ň)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0148 (ň)
-	{ 0x00, 0x00, 0x02, 0x01, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0149 (ŉ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x08, 0x06 },	// U+014A (Ŋ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x08, 0x04 },	// U+014B (ŋ)
-	{ 0x00, 0x0f, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+014C (Ō)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+014D (ō)
-	{ 0x00, 0x09, 0x06, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+014E (Ŏ)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+014F (ŏ)
-	{ 0x00, 0x0a, 0x05, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0150 (Ő)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0151 (ő)
-	{ 0x00, 0x00, 0x00, 0x1e, 0x05, 0x05, 0x1d, 0x05, 0x05, 0x1e, 0x00, 0x00 },	// U+0152 (Œ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x15, 0x1d, 0x05, 0x1e, 0x00, 0x00 },	// U+0153 (œ)
-	{ 0x00, 0x04, 0x02, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0154 (Ŕ)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0155 (ŕ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x02, 0x01 },	// U+0156 (Ŗ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x02, 0x01 },	// U+0157 (ŗ)
-	{ 0x00, 0x0a, 0x04, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0158 (Ř)
-	{ 0x00, 0x0a, 0x04, 0x00, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0159 (ř)
-	{ 0x00, 0x04, 0x02, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+015A (Ś)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x00, 0x00 },	// U+015B (ś)
-	{ 0x00, 0x04, 0x0a, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+015C (Ŝ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x00, 0x00 },	// U+015D (ŝ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x04, 0x06 },	// U+015E (Ş)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x04, 0x06 },	// U+015F (ş)
-	{ 0x00, 0x0a, 0x04, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0160 (Š)
-	{ 0x00, 0x00, 0x0a, 0x04, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x00, 0x00 },	// U+0161 (š)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x06 },	// U+0162 (Ţ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x02, 0x02, 0x04, 0x02, 0x03 },	// U+0163 (ţ)
-	{ 0x00, 0x05, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+0164 (Ť)
-	{ 0x00, 0x00, 0x00, 0x12, 0x12, 0x07, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00 },	// U+0165 (ť)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x07, 0x02, 0x02, 0x00, 0x00 },	// U+0166 (Ŧ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x04, 0x00, 0x00 },	// U+0167 (ŧ)
-	{ 0x00, 0x05, 0x0a, 0x01, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0168 (Ũ)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0169 (ũ)
-	{ 0x00, 0x07, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016A (Ū)
-	{ 0x00, 0x00, 0x00, 0x07, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016B (ū)
-	{ 0x00, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016C (Ŭ)
-	{ 0x00, 0x00, 0x09, 0x06, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016D (ŭ)
-	{ 0x00, 0x04, 0x0a, 0x0d, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016E (Ů)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+016F (ů)
-	{ 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0170 (Ű)
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0171 (ű)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x04, 0x08 },	// U+0172 (Ų)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x18 },	// U+0173 (ų)
-	{ 0x00, 0x04, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x00, 0x00 },	// U+0174 (Ŵ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x00, 0x00 },	// U+0175 (ŵ)
-	{ 0x00, 0x04, 0x0a, 0x01, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x0e, 0x00, 0x00 },	// U+0176 (Ŷ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x09, 0x06 },	// U+0177 (ŷ)
-	{ 0x00, 0x09, 0x00, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x0e, 0x00, 0x00 },	// U+0178 (Ÿ)
-	{ 0x00, 0x02, 0x00, 0x0f, 0x08, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+0179 (Ź)
-	{ 0x00, 0x00, 0x04, 0x02, 0x00, 0x0f, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+017A (ź)
-	{ 0x00, 0x02, 0x00, 0x0f, 0x08, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+017B (Ż)
-	{ 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+017C (ż)
-	{ 0x00, 0x0a, 0x04, 0x0f, 0x08, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+017D (Ž)
-	{ 0x00, 0x0a, 0x04, 0x00, 0x00, 0x0f, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+017E (ž)
-	{ 0x00, 0x00, 0x00, 0x0c, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+017F (ſ)
-	{ 0x00, 0x00, 0x01, 0x07, 0x01, 0x07, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0180 (ƀ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x0c, 0x14, 0x14, 0x0c, 0x00, 0x00 },	// U+0181 (Ɓ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0182 (Ƃ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x07, 0x09, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0183 (ƃ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x06, 0x0a, 0x0a, 0x06, 0x00, 0x00 },	// U+0184 (Ƅ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x03, 0x06, 0x0a, 0x0a, 0x0a, 0x06, 0x00, 0x00 },	// U+0185 (ƅ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0186 (Ɔ)
-	{ 0x00, 0x18, 0x04, 0x06, 0x09, 0x01, 0x01, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0187 (Ƈ)
-	{ 0x00, 0x00, 0x00, 0x18, 0x04, 0x06, 0x09, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0188 (ƈ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x0a, 0x0a, 0x0f, 0x0a, 0x0a, 0x06, 0x00, 0x00 },	// U+0189 (Ɖ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x15, 0x14, 0x14, 0x14, 0x14, 0x0c, 0x00, 0x00 },	// U+018A (Ɗ)
-	{ 0x00, 0x00, 0x0f, 0x08, 0x08, 0x08, 0x0e, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+018B (Ƌ)
-	{ 0x00, 0x00, 0x0f, 0x08, 0x08, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+018C (ƌ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x08, 0x07 },	// U+018D (ƍ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x0c, 0x08, 0x08, 0x0f, 0x00, 0x00 },	// U+018E (Ǝ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0f, 0x09, 0x06, 0x00, 0x00 },	// U+018F (Ə)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x01, 0x01, 0x06, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+0190 (Ɛ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x01 },	// U+0191 (Ƒ)
-	{ 0x00, 0x00, 0x04, 0x0a, 0x02, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x01 },	// U+0192 (ƒ)
-	{ 0x00, 0x0c, 0x02, 0x06, 0x09, 0x01, 0x01, 0x0d, 0x09, 0x06, 0x00, 0x00 },	// U+0193 (Ɠ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0a, 0x04, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0194 (Ɣ)
-	{ 0x00, 0x00, 0x00, 0x01, 0x09, 0x13, 0x15, 0x15, 0x15, 0x0d, 0x00, 0x00 },	// U+0195 (ƕ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00 },	// U+0196 (Ɩ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x02, 0x00, 0x00 },	// U+0197 (Ɨ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x15, 0x03, 0x05, 0x05, 0x09, 0x09, 0x00, 0x00 },	// U+0198 (Ƙ)
-	{ 0x00, 0x00, 0x02, 0x05, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00, 0x00 },	// U+0199 (ƙ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x04, 0x04, 0x0e, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+019A (ƚ)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x05, 0x04, 0x04, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+019B (ƛ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x00, 0x00 },	// U+019C (Ɯ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x08, 0x06 },	// U+019D (Ɲ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08 },	// U+019E (ƞ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x0f, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+019F (Ɵ)
-	{ 0x00, 0x08, 0x08, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01A0 (Ơ)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01A1 (ơ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x15, 0x15, 0x15, 0x15, 0x16, 0x00, 0x00 },	// U+01A2 (Ƣ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x16, 0x10, 0x10, 0x08 },	// U+01A3 (ƣ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x0b, 0x0a, 0x06, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+01A4 (Ƥ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x01, 0x07, 0x09, 0x09, 0x09, 0x07, 0x01, 0x01 },	// U+01A5 (ƥ)
-	{ 0x00, 0x00, 0x01, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x09, 0x08, 0x10 },	// U+01A6 (Ʀ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x06, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+01A7 (Ƨ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x06, 0x01, 0x0e, 0x00, 0x00 },	// U+01A8 (ƨ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x02, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+01A9 (Ʃ)
-	{ 0x00, 0x02, 0x05, 0x04, 0x0e, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, 0x00 },	// U+01AA (ƪ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x0c, 0x08, 0x04 },	// U+01AB (ƫ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+01AC (Ƭ)
-	{ 0x00, 0x04, 0x02, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+01AD (ƭ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04 },	// U+01AE (Ʈ)
-	{ 0x00, 0x10, 0x10, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01AF (Ư)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+01B0 (ư)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0a, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+01B1 (Ʊ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x05, 0x03, 0x00, 0x00 },	// U+01B2 (Ʋ)
-	{ 0x00, 0x00, 0x08, 0x15, 0x05, 0x05, 0x06, 0x04, 0x05, 0x06, 0x00, 0x00 },	// U+01B3 (Ƴ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x05, 0x05, 0x05, 0x06, 0x05, 0x06 },	// U+01B4 (ƴ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x0f, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+01B5 (Ƶ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x04, 0x0f, 0x02, 0x0f, 0x00, 0x00 },	// U+01B6 (ƶ)
-}; // 279
-
-static const unsigned char scientifica_block3[][12] = {
-	{ 0x00, 0x00, 0x00, 0x0d, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x08, 0x06 },	// U+01C7 (Ǉ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x01, 0x09, 0x09, 0x09, 0x09, 0x0b, 0x08, 0x04 },	// U+01C8 (ǈ)
-	{ 0x00, 0x00, 0x00, 0x0b, 0x02, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x08, 0x04 },	// U+01C9 (ǉ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x17, 0x17, 0x15, 0x15, 0x15, 0x15, 0x10, 0x0c },	// U+01CA (Ǌ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x07, 0x17, 0x15, 0x15, 0x15, 0x15, 0x10, 0x08 },	// U+01CB (ǋ)
-	{ 0x00, 0x00, 0x00, 0x10, 0x00, 0x13, 0x15, 0x15, 0x15, 0x15, 0x10, 0x08 },	// U+01CC (ǌ)
-	{ 0x00, 0x05, 0x02, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+01CD (Ǎ)
-	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x0e, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+01CE (ǎ)
-	{ 0x00, 0x05, 0x02, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+01CF (Ǐ)
-	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x03, 0x02, 0x02, 0x02, 0x0c, 0x00, 0x00 },	// U+01D0 (ǐ)
-	{ 0x00, 0x05, 0x02, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01D1 (Ǒ)
-	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01D2 (ǒ)
-	{ 0x00, 0x05, 0x02, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+01D3 (Ǔ)
-	{ 0x00, 0x00, 0x05, 0x02, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+01D4 (ǔ)
-}; // 14
-
-static const unsigned char scientifica_block4[][12] = {
-	{ 0x00, 0x05, 0x0a, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020C (Ȍ)
-	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020D (ȍ)
-	{ 0x00, 0x06, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020E (Ȏ)
-	{ 0x00, 0x00, 0x06, 0x09, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+020F (ȏ)
-	{ 0x00, 0x05, 0x0a, 0x00, 0x07, 0x09, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0210 (Ȑ)
-	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0211 (ȑ)
-	{ 0x00, 0x06, 0x09, 0x00, 0x07, 0x09, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0212 (Ȓ)
-	{ 0x00, 0x00, 0x06, 0x09, 0x00, 0x07, 0x09, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0213 (ȓ)
-	{ 0x00, 0x05, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0214 (Ȕ)
-	{ 0x00, 0x00, 0x05, 0x0a, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0215 (ȕ)
-	{ 0x00, 0x06, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0216 (Ȗ)
-	{ 0x00, 0x00, 0x06, 0x09, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+0217 (ȗ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x01, 0x06, 0x08, 0x09, 0x06, 0x04, 0x02 },	// U+0218 (Ș)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x06, 0x08, 0x07, 0x04, 0x02 },	// U+0219 (ș)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01 },	// U+021A (Ț)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x0c, 0x04, 0x02 },	// U+021B (ț)
-}; // 16
-
-static const unsigned char scientifica_block5[][12] = {
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x08, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+0296 (ʖ)
-}; // 1
-
-static const unsigned char scientifica_block6[][12] = {
-	{ 0x00, 0x00, 0x0e, 0x11, 0x11, 0x15, 0x15, 0x11, 0x11, 0x0e, 0x00, 0x00 },	// U+0298 (ʘ)
-}; // 1
-
-static const unsigned char scientifica_block7[][12] = {
-	{ 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02C7 (ˇ)
-}; // 1
-
-static const unsigned char scientifica_block8[][12] = {
-	{ 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+02DA (˚)
-}; // 1
-
-static const unsigned char scientifica_block9[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x08, 0x04, 0x00, 0x00 },	// U+0364 (ͤ)
-}; // 1
-
-static const unsigned char scientifica_block10[][12] = {
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0391 (Α)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x09, 0x09, 0x07, 0x00, 0x00 },	// U+0392 (Β)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+0393 (Γ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x1f, 0x00, 0x00 },	// U+0394 (Δ)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x01, 0x07, 0x01, 0x01, 0x0f, 0x00, 0x00 },	// U+0395 (Ε)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+0396 (Ζ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+0397 (Η)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+0398 (Θ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+0399 (Ι)
-	{ 0x00, 0x00, 0x00, 0x09, 0x05, 0x03, 0x05, 0x05, 0x09, 0x09, 0x00, 0x00 },	// U+039A (Κ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x11, 0x00, 0x00 },	// U+039B (Λ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+039C (Μ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x0b, 0x0b, 0x0d, 0x0d, 0x09, 0x09, 0x00, 0x00 },	// U+039D (Ν)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x09, 0x00, 0x06, 0x00, 0x09, 0x0f, 0x00, 0x00 },	// U+039E (Ξ)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+039F (Ο)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+03A0 (Π)
-	{ 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x07, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+03A1 (Ρ)
-	{ 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+03A2 (΢)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x01, 0x02, 0x04, 0x02, 0x01, 0x0f, 0x00, 0x00 },	// U+03A3 (Σ)
-	{ 0x00, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+03A4 (Τ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0e, 0x08, 0x09, 0x06, 0x00, 0x00 },	// U+03A5 (Υ)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+03A6 (Φ)
-	{ 0x00, 0x00, 0x00, 0x09, 0x09, 0x06, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+03A7 (Χ)
-	{ 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+03A8 (Ψ)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x1b, 0x0a, 0x1b, 0x00, 0x00 },	// U+03A9 (Ω)
-}; // 25
-
-static const unsigned char scientifica_block11[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x0a, 0x00, 0x00 },	// U+03B1 (α)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x0b, 0x09, 0x07, 0x01, 0x01 },	// U+03B2 (β)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x04, 0x0a, 0x0a, 0x04 },	// U+03B3 (γ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x01, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+03B4 (δ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x02, 0x01, 0x09, 0x06, 0x00, 0x00 },	// U+03B5 (ε)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x02, 0x01, 0x01, 0x0e, 0x08 },	// U+03B6 (ζ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08 },	// U+03B7 (η)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x0f, 0x09, 0x06, 0x00, 0x00 },	// U+03B8 (θ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00 },	// U+03B9 (ι)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+03BA (κ)
-	{ 0x00, 0x00, 0x00, 0x02, 0x05, 0x04, 0x04, 0x0a, 0x09, 0x09, 0x00, 0x00 },	// U+03BB (λ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x11, 0x01 },	// U+03BC (μ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x0a, 0x0a, 0x0a, 0x04, 0x00, 0x00 },	// U+03BD (ν)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x02, 0x01, 0x01, 0x0e, 0x08, 0x06 },	// U+03BE (ξ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+03BF (ο)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+03C0 (π)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x0a, 0x06, 0x02, 0x02 },	// U+03C1 (ρ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x01, 0x06, 0x08, 0x04 },	// U+03C2 (ς)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x06, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+03C3 (σ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x02, 0x0a, 0x04, 0x00, 0x00 },	// U+03C4 (τ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00 },	// U+03C5 (υ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x09, 0x0f, 0x02, 0x02 },	// U+03C6 (φ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x02, 0x05, 0x08, 0x00 },	// U+03C7 (χ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x15, 0x0e, 0x04, 0x04 },	// U+03C8 (ψ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x15, 0x0a, 0x00, 0x00 },	// U+03C9 (ω)
-}; // 25
-
-static const unsigned char scientifica_block12[][12] = {
-	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01 },	// U+0F3C (༼)
-	{ 0x00, 0x00, 0x02, 0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x10 },	// U+0F3D (༽)
-}; // 2
-
-static const unsigned char scientifica_block13[][12] = {
-	{ 0x00, 0x00, 0x00, 0x0e, 0x09, 0x09, 0x05, 0x09, 0x09, 0x0f, 0x01, 0x01 },	// U+1E9E (ẞ)
-}; // 1
-
-static const unsigned char scientifica_block14[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2010 (‐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+2011 (‑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2012 (‒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2013 (–)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2014 (—)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2015 (―)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2016 (‖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00 },	// U+2017 (‗)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2018 (‘)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2019 (’)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04 },	// U+201A (‚)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201B (‛)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201C (“)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201D (”)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x05, 0x00, 0x00 },	// U+201E („)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+201F (‟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+2020 (†)
-	{ 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x02, 0x07, 0x02, 0x02, 0x00, 0x00 },	// U+2021 (‡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2022 (•)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00 },	// U+2023 (‣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+2024 (․)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00 },	// U+2025 (‥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00 },	// U+2026 (…)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2027 (‧)
-}; // 24
-
-static const unsigned char scientifica_block15[][12] = {
-	{ 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2032 (′)
-	{ 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2033 (″)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2034 (‴)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2035 (‵)
-	{ 0x00, 0x00, 0x00, 0x0a, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2036 (‶)
-	{ 0x00, 0x00, 0x00, 0x15, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2037 (‷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00 },	// U+2038 (‸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x04, 0x02, 0x01, 0x00 },	// U+2039 (‹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203A (›)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x0a, 0x00, 0x00, 0x00 },	// U+203B (※)
-	{ 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x00, 0x00 },	// U+203C (‼)
-}; // 11
-
-static const unsigned char scientifica_block16[][12] = {
-	{ 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+203E (‾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x06, 0x00 },	// U+203F (‿)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2040 (⁀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x05, 0x00, 0x00 },	// U+2041 (⁁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00 },	// U+2042 (⁂)
-}; // 5
-
-static const unsigned char scientifica_block17[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x04, 0x00 },	// U+204F (⁏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00 },	// U+2050 (⁐)
-	{ 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00 },	// U+2051 (⁑)
-}; // 3
-
-static const unsigned char scientifica_block18[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x04, 0x1f, 0x04, 0x15, 0x00, 0x00 },	// U+205C (⁜)
-}; // 1
-
-static const unsigned char scientifica_block19[][12] = {
-	{ 0x00, 0x00, 0x1f, 0x08, 0x1f, 0x08, 0x07, 0x02, 0x04, 0x08, 0x00, 0x00 },	// U+20A8 (₨)
-}; // 1
-
-static const unsigned char scientifica_block20[][12] = {
-	{ 0x00, 0x00, 0x00, 0x17, 0x15, 0x15, 0x11, 0x15, 0x15, 0x1d, 0x00, 0x00 },	// U+20AA (₪)
-}; // 1
-
-static const unsigned char scientifica_block21[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x07, 0x07, 0x01, 0x0e, 0x00, 0x00 },	// U+20AC (€)
-}; // 1
-
-static const unsigned char scientifica_block22[][12] = {
-	{ 0x00, 0x0e, 0x04, 0x04, 0x04, 0x0a, 0x0e, 0x0a, 0x0a, 0x00, 0x00, 0x00 },	// U+2122 (™)
-}; // 1
-
-static const unsigned char scientifica_block23[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x1f, 0x02, 0x04, 0x00, 0x00 },	// U+2190 (←)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x04, 0x00, 0x00 },	// U+2191 (↑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x1f, 0x08, 0x04, 0x00, 0x00 },	// U+2192 (→)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00 },	// U+2193 (↓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x00, 0x00, 0x00 },	// U+2194 (↔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, 0x02, 0x07, 0x02, 0x00 },	// U+2195 (↕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x08, 0x00, 0x00 },	// U+2196 (↖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x02, 0x01, 0x00, 0x00 },	// U+2197 (↗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0c, 0x0c, 0x00, 0x00 },	// U+2198 (↘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x03, 0x03, 0x00, 0x00 },	// U+2199 (↙)
-}; // 10
-
-static const unsigned char scientifica_block24[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x14, 0x12, 0x1f, 0x12, 0x14, 0x00, 0x00, 0x00 },	// U+21A4 (↤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x04, 0x1f, 0x00, 0x00, 0x00 },	// U+21A5 (↥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x1f, 0x09, 0x05, 0x00, 0x00, 0x00 },	// U+21A6 (↦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x15, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+21A7 (↧)
-}; // 4
-
-static const unsigned char scientifica_block25[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1f, 0x02, 0x00, 0x00, 0x00 },	// U+21A9 (↩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1f, 0x08, 0x00, 0x00, 0x00 },	// U+21AA (↪)
-}; // 2
-
-static const unsigned char scientifica_block26[][12] = {
-	{ 0x00, 0x00, 0x00, 0x02, 0x0f, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },	// U+21B0 (↰)
-	{ 0x00, 0x00, 0x00, 0x04, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00 },	// U+21B1 (↱)
-	{ 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x0a, 0x0f, 0x02, 0x00, 0x00 },	// U+21B2 (↲)
-	{ 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x05, 0x0f, 0x04, 0x00, 0x00 },	// U+21B3 (↳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x00, 0x00 },	// U+21B4 (↴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x12, 0x1f, 0x02, 0x00, 0x00 },	// U+21B5 (↵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x12, 0x12, 0x17, 0x02, 0x00, 0x00 },	// U+21B6 (↶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x1d, 0x09, 0x00, 0x00 },	// U+21B7 (↷)
-}; // 8
-
-static const unsigned char scientifica_block27[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+21B9 (↹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x19, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+21BA (↺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x12, 0x12, 0x0c, 0x00, 0x00 },	// U+21BB (↻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+21BC (↼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x00, 0x00 },	// U+21BD (↽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+21BE (↾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x00, 0x00 },	// U+21BF (↿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+21C0 (⇀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x00, 0x00 },	// U+21C1 (⇁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x0c, 0x04, 0x00, 0x00 },	// U+21C2 (⇂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x02, 0x00, 0x00 },	// U+21C3 (⇃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x0a, 0x1f, 0x02, 0x00, 0x00 },	// U+21C4 (⇄)
-}; // 12
-
-static const unsigned char scientifica_block28[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x0a, 0x1f, 0x08, 0x00, 0x00 },	// U+21C6 (⇆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x02, 0x1f, 0x02, 0x00, 0x00 },	// U+21C7 (⇇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+21C8 (⇈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x08, 0x1f, 0x08, 0x00, 0x00 },	// U+21C9 (⇉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x1f, 0x0a, 0x00, 0x00 },	// U+21CA (⇊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x00, 0x1f, 0x08, 0x00, 0x00 },	// U+21CB (⇋)
-}; // 6
-
-static const unsigned char scientifica_block29[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1e, 0x01, 0x1e, 0x04, 0x00, 0x00 },	// U+21D0 (⇐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1b, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+21D1 (⇑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x10, 0x0f, 0x04, 0x00, 0x00 },	// U+21D2 (⇒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x1b, 0x0a, 0x04, 0x00 },	// U+21D3 (⇓)
-}; // 4
-
-static const unsigned char scientifica_block30[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x09, 0x06, 0x00 },	// U+2200 (∀)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x05, 0x01, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2201 (∁)
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x08, 0x0e, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+2202 (∂)
-	{ 0x00, 0x00, 0x00, 0x0f, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x0f, 0x00, 0x00 },	// U+2203 (∃)
-	{ 0x00, 0x00, 0x08, 0x0f, 0x0c, 0x0a, 0x0e, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+2204 (∄)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x15, 0x15, 0x0e, 0x04, 0x04, 0x00 },	// U+2205 (∅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x11, 0x1f, 0x00, 0x00, 0x00 },	// U+2206 (∆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00 },	// U+2207 (∇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x0f, 0x01, 0x1e, 0x00, 0x00 },	// U+2208 (∈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x0e, 0x05, 0x07, 0x01, 0x0e, 0x00, 0x00 },	// U+2209 (∉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x07, 0x01, 0x0e, 0x00, 0x00 },	// U+220A (∊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0e, 0x08, 0x07, 0x00, 0x00 },	// U+220B (∋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x0c, 0x0e, 0x09, 0x07, 0x00, 0x00 },	// U+220C (∌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0e, 0x08, 0x07, 0x00, 0x00 },	// U+220D (∍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00 },	// U+220E (∎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+220F (∏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+2210 (∐)
-	{ 0x00, 0x00, 0x0f, 0x09, 0x01, 0x02, 0x04, 0x02, 0x01, 0x09, 0x0f, 0x00 },	// U+2211 (∑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00 },	// U+2212 (−)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2213 (∓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x1f, 0x04, 0x04, 0x00, 0x00 },	// U+2214 (∔)
-}; // 21
-
-static const unsigned char scientifica_block31[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x1f, 0x04, 0x0a, 0x00, 0x00 },	// U+2217 (∗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+2218 (∘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+2219 (∙)
-	{ 0x00, 0x00, 0x10, 0x10, 0x08, 0x08, 0x04, 0x05, 0x02, 0x02, 0x00, 0x00 },	// U+221A (√)
-}; // 4
-
-static const unsigned char scientifica_block32[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x05, 0x0a, 0x00, 0x00 },	// U+221D (∝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x15, 0x15, 0x0a, 0x00, 0x00 },	// U+221E (∞)
-}; // 2
-
-static const unsigned char scientifica_block33[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11, 0x00, 0x00 },	// U+2227 (∧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x00, 0x00 },	// U+2228 (∨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00 },	// U+2229 (∩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+222A (∪)
-	{ 0x00, 0x00, 0x08, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02 },	// U+222B (∫)
-}; // 5
-
-static const unsigned char scientifica_block34[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00 },	// U+2234 (∴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+2235 (∵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 },	// U+2236 (∶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00 },	// U+2237 (∷)
-}; // 4
-
-static const unsigned char scientifica_block35[][12] = {
-	{ 0x00, 0x00, 0x00, 0x02, 0x15, 0x08, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2243 (≃)
-}; // 1
-
-static const unsigned char scientifica_block36[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x08, 0x02, 0x15, 0x08, 0x00, 0x00 },	// U+2248 (≈)
-}; // 1
-
-static const unsigned char scientifica_block37[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x1d, 0x00, 0x00, 0x00 },	// U+2254 (≔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x17, 0x00, 0x00, 0x00 },	// U+2255 (≕)
-}; // 2
-
-static const unsigned char scientifica_block38[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x1f, 0x04, 0x1f, 0x02, 0x02, 0x00 },	// U+2260 (≠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00 },	// U+2261 (≡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x08, 0x1f, 0x02, 0x1f, 0x01, 0x00 },	// U+2262 (≢)
-}; // 3
-
-static const unsigned char scientifica_block39[][12] = {
-	{ 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x1f, 0x00, 0x00 },	// U+2264 (≤)
-	{ 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x04, 0x02, 0x00, 0x1f, 0x00, 0x00 },	// U+2265 (≥)
-}; // 2
-
-static const unsigned char scientifica_block40[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x01, 0x0e, 0x00, 0x00, 0x00 },	// U+2282 (⊂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00 },	// U+2283 (⊃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x05, 0x05, 0x0e, 0x02, 0x00, 0x00 },	// U+2284 (⊄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0a, 0x0a, 0x07, 0x04, 0x00, 0x00 },	// U+2285 (⊅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x01, 0x0e, 0x00, 0x0f, 0x00, 0x00 },	// U+2286 (⊆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x08, 0x07, 0x00, 0x0f, 0x00, 0x00 },	// U+2287 (⊇)
-}; // 6
-
-static const unsigned char scientifica_block41[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x1f, 0x15, 0x0e, 0x00, 0x00 },	// U+2295 (⊕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+2296 (⊖)
-}; // 2
-
-static const unsigned char scientifica_block42[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00 },	// U+2299 (⊙)
-}; // 1
-
-static const unsigned char scientifica_block43[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x00, 0x00 },	// U+229E (⊞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1f, 0x11, 0x1f, 0x00, 0x00 },	// U+229F (⊟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x00, 0x00 },	// U+22A0 (⊠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x15, 0x11, 0x1f, 0x00, 0x00 },	// U+22A1 (⊡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x01, 0x01, 0x00, 0x00 },	// U+22A2 (⊢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x10, 0x10, 0x00, 0x00 },	// U+22A3 (⊣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+22A4 (⊤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+22A5 (⊥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x00, 0x00 },	// U+22A6 (⊦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x01, 0x07, 0x01, 0x00, 0x00 },	// U+22A7 (⊧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x01, 0x1f, 0x01, 0x00, 0x00 },	// U+22A8 (⊨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x1d, 0x05, 0x05, 0x00, 0x00 },	// U+22A9 (⊩)
-}; // 12
-
-static const unsigned char scientifica_block44[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1d, 0x05, 0x1d, 0x05, 0x00, 0x00 },	// U+22AB (⊫)
-}; // 1
-
-static const unsigned char scientifica_block45[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x02, 0x00, 0x00, 0x00 },	// U+22C4 (⋄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00 },	// U+22C5 (⋅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00, 0x00 },	// U+22C6 (⋆)
-}; // 3
-
-static const unsigned char scientifica_block46[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1b, 0x02, 0x04, 0x04, 0x08, 0x18, 0x00, 0x00 },	// U+2325 (⌥)
-}; // 1
-
-static const unsigned char scientifica_block47[][12] = {
-	{ 0x00, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+239B (⎛)
-	{ 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+239C (⎜)
-	{ 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10 },	// U+239D (⎝)
-	{ 0x00, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239E (⎞)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+239F (⎟)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01 },	// U+23A0 (⎠)
-	{ 0x00, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+23A1 (⎡)
-	{ 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02 },	// U+23A2 (⎢)
-	{ 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e },	// U+23A3 (⎣)
-	{ 0x00, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+23A4 (⎤)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08 },	// U+23A5 (⎥)
-	{ 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e },	// U+23A6 (⎦)
-	{ 0x00, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23A7 (⎧)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23A8 (⎨)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18 },	// U+23A9 (⎩)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AA (⎪)
-	{ 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AB (⎫)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AC (⎬)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03 },	// U+23AD (⎭)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+23AE (⎮)
-}; // 20
-
-static const unsigned char scientifica_block48[][12] = {
-	{ 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BA (⎺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+23BB (⎻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+23BC (⎼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00 },	// U+23BD (⎽)
-}; // 4
-
-static const unsigned char scientifica_block49[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x1f, 0x0f, 0x05, 0x00, 0x00 },	// U+23E9 (⏩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1e, 0x1f, 0x1e, 0x14, 0x00, 0x00 },	// U+23EA (⏪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x1f, 0x00, 0x00 },	// U+23EB (⏫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+23EC (⏬)
-}; // 4
-
-static const unsigned char scientifica_block50[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00 },	// U+23F4 (⏴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00, 0x00 },	// U+23F5 (⏵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+23F6 (⏶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+23F7 (⏷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00 },	// U+23F8 (⏸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00 },	// U+23F9 (⏹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00, 0x00 },	// U+23FA (⏺)
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x15, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+23FB (⏻)
-}; // 8
-
-static const unsigned char scientifica_block51[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2500 (─)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2501 (━)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2502 (│)
-	{ 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06 },	// U+2503 (┃)
-}; // 4
-
-static const unsigned char scientifica_block52[][12] = {
-	{ 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04 },	// U+2506 (┆)
-	{ 0x00, 0x06, 0x06, 0x06, 0x00, 0x06, 0x06, 0x06, 0x00, 0x06, 0x06, 0x06 },	// U+2507 (┇)
-}; // 2
-
-static const unsigned char scientifica_block53[][12] = {
-	{ 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04 },	// U+250A (┊)
-	{ 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x06 },	// U+250B (┋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+250C (┌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+250D (┍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+250E (┎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+250F (┏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2510 (┐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2511 (┑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2512 (┒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2513 (┓)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2514 (└)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2515 (┕)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2516 (┖)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2517 (┗)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2518 (┘)
-	{ 0x00, 0x04, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2519 (┙)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251A (┚)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+251B (┛)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251C (├)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+251D (┝)
-}; // 20
-
-static const unsigned char scientifica_block54[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2520 (┠)
-}; // 1
-
-static const unsigned char scientifica_block55[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1e, 0x1e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2523 (┣)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2524 (┤)
-	{ 0x00, 0x04, 0x04, 0x04, 0x07, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2525 (┥)
-}; // 3
-
-static const unsigned char scientifica_block56[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2528 (┨)
-}; // 1
-
-static const unsigned char scientifica_block57[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+252B (┫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252C (┬)
-}; // 2
-
-static const unsigned char scientifica_block58[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+252F (┯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2530 (┰)
-}; // 2
-
-static const unsigned char scientifica_block59[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2533 (┳)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2534 (┴)
-}; // 2
-
-static const unsigned char scientifica_block60[][12] = {
-	{ 0x00, 0x04, 0x04, 0x04, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2537 (┷)
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2538 (┸)
-}; // 2
-
-static const unsigned char scientifica_block61[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+253B (┻)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253C (┼)
-}; // 2
-
-static const unsigned char scientifica_block62[][12] = {
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+253F (┿)
-}; // 1
-
-static const unsigned char scientifica_block63[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+2542 (╂)
-}; // 1
-
-static const unsigned char scientifica_block64[][12] = {
-	{ 0x00, 0x0e, 0x0e, 0x0e, 0x1f, 0x1f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e },	// U+254B (╋)
-}; // 1
-
-static const unsigned char scientifica_block65[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2550 (═)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2551 (║)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2552 (╒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2553 (╓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x1a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2554 (╔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2555 (╕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2556 (╖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2557 (╗)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x04, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2558 (╘)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2559 (╙)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x1a, 0x02, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+255A (╚)
-	{ 0x00, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+255B (╛)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+255C (╜)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0b, 0x08, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+255D (╝)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1c, 0x04, 0x1c, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+255E (╞)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x1a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+255F (╟)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x1a, 0x02, 0x1a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2560 (╠)
-	{ 0x00, 0x04, 0x04, 0x04, 0x07, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2561 (╡)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2562 (╢)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0b, 0x08, 0x0b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2563 (╣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+2564 (╤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2565 (╥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+2566 (╦)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2567 (╧)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2568 (╨)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2569 (╩)
-	{ 0x00, 0x04, 0x04, 0x04, 0x1f, 0x04, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+256A (╪)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+256B (╫)
-	{ 0x00, 0x0a, 0x0a, 0x0a, 0x1b, 0x00, 0x1b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a },	// U+256C (╬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+256D (╭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },	// U+256E (╮)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+256F (╯)
-	{ 0x00, 0x04, 0x04, 0x04, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+2570 (╰)
-	{ 0x00, 0x10, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01 },	// U+2571 (╱)
-	{ 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10 },	// U+2572 (╲)
-	{ 0x00, 0x11, 0x11, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x11, 0x11 },	// U+2573 (╳)
-}; // 36
-
-static const unsigned char scientifica_block66[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1f, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257C (╼)
-}; // 1
-
-static const unsigned char scientifica_block67[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+257E (╾)
-}; // 1
-
-static const unsigned char scientifica_block68[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x00, 0x00 },	// U+2581 (▁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2582 (▂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2583 (▃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2584 (▄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2585 (▅)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2586 (▆)
-	{ 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00 },	// U+2587 (▇)
-	{ 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f },	// U+2588 (█)
-	{ 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+2589 (▉)
-	{ 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+258A (▊)
-}; // 10
-
-static const unsigned char scientifica_block69[][12] = {
-	{ 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00 },	// U+258F (▏)
-}; // 1
-
-static const unsigned char scientifica_block70[][12] = {
-	{ 0x00, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04, 0x11, 0x04 },	// U+2591 (░)
-	{ 0x00, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x0a },	// U+2592 (▒)
-	{ 0x00, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x15, 0x1f, 0x15, 0x1f },	// U+2593 (▓)
-}; // 3
-
-static const unsigned char scientifica_block71[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x0f, 0x00, 0x00, 0x00 },	// U+25A1 (□)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+25A2 (▢)
-}; // 2
-
-static const unsigned char scientifica_block72[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00 },	// U+25AA (▪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x09, 0x09, 0x0f, 0x00, 0x00, 0x00 },	// U+25AB (▫)
-}; // 2
-
-static const unsigned char scientifica_block73[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0e, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+25B2 (▲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x0a, 0x0a, 0x1f, 0x00, 0x00, 0x00 },	// U+25B3 (△)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+25B4 (▴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x1f, 0x00, 0x00, 0x00 },	// U+25B5 (▵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x07, 0x01, 0x00, 0x00 },	// U+25B6 (▶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x19, 0x07, 0x01, 0x00, 0x00 },	// U+25B7 (▷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+25B8 (▸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x03, 0x01, 0x00, 0x00 },	// U+25B9 (▹)
-}; // 8
-
-static const unsigned char scientifica_block74[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+25BC (▼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0a, 0x04, 0x00, 0x00, 0x00 },	// U+25BD (▽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00 },	// U+25BE (▾)
-}; // 3
-
-static const unsigned char scientifica_block75[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x1f, 0x1c, 0x10, 0x00, 0x00 },	// U+25C0 (◀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1c, 0x13, 0x1c, 0x10, 0x00, 0x00 },	// U+25C1 (◁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00 },	// U+25C2 (◂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x00, 0x00 },	// U+25C3 (◃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+25C4 (◄)
-}; // 5
-
-static const unsigned char scientifica_block76[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+25CB (○)
-}; // 1
-
-static const unsigned char scientifica_block77[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x15, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+25CE (◎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+25CF (●)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x17, 0x17, 0x17, 0x0e, 0x00, 0x00, 0x00 },	// U+25D0 (◐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x1d, 0x1d, 0x0e, 0x00, 0x00, 0x00 },	// U+25D1 (◑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+25D2 (◒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+25D3 (◓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x1d, 0x11, 0x0e, 0x00, 0x00, 0x00 },	// U+25D4 (◔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x0e, 0x19, 0x19, 0x1f, 0x0e, 0x00, 0x00, 0x00 },	// U+25D5 (◕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00 },	// U+25D6 (◖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x18, 0x18, 0x08, 0x00, 0x00, 0x00 },	// U+25D7 (◗)
-}; // 10
-
-static const unsigned char scientifica_block78[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x17, 0x17, 0x17, 0x1f, 0x00, 0x00 },	// U+25E7 (◧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1d, 0x1d, 0x1d, 0x1f, 0x00, 0x00 },	// U+25E8 (◨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x17, 0x13, 0x1f, 0x00, 0x00 },	// U+25E9 (◩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x19, 0x1d, 0x1f, 0x1f, 0x00, 0x00 },	// U+25EA (◪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x15, 0x15, 0x1f, 0x00, 0x00 },	// U+25EB (◫)
-}; // 5
-
-static const unsigned char scientifica_block79[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x17, 0x11, 0x1f, 0x00, 0x00 },	// U+25F0 (◰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x17, 0x15, 0x1f, 0x00, 0x00 },	// U+25F1 (◱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x11, 0x1d, 0x15, 0x1f, 0x00, 0x00 },	// U+25F2 (◲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x1d, 0x11, 0x1f, 0x00, 0x00 },	// U+25F3 (◳)
-}; // 4
-
-static const unsigned char scientifica_block80[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x15, 0x0e, 0x1f, 0x0e, 0x15, 0x04, 0x00 },	// U+2600 (☀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x1f, 0x1f, 0x00, 0x00, 0x00 },	// U+2601 (☁)
-	{ 0x00, 0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x04, 0x04, 0x05, 0x05, 0x02, 0x00 },	// U+2602 (☂)
-}; // 3
-
-static const unsigned char scientifica_block81[][12] = {
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00 },	// U+2630 (☰)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00 },	// U+2631 (☱)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x00 },	// U+2632 (☲)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x00 },	// U+2633 (☳)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00 },	// U+2634 (☴)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00 },	// U+2635 (☵)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x00, 0x00 },	// U+2636 (☶)
-	{ 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x1b, 0x00, 0x00 },	// U+2637 (☷)
-}; // 8
-
-static const unsigned char scientifica_block82[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x15, 0x11, 0x0a, 0x04, 0x00, 0x00 },	// U+2661 (♡)
-}; // 1
-
-static const unsigned char scientifica_block83[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2665 (♥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+2666 (♦)
-}; // 2
-
-static const unsigned char scientifica_block84[][12] = {
-	{ 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00 },	// U+2669 (♩)
-	{ 0x00, 0x00, 0x02, 0x06, 0x0a, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00 },	// U+266A (♪)
-	{ 0x00, 0x00, 0x06, 0x1a, 0x12, 0x12, 0x12, 0x13, 0x1b, 0x18, 0x00, 0x00 },	// U+266B (♫)
-	{ 0x00, 0x00, 0x12, 0x1e, 0x12, 0x1e, 0x12, 0x12, 0x1b, 0x1b, 0x00, 0x00 },	// U+266C (♬)
-}; // 4
-
-static const unsigned char scientifica_block85[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x11, 0x1b, 0x00, 0x00 },	// U+267A (♺)
-}; // 1
-
-static const unsigned char scientifica_block86[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00 },	// U+26AA (⚪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00, 0x00 },	// U+26AB (⚫)
-}; // 2
-
-static const unsigned char scientifica_block87[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x09, 0x06, 0x04, 0x00, 0x00 },	// U+2713 (✓)
-	{ 0x00, 0x00, 0x00, 0x10, 0x10, 0x18, 0x09, 0x0f, 0x06, 0x04, 0x00, 0x00 },	// U+2714 (✔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x00, 0x00 },	// U+2715 (✕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1f, 0x0e, 0x1f, 0x1b, 0x00, 0x00 },	// U+2716 (✖)
-	{ 0x00, 0x00, 0x08, 0x08, 0x05, 0x06, 0x06, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+2717 (✗)
-	{ 0x00, 0x00, 0x08, 0x08, 0x05, 0x05, 0x06, 0x06, 0x09, 0x09, 0x00, 0x00 },	// U+2718 (✘)
-}; // 6
-
-static const unsigned char scientifica_block88[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x1f, 0x0e, 0x0e, 0x11, 0x00, 0x00 },	// U+272E (✮)
-}; // 1
-
-static const unsigned char scientifica_block89[][12] = {
-	{ 0x00, 0x00, 0x00, 0x04, 0x1b, 0x15, 0x0e, 0x15, 0x1b, 0x04, 0x00, 0x00 },	// U+2744 (❄)
-}; // 1
-
-static const unsigned char scientifica_block90[][12] = {
-	{ 0x00, 0x00, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x06, 0x0c, 0x18, 0x00, 0x00 },	// U+276E (❮)
-	{ 0x00, 0x00, 0x00, 0x03, 0x06, 0x0c, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00 },	// U+276F (❯)
-	{ 0x00, 0x00, 0x00, 0x1c, 0x0e, 0x07, 0x03, 0x07, 0x0e, 0x1c, 0x00, 0x00 },	// U+2770 (❰)
-	{ 0x00, 0x00, 0x00, 0x07, 0x0e, 0x1c, 0x18, 0x1c, 0x0e, 0x07, 0x00, 0x00 },	// U+2771 (❱)
-}; // 4
-
-static const unsigned char scientifica_block91[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00 },	// U+27C2 (⟂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x05, 0x01, 0x0e, 0x00, 0x00 },	// U+27C3 (⟃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0a, 0x08, 0x07, 0x00, 0x00 },	// U+27C4 (⟄)
-}; // 3
-
-static const unsigned char scientifica_block92[][12] = {
-	{ 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1f, 0x00, 0x00 },	// U+27D8 (⟘)
-	{ 0x00, 0x00, 0x00, 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 },	// U+27D9 (⟙)
-}; // 2
-
-static const unsigned char scientifica_block93[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x02, 0x00, 0x00, 0x00 },	// U+27DC (⟜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x01, 0x00, 0x00, 0x00 },	// U+27DD (⟝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x10, 0x00, 0x00, 0x00 },	// U+27DE (⟞)
-}; // 3
-
-static const unsigned char scientifica_block94[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01 },	// U+2864 (⡤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01 },	// U+2865 (⡥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01 },	// U+2866 (⡦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01 },	// U+2867 (⡧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01 },	// U+2868 (⡨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01 },	// U+2869 (⡩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01 },	// U+286A (⡪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01 },	// U+286B (⡫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01 },	// U+286C (⡬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x01 },	// U+286D (⡭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01 },	// U+286E (⡮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01 },	// U+286F (⡯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01 },	// U+2870 (⡰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01 },	// U+2871 (⡱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01 },	// U+2872 (⡲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01 },	// U+2873 (⡳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01 },	// U+2874 (⡴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01 },	// U+2875 (⡵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+2876 (⡶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+2877 (⡷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01 },	// U+2878 (⡸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01 },	// U+2879 (⡹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01 },	// U+287A (⡺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01 },	// U+287B (⡻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01 },	// U+287C (⡼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01 },	// U+287D (⡽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+287E (⡾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01 },	// U+287F (⡿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+2880 (⢀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+2881 (⢁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04 },	// U+2882 (⢂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04 },	// U+2883 (⢃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04 },	// U+2884 (⢄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04 },	// U+2885 (⢅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04 },	// U+2886 (⢆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04 },	// U+2887 (⢇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },	// U+2888 (⢈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },	// U+2889 (⢉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04 },	// U+288A (⢊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04 },	// U+288B (⢋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04 },	// U+288C (⢌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x04 },	// U+288D (⢍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04 },	// U+288E (⢎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04 },	// U+288F (⢏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01 },	// U+2890 (⢐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04 },	// U+2891 (⢑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04 },	// U+2892 (⢒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04 },	// U+2893 (⢓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04 },	// U+2894 (⢔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04 },	// U+2895 (⢕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04 },	// U+2896 (⢖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04 },	// U+2897 (⢗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01 },	// U+2898 (⢘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04 },	// U+2899 (⢙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04 },	// U+289A (⢚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04 },	// U+289B (⢛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04 },	// U+289C (⢜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04 },	// U+289D (⢝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04 },	// U+289E (⢞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04 },	// U+289F (⢟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01 },	// U+28A0 (⢠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04 },	// U+28A1 (⢡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04 },	// U+28A2 (⢢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04 },	// U+28A3 (⢣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04 },	// U+28A4 (⢤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04 },	// U+28A5 (⢥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04 },	// U+28A6 (⢦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04 },	// U+28A7 (⢧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01 },	// U+28A8 (⢨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04 },	// U+28A9 (⢩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04 },	// U+28AA (⢪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04 },	// U+28AB (⢫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04 },	// U+28AC (⢬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04 },	// U+28AD (⢭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04 },	// U+28AE (⢮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04 },	// U+28AF (⢯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04 },	// U+28B0 (⢰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04 },	// U+28B1 (⢱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04 },	// U+28B2 (⢲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04 },	// U+28B3 (⢳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04 },	// U+28B4 (⢴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04 },	// U+28B5 (⢵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04 },	// U+28B6 (⢶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04 },	// U+28B7 (⢷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01 },	// U+28B8 (⢸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04 },	// U+28B9 (⢹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04 },	// U+28BA (⢺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04 },	// U+28BB (⢻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04 },	// U+28BC (⢼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04 },	// U+28BD (⢽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04 },	// U+28BE (⢾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04 },	// U+28BF (⢿)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05 },	// U+28C0 (⣀)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05 },	// U+28C1 (⣁)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05 },	// U+28C2 (⣂)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05 },	// U+28C3 (⣃)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05 },	// U+28C4 (⣄)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05 },	// U+28C5 (⣅)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05 },	// U+28C6 (⣆)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05 },	// U+28C7 (⣇)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05 },	// U+28C8 (⣈)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05 },	// U+28C9 (⣉)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05 },	// U+28CA (⣊)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05 },	// U+28CB (⣋)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05 },	// U+28CC (⣌)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05 },	// U+28CD (⣍)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05 },	// U+28CE (⣎)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05 },	// U+28CF (⣏)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05 },	// U+28D0 (⣐)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05 },	// U+28D1 (⣑)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05 },	// U+28D2 (⣒)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05 },	// U+28D3 (⣓)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05 },	// U+28D4 (⣔)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05 },	// U+28D5 (⣕)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05 },	// U+28D6 (⣖)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05 },	// U+28D7 (⣗)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05 },	// U+28D8 (⣘)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05 },	// U+28D9 (⣙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05 },	// U+28DA (⣚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05 },	// U+28DB (⣛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05 },	// U+28DC (⣜)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05 },	// U+28DD (⣝)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05 },	// U+28DE (⣞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05 },	// U+28DF (⣟)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05 },	// U+28E0 (⣠)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05 },	// U+28E1 (⣡)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05 },	// U+28E2 (⣢)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05 },	// U+28E3 (⣣)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05 },	// U+28E4 (⣤)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x00, 0x05 },	// U+28E5 (⣥)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05 },	// U+28E6 (⣦)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05 },	// U+28E7 (⣧)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05 },	// U+28E8 (⣨)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05 },	// U+28E9 (⣩)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05 },	// U+28EA (⣪)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05 },	// U+28EB (⣫)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05 },	// U+28EC (⣬)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x05, 0x00, 0x05 },	// U+28ED (⣭)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05 },	// U+28EE (⣮)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05 },	// U+28EF (⣯)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05 },	// U+28F0 (⣰)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05 },	// U+28F1 (⣱)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05 },	// U+28F2 (⣲)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05 },	// U+28F3 (⣳)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05 },	// U+28F4 (⣴)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05 },	// U+28F5 (⣵)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28F6 (⣶)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28F7 (⣷)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05 },	// U+28F8 (⣸)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05 },	// U+28F9 (⣹)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05 },	// U+28FA (⣺)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05 },	// U+28FB (⣻)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05 },	// U+28FC (⣼)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05 },	// U+28FD (⣽)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28FE (⣾)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05 },	// U+28FF (⣿)
-}; // 156
-
-static const unsigned char scientifica_block95[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x07, 0x08, 0x10, 0x00, 0x00 },	// U+2919 (⤙)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x1c, 0x02, 0x01, 0x00, 0x00 },	// U+291A (⤚)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x09, 0x04, 0x09, 0x12, 0x00, 0x00 },	// U+291B (⤛)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x04, 0x12, 0x09, 0x00, 0x00 },	// U+291C (⤜)
-}; // 4
-
-static const unsigned char scientifica_block96[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2B5E (⭞)
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+2B5F (⭟)
-	{ 0x00, 0x01, 0x01, 0x05, 0x0f, 0x05, 0x05, 0x07, 0x01, 0x01, 0x00, 0x00 },	// U+2B60 (⭠)
-	{ 0x00, 0x01, 0x01, 0x01, 0x07, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+2B61 (⭡)
-	{ 0x00, 0x00, 0x06, 0x02, 0x03, 0x0a, 0x1a, 0x0b, 0x08, 0x18, 0x00, 0x00 },	// U+2B62 (⭢)
-}; // 5
-
-static const unsigned char scientifica_block97[][12] = {
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0f, 0x0b, 0x0f, 0x00, 0x00 },	// U+2B64 (⭤)
-}; // 1
-
-static const unsigned char scientifica_block98[][12] = {
-	{ 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+2B80 (⮀)
-	{ 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00 },	// U+2B81 (⮁)
-	{ 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00, 0x00 },	// U+2B82 (⮂)
-	{ 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00 },	// U+2B83 (⮃)
-}; // 4
-
-static const unsigned char scientifica_block99[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x06, 0x00, 0x00 },	// U+30C3 (ッ)
-	{ 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x09, 0x09, 0x06, 0x00, 0x00 },	// U+30C4 (ツ)
-}; // 2
-
-static const unsigned char scientifica_block100[][12] = {
-	{ 0x00, 0x00, 0x00, 0x1d, 0x05, 0x05, 0x1f, 0x14, 0x14, 0x17, 0x00, 0x00 },	// U+5350 (卐)
-}; // 1
-
-static const unsigned char scientifica_block101[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, 0x00 },	// U+E09E ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00 },	// U+E09F ()
-	{ 0x00, 0x00, 0x01, 0x05, 0x0d, 0x05, 0x05, 0x03, 0x01, 0x01, 0x00, 0x00 },	// U+E0A0 ()
-	{ 0x00, 0x01, 0x01, 0x01, 0x07, 0x00, 0x06, 0x0a, 0x0a, 0x0a, 0x00, 0x00 },	// U+E0A1 ()
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+E0A2 ()
-}; // 5
-
-static const unsigned char scientifica_block102[][12] = {
-	{ 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00 },	// U+E0B0 ()
-	{ 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 },	// U+E0B1 ()
-	{ 0x00, 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00 },	// U+E0B2 ()
-	{ 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 },	// U+E0B3 ()
-	{ 0x00, 0x1f, 0x1e, 0x1c, 0x18, 0x10, 0x00, 0x10, 0x18, 0x1c, 0x1e, 0x1f },	// U+E0B4 ()
-	{ 0x00, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f },	// U+E0B5 ()
-}; // 6
-
-static const unsigned char scientifica_block103[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x0a, 0x15, 0x12, 0x00, 0x00 },	// U+E0C0 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x08, 0x04, 0x00, 0x00 },	// U+E0C1 ()
-	{ 0x00, 0x00, 0x00, 0x0a, 0x0a, 0x1f, 0x0e, 0x0e, 0x04, 0x04, 0x04, 0x00 },	// U+E0C2 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x00, 0x1e, 0x01, 0x00, 0x00 },	// U+E0C3 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1a, 0x04, 0x1a, 0x05, 0x00, 0x00 },	// U+E0C4 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x0f, 0x10, 0x00, 0x00 },	// U+E0C5 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0b, 0x04, 0x0b, 0x14, 0x00, 0x00 },	// U+E0C6 ()
-}; // 7
-
-static const unsigned char scientifica_block104[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00 },	// U+E0D1 ()
-}; // 1
-
-static const unsigned char scientifica_block105[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x09, 0x09, 0x0f, 0x00, 0x00 },	// U+F031 ()
-}; // 1
-
-static const unsigned char scientifica_block106[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x06, 0x04, 0x00, 0x00 },	// U+F033 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00 },	// U+F034 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x1f, 0x00, 0x00, 0x00 },	// U+F035 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0e, 0x04, 0x00, 0x00, 0x00 },	// U+F036 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0f, 0x0a, 0x00, 0x00, 0x00 },	// U+F037 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x05, 0x00, 0x00, 0x00 },	// U+F038 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x1f, 0x15, 0x01, 0x00, 0x00 },	// U+F039 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x15, 0x1f, 0x15, 0x10, 0x00, 0x00 },	// U+F03A ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00 },	// U+F03B ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00 },	// U+F03C ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x06, 0x00, 0x00 },	// U+F03D ()
-}; // 11
-
-static const unsigned char scientifica_block107[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x01, 0x00 },	// U+F057 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x0c, 0x0f, 0x0f, 0x0f, 0x0c, 0x08, 0x00 },	// U+F058 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x1f, 0x0e, 0x04, 0x00, 0x00 },	// U+F059 ()
-}; // 3
-
-static const unsigned char scientifica_block108[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x0e, 0x04, 0x00, 0x00 },	// U+F061 ()
-}; // 1
-
-static const unsigned char scientifica_block109[][12] = {
-	{ 0x00, 0x00, 0x00, 0x06, 0x0f, 0x19, 0x19, 0x0c, 0x06, 0x06, 0x00, 0x06 },	// U+F073 ()
-}; // 1
-
-static const unsigned char scientifica_block110[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x13, 0x15, 0x19, 0x0e, 0x00, 0x00 },	// U+F078 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x11, 0x1f, 0x11, 0x0e, 0x00, 0x00 },	// U+F079 ()
-}; // 2
-
-static const unsigned char scientifica_block111[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x0e, 0x07, 0x02, 0x01, 0x00, 0x00 },	// U+F07E ()
-}; // 1
-
-static const unsigned char scientifica_block112[][12] = {
-	{ 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+F0CF ()
-	{ 0x00, 0x00, 0x06, 0x09, 0x08, 0x08, 0x0f, 0x0b, 0x0b, 0x0f, 0x00, 0x00 },	// U+F0D0 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x02, 0x02, 0x02, 0x05, 0x02, 0x00 },	// U+F0D1 ()
-}; // 3
-
-static const unsigned char scientifica_block113[][12] = {
-	{ 0x00, 0x00, 0x00, 0x04, 0x12, 0x0f, 0x19, 0x09, 0x0f, 0x15, 0x00, 0x00 },	// U+F0D5 ()
-	{ 0x00, 0x00, 0x08, 0x05, 0x12, 0x0f, 0x19, 0x1d, 0x1f, 0x1f, 0x00, 0x00 },	// U+F0D6 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x1d, 0x1e, 0x00, 0x00, 0x00, 0x00 },	// U+F0D7 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x19, 0x1d, 0x1e, 0x00, 0x14, 0x0a, 0x00 },	// U+F0D8 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F0D9 ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x00, 0x15, 0x00, 0x0a, 0x00 },	// U+F0DA ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x00, 0x15, 0x0a, 0x00, 0x00 },	// U+F0DB ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x08, 0x1e, 0x1f, 0x08, 0x0c, 0x04, 0x02, 0x00 },	// U+F0DC ()
-}; // 8
-
-static const unsigned char scientifica_block114[][12] = {
-	{ 0x00, 0x00, 0x0a, 0x05, 0x00, 0x08, 0x14, 0x00, 0x0a, 0x05, 0x00, 0x00 },	// U+F0DE ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0a, 0x15, 0x0a, 0x15, 0x00, 0x00 },	// U+F0DF ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x19, 0x19, 0x0e, 0x00, 0x00 },	// U+F0E0 ()
-}; // 3
-
-static const unsigned char scientifica_block115[][12] = {
-	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x11, 0x0a, 0x00, 0x00 },	// U+F0ED ()
-	{ 0x00, 0x00, 0x0a, 0x11, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },	// U+F0EE ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x06, 0x00, 0x08, 0x04, 0x00 },	// U+F0EF ()
-	{ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x06, 0x00, 0x01, 0x02, 0x00 },	// U+F0F0 ()
-}; // 4
+static const uint8_t scientifica_bitmaps[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+0020 ( )
+	0x00, 0x00, 0x42, 0x08, 0x21, 0x80, 0x00, 0x00,	// scientifica U+0021 (!)
+	0x00, 0x00, 0xa5, 0x14, 0x00, 0x00, 0x00, 0x00,	// scientifica U+0022 (")
+	0x00, 0x00, 0x00, 0xd4, 0x57, 0x5f, 0x01, 0x00,	// scientifica U+0023 (#)
+	0x00, 0x10, 0xe2, 0x84, 0x43, 0x8e, 0x10, 0x00,	// scientifica U+0024 ($)
+	0x00, 0x00, 0x00, 0x12, 0x11, 0x09, 0x00, 0x00,	// scientifica U+0025 (%)
+	0x00, 0x00, 0x13, 0x92, 0x4f, 0xc9, 0x02, 0x00,	// scientifica U+0026 (&)
+	0x00, 0x00, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00,	// scientifica U+0027 (')
+	0x00, 0x30, 0x11, 0x42, 0x08, 0x41, 0x30, 0x00,	// scientifica U+0028 (()
+	0x00, 0x0c, 0x82, 0x10, 0x42, 0x88, 0x0c, 0x00,	// scientifica U+0029 ())
+	0x00, 0x00, 0x00, 0x14, 0xf9, 0x44, 0x01, 0x00,	// scientifica U+002A (*)
+	0x00, 0x00, 0x00, 0x08, 0xf9, 0x84, 0x00, 0x00,	// scientifica U+002B (+)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x08, 0x00,	// scientifica U+002C (,)
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,	// scientifica U+002D (-)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,	// scientifica U+002E (.)
+	0x00, 0x00, 0x84, 0x08, 0x11, 0x22, 0x04, 0x00,	// scientifica U+002F (/)
+	0x00, 0x00, 0x93, 0xda, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+0030 (0)
+	0x00, 0x00, 0x62, 0x08, 0x21, 0xc4, 0x01, 0x00,	// scientifica U+0031 (1)
+	0x00, 0x00, 0x93, 0x10, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+0032 (2)
+	0x00, 0x80, 0x87, 0x88, 0x42, 0xc9, 0x00, 0x00,	// scientifica U+0033 (3)
+	0x00, 0x80, 0x10, 0x4a, 0x79, 0x84, 0x00, 0x00,	// scientifica U+0034 (4)
+	0x00, 0x80, 0x17, 0x0e, 0x42, 0xc9, 0x00, 0x00,	// scientifica U+0035 (5)
+	0x00, 0x00, 0x93, 0xc2, 0x49, 0xc9, 0x00, 0x00,	// scientifica U+0036 (6)
+	0x00, 0x80, 0x87, 0x10, 0x21, 0x42, 0x00, 0x00,	// scientifica U+0037 (7)
+	0x00, 0x00, 0x93, 0x92, 0x49, 0xc9, 0x00, 0x00,	// scientifica U+0038 (8)
+	0x00, 0x00, 0x93, 0x92, 0x43, 0xc9, 0x00, 0x00,	// scientifica U+0039 (9)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00,	// scientifica U+003A (:)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x84, 0x08, 0x00,	// scientifica U+003B (;)
+	0x00, 0x00, 0x00, 0x88, 0x08, 0x82, 0x00, 0x00,	// scientifica U+003C (<)
+	0x00, 0x00, 0x00, 0xc0, 0x03, 0x0f, 0x00, 0x00,	// scientifica U+003D (=)
+	0x00, 0x00, 0x00, 0x04, 0x41, 0x44, 0x00, 0x00,	// scientifica U+003E (>)
+	0x00, 0x00, 0x93, 0x10, 0x11, 0x40, 0x00, 0x00,	// scientifica U+003F (?)
+	0x00, 0x00, 0x93, 0x5a, 0x6b, 0xc1, 0x01, 0x00,	// scientifica U+0040 (@)
+	0x00, 0x00, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0041 (A)
+	0x00, 0x80, 0x93, 0xd2, 0x49, 0xe9, 0x00, 0x00,	// scientifica U+0042 (B)
+	0x00, 0x00, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+0043 (C)
+	0x00, 0x80, 0x93, 0x52, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+0044 (D)
+	0x00, 0x80, 0x17, 0xc2, 0x09, 0xe1, 0x01, 0x00,	// scientifica U+0045 (E)
+	0x00, 0x80, 0x17, 0xc2, 0x09, 0x21, 0x00, 0x00,	// scientifica U+0046 (F)
+	0x00, 0x00, 0x93, 0x42, 0x4b, 0xc9, 0x00, 0x00,	// scientifica U+0047 (G)
+	0x00, 0x80, 0x94, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0048 (H)
+	0x00, 0x00, 0x47, 0x08, 0x21, 0xc4, 0x01, 0x00,	// scientifica U+0049 (I)
+	0x00, 0x00, 0x87, 0x10, 0x42, 0xc9, 0x01, 0x00,	// scientifica U+004A (J)
+	0x00, 0x80, 0x54, 0x46, 0x49, 0x29, 0x01, 0x00,	// scientifica U+004B (K)
+	0x00, 0x80, 0x10, 0x42, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+004C (L)
+	0x00, 0x80, 0xf4, 0x5e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+004D (M)
+	0x00, 0x80, 0xb4, 0x56, 0x6b, 0x29, 0x01, 0x00,	// scientifica U+004E (N)
+	0x00, 0x00, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+004F (O)
+	0x00, 0x80, 0x93, 0xd2, 0x09, 0x21, 0x00, 0x00,	// scientifica U+0050 (P)
+	0x00, 0x00, 0x93, 0x52, 0x4a, 0xc9, 0x10, 0x04,	// scientifica U+0051 (Q)
+	0x00, 0x80, 0x93, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0052 (R)
+	0x00, 0x00, 0x93, 0x82, 0x41, 0xc9, 0x00, 0x00,	// scientifica U+0053 (S)
+	0x00, 0x80, 0x4f, 0x08, 0x21, 0x84, 0x00, 0x00,	// scientifica U+0054 (T)
+	0x00, 0x80, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0055 (U)
+	0x00, 0x80, 0x94, 0x52, 0x4a, 0xc6, 0x00, 0x00,	// scientifica U+0056 (V)
+	0x00, 0x80, 0x94, 0x52, 0x7a, 0x2f, 0x01, 0x00,	// scientifica U+0057 (W)
+	0x00, 0x80, 0x94, 0x92, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0058 (X)
+	0x00, 0x80, 0x94, 0x92, 0x43, 0xc9, 0x01, 0x00,	// scientifica U+0059 (Y)
+	0x00, 0x80, 0x87, 0x88, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+005A (Z)
+	0x00, 0x38, 0x21, 0x84, 0x10, 0x42, 0x38, 0x00,	// scientifica U+005B ([)
+	0x00, 0x80, 0x10, 0x84, 0x20, 0x04, 0x21, 0x00,	// scientifica U+005C (\)
+	0x00, 0x38, 0x84, 0x10, 0x42, 0x08, 0x39, 0x00,	// scientifica U+005D (])
+	0x00, 0x00, 0xa2, 0x22, 0x00, 0x00, 0x00, 0x00,	// scientifica U+005E (^)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00,	// scientifica U+005F (_)
+	0x00, 0x00, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00,	// scientifica U+0060 (`)
+	0x00, 0x00, 0x00, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+0061 (a)
+	0x00, 0x80, 0x10, 0x4e, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+0062 (b)
+	0x00, 0x00, 0x00, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+0063 (c)
+	0x00, 0x00, 0x84, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0064 (d)
+	0x00, 0x00, 0x00, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+0065 (e)
+	0x00, 0x00, 0x26, 0xc4, 0x11, 0x42, 0x00, 0x00,	// scientifica U+0066 (f)
+	0x00, 0x00, 0x00, 0x5c, 0x4a, 0xc9, 0x21, 0x03,	// scientifica U+0067 (g)
+	0x00, 0x80, 0x10, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0068 (h)
+	0x00, 0x00, 0x01, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+0069 (i)
+	0x00, 0x00, 0x02, 0x0c, 0x21, 0x84, 0x90, 0x01,	// scientifica U+006A (j)
+	0x00, 0x80, 0x10, 0x52, 0x19, 0x25, 0x01, 0x00,	// scientifica U+006B (k)
+	0x00, 0x80, 0x21, 0x84, 0x10, 0x82, 0x01, 0x00,	// scientifica U+006C (l)
+	0x00, 0x00, 0x00, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+006D (m)
+	0x00, 0x00, 0x00, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+006E (n)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+006F (o)
+	0x00, 0x00, 0x00, 0x4e, 0x4a, 0xe9, 0x84, 0x00,	// scientifica U+0070 (p)
+	0x00, 0x00, 0x00, 0x5c, 0x4a, 0xc9, 0x21, 0x04,	// scientifica U+0071 (q)
+	0x00, 0x00, 0x00, 0x4e, 0x0a, 0x21, 0x00, 0x00,	// scientifica U+0072 (r)
+	0x00, 0x00, 0x00, 0x5c, 0x30, 0xe8, 0x00, 0x00,	// scientifica U+0073 (s)
+	0x00, 0x00, 0x21, 0x9e, 0x10, 0x82, 0x01, 0x00,	// scientifica U+0074 (t)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0075 (u)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xc6, 0x00, 0x00,	// scientifica U+0076 (v)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0x2f, 0x01, 0x00,	// scientifica U+0077 (w)
+	0x00, 0x00, 0x00, 0x52, 0x32, 0x29, 0x01, 0x00,	// scientifica U+0078 (x)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xc9, 0x21, 0x03,	// scientifica U+0079 (y)
+	0x00, 0x00, 0x00, 0x1e, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+007A (z)
+	0x00, 0x20, 0x42, 0xc8, 0x20, 0x84, 0x20, 0x00,	// scientifica U+007B ({)
+	0x00, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x00,	// scientifica U+007C (|)
+	0x00, 0x08, 0x42, 0x08, 0x26, 0x84, 0x08, 0x00,	// scientifica U+007D (})
+	0x00, 0x00, 0x00, 0x80, 0xa8, 0x08, 0x00, 0x00,	// scientifica U+007E (~)
+	0x00, 0x10, 0x40, 0x08, 0x21, 0x84, 0x00, 0x00,	// scientifica U+00A1 (¡)
+	0x00, 0x00, 0x20, 0xcc, 0x1a, 0xcb, 0x08, 0x00,	// scientifica U+00A2 (¢)
+	0x00, 0x00, 0x93, 0xc2, 0x08, 0xab, 0x01, 0x00,	// scientifica U+00A3 (£)
+	0x00, 0x00, 0x00, 0xa2, 0x53, 0x2e, 0x02, 0x00,	// scientifica U+00A4 (¤)
+	0x00, 0x00, 0xa5, 0xbe, 0xfa, 0x84, 0x00, 0x00,	// scientifica U+00A5 (¥)
+	0x84, 0x10, 0x02, 0x00, 0x21, 0x84, 0x00, 0x00,	// scientifica U+00A6 (¦)
+	0x00, 0x00, 0x17, 0x4e, 0x72, 0xe8, 0x00, 0x00,	// scientifica U+00A7 (§)
+	0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+00A8 (¨)
+	0x00, 0x00, 0x17, 0x5b, 0x69, 0xd1, 0x01, 0x00,	// scientifica U+00A9 (©)
+	0xc0, 0xa5, 0x94, 0x1c, 0x78, 0x00, 0x00, 0x00,	// scientifica U+00AA (ª)
+	0x00, 0x00, 0x00, 0x80, 0x4c, 0x12, 0x00, 0x00,	// scientifica U+00AB («)
+	0x00, 0x00, 0x00, 0xc0, 0x43, 0x00, 0x00, 0x00,	// scientifica U+00AC (¬)
+	0x00, 0x00, 0x17, 0x5b, 0x29, 0xd1, 0x01, 0x00,	// scientifica U+00AE (®)
+	0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+00AF (¯)
+	0x00, 0x00, 0xa2, 0x08, 0x00, 0x00, 0x00, 0x00,	// scientifica U+00B0 (°)
+	0x00, 0x00, 0x00, 0x08, 0xf9, 0xe4, 0x03, 0x00,	// scientifica U+00B1 (±)
+	0x00, 0x00, 0x87, 0x88, 0x03, 0x00, 0x00, 0x00,	// scientifica U+00B2 (²)
+	0x00, 0x00, 0x47, 0x90, 0x01, 0x00, 0x00, 0x00,	// scientifica U+00B3 (³)
+	0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,	// scientifica U+00B4 (´)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xe9, 0xc5, 0x00,	// scientifica U+00B5 (µ)
+	0x00, 0x00, 0xe0, 0xd6, 0x5a, 0x4a, 0x29, 0x00,	// scientifica U+00B6 (¶)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,	// scientifica U+00B7 (·)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03,	// scientifica U+00B8 (¸)
+	0x00, 0x00, 0x43, 0x88, 0x03, 0x00, 0x00, 0x00,	// scientifica U+00B9 (¹)
+	0x00, 0x00, 0x20, 0x8a, 0x00, 0x07, 0x00, 0x00,	// scientifica U+00BA (º)
+	0x00, 0x00, 0x00, 0x40, 0x92, 0x09, 0x00, 0x00,	// scientifica U+00BB (»)
+	0x80, 0x10, 0x42, 0xc0, 0x03, 0x42, 0x39, 0x04,	// scientifica U+00BC (¼)
+	0x80, 0x10, 0x42, 0xc0, 0x03, 0x0e, 0x11, 0x07,	// scientifica U+00BD (½)
+	0xc0, 0x11, 0x64, 0xc0, 0x03, 0x42, 0x39, 0x04,	// scientifica U+00BE (¾)
+	0x00, 0x00, 0x02, 0x88, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+00BF (¿)
+	0x40, 0x10, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C0 (À)
+	0x80, 0x08, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C1 (Á)
+	0x80, 0x28, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C2 (Â)
+	0x40, 0x15, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C3 (Ã)
+	0x20, 0x01, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C4 (Ä)
+	0x40, 0x00, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+00C5 (Å)
+	0x00, 0x00, 0x57, 0xca, 0x2b, 0xa5, 0x01, 0x00,	// scientifica U+00C6 (Æ)
+	0x00, 0x00, 0x93, 0x42, 0x08, 0xc9, 0x10, 0x03,	// scientifica U+00C7 (Ç)
+	0x40, 0x90, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+00C8 (È)
+	0x80, 0x88, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+00C9 (É)
+	0x80, 0x28, 0xf0, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+00CA (Ê)
+	0x40, 0x81, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+00CB (Ë)
+	0x20, 0x88, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+00CC (Ì)
+	0x80, 0x88, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+00CD (Í)
+	0x40, 0x14, 0x70, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+00CE (Î)
+	0xa0, 0x80, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+00CF (Ï)
+	0x00, 0x00, 0x27, 0xe5, 0x95, 0xd2, 0x01, 0x00,	// scientifica U+00D0 (Ð)
+	0x40, 0x95, 0x94, 0xd6, 0x6a, 0x2d, 0x01, 0x00,	// scientifica U+00D1 (Ñ)
+	0x40, 0x10, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D2 (Ò)
+	0x80, 0x08, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D3 (Ó)
+	0x80, 0x28, 0x60, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D4 (Ô)
+	0x40, 0x15, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D5 (Õ)
+	0x20, 0x01, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D6 (Ö)
+	0x00, 0x00, 0x00, 0xa2, 0x22, 0x2a, 0x02, 0x00,	// scientifica U+00D7 (×)
+	0x00, 0x00, 0x9b, 0xdb, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00D8 (Ø)
+	0x40, 0x90, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00D9 (Ù)
+	0x80, 0x88, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00DA (Ú)
+	0x80, 0x28, 0x90, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00DB (Û)
+	0x20, 0x81, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00DC (Ü)
+	0x80, 0x88, 0x94, 0x92, 0x43, 0xc9, 0x00, 0x00,	// scientifica U+00DD (Ý)
+	0x00, 0x80, 0x70, 0x52, 0x4a, 0x27, 0x00, 0x00,	// scientifica U+00DE (Þ)
+	0x00, 0x00, 0x30, 0x4a, 0x59, 0xe9, 0x04, 0x00,	// scientifica U+00DF (ß)
+	0x00, 0x08, 0x02, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E0 (à)
+	0x00, 0x10, 0x01, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E1 (á)
+	0x00, 0x10, 0x05, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E2 (â)
+	0x00, 0x50, 0x05, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E3 (ã)
+	0x00, 0x80, 0x04, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E4 (ä)
+	0x00, 0x00, 0x02, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+00E5 (å)
+	0x00, 0x00, 0x00, 0x5c, 0x79, 0xa5, 0x01, 0x00,	// scientifica U+00E6 (æ)
+	0x00, 0x00, 0x00, 0x4c, 0x0a, 0xc9, 0x10, 0x03,	// scientifica U+00E7 (ç)
+	0x00, 0x08, 0x02, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+00E8 (è)
+	0x00, 0x10, 0x01, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+00E9 (é)
+	0x00, 0x10, 0x05, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+00EA (ê)
+	0x00, 0x80, 0x04, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+00EB (ë)
+	0x00, 0x04, 0x01, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+00EC (ì)
+	0x00, 0x10, 0x01, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+00ED (í)
+	0x00, 0x88, 0x02, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+00EE (î)
+	0x00, 0x80, 0x02, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+00EF (ï)
+	0x00, 0x00, 0x83, 0x5c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F0 (ð)
+	0x00, 0xa8, 0x02, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+00F1 (ñ)
+	0x00, 0x08, 0x02, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F2 (ò)
+	0x00, 0x10, 0x01, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F3 (ó)
+	0x00, 0x10, 0x05, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F4 (ô)
+	0x00, 0xa8, 0x02, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F5 (õ)
+	0x00, 0x80, 0x04, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+00F6 (ö)
+	0x00, 0x00, 0x00, 0x0c, 0x78, 0xc0, 0x00, 0x00,	// scientifica U+00F7 (÷)
+	0x00, 0x00, 0x00, 0x5d, 0x5b, 0xc9, 0x00, 0x00,	// scientifica U+00F8 (ø)
+	0x00, 0x08, 0x02, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00F9 (ù)
+	0x00, 0x10, 0x01, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00FA (ú)
+	0x00, 0x10, 0x05, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00FB (û)
+	0x00, 0x80, 0x04, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+00FC (ü)
+	0x00, 0x10, 0x01, 0x52, 0x4a, 0xc9, 0x25, 0x03,	// scientifica U+00FD (ý)
+	0x00, 0x00, 0x10, 0xc2, 0x49, 0xe9, 0x84, 0x00,	// scientifica U+00FE (þ)
+	0x00, 0x80, 0x04, 0x52, 0x4a, 0xc9, 0x25, 0x03,	// scientifica U+00FF (ÿ)
+	0xe0, 0x01, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0100 (Ā)
+	0x00, 0x00, 0x07, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+0101 (ā)
+	0x20, 0x19, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0102 (Ă)
+	0x00, 0x24, 0x03, 0x5c, 0x4a, 0x4d, 0x01, 0x00,	// scientifica U+0103 (ă)
+	0x00, 0x00, 0x93, 0xd2, 0x4b, 0x29, 0x11, 0x06,	// scientifica U+0104 (Ą)
+	0x00, 0x00, 0x00, 0x5c, 0x4a, 0x4d, 0x09, 0x03,	// scientifica U+0105 (ą)
+	0x00, 0x11, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+0106 (Ć)
+	0x00, 0x10, 0x01, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+0107 (ć)
+	0x80, 0x28, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+0108 (Ĉ)
+	0x00, 0x10, 0x05, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+0109 (ĉ)
+	0x80, 0x00, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+010A (Ċ)
+	0x00, 0x00, 0x02, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+010B (ċ)
+	0x40, 0x11, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+010C (Č)
+	0x00, 0x28, 0x02, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+010D (č)
+	0x40, 0x91, 0x93, 0x52, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+010E (Ď)
+	0x00, 0x00, 0x4a, 0x4d, 0x29, 0xc5, 0x00, 0x00,	// scientifica U+010F (ď)
+	0x00, 0x80, 0x93, 0xd2, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+0110 (Đ)
+	0x00, 0x20, 0x87, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0111 (đ)
+	0xe0, 0x81, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+0112 (Ē)
+	0x00, 0x80, 0x07, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+0113 (ē)
+	0x20, 0x99, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+0114 (Ĕ)
+	0x00, 0x24, 0x03, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+0115 (ĕ)
+	0x80, 0x80, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+0116 (Ė)
+	0x00, 0x00, 0x02, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+0117 (ė)
+	0x00, 0x80, 0x17, 0xc2, 0x08, 0xe1, 0x11, 0x06,	// scientifica U+0118 (Ę)
+	0x00, 0x00, 0x00, 0x4c, 0x7a, 0xc1, 0x11, 0x06,	// scientifica U+0119 (ę)
+	0x40, 0x91, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+011A (Ě)
+	0x00, 0x28, 0x02, 0x4c, 0x7a, 0xc1, 0x01, 0x00,	// scientifica U+011B (ě)
+	0x80, 0x28, 0x93, 0x42, 0x68, 0xc9, 0x00, 0x00,	// scientifica U+011C (Ĝ)
+	0x00, 0x10, 0x05, 0x5c, 0x4a, 0xc9, 0x21, 0x03,	// scientifica U+011D (ĝ)
+	0x20, 0x19, 0x93, 0x42, 0x68, 0xc9, 0x00, 0x00,	// scientifica U+011E (Ğ)
+	0x00, 0x24, 0x03, 0x5c, 0x4a, 0xc9, 0x21, 0x03,	// scientifica U+011F (ğ)
+	0x40, 0x00, 0x93, 0x42, 0x68, 0xc9, 0x00, 0x00,	// scientifica U+0120 (Ġ)
+	0x00, 0x00, 0x01, 0x5c, 0x4a, 0xc9, 0x21, 0x07,	// scientifica U+0121 (ġ)
+	0x00, 0x00, 0x93, 0x42, 0x68, 0xc9, 0x10, 0x03,	// scientifica U+0122 (Ģ)
+	0x00, 0x20, 0x02, 0x5c, 0x4a, 0xc9, 0x21, 0x07,	// scientifica U+0123 (ģ)
+	0x80, 0x28, 0x90, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0124 (Ĥ)
+	0x40, 0x94, 0x10, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0125 (ĥ)
+	0x00, 0x80, 0xf4, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+0126 (Ħ)
+	0x00, 0x84, 0x13, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0127 (ħ)
+	0x40, 0x15, 0x70, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+0128 (Ĩ)
+	0x00, 0xa8, 0x02, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+0129 (ĩ)
+	0xe0, 0x80, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+012A (Ī)
+	0x00, 0x80, 0x07, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+012B (ī)
+	0x20, 0x99, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+012C (Ĭ)
+	0x00, 0x24, 0x03, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+012D (ĭ)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0xe2, 0x10, 0x06,	// scientifica U+012E (Į)
+	0x00, 0x00, 0x01, 0x86, 0x10, 0x82, 0x85, 0x01,	// scientifica U+012F (į)
+	0x40, 0x80, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+0130 (İ)
+	0x00, 0x00, 0x00, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+0131 (ı)
+	0x00, 0x80, 0x96, 0x52, 0x4a, 0xab, 0x01, 0x00,	// scientifica U+0132 (Ĳ)
+	0x00, 0x80, 0x02, 0x4a, 0x29, 0xa5, 0x14, 0x01,	// scientifica U+0133 (ĳ)
+	0x80, 0x28, 0xe0, 0x10, 0x42, 0xc9, 0x01, 0x00,	// scientifica U+0134 (Ĵ)
+	0x00, 0x88, 0x02, 0x0c, 0x21, 0x84, 0x10, 0x01,	// scientifica U+0135 (ĵ)
+	0x00, 0x80, 0x54, 0x46, 0x49, 0x29, 0x11, 0x03,	// scientifica U+0136 (Ķ)
+	0x00, 0x80, 0x10, 0x52, 0x19, 0x25, 0x11, 0x03,	// scientifica U+0137 (ķ)
+	0x00, 0x00, 0x90, 0xd2, 0x29, 0x29, 0x01, 0x00,	// scientifica U+0138 (ĸ)
+	0x80, 0x08, 0x10, 0x42, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+0139 (Ĺ)
+	0x80, 0x88, 0x21, 0x84, 0x10, 0x82, 0x01, 0x00,	// scientifica U+013A (ĺ)
+	0x00, 0x80, 0x10, 0x42, 0x08, 0xe1, 0x11, 0x03,	// scientifica U+013B (Ļ)
+	0x00, 0x80, 0x21, 0x84, 0x10, 0x82, 0x89, 0x01,	// scientifica U+013C (ļ)
+	0x00, 0x80, 0x52, 0x42, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+013D (Ľ)
+	0x00, 0x80, 0xa5, 0x84, 0x10, 0x82, 0x01, 0x00,	// scientifica U+013E (ľ)
+	0x00, 0x80, 0x10, 0x42, 0x0a, 0xe1, 0x01, 0x00,	// scientifica U+013F (Ŀ)
+	0x00, 0x00, 0x30, 0x84, 0x12, 0x82, 0x01, 0x00,	// scientifica U+0140 (ŀ)
+	0x00, 0x80, 0x10, 0xca, 0x08, 0xe1, 0x01, 0x00,	// scientifica U+0141 (Ł)
+	0x00, 0x80, 0xa1, 0x8c, 0x18, 0x82, 0x01, 0x00,	// scientifica U+0142 (ł)
+	0x00, 0x91, 0x94, 0x56, 0x6b, 0x29, 0x01, 0x00,	// scientifica U+0143 (Ń)
+	0x00, 0x10, 0x01, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0144 (ń)
+	0x00, 0x80, 0x94, 0x56, 0x6b, 0x29, 0x11, 0x06,	// scientifica U+0145 (Ņ)
+	0x00, 0x00, 0x00, 0x4e, 0x4a, 0x29, 0x11, 0x06,	// scientifica U+0146 (ņ)
+	0x40, 0x91, 0xb4, 0x56, 0x6b, 0x29, 0x01, 0x00,	// scientifica U+0147 (Ň)
+	0x00, 0x28, 0x02, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0148 (ň)
+	0x00, 0x88, 0x00, 0x4e, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+0149 (ŉ)
+	0x00, 0x00, 0x50, 0x56, 0x4a, 0x29, 0x21, 0x03,	// scientifica U+014A (Ŋ)
+	0x00, 0x00, 0x00, 0x4e, 0x4a, 0x29, 0x21, 0x02,	// scientifica U+014B (ŋ)
+	0xe0, 0x01, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+014C (Ō)
+	0x00, 0x80, 0x07, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+014D (ō)
+	0x20, 0x19, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+014E (Ŏ)
+	0x00, 0x24, 0x03, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+014F (ŏ)
+	0x00, 0x00, 0x5f, 0x4a, 0x2f, 0xc5, 0x03, 0x00,	// scientifica U+0152 (Œ)
+	0x00, 0x00, 0x00, 0x7c, 0xed, 0xc5, 0x03, 0x00,	// scientifica U+0153 (œ)
+	0x80, 0x88, 0x93, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0154 (Ŕ)
+	0x00, 0x10, 0x01, 0x4e, 0x0a, 0x21, 0x00, 0x00,	// scientifica U+0155 (ŕ)
+	0x00, 0x80, 0x93, 0xd2, 0x49, 0x29, 0x89, 0x00,	// scientifica U+0156 (Ŗ)
+	0x00, 0x00, 0x00, 0x4e, 0x0a, 0x21, 0x88, 0x00,	// scientifica U+0157 (ŗ)
+	0x40, 0x91, 0x93, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0158 (Ř)
+	0x40, 0x11, 0x00, 0x4e, 0x0a, 0x21, 0x00, 0x00,	// scientifica U+0159 (ř)
+	0x80, 0x08, 0x93, 0x82, 0x41, 0xc9, 0x00, 0x00,	// scientifica U+015A (Ś)
+	0x00, 0x10, 0x01, 0x5c, 0x30, 0xe8, 0x00, 0x00,	// scientifica U+015B (ś)
+	0x80, 0x28, 0x93, 0x82, 0x41, 0xc9, 0x00, 0x00,	// scientifica U+015C (Ŝ)
+	0x00, 0x10, 0x05, 0x5c, 0x30, 0xe8, 0x00, 0x00,	// scientifica U+015D (ŝ)
+	0x00, 0x00, 0x93, 0x82, 0x41, 0xc9, 0x10, 0x03,	// scientifica U+015E (Ş)
+	0x00, 0x00, 0x00, 0x5c, 0x30, 0xe8, 0x10, 0x03,	// scientifica U+015F (ş)
+	0x40, 0x11, 0x93, 0x82, 0x41, 0xc9, 0x00, 0x00,	// scientifica U+0160 (Š)
+	0x00, 0x28, 0x02, 0x5c, 0x30, 0xe8, 0x00, 0x00,	// scientifica U+0161 (š)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0x42, 0x10, 0x03,	// scientifica U+0162 (Ţ)
+	0x00, 0x00, 0x21, 0x8e, 0x10, 0x82, 0x88, 0x01,	// scientifica U+0163 (ţ)
+	0xa0, 0x88, 0x23, 0x84, 0x10, 0x42, 0x00, 0x00,	// scientifica U+0164 (Ť)
+	0x00, 0x00, 0x29, 0x8f, 0x10, 0x82, 0x00, 0x00,	// scientifica U+0165 (ť)
+	0x00, 0x80, 0x23, 0x84, 0x38, 0x42, 0x00, 0x00,	// scientifica U+0166 (Ŧ)
+	0x00, 0x00, 0x21, 0x8e, 0x38, 0x82, 0x00, 0x00,	// scientifica U+0167 (ŧ)
+	0xa0, 0xa8, 0x90, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0168 (Ũ)
+	0x00, 0xa8, 0x02, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0169 (ũ)
+	0xe0, 0x80, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016A (Ū)
+	0x00, 0x80, 0x03, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016B (ū)
+	0x20, 0x99, 0x94, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016C (Ŭ)
+	0x00, 0x24, 0x03, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016D (ŭ)
+	0x80, 0xa8, 0x96, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016E (Ů)
+	0x00, 0x10, 0x45, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+016F (ů)
+	0x00, 0x80, 0x94, 0x52, 0x4a, 0xc9, 0x11, 0x04,	// scientifica U+0172 (Ų)
+	0x00, 0x00, 0x90, 0x52, 0x4a, 0xc9, 0x01, 0x0c,	// scientifica U+0173 (ų)
+	0x80, 0x28, 0x90, 0x52, 0x4a, 0x2f, 0x01, 0x00,	// scientifica U+0174 (Ŵ)
+	0x00, 0x10, 0x05, 0x52, 0x4a, 0x2f, 0x01, 0x00,	// scientifica U+0175 (ŵ)
+	0x80, 0xa8, 0x90, 0x92, 0x43, 0xc9, 0x01, 0x00,	// scientifica U+0176 (Ŷ)
+	0x00, 0x88, 0x02, 0x52, 0x4a, 0xc9, 0x25, 0x03,	// scientifica U+0177 (ŷ)
+	0x20, 0x81, 0x94, 0x92, 0x43, 0xc9, 0x01, 0x00,	// scientifica U+0178 (Ÿ)
+	0x40, 0x80, 0x87, 0x10, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+0179 (Ź)
+	0x00, 0x10, 0x01, 0x1e, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+017A (ź)
+	0x00, 0x00, 0x01, 0x1e, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+017C (ż)
+	0x40, 0x91, 0x87, 0x10, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+017D (Ž)
+	0x40, 0x11, 0x00, 0x1e, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+017E (ž)
+	0x00, 0x00, 0x26, 0x86, 0x10, 0x42, 0x00, 0x00,	// scientifica U+017F (ſ)
+	0x00, 0x84, 0x13, 0x4e, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+0180 (ƀ)
+	0x00, 0x00, 0x57, 0x29, 0xa3, 0x94, 0x01, 0x00,	// scientifica U+0181 (Ɓ)
+	0x00, 0x80, 0x17, 0xc2, 0x49, 0xe9, 0x00, 0x00,	// scientifica U+0182 (Ƃ)
+	0x00, 0x80, 0x17, 0x4e, 0x4a, 0xe9, 0x00, 0x00,	// scientifica U+0183 (ƃ)
+	0x00, 0x00, 0x31, 0x84, 0x51, 0xca, 0x00, 0x00,	// scientifica U+0184 (Ƅ)
+	0x00, 0x00, 0x31, 0x8c, 0x52, 0xca, 0x00, 0x00,	// scientifica U+0185 (ƅ)
+	0x00, 0x00, 0x93, 0x10, 0x42, 0xc9, 0x00, 0x00,	// scientifica U+0186 (Ɔ)
+	0x00, 0x13, 0x93, 0x42, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+0187 (Ƈ)
+	0x00, 0x00, 0x4c, 0x4c, 0x0a, 0xc9, 0x00, 0x00,	// scientifica U+0188 (ƈ)
+	0x00, 0x00, 0xa3, 0xd4, 0x53, 0xca, 0x00, 0x00,	// scientifica U+0189 (Ɖ)
+	0x00, 0x00, 0x57, 0x29, 0xa5, 0x94, 0x01, 0x00,	// scientifica U+018A (Ɗ)
+	0x00, 0x3c, 0x84, 0x90, 0x4b, 0xc9, 0x01, 0x00,	// scientifica U+018B (Ƌ)
+	0x00, 0x3c, 0x84, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+018C (ƌ)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0xc9, 0xa0, 0x03,	// scientifica U+018D (ƍ)
+	0x00, 0x80, 0x87, 0x10, 0x43, 0xe8, 0x01, 0x00,	// scientifica U+018E (Ǝ)
+	0x00, 0x00, 0x00, 0x0e, 0x7a, 0xc9, 0x00, 0x00,	// scientifica U+018F (Ə)
+	0x00, 0x00, 0x17, 0x82, 0x09, 0xc9, 0x00, 0x00,	// scientifica U+0190 (Ɛ)
+	0x00, 0x00, 0x27, 0x84, 0x11, 0x42, 0x88, 0x00,	// scientifica U+0191 (Ƒ)
+	0x00, 0x10, 0x25, 0xc4, 0x11, 0x42, 0x88, 0x00,	// scientifica U+0192 (ƒ)
+	0x80, 0x09, 0x93, 0x42, 0x68, 0xc9, 0x00, 0x00,	// scientifica U+0193 (Ɠ)
+	0x00, 0x80, 0xa4, 0x88, 0x49, 0xc9, 0x00, 0x00,	// scientifica U+0194 (Ɣ)
+	0x00, 0x80, 0x90, 0x66, 0xad, 0xb5, 0x01, 0x00,	// scientifica U+0195 (ƕ)
+	0x00, 0x00, 0x21, 0x84, 0x10, 0x82, 0x00, 0x00,	// scientifica U+0196 (Ɩ)
+	0x00, 0x00, 0x21, 0x84, 0x10, 0x47, 0x00, 0x00,	// scientifica U+0197 (Ɨ)
+	0x00, 0x80, 0x54, 0x47, 0x29, 0x29, 0x01, 0x00,	// scientifica U+0198 (Ƙ)
+	0x00, 0x88, 0x12, 0x52, 0x19, 0x25, 0x01, 0x00,	// scientifica U+0199 (ƙ)
+	0x00, 0x00, 0x43, 0x88, 0x23, 0x04, 0x01, 0x00,	// scientifica U+019A (ƚ)
+	0x00, 0x00, 0x55, 0x08, 0x31, 0x29, 0x01, 0x00,	// scientifica U+019B (ƛ)
+	0x00, 0x80, 0x94, 0x52, 0x4a, 0x2f, 0x01, 0x00,	// scientifica U+019C (Ɯ)
+	0x00, 0x80, 0x94, 0x56, 0x6b, 0x29, 0x21, 0x03,	// scientifica U+019D (Ɲ)
+	0x00, 0x00, 0x00, 0x4e, 0x4a, 0x29, 0x21, 0x04,	// scientifica U+019E (ƞ)
+	0x00, 0x00, 0x60, 0xd2, 0x4b, 0xc9, 0x00, 0x00,	// scientifica U+019F (Ɵ)
+	0x00, 0x21, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01A0 (Ơ)
+	0x00, 0x00, 0x84, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01A1 (ơ)
+	0x00, 0x00, 0xe0, 0x6b, 0xad, 0xd5, 0x02, 0x00,	// scientifica U+01A2 (Ƣ)
+	0x00, 0x00, 0xe0, 0x6a, 0xad, 0x16, 0x42, 0x04,	// scientifica U+01A3 (ƣ)
+	0x00, 0x00, 0xb3, 0x94, 0x11, 0x42, 0x00, 0x00,	// scientifica U+01A4 (Ƥ)
+	0x00, 0x00, 0x13, 0x4e, 0x4a, 0xe9, 0x84, 0x00,	// scientifica U+01A5 (ƥ)
+	0x00, 0x84, 0x93, 0xd2, 0x49, 0x29, 0x21, 0x08,	// scientifica U+01A6 (Ʀ)
+	0x00, 0x00, 0x93, 0x90, 0x09, 0xc9, 0x00, 0x00,	// scientifica U+01A7 (Ƨ)
+	0x00, 0x00, 0x00, 0x0e, 0x32, 0xc1, 0x01, 0x00,	// scientifica U+01A8 (ƨ)
+	0x00, 0x80, 0x17, 0x04, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+01A9 (Ʃ)
+	0x40, 0x14, 0xe2, 0x08, 0x21, 0x04, 0x01, 0x00,	// scientifica U+01AA (ƪ)
+	0x00, 0x00, 0x21, 0x9e, 0x10, 0x82, 0x21, 0x02,	// scientifica U+01AB (ƫ)
+	0x00, 0x00, 0x57, 0x08, 0x21, 0x84, 0x00, 0x00,	// scientifica U+01AC (Ƭ)
+	0x80, 0x08, 0x21, 0x9e, 0x10, 0x82, 0x01, 0x00,	// scientifica U+01AD (ƭ)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0x42, 0x08, 0x02,	// scientifica U+01AE (Ʈ)
+	0x00, 0xc2, 0x94, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01AF (Ư)
+	0x00, 0x00, 0x08, 0x53, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+01B0 (ư)
+	0x00, 0x00, 0xb0, 0x55, 0x8c, 0xd1, 0x01, 0x00,	// scientifica U+01B1 (Ʊ)
+	0x00, 0x00, 0x50, 0x52, 0x4a, 0x65, 0x00, 0x00,	// scientifica U+01B2 (Ʋ)
+	0x00, 0xa0, 0x5a, 0x8a, 0x21, 0xc5, 0x00, 0x00,	// scientifica U+01B3 (Ƴ)
+	0x00, 0x00, 0x80, 0x6a, 0x29, 0xc5, 0x14, 0x03,	// scientifica U+01B4 (ƴ)
+	0x00, 0x80, 0x87, 0xc8, 0x13, 0xe1, 0x01, 0x00,	// scientifica U+01B5 (Ƶ)
+	0x00, 0x00, 0xf0, 0x10, 0x79, 0xe2, 0x01, 0x00,	// scientifica U+01B6 (ƶ)
+	0x00, 0x80, 0x96, 0x52, 0x4a, 0x69, 0x21, 0x03,	// scientifica U+01C7 (Ǉ)
+	0x00, 0x80, 0x14, 0x52, 0x4a, 0x69, 0x21, 0x02,	// scientifica U+01C8 (ǈ)
+	0x00, 0x80, 0x25, 0x94, 0x52, 0x4a, 0x21, 0x02,	// scientifica U+01C9 (ǉ)
+	0x00, 0x80, 0x7a, 0x6f, 0xad, 0xb5, 0x42, 0x06,	// scientifica U+01CA (Ǌ)
+	0x00, 0x80, 0x7a, 0x6e, 0xad, 0xb5, 0x42, 0x04,	// scientifica U+01CB (ǋ)
+	0x00, 0x00, 0x08, 0x66, 0xad, 0xb5, 0x42, 0x04,	// scientifica U+01CC (ǌ)
+	0xa0, 0x08, 0x93, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientifica U+01CD (Ǎ)
+	0x00, 0x14, 0x01, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+01CE (ǎ)
+	0xa0, 0x88, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+01CF (Ǐ)
+	0x00, 0x14, 0x01, 0x86, 0x10, 0x82, 0x01, 0x00,	// scientifica U+01D0 (ǐ)
+	0xa0, 0x08, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01D1 (Ǒ)
+	0x00, 0x14, 0x01, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01D2 (ǒ)
+	0xa0, 0x88, 0x94, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+01D3 (Ǔ)
+	0x00, 0x14, 0x01, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+01D4 (ǔ)
+	0xa0, 0x28, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+020C (Ȍ)
+	0x00, 0x14, 0x05, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+020D (ȍ)
+	0xc0, 0x24, 0x93, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+020E (Ȏ)
+	0x00, 0x98, 0x04, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+020F (ȏ)
+	0xa0, 0x28, 0x70, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0210 (Ȑ)
+	0x00, 0x14, 0x05, 0x4e, 0x0a, 0x21, 0x00, 0x00,	// scientifica U+0211 (ȑ)
+	0xc0, 0x24, 0x70, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientifica U+0212 (Ȓ)
+	0x00, 0x98, 0x04, 0x4e, 0x0a, 0x21, 0x00, 0x00,	// scientifica U+0213 (ȓ)
+	0xa0, 0x28, 0x90, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0214 (Ȕ)
+	0x00, 0x14, 0x05, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0215 (ȕ)
+	0xc0, 0x24, 0x90, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0216 (Ȗ)
+	0x00, 0x98, 0x04, 0x52, 0x4a, 0xc9, 0x01, 0x00,	// scientifica U+0217 (ȗ)
+	0x00, 0x00, 0x93, 0x82, 0x41, 0xc9, 0x10, 0x01,	// scientifica U+0218 (Ș)
+	0x00, 0x00, 0x00, 0x5c, 0x30, 0xe8, 0x10, 0x01,	// scientifica U+0219 (ș)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0x42, 0x88, 0x00,	// scientifica U+021A (Ț)
+	0x00, 0x00, 0x21, 0x9e, 0x10, 0x82, 0x11, 0x01,	// scientifica U+021B (ț)
+	0x00, 0x00, 0x21, 0x08, 0x42, 0xc9, 0x00, 0x00,	// scientifica U+0296 (ʖ)
+	0x00, 0xb8, 0x18, 0x6b, 0x8d, 0xd1, 0x01, 0x00,	// scientifica U+0298 (ʘ)
+	0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+02C7 (ˇ)
+	0x00, 0x10, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+02DA (˚)
+	0x00, 0x00, 0x00, 0x4c, 0x42, 0x88, 0x00, 0x00,	// scientifica U+0364 (ͤ)
+	0x00, 0x80, 0x17, 0x42, 0x08, 0x21, 0x00, 0x00,	// scientifica U+0393 (Γ)
+	0x00, 0x00, 0x40, 0x88, 0x52, 0xf1, 0x03, 0x00,	// scientifica U+0394 (Δ)
+	0x00, 0x80, 0x87, 0x10, 0x11, 0xe1, 0x01, 0x00,	// scientifica U+0396 (Ζ)
+	0x00, 0x00, 0x93, 0xd2, 0x4b, 0xc9, 0x00, 0x00,	// scientifica U+0398 (Θ)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+0399 (Ι)
+	0x00, 0x80, 0x54, 0x46, 0x29, 0x29, 0x01, 0x00,	// scientifica U+039A (Κ)
+	0x00, 0x00, 0x42, 0x94, 0x8a, 0x31, 0x02, 0x00,	// scientifica U+039B (Λ)
+	0x00, 0x80, 0xf4, 0x52, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+039C (Μ)
+	0x00, 0x80, 0x97, 0x80, 0x01, 0xe9, 0x01, 0x00,	// scientifica U+039E (Ξ)
+	0x00, 0x80, 0x97, 0x52, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+03A0 (Π)
+	0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,	// scientifica U+03A2 (΢)
+	0x00, 0x80, 0x23, 0x84, 0x10, 0x42, 0x00, 0x00,	// scientifica U+03A4 (Τ)
+	0x00, 0x80, 0x94, 0x92, 0x43, 0xc9, 0x00, 0x00,	// scientifica U+03A5 (Υ)
+	0x00, 0x00, 0xe2, 0x6a, 0xad, 0x8e, 0x00, 0x00,	// scientifica U+03A6 (Φ)
+	0x00, 0x80, 0x94, 0x4c, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+03A7 (Χ)
+	0x00, 0x80, 0x5a, 0xab, 0x23, 0x84, 0x00, 0x00,	// scientifica U+03A8 (Ψ)
+	0x00, 0x00, 0x17, 0x63, 0xdc, 0x6a, 0x03, 0x00,	// scientifica U+03A9 (Ω)
+	0x00, 0x00, 0x00, 0x80, 0x2a, 0x45, 0x01, 0x00,	// scientifica U+03B1 (α)
+	0x00, 0x00, 0x30, 0x4a, 0x59, 0xe9, 0x84, 0x00,	// scientifica U+03B2 (β)
+	0x00, 0x00, 0x00, 0x40, 0x32, 0x44, 0x29, 0x02,	// scientifica U+03B3 (γ)
+	0x00, 0x00, 0xf0, 0x82, 0x49, 0xc9, 0x00, 0x00,	// scientifica U+03B4 (δ)
+	0x00, 0x00, 0x60, 0x92, 0x08, 0xc9, 0x00, 0x00,	// scientifica U+03B5 (ε)
+	0x00, 0x00, 0x00, 0x1e, 0x11, 0x21, 0x38, 0x04,	// scientifica U+03B6 (ζ)
+	0x00, 0x00, 0x00, 0x4c, 0x7a, 0xc9, 0x00, 0x00,	// scientifica U+03B8 (θ)
+	0x00, 0x00, 0x30, 0x84, 0x10, 0x82, 0x00, 0x00,	// scientifica U+03B9 (ι)
+	0x00, 0x00, 0x00, 0xca, 0x28, 0xa5, 0x00, 0x00,	// scientifica U+03BA (κ)
+	0x00, 0x00, 0x51, 0x08, 0x51, 0x29, 0x01, 0x00,	// scientifica U+03BB (λ)
+	0x00, 0x00, 0x40, 0x92, 0x52, 0x8a, 0x00, 0x00,	// scientifica U+03BD (ν)
+	0x00, 0x00, 0x70, 0x92, 0x08, 0xc1, 0x21, 0x03,	// scientifica U+03BE (ξ)
+	0x00, 0x00, 0xf0, 0x95, 0x52, 0x4a, 0x01, 0x00,	// scientifica U+03C0 (π)
+	0x00, 0x00, 0x00, 0x00, 0x51, 0xca, 0x08, 0x01,	// scientifica U+03C1 (ρ)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0xc1, 0x20, 0x02,	// scientifica U+03C2 (ς)
+	0x00, 0x00, 0x80, 0x4c, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+03C3 (σ)
+	0x00, 0x00, 0x00, 0x9e, 0x10, 0x8a, 0x00, 0x00,	// scientifica U+03C4 (τ)
+	0x00, 0x00, 0x00, 0x00, 0x68, 0xe9, 0x09, 0x01,	// scientifica U+03C6 (φ)
+	0x00, 0x00, 0x00, 0x40, 0x32, 0xa2, 0x20, 0x00,	// scientifica U+03C7 (χ)
+	0x00, 0x00, 0x00, 0x00, 0xa9, 0xd5, 0x11, 0x02,	// scientifica U+03C8 (ψ)
+	0x00, 0x00, 0x00, 0x54, 0x8c, 0x55, 0x01, 0x00,	// scientifica U+03C9 (ω)
+	0x00, 0x20, 0x4a, 0x08, 0x21, 0x84, 0x88, 0x00,	// scientifica U+0F3C (༼)
+	0x00, 0x88, 0x42, 0x08, 0x21, 0x84, 0x20, 0x08,	// scientifica U+0F3D (༽)
+	0x00, 0x00, 0x97, 0x52, 0x49, 0xe9, 0x85, 0x00,	// scientifica U+1E9E (ẞ)
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,	// scientifica U+2010 (‐)
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,	// scientifica U+2014 (—)
+	0x00, 0x00, 0xa5, 0x94, 0x52, 0x4a, 0x01, 0x00,	// scientifica U+2016 (‖)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x00,	// scientifica U+2017 (‗)
+	0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2018 (‘)
+	0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2019 (’)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x02,	// scientifica U+201A (‚)
+	0x00, 0x80, 0x52, 0x14, 0x00, 0x00, 0x00, 0x00,	// scientifica U+201C (“)
+	0x00, 0x00, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0x00,	// scientifica U+201D (”)
+	0x00, 0x00, 0x00, 0x00, 0x50, 0xaa, 0x00, 0x00,	// scientifica U+201E („)
+	0x00, 0x00, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00,	// scientifica U+201F (‟)
+	0x00, 0x00, 0x20, 0xc4, 0x11, 0x42, 0x00, 0x00,	// scientifica U+2020 (†)
+	0x00, 0x00, 0x21, 0x8e, 0x38, 0x42, 0x00, 0x00,	// scientifica U+2021 (‡)
+	0x00, 0x00, 0x00, 0x00, 0x71, 0x04, 0x00, 0x00,	// scientifica U+2022 (•)
+	0x00, 0x00, 0x00, 0x40, 0x18, 0x01, 0x00, 0x00,	// scientifica U+2023 (‣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00,	// scientifica U+2025 (‥)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00,	// scientifica U+2026 (…)
+	0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2032 (′)
+	0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2033 (″)
+	0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2034 (‴)
+	0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2035 (‵)
+	0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2036 (‶)
+	0x00, 0x80, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2037 (‷)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00,	// scientifica U+2038 (‸)
+	0x00, 0x00, 0x10, 0x04, 0x41, 0x44, 0x04, 0x00,	// scientifica U+2039 (‹)
+	0x00, 0x00, 0x60, 0x04, 0x01, 0x00, 0x00, 0x00,	// scientifica U+203A (›)
+	0x00, 0x00, 0x00, 0x80, 0x22, 0x0a, 0x00, 0x00,	// scientifica U+203B (※)
+	0x00, 0x80, 0x52, 0x4a, 0x29, 0xa0, 0x00, 0x00,	// scientifica U+203C (‼)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x19, 0x00,	// scientifica U+203F (‿)
+	0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2040 (⁀)
+	0x00, 0x00, 0x00, 0x00, 0x22, 0xa2, 0x00, 0x00,	// scientifica U+2041 (⁁)
+	0x00, 0x00, 0x00, 0x04, 0x28, 0x00, 0x00, 0x00,	// scientifica U+2042 (⁂)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x10, 0x00,	// scientifica U+204F (⁏)
+	0x00, 0x00, 0x60, 0x12, 0x00, 0xc9, 0x00, 0x00,	// scientifica U+2050 (⁐)
+	0x00, 0x80, 0x22, 0x0a, 0x28, 0xa2, 0x00, 0x00,	// scientifica U+2051 (⁑)
+	0x00, 0x00, 0x00, 0x2a, 0xf9, 0xa4, 0x02, 0x00,	// scientifica U+205C (⁜)
+	0x00, 0x7c, 0xf4, 0xd1, 0x11, 0x04, 0x01, 0x00,	// scientifica U+20A8 (₨)
+	0x00, 0x80, 0x5b, 0x6b, 0xac, 0xb5, 0x03, 0x00,	// scientifica U+20AA (₪)
+	0x00, 0x00, 0xe0, 0xc2, 0x39, 0xc1, 0x01, 0x00,	// scientifica U+20AC (€)
+	0xc0, 0x11, 0x42, 0x94, 0x53, 0x0a, 0x00, 0x00,	// scientifica U+2122 (™)
+	0x00, 0x00, 0x00, 0x88, 0xf8, 0x82, 0x00, 0x00,	// scientifica U+2190 (←)
+	0x00, 0x00, 0x00, 0x88, 0xab, 0x84, 0x00, 0x00,	// scientifica U+2191 (↑)
+	0x00, 0x00, 0x00, 0x08, 0xfa, 0x88, 0x00, 0x00,	// scientifica U+2192 (→)
+	0x00, 0x00, 0x00, 0x08, 0xa9, 0x8e, 0x00, 0x00,	// scientifica U+2193 (↓)
+	0x00, 0x00, 0x00, 0x80, 0xfa, 0x0a, 0x00, 0x00,	// scientifica U+2194 (↔)
+	0x00, 0x00, 0x00, 0xc4, 0x11, 0xe2, 0x08, 0x00,	// scientifica U+2195 (↕)
+	0x00, 0x00, 0x00, 0xc0, 0x18, 0x04, 0x01, 0x00,	// scientifica U+2196 (↖)
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x22, 0x00, 0x00,	// scientifica U+2197 (↗)
+	0x00, 0x00, 0x00, 0x40, 0x10, 0x8c, 0x01, 0x00,	// scientifica U+2198 (↘)
+	0x00, 0x00, 0x00, 0x00, 0x22, 0x63, 0x00, 0x00,	// scientifica U+2199 (↙)
+	0x00, 0x00, 0x40, 0xe5, 0x97, 0x14, 0x00, 0x00,	// scientifica U+21A4 (↤)
+	0x00, 0x00, 0x40, 0x5c, 0x25, 0x1f, 0x00, 0x00,	// scientifica U+21A5 (↥)
+	0x00, 0x00, 0x50, 0xd2, 0x4f, 0x05, 0x00, 0x00,	// scientifica U+21A6 (↦)
+	0x00, 0x00, 0xf0, 0x49, 0x75, 0x04, 0x00, 0x00,	// scientifica U+21A7 (↧)
+	0x00, 0x00, 0x00, 0x80, 0xfc, 0x02, 0x00, 0x00,	// scientifica U+21A9 (↩)
+	0x00, 0x00, 0x00, 0x40, 0xfa, 0x08, 0x00, 0x00,	// scientifica U+21AA (↪)
+	0x00, 0x00, 0xf1, 0x14, 0x42, 0x08, 0x01, 0x00,	// scientifica U+21B0 (↰)
+	0x00, 0x00, 0xf2, 0x4a, 0x08, 0x21, 0x00, 0x00,	// scientifica U+21B1 (↱)
+	0x00, 0x00, 0x84, 0x10, 0x52, 0x4f, 0x00, 0x00,	// scientifica U+21B2 (↲)
+	0x00, 0x80, 0x10, 0x42, 0x28, 0x8f, 0x00, 0x00,	// scientifica U+21B3 (↳)
+	0x00, 0x00, 0x70, 0x08, 0x21, 0x8e, 0x00, 0x00,	// scientifica U+21B4 (↴)
+	0x00, 0x00, 0x00, 0x20, 0x94, 0x5f, 0x00, 0x00,	// scientifica U+21B5 (↵)
+	0x00, 0x00, 0x00, 0x98, 0x94, 0x57, 0x00, 0x00,	// scientifica U+21B6 (↶)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0x3d, 0x01, 0x00,	// scientifica U+21B7 (↷)
+	0x00, 0x00, 0x00, 0x50, 0x4e, 0xc9, 0x00, 0x00,	// scientifica U+21BA (↺)
+	0x00, 0x00, 0x00, 0xc4, 0x94, 0x92, 0x01, 0x00,	// scientifica U+21BB (↻)
+	0x00, 0x00, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x00,	// scientifica U+21BC (↼)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00,	// scientifica U+21BD (↽)
+	0x00, 0x00, 0x00, 0x08, 0x23, 0x84, 0x00, 0x00,	// scientifica U+21BE (↾)
+	0x00, 0x00, 0x00, 0xc4, 0x10, 0x42, 0x00, 0x00,	// scientifica U+21BF (↿)
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,	// scientifica U+21C0 (⇀)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00,	// scientifica U+21C1 (⇁)
+	0x00, 0x00, 0x00, 0x08, 0x21, 0x8c, 0x00, 0x00,	// scientifica U+21C2 (⇂)
+	0x00, 0x00, 0x00, 0x84, 0x10, 0x43, 0x00, 0x00,	// scientifica U+21C3 (⇃)
+	0x00, 0x00, 0x00, 0xd0, 0x57, 0x5f, 0x00, 0x00,	// scientifica U+21C4 (⇄)
+	0x00, 0x00, 0x00, 0xc4, 0x57, 0x1f, 0x01, 0x00,	// scientifica U+21C6 (⇆)
+	0x00, 0x00, 0x00, 0xc4, 0x17, 0x5f, 0x00, 0x00,	// scientifica U+21C7 (⇇)
+	0x00, 0x00, 0x00, 0xd4, 0x57, 0x4a, 0x01, 0x00,	// scientifica U+21C8 (⇈)
+	0x00, 0x00, 0x00, 0xd0, 0x47, 0x1f, 0x01, 0x00,	// scientifica U+21C9 (⇉)
+	0x00, 0x00, 0x00, 0x94, 0x52, 0x5f, 0x01, 0x00,	// scientifica U+21CA (⇊)
+	0x00, 0x00, 0x00, 0xc4, 0x07, 0x1f, 0x01, 0x00,	// scientifica U+21CB (⇋)
+	0x00, 0x00, 0x00, 0x88, 0x0f, 0x9e, 0x00, 0x00,	// scientifica U+21D0 (⇐)
+	0x00, 0x00, 0x40, 0xd4, 0x56, 0x4a, 0x01, 0x00,	// scientifica U+21D1 (⇑)
+	0x00, 0x00, 0x00, 0xc8, 0x83, 0x8f, 0x00, 0x00,	// scientifica U+21D2 (⇒)
+	0x00, 0x00, 0x00, 0x94, 0x52, 0x5b, 0x11, 0x00,	// scientifica U+21D3 (⇓)
+	0x00, 0x00, 0x90, 0x52, 0x7a, 0x29, 0x19, 0x00,	// scientifica U+2200 (∀)
+	0x00, 0x00, 0x93, 0x4a, 0x48, 0xc9, 0x00, 0x00,	// scientifica U+2201 (∁)
+	0x00, 0x00, 0x93, 0x90, 0x4b, 0xc9, 0x00, 0x00,	// scientifica U+2202 (∂)
+	0x00, 0x80, 0x87, 0x90, 0x43, 0xe8, 0x01, 0x00,	// scientifica U+2203 (∃)
+	0x00, 0xa0, 0xc7, 0x94, 0x4b, 0xe9, 0x01, 0x00,	// scientifica U+2204 (∄)
+	0x00, 0x00, 0x42, 0x5c, 0xad, 0x8e, 0x10, 0x00,	// scientifica U+2205 (∅)
+	0x00, 0x00, 0x00, 0x88, 0x8a, 0x1f, 0x00, 0x00,	// scientifica U+2206 (∆)
+	0x00, 0x00, 0xf0, 0xa3, 0x22, 0x00, 0x00, 0x00,	// scientifica U+2207 (∇)
+	0x00, 0x00, 0x00, 0x7c, 0x78, 0xc1, 0x03, 0x00,	// scientifica U+2208 (∈)
+	0x00, 0x00, 0x00, 0x5d, 0x39, 0xc1, 0x01, 0x00,	// scientifica U+2209 (∉)
+	0x00, 0x00, 0x00, 0x5c, 0x38, 0xc1, 0x01, 0x00,	// scientifica U+220A (∊)
+	0x00, 0x00, 0x00, 0x0e, 0x72, 0xe8, 0x00, 0x00,	// scientifica U+220B (∋)
+	0x00, 0x00, 0x00, 0x1f, 0x73, 0xe9, 0x00, 0x00,	// scientifica U+220C (∌)
+	0x00, 0x00, 0x00, 0x80, 0x73, 0x0e, 0x00, 0x00,	// scientifica U+220E (∎)
+	0x00, 0x00, 0xf0, 0x52, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+220F (∏)
+	0x00, 0x00, 0x90, 0x52, 0x4a, 0xe9, 0x01, 0x00,	// scientifica U+2210 (∐)
+	0x00, 0xbc, 0x14, 0x04, 0x11, 0x21, 0x3d, 0x00,	// scientifica U+2211 (∑)
+	0x00, 0x00, 0xf0, 0x09, 0xf9, 0x84, 0x00, 0x00,	// scientifica U+2213 (∓)
+	0x00, 0x00, 0x40, 0x00, 0xf9, 0x84, 0x00, 0x00,	// scientifica U+2214 (∔)
+	0x00, 0x00, 0x00, 0x00, 0x51, 0x04, 0x00, 0x00,	// scientifica U+2218 (∘)
+	0x00, 0x40, 0x88, 0x10, 0x29, 0x42, 0x00, 0x00,	// scientifica U+221A (√)
+	0x00, 0x00, 0x00, 0x54, 0xad, 0x55, 0x01, 0x00,	// scientifica U+221E (∞)
+	0x00, 0x00, 0x40, 0x88, 0x52, 0x31, 0x02, 0x00,	// scientifica U+2227 (∧)
+	0x00, 0x00, 0x10, 0xa3, 0x52, 0x84, 0x00, 0x00,	// scientifica U+2228 (∨)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0x29, 0x01, 0x00,	// scientifica U+2229 (∩)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xc9, 0x00, 0x00,	// scientifica U+222A (∪)
+	0x00, 0x20, 0x4a, 0x08, 0x21, 0x84, 0x14, 0x01,	// scientifica U+222B (∫)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x02, 0x00,	// scientifica U+2234 (∴)
+	0x00, 0x00, 0x10, 0x01, 0x00, 0x80, 0x00, 0x00,	// scientifica U+2235 (∵)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00,	// scientifica U+2236 (∶)
+	0x00, 0x00, 0x00, 0x24, 0x00, 0x40, 0x02, 0x00,	// scientifica U+2237 (∷)
+	0x00, 0x00, 0x51, 0x11, 0xf8, 0x00, 0x00, 0x00,	// scientifica U+2243 (≃)
+	0x00, 0x00, 0x20, 0x2a, 0x12, 0x15, 0x01, 0x00,	// scientifica U+2248 (≈)
+	0x00, 0x00, 0x00, 0x40, 0x07, 0x1d, 0x00, 0x00,	// scientifica U+2254 (≔)
+	0x00, 0x00, 0x00, 0xc0, 0x05, 0x17, 0x00, 0x00,	// scientifica U+2255 (≕)
+	0x00, 0x00, 0x80, 0xd0, 0x27, 0x5f, 0x08, 0x00,	// scientifica U+2260 (≠)
+	0x00, 0x00, 0x00, 0x3e, 0xf8, 0xe0, 0x03, 0x00,	// scientifica U+2261 (≡)
+	0x00, 0x00, 0x00, 0x3f, 0xfa, 0xe2, 0x07, 0x00,	// scientifica U+2262 (≢)
+	0x00, 0x00, 0x44, 0x04, 0x41, 0xe0, 0x03, 0x00,	// scientifica U+2264 (≤)
+	0x00, 0x00, 0x41, 0x10, 0x11, 0xe0, 0x03, 0x00,	// scientifica U+2265 (≥)
+	0x00, 0x00, 0x00, 0x5c, 0x08, 0x0e, 0x00, 0x00,	// scientifica U+2282 (⊂)
+	0x00, 0x00, 0x00, 0x0e, 0x42, 0x07, 0x00, 0x00,	// scientifica U+2283 (⊃)
+	0x00, 0x00, 0x80, 0x5c, 0x29, 0x4e, 0x00, 0x00,	// scientifica U+2284 (⊄)
+	0x00, 0x00, 0x10, 0x8e, 0x52, 0x87, 0x00, 0x00,	// scientifica U+2285 (⊅)
+	0x00, 0x00, 0xe0, 0x42, 0x70, 0xe0, 0x01, 0x00,	// scientifica U+2286 (⊆)
+	0x00, 0x00, 0x70, 0x10, 0x3a, 0xe0, 0x01, 0x00,	// scientifica U+2287 (⊇)
+	0x00, 0x00, 0x00, 0x5c, 0xfd, 0xd5, 0x01, 0x00,	// scientifica U+2295 (⊕)
+	0x00, 0x00, 0x00, 0x5c, 0xfc, 0xd1, 0x01, 0x00,	// scientifica U+2296 (⊖)
+	0x00, 0x00, 0x00, 0x5c, 0xac, 0xd1, 0x01, 0x00,	// scientifica U+2299 (⊙)
+	0x00, 0x00, 0x00, 0x7e, 0xfd, 0xf5, 0x03, 0x00,	// scientifica U+229E (⊞)
+	0x00, 0x00, 0x00, 0x7e, 0xfc, 0xf1, 0x03, 0x00,	// scientifica U+229F (⊟)
+	0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x02, 0x00,	// scientifica U+22A0 (⊠)
+	0x00, 0x00, 0x00, 0x7e, 0xac, 0xf1, 0x03, 0x00,	// scientifica U+22A1 (⊡)
+	0x00, 0x00, 0x00, 0x42, 0xf8, 0x21, 0x00, 0x00,	// scientifica U+22A2 (⊢)
+	0x00, 0x00, 0x00, 0x20, 0xfc, 0x10, 0x02, 0x00,	// scientifica U+22A3 (⊣)
+	0x00, 0x00, 0x00, 0x3e, 0x21, 0x84, 0x00, 0x00,	// scientifica U+22A4 (⊤)
+	0x00, 0x00, 0x00, 0x08, 0x21, 0xe4, 0x03, 0x00,	// scientifica U+22A5 (⊥)
+	0x00, 0x00, 0x00, 0x42, 0x38, 0x21, 0x00, 0x00,	// scientifica U+22A6 (⊦)
+	0x00, 0x00, 0x00, 0xc2, 0x09, 0x27, 0x00, 0x00,	// scientifica U+22A7 (⊧)
+	0x00, 0x00, 0x00, 0xc2, 0x0f, 0x3f, 0x00, 0x00,	// scientifica U+22A8 (⊨)
+	0x00, 0x00, 0x00, 0x4a, 0xe9, 0xa5, 0x00, 0x00,	// scientifica U+22A9 (⊩)
+	0x00, 0x00, 0x00, 0x4a, 0x2f, 0xbd, 0x00, 0x00,	// scientifica U+22AB (⊫)
+	0x00, 0x00, 0x00, 0x80, 0x28, 0x02, 0x00, 0x00,	// scientifica U+22C4 (⋄)
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,	// scientifica U+22C5 (⋅)
+	0x00, 0x00, 0x00, 0x40, 0x11, 0x05, 0x00, 0x00,	// scientifica U+22C6 (⋆)
+	0x00, 0x00, 0xb0, 0x05, 0x21, 0x08, 0x03, 0x00,	// scientifica U+2325 (⌥)
+	0x00, 0x22, 0x42, 0x84, 0x10, 0x42, 0x08, 0x01,	// scientifica U+239B (⎛)
+	0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01,	// scientifica U+239C (⎜)
+	0x40, 0x08, 0x21, 0x84, 0x10, 0x84, 0x20, 0x08,	// scientifica U+239D (⎝)
+	0x20, 0x08, 0x42, 0x10, 0x42, 0x08, 0x21, 0x04,	// scientifica U+239E (⎞)
+	0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04,	// scientifica U+239F (⎟)
+	0x00, 0x21, 0x84, 0x10, 0x42, 0x84, 0x88, 0x00,	// scientifica U+23A0 (⎠)
+	0xc0, 0x09, 0x21, 0x84, 0x10, 0x42, 0x08, 0x01,	// scientifica U+23A1 (⎡)
+	0x40, 0x08, 0x21, 0x84, 0x10, 0x42, 0x08, 0x07,	// scientifica U+23A3 (⎣)
+	0xc0, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04,	// scientifica U+23A4 (⎤)
+	0x00, 0x21, 0x84, 0x10, 0x42, 0x08, 0x21, 0x07,	// scientifica U+23A6 (⎦)
+	0x00, 0x13, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02,	// scientifica U+23A7 (⎧)
+	0x80, 0x10, 0x42, 0x06, 0x21, 0x84, 0x10, 0x02,	// scientifica U+23A8 (⎨)
+	0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x0c,	// scientifica U+23A9 (⎩)
+	0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02,	// scientifica U+23AA (⎪)
+	0x60, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10, 0x02,	// scientifica U+23AB (⎫)
+	0x80, 0x10, 0x42, 0x30, 0x21, 0x84, 0x10, 0x02,	// scientifica U+23AC (⎬)
+	0x80, 0x10, 0x42, 0x08, 0x21, 0x84, 0x90, 0x01,	// scientifica U+23AD (⎭)
+	0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// scientifica U+23BA (⎺)
+	0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00,	// scientifica U+23BB (⎻)
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,	// scientifica U+23BC (⎼)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,	// scientifica U+23BD (⎽)
+	0x00, 0x00, 0x00, 0xca, 0xfb, 0xaf, 0x00, 0x00,	// scientifica U+23E9 (⏩)
+	0x00, 0x00, 0x00, 0xa8, 0xff, 0x9e, 0x02, 0x00,	// scientifica U+23EA (⏪)
+	0x00, 0x00, 0x00, 0x88, 0xfb, 0xee, 0x03, 0x00,	// scientifica U+23EB (⏫)
+	0x00, 0x00, 0x00, 0xbe, 0xfb, 0x8e, 0x00, 0x00,	// scientifica U+23EC (⏬)
+	0x00, 0x00, 0x10, 0xc6, 0x19, 0x01, 0x00, 0x00,	// scientifica U+23F4 (⏴)
+	0x00, 0x00, 0x40, 0xcc, 0x31, 0x04, 0x00, 0x00,	// scientifica U+23F5 (⏵)
+	0x00, 0x00, 0x00, 0x00, 0x71, 0x1f, 0x00, 0x00,	// scientifica U+23F6 (⏶)
+	0x00, 0x00, 0x00, 0xc0, 0x77, 0x04, 0x00, 0x00,	// scientifica U+23F7 (⏷)
+	0x00, 0x00, 0x50, 0x4a, 0x29, 0x05, 0x00, 0x00,	// scientifica U+23F8 (⏸)
+	0x00, 0x00, 0x00, 0xce, 0x39, 0x00, 0x00, 0x00,	// scientifica U+23F9 (⏹)
+	0x00, 0x00, 0x00, 0xcc, 0x7b, 0x06, 0x00, 0x00,	// scientifica U+23FA (⏺)
+	0x00, 0x00, 0x42, 0x6a, 0x8d, 0x0e, 0x00, 0x00,	// scientifica U+23FB (⏻)
+	0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2500 (─)
+	0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2501 (━)
+	0xc0, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x03,	// scientifica U+2503 (┃)
+	0x80, 0x10, 0x02, 0x08, 0x21, 0x80, 0x10, 0x02,	// scientifica U+2506 (┆)
+	0xc0, 0x18, 0x03, 0x8c, 0x31, 0xc0, 0x18, 0x03,	// scientifica U+2507 (┇)
+	0x80, 0x10, 0x40, 0x08, 0x20, 0x04, 0x10, 0x02,	// scientifica U+250A (┊)
+	0xc0, 0x18, 0x60, 0x0c, 0x30, 0x06, 0x18, 0x03,	// scientifica U+250B (┋)
+	0x00, 0x00, 0x00, 0x38, 0x21, 0x84, 0x10, 0x02,	// scientifica U+250C (┌)
+	0x00, 0x00, 0xc0, 0x39, 0x21, 0x84, 0x10, 0x02,	// scientifica U+250D (┍)
+	0x00, 0x00, 0x00, 0xbc, 0x73, 0xce, 0x39, 0x07,	// scientifica U+250E (┎)
+	0x00, 0x00, 0xe0, 0xbd, 0x73, 0xce, 0x39, 0x07,	// scientifica U+250F (┏)
+	0x00, 0x00, 0x00, 0x0e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2510 (┐)
+	0x00, 0x00, 0x70, 0x0e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2511 (┑)
+	0x00, 0x00, 0x00, 0x9e, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2512 (┒)
+	0x00, 0x00, 0xf0, 0x9e, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2513 (┓)
+	0x80, 0x10, 0x42, 0x38, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2514 (└)
+	0x80, 0x10, 0xc2, 0x39, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2515 (┕)
+	0xc0, 0x39, 0xe7, 0x3c, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2516 (┖)
+	0xc0, 0x39, 0xe7, 0x3d, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2517 (┗)
+	0x80, 0x10, 0x42, 0x0e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2518 (┘)
+	0x80, 0x10, 0x72, 0x0e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2519 (┙)
+	0xc0, 0x39, 0xe7, 0x1e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+251A (┚)
+	0xc0, 0x39, 0xf7, 0x1e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+251B (┛)
+	0x80, 0x10, 0x42, 0x38, 0x21, 0x84, 0x10, 0x02,	// scientifica U+251C (├)
+	0x80, 0x10, 0xc2, 0x39, 0x21, 0x84, 0x10, 0x02,	// scientifica U+251D (┝)
+	0xc0, 0x39, 0xe7, 0xbc, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2520 (┠)
+	0xc0, 0x39, 0xe7, 0xbd, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2523 (┣)
+	0x80, 0x10, 0x42, 0x0e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2524 (┤)
+	0x80, 0x10, 0x72, 0x0e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2525 (┥)
+	0xc0, 0x39, 0xe7, 0x9e, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2528 (┨)
+	0xc0, 0x39, 0xf7, 0x9e, 0x73, 0xce, 0x39, 0x07,	// scientifica U+252B (┫)
+	0x00, 0x00, 0x00, 0x3e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+252C (┬)
+	0x00, 0x00, 0xf0, 0x3f, 0x21, 0x84, 0x10, 0x02,	// scientifica U+252F (┯)
+	0x00, 0x00, 0x00, 0xbe, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2530 (┰)
+	0x00, 0x00, 0xf0, 0xbf, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2533 (┳)
+	0x80, 0x10, 0x42, 0x3e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2534 (┴)
+	0x80, 0x10, 0xf2, 0x3f, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2537 (┷)
+	0xc0, 0x39, 0xe7, 0x3e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2538 (┸)
+	0xc0, 0x39, 0xf7, 0x3f, 0x00, 0x00, 0x00, 0x00,	// scientifica U+253B (┻)
+	0x80, 0x10, 0x42, 0x3e, 0x21, 0x84, 0x10, 0x02,	// scientifica U+253C (┼)
+	0x80, 0x10, 0x42, 0xfe, 0x27, 0x84, 0x10, 0x02,	// scientifica U+253F (┿)
+	0xc0, 0x39, 0xe7, 0xbe, 0x73, 0xce, 0x39, 0x07,	// scientifica U+2542 (╂)
+	0xc0, 0x39, 0xf7, 0xbf, 0x73, 0xce, 0x39, 0x07,	// scientifica U+254B (╋)
+	0x00, 0x00, 0xf0, 0xc1, 0x07, 0x00, 0x00, 0x00,	// scientifica U+2550 (═)
+	0x40, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2551 (║)
+	0x00, 0x00, 0xc0, 0x09, 0x27, 0x84, 0x10, 0x02,	// scientifica U+2552 (╒)
+	0x00, 0x00, 0x00, 0xbc, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2553 (╓)
+	0x00, 0x00, 0xe0, 0x85, 0x56, 0x4a, 0x29, 0x05,	// scientifica U+2554 (╔)
+	0x00, 0x00, 0x70, 0xc8, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2555 (╕)
+	0x00, 0x00, 0x00, 0x9e, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2556 (╖)
+	0x00, 0x00, 0xf0, 0xd0, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2557 (╗)
+	0x80, 0x10, 0xc2, 0x09, 0x07, 0x00, 0x00, 0x00,	// scientifica U+2558 (╘)
+	0x40, 0x29, 0xa5, 0x3c, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2559 (╙)
+	0x40, 0x29, 0xa5, 0x85, 0x07, 0x00, 0x00, 0x00,	// scientifica U+255A (╚)
+	0x80, 0x10, 0x72, 0xc8, 0x01, 0x00, 0x00, 0x00,	// scientifica U+255B (╛)
+	0x40, 0x29, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+255C (╜)
+	0x40, 0x29, 0xb5, 0xd0, 0x03, 0x00, 0x00, 0x00,	// scientifica U+255D (╝)
+	0x80, 0x10, 0xc2, 0x09, 0x27, 0x84, 0x10, 0x02,	// scientifica U+255E (╞)
+	0x40, 0x29, 0xa5, 0xb4, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+255F (╟)
+	0x40, 0x29, 0xa5, 0x85, 0x56, 0x4a, 0x29, 0x05,	// scientifica U+2560 (╠)
+	0x80, 0x10, 0x72, 0xc8, 0x21, 0x84, 0x10, 0x02,	// scientifica U+2561 (╡)
+	0x40, 0x29, 0xa5, 0x96, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2562 (╢)
+	0x40, 0x29, 0xb5, 0xd0, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2563 (╣)
+	0x00, 0x00, 0xf0, 0xc1, 0x27, 0x84, 0x10, 0x02,	// scientifica U+2564 (╤)
+	0x00, 0x00, 0x00, 0xbe, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+2565 (╥)
+	0x00, 0x00, 0xf0, 0xc1, 0x56, 0x4a, 0x29, 0x05,	// scientifica U+2566 (╦)
+	0x80, 0x10, 0xf2, 0xc1, 0x07, 0x00, 0x00, 0x00,	// scientifica U+2567 (╧)
+	0x40, 0x29, 0xa5, 0x3e, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2568 (╨)
+	0x40, 0x29, 0xb5, 0xc1, 0x07, 0x00, 0x00, 0x00,	// scientifica U+2569 (╩)
+	0x80, 0x10, 0xf2, 0xc9, 0x27, 0x84, 0x10, 0x02,	// scientifica U+256A (╪)
+	0x40, 0x29, 0xa5, 0xbe, 0x52, 0x4a, 0x29, 0x05,	// scientifica U+256B (╫)
+	0x40, 0x29, 0xb5, 0xc1, 0x56, 0x4a, 0x29, 0x05,	// scientifica U+256C (╬)
+	0x00, 0x00, 0x00, 0x30, 0x21, 0x84, 0x10, 0x02,	// scientifica U+256D (╭)
+	0x00, 0x00, 0x00, 0x06, 0x21, 0x84, 0x10, 0x02,	// scientifica U+256E (╮)
+	0x80, 0x10, 0x42, 0x06, 0x00, 0x00, 0x00, 0x00,	// scientifica U+256F (╯)
+	0x80, 0x10, 0x42, 0x30, 0x00, 0x00, 0x00, 0x00,	// scientifica U+2570 (╰)
+	0x00, 0x42, 0x88, 0x10, 0x21, 0x42, 0x84, 0x00,	// scientifica U+2571 (╱)
+	0x20, 0x84, 0x20, 0x04, 0x21, 0x08, 0x41, 0x08,	// scientifica U+2572 (╲)
+	0x20, 0x46, 0xa5, 0x08, 0x21, 0x4a, 0xc5, 0x08,	// scientifica U+2573 (╳)
+	0x00, 0x00, 0xc0, 0x3f, 0x07, 0x00, 0x00, 0x00,	// scientifica U+257C (╼)
+	0x00, 0x00, 0x70, 0xfe, 0x01, 0x00, 0x00, 0x00,	// scientifica U+257E (╾)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00,	// scientifica U+2581 (▁)
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x03, 0x00,	// scientifica U+2582 (▂)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x03, 0x00,	// scientifica U+2583 (▃)
+	0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x03, 0x00,	// scientifica U+2584 (▄)
+	0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x03, 0x00,	// scientifica U+2585 (▅)
+	0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00,	// scientifica U+2586 (▆)
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00,	// scientifica U+2587 (▇)
+	0xe0, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0x01, 0x00,	// scientifica U+2589 (▉)
+	0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04, 0x00,	// scientifica U+258F (▏)
+	0x80, 0x44, 0x12, 0x49, 0x24, 0x91, 0x44, 0x02,	// scientifica U+2591 (░)
+	0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05,	// scientifica U+2592 (▒)
+	0xe0, 0xd7, 0x5f, 0x7f, 0xfd, 0xf5, 0xd7, 0x0f,	// scientifica U+2593 (▓)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0x0f, 0x00, 0x00,	// scientifica U+25A1 (□)
+	0x00, 0x00, 0x00, 0x4c, 0x4a, 0x06, 0x00, 0x00,	// scientifica U+25A2 (▢)
+	0x00, 0x00, 0x00, 0xde, 0x7b, 0x0f, 0x00, 0x00,	// scientifica U+25AA (▪)
+	0x00, 0x00, 0x40, 0x88, 0x73, 0x1f, 0x00, 0x00,	// scientifica U+25B2 (▲)
+	0x00, 0x00, 0x40, 0x88, 0x52, 0x1f, 0x00, 0x00,	// scientifica U+25B3 (△)
+	0x00, 0x00, 0x00, 0x00, 0x51, 0x1f, 0x00, 0x00,	// scientifica U+25B5 (▵)
+	0x00, 0x00, 0x00, 0xc2, 0xf9, 0x27, 0x00, 0x00,	// scientifica U+25B6 (▶)
+	0x00, 0x00, 0x00, 0xc2, 0xc9, 0x27, 0x00, 0x00,	// scientifica U+25B7 (▷)
+	0x00, 0x00, 0x00, 0xc2, 0x38, 0x23, 0x00, 0x00,	// scientifica U+25B8 (▸)
+	0x00, 0x00, 0x00, 0xc2, 0x28, 0x23, 0x00, 0x00,	// scientifica U+25B9 (▹)
+	0x00, 0x00, 0x00, 0xc0, 0x57, 0x04, 0x00, 0x00,	// scientifica U+25BD (▽)
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00,	// scientifica U+25BE (▾)
+	0x00, 0x00, 0x00, 0x20, 0xff, 0x1c, 0x02, 0x00,	// scientifica U+25C0 (◀)
+	0x00, 0x00, 0x00, 0x20, 0x9f, 0x1c, 0x02, 0x00,	// scientifica U+25C1 (◁)
+	0x00, 0x00, 0x00, 0x88, 0x39, 0x86, 0x00, 0x00,	// scientifica U+25C2 (◂)
+	0x00, 0x00, 0x00, 0x88, 0x29, 0x86, 0x00, 0x00,	// scientifica U+25C3 (◃)
+	0x00, 0x00, 0xe0, 0x62, 0x8c, 0x0e, 0x00, 0x00,	// scientifica U+25CB (○)
+	0x00, 0x00, 0xe0, 0x62, 0x8d, 0x0e, 0x00, 0x00,	// scientifica U+25CE (◎)
+	0x00, 0x00, 0xe0, 0xfe, 0xff, 0x0e, 0x00, 0x00,	// scientifica U+25CF (●)
+	0x00, 0x00, 0xe0, 0xee, 0xbd, 0x0e, 0x00, 0x00,	// scientifica U+25D0 (◐)
+	0x00, 0x00, 0xe0, 0x7a, 0xef, 0x0e, 0x00, 0x00,	// scientifica U+25D1 (◑)
+	0x00, 0x00, 0xe0, 0xe2, 0xff, 0x0e, 0x00, 0x00,	// scientifica U+25D2 (◒)
+	0x00, 0x00, 0xe0, 0xfe, 0x8f, 0x0e, 0x00, 0x00,	// scientifica U+25D3 (◓)
+	0x00, 0x00, 0xe0, 0x7a, 0x8f, 0x0e, 0x00, 0x00,	// scientifica U+25D4 (◔)
+	0x00, 0x00, 0xe0, 0x72, 0xfe, 0x0e, 0x00, 0x00,	// scientifica U+25D5 (◕)
+	0x00, 0x00, 0x20, 0xc6, 0x18, 0x02, 0x00, 0x00,	// scientifica U+25D6 (◖)
+	0x00, 0x00, 0x80, 0x30, 0xc6, 0x08, 0x00, 0x00,	// scientifica U+25D7 (◗)
+	0x00, 0x00, 0x00, 0xfe, 0xbd, 0xf7, 0x03, 0x00,	// scientifica U+25E7 (◧)
+	0x00, 0x00, 0x00, 0x7e, 0xef, 0xfd, 0x03, 0x00,	// scientifica U+25E8 (◨)
+	0x00, 0x00, 0x00, 0xfe, 0xbf, 0xf3, 0x03, 0x00,	// scientifica U+25E9 (◩)
+	0x00, 0x00, 0x00, 0x7e, 0xee, 0xff, 0x03, 0x00,	// scientifica U+25EA (◪)
+	0x00, 0x00, 0x00, 0x7e, 0xad, 0xf5, 0x03, 0x00,	// scientifica U+25EB (◫)
+	0x00, 0x00, 0x00, 0x7e, 0xbd, 0xf1, 0x03, 0x00,	// scientifica U+25F0 (◰)
+	0x00, 0x00, 0x00, 0x7e, 0xbc, 0xf5, 0x03, 0x00,	// scientifica U+25F1 (◱)
+	0x00, 0x00, 0x00, 0x7e, 0xec, 0xf5, 0x03, 0x00,	// scientifica U+25F2 (◲)
+	0x00, 0x00, 0x00, 0x7e, 0xed, 0xf1, 0x03, 0x00,	// scientifica U+25F3 (◳)
+	0x00, 0x00, 0x40, 0xaa, 0xfb, 0xae, 0x12, 0x00,	// scientifica U+2600 (☀)
+	0x00, 0x00, 0x00, 0x8c, 0xfb, 0x1f, 0x00, 0x00,	// scientifica U+2601 (☁)
+	0x00, 0x00, 0xf7, 0x3f, 0x21, 0xa5, 0x08, 0x00,	// scientifica U+2602 (☂)
+	0x00, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x03, 0x00,	// scientifica U+2630 (☰)
+	0x00, 0x80, 0x0d, 0xc0, 0x07, 0xe0, 0x03, 0x00,	// scientifica U+2631 (☱)
+	0x00, 0x80, 0x0f, 0xc0, 0x06, 0xe0, 0x03, 0x00,	// scientifica U+2632 (☲)
+	0x00, 0x80, 0x0d, 0xc0, 0x06, 0xe0, 0x03, 0x00,	// scientifica U+2633 (☳)
+	0x00, 0x80, 0x0f, 0xc0, 0x07, 0x60, 0x03, 0x00,	// scientifica U+2634 (☴)
+	0x00, 0x80, 0x0d, 0xc0, 0x07, 0x60, 0x03, 0x00,	// scientifica U+2635 (☵)
+	0x00, 0x80, 0x0f, 0xc0, 0x06, 0x60, 0x03, 0x00,	// scientifica U+2636 (☶)
+	0x00, 0x80, 0x0d, 0xc0, 0x06, 0x60, 0x03, 0x00,	// scientifica U+2637 (☷)
+	0x00, 0x00, 0x00, 0x54, 0x8d, 0x8a, 0x00, 0x00,	// scientifica U+2661 (♡)
+	0x00, 0x00, 0x00, 0xd4, 0xff, 0x8e, 0x00, 0x00,	// scientifica U+2665 (♥)
+	0x00, 0x00, 0x00, 0x88, 0xfb, 0x8e, 0x00, 0x00,	// scientifica U+2666 (♦)
+	0x00, 0x08, 0x21, 0x84, 0x10, 0x63, 0x00, 0x00,	// scientifica U+2669 (♩)
+	0x00, 0x08, 0xa3, 0x84, 0x10, 0x63, 0x00, 0x00,	// scientifica U+266A (♪)
+	0x00, 0x18, 0x2d, 0xa5, 0x9c, 0x1b, 0x03, 0x00,	// scientifica U+266B (♫)
+	0x00, 0x48, 0x2f, 0xbd, 0x94, 0x7b, 0x03, 0x00,	// scientifica U+266C (♬)
+	0x00, 0x00, 0x00, 0x88, 0x02, 0x71, 0x03, 0x00,	// scientifica U+267A (♺)
+	0x00, 0x00, 0x00, 0x21, 0x4a, 0x86, 0x00, 0x00,	// scientifica U+2713 (✓)
+	0x00, 0x00, 0x08, 0x71, 0x7a, 0x86, 0x00, 0x00,	// scientifica U+2714 (✔)
+	0x00, 0x00, 0x00, 0xf6, 0x77, 0x7f, 0x03, 0x00,	// scientifica U+2716 (✖)
+	0x00, 0x20, 0x54, 0x8c, 0x31, 0x29, 0x01, 0x00,	// scientifica U+2717 (✗)
+	0x00, 0x20, 0x54, 0x8a, 0x31, 0x29, 0x01, 0x00,	// scientifica U+2718 (✘)
+	0x00, 0x00, 0x40, 0xc8, 0x77, 0x2e, 0x02, 0x00,	// scientifica U+272E (✮)
+	0x00, 0x00, 0xb2, 0xab, 0xab, 0x9b, 0x00, 0x00,	// scientifica U+2744 (❄)
+	0x00, 0x00, 0xcc, 0xcc, 0x30, 0x0c, 0x03, 0x00,	// scientifica U+276E (❮)
+	0x00, 0x80, 0x61, 0x18, 0x66, 0x66, 0x00, 0x00,	// scientifica U+276F (❯)
+	0x00, 0x00, 0xee, 0xce, 0x38, 0x8e, 0x03, 0x00,	// scientifica U+2770 (❰)
+	0x00, 0x80, 0xe3, 0x38, 0xe6, 0xee, 0x00, 0x00,	// scientifica U+2771 (❱)
+	0x00, 0x00, 0x00, 0x84, 0x10, 0xe2, 0x00, 0x00,	// scientifica U+27C2 (⟂)
+	0x00, 0x00, 0x00, 0x5c, 0x28, 0xc1, 0x01, 0x00,	// scientifica U+27C3 (⟃)
+	0x00, 0x00, 0x00, 0x0e, 0x52, 0xe8, 0x00, 0x00,	// scientifica U+27C4 (⟄)
+	0x00, 0x00, 0x42, 0x08, 0x21, 0xe4, 0x03, 0x00,	// scientifica U+27D8 (⟘)
+	0x00, 0x00, 0x00, 0x80, 0xe8, 0x02, 0x00, 0x00,	// scientifica U+27DC (⟜)
+	0x00, 0x00, 0x00, 0x40, 0xf8, 0x01, 0x00, 0x00,	// scientifica U+27DD (⟝)
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0x10, 0x00, 0x00,	// scientifica U+27DE (⟞)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x80, 0x00,	// scientifica U+2864 (⡤)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0xa0, 0x80, 0x00,	// scientifica U+2865 (⡥)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x80, 0x00,	// scientifica U+2866 (⡦)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0xa0, 0x80, 0x00,	// scientifica U+2867 (⡧)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x80, 0x00,	// scientifica U+2868 (⡨)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x80, 0x00,	// scientifica U+2869 (⡩)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x80, 0x80, 0x00,	// scientifica U+286A (⡪)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x80, 0x80, 0x00,	// scientifica U+286B (⡫)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0xa0, 0x80, 0x00,	// scientifica U+286C (⡬)
+	0x00, 0x00, 0x00, 0x40, 0x01, 0xa0, 0x80, 0x00,	// scientifica U+286D (⡭)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0xa0, 0x80, 0x00,	// scientifica U+286E (⡮)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0xa0, 0x80, 0x00,	// scientifica U+286F (⡯)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x80, 0x00,	// scientifica U+2870 (⡰)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x80, 0x80, 0x00,	// scientifica U+2871 (⡱)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0x80, 0x00,	// scientifica U+2872 (⡲)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x80, 0x80, 0x00,	// scientifica U+2873 (⡳)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xa0, 0x80, 0x00,	// scientifica U+2874 (⡴)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0xa0, 0x80, 0x00,	// scientifica U+2875 (⡵)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0xa0, 0x80, 0x00,	// scientifica U+2876 (⡶)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0xa0, 0x80, 0x00,	// scientifica U+2877 (⡷)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0x80, 0x80, 0x00,	// scientifica U+2878 (⡸)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x80, 0x80, 0x00,	// scientifica U+2879 (⡹)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x80, 0x80, 0x00,	// scientifica U+287A (⡺)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x80, 0x80, 0x00,	// scientifica U+287B (⡻)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0xa0, 0x80, 0x00,	// scientifica U+287C (⡼)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0xa0, 0x80, 0x00,	// scientifica U+287D (⡽)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0xa0, 0x80, 0x00,	// scientifica U+287E (⡾)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0xa0, 0x80, 0x00,	// scientifica U+287F (⡿)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,	// scientifica U+2880 (⢀)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,	// scientifica U+2881 (⢁)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x02,	// scientifica U+2882 (⢂)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02,	// scientifica U+2883 (⢃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02,	// scientifica U+2884 (⢄)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x02,	// scientifica U+2885 (⢅)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x02,	// scientifica U+2886 (⢆)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x20, 0x00, 0x02,	// scientifica U+2887 (⢇)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x00,	// scientifica U+2888 (⢈)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02,	// scientifica U+2889 (⢉)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x02,	// scientifica U+288A (⢊)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x00, 0x02,	// scientifica U+288B (⢋)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x02,	// scientifica U+288C (⢌)
+	0x00, 0x00, 0x00, 0x40, 0x01, 0x20, 0x00, 0x02,	// scientifica U+288D (⢍)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x20, 0x00, 0x02,	// scientifica U+288E (⢎)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x20, 0x00, 0x02,	// scientifica U+288F (⢏)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00,	// scientifica U+2890 (⢐)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02,	// scientifica U+2891 (⢑)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x02,	// scientifica U+2892 (⢒)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x00, 0x02,	// scientifica U+2893 (⢓)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x02,	// scientifica U+2894 (⢔)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x20, 0x00, 0x02,	// scientifica U+2895 (⢕)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x00, 0x02,	// scientifica U+2896 (⢖)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x20, 0x00, 0x02,	// scientifica U+2897 (⢗)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x80, 0x00,	// scientifica U+2898 (⢘)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x00, 0x02,	// scientifica U+2899 (⢙)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x00, 0x00, 0x02,	// scientifica U+289A (⢚)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x00, 0x02,	// scientifica U+289B (⢛)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0x20, 0x00, 0x02,	// scientifica U+289C (⢜)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x20, 0x00, 0x02,	// scientifica U+289D (⢝)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x20, 0x00, 0x02,	// scientifica U+289E (⢞)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x20, 0x00, 0x02,	// scientifica U+289F (⢟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00,	// scientifica U+28A0 (⢠)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x02,	// scientifica U+28A1 (⢡)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x02,	// scientifica U+28A2 (⢢)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x80, 0x00, 0x02,	// scientifica U+28A3 (⢣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x02,	// scientifica U+28A4 (⢤)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x02,	// scientifica U+28A5 (⢥)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x00, 0x02,	// scientifica U+28A6 (⢦)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0xa0, 0x00, 0x02,	// scientifica U+28A7 (⢧)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x80, 0x00,	// scientifica U+28A8 (⢨)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x02,	// scientifica U+28A9 (⢩)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x80, 0x00, 0x02,	// scientifica U+28AA (⢪)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x80, 0x00, 0x02,	// scientifica U+28AB (⢫)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0xa0, 0x00, 0x02,	// scientifica U+28AC (⢬)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0xa0, 0x00, 0x02,	// scientifica U+28AD (⢭)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0xa0, 0x00, 0x02,	// scientifica U+28AE (⢮)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0xa0, 0x00, 0x02,	// scientifica U+28AF (⢯)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x00, 0x02,	// scientifica U+28B0 (⢰)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x80, 0x00, 0x02,	// scientifica U+28B1 (⢱)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0x00, 0x02,	// scientifica U+28B2 (⢲)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x80, 0x00, 0x02,	// scientifica U+28B3 (⢳)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xa0, 0x00, 0x02,	// scientifica U+28B4 (⢴)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0xa0, 0x00, 0x02,	// scientifica U+28B5 (⢵)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0xa0, 0x00, 0x02,	// scientifica U+28B6 (⢶)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0xa0, 0x00, 0x02,	// scientifica U+28B7 (⢷)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x20, 0x80, 0x00,	// scientifica U+28B8 (⢸)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x80, 0x00, 0x02,	// scientifica U+28B9 (⢹)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x80, 0x00, 0x02,	// scientifica U+28BA (⢺)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x80, 0x00, 0x02,	// scientifica U+28BB (⢻)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0xa0, 0x00, 0x02,	// scientifica U+28BC (⢼)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0xa0, 0x00, 0x02,	// scientifica U+28BD (⢽)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0xa0, 0x00, 0x02,	// scientifica U+28BE (⢾)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0xa0, 0x00, 0x02,	// scientifica U+28BF (⢿)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02,	// scientifica U+28C0 (⣀)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02,	// scientifica U+28C1 (⣁)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x02,	// scientifica U+28C2 (⣂)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x80, 0x02,	// scientifica U+28C3 (⣃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x02,	// scientifica U+28C4 (⣄)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x80, 0x02,	// scientifica U+28C5 (⣅)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x80, 0x02,	// scientifica U+28C6 (⣆)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x20, 0x80, 0x02,	// scientifica U+28C7 (⣇)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x02,	// scientifica U+28C8 (⣈)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x80, 0x02,	// scientifica U+28C9 (⣉)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x80, 0x02,	// scientifica U+28CA (⣊)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x00, 0x80, 0x02,	// scientifica U+28CB (⣋)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x80, 0x02,	// scientifica U+28CC (⣌)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x20, 0x80, 0x02,	// scientifica U+28CD (⣍)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x20, 0x80, 0x02,	// scientifica U+28CE (⣎)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x20, 0x80, 0x02,	// scientifica U+28CF (⣏)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x02,	// scientifica U+28D0 (⣐)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x80, 0x02,	// scientifica U+28D1 (⣑)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x02,	// scientifica U+28D2 (⣒)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x00, 0x80, 0x02,	// scientifica U+28D3 (⣓)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x80, 0x02,	// scientifica U+28D4 (⣔)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x20, 0x80, 0x02,	// scientifica U+28D5 (⣕)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x80, 0x02,	// scientifica U+28D6 (⣖)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x20, 0x80, 0x02,	// scientifica U+28D7 (⣗)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x80, 0x02,	// scientifica U+28D8 (⣘)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x80, 0x02,	// scientifica U+28D9 (⣙)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x00, 0x80, 0x02,	// scientifica U+28DA (⣚)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x00, 0x80, 0x02,	// scientifica U+28DB (⣛)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0x20, 0x80, 0x02,	// scientifica U+28DC (⣜)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x20, 0x80, 0x02,	// scientifica U+28DD (⣝)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x20, 0x80, 0x02,	// scientifica U+28DE (⣞)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x20, 0x80, 0x02,	// scientifica U+28DF (⣟)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x02,	// scientifica U+28E0 (⣠)
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x80, 0x80, 0x02,	// scientifica U+28E1 (⣡)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 0x02,	// scientifica U+28E2 (⣢)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0x80, 0x80, 0x02,	// scientifica U+28E3 (⣣)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x80, 0x02,	// scientifica U+28E4 (⣤)
+	0x00, 0x00, 0x00, 0x40, 0x00, 0xa0, 0x80, 0x02,	// scientifica U+28E5 (⣥)
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xa0, 0x80, 0x02,	// scientifica U+28E6 (⣦)
+	0x00, 0x00, 0x00, 0x02, 0x08, 0xa0, 0x80, 0x02,	// scientifica U+28E7 (⣧)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x80, 0x02,	// scientifica U+28E8 (⣨)
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x80, 0x02,	// scientifica U+28E9 (⣩)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x80, 0x80, 0x02,	// scientifica U+28EA (⣪)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0x80, 0x80, 0x02,	// scientifica U+28EB (⣫)
+	0x00, 0x00, 0x00, 0x08, 0x00, 0xa0, 0x80, 0x02,	// scientifica U+28EC (⣬)
+	0x00, 0x00, 0x00, 0x40, 0x01, 0xa0, 0x80, 0x02,	// scientifica U+28ED (⣭)
+	0x00, 0x00, 0x00, 0x08, 0x08, 0xa0, 0x80, 0x02,	// scientifica U+28EE (⣮)
+	0x00, 0x00, 0x00, 0x0a, 0x08, 0xa0, 0x80, 0x02,	// scientifica U+28EF (⣯)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x80, 0x80, 0x02,	// scientifica U+28F0 (⣰)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0x80, 0x80, 0x02,	// scientifica U+28F1 (⣱)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0x80, 0x02,	// scientifica U+28F2 (⣲)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0x80, 0x80, 0x02,	// scientifica U+28F3 (⣳)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xa0, 0x80, 0x02,	// scientifica U+28F4 (⣴)
+	0x00, 0x00, 0x00, 0x02, 0x20, 0xa0, 0x80, 0x02,	// scientifica U+28F5 (⣵)
+	0x00, 0x00, 0x00, 0x00, 0x28, 0xa0, 0x80, 0x02,	// scientifica U+28F6 (⣶)
+	0x00, 0x00, 0x00, 0x02, 0x28, 0xa0, 0x80, 0x02,	// scientifica U+28F7 (⣷)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0x80, 0x80, 0x02,	// scientifica U+28F8 (⣸)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0x80, 0x80, 0x02,	// scientifica U+28F9 (⣹)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0x80, 0x80, 0x02,	// scientifica U+28FA (⣺)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0x80, 0x80, 0x02,	// scientifica U+28FB (⣻)
+	0x00, 0x00, 0x00, 0x08, 0x20, 0xa0, 0x80, 0x02,	// scientifica U+28FC (⣼)
+	0x00, 0x00, 0x00, 0x0a, 0x20, 0xa0, 0x80, 0x02,	// scientifica U+28FD (⣽)
+	0x00, 0x00, 0x00, 0x08, 0x28, 0xa0, 0x80, 0x02,	// scientifica U+28FE (⣾)
+	0x00, 0x00, 0x00, 0x0a, 0x28, 0xa0, 0x80, 0x02,	// scientifica U+28FF (⣿)
+	0x00, 0x00, 0x00, 0x20, 0x3a, 0x08, 0x02, 0x00,	// scientifica U+2919 (⤙)
+	0x00, 0x00, 0x00, 0x82, 0xe0, 0x22, 0x00, 0x00,	// scientifica U+291A (⤚)
+	0x00, 0x00, 0x00, 0x64, 0x22, 0x49, 0x02, 0x00,	// scientifica U+291B (⤛)
+	0x00, 0x00, 0x00, 0x92, 0x24, 0x32, 0x01, 0x00,	// scientifica U+291C (⤜)
+	0x00, 0x00, 0x00, 0x3e, 0xf8, 0x00, 0x00, 0x00,	// scientifica U+2B5E (⭞)
+	0x20, 0x84, 0xf2, 0x4a, 0x39, 0x21, 0x00, 0x00,	// scientifica U+2B60 (⭠)
+	0x20, 0x84, 0x70, 0x80, 0x51, 0x4a, 0x01, 0x00,	// scientifica U+2B61 (⭡)
+	0x00, 0x18, 0x31, 0x94, 0x5e, 0x08, 0x03, 0x00,	// scientifica U+2B62 (⭢)
+	0x00, 0x00, 0x93, 0xd2, 0x7b, 0xeb, 0x01, 0x00,	// scientifica U+2B64 (⭤)
+	0x20, 0x8c, 0xf3, 0xfe, 0x3b, 0x23, 0x00, 0x00,	// scientifica U+2B80 (⮀)
+	0x20, 0x08, 0x82, 0x20, 0x22, 0x22, 0x00, 0x00,	// scientifica U+2B81 (⮁)
+	0x00, 0x62, 0xee, 0xbf, 0xe7, 0x18, 0x02, 0x00,	// scientifica U+2B82 (⮂)
+	0x00, 0x22, 0x22, 0x82, 0x20, 0x08, 0x02, 0x00,	// scientifica U+2B83 (⮃)
+	0x00, 0x00, 0x00, 0x40, 0x02, 0xc9, 0x00, 0x00,	// scientifica U+30C3 (ッ)
+	0x00, 0x00, 0x90, 0x00, 0x48, 0xc9, 0x00, 0x00,	// scientifica U+30C4 (ツ)
+	0x00, 0x80, 0x5e, 0xca, 0xa7, 0xf4, 0x02, 0x00,	// scientifica U+5350 (卐)
+	0x00, 0x00, 0x00, 0xc0, 0x07, 0x1f, 0x00, 0x00,	// scientifica U+E09E ()
+	0x00, 0x84, 0xd2, 0x4a, 0x19, 0x21, 0x00, 0x00,	// scientifica U+E0A0 ()
+	0x00, 0x00, 0x93, 0xd2, 0x5b, 0xeb, 0x01, 0x00,	// scientifica U+E0A2 ()
+	0x00, 0x84, 0x71, 0xde, 0x7f, 0x67, 0x04, 0x00,	// scientifica U+E0B0 ()
+	0x00, 0x04, 0x41, 0x10, 0x44, 0x44, 0x04, 0x00,	// scientifica U+E0B1 ()
+	0x00, 0x40, 0xcc, 0xfd, 0xf7, 0x1c, 0x43, 0x00,	// scientifica U+E0B2 ()
+	0x00, 0x40, 0x44, 0x44, 0x10, 0x04, 0x41, 0x00,	// scientifica U+E0B3 ()
+	0xe0, 0x7b, 0x8e, 0x21, 0x80, 0x98, 0xfb, 0x0f,	// scientifica U+E0B4 ()
+	0xe0, 0xbf, 0x33, 0x02, 0x08, 0xe3, 0xbc, 0x0f,	// scientifica U+E0B5 ()
+	0x00, 0x00, 0x00, 0x44, 0x51, 0x55, 0x02, 0x00,	// scientifica U+E0C0 ()
+	0x00, 0x00, 0x00, 0x08, 0x82, 0x88, 0x00, 0x00,	// scientifica U+E0C1 ()
+	0x00, 0x00, 0xa5, 0xbe, 0x73, 0x84, 0x10, 0x00,	// scientifica U+E0C2 ()
+	0x00, 0x00, 0x00, 0x82, 0x07, 0x3e, 0x00, 0x00,	// scientifica U+E0C3 ()
+	0x00, 0x00, 0x00, 0x8a, 0x26, 0xba, 0x00, 0x00,	// scientifica U+E0C4 ()
+	0x00, 0x00, 0x00, 0xe0, 0x03, 0x0f, 0x02, 0x00,	// scientifica U+E0C5 ()
+	0x00, 0x00, 0x00, 0xe8, 0x22, 0x8b, 0x02, 0x00,	// scientifica U+E0C6 ()
+	0x00, 0x00, 0x00, 0xde, 0x4b, 0xe9, 0x01, 0x00,	// scientifica U+F031 ()
+	0x00, 0x00, 0x00, 0x80, 0x7a, 0x0a, 0x00, 0x00,	// scientifica U+F037 ()
+	0x00, 0x00, 0x00, 0x40, 0x79, 0x05, 0x00, 0x00,	// scientifica U+F038 ()
+	0x00, 0x00, 0x00, 0x42, 0xfd, 0x35, 0x00, 0x00,	// scientifica U+F039 ()
+	0x00, 0x00, 0x00, 0x60, 0xfd, 0x15, 0x02, 0x00,	// scientifica U+F03A ()
+	0x00, 0x00, 0x00, 0x40, 0x29, 0xa5, 0x00, 0x00,	// scientifica U+F03B ()
+	0x00, 0x00, 0x00, 0xc0, 0x7b, 0xef, 0x01, 0x00,	// scientifica U+F03C ()
+	0x00, 0x00, 0x00, 0x80, 0x79, 0xcf, 0x00, 0x00,	// scientifica U+F03D ()
+	0x00, 0x00, 0x10, 0xc6, 0x7b, 0x6f, 0x04, 0x00,	// scientifica U+F057 ()
+	0x00, 0x00, 0x80, 0xd8, 0x7b, 0x8f, 0x21, 0x00,	// scientifica U+F058 ()
+	0x00, 0x00, 0x00, 0x00, 0xdc, 0x8e, 0x00, 0x00,	// scientifica U+F061 ()
+	0x00, 0x00, 0xf3, 0x72, 0x66, 0xc6, 0x00, 0x03,	// scientifica U+F073 ()
+	0x00, 0x00, 0x00, 0xdc, 0xac, 0xd9, 0x01, 0x00,	// scientifica U+F078 ()
+	0x00, 0x00, 0x80, 0x88, 0x3b, 0x22, 0x00, 0x00,	// scientifica U+F07E ()
+	0x00, 0x98, 0x84, 0xd0, 0x5b, 0xeb, 0x01, 0x00,	// scientifica U+F0D0 ()
+	0x00, 0x00, 0x60, 0x8c, 0x10, 0xa2, 0x08, 0x00,	// scientifica U+F0D1 ()
+	0x00, 0x00, 0x22, 0x5f, 0x4e, 0xaf, 0x02, 0x00,	// scientifica U+F0D5 ()
+	0x00, 0xa0, 0x22, 0x5f, 0xee, 0xff, 0x03, 0x00,	// scientifica U+F0D6 ()
+	0x00, 0x00, 0x60, 0x72, 0xf7, 0x00, 0x00, 0x00,	// scientifica U+F0D7 ()
+	0x00, 0x00, 0x60, 0x72, 0xf7, 0x80, 0x2a, 0x00,	// scientifica U+F0D8 ()
+	0x00, 0x00, 0x80, 0xfc, 0x07, 0x00, 0x00, 0x00,	// scientifica U+F0D9 ()
+	0x00, 0x00, 0x80, 0xfc, 0x07, 0x15, 0x28, 0x00,	// scientifica U+F0DA ()
+	0x00, 0x00, 0x80, 0xfc, 0x07, 0x55, 0x01, 0x00,	// scientifica U+F0DB ()
+	0x00, 0x00, 0x80, 0xfc, 0x47, 0x8c, 0x08, 0x00,	// scientifica U+F0DC ()
+	0x00, 0xa8, 0x02, 0x10, 0x05, 0xaa, 0x00, 0x00,	// scientifica U+F0DE ()
+	0x00, 0x00, 0x00, 0x5c, 0xcf, 0xd9, 0x01, 0x00,	// scientifica U+F0E0 ()
+	0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 0x01, 0x00,	// scientifica U+F0ED ()
+	0x00, 0xa8, 0x48, 0x08, 0x00, 0x00, 0x00, 0x00,	// scientifica U+F0EE ()
+	0x00, 0x00, 0x40, 0x10, 0x30, 0x00, 0x11, 0x00,	// scientifica U+F0EF ()
+	0x00, 0x00, 0x20, 0x02, 0x30, 0x20, 0x08, 0x00,	// scientifica U+F0F0 ()
+	0x00, 0x10, 0xf2, 0xc3, 0x87, 0x9f, 0x10, 0x00,	// scientificab U+0024 ($)
+	0x00, 0x80, 0x13, 0xd2, 0x4f, 0xe9, 0x03, 0x00,	// scientificab U+0026 (&)
+	0x00, 0x80, 0x97, 0x56, 0x6a, 0xe9, 0x01, 0x00,	// scientificab U+0030 (0)
+	0x00, 0x80, 0x87, 0xd0, 0x0b, 0xe1, 0x01, 0x00,	// scientificab U+0032 (2)
+	0x00, 0x80, 0x52, 0x4a, 0x79, 0x84, 0x00, 0x00,	// scientificab U+0034 (4)
+	0x00, 0x80, 0x17, 0x1e, 0x42, 0xe9, 0x01, 0x00,	// scientificab U+0035 (5)
+	0x00, 0x80, 0x17, 0xc2, 0x4b, 0xe9, 0x01, 0x00,	// scientificab U+0036 (6)
+	0x00, 0x80, 0x97, 0x10, 0x42, 0x08, 0x01, 0x00,	// scientificab U+0037 (7)
+	0x00, 0x80, 0x97, 0xd2, 0x4b, 0xe9, 0x01, 0x00,	// scientificab U+0038 (8)
+	0x00, 0x80, 0x97, 0xd2, 0x43, 0xe8, 0x01, 0x00,	// scientificab U+0039 (9)
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00,	// scientificab U+003A (:)
+	0x00, 0x00, 0x40, 0x44, 0x10, 0x04, 0x00, 0x00,	// scientificab U+003C (<)
+	0x00, 0x00, 0x00, 0x1e, 0x78, 0x00, 0x00, 0x00,	// scientificab U+003D (=)
+	0x00, 0x00, 0x20, 0x08, 0x22, 0x02, 0x00, 0x00,	// scientificab U+003E (>)
+	0x00, 0x80, 0x97, 0x90, 0x13, 0x40, 0x00, 0x00,	// scientificab U+003F (?)
+	0x00, 0x80, 0x97, 0x5a, 0x6b, 0xe1, 0x01, 0x00,	// scientificab U+0040 (@)
+	0x00, 0x80, 0x97, 0xd2, 0x4b, 0x29, 0x01, 0x00,	// scientificab U+0041 (A)
+	0x00, 0x80, 0x53, 0xca, 0x4b, 0xe9, 0x01, 0x00,	// scientificab U+0042 (B)
+	0x00, 0x80, 0x97, 0x42, 0x08, 0xe9, 0x01, 0x00,	// scientificab U+0043 (C)
+	0x00, 0x80, 0x97, 0x42, 0x4b, 0xe9, 0x01, 0x00,	// scientificab U+0047 (G)
+	0x00, 0x00, 0x87, 0x10, 0x42, 0xe9, 0x01, 0x00,	// scientificab U+004A (J)
+	0x00, 0x80, 0x94, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientificab U+004B (K)
+	0x00, 0x80, 0x97, 0x52, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+004F (O)
+	0x00, 0x80, 0x97, 0xd2, 0x0b, 0x21, 0x00, 0x00,	// scientificab U+0050 (P)
+	0x00, 0x80, 0x97, 0x52, 0x4a, 0xe9, 0x11, 0x02,	// scientificab U+0051 (Q)
+	0x00, 0x80, 0x97, 0xd2, 0x49, 0x29, 0x01, 0x00,	// scientificab U+0052 (R)
+	0x00, 0x80, 0x97, 0xc2, 0x43, 0xe9, 0x01, 0x00,	// scientificab U+0053 (S)
+	0x00, 0x80, 0x94, 0x52, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+0055 (U)
+	0x00, 0x80, 0x94, 0xd2, 0x43, 0xe9, 0x01, 0x00,	// scientificab U+0059 (Y)
+	0x00, 0x80, 0x97, 0x88, 0x11, 0xe9, 0x01, 0x00,	// scientificab U+005A (Z)
+	0x00, 0x18, 0x21, 0x84, 0x10, 0x42, 0x18, 0x00,	// scientificab U+005B ([)
+	0x00, 0x18, 0x42, 0x08, 0x21, 0x84, 0x18, 0x00,	// scientificab U+005D (])
+	0x00, 0x00, 0x00, 0x1e, 0x7a, 0xe9, 0x03, 0x00,	// scientificab U+0061 (a)
+	0x00, 0x80, 0x10, 0x5e, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+0062 (b)
+	0x00, 0x00, 0x00, 0x5e, 0x08, 0xe1, 0x01, 0x00,	// scientificab U+0063 (c)
+	0x00, 0x00, 0x84, 0x5e, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+0064 (d)
+	0x00, 0x00, 0x00, 0x5e, 0x7a, 0xe1, 0x01, 0x00,	// scientificab U+0065 (e)
+	0x00, 0x00, 0x27, 0xc4, 0x11, 0x42, 0x00, 0x00,	// scientificab U+0066 (f)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0xe9, 0xa1, 0x07,	// scientificab U+0067 (g)
+	0x00, 0x80, 0x10, 0x5e, 0x4a, 0x29, 0x01, 0x00,	// scientificab U+0068 (h)
+	0x00, 0x00, 0x01, 0x86, 0x10, 0xe2, 0x00, 0x00,	// scientificab U+0069 (i)
+	0x00, 0x00, 0x02, 0x0e, 0x21, 0x84, 0x90, 0x03,	// scientificab U+006A (j)
+	0x00, 0x80, 0x10, 0x52, 0x3a, 0x29, 0x01, 0x00,	// scientificab U+006B (k)
+	0x00, 0x80, 0x21, 0x84, 0x10, 0xc2, 0x00, 0x00,	// scientificab U+006C (l)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0x29, 0x01, 0x00,	// scientificab U+006E (n)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+006F (o)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0xe9, 0x85, 0x00,	// scientificab U+0070 (p)
+	0x00, 0x00, 0x00, 0x5e, 0x4a, 0xe9, 0x21, 0x04,	// scientificab U+0071 (q)
+	0x00, 0x00, 0x00, 0x5e, 0x0a, 0x21, 0x00, 0x00,	// scientificab U+0072 (r)
+	0x00, 0x00, 0x00, 0x5e, 0x78, 0xe8, 0x01, 0x00,	// scientificab U+0073 (s)
+	0x00, 0x00, 0x21, 0x8e, 0x10, 0xc2, 0x00, 0x00,	// scientificab U+0074 (t)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xe9, 0x01, 0x00,	// scientificab U+0075 (u)
+	0x00, 0x00, 0x00, 0x52, 0x4a, 0xe9, 0xa1, 0x07,	// scientificab U+0079 (y)
+	0x00, 0x00, 0x00, 0x1e, 0x7a, 0xe1, 0x01, 0x00,	// scientificab U+007A (z)
+	0x00, 0x60, 0x42, 0xc8, 0x20, 0x84, 0x60, 0x00,	// scientificab U+007B ({)
+	0x00, 0x00, 0x42, 0x08, 0x21, 0x84, 0x00, 0x00,	// scientificab U+007C (|)
+	0x00, 0x0c, 0x42, 0x08, 0x26, 0x84, 0x0c, 0x00,	// scientificab U+007D (})
+	0x00, 0x00, 0x00, 0x44, 0x45, 0x00, 0x00, 0x00,	// scientificab U+007E (~)
+	0x00, 0x00, 0x93, 0x4e, 0x72, 0xc9, 0x00, 0x00,	// scientificab U+00A7 (§)
+	0x00, 0x00, 0x26, 0x5b, 0x69, 0x92, 0x01, 0x00,	// scientificab U+00A9 (©)
+	0x00, 0x00, 0x00, 0x54, 0x29, 0x0a, 0x00, 0x00,	// scientificab U+00AB («)
+	0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x00,	// scientificab U+00AC (¬)
+	0x00, 0x00, 0x26, 0x5b, 0x29, 0x92, 0x01, 0x00,	// scientificab U+00AE (®)
+	0x00, 0x00, 0x40, 0xc8, 0x27, 0xe4, 0x03, 0x00,	// scientificab U+00B1 (±)
+	0x00, 0x00, 0x83, 0x88, 0x03, 0x00, 0x00, 0x00,	// scientificab U+00B2 (²)
+	0x00, 0x00, 0x00, 0x8a, 0x52, 0x05, 0x00, 0x00,	// scientificab U+00BB (»)
+	0x00, 0x00, 0x42, 0xc0, 0x03, 0xca, 0x21, 0x00,	// scientificab U+00BC (¼)
+	0x00, 0x00, 0x42, 0xc0, 0x03, 0x44, 0x11, 0x07,	// scientificab U+00BD (½)
+	0xc0, 0x21, 0x86, 0x1c, 0x78, 0x40, 0x39, 0x04,	// scientificab U+00BE (¾)
+	0x00, 0x00, 0x02, 0x08, 0x19, 0xc1, 0x01, 0x00,	// scientificab U+00BF (¿)
+	0x00, 0x08, 0x02, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E0 (à)
+	0x00, 0x10, 0x01, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E1 (á)
+	0x00, 0x10, 0x05, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E2 (â)
+	0x00, 0x50, 0x05, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E3 (ã)
+	0x00, 0x80, 0x04, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E4 (ä)
+	0x00, 0x00, 0x02, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+00E5 (å)
+	0x00, 0x04, 0x01, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+00EC (ì)
+	0x00, 0x10, 0x01, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+00ED (í)
+	0x00, 0x88, 0x02, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+00EE (î)
+	0x00, 0x80, 0x02, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+00EF (ï)
+	0x00, 0x00, 0x07, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+0101 (ā)
+	0x00, 0x24, 0x03, 0x5c, 0x4a, 0xc9, 0x01, 0x00,	// scientificab U+0103 (ă)
+	0x00, 0x00, 0x00, 0x5c, 0x4a, 0xc9, 0x11, 0x06,	// scientificab U+0105 (ą)
+	0x00, 0xa8, 0x02, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+0129 (ĩ)
+	0x00, 0x80, 0x03, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+012B (ī)
+	0x00, 0x24, 0x03, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+012D (ĭ)
+	0x00, 0x00, 0x01, 0x86, 0x10, 0xc2, 0x84, 0x01,	// scientificab U+012F (į)
+	0x00, 0x00, 0x00, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+0131 (ı)
+	0x80, 0x88, 0x21, 0x84, 0x10, 0x82, 0x00, 0x00,	// scientificab U+013A (ĺ)
+	0x00, 0x80, 0x21, 0x84, 0x10, 0x82, 0x88, 0x01,	// scientificab U+013C (ļ)
+	0x00, 0x80, 0xa5, 0x84, 0x10, 0x82, 0x00, 0x00,	// scientificab U+013E (ľ)
+	0x00, 0x00, 0x30, 0x84, 0x12, 0x82, 0x00, 0x00,	// scientificab U+0140 (ŀ)
+	0x00, 0x80, 0xa1, 0x8c, 0x18, 0x82, 0x00, 0x00,	// scientificab U+0142 (ł)
+	0x80, 0x88, 0x93, 0xd2, 0x29, 0x25, 0x01, 0x00,	// scientificab U+0154 (Ŕ)
+	0x00, 0x80, 0x93, 0xd2, 0x29, 0x25, 0x89, 0x00,	// scientificab U+0156 (Ŗ)
+	0x40, 0x91, 0x93, 0xd2, 0x29, 0x25, 0x01, 0x00,	// scientificab U+0158 (Ř)
+	0x40, 0x14, 0x47, 0x08, 0x21, 0x04, 0x01, 0x00,	// scientificab U+01AA (ƪ)
+	0x00, 0x00, 0x21, 0x8e, 0x10, 0x82, 0x21, 0x02,	// scientificab U+01AB (ƫ)
+	0x80, 0x08, 0x21, 0x8e, 0x10, 0x82, 0x00, 0x00,	// scientificab U+01AD (ƭ)
+	0x00, 0x14, 0x01, 0x86, 0x10, 0x82, 0x00, 0x00,	// scientificab U+01D0 (ǐ)
+	0xa0, 0x28, 0x70, 0xd2, 0x29, 0x25, 0x01, 0x00,	// scientificab U+0210 (Ȑ)
+	0x00, 0x00, 0x21, 0x8e, 0x10, 0x82, 0x10, 0x01,	// scientificab U+021B (ț)
+	0x00, 0x80, 0x51, 0xca, 0x49, 0xe9, 0x01, 0x00,	// scientificab U+0392 (Β)
+	0x00, 0x80, 0x97, 0x42, 0x08, 0x21, 0x00, 0x00,	// scientificab U+0393 (Γ)
+	0x00, 0x00, 0x42, 0x94, 0x8a, 0xf1, 0x03, 0x00,	// scientificab U+0394 (Δ)
+	0x00, 0x80, 0x17, 0xc2, 0x08, 0xe1, 0x01, 0x00,	// scientificab U+0395 (Ε)
+	0x00, 0x80, 0x94, 0x5e, 0x4a, 0x29, 0x01, 0x00,	// scientificab U+0397 (Η)
+	0x00, 0x80, 0x97, 0x04, 0x11, 0xe9, 0x01, 0x00,	// scientificab U+03A3 (Σ)
+	0x00, 0x00, 0x00, 0xc0, 0x10, 0x82, 0x00, 0x00,	// scientificab U+03B9 (ι)
+	0x00, 0x00, 0x20, 0x0a, 0x31, 0x29, 0x01, 0x00,	// scientificab U+03BB (λ)
+	0x00, 0x00, 0x40, 0x92, 0x52, 0x46, 0x00, 0x00,	// scientificab U+03BD (ν)
+	0x00, 0x00, 0x00, 0x9e, 0x52, 0x4a, 0x01, 0x00,	// scientificab U+03C0 (π)
+	0x00, 0x00, 0x30, 0x4a, 0x59, 0xe9, 0x85, 0x00,	// scientificab U+1E9E (ẞ)
+	0x00, 0x00, 0x23, 0x08, 0x00, 0x00, 0x00, 0x00,	// scientificab U+2018 (‘)
+	0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x00, 0x00,	// scientificab U+2019 (’)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x02,	// scientificab U+201A (‚)
+	0x00, 0x80, 0x57, 0x14, 0x00, 0x00, 0x00, 0x00,	// scientificab U+201C (“)
+	0x00, 0x80, 0xa7, 0x0a, 0x00, 0x00, 0x00, 0x00,	// scientificab U+201D (”)
+	0x00, 0x00, 0x00, 0x00, 0x78, 0xaa, 0x00, 0x00,	// scientificab U+201E („)
+	0x00, 0x00, 0x55, 0x1e, 0x00, 0x00, 0x00, 0x00,	// scientificab U+201F (‟)
+	0x00, 0x00, 0x00, 0xa8, 0xfc, 0x92, 0x02, 0x00,	// scientificab U+21A4 (↤)
+	0x00, 0x00, 0x00, 0x88, 0xab, 0xe4, 0x03, 0x00,	// scientificab U+21A5 (↥)
+	0x00, 0x00, 0x00, 0x4a, 0xfa, 0xa9, 0x00, 0x00,	// scientificab U+21A6 (↦)
+	0x00, 0x00, 0x84, 0x90, 0x7a, 0x02, 0x00, 0x00,	// scientificab U+21B2 (↲)
+	0x00, 0x80, 0x10, 0x42, 0x79, 0x04, 0x00, 0x00,	// scientificab U+21B3 (↳)
+	0x00, 0x80, 0x87, 0x10, 0x42, 0x1c, 0x01, 0x00,	// scientificab U+21B4 (↴)
+	0x00, 0x00, 0x00, 0xc8, 0x03, 0x4f, 0x00, 0x00,	// scientificab U+21C4 (⇄)
+	0x00, 0x00, 0x00, 0xc4, 0x03, 0x8f, 0x00, 0x00,	// scientificab U+21C6 (⇆)
+	0x00, 0x00, 0x00, 0xc4, 0x03, 0x4f, 0x00, 0x00,	// scientificab U+21C7 (⇇)
+	0x00, 0x00, 0x00, 0xc8, 0x03, 0x8f, 0x00, 0x00,	// scientificab U+21C9 (⇉)
+	0x00, 0x00, 0x80, 0x4c, 0x5b, 0x26, 0x00, 0x00,	// scientificab U+2205 (∅)
+	0x00, 0x00, 0xf0, 0x92, 0x10, 0xe9, 0x01, 0x00,	// scientificab U+2211 (∑)
+	0x00, 0x00, 0x00, 0x0e, 0x10, 0x47, 0x00, 0x00,	// scientificab U+2213 (∓)
+	0x00, 0x00, 0x46, 0x08, 0x21, 0xc5, 0x00, 0x00,	// scientificab U+221A (√)
+	0x00, 0x00, 0x00, 0x80, 0xaa, 0x55, 0x01, 0x00,	// scientificab U+221E (∞)
+	0x00, 0x00, 0x00, 0x54, 0x01, 0xaa, 0x00, 0x00,	// scientificab U+2248 (≈)
+	0x00, 0x00, 0x00, 0xd0, 0x23, 0x2f, 0x00, 0x00,	// scientificab U+2260 (≠)
+	0x00, 0x00, 0x00, 0x1e, 0x78, 0xe0, 0x01, 0x00,	// scientificab U+2261 (≡)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0xee, 0x03, 0x00,	// scientificab U+23F6 (⏶)
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0x8e, 0x00, 0x00,	// scientificab U+23F7 (⏷)
+	0x00, 0x00, 0x40, 0x5c, 0xad, 0xd1, 0x01, 0x00,	// scientificab U+23FB (⏻)
+	0xc0, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0x07,	// scientificab U+2503 (┃)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f,	// scientificab U+2581 (▁)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f,	// scientificab U+2582 (▂)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0f,	// scientificab U+2583 (▃)
+	0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x0f,	// scientificab U+2584 (▄)
+	0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x0f,	// scientificab U+2585 (▅)
+	0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f,	// scientificab U+2586 (▆)
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,	// scientificab U+2587 (▇)
+	0xe0, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0xbd, 0x07,	// scientificab U+2589 (▉)
+	0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x84, 0x00,	// scientificab U+258F (▏)
+	0x20, 0x92, 0x48, 0x22, 0x89, 0x24, 0x92, 0x08,	// scientificab U+2591 (░)
+	0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a,	// scientificab U+2592 (▒)
+	0xa0, 0xee, 0xba, 0xeb, 0xae, 0xbb, 0xee, 0x0a,	// scientificab U+2593 (▓)
+	0x00, 0x00, 0x00, 0x80, 0x31, 0x00, 0x00, 0x00,	// scientificab U+25AA (▪)
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x0e, 0x00, 0x00,	// scientificab U+25B4 (▴)
+	0x00, 0x00, 0x00, 0x80, 0x49, 0xcf, 0x00, 0x00,	// scientificab U+25D2 (◒)
+	0x00, 0x00, 0x00, 0x80, 0x79, 0xc9, 0x00, 0x00,	// scientificab U+25D3 (◓)
+	0x00, 0x00, 0x00, 0x80, 0x69, 0xcf, 0x00, 0x00,	// scientificab U+25D5 (◕)
+	0x00, 0x00, 0x00, 0x80, 0x18, 0x43, 0x00, 0x00,	// scientificab U+25D6 (◖)
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x8c, 0x00, 0x00,	// scientificab U+25D7 (◗)
+	0x00, 0x00, 0x00, 0xde, 0x7a, 0x0f, 0x00, 0x00,	// scientificab U+25E7 (◧)
+	0x00, 0x00, 0x00, 0x5e, 0x6b, 0x0f, 0x00, 0x00,	// scientificab U+25E8 (◨)
+	0x00, 0x00, 0x00, 0xde, 0x5b, 0x0f, 0x00, 0x00,	// scientificab U+25E9 (◩)
+	0x00, 0x00, 0x00, 0x5e, 0x7b, 0x0f, 0x00, 0x00,	// scientificab U+25EA (◪)
+	0x00, 0x00, 0x00, 0x8c, 0xfb, 0x00, 0x00, 0x00,	// scientificab U+2601 (☁)
+	0x00, 0x00, 0x20, 0x84, 0x10, 0x63, 0x00, 0x00,	// scientificab U+2669 (♩)
+	0x00, 0x00, 0x60, 0x84, 0x10, 0x63, 0x00, 0x00,	// scientificab U+266A (♪)
+	0x00, 0x00, 0x20, 0xbd, 0x94, 0x7b, 0x03, 0x00,	// scientificab U+266B (♫)
+	0x00, 0x00, 0xe0, 0xa5, 0x97, 0x7b, 0x03, 0x00,	// scientificab U+266C (♬)
+	0x00, 0x00, 0x00, 0x71, 0x7a, 0x86, 0x00, 0x00,	// scientificab U+2714 (✔)
+	0x00, 0x00, 0x00, 0xb6, 0x23, 0x6e, 0x03, 0x00,	// scientificab U+2716 (✖)
+	0x00, 0x00, 0x00, 0x10, 0x5d, 0x14, 0x01, 0x00,	// scientificab U+291B (⤛)
+	0x00, 0x00, 0x00, 0x44, 0xd1, 0x45, 0x00, 0x00,	// scientificab U+291C (⤜)
+	0x00, 0x84, 0xf2, 0x4a, 0x39, 0x21, 0x00, 0x00,	// scientificab U+2B60 (⭠)
+	0x00, 0x84, 0x10, 0xc2, 0xe5, 0x94, 0x02, 0x00,	// scientificab U+2B61 (⭡)
+	0x00, 0x84, 0xf2, 0x4a, 0x19, 0x21, 0x00, 0x00,	// scientificab U+E0A0 ()
+	0x00, 0x84, 0x10, 0x86, 0x51, 0x4a, 0x01, 0x00,	// scientificab U+E0A1 ()
+	0x20, 0x8c, 0xf3, 0xfe, 0x7f, 0x67, 0x04, 0x00,	// scientificab U+E0B0 ()
+	0x20, 0x08, 0x82, 0x20, 0x44, 0x44, 0x04, 0x00,	// scientificab U+E0B1 ()
+	0x00, 0x62, 0xee, 0xff, 0xf7, 0x1c, 0x43, 0x00,	// scientificab U+E0B2 ()
+	0x00, 0x22, 0x22, 0x42, 0x10, 0x04, 0x41, 0x00,	// scientificab U+E0B3 ()
+}; // 1193
+
+static const uint16_t scientifica_ids[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+	64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+	80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 0,
+	95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 13, 107, 108, 109,
+	110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+	126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+	142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+	158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+	174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+	190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+	222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237,
+	238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253,
+	254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 146,
+	178, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+	284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 153,
+	292, 299, 300, 301, 302, 303, 304, 305, 306, 307, 306, 308, 309, 310, 311, 312,
+	313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328,
+	329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+	345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+	361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
+	377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+	393, 394, 395, 396, 397, 398, 399, 400, 401, 33, 34, 402, 403, 37, 404, 40,
+	405, 406, 407, 408, 409, 46, 410, 47, 411, 48, 412, 353, 413, 414, 415, 416,
+	417, 418, 419, 420, 421, 422, 423, 424, 342, 425, 426, 427, 428, 114, 429, 430,
+	79, 431, 432, 433, 434, 435, 85, 436, 437, 438, 439, 440, 441, 442, 443, 443,
+	13, 13, 444, 444, 445, 446, 447, 448, 449, 447, 450, 451, 452, 453, 454, 455,
+	456, 457, 14, 458, 459, 116, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469,
+	470, 108, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+	485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+	501, 502, 503, 504, 505, 506, 0, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+	516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+	532, 533, 534, 535, 536, 537, 538, 539, 540, 539, 541, 542, 543, 544, 13, 545,
+	546, 10, 547, 456, 548, 419, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558,
+	559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+	575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590,
+	591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 595, 601, 602, 598, 603, 604,
+	605, 606, 607, 608, 609, 610, 607, 611, 612, 613, 614, 615, 616, 617, 618, 619,
+	620, 621, 622, 623, 624, 625, 626, 627, 628, 607, 629, 630, 631, 632, 633, 634,
+	635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650,
+	651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+	667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682,
+	683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698,
+	699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714,
+	412, 715, 715, 716, 717, 718, 719, 720, 721, 722, 720, 723, 724, 621, 725, 726,
+	727, 728, 729, 622, 730, 731, 732, 733, 734, 735, 0, 736, 737, 738, 739, 740,
+	741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756,
+	757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772,
+	773, 774, 721, 625, 775, 776, 148, 777, 778, 779, 780, 781, 782, 783, 784, 785,
+	786, 787, 788, 789, 52, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800,
+	801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816,
+	817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832,
+	833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848,
+	849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864,
+	865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880,
+	881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896,
+	897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912,
+	913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928,
+	929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944,
+	945, 946, 947, 948, 949, 950, 951, 952, 953, 444, 954, 955, 956, 957, 958, 959,
+	960, 961, 962, 963, 964, 965, 444, 966, 955, 967, 968, 969, 970, 971, 972, 973,
+	974, 975, 976, 977, 978, 979, 980, 28, 981, 734, 728, 621, 622, 982, 983, 984,
+	985, 986, 987, 988, 989, 990, 768, 991, 992, 993, 575, 994, 967, 995, 996, 997,
+	998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 579, 1006, 1007, 1008, 1009, 1010,
+};
+static const uint16_t scientifica_chunks[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 0, 12, 13, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+	17, 18, 19, 0, 20, 0, 21, 22, 23, 24, 25, 26, 27, 0, 28, 29,
+	0, 0, 0, 0, 30, 31, 32, 33, 34, 35, 36, 0, 37, 38, 0, 39,
+	0, 40, 41, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	50, 51, 0, 52,
+};
+static const uint64_t scientifica_coverage[] = {
+	0x0000000000000000, 0xffffffff00000000, 0x7fffffffffffffff, 0xffffffff00000000,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x007fffffffffffff,
+	0x00000000001fff80, 0x000000000ffff000, 0x0000000001400000, 0x0000000004000080,
+	0x0000001000000000, 0xfffe03fffffe0000, 0x00000000000003ff, 0x3000000000000000,
+	0x0000000040000000, 0xdffc00ffffff0000, 0x0000000010038007, 0x0000150000000000,
+	0x0000000400000000, 0xfeff06f003ff0000, 0x00000000000f0fdf, 0x00f00f80679fffff,
+	0x0000003700300108, 0x00000bffc26000fc, 0x0000000000000070, 0x0000002000000000,
+	0x3c007ffff8000000, 0x0ff01e0000000000, 0x999999393ffffccf, 0x500fffffffff0804,
+	0x73fc0c06000e87fe, 0x000f0f8000ffc81f, 0x00ff000000000007, 0x04001e6200000000,
+	0x00000c0000000000, 0x0000400001f80000, 0x0003c00000000010, 0x000000007300001c,
+	0xfffffff000000000, 0xffffffffffffffff, 0xffffffffffffffff, 0x000000001e000000,
+	0x00000017c0000000, 0x000000000000000f, 0x0000000000000018, 0x0000000000010000,
+	0x003f0007c0000000, 0x000000000002007f, 0x3ffa000000000000, 0x4308000203800000,
+	0x0001e001dfe38000,
+};
+static const uint16_t scientifica_ranks[] = {
+	0, 0, 32, 95, 127, 191, 255, 319, 374, 388, 404, 406, 408, 409, 449, 459,
+	461, 462, 499, 506, 509, 510, 541, 556, 592, 601, 623, 626, 627, 651, 663, 705,
+	745, 774, 799, 810, 818, 820, 827, 832, 840, 868, 932, 996, 1000, 1006, 1010, 1012,
+	1013, 1024, 1032, 1044, 1052,
+};
+static const FBInkFont scientifica_font = {
+	.map =
+	    {
+		.chunks      = scientifica_chunks,
+		.coverage    = scientifica_coverage,
+		.ranks       = scientifica_ranks,
+		.chunk_count = 964U,
+	    },
+	.ids         = scientifica_ids,
+	.bitmaps     = scientifica_bitmaps,
+	.width       = 5U,
+	.height      = 12U,
+	.bitmap_size = 8U,
+};
+
+static const uint16_t scientificab_ids[] = {
+	0, 1, 2, 3, 1011, 5, 1012, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	1013, 17, 1014, 531, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 27, 1022, 1023, 1024, 1025,
+	1026, 1027, 1028, 1029, 36, 37, 38, 1030, 40, 406, 1031, 1032, 44, 409, 46, 1033,
+	1034, 1035, 1036, 1037, 413, 1038, 54, 340, 416, 1039, 1040, 1041, 60, 1042, 62, 63,
+	463, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 77, 1055, 1056,
+	1057, 1058, 1059, 1060, 1061, 1062, 86, 87, 88, 1063, 1064, 1065, 1066, 1067, 1068, 0,
+	95, 96, 97, 98, 99, 100, 1069, 102, 1070, 104, 1071, 1072, 13, 1073, 108, 109,
+	1074, 1075, 112, 113, 114, 115, 116, 117, 118, 119, 1076, 1077, 1078, 1079, 1080, 125,
+	126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+	142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 1081,
+	1082, 1083, 1084, 1085, 1086, 163, 164, 165, 166, 167, 168, 1087, 1088, 1089, 1090, 173,
+	174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+	1091, 191, 1092, 193, 1093, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205,
+	206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+	222, 223, 224, 225, 226, 227, 228, 229, 1094, 231, 1095, 233, 1096, 235, 1097, 237,
+	1098, 239, 240, 241, 242, 243, 244, 245, 246, 1099, 248, 1100, 250, 1101, 252, 1102,
+	254, 1103, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 146,
+	178, 269, 270, 1104, 272, 1105, 274, 1106, 276, 277, 278, 279, 280, 281, 282, 283,
+	284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 153,
+	292, 299, 300, 301, 302, 303, 304, 305, 306, 307, 306, 308, 309, 310, 311, 312,
+	313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328,
+	329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+	345, 346, 347, 348, 349, 350, 351, 352, 353, 1107, 1108, 356, 1109, 358, 359, 360,
+	361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 1110,
+	377, 378, 379, 380, 381, 382, 383, 384, 1111, 386, 388, 389, 390, 391, 392, 393,
+	394, 395, 1112, 397, 399, 400, 401, 33, 1113, 1114, 1115, 1116, 404, 1117, 405, 406,
+	407, 408, 409, 46, 410, 47, 411, 48, 412, 1118, 413, 414, 415, 416, 417, 418,
+	419, 420, 421, 422, 423, 424, 342, 425, 1119, 427, 1120, 114, 1121, 430, 79, 1122,
+	432, 433, 434, 435, 85, 436, 437, 438, 439, 440, 441, 1123, 443, 443, 13, 13,
+	444, 444, 445, 446, 1124, 1125, 1126, 468, 1127, 1128, 1129, 1130, 454, 455, 541, 457,
+	14, 458, 459, 116, 460, 461, 462, 463, 464, 465, 466, 467, 468, 470, 108, 471,
+	472, 473, 474, 475, 476, 477, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+	491, 492, 1131, 1132, 1133, 1132, 497, 498, 500, 1134, 1135, 1136, 0, 507, 508, 509,
+	510, 511, 512, 513, 514, 515, 516, 1137, 1138, 1139, 1140, 524, 525, 526, 527, 528,
+	529, 530, 531, 532, 1141, 534, 535, 538, 537, 538, 539, 540, 539, 541, 542, 543,
+	1142, 13, 1143, 546, 721, 625, 1144, 419, 1145, 552, 553, 554, 555, 556, 557, 558,
+	1146, 1147, 1148, 566, 567, 0, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577,
+	578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 611,
+	612, 613, 614, 615, 616, 617, 618, 734, 728, 1149, 1150, 986, 987, 988, 1151, 627,
+	628, 607, 1152, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644,
+	645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+	661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+	677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692,
+	693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 706, 707, 1153, 1154, 1155, 1156,
+	1157, 1158, 1159, 412, 1160, 1160, 1161, 1162, 1163, 1164, 720, 721, 1165, 621, 725, 1166,
+	726, 727, 728, 729, 622, 730, 731, 732, 733, 734, 735, 0, 1167, 1168, 1169, 1170,
+	1171, 1172, 1173, 1174, 1175, 756, 1176, 758, 767, 768, 1177, 1178, 1179, 1180, 775, 1181,
+	148, 1182, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 52, 790,
+	791, 792, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+	832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+	848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+	864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879,
+	880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+	896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+	912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+	928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+	944, 945, 946, 947, 948, 949, 950, 1183, 1184, 953, 444, 1185, 1186, 956, 957, 958,
+	959, 960, 961, 962, 963, 964, 965, 444, 1187, 1188, 967, 1189, 1190, 1191, 1192, 974,
+	975, 976, 977, 978, 979, 980, 28, 981, 734, 728, 621, 622, 982, 983, 984, 985,
+	986, 987, 988, 989, 990, 768, 991, 992, 993, 575, 994, 967, 995, 996, 997, 998,
+	999, 1000, 1001, 1002, 1003, 1004, 1005, 579, 1006, 1007, 1008, 1009, 1010,
+};
+static const uint16_t scientificab_chunks[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 0, 12, 13, 14,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+	17, 18, 19, 0, 20, 0, 21, 22, 23, 24, 25, 26, 0, 0, 27, 28,
+	0, 0, 0, 0, 29, 30, 31, 32, 33, 34, 0, 0, 35, 36, 0, 37,
+	0, 38, 39, 40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 42, 43, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	48, 49, 0, 50,
+};
+static const uint64_t scientificab_coverage[] = {
+	0x0000000000000000, 0xffffffff00000000, 0x7fffffffffffffff, 0xffffffff00000000,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x007fffffffffffff,
+	0x00000000001fff80, 0x000000000ffbf000, 0x0000000000400000, 0x0000000004000080,
+	0x0000001000000000, 0xfffe03fffffe0000, 0x00000000000003ff, 0x3000000000000000,
+	0x0000000040000000, 0xd7fc00ffffff0000, 0x0000000000038007, 0x0000100000000000,
+	0x0000000400000000, 0xfe1e06f003ff0000, 0x00000000000f02df, 0x00f00e00671fffff,
+	0x0400003300000100, 0x00000bffc26000fc, 0x0000000000000070, 0x3c00000000000000,
+	0x0ff01e0000000000, 0x999999393ffffc0f, 0x5001ffffffff0804, 0x73dc0406000e87fe,
+	0x0000078000ec001f, 0x0000000000000007, 0x00001e2200000000, 0x0000400001f80000,
+	0x0003c00000000010, 0x000000007300001c, 0xe000000000000000, 0xffffffffffffffff,
+	0xffffffffffffffff, 0x000000001e000000, 0x00000017c0000000, 0x000000000000000f,
+	0x0000000000000018, 0x0000000000010000, 0x000f0007c0000000, 0x000000000002007f,
+	0x3ffa000000000000, 0x4308000203800000, 0x0001e001dfe38000,
+};
+static const uint16_t scientificab_ranks[] = {
+	0, 0, 32, 95, 127, 191, 255, 319, 374, 388, 403, 404, 406, 407, 447, 457,
+	459, 460, 496, 502, 503, 504, 531, 543, 576, 582, 604, 607, 611, 623, 663, 700,
+	727, 741, 744, 750, 757, 762, 770, 773, 837, 901, 905, 911, 915, 917, 918, 927,
+	935, 947, 955,
+};
+static const FBInkFont scientificab_font = {
+	.map =
+	    {
+		.chunks      = scientificab_chunks,
+		.coverage    = scientificab_coverage,
+		.ranks       = scientificab_ranks,
+		.chunk_count = 964U,
+	    },
+	.ids         = scientificab_ids,
+	.bitmaps     = scientifica_bitmaps,
+	.width       = 5U,
+	.height      = 12U,
+	.bitmap_size = 8U,
+};
 
@@ -0,0 +1,219 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Time our bitmask expansion kernels (c.f., fbink_expand.c) against their scalar LUT versions, for every pixel format.
+// Usage: make bench (or run Release/bench_expand on the device)
+// NOTE: We pull FBInk in as a single compilation unit, like the library itself,
+//       then pull fbink_expand.c in a second time, with the SIMD kernels disabled, and everything renamed.
+
+#include "../fbink.c"
+
+#include <sched.h>
+#include <time.h>
+
+#if defined(FBINK_EXPAND_NEON)
+#	define SIMD_KERNELS "NEON"
+#elif defined(FBINK_EXPAND_AVX2)
+#	define SIMD_KERNELS "SSE2/AVX2"
+#elif defined(FBINK_EXPAND_SSE2)
+#	define SIMD_KERNELS "SSE2"
+#else
+#	define SIMD_KERNELS "none"
+#endif
+
+#undef FBINK_EXPAND_NEON
+#undef FBINK_EXPAND_SSE2
+#undef FBINK_EXPAND_AVX2
+#define expand_init_luts   scalar_expand_init_luts
+#define set_mask_bits      scalar_set_mask_bits
+#define scale_glyph_mask   scalar_scale_glyph_mask
+#define expand_mask_Gray4  scalar_expand_mask_Gray4
+#define expand_mask_Gray8  scalar_expand_mask_Gray8
+#define expand_mask_RGB24  scalar_expand_mask_RGB24
+#define expand_mask_RGB32  scalar_expand_mask_RGB32
+#define expand_mask_RGB565 scalar_expand_mask_RGB565
+#define expand_mask        scalar_expand_mask
+#define expandLUT4         scalar_expandLUT4
+#define expandLUT8         scalar_expandLUT8
+#define expandLUT16        scalar_expandLUT16
+#define expandLUT32        scalar_expandLUT32
+// NOTE: Declared exactly like the real ones (c.f., fbink_expand.h), so that both copies of the kernels compile the same:
+//       a static LUT can't alias dst, which lets the compiler vectorize the scalar copies, but not the real ones...
+uint32_t scalar_expandLUT4[256] = { 0U };
+uint64_t scalar_expandLUT8[256] = { 0U };
+uint64_t scalar_expandLUT16[16] = { 0U };
+uint64_t scalar_expandLUT32[4]  = { 0U };
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../fbink_expand.c"
+#pragma GCC diagnostic pop
+#undef expand_init_luts
+#undef expand_mask_Gray4
+#undef expand_mask_Gray8
+#undef expand_mask_RGB24
+#undef expand_mask_RGB32
+#undef expand_mask_RGB565
+
+// A glyph is GLYPH_ROWS rows of GLYPH_BYTES mask bytes (i.e., a 16x32 glyph at x2)
+#define GLYPH_BYTES 4U
+#define GLYPH_ROWS  32U
+// NOTE: Plenty of short runs, rather than a few long ones, so that whatever gets in our way
+//       (another process, an interrupt, a frequency switch) only ever spoils a few of them.
+#define GLYPHS      10000U
+#define RUNS        51U
+
+typedef void (*ExpandKernel)(const uint8_t*, size_t, uint32_t, uint32_t, unsigned char*);
+
+static uint64_t
+    now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000U) + (uint64_t) ts.tv_nsec;
+}
+
+// Returns the average time it takes to expand a glyph, in ns
+static double
+    bench_kernel(ExpandKernel   kernel,
+		 uint32_t       fgP,
+		 uint32_t       bgP,
+		 const uint8_t* masks,
+		 size_t         mask_count,
+		 unsigned char* dst,
+		 uint32_t*      sum)
+{
+	const uint64_t start = now_ns();
+	for (uint32_t g = 0U; g < GLYPHS; g++) {
+		for (uint32_t y = 0U; y < GLYPH_ROWS; y++) {
+			const size_t offset = (((g * GLYPH_ROWS) + y) * GLYPH_BYTES) % mask_count;
+			(*kernel)(masks + offset, GLYPH_BYTES, fgP, bgP, dst + (y * GLYPH_BYTES * 32U));
+		}
+		// Make sure the compiler can't skip any of it
+		*sum += dst[g % (GLYPH_ROWS * GLYPH_BYTES * 32U)];
+	}
+	return (double) (now_ns() - start) / GLYPHS;
+}
+
+static int
+    cmp_double(const void* a, const void* b)
+{
+	const double x = *((const double*) a);
+	const double y = *((const double*) b);
+	return (x > y) - (x < y);
+}
+
+int
+    main(void)
+{
+	const struct
+	{
+		uint8_t      bpp;
+		const char*  name;
+		ExpandKernel kernel;
+		ExpandKernel scalar;
+		uint32_t     fgP;    // Packed pixels, as fbink_init's pack_pixel would (i.e., black on light gray)
+		uint32_t     bgP;
+	} formats[] = {
+		// NOTE: Formats without a SIMD kernel (Gray4 & RGB24, as well as Gray8 on x86)
+		//       run the same scalar code on both sides, so they should come out @ 1.00x, give or take the noise.
+		{ 4U, "Gray4", expand_mask_Gray4, scalar_expand_mask_Gray4, 0x00U, 0xA0U },
+		{ 8U, "Gray8", expand_mask_Gray8, scalar_expand_mask_Gray8, 0x00U, 0xAAU },
+		{ 16U, "RGB565", expand_mask_RGB565, scalar_expand_mask_RGB565, 0x0000U, 0xAD55U },
+		{ 24U, "RGB24", expand_mask_RGB24, scalar_expand_mask_RGB24, 0x000000U, 0xAAAAAAU },
+		{ 32U, "RGB32", expand_mask_RGB32, scalar_expand_mask_RGB32, 0xFF000000U, 0xFFAAAAAAU },
+	};
+
+	// Stay on the same core, so that the scheduler doesn't move us around between runs
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	const int cpu = sched_getcpu();
+	if (cpu >= 0) {
+		CPU_SET((size_t) cpu, &cpus);
+	}
+	if (cpu < 0 || sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+		fprintf(stderr, "[FBInk] Couldn't pin ourselves to a single core, results may be noisier than usual\n");
+	}
+
+	expand_init_luts();
+	scalar_expand_init_luts();
+
+	// A few KB worth of pseudo-random mask bytes, so the branch predictor doesn't get too cozy
+	uint8_t  masks[4096];
+	uint32_t seed = 0x2545F491U;
+	for (size_t i = 0U; i < sizeof(masks); i++) {
+		seed     = (seed * 1103515245U) + 12345U;
+		masks[i] = (uint8_t)(seed >> 16U);
+	}
+	// Room for a full glyph @ 32bpp
+	static unsigned char dst[GLYPH_ROWS * GLYPH_BYTES * 32U];
+	uint32_t             sum = 0U;
+
+	printf("Expanding %u glyphs of %ux%u pixels (SIMD kernels: %s)\n", GLYPHS, GLYPH_BYTES * 8U, GLYPH_ROWS, SIMD_KERNELS);
+	printf("%-8s %17s %17s %8s\n", "Format", "LUT (ns/glyph)", "Kernel (ns/glyph)", "Speedup");
+	for (size_t i = 0U; i < sizeof(formats) / sizeof(*formats); i++) {
+		// Same output, or it doesn't count
+		unsigned char a[GLYPH_BYTES * 32U];
+		unsigned char b[GLYPH_BYTES * 32U];
+		(*formats[i].kernel)(masks, GLYPH_BYTES, formats[i].fgP, formats[i].bgP, a);
+		(*formats[i].scalar)(masks, GLYPH_BYTES, formats[i].fgP, formats[i].bgP, b);
+		if (memcmp(a, b, (size_t)(GLYPH_BYTES * formats[i].bpp)) != 0) {
+			fprintf(stderr, "[FBInk] %s kernel doesn't match its LUT version!\n", formats[i].name);
+			return EXIT_FAILURE;
+		}
+
+		// Warm the caches (and the branch predictor) up first
+		bench_kernel(formats[i].scalar, formats[i].fgP, formats[i].bgP, masks, sizeof(masks), dst, &sum);
+		bench_kernel(formats[i].kernel, formats[i].fgP, formats[i].bgP, masks, sizeof(masks), dst, &sum);
+
+		// Time both sides back to back, a bunch of times, alternating which one goes first,
+		// so that neither of them consistently gets the short end of the stick.
+		// We report the best time of each, and the median of the speedups of each pair,
+		// which makes anything that slows a whole run down (e.g., another process) mostly cancel out.
+		double lut    = 0.0;
+		double kernel = 0.0;
+		double speedups[RUNS];
+		for (uint8_t run = 0U; run < RUNS; run++) {
+			const bool   lut_first = ((run & 0x01) == 0);
+			const double t         = bench_kernel(lut_first ? formats[i].scalar : formats[i].kernel,
+								  formats[i].fgP,
+								  formats[i].bgP,
+								  masks,
+								  sizeof(masks),
+								  dst,
+								  &sum);
+			const double u         = bench_kernel(lut_first ? formats[i].kernel : formats[i].scalar,
+								  formats[i].fgP,
+								  formats[i].bgP,
+								  masks,
+								  sizeof(masks),
+								  dst,
+								  &sum);
+			const double l         = lut_first ? t : u;
+			const double k         = lut_first ? u : t;
+			lut                    = (run == 0U || l < lut) ? l : lut;
+			kernel                 = (run == 0U || k < kernel) ? k : kernel;
+			speedups[run]          = l / k;
+		}
+		qsort(speedups, RUNS, sizeof(*speedups), cmp_double);
+		printf("%-8s %17.1f %17.1f %7.2fx\n", formats[i].name, lut, kernel, speedups[RUNS / 2U]);
+	}
+	// NOTE: Only there to keep the results alive ;).
+	return (sum == 0xDEADBEEFU) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
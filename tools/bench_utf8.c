@@ -0,0 +1,227 @@
+/*
+	FBInk: FrameBuffer eInker, a tool to print text & images on eInk devices (Kobo/Kindle)
+	Copyright (C) 2018 NiLuJe <ninuje@gmail.com>
+
+	----
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as
+	published by the Free Software Foundation, either version 3 of the
+	License, or (at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Time our UTF-8 decoder (c.f., fbink_utf8.c), with & without its SIMD ASCII fast path,
+// against the u8_nextchar loop it replaced, on ASCII, mixed, non-Latin & invalid input.
+// Usage: make bench (or run Release/bench_utf8 on the device)
+// NOTE: Like tools/bench_expand.c, we pull FBInk in as a single compilation unit,
+//       then pull fbink_utf8.c in a second time, with the SIMD fast path disabled, and everything renamed.
+
+#include "../fbink.c"
+
+#include <sched.h>
+#include <time.h>
+
+#if defined(FBINK_UTF8_NEON)
+#	define SIMD_PATH "NEON"
+#elif defined(FBINK_UTF8_SSE2)
+#	define SIMD_PATH "SSE2"
+#else
+#	define SIMD_PATH "none"
+#endif
+
+#undef FBINK_UTF8_NEON
+#undef FBINK_UTF8_SSE2
+#define utf8_decode_seq   scalar_utf8_decode_seq
+#define utf8_decode_multi scalar_utf8_decode_multi
+#define utf8_decode_ascii scalar_utf8_decode_ascii
+#define utf8_is_ascii_head scalar_utf8_is_ascii_head
+#define utf8_decode       scalar_utf8_decode
+#define utf8_next         scalar_utf8_next
+#define utf8Leads         scalar_utf8Leads
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "../fbink_utf8.c"
+#pragma GCC diagnostic pop
+#undef utf8_decode_seq
+#undef utf8_decode_multi
+#undef utf8_decode_ascii
+#undef utf8_is_ascii_head
+#undef utf8_decode
+#undef utf8_next
+#undef utf8Leads
+
+// Each input is INPUT_SIZE bytes, decoded PASSES times per run
+// NOTE: Plenty of short runs, rather than a few long ones, so that whatever gets in our way
+//       (another process, an interrupt, a frequency switch) only ever spoils a few of them.
+#define INPUT_SIZE (64U * 1024U)
+#define PASSES     8U
+#define RUNS       51U
+
+typedef size_t (*Decoder)(const char*, size_t, uint32_t*);
+
+static uint64_t
+    now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000000U) + (uint64_t) ts.tv_nsec;
+}
+
+// What fbink_print used to do
+static size_t
+    u8_nextchar_decode(const char* string, size_t len, uint32_t* dst)
+{
+	unsigned int i = 0U;
+	size_t       n = 0U;
+	uint32_t     c;
+
+	while (i < len && (c = u8_nextchar(string, &i)) != 0U) {
+		dst[n++] = c;
+	}
+	return n;
+}
+
+// Returns the throughput of a single run, in MB/s
+static double
+    bench_decoder(Decoder decoder, const char* input, uint32_t* dst, size_t* sum)
+{
+	const uint64_t start = now_ns();
+	for (uint32_t p = 0U; p < PASSES; p++) {
+		*sum += (*decoder)(input, INPUT_SIZE, dst);
+		// Make sure the compiler can't skip any of it
+		*sum += dst[p % 64U];
+	}
+	return ((double) INPUT_SIZE * PASSES) / ((double) (now_ns() - start) / 1000.0);
+}
+
+static int
+    cmp_double(const void* a, const void* b)
+{
+	const double x = *((const double*) a);
+	const double y = *((const double*) b);
+	return (x > y) - (x < y);
+}
+
+// Fill buf with copies of pattern (NUL-terminated, and never cutting a sequence in half)
+static void
+    fill_input(char* buf, const char* pattern)
+{
+	const size_t len = strlen(pattern);
+	size_t       i   = 0U;
+	while (i + len < INPUT_SIZE) {
+		memcpy(buf + i, pattern, len);
+		i += len;
+	}
+	memset(buf + i, ' ', INPUT_SIZE - i);
+	buf[INPUT_SIZE] = '\0';
+}
+
+int
+    main(void)
+{
+	static char     ascii[INPUT_SIZE + 1U];
+	static char     mixed[INPUT_SIZE + 1U];
+	static char     cyrillic[INPUT_SIZE + 1U];
+	static char     cjk[INPUT_SIZE + 1U];
+	static char     invalid[INPUT_SIZE + 1U];
+	static uint32_t dst[INPUT_SIZE];
+	size_t          sum = 0U;
+
+	// Stay on the same core, so that the scheduler doesn't move us around between runs
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	const int cpu = sched_getcpu();
+	if (cpu >= 0) {
+		CPU_SET((size_t) cpu, &cpus);
+	}
+	if (cpu < 0 || sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+		fprintf(stderr, "[FBInk] Couldn't pin ourselves to a single core, results may be noisier than usual\n");
+	}
+
+	// Log lines, which is what we mostly get thrown at us
+	fill_input(ascii, "[2018-06-12 21:42:07] KFMon: Spawned process 1337 (/mnt/onboard/.adds/koreader/koreader.sh)\n");
+	// Latin, Greek, Cyrillic, CJK & box drawing, with some ASCII in between
+	fill_input(mixed, "Déjà vu, naïve café — Ελληνικά, Кириллица, 日本語のテキスト, ┌─┐ and some ASCII. ");
+	// Two-byte & three-byte sequences, with as little ASCII as it gets in actual text
+	fill_input(cyrillic, "Съешь же ещё этих мягких французских булок, да выпей чаю. ");
+	fill_input(cjk, "吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。");
+	// Random bytes (but no NULs), which is mostly garbage
+	uint32_t seed = 0x2545F491U;
+	for (size_t i = 0U; i < INPUT_SIZE; i++) {
+		seed       = (seed * 1103515245U) + 12345U;
+		invalid[i] = (char) (1U + ((seed >> 16U) % 255U));
+	}
+	invalid[INPUT_SIZE] = '\0';
+
+	const struct
+	{
+		const char* name;
+		const char* input;
+	} inputs[] = {
+		{ "ASCII", ascii }, { "Mixed", mixed }, { "Cyrillic", cyrillic }, { "CJK", cjk }, { "Invalid", invalid },
+	};
+	const Decoder decoders[] = { u8_nextchar_decode, scalar_utf8_decode, utf8_decode };
+
+	printf("Decoding %u KB, %u times per run, %u runs (SIMD ASCII path: %s)\n",
+	       INPUT_SIZE / 1024U,
+	       PASSES,
+	       RUNS,
+	       SIMD_PATH);
+	printf("%-8s %12s %12s %12s %14s %14s\n", "", "u8_nextchar", "utf8_decode", "+ SIMD", "utf8_decode", "+ SIMD");
+	printf(
+	    "%-8s %12s %12s %12s %14s %14s\n", "Input", "(MB/s)", "(MB/s)", "(MB/s)", "/ u8_nextchar", "/ utf8_decode");
+	for (size_t i = 0U; i < sizeof(inputs) / sizeof(*inputs); i++) {
+		// Both flavors of utf8_decode had better agree
+		static uint32_t a[INPUT_SIZE];
+		static uint32_t b[INPUT_SIZE];
+		const size_t    na = utf8_decode(inputs[i].input, INPUT_SIZE, a);
+		const size_t    nb = scalar_utf8_decode(inputs[i].input, INPUT_SIZE, b);
+		if (na != nb || memcmp(a, b, na * sizeof(*a)) != 0) {
+			fprintf(stderr, "[FBInk] utf8_decode's SIMD path doesn't match its scalar version on %s input!\n",
+				inputs[i].name);
+			return EXIT_FAILURE;
+		}
+
+		// Warm the caches (and the branch predictor) up first
+		for (size_t d = 0U; d < sizeof(decoders) / sizeof(*decoders); d++) {
+			bench_decoder(decoders[d], inputs[i].input, dst, &sum);
+		}
+
+		// Time all three back to back, a bunch of times, rotating which one goes first,
+		// so that none of them consistently gets the short end of the stick.
+		// We report the best throughput of each, and the median of the speedups within each run,
+		// which makes anything that slows a whole run down (e.g., another process) mostly cancel out.
+		double best[3] = { 0.0 };
+		double vs_legacy[RUNS];
+		double vs_scalar[RUNS];
+		for (uint8_t run = 0U; run < RUNS; run++) {
+			double mbps[3];
+			for (uint8_t k = 0U; k < 3U; k++) {
+				const uint8_t d = (uint8_t)((run + k) % 3U);
+				mbps[d]         = bench_decoder(decoders[d], inputs[i].input, dst, &sum);
+				best[d]         = (mbps[d] > best[d]) ? mbps[d] : best[d];
+			}
+			vs_legacy[run] = mbps[1] / mbps[0];
+			vs_scalar[run] = mbps[2] / mbps[1];
+		}
+		qsort(vs_legacy, RUNS, sizeof(*vs_legacy), cmp_double);
+		qsort(vs_scalar, RUNS, sizeof(*vs_scalar), cmp_double);
+		printf("%-8s %12.1f %12.1f %12.1f %13.2fx %13.2fx\n",
+		       inputs[i].name,
+		       best[0],
+		       best[1],
+		       best[2],
+		       vs_legacy[RUNS / 2U],
+		       vs_scalar[RUNS / 2U]);
+	}
+	// NOTE: Only there to keep the results alive ;).
+	return (sum == 0xDEADBEEFU) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -2,22 +2,22 @@
 # -*- coding:utf-8 -*-
 #
 # Very naive script to build a C array out of Unifont's hex format.
-# Assumes 8x8 or 8x16 glyphs
 # Tested on Unscii & its fun variants (http://pelulamu.net/unscii/)
 # NOTE: You can probably get something working out of BDF fonts, either via gbdfed, bdfe, or Unifont's bdfimplode/unibdf2hex,
-#       but if the horizontal resolution is > 8, that implies code tweaks to handle it right.
-#       Right now, fontwidth <= 8 means we store an array of uint8_t, for a <= 16xN font an array of uint16_t,
-#       a <= 32xN one an array of uint32_t, and a <= 64xN one an array of uint64_t ;).
-#       This script currently handles <= 64, as does FBInk.
+#       provided you end up with fixed-width glyphs.
+#       Glyphs are bit-packed at their actual width (so a 6x12 glyph takes 9 bytes, not 12),
+#       row by row, LSB first, with each glyph starting on a byte boundary.
+#       This script currently handles widths <= 32 (and heights <= 32), as does FBInk.
 #       As for the conversion process itself, FontForge + gbdfed + a text editor should handle most common cases just fine ;).
-#       In case that wasn't clear, width of intermediary values are supported, it's just a bit of a waste of memory ;).
+#       Fonts of the same size that are converted together (e.g., the regular, bold & italic variants of a font)
+#       share a single pool of glyphs, so that identical glyphs are only stored once.
 #
 ##
 
 import re
 import sys
 
-# We'll send the C header to stdout, but our C if/else snippet to stderr... ;).
+# We'll send the C header (glyphs & codepoint map) to stdout, but our C getter to stderr... ;).
 # And then use your shell to handle the I/O redirections, because I'm lazy :D.
 # ./hextoc.py > ../fonts/unscii.h 2>> ../fbink_unscii.c
 def eprint(*args, **kwargs):
@@ -51,138 +51,160 @@ def hex2f32(v):
 	h = int(v, base=16)
 	return int(bin(h)[2:].zfill(32)[::-1], 2)
 
-def hex2f64(v):
-	h = int(v, base=16)
-	return int(bin(h)[2:].zfill(64)[::-1], 2)
-
+# Fonts of the same size, converted together, sharing a single pool of glyphs (named after the first one).
 fontwidth = 32
 fontheight = 32
-fontfile = "../fonts/block.hex"
-fontname = "block"
-
-print("/*")
-print("* C Header for use with https://github.com/NiLuJe/FBInk")
-print("* Converted from Hex font {}".format(fontfile))
-print("* With FBInk's tools/hextoc.py")
-print("*/")
-print("")
-
-blocknum = 0
-blockcount = 1
-blockcp = 0x0
-cp = 0x0
-prevcp = 0x0
-
-pat_cp = "([0-9a-fA-F]{4})"
-if fontwidth <= 8:
-	pat_rows = "([0-9a-fA-F]{2})" * fontheight
-elif fontwidth <= 16:
-	pat_rows = "([0-9a-fA-F]{4})" * fontheight
-elif fontwidth <= 32:
-	pat_rows = "([0-9a-fA-F]{8})" * fontheight
-elif fontwidth <= 64:
-	pat_rows = "([0-9a-fA-F]{16})" * fontheight
-else:
-	print("Unsupported font width (Must be <= 64)!")
+fonts = [
+	("block", "../fonts/block.hex"),
+]
+
+if fontwidth > 32 or fontheight > 32:
+	print("Unsupported font size (Must be <= 32x32)!")
 	exit(-1)
-fmt = re.compile(r"{}:{}".format(pat_cp, pat_rows))
-
-with open(fontfile, "r") as f:
-	for line in f:
-		m = fmt.match(line)
-		if m:
-			cp = m.group(1)
-			if int(cp, base=16) == prevcp + 0x1:
-				blockcount += 1
-			else:
-				if blocknum > 0:
-					print("}}; // {}".format(blockcount))
-					print("")
-					if blocknum == 1:
-						if fontwidth <= 8:
-							eprint("static const unsigned char*")
-						elif fontwidth <= 16:
-							eprint("static const uint16_t*")
-						elif fontwidth <= 32:
-							eprint("static const uint32_t*")
-						elif fontwidth <= 64:
-							eprint("static const uint64_t*")
-						else:
-							exit(-1)
-						eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-						eprint("{")
-						if int(blockcp, base=16) > 0:
-							eprint("\tif (codepoint >= {:#04x} && codepoint <= {:#04x}) {{".format(int(blockcp, base=16), prevcp))
-							eprint("\t\treturn {}_block{}[codepoint - {:#04x}];".format(fontname, blocknum, int(blockcp, base=16)))
-						else:
-							eprint("\tif (codepoint <= {:#04x}) {{".format(prevcp))
-							eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-					else:
-						eprint("\t}} else if (codepoint >= {:#04x} && codepoint <= {:#04x}) {{".format(int(blockcp, base=16), prevcp))
-						eprint("\t\treturn {}_block{}[codepoint - {:#04x}];".format(fontname, blocknum, int(blockcp, base=16)))
-				blocknum += 1
-				blockcount = 1
-				blockcp = cp
-				if fontwidth <= 8:
-					print("static const unsigned char {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 16:
-					print("static const uint16_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 32:
-					print("static const uint32_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				elif fontwidth <= 64:
-					print("static const uint64_t {}_block{}[][{}] = {{".format(fontname, blocknum, fontheight))
-				else:
-					exit(-1)
-
-			hcp = int(cp, base=16)
-			print(u"\t{", end='')
-			if fontwidth <= 8:
-				for i in range(fontheight):
-					print(u" {:#04x}".format(hex2f8(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			elif fontwidth <= 16:
-				for i in range(fontheight):
-					print(u" {:#06x}".format(hex2f16(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			elif fontwidth <= 32:
-				for i in range(fontheight):
-					print(u" {:#010x}".format(hex2f32(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			elif fontwidth <= 64:
-				for i in range(fontheight):
-					print(u" {:#018x}".format(hex2f64(m.group(i+2))), end='' if i+1 == fontheight else ',')
-			else:
-				exit(-1)
-			print(u" }},\t// U+{} ({})".format(cp, chr(hcp) if hcp >= 0x20 else "ESC"))
-			prevcp = int(cp, base=16)
-print("}}; // {}".format(blockcount))
-print("")
-
-# Handle single block fonts
-if blocknum == 1:
+# Bytes per glyph
+bitmapsize = (fontwidth * fontheight + 7) // 8
+
+# Parse a Hex font, returns a list of (codepoint, rows) tuples, sorted by codepoint
+# NOTE: Our glyph indices are assigned in codepoint order, so that's the order we store them in.
+def parse_hex(fontfile):
+	pat_cp = "([0-9a-fA-F]{4})"
 	if fontwidth <= 8:
-		eprint("static const unsigned char*")
+		pat_rows = "([0-9a-fA-F]{2})" * fontheight
+		conv = hex2f8
 	elif fontwidth <= 16:
-		eprint("static const uint16_t*")
-	elif fontwidth <= 32:
-		eprint("static const uint32_t*")
-	elif fontwidth <= 64:
-		eprint("static const uint64_t*")
+		pat_rows = "([0-9a-fA-F]{4})" * fontheight
+		conv = hex2f16
 	else:
-		exit(-1)
-	eprint("    {}_get_bitmap(uint32_t codepoint)".format(fontname))
-	eprint("{")
-	if int(blockcp, base=16) > 0:
-		eprint("\tif (codepoint >= {:#04x} && codepoint <= {:#04x}) {{".format(int(blockcp, base=16), prevcp))
-		eprint("\t\treturn {}_block{}[codepoint - {:#04x}];".format(fontname, blocknum, int(blockcp, base=16)))
-	else:
-		eprint("\tif (codepoint <= {:#04x}) {{".format(prevcp))
-		eprint("\t\treturn {}_block{}[codepoint];".format(fontname, blocknum))
-else:
-	# Otherwise, don't forget the final block ;)
-	eprint("\t}} else if (codepoint >= {:#04x} && codepoint <= {:#04x}) {{".format(int(blockcp, base=16), prevcp))
-	eprint("\t\treturn {}_block{}[codepoint - {:#04x}];".format(fontname, blocknum, int(blockcp, base=16)))
-
-eprint("\t} else {")
-eprint('\t\tfprintf(stderr, "[FBInk] Codepoint U+%04X is not covered by this font!\\n", codepoint);')
-eprint("\t\treturn {}_block1[0];".format(fontname))
-eprint("\t}")
-eprint("}")
-eprint("")
+		pat_rows = "([0-9a-fA-F]{8})" * fontheight
+		conv = hex2f32
+	fmt = re.compile(r"{}:{}".format(pat_cp, pat_rows))
+
+	glyphs = []
+	with open(fontfile, "r") as f:
+		for line in f:
+			m = fmt.match(line)
+			if m:
+				rows = [conv(m.group(i+2)) for i in range(fontheight)]
+				for row in rows:
+					if row >> fontwidth:
+						print("U+{} is wider than {} pixels!".format(m.group(1), fontwidth))
+						exit(-1)
+				glyphs.append((int(m.group(1), base=16), rows))
+	glyphs.sort(key=lambda g: g[0])
+	return glyphs
+
+# Pack a glyph's rows into bitmapsize bytes
+def pack_glyph(rows):
+	bits = 0
+	for y, row in enumerate(rows):
+		bits |= row << (y * fontwidth)
+	return bits.to_bytes(bitmapsize, byteorder="little")
+
+# Build the pool of glyphs for a list of (fontname, [(codepoint, rows)]) tuples,
+# returns it as a list of (packed, fontname, codepoint) tuples, along with each font's glyph index to bitmap index table.
+# NOTE: For a lone font, that table costs 2 bytes per glyph, so it's only worth it if there are enough duplicates.
+def build_pool(fontglyphs):
+	shared = len(fontglyphs) > 1
+	if not shared:
+		glyphs = fontglyphs[0][1]
+		dupes = len(glyphs) - len(set(pack_glyph(rows) for cp, rows in glyphs))
+		shared = dupes * bitmapsize > 2 * len(glyphs)
+	pool = []
+	poolids = {}
+	fontids = []
+	for fontname, glyphs in fontglyphs:
+		ids = []
+		for cp, rows in glyphs:
+			packed = pack_glyph(rows)
+			if not shared or packed not in poolids:
+				poolids[packed] = len(pool)
+				pool.append((packed, fontname, cp))
+				ids.append(len(pool) - 1)
+			else:
+				ids.append(poolids[packed])
+		fontids.append(ids)
+	return pool, fontids
+
+# Build the codepoint to glyph index map of a font (c.f., font_glyph_index in fbink.c), returns (chunks, coverage, ranks).
+# Codepoints are split in chunks of 64: for each of them, chunks points to a bitmap of the codepoints we cover,
+# and to the index of the first of those in our glyphs, so a glyph's index is that plus the amount of bits set
+# below it in the bitmap. That's two loads & a popcount, whatever the codepoint.
+# NOTE: The first bitmap is always empty, and is shared by every chunk we don't cover at all.
+def build_map(glyphs):
+	chunks = [0] * ((glyphs[-1][0] >> 6) + 1)
+	coverage = [0]
+	ranks = [0]
+	for i, (cp, rows) in enumerate(glyphs):
+		c = cp >> 6
+		if chunks[c] == 0:
+			chunks[c] = len(coverage)
+			coverage.append(0)
+			ranks.append(i)
+		coverage[chunks[c]] |= 1 << (cp & 0x3F)
+	return chunks, coverage, ranks
+
+def print_array(ctype, name, values, fmt, per_line):
+	print("static const {} {}[] = {{".format(ctype, name))
+	for i in range(0, len(values), per_line):
+		print("\t" + " ".join(fmt.format(v) + "," for v in values[i:i+per_line]))
+	print("};")
+
+# Emit the C header for a list of (fontname, [(codepoint, rows)]) tuples to stdout, and their getters to stderr
+def emit(fontglyphs):
+	poolname = fontglyphs[0][0]
+	pool, fontids = build_pool(fontglyphs)
+
+	# First, the pool of glyphs, one per line
+	print("static const uint8_t {}_bitmaps[] = {{".format(poolname))
+	for packed, fontname, cp in pool:
+		label = "U+{:04X} ({})".format(cp, chr(cp) if cp >= 0x20 else "ESC")
+		if len(fontglyphs) > 1:
+			label = "{} {}".format(fontname, label)
+		print("\t{},\t// {}".format(", ".join("{:#04x}".format(b) for b in packed), label))
+	print("}}; // {}".format(len(pool)))
+	print("")
+
+	for (fontname, glyphs), ids in zip(fontglyphs, fontids):
+		# The glyph index to bitmap index table, unless it's a no-op
+		if ids != list(range(len(ids))):
+			print_array("uint16_t", "{}_ids".format(fontname), ids, "{}", 16)
+
+		# Then, the codepoint to glyph index map
+		chunks, coverage, ranks = build_map(glyphs)
+		print_array("uint16_t", "{}_chunks".format(fontname), chunks, "{}", 16)
+		print_array("uint64_t", "{}_coverage".format(fontname), coverage, "{:#018x}", 4)
+		print_array("uint16_t", "{}_ranks".format(fontname), ranks, "{}", 16)
+
+		print("static const FBInkFont {}_font = {{".format(fontname))
+		print("\t.map =")
+		print("\t    {")
+		print("\t\t.chunks      = {}_chunks,".format(fontname))
+		print("\t\t.coverage    = {}_coverage,".format(fontname))
+		print("\t\t.ranks       = {}_ranks,".format(fontname))
+		print("\t\t.chunk_count = {}U,".format(len(chunks)))
+		print("\t    },")
+		print("\t.ids         = {},".format("{}_ids".format(fontname) if ids != list(range(len(ids))) else "NULL"))
+		print("\t.bitmaps     = {}_bitmaps,".format(poolname))
+		print("\t.width       = {}U,".format(fontwidth))
+		print("\t.height      = {}U,".format(fontheight))
+		print("\t.bitmap_size = {}U,".format(bitmapsize))
+		print("};")
+		print("")
+
+		# And finally, the getter, which is just a matter of unpacking the right glyph
+		eprint("static bool")
+		eprint("    {}_get_glyph(uint32_t codepoint, uint32_t* rows)".format(fontname))
+		eprint("{")
+		eprint("\treturn font_get_glyph(&{}_font, codepoint, rows);".format(fontname))
+		eprint("}")
+		eprint("")
+
+if __name__ == "__main__":
+	print("/*")
+	print("* C Header for use with https://github.com/NiLuJe/FBInk")
+	print("* Converted from Hex font{} {}".format("s" if len(fonts) > 1 else "", ", ".join(f for n, f in fonts)))
+	print("* With FBInk's tools/hextoc.py")
+	print("*/")
+	print("")
+
+	emit([(fontname, parse_hex(fontfile)) for fontname, fontfile in fonts])
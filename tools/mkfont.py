@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+# -*- coding:utf-8 -*-
+#
+# Build an FBInk font file (c.f., fbink_register_font) out of a PSF (1 or 2), BDF or Unifont hex font.
+# Shares the heavy lifting (bit-packing, glyph deduplication & codepoint map) with hextoc.py.
+# Usage: ./mkfont.py [-W WIDTH -H HEIGHT] INPUT OUTPUT
+# NOTE: Hex fonts don't tell us their glyph size, so we assume Unifont's 16px height, unless told otherwise,
+#       and guess the width from the size of the first glyph's rows, which are padded to a full byte (i.e., -W 6 for Orp).
+#       As with builtin fonts, glyphs can't be larger than 32x32.
+#
+# The format itself is dead simple, everything is little-endian, and every offset is from the start of the file
+# (c.f., FBInkFontFileHeader in fbink_types.h):
+#   a 52 bytes header,
+#   the map's chunks (uint16_t), coverage (uint64_t, 8 bytes aligned) & ranks (uint16_t),
+#   the glyph index to bitmap index table (uint16_t, optional),
+#   and finally, the bit-packed glyphs themselves.
+# That's laid out so that FBInk can simply mmap it, and only ever fault in the pages of the glyphs it actually uses.
+#
+##
+
+import argparse
+import gzip
+import struct
+
+import hextoc
+
+FONT_FILE_MAGIC = b"FBInkFnt"
+FONT_FILE_VERSION = 1
+
+# Open a (possibly gzipped, as is customary for console fonts) file
+def read_file(path):
+	with open(path, "rb") as f:
+		data = f.read()
+	if data[:2] == b"\x1f\x8b":
+		data = gzip.decompress(data)
+	return data
+
+# Turn rows of MSB first bytes (as used by PSF & BDF) into our LSB first row masks
+def mirror_row(v, nbits, width):
+	row = 0
+	for x in range(width):
+		if v >> (nbits - 1 - x) & 1:
+			row |= 1 << x
+	return row
+
+# PSF1 & PSF2, with their unicode tables, if any, returns (width, height, [(codepoint, rows)])
+def parse_psf(data):
+	if data[:2] == b"\x36\x04":
+		mode, charsize = data[2], data[3]
+		width, height, headersize = 8, charsize, 4
+		length = 512 if mode & 0x01 else 256
+		has_table = mode & 0x02 or mode & 0x04
+	elif data[:4] == b"\x72\xb5\x4a\x86":
+		version, headersize, flags, length, charsize, height, width = struct.unpack("<7I", data[4:32])
+		has_table = flags & 0x01
+	else:
+		print("Not a PSF font!")
+		exit(-1)
+
+	rowbytes = (width + 7) // 8
+	bitmaps = []
+	for i in range(length):
+		g = data[headersize + i * charsize:headersize + (i + 1) * charsize]
+		bitmaps.append([mirror_row(int.from_bytes(g[y * rowbytes:(y + 1) * rowbytes], "big"), rowbytes * 8, width) for y in range(height)])
+
+	# NOTE: We only care about single codepoints, not sequences.
+	cps = {}
+	if has_table:
+		pos = headersize + length * charsize
+		for i in range(length):
+			if data[:2] == b"\x36\x04":
+				while pos + 1 < len(data):
+					u = struct.unpack("<H", data[pos:pos + 2])[0]
+					pos += 2
+					if u == 0xFFFF:
+						break
+					if u == 0xFFFE:
+						# Skip the sequences
+						while pos + 1 < len(data) and struct.unpack("<H", data[pos:pos + 2])[0] != 0xFFFF:
+							pos += 2
+						continue
+					cps.setdefault(u, i)
+			else:
+				end = data.index(b"\xff", pos)
+				entry = data[pos:end].split(b"\xfe")[0]
+				pos = end + 1
+				for c in entry.decode("utf-8", errors="ignore"):
+					cps.setdefault(ord(c), i)
+	else:
+		for i in range(length):
+			cps[i] = i
+	return width, height, sorted((cp, bitmaps[i]) for cp, i in cps.items())
+
+# BDF, with each glyph placed in the font's bounding box, returns (width, height, [(codepoint, rows)])
+def parse_bdf(data):
+	glyphs = []
+	lines = iter(data.decode("latin-1").splitlines())
+	for line in lines:
+		tok = line.split()
+		if not tok:
+			continue
+		if tok[0] == "FONTBOUNDINGBOX":
+			fw, fh, fx, fy = map(int, tok[1:5])
+		elif tok[0] == "ENCODING":
+			cp = int(tok[1])
+		elif tok[0] == "BBX":
+			w, h, x, y = map(int, tok[1:5])
+		elif tok[0] == "BITMAP":
+			rows = [0] * fh
+			top = (fh + fy) - (y + h)
+			for r in range(h):
+				hexrow = next(lines).strip()
+				nbits = len(hexrow) * 4
+				v = int(hexrow, base=16)
+				for c in range(w):
+					dx = c + (x - fx)
+					dy = top + r
+					if v >> (nbits - 1 - c) & 1 and 0 <= dx < fw and 0 <= dy < fh:
+						rows[dy] |= 1 << dx
+			if cp >= 0:
+				glyphs.append((cp, rows))
+	return fw, fh, sorted(glyphs)
+
+def main():
+	parser = argparse.ArgumentParser(description="Build an FBInk font file out of a PSF, BDF or Unifont hex font.")
+	parser.add_argument("-W", "--width", type=int, help="glyph width (hex fonts only, default: guessed from the row size)")
+	parser.add_argument("-H", "--height", type=int, default=16, help="glyph height (hex fonts only, default: 16)")
+	parser.add_argument("input")
+	parser.add_argument("output")
+	args = parser.parse_args()
+
+	data = read_file(args.input)
+	if data[:2] == b"\x36\x04" or data[:4] == b"\x72\xb5\x4a\x86":
+		width, height, glyphs = parse_psf(data)
+	elif data.startswith(b"STARTFONT"):
+		width, height, glyphs = parse_bdf(data)
+	else:
+		# Unifont hex: guess the width from the first glyph, given the height
+		height = args.height
+		width = args.width or len(data.split(b"\n")[0].split(b":")[1].strip()) * 4 // height
+		hextoc.fontwidth = width
+		hextoc.fontheight = height
+		glyphs = hextoc.parse_hex(args.input)
+
+	if width > 32 or height > 32 or not glyphs:
+		print("Unsupported font (glyphs must be <= 32x32)!")
+		exit(-1)
+	for cp, rows in glyphs:
+		if any(row >> width for row in rows):
+			print("U+{:04X} is wider than {} pixels!".format(cp, width))
+			exit(-1)
+
+	hextoc.fontwidth = width
+	hextoc.fontheight = height
+	hextoc.bitmapsize = (width * height + 7) // 8
+	pool, fontids = hextoc.build_pool([("font", glyphs)])
+	ids = fontids[0]
+	chunks, coverage, ranks = hextoc.build_map(glyphs)
+	has_ids = ids != list(range(len(ids)))
+
+	# Lay it all out
+	offset = 52
+	chunks_offset = offset
+	offset += 2 * len(chunks)
+	offset = (offset + 7) & ~7
+	coverage_offset = offset
+	offset += 8 * len(coverage)
+	ranks_offset = offset
+	offset += 2 * len(ranks)
+	ids_offset = offset if has_ids else 0
+	offset += 2 * len(ids) if has_ids else 0
+	bitmaps_offset = offset
+
+	out = bytearray(struct.pack("<8sIBBBB9I",
+				    FONT_FILE_MAGIC,
+				    FONT_FILE_VERSION,
+				    width,
+				    height,
+				    hextoc.bitmapsize,
+				    0,
+				    len(chunks),
+				    len(coverage),
+				    len(glyphs),
+				    len(pool),
+				    chunks_offset,
+				    coverage_offset,
+				    ranks_offset,
+				    ids_offset,
+				    bitmaps_offset))
+	out += struct.pack("<{}H".format(len(chunks)), *chunks)
+	out += bytes(coverage_offset - len(out))
+	out += struct.pack("<{}Q".format(len(coverage)), *coverage)
+	out += struct.pack("<{}H".format(len(ranks)), *ranks)
+	if has_ids:
+		out += struct.pack("<{}H".format(len(ids)), *ids)
+	for packed, fontname, cp in pool:
+		out += packed
+
+	with open(args.output, "wb") as f:
+		f.write(out)
+	print("{}: {}x{}, {} glyphs ({} unique), {} bytes".format(args.output, width, height, len(glyphs), len(pool), len(out)))
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+# -*- coding:utf-8 -*-
+#
+# Trim our builtin fonts down to a subset of fonts & Unicode blocks, at build time (c.f., FONTS & RANGES in the Makefile).
+# Usage: ./subset_fonts.py --fonts "IBM LEGGIE" --ranges "latin" --output ../fonts/subset
+# NOTE: This works off the generated headers in fonts/ (so, not every font's original Hex/BDF source needs to be around),
+#       and re-emits them through hextoc.py, so the map & glyph pool of a subset are as tight as if it had been converted
+#       that way in the first place. Families that end up empty get an empty header.
+#       It also writes fonts.h, which tells FBInk which fonts (and which of font8x8's blocks) made the cut.
+#       A font always keeps its first glyph, since that's what we fall back to for codepoints it doesn't cover.
+#
+##
+
+import argparse
+import contextlib
+import io
+import os
+import re
+import sys
+
+import hextoc
+
+# Our generated headers, and the fonts they contain (enum name, C name), in order.
+HEADERS = [
+	("unscii", [("UNSCII", "unscii"), ("UNSCII_ALT", "alt"), ("UNSCII_THIN", "thin"), ("UNSCII_FANTASY", "fantasy"), ("UNSCII_MCR", "mcr")]),
+	("tall", [("UNSCII_TALL", "tall")]),
+	("block", [("BLOCK", "block")]),
+	("leggie", [("LEGGIE", "leggie")]),
+	("veggie", [("VEGGIE", "veggie")]),
+	("kates", [("KATES", "kates")]),
+	("fkp", [("FKP", "fkp")]),
+	("ctrld", [("CTRLD", "ctrld")]),
+	("orp", [("ORP", "orp"), ("ORPB", "orpb"), ("ORPI", "orpi")]),
+	("scientifica", [("SCIENTIFICA", "scientifica"), ("SCIENTIFICAB", "scientificab")]),
+	("scientificai", [("SCIENTIFICAI", "scientificai")]),
+]
+# The CLI's short names (c.f., fbink -F)
+ALIASES = {
+	"ALT": "UNSCII_ALT",
+	"THIN": "UNSCII_THIN",
+	"FANTASY": "UNSCII_FANTASY",
+	"MCR": "UNSCII_MCR",
+	"TALL": "UNSCII_TALL",
+}
+
+# Named sets of Unicode blocks
+# NOTE: Latin text is seldom *only* letters, so latin also pulls in General Punctuation (quotes, dashes, ellipsis)
+#       & Currency Symbols (€).
+RANGES = {
+	"ascii": [(0x0000, 0x007F)],
+	"latin": [(0x0000, 0x024F), (0x1E00, 0x1EFF), (0x2000, 0x206F), (0x20A0, 0x20CF)],
+	"greek": [(0x0370, 0x03FF), (0x1F00, 0x1FFF)],
+	"cyrillic": [(0x0400, 0x052F)],
+	"punctuation": [(0x2000, 0x206F)],
+	"box": [(0x2500, 0x259F)],
+	"kana": [(0x3040, 0x30FF)],
+}
+
+# font8x8's blocks (c.f., font8x8_get_bitmap), minus basic, which is always built, since it's our ultimate fallback.
+FONT8X8_BLOCKS = [
+	("CONTROL", 0x0080, 0x009F),
+	("EXT_LATIN", 0x00A0, 0x00FF),
+	("GREEK", 0x0390, 0x03C9),
+	("BOX", 0x2500, 0x257F),
+	("BLOCK", 0x2580, 0x259F),
+	("HIRAGANA", 0x3040, 0x309F),
+]
+
+# Parse a list of range names and/or hex codepoints & ranges (e.g., "latin 2190-21FF 2713"), returns [(first, last)]
+def parse_ranges(spec):
+	ranges = []
+	for tok in spec.replace(",", " ").split():
+		if tok.lower() in RANGES:
+			ranges += RANGES[tok.lower()]
+			continue
+		m = re.fullmatch(r"(?:U\+)?([0-9a-fA-F]+)(?:-(?:U\+)?([0-9a-fA-F]+))?", tok)
+		if not m:
+			print("Unknown range '{}' (known ranges: {})".format(tok, ", ".join(RANGES)), file=sys.stderr)
+			exit(-1)
+		first = int(m.group(1), base=16)
+		ranges.append((first, int(m.group(2), base=16) if m.group(2) else first))
+	return ranges
+
+def in_ranges(cp, ranges):
+	return any(first <= cp <= last for first, last in ranges)
+
+# Parse one of our generated headers, returns a list of (fontname, width, height, [(codepoint, rows)])
+def parse_header(path):
+	with open(path, "r", encoding="utf-8") as f:
+		text = f.read()
+
+	arrays = {}
+	for m in re.finditer(r"static const uint(?:8|16|64)_t (\w+)\[\] = \{(.*?)\};", text, re.S):
+		body = re.sub(r"//[^\n]*", "", m.group(2))
+		arrays[m.group(1)] = [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+
+	fonts = []
+	for m in re.finditer(r"static const FBInkFont (\w+)_font = \{(.*?)\n\};", text, re.S):
+		name, body = m.group(1), m.group(2)
+		field = lambda k: re.search(r"\.{}\s*= (\w+)".format(k), body).group(1)
+		width = int(field("width").rstrip("U"))
+		height = int(field("height").rstrip("U"))
+		bitmap_size = int(field("bitmap_size").rstrip("U"))
+		pool = arrays[field("bitmaps")]
+		ids = arrays[field("ids")] if field("ids") != "NULL" else None
+		chunks = arrays[name + "_chunks"]
+		coverage = arrays[name + "_coverage"]
+		ranks = arrays[name + "_ranks"]
+
+		glyphs = []
+		for c, ci in enumerate(chunks):
+			if ci == 0:
+				continue
+			assert ranks[ci] == len(glyphs)
+			for b in range(64):
+				if coverage[ci] >> b & 1:
+					cp = (c << 6) | b
+					i = len(glyphs)
+					bm = ids[i] if ids else i
+					bits = int.from_bytes(bytes(pool[bm * bitmap_size:(bm + 1) * bitmap_size]), byteorder="little")
+					rows = [(bits >> (y * width)) & ((1 << width) - 1) for y in range(height)]
+					glyphs.append((cp, rows))
+		fonts.append((name, width, height, glyphs))
+	return fonts
+
+def main():
+	parser = argparse.ArgumentParser(description="Trim FBInk's builtin fonts down to a subset of fonts & Unicode blocks.")
+	parser.add_argument("--fonts", default="", help="fonts to keep, by FONT_INDEX_T name (default: all)")
+	parser.add_argument("--ranges", default="", help="Unicode blocks to keep, by name or as hex ranges (default: all)")
+	parser.add_argument("--output", required=True, help="where to write the trimmed headers")
+	args = parser.parse_args()
+
+	known = [enum for header, members in HEADERS for enum, name in members]
+	wanted = set()
+	for tok in args.fonts.upper().replace(",", " ").split():
+		tok = ALIASES.get(tok, tok)
+		if tok == "IBM":
+			# Always built
+			continue
+		if tok not in known:
+			print("Unknown font '{}' (known fonts: IBM, {})".format(tok, ", ".join(known)), file=sys.stderr)
+			exit(-1)
+		wanted.add(tok)
+	if not args.fonts.strip():
+		wanted = set(known)
+	ranges = parse_ranges(args.ranges) if args.ranges.strip() else [(0x0000, 0x10FFFF)]
+
+	srcdir = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "fonts")
+	os.makedirs(args.output, exist_ok=True)
+	for header, members in HEADERS:
+		fontglyphs = []
+		width = height = 0
+		keep = [name for enum, name in members if enum in wanted]
+		if keep:
+			for name, width, height, glyphs in parse_header(os.path.join(srcdir, header + ".h")):
+				if name in keep:
+					fontglyphs.append((name, [g for i, g in enumerate(glyphs) if i == 0 or in_ranges(g[0], ranges)]))
+
+		out = io.StringIO()
+		with contextlib.redirect_stdout(out):
+			print("/*")
+			print("* C Header for use with https://github.com/NiLuJe/FBInk")
+			print("* Subset of fonts/{}.h (fonts: {}; ranges: {})".format(header, " ".join(keep) or "none", args.ranges.strip() or "all"))
+			print("* With FBInk's tools/subset_fonts.py")
+			print("*/")
+			print("")
+			if fontglyphs:
+				hextoc.fontwidth = width
+				hextoc.fontheight = height
+				hextoc.bitmapsize = (width * height + 7) // 8
+				# NOTE: We don't need the getters, they're already in fbink_*.c
+				with contextlib.redirect_stderr(io.StringIO()):
+					hextoc.emit(fontglyphs)
+		with open(os.path.join(args.output, header + ".h"), "w", encoding="utf-8") as f:
+			f.write(out.getvalue())
+
+	# And the list of what we kept, for the C side of things
+	with open(os.path.join(args.output, "fonts.h"), "w", encoding="utf-8") as f:
+		f.write("/*\n")
+		f.write("* Font subset for use with https://github.com/NiLuJe/FBInk (c.f., FBINK_FONTS_SUBSET)\n")
+		f.write("* With FBInk's tools/subset_fonts.py\n")
+		f.write("*/\n")
+		f.write("\n")
+		for enum in known:
+			if enum in wanted:
+				f.write("#define FBINK_WITH_FONT_{}\n".format(enum))
+		for block, first, last in FONT8X8_BLOCKS:
+			if any(f <= last and first <= l for f, l in ranges):
+				f.write("#define FBINK_WITH_FONT8X8_{}\n".format(block))
+
+if __name__ == "__main__":
+	main()